@@ -84,6 +84,14 @@ void FunctionSpaceImpl::haloExchange( Field&, bool ) const {
     NOTIMP;
 }
 
+void FunctionSpaceImpl::adjointHaloExchange( FieldSet& ) const {
+    NOTIMP;
+}
+
+void FunctionSpaceImpl::adjointHaloExchange( Field& ) const {
+    NOTIMP;
+}
+
 Field NoFunctionSpace::createField( const eckit::Configuration& ) const {
     NOTIMP;
 }
@@ -135,6 +143,14 @@ void FunctionSpace::haloExchange( FieldSet& fields, bool on_device ) const {
     return functionspace_->haloExchange( fields, on_device );
 }
 
+void FunctionSpace::adjointHaloExchange( Field& field ) const {
+    return functionspace_->adjointHaloExchange( field );
+}
+
+void FunctionSpace::adjointHaloExchange( FieldSet& fields ) const {
+    return functionspace_->adjointHaloExchange( fields );
+}
+
 // ------------------------------------------------------------------
 
 }  // namespace atlas
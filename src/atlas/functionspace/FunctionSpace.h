@@ -84,6 +84,9 @@ public:
     virtual void haloExchange( FieldSet&, bool /*on_device*/ = false ) const;
     virtual void haloExchange( Field&, bool /* on_device*/ = false ) const;
 
+    virtual void adjointHaloExchange( FieldSet& ) const;
+    virtual void adjointHaloExchange( Field& ) const;
+
     virtual idx_t size() const = 0;
 
 private:
@@ -180,6 +183,9 @@ public:
     void haloExchange( FieldSet&, bool on_device = false ) const;
     void haloExchange( Field&, bool on_device = false ) const;
 
+    void adjointHaloExchange( FieldSet& ) const;
+    void adjointHaloExchange( Field& ) const;
+
     idx_t size() const { return functionspace_->size(); };
 };
 
@@ -386,6 +386,25 @@ void dispatch_haloExchange( Field& field, const parallel::HaloExchange& halo_exc
         throw eckit::Exception( "datatype not supported", Here() );
     field.set_dirty( false );
 }
+
+template <int RANK>
+void dispatch_adjointHaloExchange( Field& field, const parallel::HaloExchange& halo_exchange ) {
+    if ( field.datatype() == array::DataType::kind<int>() ) {
+        halo_exchange.template execute_adjoint<int, RANK>( field.array() );
+    }
+    else if ( field.datatype() == array::DataType::kind<long>() ) {
+        halo_exchange.template execute_adjoint<long, RANK>( field.array() );
+    }
+    else if ( field.datatype() == array::DataType::kind<float>() ) {
+        halo_exchange.template execute_adjoint<float, RANK>( field.array() );
+    }
+    else if ( field.datatype() == array::DataType::kind<double>() ) {
+        halo_exchange.template execute_adjoint<double, RANK>( field.array() );
+    }
+    else
+        throw eckit::Exception( "datatype not supported", Here() );
+    field.set_dirty( true );
+}
 }  // namespace
 
 void NodeColumns::haloExchange( FieldSet& fieldset, bool on_device ) const {
@@ -415,6 +434,34 @@ void NodeColumns::haloExchange( Field& field, bool on_device ) const {
     fieldset.add( field );
     haloExchange( fieldset, on_device );
 }
+
+void NodeColumns::adjointHaloExchange( FieldSet& fieldset ) const {
+    for ( idx_t f = 0; f < fieldset.size(); ++f ) {
+        Field& field = fieldset[f];
+        switch ( field.rank() ) {
+            case 1:
+                dispatch_adjointHaloExchange<1>( field, halo_exchange() );
+                break;
+            case 2:
+                dispatch_adjointHaloExchange<2>( field, halo_exchange() );
+                break;
+            case 3:
+                dispatch_adjointHaloExchange<3>( field, halo_exchange() );
+                break;
+            case 4:
+                dispatch_adjointHaloExchange<4>( field, halo_exchange() );
+                break;
+            default:
+                throw eckit::Exception( "Rank not supported", Here() );
+        }
+    }
+}
+
+void NodeColumns::adjointHaloExchange( Field& field ) const {
+    FieldSet fieldset;
+    fieldset.add( field );
+    adjointHaloExchange( fieldset );
+}
 const parallel::HaloExchange& NodeColumns::halo_exchange() const {
     if ( halo_exchange_ ) return *halo_exchange_;
     halo_exchange_ = NodeColumnsHaloExchangeCache::instance().get_or_create( mesh_, halo_.size() );
@@ -2097,6 +2144,14 @@ void NodeColumns::haloExchange( Field& field, bool on_device ) const {
     functionspace_->haloExchange( field, on_device );
 }
 
+void NodeColumns::adjointHaloExchange( FieldSet& fieldset ) const {
+    functionspace_->adjointHaloExchange( fieldset );
+}
+
+void NodeColumns::adjointHaloExchange( Field& field ) const {
+    functionspace_->adjointHaloExchange( field );
+}
+
 const parallel::HaloExchange& NodeColumns::halo_exchange() const {
     return functionspace_->halo_exchange();
 }
@@ -81,6 +81,8 @@ public:
 
     void haloExchange( FieldSet&, bool on_device = false ) const;
     void haloExchange( Field&, bool on_device = false ) const;
+    void adjointHaloExchange( FieldSet& ) const;
+    void adjointHaloExchange( Field& ) const;
     const parallel::HaloExchange& halo_exchange() const;
 
     void gather( const FieldSet&, FieldSet& ) const;
@@ -471,6 +473,8 @@ public:
 
     void haloExchange( FieldSet&, bool on_device = false ) const;
     void haloExchange( Field&, bool on_device = false ) const;
+    void adjointHaloExchange( FieldSet& ) const;
+    void adjointHaloExchange( Field& ) const;
     const parallel::HaloExchange& halo_exchange() const;
 
     void gather( const FieldSet&, FieldSet& ) const;
@@ -48,12 +48,25 @@ PointCloud::PointCloud( const Grid& grid ) {
     lonlat_     = Field( "lonlat", array::make_datatype<double>(), array::make_shape( grid.size(), 2 ) );
     auto lonlat = array::make_view<double, 2>( lonlat_ );
 
-    idx_t j{0};
-    for ( auto p : grid.lonlat() ) {
-        lonlat( j, 0 ) = p.lon();
-        lonlat( j, 1 ) = p.lat();
-        ++j;
+    grid::StructuredGrid structured_grid( grid );
+    if ( structured_grid ) {
+        structured_grid.parallel_for_each_row( [&]( const grid::StructuredGrid::Row& row ) {
+            for ( idx_t i = row.i_begin, n = row.n; i < row.i_end; ++i, ++n ) {
+                lonlat( n, 0 ) = row.x( i );
+                lonlat( n, 1 ) = row.y;
+            }
+        } );
     }
+    else {
+        idx_t j{0};
+        for ( auto p : grid.xy() ) {
+            lonlat( j, 0 ) = p.x();
+            lonlat( j, 1 ) = p.y();
+            ++j;
+        }
+    }
+    grid.projection().xy2lonlat( grid.size(), lonlat.data(), lonlat.data() + 1, lonlat.data(), lonlat.data() + 1,
+                                 lonlat.stride( 0 ) );
 }
 
 const Field& PointCloud::ghost() const {
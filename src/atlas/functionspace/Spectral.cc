@@ -8,6 +8,9 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <algorithm>
+#include <cmath>
+
 #include "eckit/os/BackTrace.h"
 #include "eckit/utils/MD5.h"
 
@@ -18,9 +21,11 @@
 #include "atlas/mesh/Mesh.h"
 #include "atlas/option.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/ErrorHandling.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/trans/Trans.h"
+#include "atlas/util/Earth.h"
 
 
 #if ATLAS_HAVE_TRANS
@@ -61,6 +66,12 @@ public:
     int nb_spectral_coefficients_global() const { return trans_->nspec2g; }
     int nb_spectral_coefficients() const { return trans_->nspec2; }
 
+    // total wavenumber of each local spectral coefficient
+    const int* nvalue() const {
+        if ( trans_->nvalue == NULL ) ::trans_inquire( trans_.get(), "nvalue" );
+        return trans_->nvalue;
+    }
+
     std::string distribution() const { return "trans"; }
     operator ::Trans_t*() const { return trans_.get(); }
     std::shared_ptr<::Trans_t> trans_;
@@ -71,6 +82,7 @@ public:
     Parallelisation( int truncation ) : truncation_( truncation ) {}
     int nb_spectral_coefficients_global() const { return ( truncation_ + 1 ) * ( truncation_ + 2 ); }
     int nb_spectral_coefficients() const { return nb_spectral_coefficients_global(); }
+    const int* nvalue() const { return nullptr; }
     int truncation_;
     std::string distribution() const { return "serial"; }
 };
@@ -340,6 +352,143 @@ void Spectral::norm( const Field& field, std::vector<double>& norm_per_level, in
 #endif
 }
 
+std::vector<int> Spectral::total_wavenumbers( idx_t nb_coefficients ) const {
+    std::vector<int> n( nb_coefficients );
+    const int* nvalue = parallelisation_->nvalue();
+    if ( nvalue && nb_coefficients == nb_spectral_coefficients() ) {
+        std::copy( nvalue, nvalue + nb_coefficients, n.begin() );
+        return n;
+    }
+    if ( nb_coefficients != nb_spectral_coefficients_global() ) {
+        std::stringstream err;
+        err << "Spectral field with " << nb_coefficients << " coefficients does not match truncation "
+            << truncation_;
+        throw eckit::BadValue( err.str(), Here() );
+    }
+    // global layout: for each zonal wavenumber m, total wavenumbers n = m .. truncation, real and imaginary parts
+    idx_t k = 0;
+    for ( int jm = 0; jm <= truncation_; ++jm ) {
+        for ( int jn = jm; jn <= truncation_; ++jn ) {
+            n[k++] = jn;
+            n[k++] = jn;
+        }
+    }
+    return n;
+}
+
+void Spectral::filter( const Field& in, Field& out, const std::vector<double>& factors ) const {
+    auto check = []( const Field& field ) {
+        if ( field.datatype() != array::DataType::str<double>() ) {
+            std::stringstream err;
+            err << "Cannot apply spectral operator to field " << field.name() << " of datatype "
+                << field.datatype().str() << ".";
+            err << "Only " << array::DataType::str<double>() << " supported.";
+            throw eckit::BadValue( err.str() );
+        }
+        ASSERT( field.rank() == 1 || ( field.rank() == 2 && field.stride( 1 ) == 1 ) );
+    };
+    check( in );
+    check( out );
+    ASSERT( in.shape() == out.shape() );
+    ASSERT( factors.size() > size_t( truncation_ ) );
+
+    const std::vector<int> n = total_wavenumbers( in.shape( 0 ) );
+    const idx_t nb_levels    = in.rank() == 2 ? in.shape( 1 ) : 1;
+    const idx_t in_stride    = in.stride( 0 );
+    const idx_t out_stride   = out.stride( 0 );
+    const double* in_data    = in.data<double>();
+    double* out_data         = out.data<double>();
+
+    // The coefficients of a zonal wavenumber are contiguous, so that threads get blocks of zonal wavenumbers,
+    // and the levels of a coefficient are contiguous, which vectorises the innermost loop
+    atlas_omp_parallel_for( idx_t k = 0; k < idx_t( n.size() ); ++k ) {
+        const double factor = factors[n[k]];
+        const double* in_k  = in_data + k * in_stride;
+        double* out_k       = out_data + k * out_stride;
+        for ( idx_t jlev = 0; jlev < nb_levels; ++jlev ) {
+            out_k[jlev] = factor * in_k[jlev];
+        }
+    }
+    out.set_dirty();
+}
+
+void Spectral::filter( const FieldSet& in, FieldSet& out, const std::vector<double>& factors ) const {
+    ASSERT( in.size() == out.size() );
+    for ( idx_t f = 0; f < in.size(); ++f ) {
+        filter( in[f], out[f], factors );
+    }
+}
+
+namespace {
+// Factors of the spectral operators for the total wavenumbers n = 0 .. truncation
+
+std::vector<double> laplacian_factors( int truncation ) {
+    const double radius = util::Earth::radius();
+    std::vector<double> factors( truncation + 1 );
+    for ( int jn = 0; jn <= truncation; ++jn ) {
+        factors[jn] = -jn * ( jn + 1. ) / ( radius * radius );
+    }
+    return factors;
+}
+
+std::vector<double> inverse_laplacian_factors( int truncation ) {
+    std::vector<double> factors = laplacian_factors( truncation );
+    factors[0]                  = 0.;
+    for ( int jn = 1; jn <= truncation; ++jn ) {
+        factors[jn] = 1. / factors[jn];
+    }
+    return factors;
+}
+
+std::vector<double> diffusion_factors( int truncation, double coefficient, int order ) {
+    std::vector<double> factors = laplacian_factors( truncation );
+    for ( int jn = 0; jn <= truncation; ++jn ) {
+        factors[jn] = 1. / ( 1. + coefficient * std::pow( -factors[jn], order ) );
+    }
+    return factors;
+}
+
+std::vector<double> truncation_factors( int truncation, int filter_truncation ) {
+    std::vector<double> factors( truncation + 1, 1. );
+    for ( int jn = std::max( 0, filter_truncation + 1 ); jn <= truncation; ++jn ) {
+        factors[jn] = 0.;
+    }
+    return factors;
+}
+}  // namespace
+
+void Spectral::laplacian( const Field& in, Field& out ) const {
+    filter( in, out, laplacian_factors( truncation_ ) );
+}
+
+void Spectral::laplacian( const FieldSet& in, FieldSet& out ) const {
+    filter( in, out, laplacian_factors( truncation_ ) );
+}
+
+void Spectral::inverse_laplacian( const Field& in, Field& out ) const {
+    filter( in, out, inverse_laplacian_factors( truncation_ ) );
+}
+
+void Spectral::inverse_laplacian( const FieldSet& in, FieldSet& out ) const {
+    filter( in, out, inverse_laplacian_factors( truncation_ ) );
+}
+
+void Spectral::horizontal_diffusion( const Field& in, Field& out, double coefficient, int order ) const {
+    filter( in, out, diffusion_factors( truncation_, coefficient, order ) );
+}
+
+void Spectral::horizontal_diffusion( const FieldSet& in, FieldSet& out, double coefficient, int order ) const {
+    filter( in, out, diffusion_factors( truncation_, coefficient, order ) );
+}
+
+void Spectral::truncate( const Field& in, Field& out, int truncation ) const {
+    filter( in, out, truncation_factors( truncation_, truncation ) );
+}
+
+void Spectral::truncate( const FieldSet& in, FieldSet& out, int truncation ) const {
+    filter( in, out, truncation_factors( truncation_, truncation ) );
+}
+
 }  // namespace detail
 
 // ----------------------------------------------------------------------
@@ -408,6 +557,46 @@ void Spectral::norm( const Field& field, std::vector<double>& norm_per_level, in
     functionspace_->norm( field, norm_per_level, rank );
 }
 
+void Spectral::laplacian( const Field& in, Field& out ) const {
+    functionspace_->laplacian( in, out );
+}
+
+void Spectral::laplacian( const FieldSet& in, FieldSet& out ) const {
+    functionspace_->laplacian( in, out );
+}
+
+void Spectral::inverse_laplacian( const Field& in, Field& out ) const {
+    functionspace_->inverse_laplacian( in, out );
+}
+
+void Spectral::inverse_laplacian( const FieldSet& in, FieldSet& out ) const {
+    functionspace_->inverse_laplacian( in, out );
+}
+
+void Spectral::horizontal_diffusion( const Field& in, Field& out, double coefficient, int order ) const {
+    functionspace_->horizontal_diffusion( in, out, coefficient, order );
+}
+
+void Spectral::horizontal_diffusion( const FieldSet& in, FieldSet& out, double coefficient, int order ) const {
+    functionspace_->horizontal_diffusion( in, out, coefficient, order );
+}
+
+void Spectral::truncate( const Field& in, Field& out, int truncation ) const {
+    functionspace_->truncate( in, out, truncation );
+}
+
+void Spectral::truncate( const FieldSet& in, FieldSet& out, int truncation ) const {
+    functionspace_->truncate( in, out, truncation );
+}
+
+void Spectral::filter( const Field& in, Field& out, const std::vector<double>& factors ) const {
+    functionspace_->filter( in, out, factors );
+}
+
+void Spectral::filter( const FieldSet& in, FieldSet& out, const std::vector<double>& factors ) const {
+    functionspace_->filter( in, out, factors );
+}
+
 // ----------------------------------------------------------------------
 
 extern "C" {
@@ -64,6 +64,21 @@ public:
     void norm( const Field&, double norm_per_level[], int rank = 0 ) const;
     void norm( const Field&, std::vector<double>& norm_per_level, int rank = 0 ) const;
 
+    void laplacian( const Field& in, Field& out ) const;
+    void laplacian( const FieldSet& in, FieldSet& out ) const;
+
+    void inverse_laplacian( const Field& in, Field& out ) const;
+    void inverse_laplacian( const FieldSet& in, FieldSet& out ) const;
+
+    void horizontal_diffusion( const Field& in, Field& out, double coefficient, int order = 2 ) const;
+    void horizontal_diffusion( const FieldSet& in, FieldSet& out, double coefficient, int order = 2 ) const;
+
+    void truncate( const Field& in, Field& out, int truncation ) const;
+    void truncate( const FieldSet& in, FieldSet& out, int truncation ) const;
+
+    void filter( const Field& in, Field& out, const std::vector<double>& factors ) const;
+    void filter( const FieldSet& in, FieldSet& out, const std::vector<double>& factors ) const;
+
 public:  // methods
     idx_t nb_spectral_coefficients() const;
     idx_t nb_spectral_coefficients_global() const;
@@ -78,6 +93,7 @@ private:  // methods
     idx_t config_levels( const eckit::Configuration& ) const;
     void set_field_metadata( const eckit::Configuration&, Field& ) const;
     size_t footprint() const;
+    std::vector<int> total_wavenumbers( idx_t nb_coefficients ) const;
 
 private:  // data
     idx_t nb_levels_;
@@ -115,6 +131,33 @@ public:
     void norm( const Field&, double norm_per_level[], int rank = 0 ) const;
     void norm( const Field&, std::vector<double>& norm_per_level, int rank = 0 ) const;
 
+    /// @brief Spectral-space operators
+    ///
+    /// They apply to the fields of this function space, with or without levels, holding either the local or
+    /// the global spectral coefficients, and depend on the total wavenumber n of each coefficient only.
+    /// Input and output may be the same fields. a is the Earth radius (util::Earth::radius()).
+
+    /// @brief out = Laplacian of in: coefficients multiplied by -n(n+1)/a^2
+    void laplacian( const Field& in, Field& out ) const;
+    void laplacian( const FieldSet& in, FieldSet& out ) const;
+
+    /// @brief out = inverse Laplacian of in: coefficients multiplied by -a^2/(n(n+1)), and zero for n = 0
+    void inverse_laplacian( const Field& in, Field& out ) const;
+    void inverse_laplacian( const FieldSet& in, FieldSet& out ) const;
+
+    /// @brief Implicit horizontal diffusion of the given order:
+    ///        out = in / ( 1 + coefficient * ( n(n+1)/a^2 )^order ), the coefficient including the time step
+    void horizontal_diffusion( const Field& in, Field& out, double coefficient, int order = 2 ) const;
+    void horizontal_diffusion( const FieldSet& in, FieldSet& out, double coefficient, int order = 2 ) const;
+
+    /// @brief out = in truncated: coefficients of n > truncation set to zero
+    void truncate( const Field& in, Field& out, int truncation ) const;
+    void truncate( const FieldSet& in, FieldSet& out, int truncation ) const;
+
+    /// @brief Isotropic filter: coefficients multiplied by factors[n], for n = 0 .. truncation()
+    void filter( const Field& in, Field& out, const std::vector<double>& factors ) const;
+    void filter( const FieldSet& in, FieldSet& out, const std::vector<double>& factors ) const;
+
     idx_t nb_spectral_coefficients() const;
     idx_t nb_spectral_coefficients_global() const;
     int truncation() const;
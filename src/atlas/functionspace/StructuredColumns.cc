@@ -403,17 +403,22 @@ StructuredColumns::StructuredColumns( const Grid& grid, const Vertical& vertical
     j_end_   = std::numeric_limits<idx_t>::min();
     i_begin_.resize( grid_.ny(), std::numeric_limits<idx_t>::max() );
     i_end_.resize( grid_.ny(), std::numeric_limits<idx_t>::min() );
-    idx_t c( 0 );
+    std::vector<idx_t> owned_in_row( grid_.ny(), 0 );
+    distribution.for_each_run( [&]( gidx_t begin, gidx_t end, int part ) {
+        if ( part != mpi_rank ) { return; }
+        grid_.for_each_row( begin, end, [&]( const grid::StructuredGrid::Row& row ) {
+            const idx_t j = row.j;
+            i_begin_[j]   = std::min<idx_t>( i_begin_[j], row.i_begin );
+            i_end_[j]     = std::max<idx_t>( i_end_[j], row.i_end );
+            owned_in_row[j] += row.size();
+        } );
+    } );
     idx_t owned( 0 );
     for ( idx_t j = 0; j < grid_.ny(); ++j ) {
-        for ( idx_t i = 0; i < grid_.nx( j ); ++i, ++c ) {
-            if ( distribution.partition( c ) == mpi_rank ) {
-                j_begin_    = std::min<idx_t>( j_begin_, j );
-                j_end_      = std::max<idx_t>( j_end_, j + 1 );
-                i_begin_[j] = std::min<idx_t>( i_begin_[j], i );
-                i_end_[j]   = std::max<idx_t>( i_end_[j], i + 1 );
-                ++owned;
-            }
+        if ( owned_in_row[j] ) {
+            j_begin_ = std::min<idx_t>( j_begin_, j );
+            j_end_   = std::max<idx_t>( j_end_, j + 1 );
+            owned += owned_in_row[j];
         }
     }
 
@@ -470,10 +475,8 @@ StructuredColumns::StructuredColumns( const Grid& grid, const Vertical& vertical
     };
 
     std::vector<gidx_t> global_offsets( grid_.ny() );
-    idx_t grid_idx = 0;
     for ( idx_t j = 0; j < grid_.ny(); ++j ) {
-        global_offsets[j] = grid_idx;
-        grid_idx += grid_.nx( j );
+        global_offsets[j] = grid_.index( 0, j );
     }
 
     auto compute_g = [this, &global_offsets, &compute_i, &compute_j]( idx_t i, idx_t j ) -> gidx_t {
@@ -1130,6 +1133,32 @@ void dispatch_haloExchange( Field& field, const parallel::HaloExchange& halo_exc
         throw eckit::Exception( "datatype not supported", Here() );
     field.set_dirty( false );
 }
+
+template <int RANK>
+void dispatch_adjointHaloExchange( Field& field, const parallel::HaloExchange& halo_exchange,
+                                   const StructuredColumns& fs ) {
+    // The vector fixup only flips signs of halo values, so it is its own adjoint
+    FixupHaloForVectors<RANK> fixup_halos( fs );
+    if ( field.datatype() == array::DataType::kind<int>() ) {
+        fixup_halos.template apply<int>( field );
+        halo_exchange.template execute_adjoint<int, RANK>( field.array() );
+    }
+    else if ( field.datatype() == array::DataType::kind<long>() ) {
+        fixup_halos.template apply<long>( field );
+        halo_exchange.template execute_adjoint<long, RANK>( field.array() );
+    }
+    else if ( field.datatype() == array::DataType::kind<float>() ) {
+        fixup_halos.template apply<float>( field );
+        halo_exchange.template execute_adjoint<float, RANK>( field.array() );
+    }
+    else if ( field.datatype() == array::DataType::kind<double>() ) {
+        fixup_halos.template apply<double>( field );
+        halo_exchange.template execute_adjoint<double, RANK>( field.array() );
+    }
+    else
+        throw eckit::Exception( "datatype not supported", Here() );
+    field.set_dirty( true );
+}
 }  // namespace
 
 void StructuredColumns::haloExchange( FieldSet& fieldset, bool ) const {
@@ -1160,6 +1189,34 @@ void StructuredColumns::haloExchange( Field& field, bool ) const {
     haloExchange( fieldset );
 }
 
+void StructuredColumns::adjointHaloExchange( FieldSet& fieldset ) const {
+    for ( idx_t f = 0; f < fieldset.size(); ++f ) {
+        Field& field = fieldset[f];
+        switch ( field.rank() ) {
+            case 1:
+                dispatch_adjointHaloExchange<1>( field, halo_exchange(), *this );
+                break;
+            case 2:
+                dispatch_adjointHaloExchange<2>( field, halo_exchange(), *this );
+                break;
+            case 3:
+                dispatch_adjointHaloExchange<3>( field, halo_exchange(), *this );
+                break;
+            case 4:
+                dispatch_adjointHaloExchange<4>( field, halo_exchange(), *this );
+                break;
+            default:
+                throw eckit::Exception( "Rank not supported", Here() );
+        }
+    }
+}
+
+void StructuredColumns::adjointHaloExchange( Field& field ) const {
+    FieldSet fieldset;
+    fieldset.add( field );
+    adjointHaloExchange( fieldset );
+}
+
 size_t StructuredColumns::footprint() const {
     size_t size = sizeof( *this );
     size += ij2gp_.footprint();
@@ -1224,6 +1281,14 @@ void StructuredColumns::haloExchange( Field& field, bool on_device ) const {
     functionspace_->haloExchange( field, on_device );
 }
 
+void StructuredColumns::adjointHaloExchange( FieldSet& fields ) const {
+    functionspace_->adjointHaloExchange( fields );
+}
+
+void StructuredColumns::adjointHaloExchange( Field& field ) const {
+    functionspace_->adjointHaloExchange( field );
+}
+
 std::string StructuredColumns::checksum( const FieldSet& fieldset ) const {
     return functionspace_->checksum( fieldset );
 }
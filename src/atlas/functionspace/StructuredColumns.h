@@ -74,6 +74,9 @@ public:
     virtual void haloExchange( FieldSet&, bool on_device = false ) const;
     virtual void haloExchange( Field&, bool on_device = false ) const;
 
+    virtual void adjointHaloExchange( FieldSet& ) const;
+    virtual void adjointHaloExchange( Field& ) const;
+
     idx_t sizeOwned() const { return size_owned_; }
     idx_t sizeHalo() const { return size_halo_; }
     virtual idx_t size() const { return size_halo_; }
@@ -309,6 +312,9 @@ public:
     virtual void haloExchange( FieldSet&, bool on_device = false ) const;
     virtual void haloExchange( Field&, bool on_device = false ) const;
 
+    virtual void adjointHaloExchange( FieldSet& ) const;
+    virtual void adjointHaloExchange( Field& ) const;
+
     std::string checksum( const FieldSet& ) const;
     std::string checksum( const Field& ) const;
 
@@ -9,6 +9,9 @@
  */
 
 #include <algorithm>
+#include <set>
+
+#include "eckit/exception/Exceptions.h"
 
 #include "atlas/grid/Distribution.h"
 #include "atlas/grid/Grid.h"
@@ -29,45 +32,101 @@ std::string distribution_type( int N, const Partitioner& p = Partitioner() ) {
 
 Distribution::impl_t::impl_t( const Grid& grid ) :
     nb_partitions_( 1 ),
-    part_( grid.size(), 0 ),
+    size_( grid.size() ),
+    compact_( true ),
     nb_pts_( nb_partitions_, grid.size() ),
     max_pts_( grid.size() ),
     min_pts_( grid.size() ),
-    type_( distribution_type( nb_partitions_ ) ) {}
+    type_( distribution_type( nb_partitions_ ) ) {
+    if ( size_ ) {
+        run_end_.assign( 1, size_ );
+        run_part_.assign( 1, 0 );
+    }
+}
 
 Distribution::impl_t::impl_t( const Grid& grid, const Partitioner& partitioner ) {
-    part_.resize( grid.size() );
-    partitioner.partition( grid, part_.data() );
     nb_partitions_ = partitioner.nb_partitions();
-    nb_pts_.resize( nb_partitions_, 0 );
-    for ( idx_t j = 0, size = part_.size(); j < size; ++j )
-        ++nb_pts_[part_[j]];
-    max_pts_ = *std::max_element( nb_pts_.begin(), nb_pts_.end() );
-    min_pts_ = *std::min_element( nb_pts_.begin(), nb_pts_.end() );
-    type_    = distribution_type( nb_partitions_, partitioner );
+    if ( partitioner.partition_runs( grid, run_end_, run_part_ ) ) {
+        ASSERT( run_end_.empty() ? grid.size() == 0 : run_end_.back() == grid.size() );
+        setup_runs();
+    }
+    else {
+        std::vector<int> part( grid.size() );
+        partitioner.partition( grid, part.data() );
+        setup( part );
+    }
+    type_ = distribution_type( nb_partitions_, partitioner );
 }
 
 Distribution::impl_t::impl_t( idx_t npts, int part[], int part0 ) {
-    part_.assign( part, part + npts );
-    std::set<int> partset( part_.begin(), part_.end() );
+    std::vector<int> partition( part, part + npts );
+    std::set<int> partset( partition.begin(), partition.end() );
     nb_partitions_ = partset.size();
+    for ( idx_t j = 0; j < npts; ++j ) {
+        partition[j] -= part0;
+    }
+    setup( partition );
+    type_ = distribution_type( nb_partitions_ );
+}
+
+void Distribution::impl_t::setup( std::vector<int>& part ) {
+    size_ = part.size();
     nb_pts_.resize( nb_partitions_, 0 );
-    for ( idx_t j = 0, size = part_.size(); j < size; ++j ) {
-        part_[j] -= part0;
-        ++nb_pts_[part_[j]];
+    size_t nb_runs = 0;
+    for ( gidx_t j = 0; j < size_; ++j ) {
+        ++nb_pts_[part[j]];
+        if ( j == 0 || part[j] != part[j - 1] ) { ++nb_runs; }
     }
     max_pts_ = *std::max_element( nb_pts_.begin(), nb_pts_.end() );
     min_pts_ = *std::min_element( nb_pts_.begin(), nb_pts_.end() );
-    type_    = distribution_type( nb_partitions_ );
+
+    // Store runs only when that saves memory
+    compact_ = nb_runs * ( sizeof( gidx_t ) + sizeof( int ) ) < part.size() * sizeof( int );
+    if ( compact_ ) {
+        run_end_.reserve( nb_runs );
+        run_part_.reserve( nb_runs );
+        for ( gidx_t j = 0; j < size_; ++j ) {
+            if ( j + 1 == size_ || part[j + 1] != part[j] ) {
+                run_end_.push_back( j + 1 );
+                run_part_.push_back( part[j] );
+            }
+        }
+    }
+    else {
+        part_.swap( part );
+    }
+}
+
+void Distribution::impl_t::setup_runs() {
+    size_    = run_end_.empty() ? 0 : run_end_.back();
+    compact_ = true;
+    nb_pts_.assign( nb_partitions_, 0 );
+    for_each_run( [this]( gidx_t begin, gidx_t end, int p ) { nb_pts_[p] += end - begin; } );
+    max_pts_ = *std::max_element( nb_pts_.begin(), nb_pts_.end() );
+    min_pts_ = *std::min_element( nb_pts_.begin(), nb_pts_.end() );
+}
+
+const std::vector<int>& Distribution::impl_t::expand() const {
+    if ( compact_ ) {
+        std::call_once( expanded_, [this]() {
+            part_.resize( size_ );
+            for_each_run( [this]( gidx_t begin, gidx_t end, int p ) {
+                std::fill( part_.begin() + begin, part_.begin() + end, p );
+            } );
+        } );
+    }
+    return part_;
 }
 
 void Distribution::impl_t::print( std::ostream& s ) const {
     s << "Distribution( "
-      << "type: " << type_ << ", nbPoints: " << part_.size() << ", nbPartitions: " << nb_pts_.size() << ", parts : [";
-    for ( idx_t i = 0, size = part_.size(); i < size; i++ ) {
-        if ( i != 0 ) s << ',';
-        s << part_[i];
-    }
+      << "type: " << type_ << ", nbPoints: " << size_ << ", nbPartitions: " << nb_pts_.size() << ", parts : [";
+    for_each_run( [&s]( gidx_t begin, gidx_t end, int p ) {
+        for ( gidx_t i = begin; i < end; i++ ) {
+            if ( i != 0 ) s << ',';
+            s << p;
+        }
+    } );
     s << ']';
 }
 
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <mutex>
 #include <vector>
 
 #include "eckit/memory/Owned.h"
@@ -31,6 +33,11 @@ class Distribution {
     friend class Partitioner;
 
 public:
+    /// The partition of each grid point is stored as runs of consecutive global indices belonging to the
+    /// same partition whenever that takes less memory than one entry per point, which is the case for
+    /// the partitioners of structured grids (equal_regions, checkerboard, trans).
+    /// Use partition( gidx ) or for_each_run() to query it; partition(), data() and the conversion to
+    /// std::vector<int> create the array of one partition per point on first use.
     class impl_t : public eckit::Owned {
     public:
         impl_t( const Grid& );
@@ -41,15 +48,45 @@ public:
 
         virtual ~impl_t() {}
 
-        int partition( const gidx_t gidx ) const { return part_[gidx]; }
+        int partition( const gidx_t gidx ) const {
+            if ( compact_ ) {
+                return run_part_[std::upper_bound( run_end_.begin(), run_end_.end(), gidx ) - run_end_.begin()];
+            }
+            return part_[gidx];
+        }
 
-        const std::vector<int>& partition() const { return part_; }
+        const std::vector<int>& partition() const { return expand(); }
 
         idx_t nb_partitions() const { return nb_partitions_; }
 
-        operator const std::vector<int>&() const { return part_; }
-
-        const int* data() const { return part_.data(); }
+        operator const std::vector<int>&() const { return expand(); }
+
+        const int* data() const { return expand().data(); }
+
+        /// Number of grid points
+        gidx_t size() const { return size_; }
+
+        /// @brief Call f( gidx_t begin, gidx_t end, int part ) for each run [begin,end) of consecutive global
+        /// indices belonging to partition part, in order of increasing indices
+        template <typename Functor>
+        void for_each_run( const Functor& f ) const {
+            if ( compact_ ) {
+                gidx_t begin = 0;
+                for ( size_t r = 0; r < run_end_.size(); ++r ) {
+                    f( begin, run_end_[r], run_part_[r] );
+                    begin = run_end_[r];
+                }
+            }
+            else {
+                gidx_t begin = 0;
+                for ( gidx_t n = 1; n <= size_; ++n ) {
+                    if ( n == size_ || part_[n] != part_[begin] ) {
+                        f( begin, n, part_[begin] );
+                        begin = n;
+                    }
+                }
+            }
+        }
 
         const std::vector<idx_t>& nb_pts() const { return nb_pts_; }
 
@@ -60,9 +97,19 @@ public:
 
         void print( std::ostream& ) const;
 
+    private:
+        void setup( std::vector<int>& part );
+        void setup_runs();
+        const std::vector<int>& expand() const;
+
     private:
         idx_t nb_partitions_;
-        std::vector<int> part_;
+        gidx_t size_;
+        bool compact_;
+        mutable std::vector<int> part_;
+        mutable std::once_flag expanded_;
+        std::vector<gidx_t> run_end_;
+        std::vector<int> run_part_;
         std::vector<idx_t> nb_pts_;
         idx_t max_pts_;
         idx_t min_pts_;
@@ -92,6 +139,13 @@ public:
 
     const int* data() const { return impl_->data(); }
 
+    gidx_t size() const { return impl_->size(); }
+
+    template <typename Functor>
+    void for_each_run( const Functor& f ) const {
+        impl_->for_each_run( f );
+    }
+
     const std::vector<idx_t>& nb_pts() const { return impl_->nb_pts(); }
 
     idx_t max_pts() const { return impl_->max_pts(); }
@@ -21,7 +21,9 @@
 #include "atlas/grid/Grid.h"
 #include "atlas/grid/Spacing.h"
 #include "atlas/grid/detail/grid/Gaussian.h"
+#include "atlas/grid/detail/grid/GridCache.h"
 #include "atlas/grid/detail/grid/Structured.h"
+#include "atlas/library/Library.h"
 #include "atlas/projection/Projection.h"
 #include "atlas/util/Config.h"
 
@@ -36,7 +38,13 @@ Grid::Grid( const Grid::Implementation* grid ) : grid_( grid ) {}
 Grid::Grid( const std::string& shortname, const Domain& domain ) {
     Config config;
     if ( domain ) config.set( "domain", domain.spec() );
-    grid_ = Grid::Implementation::create( shortname, config );
+    if ( Library::instance().gridCache() ) {
+        grid_ = grid::GridCache::instance().get_or_create(
+            shortname, config, [&]() { return Grid::Implementation::create( shortname, config ); } );
+    }
+    else {
+        grid_ = Grid::Implementation::create( shortname, config );
+    }
 }
 
 Grid::Grid( const Grid& grid, const Grid::Domain& domain ) {
@@ -45,7 +53,12 @@ Grid::Grid( const Grid& grid, const Grid::Domain& domain ) {
 }
 
 Grid::Grid( const Config& p ) {
-    grid_ = Grid::Implementation::create( p );
+    if ( Library::instance().gridCache() ) {
+        grid_ = grid::GridCache::instance().get_or_create( "", p, [&]() { return Grid::Implementation::create( p ); } );
+    }
+    else {
+        grid_ = Grid::Implementation::create( p );
+    }
 }
 
 namespace grid {
@@ -169,6 +169,22 @@ public:
 
     PointLonLat lonlat( idx_t n ) const { return grid_->lonlat( n ); }
 
+    /// Spatial index of the points, built on first use and shared by all copies of the grid
+    const util::IndexKDTree& index() const { return grid_->index(); }
+
+    void closestPoint( idx_t n, const PointLonLat lonlat[], idx_t closest[] ) const {
+        grid_->closestPoint( n, lonlat, closest );
+    }
+
+    void closestPoints( idx_t n, const PointLonLat lonlat[], idx_t k, idx_t closest[] ) const {
+        grid_->closestPoints( n, lonlat, k, closest );
+    }
+
+    void closestPointsWithinRadius( idx_t n, const PointLonLat lonlat[], double radius,
+                                    std::vector<std::vector<idx_t>>& within ) const {
+        grid_->closestPointsWithinRadius( n, lonlat, radius, within );
+    }
+
 private:
     const grid_t* grid_;
 };
@@ -180,6 +196,7 @@ public:
     using grid_t = detail::grid::Structured;
     using XSpace = grid_t::XSpace;
     using YSpace = grid_t::YSpace;
+    using Row    = grid_t::Row;
 
 public:
     StructuredGrid();
@@ -217,6 +234,24 @@ public:
 
     PointLonLat lonlat( idx_t i, idx_t j ) const { return grid_->lonlat( i, j ); }
 
+    inline idx_t index( idx_t i, idx_t j ) const { return grid_->index( i, j ); }
+
+    Row row( idx_t j ) const { return grid_->row( j ); }
+
+    /// @brief Call f( const Row& ) for all rows, see detail::grid::Structured::for_each_row
+    template <typename Functor>
+    void for_each_row( const Functor& f ) const { grid_->for_each_row( f ); }
+
+    /// @brief Call f( const Row& ) for the blocks of rows made of the points with index in [n_begin,n_end)
+    template <typename Functor>
+    void for_each_row( idx_t n_begin, idx_t n_end, const Functor& f ) const {
+        grid_->for_each_row( n_begin, n_end, f );
+    }
+
+    /// @brief Call f( const Row& ) for all rows, distributed over OpenMP threads
+    template <typename Functor>
+    void parallel_for_each_row( const Functor& f ) const { grid_->parallel_for_each_row( f ); }
+
     inline bool reduced() const { return grid_->reduced(); }
 
     inline bool regular() const { return not reduced(); }
@@ -9,6 +9,8 @@
  */
 
 #include "atlas/grid/Partitioner.h"
+#include "atlas/array/ArrayView.h"
+#include "atlas/array/MakeView.h"
 #include "atlas/grid/detail/partitioner/Partitioner.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/runtime/Trace.h"
@@ -42,11 +44,52 @@ detail::partitioner::Partitioner* partitioner_from_config( const Partitioner::Co
 
 Partitioner::Partitioner( const Config& config ) : partitioner_( partitioner_from_config( config ) ) {}
 
+namespace {
+detail::partitioner::Partitioner* weighted_partitioner( const std::string& type, const idx_t nb_partitions,
+                                                        const Partitioner::Weight& weight ) {
+    detail::partitioner::Partitioner* partitioner = Factory::build( type, nb_partitions );
+    try {
+        partitioner->set_weight( weight );
+    }
+    catch ( ... ) {
+        delete partitioner;
+        throw;
+    }
+    return partitioner;
+}
+
+Partitioner::Weight weight_from_field( const Field& weights ) {
+    ASSERT( weights.rank() == 1 );
+    ASSERT( weights.datatype() == array::DataType::real64() );
+    auto view = array::make_view<double, 1>( weights );
+    return [weights, view]( gidx_t n ) { return view( n ); };
+}
+
+// The grid is only known when partitioning
+void check_weights( const Field& weights, const Grid& grid ) {
+    if ( weights ) { ASSERT( weights.shape( 0 ) == grid.size() ); }
+}
+}  // namespace
+
+Partitioner::Partitioner( const std::string& type, const idx_t nb_partitions, const Weight& weight ) :
+    partitioner_( weighted_partitioner( type, nb_partitions, weight ) ) {}
+
+Partitioner::Partitioner( const std::string& type, const idx_t nb_partitions, const Field& weights ) :
+    partitioner_( weighted_partitioner( type, nb_partitions, weight_from_field( weights ) ) ),
+    weights_( weights ) {}
+
 void Partitioner::partition( const Grid& grid, int part[] ) const {
     ATLAS_TRACE();
+    check_weights( weights_, grid );
     partitioner_->partition( grid, part );
 }
 
+bool Partitioner::partition_runs( const Grid& grid, std::vector<gidx_t>& run_end, std::vector<int>& run_part ) const {
+    ATLAS_TRACE();
+    check_weights( weights_, grid );
+    return partitioner_->partition_runs( grid, run_end, run_part );
+}
+
 MatchingMeshPartitioner::MatchingMeshPartitioner() : Partitioner() {}
 
 grid::detail::partitioner::Partitioner* matching_mesh_partititioner( const Mesh& mesh,
@@ -12,6 +12,7 @@
 
 #include "eckit/memory/SharedPtr.h"
 
+#include "atlas/field/Field.h"
 #include "atlas/grid/Distribution.h"
 #include "atlas/grid/Grid.h"
 #include "atlas/grid/detail/partitioner/Partitioner.h"
@@ -25,6 +26,7 @@ class Partitioner {
 public:
     using Config         = eckit::Parametrisation;
     using Implementation = detail::partitioner::Partitioner;
+    using Weight         = Implementation::Weight;
 
 public:
     static bool exists( const std::string& type );
@@ -36,10 +38,19 @@ public:
     Partitioner( const std::string& type, const idx_t nb_partitions );
     Partitioner( const Config& );
 
+    /// @brief Partitioner balancing the sum of the weights of the points of each partition, instead of their number
+    Partitioner( const std::string& type, const idx_t nb_partitions, const Weight& );
+
+    /// @brief Partitioner balancing the sum of the weights of the points of each partition, with the weights
+    /// given by a field of type double and rank 1, of the size of the grid to partition
+    Partitioner( const std::string& type, const idx_t nb_partitions, const Field& weights );
+
     operator bool() const { return partitioner_; }
 
     void partition( const Grid& grid, int part[] ) const;
 
+    bool partition_runs( const Grid& grid, std::vector<gidx_t>& run_end, std::vector<int>& run_part ) const;
+
     Distribution partition( const Grid& grid ) const { return Distribution( grid, *this ); }
 
     idx_t nb_partitions() const { return partitioner_->nb_partitions(); }
@@ -50,6 +61,7 @@ public:
 
 private:
     eckit::SharedPtr<const Implementation> partitioner_;
+    Field weights_;  // if the weights are given by a field, to check its size against the grid
 };
 
 // ------------------------------------------------------------------
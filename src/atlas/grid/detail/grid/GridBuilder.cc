@@ -38,59 +38,6 @@ size_t regex_count_parens( const std::string& string ) {
     return out;
 }
 
-int regex_match_impl( const std::string& string, const std::string& regex, std::vector<std::string>& substr,
-                      bool use_substr, bool use_case ) {
-    regex_t re;
-    size_t matchcount = 0;
-    if ( use_substr ) matchcount = regex_count_parens( regex );
-    regmatch_t result[matchcount + 1];
-    int compiled_ok =
-        !regcomp( &re, regex.c_str(), REG_EXTENDED + ( use_case ? 0 : REG_ICASE ) + ( use_substr ? 0 : REG_NOSUB ) );
-
-    if ( !compiled_ok ) Log::error() << "This regular expression didn't compile: \"" << regex << "\"" << std::endl;
-
-    ASSERT( compiled_ok );
-
-    int found = !regexec( &re, string.c_str(), matchcount + 1, result, 0 );
-    if ( found && use_substr ) {
-        substr.resize( matchcount );
-        // match zero is the whole string; ignore it.
-        for ( size_t i = 0; i < matchcount; i++ ) {
-            if ( result[i + 1].rm_eo > 0 ) {
-                // GNU peculiarity: match-to-empty marked with -1.
-                size_t length_of_match = result[i + 1].rm_eo - result[i + 1].rm_so;
-                substr[i]              = std::string( &string[result[i + 1].rm_so], length_of_match );
-            }
-        }
-    }
-    regfree( &re );
-    return found;
-}
-
-class Regex {
-public:
-    Regex( const std::string& regex, bool use_case = true ) : regex_( regex ), use_case_( use_case ) {}
-    /*
-    // unused
-    bool match( const std::string& string ) const {
-        std::vector<std::string> substr;
-        return regex_match_impl( string, regex_, substr, false, use_case_ );
-    }
-*/
-    bool match( const std::string& string, std::vector<std::string>& substr ) const {
-        return regex_match_impl( string, regex_, substr, true, use_case_ );
-    }
-
-    /*
-    // unused
-    operator std::string() const { return regex_; }
-*/
-
-private:
-    std::string regex_;
-    bool use_case_;
-};
-
 static eckit::Mutex* local_mutex          = 0;
 static GridBuilder::Registry* named_grids = 0;
 static GridBuilder::Registry* typed_grids = 0;
@@ -107,6 +54,42 @@ static void init() {
 
 //---------------------------------------------------------------------------------------------------------------------
 
+/// Regular expression compiled once, matched with regexec, which is thread-safe
+class GridBuilder::Regex {
+public:
+    Regex( const std::string& regex, bool use_case = true ) {
+        matchcount_      = regex_count_parens( regex );
+        bool compiled_ok = !regcomp( &re_, regex.c_str(), REG_EXTENDED + ( use_case ? 0 : REG_ICASE ) );
+        if ( !compiled_ok ) Log::error() << "This regular expression didn't compile: \"" << regex << "\"" << std::endl;
+        ASSERT( compiled_ok );
+    }
+
+    ~Regex() { regfree( &re_ ); }
+
+    bool match( const std::string& string, std::vector<std::string>& substr ) const {
+        std::vector<regmatch_t> result( matchcount_ + 1 );
+        bool found = !regexec( &re_, string.c_str(), matchcount_ + 1, result.data(), 0 );
+        if ( found ) {
+            substr.resize( matchcount_ );
+            // match zero is the whole string; ignore it.
+            for ( size_t i = 0; i < matchcount_; i++ ) {
+                if ( result[i + 1].rm_eo > 0 ) {
+                    // GNU peculiarity: match-to-empty marked with -1.
+                    size_t length_of_match = result[i + 1].rm_eo - result[i + 1].rm_so;
+                    substr[i]              = std::string( &string[result[i + 1].rm_so], length_of_match );
+                }
+            }
+        }
+        return found;
+    }
+
+private:
+    regex_t re_;
+    size_t matchcount_;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+
 namespace detail {
 namespace grid {
 void force_link_Gaussian();
@@ -140,6 +123,7 @@ GridBuilder::GridBuilder( const std::vector<std::string>& names ) : names_( name
     for ( const std::string& name : names_ ) {
         ASSERT( named_grids->find( name ) == named_grids->end() );
         ( *named_grids )[name] = this;
+        regex_.emplace_back( new Regex( name ) );
     }
 }
 
@@ -152,6 +136,7 @@ GridBuilder::GridBuilder( const std::string& type, const std::vector<std::string
     for ( const std::string& name : names_ ) {
         ASSERT( named_grids->find( name ) == named_grids->end() );
         ( *named_grids )[name] = this;
+        regex_.emplace_back( new Regex( name ) );
     }
 
     ASSERT( typed_grids->find( type_ ) == typed_grids->end() );
@@ -194,8 +179,8 @@ const Grid::Implementation* GridBuilder::create( const Grid::Config& config ) co
 
 bool GridBuilder::match( const std::string& string, std::vector<std::string>& matches, int& id ) const {
     id = 0;
-    for ( const std::string& name : names_ ) {
-        if ( Regex( name ).match( string, matches ) ) return true;
+    for ( const auto& regex : regex_ ) {
+        if ( regex->match( string, matches ) ) return true;
         ++id;
     }
     return false;
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -50,6 +51,9 @@ private:
 
     std::vector<std::string> names_;
     std::string type_;
+
+    class Regex;
+    std::vector<std::unique_ptr<Regex>> regex_;  // names_, compiled once
 };
 
 }  // namespace grid
@@ -0,0 +1,43 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/grid/detail/grid/GridCache.h"
+
+#include <sstream>
+
+#include "eckit/parser/JSON.h"
+
+namespace atlas {
+namespace grid {
+
+GridCache::GridCache() : Base( "GridCache" ) {}
+
+GridCache& GridCache::instance() {
+    static GridCache inst;
+    return inst;
+}
+
+eckit::SharedPtr<GridCache::value_type> GridCache::get_or_create( const std::string& name, const Grid::Config& config,
+                                                                  const creator_type& creator ) {
+    return Base::get_or_create( key( name, config ), creator );
+}
+
+GridCache::key_type GridCache::key( const std::string& name, const Grid::Config& config ) {
+    std::stringstream key;
+    key << "name[" << name << "] config[";
+    eckit::JSON json( key );
+    json.precision( 16 );
+    json << config;
+    key << "]";
+    return key.str();
+}
+
+}  // namespace grid
+}  // namespace atlas
@@ -0,0 +1,40 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <string>
+
+#include "atlas/grid/Grid.h"
+#include "atlas/util/detail/Cache.h"
+
+namespace atlas {
+namespace grid {
+
+/// Grids created by name or configuration, shared within the process when atlas::Library::gridCache() is true.
+/// Cached grids are kept until clear() is called, or else until the end of the process. Grids still referenced
+/// elsewhere remain valid after clear().
+class GridCache : public util::Cache<std::string, const Grid::Implementation> {
+private:
+    using Base = util::Cache<std::string, const Grid::Implementation>;
+    GridCache();
+
+public:
+    static GridCache& instance();
+
+    eckit::SharedPtr<value_type> get_or_create( const std::string& name, const Grid::Config& config,
+                                                const creator_type& creator );
+
+private:
+    static key_type key( const std::string& name, const Grid::Config& config );
+};
+
+}  // namespace grid
+}  // namespace atlas
@@ -12,6 +12,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <numeric>
 
 #include "eckit/types/FloatCompare.h"
 
@@ -80,6 +81,8 @@ Structured::Structured( const std::string& name, XSpace xspace, YSpace yspace, P
 
     if ( domain ) { crop( domain ); }
 
+    computeRowOffsets();
+
     computeTruePeriodicity();
 
     if ( domain && domain.global() )
@@ -432,6 +435,13 @@ void Structured::crop( const Domain& dom ) {
     }
 }
 
+void Structured::computeRowOffsets() {
+    offset_.resize( nx_.size() + 1 );
+    offset_[0] = 0;
+    std::partial_sum( nx_.begin(), nx_.end(), offset_.begin() + 1 );
+    ASSERT( offset_.back() == npts_ );
+}
+
 void Structured::computeTruePeriodicity() {
     if ( projection_.strictlyRegional() ) { periodic_x_ = false; }
     else if ( domain_ && domain_.global() ) {
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <memory>
 
@@ -19,6 +20,7 @@
 #include "atlas/grid/Spacing.h"
 #include "atlas/grid/detail/grid/Grid.h"
 #include "atlas/library/config.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/util/Config.h"
 
 namespace atlas {
@@ -298,6 +300,21 @@ public:
 
     using YSpace = Spacing;
 
+    /// @brief Block of consecutive points [i_begin,i_end) of row j, at x( i ) = xmin + i * dx and y.
+    /// Point i_begin has index n in the grid, so that point i has index n + ( i - i_begin ).
+    struct Row {
+        idx_t j;
+        idx_t i_begin;
+        idx_t i_end;
+        double xmin;
+        double dx;
+        double y;
+        idx_t n;
+
+        idx_t size() const { return i_end - i_begin; }
+        double x( idx_t i ) const { return xmin + static_cast<double>( i ) * dx; }
+    };
+
 public:
     static std::string static_type();
 
@@ -353,6 +370,43 @@ public:
         projection_.xy2lonlat( crd );
     }
 
+    /// Index in the grid of point (i,j)
+    inline idx_t index( idx_t i, idx_t j ) const { return offset_[j] + i; }
+
+    /// All points of row j
+    Row row( idx_t j ) const { return Row{j, 0, nx_[j], xmin_[j], dx_[j], y_[j], offset_[j]}; }
+
+    /// @brief Call f( const Row& ) for all rows, from north to south.
+    /// Unlike the iterators returned by xy() and lonlat(), this involves no virtual call per point,
+    /// so that loops over the points of a row can be vectorised.
+    template <typename Functor>
+    void for_each_row( const Functor& f ) const {
+        for ( idx_t j = 0; j < ny(); ++j ) {
+            f( row( j ) );
+        }
+    }
+
+    /// @brief Call f( const Row& ) for the blocks of rows made of the points with index in [n_begin,n_end)
+    template <typename Functor>
+    void for_each_row( idx_t n_begin, idx_t n_end, const Functor& f ) const {
+        idx_t j = std::upper_bound( offset_.begin(), offset_.end(), n_begin ) - offset_.begin() - 1;
+        for ( ; j < ny() && offset_[j] < n_end; ++j ) {
+            Row r     = row( j );
+            r.i_begin = std::max( n_begin - offset_[j], idx_t{0} );
+            r.i_end   = std::min( n_end - offset_[j], r.i_end );
+            r.n       = offset_[j] + r.i_begin;
+            if ( r.size() > 0 ) { f( r ); }
+        }
+    }
+
+    /// @brief Call f( const Row& ) for all rows, distributed over OpenMP threads.
+    /// f is called concurrently, and must only write data belonging to its row.
+    template <typename Functor>
+    void parallel_for_each_row( const Functor& f ) const {
+        const idx_t _ny = ny();
+        atlas_omp_parallel_for( idx_t j = 0; j < _ny; ++j ) { f( row( j ) ); }
+    }
+
     inline bool reduced() const { return nxmax() != nxmin(); }
 
     bool periodic() const { return periodic_x_; }
@@ -383,6 +437,8 @@ protected:  // methods
 
     void crop( const Domain& );
 
+    void computeRowOffsets();
+
 protected:
     // Minimum number of points across parallels (constant y)
     idx_t nxmin_;
@@ -408,6 +464,9 @@ protected:
     /// Value of longitude increment
     std::vector<double> dx_;
 
+    /// Index in the grid of the first point of each latitude, and size() at the end
+    std::vector<idx_t> offset_;
+
     /// Periodicity in x-direction
     bool periodic_x_;
 
@@ -10,6 +10,8 @@
 
 #include "atlas/grid/detail/grid/Unstructured.h"
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <memory>
 
@@ -22,8 +24,12 @@
 #include "atlas/mesh/Mesh.h"
 #include "atlas/mesh/Nodes.h"
 #include "atlas/option.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
+#include "atlas/util/Constants.h"
 #include "atlas/util/CoordinateEnums.h"
+#include "atlas/util/UnitSphere.h"
 
 namespace atlas {
 namespace grid {
@@ -176,6 +182,72 @@ Grid::Spec Unstructured::spec() const {
     return *cached_spec_;
 }
 
+namespace {
+PointXYZ cartesian( const PointLonLat& lonlat ) {
+    PointXYZ xyz;
+    util::UnitSphere::convertSphericalToCartesian( lonlat, xyz );
+    return xyz;
+}
+}  // namespace
+
+const util::IndexKDTree& Unstructured::index() const {
+    std::call_once( index_built_, [this]() {
+        ATLAS_TRACE( "Unstructured::index" );
+        const idx_t npts = size();
+        std::vector<double> lonlat( 2 * npts );
+        for ( idx_t n = 0; n < npts; ++n ) {
+            lonlat[2 * n]     = ( *points_ )[n].x();
+            lonlat[2 * n + 1] = ( *points_ )[n].y();
+        }
+        projection_.xy2lonlat( npts, lonlat.data(), lonlat.data() + 1, lonlat.data(), lonlat.data() + 1, 2 );
+        std::vector<PointXYZ> xyz( npts );
+        for ( idx_t n = 0; n < npts; ++n ) {
+            xyz[n] = cartesian( PointLonLat( lonlat[2 * n], lonlat[2 * n + 1] ) );
+        }
+        index_.reset( new util::IndexKDTree( xyz ) );
+    } );
+    return *index_;
+}
+
+void Unstructured::closestPoint( idx_t n, const PointLonLat lonlat[], idx_t closest[] ) const {
+    const util::IndexKDTree& tree = index();
+    ATLAS_TRACE( "Unstructured::closestPoint" );
+    atlas_omp_parallel_for( idx_t j = 0; j < n; ++j ) {
+        closest[j] = tree.closestPoint( cartesian( lonlat[j] ) ).index;
+    }
+}
+
+void Unstructured::closestPoints( idx_t n, const PointLonLat lonlat[], idx_t k, idx_t closest[] ) const {
+    const util::IndexKDTree& tree = index();
+    ATLAS_TRACE( "Unstructured::closestPoints" );
+    ASSERT( k <= size() );
+    atlas_omp_parallel_for( idx_t j = 0; j < n; ++j ) {
+        const util::IndexKDTree::Neighbours neighbours = tree.closestPoints( cartesian( lonlat[j] ), k );
+        for ( idx_t i = 0; i < k; ++i ) {
+            closest[j * k + i] = neighbours[i].index;
+        }
+    }
+}
+
+void Unstructured::closestPointsWithinRadius( idx_t n, const PointLonLat lonlat[], double radius,
+                                              std::vector<std::vector<idx_t>>& within ) const {
+    const util::IndexKDTree& tree = index();
+    ATLAS_TRACE( "Unstructured::closestPointsWithinRadius" );
+
+    // Chord on the unit sphere of the great-circle distance
+    const double chord = 2. * std::sin( 0.5 * std::min( radius, 180. ) * util::Constants::degreesToRadians() );
+
+    within.resize( n );
+    atlas_omp_parallel_for( idx_t j = 0; j < n; ++j ) {
+        const util::IndexKDTree::Neighbours neighbours =
+            tree.closestPointsWithinRadius( cartesian( lonlat[j] ), chord );
+        within[j].resize( neighbours.size() );
+        for ( size_t i = 0; i < neighbours.size(); ++i ) {
+            within[j][i] = neighbours[i].index;
+        }
+    }
+}
+
 void Unstructured::print( std::ostream& os ) const {
     os << "Unstructured(Npts:" << size() << ")";
 }
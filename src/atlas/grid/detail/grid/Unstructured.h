@@ -18,11 +18,13 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "eckit/utils/Hash.h"
 
 #include "atlas/grid/detail/grid/Grid.h"
+#include "atlas/util/IndexKDTree.h"
 
 namespace atlas {
 class Mesh;
@@ -189,6 +191,22 @@ public:  // methods
 
     PointLonLat lonlat( idx_t n ) const { return projection_.lonlat( ( *points_ )[n] ); }
 
+    /// Spatial index of the points, in cartesian coordinates on the unit sphere, built on first use and kept
+    /// with the grid. It can be searched concurrently by several threads.
+    const util::IndexKDTree& index() const;
+
+    /// For each of the n points lonlat[], the closest point of the grid
+    void closestPoint( idx_t n, const PointLonLat lonlat[], idx_t closest[] ) const;
+
+    /// For each of the n points lonlat[], the k closest points of the grid by increasing distance, stored in
+    /// closest[ j * k ] to closest[ j * k + k - 1 ] for point j. The grid must have at least k points.
+    void closestPoints( idx_t n, const PointLonLat lonlat[], idx_t k, idx_t closest[] ) const;
+
+    /// For each of the n points lonlat[], the points of the grid within the great-circle distance radius
+    /// (in degrees) by increasing distance
+    void closestPointsWithinRadius( idx_t n, const PointLonLat lonlat[], double radius,
+                                    std::vector<std::vector<idx_t>>& within ) const;
+
     virtual IteratorXY* xy_begin() const { return new IteratorXY( *this ); }
     virtual IteratorXY* xy_end() const { return new IteratorXY( *this, false ); }
     virtual IteratorLonLat* lonlat_begin() const { return new IteratorLonLat( *this ); }
@@ -215,6 +233,10 @@ protected:
 
     /// Cache for the spec since may be quite heavy to compute
     mutable std::unique_ptr<Grid::Spec> cached_spec_;
+
+    /// Spatial index, built on first use
+    mutable std::once_flag index_built_;
+    mutable std::unique_ptr<util::IndexKDTree> index_;
 };
 
 }  // namespace grid
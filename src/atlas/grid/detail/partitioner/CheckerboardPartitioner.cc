@@ -18,6 +18,16 @@ namespace grid {
 namespace detail {
 namespace partitioner {
 
+namespace {
+void add_run( gidx_t end, int part, std::vector<gidx_t>& run_end, std::vector<int>& run_part ) {
+    if ( !run_part.empty() && run_part.back() == part ) { run_end.back() = end; }
+    else {
+        run_end.push_back( end );
+        run_part.push_back( part );
+    }
+}
+}  // namespace
+
 CheckerboardPartitioner::CheckerboardPartitioner() : Partitioner() {
     nbands_       = 0;     // to be computed later
     checkerboard_ = true;  // default
@@ -85,24 +95,18 @@ bool compare_X_Y( const CheckerboardPartitioner::NodeInt& node1, const Checkerbo
     return false;
 }
 
-void CheckerboardPartitioner::partition( const Checkerboard& cb, int nb_nodes, NodeInt nodes[], int part[] ) const {
+void CheckerboardPartitioner::bands( const Checkerboard& cb, size_t nb_nodes, std::vector<size_t>& npartsb,
+                                     std::vector<size_t>& ngpb ) const {
     size_t nparts = nb_partitions();
     size_t nbands = cb.nbands;
     size_t nx     = cb.nx;
     size_t ny     = cb.ny;
     size_t remainder;
 
-    /*
-Sort nodes from south to north (increasing y), and west to east (increasing x).
-Now we can easily split
-the points in bands. Note this may not be necessary, as it could be
-already by construction in this order, but then sorting is really fast
-*/
-
     /*
 Number of procs per band
 */
-    std::vector<size_t> npartsb( nbands, 0 );  // number of procs per band
+    npartsb.assign( nbands, 0 );  // number of procs per band
     remainder = nparts;
     for ( size_t iband = 0; iband < nbands; iband++ ) {
         npartsb[iband] = nparts / nbands;
@@ -115,7 +119,7 @@ Number of procs per band
     /*
 Number of gridpoints per band
 */
-    std::vector<size_t> ngpb( nbands, 0 );
+    ngpb.assign( nbands, 0 );
     // split latitudes?
     if ( true ) {
         remainder = nb_nodes;
@@ -140,6 +144,22 @@ Number of gridpoints per band
 
     // for (int iband=0;iband<nbands; iband++ ) std::cout << "band " << iband << "
     // : nparts = " << npartsb[iband] << "; ngpb = " << ngpb[iband] << std::endl;
+}
+
+void CheckerboardPartitioner::partition( const Checkerboard& cb, int nb_nodes, NodeInt nodes[], int part[] ) const {
+    size_t nbands = cb.nbands;
+    size_t remainder;
+
+    /*
+Sort nodes from south to north (increasing y), and west to east (increasing x).
+Now we can easily split
+the points in bands. Note this may not be necessary, as it could be
+already by construction in this order, but then sorting is really fast
+*/
+
+    std::vector<size_t> npartsb;  // number of procs per band
+    std::vector<size_t> ngpb;     // number of gridpoints per band
+    bands( cb, nb_nodes, npartsb, ngpb );
 
     // sort nodes according to Y first, to determine bands
     std::sort( nodes, nodes + nb_nodes, compare_Y_X );
@@ -212,6 +232,83 @@ void CheckerboardPartitioner::partition( const Grid& grid, int part[] ) const {
     }
 }
 
+bool CheckerboardPartitioner::partition_runs( const Grid& grid, std::vector<gidx_t>& run_end,
+                                              std::vector<int>& run_part ) const {
+    run_end.clear();
+    run_part.clear();
+    if ( nb_partitions() == 1 ) {
+        if ( grid.size() ) { add_run( grid.size(), 0, run_end, run_part ); }
+        return true;
+    }
+
+    auto cb         = checkerboard( grid );
+    const gidx_t nx = cb.nx;
+
+    std::vector<size_t> npartsb;  // number of procs per band
+    std::vector<size_t> ngpb;     // number of gridpoints per band
+    bands( cb, grid.size(), npartsb, ngpb );
+
+    // The points of a band are consecutive in the grid, from column c0 of row r0 to column c1 (excluded) of row
+    // r1. partition() sorts them by column, then by row, and gives consecutive points to each part. The position
+    // of a point in this order increases from west to east along a row, so that each part is a contiguous range
+    // of each row, whose end is found by bisection.
+    gidx_t offset = 0;
+    int jpart     = 0;
+    for ( size_t iband = 0; iband < cb.nbands; iband++ ) {
+        const gidx_t band_end = offset + ngpb[iband];
+
+        // position within the band of the end of each part, with the remaining gridpoints over the first parts
+        std::vector<gidx_t> part_end( npartsb[iband] );
+        size_t remainder = ngpb[iband] % npartsb[iband];
+        gidx_t end       = 0;
+        for ( size_t ipart = 0; ipart < npartsb[iband]; ipart++ ) {
+            end += ngpb[iband] / npartsb[iband] + ( ipart < remainder ? 1 : 0 );
+            part_end[ipart] = end;
+        }
+
+        if ( band_end > offset ) {
+            const gidx_t r0 = offset / nx;
+            const gidx_t c0 = offset % nx;
+            const gidx_t r1 = ( band_end - 1 ) / nx;
+            const gidx_t c1 = ( band_end - 1 ) % nx + 1;
+            auto first_row  = [&]( gidx_t ix ) { return ix < c0 ? r0 + 1 : r0; };
+            auto last_row   = [&]( gidx_t ix ) { return ix < c1 ? r1 : r1 - 1; };
+
+            // number of points of the band west of each column
+            std::vector<gidx_t> west( nx + 1, 0 );
+            for ( gidx_t ix = 0; ix < nx; ++ix ) {
+                west[ix + 1] = west[ix] + std::max<gidx_t>( 0, last_row( ix ) - first_row( ix ) + 1 );
+            }
+
+            for ( gidx_t iy = r0; iy <= r1; ++iy ) {
+                auto position       = [&]( gidx_t ix ) { return west[ix] + iy - first_row( ix ); };
+                const gidx_t ix_end = ( iy == r1 ? c1 : nx );
+                gidx_t ix           = ( iy == r0 ? c0 : 0 );
+                size_t ipart        = 0;
+                while ( ix < ix_end ) {
+                    while ( part_end[ipart] <= position( ix ) ) {
+                        ++ipart;
+                    }
+                    // first point of the row beyond this part
+                    gidx_t lo = ix + 1, hi = ix_end;
+                    while ( lo < hi ) {
+                        gidx_t mid = ( lo + hi ) / 2;
+                        if ( position( mid ) < part_end[ipart] ) { lo = mid + 1; }
+                        else {
+                            hi = mid;
+                        }
+                    }
+                    add_run( iy * nx + lo, jpart + ipart, run_end, run_part );
+                    ix = lo;
+                }
+            }
+        }
+        offset = band_end;
+        jpart += npartsb[iband];
+    }
+    return true;
+}
+
 }  // namespace partitioner
 }  // namespace detail
 }  // namespace grid
@@ -37,12 +37,18 @@ private:
 
     Checkerboard checkerboard( const Grid& ) const;
 
+    // Number of partitions and of gridpoints of each band
+    void bands( const Checkerboard& cb, size_t nb_nodes, std::vector<size_t>& npartsb,
+                std::vector<size_t>& ngpb ) const;
+
     // Doesn't matter if nodes[] is in degrees or radians, as a sorting
     // algorithm is used internally
     void partition( const Checkerboard& cb, int nb_nodes, NodeInt nodes[], int part[] ) const;
 
     virtual void partition( const Grid&, int part[] ) const;
 
+    virtual bool partition_runs( const Grid&, std::vector<gidx_t>& run_end, std::vector<int>& run_part ) const;
+
     void check() const;
 
 private:
@@ -11,15 +11,19 @@
 #include "atlas/grid/detail/partitioner/EqualRegionsPartitioner.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <ctime>
 #include <functional>
 #include <iostream>
+#include <limits>
+#include <numeric>
 #include <vector>
 
 #include "atlas/grid/Grid.h"
 #include "atlas/parallel/mpi/Buffer.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/runtime/Trace.h"
 #include "atlas/util/MicroDeg.h"
@@ -526,243 +530,536 @@ void EqualRegionsPartitioner::partition( int nb_nodes, NodeInt nodes[], int part
     // ((double)CLOCKS_PER_SEC) << "s)" << std::endl;
 }
 
-void EqualRegionsPartitioner::partition( const Grid& grid, int part[] ) const {
-    if ( N_ == 1 ) {  // trivial solution, so much faster
-        for ( size_t j = 0; j < grid.size(); ++j )
-            part[j] = 0;
-    }
+namespace {
+
+void add_run( gidx_t end, int part, std::vector<gidx_t>& run_end, std::vector<int>& run_part ) {
+    if ( !run_part.empty() && run_part.back() == part ) { run_end.back() = end; }
     else {
-        ATLAS_TRACE( "EqualRegionsPartitioner::partition" );
+        run_end.push_back( end );
+        run_part.push_back( part );
+    }
+}
 
-        ASSERT( grid.projection().units() == "degrees" );
+// Partition the points [begin,end) of a band of a StructuredGrid in sectors of count[s] points, as done by
+// sorting them from west to east and north to south. The points of a row are ordered from west to east by
+// construction, so that every sector is a contiguous range of each row. The first point of a sector is found
+// by bisection on its x in microdegrees, counting the points west of it row by row.
+void partition_band( const StructuredGrid& grid, idx_t begin, idx_t end, int part0, const int count[],
+                     int nb_sectors, std::vector<gidx_t>& run_end, std::vector<int>& run_part ) {
+    std::vector<StructuredGrid::Row> rows;
+    grid.for_each_row( begin, end, [&rows]( const StructuredGrid::Row& row ) { rows.push_back( row ); } );
+    const size_t nb_rows = rows.size();
+
+    auto x = []( const StructuredGrid::Row& row, idx_t i ) -> long { return microdeg( row.x( i ) ); };
+
+    // Number of points of the row with x < X
+    auto nb_west_of = [&x]( const StructuredGrid::Row& row, long X ) -> idx_t {
+        idx_t lo = row.i_begin;
+        idx_t hi = row.i_end;
+        while ( lo < hi ) {
+            idx_t mid = lo + ( hi - lo ) / 2;
+            if ( x( row, mid ) < X ) { lo = mid + 1; }
+            else {
+                hi = mid;
+            }
+        }
+        return lo - row.i_begin;
+    };
+
+    long xmin = std::numeric_limits<long>::max();
+    long xmax = std::numeric_limits<long>::min();
+    for ( const auto& row : rows ) {
+        xmin = std::min( xmin, x( row, row.i_begin ) );
+        xmax = std::max( xmax, x( row, row.i_end - 1 ) );
+    }
 
-        const auto& comm = mpi::comm();
-        int mpi_rank     = comm.rank();
-        int mpi_size     = comm.size();
+    // cut[s * nb_rows + r]: number of points of row r in sectors 0 to s
+    std::vector<idx_t> cut( nb_sectors * nb_rows );
+    idx_t nb_before = 0;
+    for ( int s = 0; s < nb_sectors; ++s ) {
+        idx_t* c = cut.data() + s * nb_rows;
+        nb_before += count[s];
+        if ( s == nb_sectors - 1 ) {
+            for ( size_t r = 0; r < nb_rows; ++r ) {
+                c[r] = rows[r].size();
+            }
+            continue;
+        }
 
-        std::vector<NodeInt> nodes( grid.size() );
-        int* nodes_buffer = reinterpret_cast<int*>( nodes.data() );
-        long nb_workers   = comm.size();
+        // The first point of the next sector has the smallest X with more than nb_before points at x <= X
+        long lo = xmin;
+        long hi = xmax;
+        while ( lo < hi ) {
+            long mid = lo + ( hi - lo ) / 2;
+            idx_t nb = 0;
+            for ( size_t r = 0; r < nb_rows; ++r ) {
+                nb += nb_west_of( rows[r], mid + 1 );
+            }
+            if ( nb > nb_before ) { hi = mid; }
+            else {
+                lo = mid + 1;
+            }
+        }
+        xmin = lo;
 
-        /*
-    Sort nodes from north to south, and west to east. Now we can easily split
-    the points in bands. Note, for StructuredGrid, this should not be necessary,
-    as it is
-    already by construction in this order, but then sorting is really fast
-    */
+        // Points at x == X are ordered from north to south
+        idx_t remaining = nb_before;
+        for ( size_t r = 0; r < nb_rows; ++r ) {
+            c[r] = nb_west_of( rows[r], lo );
+            remaining -= c[r];
+        }
+        for ( size_t r = 0; r < nb_rows; ++r ) {
+            idx_t nb = std::min( remaining, nb_west_of( rows[r], lo + 1 ) - c[r] );
+            c[r] += nb;
+            remaining -= nb;
+        }
+    }
 
-        if ( StructuredGrid( grid ) ) {
-            // The grid comes sorted from north to south and west to east by
-            // construction
-            // Assert to make sure.
-            StructuredGrid structured_grid( grid );
-            ASSERT( structured_grid.y( 1 ) < structured_grid.y( 0 ) );
-            ASSERT( structured_grid.x( 1, 0 ) > structured_grid.x( 0, 0 ) );
-
-            ATLAS_TRACE( "Take shortcut" );
-            int n( 0 );
-            for ( size_t j = 0; j < structured_grid.ny(); ++j ) {
-                double y = microdeg( structured_grid.y( j ) );
-                for ( size_t i = 0; i < structured_grid.nx( j ); ++i, ++n ) {
-                    nodes[n].x = microdeg( structured_grid.x( i, j ) );
-                    nodes[n].y = y;
-                    nodes[n].n = n;
-                }
-            }
+    for ( size_t r = 0; r < nb_rows; ++r ) {
+        idx_t i = 0;
+        for ( int s = 0; s < nb_sectors; ++s ) {
+            idx_t i_next = cut[s * nb_rows + r];
+            if ( i_next > i ) { add_run( rows[r].n + i_next, part0 + s, run_end, run_part ); }
+            i = i_next;
         }
-        else {
-            ATLAS_TRACE( "sort all" );
-            std::vector<eckit::mpi::Request> requests;
+    }
+}
 
-            for ( int w = 0; w < nb_workers; ++w ) {
-                int w_begin = w * grid.size() / N_;
-                int w_end   = ( w + 1 ) * grid.size() / N_;
-                if ( w == nb_workers - 1 ) w_end = grid.size();
-                size_t w_size = w_end - w_begin;
+}  // namespace
 
-                int work_rank = std::min( w, mpi_size - 1 );
+bool EqualRegionsPartitioner::partition_runs( const Grid& grid, std::vector<gidx_t>& run_end,
+                                              std::vector<int>& run_part ) const {
+    StructuredGrid structured_grid( grid );
+    if ( not structured_grid ) { return false; }
 
-                if ( mpi_rank == 0 ) {
-                    requests.push_back( comm.iReceive( nodes_buffer + 3 * w_begin, 3 * w_size,
-                                                       /* source= */ work_rank, /* tag= */ 0 ) );
-                }
+    run_end.clear();
+    run_part.clear();
+    if ( N_ == 1 ) {
+        if ( grid.size() ) { add_run( grid.size(), 0, run_end, run_part ); }
+        return true;
+    }
+    if ( weighted() ) { return false; }
+
+    ATLAS_TRACE( "EqualRegionsPartitioner::partition_runs" );
+
+    // The grid comes sorted from north to south and west to east by construction
+    ASSERT( grid.projection().units() == "degrees" );
+    ASSERT( structured_grid.y( 1 ) < structured_grid.y( 0 ) );
+    ASSERT( structured_grid.x( 1, 0 ) > structured_grid.x( 0, 0 ) );
+
+    // Number of points of each partition, and first point and first partition of each band
+    const int nb_nodes        = grid.size();
+    const int chunk_size      = nb_nodes / N_;
+    const int chunk_remainder = nb_nodes - chunk_size * N_;
+    std::vector<int> count( N_ );
+    for ( int p = 0; p < N_; ++p ) {
+        count[p] = chunk_size + ( p < chunk_remainder ? 1 : 0 );
+    }
+    std::vector<idx_t> b_begin( nb_bands() + 1, 0 );
+    std::vector<int> b_part( nb_bands() + 1, 0 );
+    for ( int band = 0; band < nb_bands(); ++band ) {
+        b_part[band + 1]  = b_part[band] + nb_regions( band );
+        b_begin[band + 1] = b_begin[band];
+        for ( int p = b_part[band]; p < b_part[band + 1]; ++p ) {
+            b_begin[band + 1] += count[p];
+        }
+    }
 
-                if ( mpi_rank == work_rank ) {
-                    std::vector<NodeInt> w_nodes( w_size );
-                    int* w_nodes_buffer = reinterpret_cast<int*>( w_nodes.data() );
-
-                    ATLAS_TRACE_SCOPE( "create one bit" ) {
-                        if ( true )  // optimized experimental when true (still need to
-                                     // benchmark)
-                        {
-                            auto filter = [w_begin, w_end]( long n ) { return ( n >= w_begin && n < w_end ); };
-                            int i       = w_begin;
-                            int j( 0 );
-                            for ( PointXY point : grid.xy( filter ) ) {
-                                w_nodes[j].x = microdeg( point.x() );
-                                w_nodes[j].y = microdeg( point.y() );
-                                w_nodes[j].n = i++;
-                                ++j;
-                            }
-                        }
-                        else {
-                            int i( 0 );
-                            int j( 0 );
-                            for ( PointXY point : grid.xy() ) {
-                                if ( i >= w_begin && i < w_end ) {
-                                    w_nodes[j].x = microdeg( point.x() );
-                                    w_nodes[j].y = microdeg( point.y() );
-                                    w_nodes[j].n = i;
-                                    ++j;
-                                }
-                                ++i;
-                            }
-                        }
+    std::vector<std::vector<gidx_t>> b_run_end( nb_bands() );
+    std::vector<std::vector<int>> b_run_part( nb_bands() );
+    const int _nb_bands = nb_bands();
+    atlas_omp_parallel_for( int band = 0; band < _nb_bands; ++band ) {
+        partition_band( structured_grid, b_begin[band], b_begin[band + 1], b_part[band], count.data() + b_part[band],
+                        nb_regions( band ), b_run_end[band], b_run_part[band] );
+    }
+
+    for ( int band = 0; band < nb_bands(); ++band ) {
+        for ( size_t r = 0; r < b_run_end[band].size(); ++r ) {
+            add_run( b_run_end[band][r], b_run_part[band][r], run_end, run_part );
+        }
+    }
+    return true;
+}
+
+void EqualRegionsPartitioner::sort_all( const Grid& grid, std::vector<NodeInt>& nodes ) const {
+    ATLAS_TRACE( "sort all" );
+
+    const auto& comm  = mpi::comm();
+    int mpi_rank      = comm.rank();
+    int mpi_size      = comm.size();
+    int* nodes_buffer = reinterpret_cast<int*>( nodes.data() );
+    long nb_workers   = comm.size();
+
+    std::vector<eckit::mpi::Request> requests;
+
+    for ( int w = 0; w < nb_workers; ++w ) {
+        int w_begin = w * grid.size() / N_;
+        int w_end   = ( w + 1 ) * grid.size() / N_;
+        if ( w == nb_workers - 1 ) w_end = grid.size();
+        size_t w_size = w_end - w_begin;
+
+        int work_rank = std::min( w, mpi_size - 1 );
+
+        if ( mpi_rank == 0 ) {
+            requests.push_back( comm.iReceive( nodes_buffer + 3 * w_begin, 3 * w_size,
+                                               /* source= */ work_rank, /* tag= */ 0 ) );
+        }
+
+        if ( mpi_rank == work_rank ) {
+            std::vector<NodeInt> w_nodes( w_size );
+            int* w_nodes_buffer = reinterpret_cast<int*>( w_nodes.data() );
+
+            ATLAS_TRACE_SCOPE( "create one bit" ) {
+                if ( true )  // optimized experimental when true (still need to
+                             // benchmark)
+                {
+                    auto filter = [w_begin, w_end]( long n ) { return ( n >= w_begin && n < w_end ); };
+                    int i       = w_begin;
+                    int j( 0 );
+                    for ( PointXY point : grid.xy( filter ) ) {
+                        w_nodes[j].x = microdeg( point.x() );
+                        w_nodes[j].y = microdeg( point.y() );
+                        w_nodes[j].n = i++;
+                        ++j;
                     }
-                    ATLAS_TRACE_SCOPE( "sort one bit" ) { std::sort( w_nodes.begin(), w_nodes.end(), compare_NS_WE ); }
-                    ATLAS_TRACE_SCOPE( "send to rank0" ) {
-                        comm.send( w_nodes_buffer, 3 * w_size, /* dest= */ 0, /* tag= */ 0 );
+                }
+                else {
+                    int i( 0 );
+                    int j( 0 );
+                    for ( PointXY point : grid.xy() ) {
+                        if ( i >= w_begin && i < w_end ) {
+                            w_nodes[j].x = microdeg( point.x() );
+                            w_nodes[j].y = microdeg( point.y() );
+                            w_nodes[j].n = i;
+                            ++j;
+                        }
+                        ++i;
                     }
                 }
             }
-            ATLAS_TRACE_MPI( WAIT ) {
-                for ( auto request : requests ) {
-                    comm.wait( request );
-                }
+            ATLAS_TRACE_SCOPE( "sort one bit" ) { std::sort( w_nodes.begin(), w_nodes.end(), compare_NS_WE ); }
+            ATLAS_TRACE_SCOPE( "send to rank0" ) {
+                comm.send( w_nodes_buffer, 3 * w_size, /* dest= */ 0, /* tag= */ 0 );
             }
-            ATLAS_TRACE_SCOPE( "merge sorted" ) {
-                for ( int w = 0; w < nb_workers; ++w ) {
-                    int w_begin = w * grid.size() / N_;
-                    int w_end   = ( w + 1 ) * grid.size() / N_;
-                    if ( w == nb_workers - 1 ) w_end = grid.size();
-                    if ( w != 0 ) {
-                        std::inplace_merge( nodes.begin(), nodes.begin() + w_begin, nodes.begin() + w_end,
-                                            compare_NS_WE );
-                    }
-                }
+        }
+    }
+    ATLAS_TRACE_MPI( WAIT ) {
+        for ( auto request : requests ) {
+            comm.wait( request );
+        }
+    }
+    ATLAS_TRACE_SCOPE( "merge sorted" ) {
+        for ( int w = 0; w < nb_workers; ++w ) {
+            int w_begin = w * grid.size() / N_;
+            int w_end   = ( w + 1 ) * grid.size() / N_;
+            if ( w == nb_workers - 1 ) w_end = grid.size();
+            if ( w != 0 ) {
+                std::inplace_merge( nodes.begin(), nodes.begin() + w_begin, nodes.begin() + w_end, compare_NS_WE );
             }
-            ATLAS_TRACE_MPI( BROADCAST ) { comm.broadcast( nodes_buffer, 3 * grid.size(), /* root= */ 0 ); }
-        }  // sort all
+        }
+    }
+    ATLAS_TRACE_MPI( BROADCAST ) { comm.broadcast( nodes_buffer, 3 * grid.size(), /* root= */ 0 ); }
+}
 
-        /*
-    For every band, now sort from west to east, and north to south. Inside every
-    band
-    we can now easily split nodes in sectors.
-    */
+void EqualRegionsPartitioner::sort_bands( std::vector<NodeInt>& nodes, const std::vector<int>& displs,
+                                          const std::vector<int>& count ) const {
+    ATLAS_TRACE( "sort bands" );
+
+    const auto& comm  = mpi::comm();
+    int mpi_rank      = comm.rank();
+    int mpi_size      = comm.size();
+    int* nodes_buffer = reinterpret_cast<int*>( nodes.data() );
+
+    std::vector<int> b_count( nb_bands(), 0 );
+    std::vector<int> b_displs( nb_bands() );
+    for ( int band = 0, w = 0; band < nb_bands(); ++band ) {
+        b_displs[band] = displs[w];
+        for ( int p = 0; p < nb_regions( band ); ++p ) {
+            b_count[band] += count[w++];
+        }
+    }
 
-        ATLAS_TRACE_SCOPE( "sort bands" ) {
-            std::vector<eckit::mpi::Request> requests;
-
-            int nb_parts        = N_;
-            int nb_nodes        = grid.size();
-            int chunk_size      = nb_nodes / nb_parts;
-            int chunk_remainder = nb_nodes - chunk_size * nb_parts;
-            int remainder       = chunk_remainder;
-            std::vector<int> count;
-            count.reserve( nb_parts );
-            std::vector<int> displs;
-            displs.reserve( nb_parts );
-            std::vector<int> b_count;
-            b_count.reserve( nb_bands() );
-            std::vector<int> b_displs;
-            b_displs.reserve( nb_bands() );
-
-            {
-                int end = 0;
-                for ( int band = 0; band < nb_bands(); ++band ) {
-                    b_displs.push_back( end );
-                    int b_size( 0 );
-                    for ( int p = 0; p < nb_regions( band ); ++p ) {
-                        int w_size = chunk_size + ( remainder-- > 0 ? 1 : 0 );
-                        displs.push_back( end );
-                        count.push_back( w_size );
-                        end += w_size;
-                        b_size += w_size;
-                    }
-                    b_count.push_back( b_size );
+    std::vector<eckit::mpi::Request> requests;
+
+    int w( 0 );
+    for ( int band = 0; band < nb_bands(); ++band ) {
+        int w0           = w;
+        int w0_work_rank = std::min( w0, mpi_size - 1 );
+
+        for ( int p = 0; p < nb_regions( band ); ++p ) {
+            int w_begin   = displs[w];
+            int w_size    = count[w];
+            int w_end     = w_begin + w_size;
+            int work_rank = std::min( w, mpi_size - 1 );
+
+            if ( mpi_rank == w0_work_rank ) {
+                requests.push_back( comm.iReceive( nodes_buffer + 3 * w_begin, 3 * w_size,
+                                                   /* source= */ work_rank, /* tag= */ 0 ) );
+            }
+            if ( work_rank == mpi_rank ) {
+                ATLAS_TRACE_SCOPE( "sort one bit" ) {
+                    std::sort( nodes.data() + w_begin, nodes.data() + w_end, compare_WE_NS );
                 }
+                comm.send( nodes_buffer + 3 * w_begin, 3 * w_size,
+                           /* dest= */ w0_work_rank, /* tag= */ 0 );
             }
+            ++w;
+        }
+    }
+    ATLAS_TRACE_MPI( WAIT ) {
+        for ( auto request : requests ) {
+            comm.wait( request );
+        }
+    }
+    requests.clear();
+    w = 0;
+    for ( int band = 0; band < nb_bands(); ++band ) {
+        int w0           = w;
+        int w0_begin     = b_displs[band];
+        int w0_size      = b_count[band];
+        int w0_work_rank = std::min( w0, mpi_size - 1 );
+
+        for ( int p = 0; p < nb_regions( band ); ++p ) {
+            int w_begin = displs[w];
+            int w_size  = count[w];
+            int w_end   = w_begin + w_size;
+            if ( w != w0 && mpi_rank == w0_work_rank ) {
+                ATLAS_TRACE( "merge sort" );
+                std::inplace_merge( nodes.begin() + w0_begin, nodes.begin() + w_begin, nodes.begin() + w_end,
+                                    compare_WE_NS );
+            }
+            ++w;
+        }
+        if ( mpi_rank == 0 ) {
+            requests.push_back( comm.iReceive( nodes_buffer + 3 * w0_begin, 3 * w0_size,
+                                               /* source= */ w0_work_rank, /* tag= */ 0 ) );
+        }
+        if ( mpi_rank == w0_work_rank ) {
+            comm.send( nodes_buffer + 3 * w0_begin, 3 * w0_size, /* dest= */ 0,
+                       /* tag= */ 0 );
+        }
+    }
+    ATLAS_TRACE_MPI( WAIT ) {
+        for ( auto request : requests ) {
+            comm.wait( request );
+        }
+    }
+}
 
-            int w( 0 );
-            for ( int band = 0; band < nb_bands(); ++band ) {
-                int w0           = w;
-                int w0_work_rank = std::min( w0, mpi_size - 1 );
+void EqualRegionsPartitioner::partition_weighted( const Grid& grid, int part[] ) const {
+    ATLAS_TRACE( "EqualRegionsPartitioner::partition_weighted" );
 
-                for ( int p = 0; p < nb_regions( band ); ++p ) {
-                    int w_begin   = displs[w];
-                    int w_size    = count[w];
-                    int w_end     = w_begin + w_size;
-                    int work_rank = std::min( w, mpi_size - 1 );
+    ASSERT( grid.projection().units() == "degrees" );
 
-                    if ( mpi_rank == w0_work_rank ) {
-                        requests.push_back( comm.iReceive( nodes_buffer + 3 * w_begin, 3 * w_size,
-                                                           /* source= */ work_rank, /* tag= */ 0 ) );
-                    }
-                    if ( work_rank == mpi_rank ) {
-                        ATLAS_TRACE_SCOPE( "sort one bit" ) {
-                            // std::cout << w << "sorting " << w_size << std::endl;
-                            std::sort( nodes.data() + w_begin, nodes.data() + w_end, compare_WE_NS );
-                        }
-                        comm.send( nodes_buffer + 3 * w_begin, 3 * w_size,
-                                   /* dest= */ w0_work_rank, /* tag= */ 0 );
-                    }
-                    ++w;
-                }
+    const auto& comm   = mpi::comm();
+    const int mpi_rank = comm.rank();
+    const int mpi_size = comm.size();
+    const int nb_nodes = grid.size();
+
+    // Slices of consecutive points handled by each task
+    std::vector<int> w_displs( mpi_size + 1 );
+    std::vector<int> w_counts( mpi_size );
+    for ( int w = 0; w <= mpi_size; ++w ) {
+        w_displs[w] = long( nb_nodes ) * w / mpi_size;
+    }
+    for ( int w = 0; w < mpi_size; ++w ) {
+        w_counts[w] = w_displs[w + 1] - w_displs[w];
+    }
+    const int w_begin = w_displs[mpi_rank];
+    const int w_end   = w_displs[mpi_rank + 1];
+
+    std::vector<NodeInt> w_nodes( w_end - w_begin );
+    std::vector<double> w_weights( w_end - w_begin );
+    ATLAS_TRACE_SCOPE( "create one bit" ) {
+        auto filter = [w_begin, w_end]( long n ) { return ( n >= w_begin && n < w_end ); };
+        int i       = w_begin;
+        int j( 0 );
+        for ( PointXY point : grid.xy( filter ) ) {
+            w_nodes[j].x = microdeg( point.x() );
+            w_nodes[j].y = microdeg( point.y() );
+            w_nodes[j].n = i;
+            w_weights[j] = weight()( i );
+            ASSERT( w_weights[j] >= 0. );
+            ++i;
+            ++j;
+        }
+    }
+
+    // Points are ordered by keys (group, a, b, n), compared lexicographically: from north to south and west to
+    // east with (a, b) = (-y, x), or from west to east and north to south with (a, b) = (x, -y). The global
+    // index n makes the keys unique. Sorted keys of the points of this slice, and sums of their weights:
+    // cumulative[j] is the weight of the first j keys.
+    using Key = std::array<int, 4>;
+    std::vector<std::pair<Key, double>> keys( w_nodes.size() );
+    std::vector<double> cumulative( w_nodes.size() + 1, 0. );
+    auto sort_keys = [&]( const std::function<Key( size_t j )>& key ) {
+        for ( size_t j = 0; j < w_nodes.size(); ++j ) {
+            keys[j] = std::make_pair( key( j ), w_weights[j] );
+        }
+        std::sort( keys.begin(), keys.end() );
+        for ( size_t j = 0; j < keys.size(); ++j ) {
+            cumulative[j + 1] = cumulative[j] + keys[j].second;
+        }
+    };
+    auto weight_up_to = [&]( const Key& key ) {
+        auto it = std::upper_bound( keys.begin(), keys.end(), key,
+                                    []( const Key& k, const std::pair<Key, double>& p ) { return k < p.first; } );
+        return cumulative[it - keys.begin()];
+    };
+
+    double sum = std::accumulate( w_weights.begin(), w_weights.end(), 0. );
+    ATLAS_TRACE_MPI( ALLREDUCE ) { comm.allReduceInPlace( sum, eckit::mpi::sum() ); }
+    ASSERT( sum > 0. );
+
+    // Partition p starts with the first point at which the sum of the weights of the points over all tasks, in
+    // the order of the keys, exceeds sum * p / N. For every p in first, find the key of this point by bisection
+    // within the given group, one component after the other, with the components not yet found at their
+    // largest value. Each step reduces the weights up to the middle keys over all tasks, for all p at once.
+    auto split = [&]( const std::vector<int>& group, const std::vector<int>& first ) {
+        const size_t K = first.size();
+        std::vector<Key> lo( K ), hi( K ), mid( K );
+        std::vector<double> count( K );
+        for ( size_t k = 0; k < K; ++k ) {
+            lo[k] = hi[k] = Key{group[k], std::numeric_limits<int>::max(), std::numeric_limits<int>::max(),
+                                std::numeric_limits<int>::max()};
+        }
+        for ( int c = 1; c < 4; ++c ) {
+            for ( size_t k = 0; k < K; ++k ) {
+                lo[k][c] = std::numeric_limits<int>::min();
             }
-            ATLAS_TRACE_MPI( WAIT ) {
-                for ( auto request : requests ) {
-                    comm.wait( request );
+            while ( true ) {
+                bool converged = true;
+                for ( size_t k = 0; k < K; ++k ) {
+                    mid[k]    = lo[k];
+                    mid[k][c] = int( lo[k][c] + ( long( hi[k][c] ) - long( lo[k][c] ) ) / 2 );
+                    count[k]  = weight_up_to( mid[k] );
+                    converged = converged && lo[k][c] == hi[k][c];
                 }
-            }
-            requests.clear();
-            w = 0;
-            for ( int band = 0; band < nb_bands(); ++band ) {
-                int w0           = w;
-                int w0_begin     = b_displs[band];
-                int w0_size      = b_count[band];
-                int w0_work_rank = std::min( w0, mpi_size - 1 );
-
-                for ( int p = 0; p < nb_regions( band ); ++p ) {
-                    int w_begin = displs[w];
-                    int w_size  = count[w];
-                    int w_end   = w_begin + w_size;
-                    if ( w != w0 && mpi_rank == w0_work_rank ) {
-                        ATLAS_TRACE( "merge sort" );
-                        std::inplace_merge( nodes.begin() + w0_begin, nodes.begin() + w_begin, nodes.begin() + w_end,
-                                            compare_WE_NS );
+                if ( converged ) { break; }
+                ATLAS_TRACE_MPI( ALLREDUCE ) { comm.allReduceInPlace( count.data(), K, eckit::mpi::sum() ); }
+                for ( size_t k = 0; k < K; ++k ) {
+                    if ( lo[k][c] < hi[k][c] ) {
+                        if ( count[k] > sum * first[k] / N_ ) { hi[k][c] = mid[k][c]; }
+                        else {
+                            lo[k][c] = mid[k][c] + 1;
+                        }
                     }
-                    ++w;
-                }
-                if ( mpi_rank == 0 ) {
-                    requests.push_back( comm.iReceive( nodes_buffer + 3 * w0_begin, 3 * w0_size,
-                                                       /* source= */ w0_work_rank, /* tag= */ 0 ) );
-                }
-                if ( mpi_rank == w0_work_rank ) {
-                    comm.send( nodes_buffer + 3 * w0_begin, 3 * w0_size, /* dest= */ 0,
-                               /* tag= */ 0 );
-                }
-            }
-            ATLAS_TRACE_MPI( WAIT ) {
-                for ( auto request : requests ) {
-                    comm.wait( request );
                 }
             }
+        }
+        return lo;
+    };
 
-            /*
-      Create list that tells in original node numbering which part the node
-      belongs to
-      */
-            for ( int p = 0; p < nb_parts; ++p ) {
-                int begin = displs[p];
-                int end   = begin + count[p];
-                for ( int i = begin; i < end; ++i ) {
-                    part[nodes[i].n] = p;
-                }
-            }
-            ATLAS_TRACE_MPI( BROADCAST ) { comm.broadcast( part, nb_nodes, 0 ); }
+    std::vector<int> b_part( nb_bands() + 1, 0 );
+    for ( int band = 0; band < nb_bands(); ++band ) {
+        b_part[band + 1] = b_part[band] + nb_regions( band );
+    }
+
+    // Bands, sorting the points from north to south, and west to east. Band b starts with partition b_part[b].
+    std::vector<Key> b_first;
+    ATLAS_TRACE_SCOPE( "bands" ) {
+        sort_keys( [&]( size_t j ) { return Key{0, -w_nodes[j].y, w_nodes[j].x, w_nodes[j].n}; } );
+        b_first = split( std::vector<int>( nb_bands() - 1, 0 ),
+                         std::vector<int>( b_part.begin() + 1, b_part.end() - 1 ) );
+    }
+    std::vector<int> w_band( w_nodes.size() );
+    for ( size_t j = 0; j < w_nodes.size(); ++j ) {
+        const Key key = {0, -w_nodes[j].y, w_nodes[j].x, w_nodes[j].n};
+        w_band[j]     = int( std::upper_bound( b_first.begin(), b_first.end(), key ) - b_first.begin() );
+    }
+
+    // Sectors, sorting the points of every band from west to east, and north to south. The keys of the bands
+    // follow each other, so that the weights up to a key include those of the previous bands.
+    std::vector<int> group;
+    std::vector<int> first;
+    for ( int band = 0; band < nb_bands(); ++band ) {
+        for ( int p = b_part[band] + 1; p < b_part[band + 1]; ++p ) {
+            group.push_back( band );
+            first.push_back( p );
+        }
+    }
+    std::vector<Key> s_first;
+    ATLAS_TRACE_SCOPE( "sectors" ) {
+        sort_keys( [&]( size_t j ) { return Key{w_band[j], w_nodes[j].x, -w_nodes[j].y, w_nodes[j].n}; } );
+        s_first = split( group, first );
+    }
+
+    // Partition of the points of this slice, and of all points
+    std::vector<int> w_part( w_nodes.size() );
+    for ( size_t j = 0; j < w_nodes.size(); ++j ) {
+        const int band = w_band[j];
+        const Key key  = {band, w_nodes[j].x, -w_nodes[j].y, w_nodes[j].n};
+        auto begin     = s_first.begin() + ( b_part[band] - band );
+        auto end       = s_first.begin() + ( b_part[band + 1] - band - 1 );
+        w_part[j]      = b_part[band] + int( std::upper_bound( begin, end, key ) - begin );
+    }
+    ATLAS_TRACE_MPI( ALLGATHER ) {
+        comm.allGatherv( w_part.begin(), w_part.end(), part, w_counts.data(), w_displs.data() );
+    }
+}
+
+void EqualRegionsPartitioner::partition( const Grid& grid, int part[] ) const {
+    std::vector<gidx_t> run_end;
+    std::vector<int> run_part;
+    if ( N_ > 1 && weighted() ) { partition_weighted( grid, part ); }
+    else if ( partition_runs( grid, run_end, run_part ) ) {
+        gidx_t begin = 0;
+        for ( size_t r = 0; r < run_end.size(); ++r ) {
+            std::fill( part + begin, part + run_end[r], run_part[r] );
+            begin = run_end[r];
+        }
+    }
+    else if ( N_ == 1 ) {  // trivial solution, so much faster
+        for ( size_t j = 0; j < grid.size(); ++j )
+            part[j] = 0;
+    }
+    else {
+        ATLAS_TRACE( "EqualRegionsPartitioner::partition" );
+
+        ASSERT( grid.projection().units() == "degrees" );
+
+        const auto& comm = mpi::comm();
+
+        std::vector<NodeInt> nodes( grid.size() );
+
+        /*
+    Sort nodes from north to south, and west to east. Now we can easily split
+    the points in bands. StructuredGrids, which come in this order by
+    construction, are partitioned by partition_runs instead.
+    */
+        sort_all( grid, nodes );
 
-        }  // sort bands
-    }      // else
+        /*
+    For every band, now sort from west to east, and north to south. Inside every
+    band
+    we can now easily split nodes in sectors.
+    */
+        int nb_parts        = N_;
+        int nb_nodes        = grid.size();
+        int chunk_size      = nb_nodes / nb_parts;
+        int chunk_remainder = nb_nodes - chunk_size * nb_parts;
+        std::vector<int> count( nb_parts );
+        std::vector<int> displs( nb_parts );
+        for ( int p = 0, end = 0; p < nb_parts; ++p ) {
+            displs[p] = end;
+            count[p]  = chunk_size + ( p < chunk_remainder ? 1 : 0 );
+            end += count[p];
+        }
+        sort_bands( nodes, displs, count );
+
+        /*
+    Create list that tells in original node numbering which part the node
+    belongs to
+    */
+        for ( int p = 0; p < nb_parts; ++p ) {
+            int begin = displs[p];
+            int end   = begin + count[p];
+            for ( int i = begin; i < end; ++i ) {
+                part[nodes[i].n] = p;
+            }
+        }
+        ATLAS_TRACE_MPI( BROADCAST ) { comm.broadcast( part, nb_nodes, 0 ); }
+    }
 }
 
 }  // namespace partitioner
@@ -87,8 +87,18 @@ public:
 
     virtual void partition( const Grid&, int part[] ) const;
 
+    /// For a StructuredGrid, the points of each band and sector are found directly from the rows of the grid,
+    /// without sorting nor communication, with the same result as partition( grid, part[] ).
+    /// Not supported with weights.
+    virtual bool partition_runs( const Grid&, std::vector<gidx_t>& run_end, std::vector<int>& run_part ) const;
+
     virtual std::string type() const { return "equal_regions"; }
 
+    /// With weights, bands and sectors are cut where the sum of the weights of their points, rather than
+    /// their number, reaches that of the partitions they contain. Each task only holds a slice of the points,
+    /// and the cuts are found by bisection on the point coordinates, with sums of weights reduced over all tasks.
+    virtual bool supports_weights() const { return true; }
+
 public:
     // Node struct that holds the longitude and latitude in millidegrees
     // (integers)
@@ -104,6 +114,16 @@ private:
     // algorithm is used internally
     void partition( int nb_nodes, NodeInt nodes[], int part[] ) const;
 
+    void partition_weighted( const Grid&, int part[] ) const;
+
+    // Sort the nodes of the grid from north to south and west to east: each task sorts a slice, task 0 merges
+    // the slices, and all tasks receive the result
+    void sort_all( const Grid&, std::vector<NodeInt>& nodes ) const;
+
+    // Sort the nodes of every band from west to east and north to south: each task sorts the nodes of one
+    // partition [ displs[p], displs[p] + count[p] ), and task 0 receives the result
+    void sort_bands( std::vector<NodeInt>& nodes, const std::vector<int>& displs, const std::vector<int>& count ) const;
+
     // x and y in radians
     int partition( const double& x, const double& y ) const;
 
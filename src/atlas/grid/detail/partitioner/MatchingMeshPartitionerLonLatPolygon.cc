@@ -10,6 +10,9 @@
 
 #include "atlas/grid/detail/partitioner/MatchingMeshPartitionerLonLatPolygon.h"
 
+#include <algorithm>
+#include <set>
+#include <utility>
 #include <vector>
 
 #include "eckit/config/Resource.h"
@@ -19,6 +22,7 @@
 #include "atlas/mesh/Nodes.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
 #include "atlas/util/LonLatPolygon.h"
 
 namespace atlas {
@@ -31,6 +35,18 @@ PartitionerBuilder<MatchingMeshPartitionerLonLatPolygon> __builder( "lonlat-poly
 }
 
 void MatchingMeshPartitionerLonLatPolygon::partition( const Grid& grid, int partitioning[] ) const {
+    std::vector<gidx_t> run_end;
+    std::vector<int> run_part;
+    partition_runs( grid, run_end, run_part );
+    gidx_t begin = 0;
+    for ( size_t r = 0; r < run_end.size(); ++r ) {
+        std::fill( partitioning + begin, partitioning + run_end[r], run_part[r] );
+        begin = run_end[r];
+    }
+}
+
+bool MatchingMeshPartitionerLonLatPolygon::partition_runs( const Grid& grid, std::vector<gidx_t>& run_end,
+                                                           std::vector<int>& run_part ) const {
     const eckit::mpi::Comm& comm = atlas::mpi::comm();
     const int mpi_rank           = int( comm.rank() );
     const int mpi_size           = int( comm.size() );
@@ -47,30 +63,114 @@ void MatchingMeshPartitionerLonLatPolygon::partition( const Grid& grid, int part
     bool includesSouthPole = ( mpi_rank == mpi_size - 1 );
 
     const util::LonLatPolygon poly( prePartitionedMesh_.polygon( 0 ), prePartitionedMesh_.nodes().lonlat() );
-
-    {
+    const PointLonLat& min = poly.coordinatesMin();
+    const PointLonLat& max = poly.coordinatesMax();
+
+    // Runs [begin,end) of points owned by this task, stored as begin, end, begin, end, ...
+    std::vector<gidx_t> owned;
+    auto add_owned = [&owned]( gidx_t n ) {
+        if ( !owned.empty() && owned.back() == n ) { ++owned.back(); }
+        else {
+            owned.push_back( n );
+            owned.push_back( n + 1 );
+        }
+    };
+
+    StructuredGrid structured( grid );
+    if ( structured && grid.projection().type() == "lonlat" ) {
+        // (x,y) = (lon,lat), and rows are parallels
+        std::vector<idx_t> edges;
+        structured.for_each_row( [&]( const StructuredGrid::Row& row ) {
+            const double lat = row.y;
+            const bool atThePole =
+                ( includesNorthPole && lat >= max.lat() ) || ( includesSouthPole && lat < min.lat() );
+            idx_t i_begin = row.i_begin;
+            idx_t i_end   = row.i_end;
+            if ( not atThePole ) {
+                if ( lat >= max.lat() || lat < min.lat() ) { return; }
+                poly.edgesCrossing( lat, edges );
+
+                // x increases along the row: find the points within the longitudes of the polygon
+                while ( i_begin < i_end && row.x( i_begin ) < min.lon() ) {
+                    ++i_begin;
+                }
+                while ( i_end > i_begin && row.x( i_end - 1 ) >= max.lon() ) {
+                    --i_end;
+                }
+            }
+            for ( idx_t i = i_begin; i < i_end; ++i ) {
+                if ( atThePole || poly.contains( PointLonLat( row.x( i ), lat ), edges ) ) {
+                    add_owned( row.n + ( i - row.i_begin ) );
+                }
+            }
+        } );
+    }
+    else {
         eckit::ProgressTimer timer( "Partitioning", grid.size(), "point", double( 10 ), atlas::Log::trace() );
-        size_t i = 0;
+        gidx_t i = 0;
 
         for ( const PointXY Pxy : grid.xy() ) {
             ++timer;
             const PointLonLat P  = grid.projection().lonlat( Pxy );
-            const bool atThePole = ( includesNorthPole && P.lat() >= poly.coordinatesMax().lat() ) ||
-                                   ( includesSouthPole && P.lat() < poly.coordinatesMin().lat() );
+            const bool atThePole = ( includesNorthPole && P.lat() >= max.lat() ) ||
+                                   ( includesSouthPole && P.lat() < min.lat() );
 
-            partitioning[i++] = atThePole || poly.contains( P ) ? mpi_rank : -1;
+            if ( atThePole || poly.contains( P ) ) { add_owned( i ); }
+            ++i;
         }
     }
 
-    // Synchronize partitioning, do a sanity check
-    comm.allReduceInPlace( partitioning, grid.size(), eckit::mpi::Operation::MAX );
-    const int min = *std::min_element( partitioning, partitioning + grid.size() );
-    if ( min < 0 ) {
+    // Synchronize partitioning: gather the runs owned by every task
+    eckit::mpi::Buffer<gidx_t> recv( mpi_size );
+    ATLAS_TRACE_MPI( ALLGATHER ) { comm.allGatherv( owned.begin(), owned.end(), recv ); }
+
+    // Points owned by several tasks go to the highest rank. Sweep over the begins (+) and ends (-) of all runs.
+    std::vector<std::pair<gidx_t, int>> events;
+    events.reserve( recv.buffer.size() );
+    for ( int p = 0; p < mpi_size; ++p ) {
+        for ( int j = 0; j < recv.counts[p]; j += 2 ) {
+            events.emplace_back( recv.buffer[recv.displs[p] + j], p + 1 );
+            events.emplace_back( recv.buffer[recv.displs[p] + j + 1], -( p + 1 ) );
+        }
+    }
+    std::sort( events.begin(), events.end() );
+
+    run_end.clear();
+    run_part.clear();
+    std::multiset<int> active;
+    gidx_t n = 0;
+    for ( size_t e = 0; e < events.size(); ) {
+        const gidx_t position = events[e].first;
+        if ( position > n ) {
+            // Do a sanity check
+            if ( active.empty() ) {
+                throw eckit::SeriousBug(
+                    "Could not find partition for target node (source "
+                    "mesh does not contain all target grid points)",
+                    Here() );
+            }
+            const int p = *active.rbegin();
+            if ( !run_part.empty() && run_part.back() == p ) { run_end.back() = position; }
+            else {
+                run_end.push_back( position );
+                run_part.push_back( p );
+            }
+            n = position;
+        }
+        for ( ; e < events.size() && events[e].first == position; ++e ) {
+            if ( events[e].second > 0 ) { active.insert( events[e].second - 1 ); }
+            else {
+                active.erase( active.find( -events[e].second - 1 ) );
+            }
+        }
+    }
+    if ( n != grid.size() ) {
         throw eckit::SeriousBug(
             "Could not find partition for target node (source "
             "mesh does not contain all target grid points)",
             Here() );
     }
+    return true;
 }
 
 }  // namespace partitioner
@@ -36,6 +36,13 @@ public:
    */
     void partition( const Grid& grid, int partitioning[] ) const;
 
+    /**
+   * @brief Partition a grid as runs of consecutive points, see partition( grid, partitioning ).
+   * Each task tests only the grid points within the bounding box of its polygon (of a StructuredGrid,
+   * row by row, against the polygon edges crossing the row), and the tasks exchange the runs of points they own.
+   */
+    virtual bool partition_runs( const Grid& grid, std::vector<gidx_t>& run_end, std::vector<int>& run_part ) const;
+
     virtual std::string type() const { return static_type(); }
 };
 
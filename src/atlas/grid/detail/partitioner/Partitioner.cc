@@ -13,6 +13,7 @@
 #include <map>
 #include <string>
 
+#include "eckit/exception/Exceptions.h"
 #include "eckit/thread/AutoLock.h"
 #include "eckit/thread/Mutex.h"
 
@@ -23,6 +24,7 @@
 #include "atlas/grid/detail/partitioner/MatchingMeshPartitionerBruteForce.h"
 #include "atlas/grid/detail/partitioner/MatchingMeshPartitionerLonLatPolygon.h"
 #include "atlas/grid/detail/partitioner/MatchingMeshPartitionerSphericalPolygon.h"
+#include "atlas/grid/detail/partitioner/SpaceFillingCurvePartitioner.h"
 #include "atlas/library/config.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/runtime/Log.h"
@@ -54,6 +56,17 @@ Partitioner::Partitioner( const idx_t nb_partitions ) : nb_partitions_( nb_parti
 
 Partitioner::~Partitioner() {}
 
+bool Partitioner::partition_runs( const Grid&, std::vector<gidx_t>&, std::vector<int>& ) const {
+    return false;
+}
+
+void Partitioner::set_weight( const Weight& weight ) {
+    if ( weight && not supports_weights() ) {
+        throw eckit::NotImplemented( "Partitioner " + type() + " does not support weights", Here() );
+    }
+    weight_ = weight;
+}
+
 idx_t Partitioner::nb_partitions() const {
     return nb_partitions_;
 }
@@ -72,6 +85,7 @@ void load_builder() {
 struct force_link {
     force_link() {
         load_builder<EqualRegionsPartitioner>();
+        load_builder<SpaceFillingCurvePartitioner>();
 #if ATLAS_HAVE_TRANS
         load_builder<TransPartitioner>();
 #endif
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include "eckit/memory/Owned.h"
 
 #include "atlas/grid/Distribution.h"
@@ -25,6 +27,9 @@ class Partitioner : public eckit::Owned {
 public:
     using Grid = atlas::Grid;
 
+    /// @brief Computational cost of a grid point, given its global index (starting from 0)
+    using Weight = std::function<double( gidx_t )>;
+
 public:
     Partitioner();
     Partitioner( const idx_t nb_partitions );
@@ -32,14 +37,31 @@ public:
 
     virtual void partition( const Grid& grid, int part[] ) const = 0;
 
+    /// @brief Partition as runs of consecutive global indices: run r consists of the points
+    /// [ run_end[r-1], run_end[r] ) (starting from 0), which belong to partition run_part[r].
+    /// @return false if not supported for this grid, in which case partition( grid, part[] ) is to be used
+    virtual bool partition_runs( const Grid& grid, std::vector<gidx_t>& run_end, std::vector<int>& run_part ) const;
+
     Distribution partition( const Grid& grid ) const;
 
     idx_t nb_partitions() const;
 
     virtual std::string type() const = 0;
 
+    /// @brief Whether the partitioner can balance the sum of the weights of the points of each partition
+    virtual bool supports_weights() const { return false; }
+
+    /// @brief Balance the sum of the weights of the points of each partition, instead of their number.
+    /// The weights must be non-negative, and are only evaluated for the points handled by this task.
+    void set_weight( const Weight& );
+
+    bool weighted() const { return bool( weight_ ); }
+
+    const Weight& weight() const { return weight_; }
+
 private:
     idx_t nb_partitions_;
+    Weight weight_;
 };
 
 // ------------------------------------------------------------------
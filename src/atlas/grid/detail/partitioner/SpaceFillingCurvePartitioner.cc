@@ -0,0 +1,240 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/grid/detail/partitioner/SpaceFillingCurvePartitioner.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "atlas/grid/Grid.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
+#include "atlas/util/UnitSphere.h"
+#include "eckit/exception/Exceptions.h"
+
+namespace atlas {
+namespace grid {
+namespace detail {
+namespace partitioner {
+
+namespace {
+
+constexpr int nb_bits = 21;
+
+// Position along the curve of a point, made unique by its global index
+using Key = std::pair<uint64_t, gidx_t>;
+
+}  // namespace
+
+SpaceFillingCurvePartitioner::SpaceFillingCurvePartitioner() : Partitioner() {}
+
+SpaceFillingCurvePartitioner::SpaceFillingCurvePartitioner( int N ) : Partitioner( N ) {}
+
+uint64_t SpaceFillingCurvePartitioner::hilbert( const PointXYZ& p ) {
+    // Integer coordinates of the cell containing p
+    const uint32_t max = ( uint32_t( 1 ) << nb_bits ) - 1;
+    uint32_t X[3];
+    for ( int d = 0; d < 3; ++d ) {
+        const double c = std::min( 1., std::max( -1., p[d] ) );
+        X[d]           = uint32_t( ( c + 1. ) * 0.5 * max + 0.5 );
+    }
+
+    // Transpose of the Hilbert index, following
+    //   J. Skilling, Programming the Hilbert curve, AIP Conf. Proc. 707, pp. 381-387 (2004)
+    const uint32_t M = uint32_t( 1 ) << ( nb_bits - 1 );
+    for ( uint32_t Q = M; Q > 1; Q >>= 1 ) {  // inverse undo
+        const uint32_t P = Q - 1;
+        for ( int d = 0; d < 3; ++d ) {
+            if ( X[d] & Q ) { X[0] ^= P; }  // invert
+            else {                          // exchange
+                const uint32_t t = ( X[0] ^ X[d] ) & P;
+                X[0] ^= t;
+                X[d] ^= t;
+            }
+        }
+    }
+    for ( int d = 1; d < 3; ++d ) {  // Gray encode
+        X[d] ^= X[d - 1];
+    }
+    uint32_t t = 0;
+    for ( uint32_t Q = M; Q > 1; Q >>= 1 ) {
+        if ( X[2] & Q ) { t ^= Q - 1; }
+    }
+    for ( int d = 0; d < 3; ++d ) {
+        X[d] ^= t;
+    }
+
+    // Interleave the bits of the transpose, most significant first
+    uint64_t h = 0;
+    for ( int b = nb_bits - 1; b >= 0; --b ) {
+        for ( int d = 0; d < 3; ++d ) {
+            h = ( h << 1 ) | ( ( X[d] >> b ) & 1 );
+        }
+    }
+    return h;
+}
+
+void SpaceFillingCurvePartitioner::partition( const Grid& grid, int part[] ) const {
+    ATLAS_TRACE( "SpaceFillingCurvePartitioner::partition" );
+
+    const int N           = nb_partitions();
+    const gidx_t nb_nodes = grid.size();
+    if ( N == 1 ) {
+        std::fill( part, part + nb_nodes, 0 );
+        return;
+    }
+
+    const auto& comm   = mpi::comm();
+    const int mpi_rank = int( comm.rank() );
+    const int mpi_size = int( comm.size() );
+
+    // Slices of consecutive points handled by each task
+    std::vector<int> w_displs( mpi_size + 1 );
+    std::vector<int> w_counts( mpi_size );
+    for ( int w = 0; w <= mpi_size; ++w ) {
+        w_displs[w] = nb_nodes * w / mpi_size;
+    }
+    for ( int w = 0; w < mpi_size; ++w ) {
+        w_counts[w] = w_displs[w + 1] - w_displs[w];
+    }
+    const gidx_t begin = w_displs[mpi_rank];
+    const gidx_t end   = w_displs[mpi_rank + 1];
+
+    // Position along the curve of the points of this slice, sorted
+    std::vector<Key> keys( end - begin );
+    ATLAS_TRACE_SCOPE( "compute positions along curve" ) {
+        std::vector<double> lonlat;
+        lonlat.reserve( 2 * keys.size() );
+        auto filter = [begin, end]( long n ) { return ( n >= begin && n < end ); };
+        for ( PointXY p : grid.xy( filter ) ) {
+            lonlat.push_back( p.x() );
+            lonlat.push_back( p.y() );
+        }
+        ASSERT( lonlat.size() == 2 * keys.size() );
+        grid.projection().xy2lonlat( keys.size(), lonlat.data(), lonlat.data() + 1, lonlat.data(), lonlat.data() + 1,
+                                     2 );
+        for ( size_t j = 0; j < keys.size(); ++j ) {
+            PointXYZ xyz;
+            util::UnitSphere::convertSphericalToCartesian( PointLonLat( lonlat[2 * j], lonlat[2 * j + 1] ), xyz );
+            keys[j] = Key( hilbert( xyz ), begin + j );
+        }
+    }
+    ATLAS_TRACE_SCOPE( "sort" ) { std::sort( keys.begin(), keys.end() ); }
+
+    // cumulative[j]: sum of the weights of the first j sorted points of this slice, with all weights 1 if
+    // not weighted
+    std::vector<double> cumulative( keys.size() + 1, 0. );
+    for ( size_t j = 0; j < keys.size(); ++j ) {
+        const double w = weighted() ? weight()( keys[j].second ) : 1.;
+        ASSERT( w >= 0. );
+        cumulative[j + 1] = cumulative[j] + w;
+    }
+
+    // Partition p starts with the first point along the curve, over all tasks, at which the sum of the weights
+    // exceeds first[p]. Without weights, this is the point number first[p].
+    std::vector<double> first( N, 0. );
+    double total = cumulative.back();
+    if ( weighted() ) {
+        ATLAS_TRACE_MPI( ALLREDUCE ) { comm.allReduceInPlace( total, eckit::mpi::sum() ); }
+        for ( int p = 1; p < N; ++p ) {
+            first[p] = total * p / N;
+        }
+    }
+    else {
+        total                        = nb_nodes;
+        const gidx_t chunk_size      = nb_nodes / N;
+        const gidx_t chunk_remainder = nb_nodes - chunk_size * N;
+        for ( int p = 1; p < N; ++p ) {
+            first[p] = first[p - 1] + chunk_size + ( p - 1 < chunk_remainder ? 1 : 0 );
+        }
+    }
+
+    // Key of the first point of each partition: the smallest key such that the points with a key lower or equal
+    // weigh more than first[p]. Found by bisection for all partitions at once, first on the position along the
+    // curve, then on the global index among the points at that position.
+    std::vector<Key> split( N, Key( std::numeric_limits<uint64_t>::max(), nb_nodes ) );
+    ATLAS_TRACE_SCOPE( "find first point of partitions" ) {
+        std::vector<Key> lo( N );
+        std::vector<Key> hi( N );
+        std::vector<double> count( N );
+        auto bisect = [&]( const std::function<Key( const Key&, const Key& )>& midpoint,
+                           const std::function<Key( const Key& )>& next ) {
+            while ( true ) {
+                std::vector<Key> mid( N );
+                bool converged = true;
+                for ( int p = 1; p < N; ++p ) {
+                    if ( lo[p] < hi[p] ) {
+                        converged = false;
+                        mid[p]    = midpoint( lo[p], hi[p] );
+                    }
+                }
+                if ( converged ) { break; }
+                for ( int p = 1; p < N; ++p ) {
+                    count[p] = cumulative[std::upper_bound( keys.begin(), keys.end(), mid[p] ) - keys.begin()];
+                }
+                ATLAS_TRACE_MPI( ALLREDUCE ) { comm.allReduceInPlace( count.data(), N, eckit::mpi::sum() ); }
+                for ( int p = 1; p < N; ++p ) {
+                    if ( lo[p] < hi[p] ) {
+                        if ( count[p] > first[p] ) { hi[p] = mid[p]; }
+                        else {
+                            lo[p] = next( mid[p] );
+                        }
+                    }
+                }
+            }
+        };
+
+        // Position along the curve, counting all points at a position
+        const uint64_t last = ( uint64_t( 1 ) << ( 3 * nb_bits ) ) - 1;
+        for ( int p = 1; p < N; ++p ) {
+            lo[p] = Key( 0, nb_nodes );
+            hi[p] = first[p] < total ? Key( last, nb_nodes ) : lo[p];
+        }
+        bisect( []( const Key& l, const Key& h ) { return Key( l.first + ( h.first - l.first ) / 2, l.second ); },
+                []( const Key& m ) { return Key( m.first + 1, m.second ); } );
+
+        // Global index, among the points at that position
+        for ( int p = 1; p < N; ++p ) {
+            if ( first[p] < total ) {
+                lo[p] = Key( hi[p].first, 0 );
+                hi[p] = Key( hi[p].first, nb_nodes - 1 );
+            }
+        }
+        bisect( []( const Key& l, const Key& h ) { return Key( l.first, l.second + ( h.second - l.second ) / 2 ); },
+                []( const Key& m ) { return Key( m.first, m.second + 1 ); } );
+
+        for ( int p = 1; p < N; ++p ) {
+            if ( first[p] < total ) { split[p] = lo[p]; }
+        }
+    }
+
+    // Partition of the points of this slice, and of all points
+    std::vector<int> w_part( keys.size() );
+    for ( const Key& key : keys ) {
+        w_part[key.second - begin] = int( std::upper_bound( split.begin() + 1, split.end(), key ) - split.begin() ) - 1;
+    }
+    ATLAS_TRACE_MPI( ALLGATHER ) {
+        comm.allGatherv( w_part.begin(), w_part.end(), part, w_counts.data(), w_displs.data() );
+    }
+}
+
+}  // namespace partitioner
+}  // namespace detail
+}  // namespace grid
+}  // namespace atlas
+
+namespace {
+atlas::grid::detail::partitioner::PartitionerBuilder<atlas::grid::detail::partitioner::SpaceFillingCurvePartitioner>
+    __SpaceFillingCurve( "space_filling_curve" );
+}
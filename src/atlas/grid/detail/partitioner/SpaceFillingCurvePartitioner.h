@@ -0,0 +1,55 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "atlas/grid/detail/partitioner/Partitioner.h"
+#include "atlas/util/Point.h"
+
+namespace atlas {
+namespace grid {
+namespace detail {
+namespace partitioner {
+
+/// @brief Partitioner ordering the grid points along a Hilbert space-filling curve
+///
+/// The curve runs through the cube [-1,1]^3 containing the unit sphere, so that points close to each other on
+/// the sphere are mostly close to each other along the curve. The points, ordered along the curve, are cut
+/// in chunks of consecutive points, one per partition. This gives compact partitions for any grid, including
+/// unstructured grids and observation clouds.
+///
+/// The sort is distributed: each task computes the position along the curve of a slice of the points, and the
+/// positions where the curve is cut are found by bisection, counting the points of all tasks with reductions.
+/// With weights, the curve is cut in chunks of equal sums of the weights of their points instead.
+class SpaceFillingCurvePartitioner : public Partitioner {
+public:
+    static std::string static_type() { return "space_filling_curve"; }
+
+public:
+    SpaceFillingCurvePartitioner();
+
+    SpaceFillingCurvePartitioner( int N );
+
+    virtual void partition( const Grid&, int part[] ) const;
+
+    virtual std::string type() const { return static_type(); }
+
+    virtual bool supports_weights() const { return true; }
+
+    /// @brief Index along the Hilbert curve of a point within the cube [-1,1]^3, with 21 bits per dimension
+    static uint64_t hilbert( const PointXYZ& );
+};
+
+}  // namespace partitioner
+}  // namespace detail
+}  // namespace grid
+}  // namespace atlas
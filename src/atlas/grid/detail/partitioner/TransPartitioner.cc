@@ -8,6 +8,10 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
 #include "eckit/exception/Exceptions.h"
 
 #include "atlas/array.h"
@@ -44,6 +48,18 @@ TransPartitioner::TransPartitioner( const idx_t N ) : Partitioner( N ) {
 TransPartitioner::~TransPartitioner() {}
 
 void TransPartitioner::partition( const Grid& grid, int part[] ) const {
+    std::vector<gidx_t> run_end;
+    std::vector<int> run_part;
+    partition_runs( grid, run_end, run_part );
+    gidx_t begin = 0;
+    for ( size_t r = 0; r < run_end.size(); ++r ) {
+        std::fill( part + begin, part + run_end[r], run_part[r] );
+        begin = run_end[r];
+    }
+}
+
+bool TransPartitioner::partition_runs( const Grid& grid, std::vector<gidx_t>& run_end,
+                                       std::vector<int>& run_part ) const {
     ATLAS_TRACE( "TransPartitioner::partition" );
 
     StructuredGrid g( grid );
@@ -62,8 +78,6 @@ void TransPartitioner::partition( const Grid& grid, int part[] ) const {
         throw eckit::BadParameter( msg.str(), Here() );
     }
 
-    int nlonmax = g.nxmax();
-
     array::LocalView<int, 1> nloen       = t.nloen();
     array::LocalView<int, 1> n_regions   = t.n_regions();
     array::LocalView<int, 1> nfrstlat    = t.nfrstlat();
@@ -72,31 +86,46 @@ void TransPartitioner::partition( const Grid& grid, int part[] ) const {
     array::LocalView<int, 2> nsta        = t.nsta();
     array::LocalView<int, 2> nonl        = t.nonl();
 
-    int i( 0 );
-    int maxind( 0 );
-    std::vector<int> iglobal( t.ndgl() * nlonmax, -1 );
-
+    // Global index of the first point of each latitude
+    std::vector<gidx_t> first( t.ndgl() + 1, 0 );
     for ( int jgl = 0; jgl < t.ndgl(); ++jgl ) {
-        for ( int jl = 0; jl < nloen( jgl ); ++jl ) {
-            ++i;
-            iglobal[jgl * nlonmax + jl] = i;
-            maxind                      = std::max( maxind, jgl * nlonmax + jl );
-        }
+        first[jgl + 1] = first[jgl] + nloen( jgl );
     }
+
+    // Every partition owns a contiguous range of points of each of its latitudes: (begin, end, partition)
+    std::vector<std::tuple<gidx_t, gidx_t, int>> ranges;
     int iproc( 0 );
     for ( int ja = 0; ja < t.n_regions_NS(); ++ja ) {
         for ( int jb = 0; jb < n_regions( ja ); ++jb ) {
             for ( int jgl = nfrstlat( ja ) - 1; jgl < nlstlat( ja ); ++jgl ) {
                 int igl = nptrfrstlat( ja ) + jgl - nfrstlat( ja );
-                for ( int jl = nsta( jb, igl ) - 1; jl < nsta( jb, igl ) + nonl( jb, igl ) - 1; ++jl ) {
-                    size_t ind = iglobal[jgl * nlonmax + jl] - 1;
-                    if ( ind >= grid.size() ) throw eckit::OutOfRange( ind, grid.size(), Here() );
-                    part[ind] = iproc;
+                if ( nonl( jb, igl ) > 0 ) {
+                    gidx_t begin = first[jgl] + nsta( jb, igl ) - 1;
+                    ranges.emplace_back( begin, begin + nonl( jb, igl ), iproc );
                 }
             }
             ++iproc;
         }
     }
+    std::sort( ranges.begin(), ranges.end() );
+
+    run_end.clear();
+    run_part.clear();
+    gidx_t end = 0;
+    for ( const auto& range : ranges ) {
+        if ( std::get<1>( range ) > gidx_t( grid.size() ) ) {
+            throw eckit::OutOfRange( std::get<1>( range ) - 1, grid.size(), Here() );
+        }
+        ASSERT( std::get<0>( range ) == end );
+        end = std::get<1>( range );
+        if ( !run_part.empty() && run_part.back() == std::get<2>( range ) ) { run_end.back() = end; }
+        else {
+            run_end.push_back( end );
+            run_part.push_back( std::get<2>( range ) );
+        }
+    }
+    ASSERT( end == gidx_t( grid.size() ) );
+    return true;
 }
 
 int TransPartitioner::nb_bands() const {
@@ -39,6 +39,8 @@ public:
     /// of the spectral coefficients (LDGRIDONLY=TRUE)
     virtual void partition( const Grid&, int part[] ) const;
 
+    virtual bool partition_runs( const Grid&, std::vector<gidx_t>& run_end, std::vector<int>& run_part ) const;
+
     int nb_bands() const;
 
     int nb_regions( int b ) const;
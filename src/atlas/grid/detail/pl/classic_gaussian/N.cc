@@ -11,7 +11,11 @@
 /// @author Willem Deconinck
 /// @date Mar 2016
 
-#include "N.h"
+#include "atlas/grid/detail/pl/classic_gaussian/N.h"
+
+#include <cstdint>
+
+#include "eckit/exception/Exceptions.h"
 
 namespace atlas {
 namespace grid {
@@ -19,59 +23,224 @@ namespace detail {
 namespace pl {
 namespace classic_gaussian {
 
-std::string PointsPerLatitude::className() {
-    return "atlas.grid.reduced.pl.classic_gaussian.PointsPerLatitude";
-}
+namespace {
 
-void PointsPerLatitude::assign( long nlon[], const size_t size ) const {
-    ASSERT( size >= nlon_.size() );
-    for ( size_t jlat = 0; jlat < nlon_.size(); ++jlat )
-        nlon[jlat] = nlon_[jlat];
-}
+// Points per latitude from the North pole to the equator, which never decrease, as runs of latitudes with the same
+// number of points: pairs ( points per latitude, number of latitudes ), for each tabulated N in turn
+const uint16_t runs[] = {
+    // N16 (TL31)
+    20, 1, 27, 1, 32, 1, 40, 1, 45, 1, 48, 1, 60, 2, 64, 8,
+    // N24 (TL47)
+    20, 1, 25, 1, 36, 1, 40, 1, 45, 1, 48, 1, 54, 1, 60, 1, 64, 1, 72, 1, 80, 2, 90, 2, 96, 10,
+    // N32 (TL63)
+    20, 1, 27, 1, 36, 1, 40, 1, 45, 1, 50, 1, 60, 1, 64, 1, 72, 1, 75, 1, 80, 1, 90, 2, 96, 1, 100, 1, 108, 2, 120, 3,
+    128, 12,
+    // N48 (TL95)
+    20, 1, 25, 1, 36, 1, 40, 1, 45, 1, 50, 1, 60, 2, 72, 1, 75, 1, 80, 1, 90, 1, 96, 1, 100, 1, 108, 1, 120, 3, 128, 1,
+    135, 1, 144, 2, 160, 5, 180, 5, 192, 16,
+    // N64 (TL127)
+    20, 1, 25, 1, 36, 1, 40, 1, 45, 1, 54, 1, 60, 1, 64, 1, 72, 1, 75, 1, 80, 1, 90, 1, 96, 1, 100, 1, 108, 1, 120, 2,
+    125, 1, 135, 2, 144, 1, 150, 1, 160, 2, 180, 4, 192, 2, 200, 2, 216, 4, 225, 3, 240, 4, 243, 1, 250, 4, 256, 16,
+    // N80 (TL159)
+    18, 1, 25, 1, 36, 1, 40, 1, 45, 1, 54, 1, 60, 1, 64, 1, 72, 2, 80, 1, 90, 1, 96, 1, 100, 1, 108, 1, 120, 2, 128, 1,
+    135, 1, 144, 2, 150, 1, 160, 2, 180, 3, 192, 2, 200, 2, 216, 3, 225, 2, 240, 3, 256, 4, 288, 9, 300, 4, 320, 24,
+    // N96 (TL191)
+    18, 1, 25, 1, 36, 1, 40, 1, 45, 1, 50, 1, 60, 1, 64, 1, 72, 2, 80, 1, 90, 1, 96, 1, 100, 1, 108, 1, 120, 2, 125, 1,
+    135, 1, 144, 2, 150, 1, 160, 2, 180, 3, 192, 2, 200, 2, 216, 2, 225, 2, 240, 3, 250, 2, 256, 1, 270, 3, 288, 4,
+    300, 3, 320, 5, 324, 1, 360, 11, 375, 7, 384, 21,
+    // N128 (TL255)
+    18, 1, 25, 1, 36, 1, 40, 1, 45, 1, 50, 1, 60, 1, 64, 1, 72, 2, 80, 1, 90, 2, 100, 1, 108, 1, 120, 2, 125, 1, 128, 1,
+    144, 2, 150, 1, 160, 2, 180, 3, 192, 2, 200, 1, 216, 3, 225, 1, 240, 3, 250, 2, 256, 1, 270, 2, 288, 3, 300, 2,
+    320, 4, 324, 1, 360, 7, 375, 4, 384, 2, 400, 4, 405, 1, 432, 7, 450, 5, 480, 10, 486, 3, 500, 7, 512, 26,
+    // N160 (TL319)
+    18, 1, 25, 1, 36, 1, 40, 1, 45, 1, 50, 1, 60, 1, 64, 1, 72, 2, 80, 1, 90, 2, 96, 1, 108, 1, 120, 2, 125, 1, 128, 1,
+    135, 1, 144, 1, 150, 1, 160, 2, 180, 3, 192, 2, 200, 1, 216, 2, 225, 2, 240, 2, 243, 1, 250, 1, 256, 1, 270, 2,
+    288, 3, 300, 2, 320, 4, 324, 1, 360, 6, 375, 3, 384, 2, 400, 3, 405, 1, 432, 5, 450, 4, 480, 7, 500, 5, 512, 2,
+    540, 8, 576, 10, 600, 9, 640, 44,
+    // N200 (TL399)
+    18, 1, 25, 1, 36, 1, 40, 1, 45, 1, 50, 1, 60, 1, 64, 1, 72, 2, 75, 1, 81, 1, 90, 1, 96, 1, 100, 1, 108, 1, 120, 1,
+    125, 1, 128, 1, 135, 1, 144, 1, 150, 1, 160, 2, 180, 3, 192, 2, 200, 1, 216, 2, 225, 2, 240, 2, 243, 1, 250, 1,
+    256, 1, 270, 2, 288, 3, 300, 2, 320, 4, 360, 6, 375, 3, 384, 1, 400, 4, 432, 5, 450, 3, 480, 6, 486, 1, 500, 3,
+    512, 3, 540, 5, 576, 8, 600, 5, 640, 10, 648, 2, 675, 7, 720, 14, 729, 3, 750, 8, 768, 8, 800, 45,
+    // N256 (TL511)
+    18, 1, 25, 1, 32, 1, 40, 1, 45, 1, 50, 1, 60, 1, 64, 1, 72, 2, 75, 1, 81, 1, 90, 1, 96, 1, 100, 1, 108, 1, 120, 2,
+    125, 1, 135, 1, 144, 1, 150, 1, 160, 2, 180, 3, 192, 2, 200, 1, 216, 3, 225, 1, 240, 2, 243, 1, 250, 1, 256, 1,
+    270, 2, 288, 3, 300, 2, 320, 3, 324, 1, 360, 6, 375, 2, 384, 2, 400, 3, 432, 5, 450, 3, 480, 5, 486, 1, 500, 3,
+    512, 2, 540, 5, 576, 6, 600, 5, 640, 8, 648, 1, 675, 6, 720, 9, 729, 2, 750, 5, 768, 4, 800, 8, 810, 2, 864, 14,
+    900, 11, 960, 22, 972, 5, 1000, 16, 1024, 45,
+    // N320 (TL639)
+    18, 1, 25, 1, 36, 1, 40, 1, 45, 1, 50, 1, 60, 1, 64, 1, 72, 2, 75, 1, 81, 1, 90, 1, 96, 1, 100, 1, 108, 1, 120, 2,
+    125, 1, 135, 1, 144, 2, 150, 1, 160, 1, 180, 3, 192, 2, 200, 1, 216, 3, 225, 1, 240, 3, 250, 1, 256, 1, 270, 2,
+    288, 3, 300, 2, 320, 3, 324, 1, 360, 6, 375, 2, 384, 2, 400, 2, 405, 1, 432, 4, 450, 3, 480, 5, 486, 1, 500, 3,
+    512, 2, 540, 5, 576, 6, 600, 4, 640, 7, 648, 2, 675, 4, 720, 9, 729, 1, 750, 4, 768, 4, 800, 6, 810, 2, 864, 11,
+    900, 8, 960, 14, 972, 2, 1000, 8, 1024, 6, 1080, 14, 1125, 14, 1152, 9, 1200, 18, 1215, 7, 1280, 74,
+    // N400 (TL799)
+    18, 1, 25, 1, 32, 1, 40, 1, 45, 1, 50, 1, 60, 2, 72, 2, 75, 1, 81, 1, 90, 1, 96, 1, 100, 1, 108, 1, 120, 2, 125, 1,
+    128, 1, 144, 2, 150, 1, 160, 2, 180, 2, 192, 2, 200, 2, 216, 2, 225, 1, 240, 3, 250, 2, 256, 1, 270, 1, 288, 3,
+    300, 2, 320, 3, 324, 1, 360, 6, 375, 2, 384, 1, 400, 3, 405, 1, 432, 4, 450, 3, 480, 5, 486, 1, 500, 2, 512, 2,
+    540, 5, 576, 6, 600, 4, 640, 7, 648, 1, 675, 5, 720, 7, 729, 2, 750, 4, 768, 3, 800, 6, 810, 1, 864, 10, 900, 7,
+    960, 12, 972, 2, 1000, 6, 1024, 5, 1080, 11, 1125, 9, 1152, 6, 1200, 11, 1215, 4, 1280, 16, 1296, 4, 1350, 15,
+    1440, 28, 1458, 7, 1500, 17, 1536, 16, 1600, 83,
+    // N512 (TL1023)
+    18, 1, 25, 1, 32, 1, 40, 1, 45, 1, 50, 1, 60, 2, 72, 2, 75, 1, 81, 1, 90, 1, 96, 2, 100, 1, 108, 1, 120, 1, 125, 1,
+    128, 1, 135, 1, 144, 1, 150, 1, 160, 2, 180, 3, 192, 2, 200, 1, 216, 2, 225, 2, 240, 2, 243, 1, 250, 1, 256, 1,
+    270, 2, 288, 3, 300, 1, 320, 4, 360, 6, 375, 2, 384, 2, 400, 3, 432, 4, 450, 3, 480, 5, 486, 1, 500, 2, 512, 2,
+    540, 5, 576, 6, 600, 3, 640, 7, 648, 1, 675, 5, 720, 7, 729, 2, 750, 3, 768, 3, 800, 6, 810, 1, 864, 10, 900, 6,
+    960, 11, 972, 2, 1000, 5, 1024, 4, 1080, 10, 1125, 9, 1152, 5, 1200, 9, 1215, 3, 1280, 13, 1296, 3, 1350, 11,
+    1440, 19, 1458, 4, 1500, 10, 1536, 8, 1600, 16, 1620, 4, 1728, 30, 1800, 22, 1875, 26, 1920, 18, 1944, 11, 2000, 32,
+    2025, 18, 2048, 64,
+    // N576 (TL1151)
+    18, 1, 25, 1, 32, 1, 40, 1, 45, 1, 50, 1, 60, 2, 72, 2, 75, 1, 81, 1, 90, 1, 96, 2, 100, 1, 108, 1, 120, 2, 125, 1,
+    135, 1, 144, 1, 150, 1, 160, 2, 180, 3, 192, 2, 200, 1, 216, 2, 225, 2, 240, 2, 243, 1, 250, 1, 256, 1, 270, 2,
+    288, 3, 300, 2, 320, 3, 360, 6, 375, 2, 384, 2, 400, 3, 432, 4, 450, 3, 480, 5, 486, 1, 500, 2, 512, 2, 540, 5,
+    576, 5, 600, 4, 640, 7, 648, 1, 675, 5, 720, 7, 729, 1, 750, 4, 768, 3, 800, 5, 810, 2, 864, 9, 900, 6, 960, 10,
+    972, 3, 1000, 5, 1024, 4, 1080, 9, 1125, 8, 1152, 5, 1200, 9, 1215, 3, 1280, 12, 1296, 3, 1350, 10, 1440, 18,
+    1458, 4, 1500, 8, 1536, 8, 1600, 14, 1620, 4, 1728, 25, 1800, 17, 1875, 19, 1920, 13, 1944, 7, 2000, 17, 2025, 8,
+    2048, 7, 2160, 43, 2187, 12, 2250, 36, 2304, 91,
+    // N640 (TL1279)
+    18, 1, 25, 1, 32, 1, 40, 1, 45, 1, 50, 1, 60, 2, 72, 2, 75, 1, 81, 1, 90, 2, 96, 1, 100, 1, 108, 1, 120, 2, 125, 1,
+    135, 1, 144, 1, 150, 1, 160, 2, 180, 3, 192, 2, 200, 1, 216, 3, 225, 1, 240, 2, 243, 1, 250, 1, 256, 1, 270, 2,
+    288, 3, 300, 2, 320, 3, 360, 6, 375, 2, 384, 2, 400, 3, 432, 4, 450, 3, 480, 5, 486, 1, 500, 2, 512, 2, 540, 5,
+    576, 5, 600, 4, 640, 7, 648, 1, 675, 4, 720, 8, 729, 1, 750, 4, 768, 3, 800, 5, 810, 2, 864, 8, 900, 6, 960, 11,
+    972, 2, 1000, 5, 1024, 4, 1080, 9, 1125, 8, 1152, 5, 1200, 8, 1215, 3, 1280, 12, 1296, 2, 1350, 10, 1440, 17,
+    1458, 4, 1500, 8, 1536, 7, 1600, 13, 1620, 3, 1728, 23, 1800, 15, 1875, 17, 1920, 11, 1944, 5, 2000, 14, 2025, 6,
+    2048, 7, 2160, 30, 2187, 8, 2250, 20, 2304, 18, 2400, 37, 2430, 14, 2500, 41, 2560, 100,
+    // N800 (TL1599)
+    18, 1, 25, 1, 32, 1, 40, 1, 45, 1, 50, 1, 60, 2, 72, 2, 75, 1, 80, 1, 90, 2, 96, 1, 100, 1, 108, 1, 120, 2, 125, 1,
+    128, 1, 135, 1, 144, 1, 150, 1, 160, 2, 180, 2, 192, 2, 200, 2, 216, 2, 225, 1, 240, 3, 250, 2, 256, 1, 270, 1,
+    288, 3, 300, 2, 320, 3, 324, 1, 360, 5, 375, 3, 384, 1, 400, 3, 405, 1, 432, 4, 450, 3, 480, 4, 486, 1, 500, 3,
+    512, 2, 540, 4, 576, 6, 600, 3, 625, 5, 640, 2, 648, 1, 675, 4, 720, 8, 729, 1, 750, 3, 768, 3, 800, 6, 810, 1,
+    864, 9, 900, 6, 960, 10, 972, 2, 1000, 5, 1024, 4, 1080, 9, 1125, 7, 1152, 5, 1200, 8, 1215, 2, 1250, 6, 1280, 6,
+    1296, 2, 1350, 10, 1440, 15, 1458, 3, 1500, 8, 1536, 6, 1600, 12, 1620, 4, 1728, 19, 1800, 14, 1875, 14, 1920, 9,
+    1944, 5, 2000, 11, 2025, 5, 2048, 5, 2160, 23, 2187, 6, 2250, 14, 2304, 12, 2400, 22, 2430, 7, 2500, 18, 2560, 15,
+    2592, 8, 2700, 30, 2880, 58, 2916, 13, 3000, 34, 3072, 35, 3125, 33, 3200, 123,
+    // N1024 (TL2047)
+    18, 1, 25, 1, 32, 1, 40, 1, 45, 1, 50, 1, 60, 1, 64, 1, 72, 2, 75, 1, 81, 1, 90, 1, 96, 2, 108, 2, 120, 2, 125, 2,
+    135, 1, 144, 1, 150, 1, 160, 2, 180, 3, 192, 2, 200, 1, 216, 2, 225, 2, 240, 2, 243, 1, 250, 1, 256, 1, 270, 2,
+    288, 3, 300, 2, 320, 3, 360, 6, 375, 2, 384, 2, 400, 2, 405, 1, 432, 4, 450, 3, 480, 5, 486, 1, 500, 2, 512, 2,
+    540, 4, 576, 6, 600, 4, 625, 4, 640, 2, 648, 1, 675, 5, 720, 7, 729, 1, 750, 4, 768, 2, 800, 6, 810, 1, 864, 9,
+    900, 6, 960, 9, 972, 2, 1000, 5, 1024, 4, 1080, 9, 1125, 7, 1152, 5, 1200, 7, 1215, 3, 1250, 6, 1280, 5, 1296, 2,
+    1350, 9, 1440, 15, 1458, 3, 1500, 8, 1536, 6, 1600, 11, 1620, 3, 1728, 19, 1800, 12, 1875, 13, 1920, 8, 1944, 5,
+    2000, 10, 2025, 4, 2048, 5, 2160, 20, 2187, 5, 2250, 12, 2304, 10, 2400, 19, 2430, 5, 2500, 15, 2560, 12, 2592, 6,
+    2700, 22, 2880, 39, 2916, 8, 3000, 19, 3072, 17, 3125, 13, 3200, 18, 3240, 10, 3375, 36, 3456, 23, 3600, 44,
+    3645, 15, 3750, 39, 3840, 37, 3888, 22, 4000, 65, 4050, 39, 4096, 116,
+    // N1280 (TL2559)
+    18, 1, 25, 1, 32, 1, 40, 1, 45, 1, 50, 1, 60, 1, 64, 1, 72, 2, 75, 1, 81, 1, 90, 1, 96, 2, 108, 2, 120, 3, 125, 1,
+    135, 2, 144, 2, 160, 2, 180, 3, 192, 1, 200, 2, 216, 2, 225, 1, 240, 3, 250, 2, 256, 1, 270, 1, 288, 3, 300, 2,
+    320, 3, 324, 1, 360, 5, 375, 3, 384, 1, 400, 3, 432, 5, 450, 2, 480, 5, 486, 1, 500, 2, 512, 2, 540, 5, 576, 5,
+    600, 4, 625, 4, 640, 3, 648, 1, 675, 4, 720, 7, 729, 2, 750, 3, 768, 3, 800, 5, 810, 1, 864, 9, 900, 6, 960, 9,
+    972, 2, 1000, 5, 1024, 4, 1080, 9, 1125, 7, 1152, 4, 1200, 8, 1215, 2, 1250, 6, 1280, 5, 1296, 3, 1350, 8, 1440, 15,
+    1458, 3, 1500, 7, 1536, 6, 1600, 11, 1620, 3, 1728, 18, 1800, 12, 1875, 13, 1920, 7, 1944, 4, 2000, 10, 2025, 4,
+    2048, 4, 2160, 20, 2187, 4, 2250, 11, 2304, 10, 2400, 17, 2430, 5, 2500, 13, 2560, 11, 2592, 6, 2700, 20, 2880, 34,
+    2916, 6, 3000, 17, 3072, 14, 3125, 10, 3200, 16, 3240, 7, 3375, 28, 3456, 18, 3600, 31, 3645, 10, 3750, 24,
+    3840, 21, 3888, 11, 4000, 29, 4050, 12, 4096, 12, 4320, 62, 4374, 16, 4500, 39, 4608, 37, 4800, 77, 4860, 28,
+    5000, 82, 5120, 190,
+    // N1600 (TL3199)
+    18, 1, 25, 1, 32, 1, 40, 1, 45, 1, 50, 1, 54, 1, 60, 1, 72, 2, 75, 1, 80, 1, 90, 2, 96, 1, 100, 1, 108, 1, 120, 3,
+    125, 1, 128, 1, 135, 1, 144, 2, 150, 1, 160, 2, 162, 1, 180, 3, 192, 2, 216, 2, 225, 1, 240, 2, 243, 1, 250, 1,
+    256, 1, 270, 2, 288, 3, 300, 2, 320, 3, 360, 6, 375, 2, 384, 2, 400, 2, 405, 1, 432, 4, 450, 3, 480, 5, 486, 1,
+    500, 2, 512, 2, 540, 4, 576, 6, 600, 4, 625, 4, 640, 2, 648, 1, 675, 4, 720, 7, 729, 2, 750, 3, 768, 3, 800, 5,
+    810, 2, 864, 8, 900, 6, 960, 10, 972, 1, 1000, 5, 1024, 4, 1080, 9, 1125, 7, 1152, 4, 1200, 8, 1215, 2, 1250, 6,
+    1280, 5, 1296, 2, 1350, 9, 1440, 15, 1458, 3, 1500, 6, 1536, 6, 1600, 11, 1620, 3, 1728, 18, 1800, 11, 1875, 13,
+    1920, 7, 1944, 4, 2000, 10, 2025, 4, 2048, 4, 2160, 18, 2187, 5, 2250, 10, 2304, 9, 2400, 17, 2430, 5, 2500, 12,
+    2560, 10, 2592, 6, 2700, 18, 2880, 32, 2916, 6, 3000, 15, 3072, 13, 3125, 10, 3200, 14, 3240, 7, 3375, 25, 3456, 15,
+    3600, 27, 3645, 9, 3750, 20, 3840, 18, 3888, 9, 4000, 23, 4050, 10, 4096, 10, 4320, 46, 4374, 12, 4500, 27,
+    4608, 25, 4800, 44, 4860, 15, 5000, 35, 5120, 31, 5184, 16, 5400, 61, 5625, 70, 5760, 46, 5832, 27, 6000, 69,
+    6075, 35, 6144, 36, 6250, 67, 6400, 235,
+    // N2000 (TL3999)
+    18, 1, 25, 1, 32, 1, 40, 1, 45, 1, 50, 1, 60, 2, 72, 2, 75, 1, 81, 1, 90, 1, 96, 2, 108, 2, 120, 3, 125, 1, 135, 2,
+    144, 2, 150, 1, 160, 2, 180, 4, 192, 3, 200, 1, 216, 3, 225, 1, 240, 2, 243, 1, 250, 1, 256, 1, 270, 2, 288, 1,
+    300, 2, 320, 3, 360, 6, 375, 2, 384, 1, 400, 3, 405, 1, 432, 4, 450, 3, 480, 4, 486, 1, 500, 3, 512, 2, 540, 4,
+    576, 5, 600, 4, 625, 4, 640, 3, 648, 1, 675, 4, 720, 7, 729, 1, 750, 4, 768, 3, 800, 5, 810, 1, 864, 9, 900, 6,
+    960, 9, 972, 2, 1000, 5, 1024, 3, 1080, 9, 1125, 7, 1152, 5, 1200, 7, 1215, 3, 1250, 5, 1280, 5, 1296, 3, 1350, 8,
+    1440, 15, 1458, 2, 1500, 7, 1536, 6, 1600, 11, 1620, 3, 1728, 17, 1800, 12, 1875, 12, 1920, 7, 1944, 4, 2000, 9,
+    2025, 4, 2048, 4, 2160, 18, 2187, 5, 2250, 10, 2304, 9, 2400, 16, 2430, 5, 2500, 12, 2560, 10, 2592, 5, 2700, 18,
+    2880, 30, 2916, 6, 3000, 15, 3072, 12, 3125, 9, 3200, 13, 3240, 7, 3375, 23, 3456, 15, 3600, 25, 3645, 8, 3750, 19,
+    3840, 16, 3888, 9, 4000, 20, 4050, 9, 4096, 9, 4320, 41, 4374, 10, 4500, 24, 4608, 21, 4800, 38, 4860, 12, 5000, 28,
+    5120, 24, 5184, 13, 5400, 46, 5625, 49, 5760, 31, 5832, 16, 6000, 39, 6075, 19, 6144, 16, 6250, 27, 6400, 39,
+    6480, 21, 6561, 22, 6750, 54, 6912, 49, 7200, 96, 7290, 33, 7500, 87, 7680, 89, 7776, 58, 8000, 317,
+    // N4000 (TL7999)
+    18, 1, 24, 1, 32, 1, 40, 1, 45, 1, 48, 1, 54, 1, 60, 1, 64, 1, 72, 1, 75, 1, 80, 1, 90, 2, 96, 1, 100, 1, 108, 2,
+    120, 2, 125, 1, 128, 1, 135, 2, 144, 1, 150, 2, 160, 2, 180, 4, 192, 3, 200, 1, 216, 4, 225, 2, 240, 3, 243, 1,
+    250, 1, 256, 2, 270, 3, 288, 4, 300, 3, 320, 4, 324, 1, 360, 8, 375, 4, 384, 2, 400, 3, 405, 2, 432, 6, 450, 4,
+    480, 6, 486, 2, 500, 3, 512, 3, 540, 6, 576, 8, 600, 6, 625, 6, 640, 3, 648, 2, 675, 6, 720, 11, 729, 2, 750, 5,
+    768, 4, 800, 7, 810, 2, 864, 13, 900, 8, 960, 14, 972, 3, 1000, 7, 1024, 5, 1080, 13, 1125, 11, 1152, 6, 1200, 11,
+    1215, 4, 1250, 8, 1280, 7, 1296, 4, 1350, 13, 1440, 21, 1458, 4, 1500, 10, 1536, 9, 1600, 15, 1620, 4, 1728, 26,
+    1800, 17, 1875, 18, 1920, 11, 1944, 5, 2000, 14, 2025, 6, 2048, 5, 2160, 27, 2187, 7, 2250, 15, 2304, 13, 2400, 22,
+    2430, 3, 2500, 8, 2560, 7, 2592, 3, 2700, 13, 2880, 22, 2916, 4, 3000, 10, 3072, 9, 3125, 7, 3200, 10, 3240, 4,
+    3375, 18, 3456, 10, 3600, 19, 3645, 6, 3750, 15, 3840, 13, 3888, 6, 4000, 16, 4050, 6, 4096, 7, 4320, 31, 4374, 8,
+    4500, 18, 4608, 16, 4800, 28, 4860, 9, 5000, 21, 5120, 18, 5184, 9, 5400, 33, 5625, 35, 5760, 20, 5832, 12,
+    6000, 26, 6075, 13, 6144, 10, 6250, 18, 6400, 23, 6480, 13, 6561, 14, 6750, 30, 6912, 28, 7200, 47, 7290, 16,
+    7500, 35, 7680, 32, 7776, 15, 8000, 40, 8100, 17, 8192, 17, 8640, 80, 8748, 20, 9000, 45, 9216, 41, 9375, 30,
+    9600, 44, 9720, 21, 10000, 56, 10125, 25, 10240, 24, 10368, 26, 10800, 86, 10935, 29, 11250, 69, 11520, 61,
+    11664, 33, 12000, 74, 12150, 36, 12288, 33, 12500, 53, 12800, 78, 12960, 42, 13122, 44, 13500, 108, 13824, 92,
+    14400, 192, 14580, 67, 15000, 174, 15360, 180, 15552, 117, 15625, 52, 16000, 548,
+    // N8000 (TL15999)
+    16, 1, 24, 1, 30, 1, 36, 1, 40, 1, 45, 1, 54, 1, 60, 1, 64, 1, 72, 2, 75, 1, 81, 1, 90, 2, 96, 1, 100, 1, 108, 1,
+    120, 3, 125, 1, 128, 1, 135, 1, 144, 2, 150, 1, 160, 3, 180, 4, 192, 3, 200, 1, 216, 4, 225, 2, 240, 3, 243, 1,
+    250, 2, 256, 1, 270, 3, 288, 4, 300, 3, 320, 4, 324, 1, 360, 8, 375, 4, 384, 2, 400, 3, 405, 2, 432, 6, 450, 4,
+    480, 7, 486, 1, 500, 3, 512, 3, 540, 7, 576, 8, 600, 5, 625, 6, 640, 4, 648, 1, 675, 7, 720, 10, 729, 2, 750, 5,
+    768, 4, 800, 8, 810, 2, 864, 13, 900, 8, 960, 14, 972, 3, 1000, 6, 1024, 6, 1080, 13, 1125, 11, 1152, 6, 1200, 11,
+    1215, 4, 1250, 8, 1280, 7, 1296, 3, 1350, 13, 1440, 21, 1458, 4, 1500, 10, 1536, 9, 1600, 15, 1620, 4, 1728, 26,
+    1800, 17, 1875, 18, 1920, 10, 1944, 6, 2000, 13, 2025, 6, 2048, 5, 2160, 27, 2187, 6, 2250, 15, 2304, 13, 2400, 23,
+    2430, 7, 2500, 16, 2560, 14, 2592, 8, 2700, 26, 2880, 43, 2916, 8, 3000, 20, 3072, 17, 3125, 13, 3200, 18, 3240, 9,
+    3375, 33, 3456, 19, 3600, 34, 3645, 11, 3750, 25, 3840, 22, 3888, 12, 4000, 26, 4050, 12, 4096, 12, 4320, 54,
+    4374, 13, 4500, 30, 4608, 26, 4800, 25, 4860, 6, 5000, 17, 5120, 13, 5184, 7, 5400, 25, 5625, 27, 5760, 16, 5832, 9,
+    6000, 21, 6075, 9, 6144, 8, 6250, 14, 6400, 19, 6480, 11, 6561, 9, 6750, 25, 6912, 21, 7200, 38, 7290, 12, 7500, 29,
+    7680, 25, 7776, 12, 8000, 32, 8100, 14, 8192, 12, 8640, 64, 8748, 16, 9000, 35, 9216, 31, 9375, 24, 9600, 32,
+    9720, 18, 10000, 42, 10125, 19, 10240, 18, 10368, 19, 10800, 65, 10935, 21, 11250, 49, 11520, 41, 11664, 24,
+    12000, 52, 12150, 25, 12288, 21, 12500, 34, 12800, 48, 12960, 25, 13122, 27, 13500, 63, 13824, 53, 14400, 96,
+    14580, 31, 15000, 70, 15360, 63, 15552, 32, 15625, 13, 16000, 65, 16200, 36, 16384, 33, 16875, 87, 17280, 72,
+    17496, 41, 18000, 92, 18225, 42, 18432, 37, 18750, 61, 19200, 85, 19440, 47, 19683, 48, 20000, 61, 20250, 50,
+    20480, 47, 20736, 52, 21600, 178, 21870, 58, 22500, 134, 23040, 121, 23328, 65, 24000, 153, 24300, 73, 24576, 67,
+    25000, 104, 25600, 152, 25920, 84, 26244, 89, 27000, 210, 27648, 195, 28125, 154, 28800, 234, 29160, 134,
+    30000, 339, 30375, 178, 30720, 183, 31104, 235, 31250, 103, 32000, 1094,
+};
+
+// Tabulated N, and position of its first run in runs[], followed by the end of runs[]
+struct Table {
+    uint16_t N;
+    uint16_t begin;
+};
+const Table tables[] = {
+    {16, 0}, {24, 16}, {32, 42}, {48, 76}, {64, 118}, {80, 178}, {96, 238}, {128, 310}, {160, 396}, {200, 492},
+    {256, 604}, {320, 730}, {400, 868}, {512, 1018}, {576, 1186}, {640, 1360}, {800, 1542}, {1024, 1748}, {1280, 1974},
+    {1600, 2212}, {2000, 2478}, {4000, 2758}, {8000, 3116}, {0, 3552},
+};
+const size_t nb_tables = sizeof( tables ) / sizeof( Table ) - 1;
 
-void PointsPerLatitude::assign( int nlon[], const size_t size ) const {
-    ASSERT( size >= nlon_.size() );
-    for ( size_t jlat = 0; jlat < nlon_.size(); ++jlat )
-        nlon[jlat] = nlon_[jlat];
+const Table* find( const size_t N ) {
+    for ( size_t t = 0; t < nb_tables; ++t ) {
+        if ( tables[t].N == N ) { return tables + t; }
+    }
+    return nullptr;
 }
 
-void PointsPerLatitude::assign( std::vector<long>& nlon ) const {
-    nlon = nlon_;
+template <typename Int>
+void decode( const size_t N, Int nlon[] ) {
+    const Table* table = find( N );
+    ASSERT( table );
+    size_t jlat = 0;
+    for ( size_t r = table[0].begin; r < table[1].begin; r += 2 ) {
+        for ( uint16_t j = 0; j < runs[r + 1]; ++j ) {
+            nlon[jlat++] = runs[r];
+        }
+    }
+    ASSERT( jlat == N );
 }
 
-void PointsPerLatitude::assign( std::vector<int>& nlon ) const {
-    nlon.assign( nlon_.begin(), nlon_.end() );
+}  // namespace
+
+bool tabulated_points_per_latitude( const size_t N ) {
+    return find( N ) != nullptr;
 }
 
-template <typename CONCRETE>
-void load() {
-    eckit::ConcreteBuilderT0<PointsPerLatitude, CONCRETE> builder( "tmp" );
+void tabulated_points_per_latitude( const size_t N, long nlon[] ) {
+    decode( N, nlon );
 }
 
-void regist() {
-    load<N16>();
-    load<N24>();
-    load<N32>();
-    load<N48>();
-    load<N64>();
-    load<N80>();
-    load<N96>();
-    load<N128>();
-    load<N160>();
-    load<N200>();
-    load<N256>();
-    load<N320>();
-    load<N400>();
-    load<N512>();
-    load<N576>();
-    load<N640>();
-    load<N800>();
-    load<N1024>();
-    load<N1280>();
-    load<N1600>();
-    load<N2000>();
-    load<N4000>();
-    load<N8000>();
+void tabulated_points_per_latitude( const size_t N, int nlon[] ) {
+    decode( N, nlon );
 }
 
 }  // namespace classic_gaussian
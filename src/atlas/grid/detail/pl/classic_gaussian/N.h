@@ -13,8 +13,7 @@
 
 #pragma once
 
-#include "eckit/memory/Builder.h"
-#include "eckit/memory/Owned.h"
+#include <cstddef>
 
 namespace atlas {
 namespace grid {
@@ -22,73 +21,18 @@ namespace detail {
 namespace pl {
 namespace classic_gaussian {
 
-class PointsPerLatitude : public eckit::Owned {
-public:
-    typedef eckit::BuilderT0<PointsPerLatitude> builder_t;
+/// Points per latitude of the classic reduced Gaussian grids are tabulated for N = 16, 24, 32, 48, 64, 80, 96, 128,
+/// 160, 200, 256, 320, 400, 512, 576, 640, 800, 1024, 1280, 1600, 2000, 4000 and 8000. The tables are stored in
+/// compact form, and decoded on request, so that they need neither static initialisation nor relocations.
 
-    static std::string className();
+/// @return true if the points per latitude are tabulated for N
+bool tabulated_points_per_latitude( const size_t N );
 
-    /// @pre nlats has enough allocated memory to store the latitudes
-    /// @param size of lats vector
-    void assign( long nlon[], const size_t size ) const;
-
-    /// @pre nlats has enough allocated memory to store the latitudes
-    /// @param size of lats vector
-    void assign( int nlon[], const size_t size ) const;
-
-    /// @post resizes the vector to the number of latitutes
-    void assign( std::vector<long>& nlon ) const;
-
-    /// @post resizes the vector to the number of latitutes
-    void assign( std::vector<int>& nlon ) const;
-
-    size_t N() const { return nlon_.size(); }
-
-protected:
-    std::vector<long> nlon_;
-};
-
-#define DECLARE_POINTS_PER_LATITUDE( NUMBER )    \
-    class N##NUMBER : public PointsPerLatitude { \
-    public:                                      \
-        N##NUMBER();                             \
-    };
-
-#define LIST( ... ) __VA_ARGS__
-#define DEFINE_POINTS_PER_LATITUDE( NUMBER, NLON )                                       \
-    eckit::ConcreteBuilderT0<PointsPerLatitude, N##NUMBER> builder_N##NUMBER( #NUMBER ); \
-                                                                                         \
-    N##NUMBER::N##NUMBER() {                                                             \
-        size_t N    = NUMBER;                                                            \
-        long nlon[] = {NLON};                                                            \
-        nlon_.assign( nlon, nlon + N );                                                  \
-    }
-
-DECLARE_POINTS_PER_LATITUDE( 16 );
-DECLARE_POINTS_PER_LATITUDE( 24 );
-DECLARE_POINTS_PER_LATITUDE( 32 );
-DECLARE_POINTS_PER_LATITUDE( 48 );
-DECLARE_POINTS_PER_LATITUDE( 64 );
-DECLARE_POINTS_PER_LATITUDE( 80 );
-DECLARE_POINTS_PER_LATITUDE( 96 );
-DECLARE_POINTS_PER_LATITUDE( 128 );
-DECLARE_POINTS_PER_LATITUDE( 160 );
-DECLARE_POINTS_PER_LATITUDE( 200 );
-DECLARE_POINTS_PER_LATITUDE( 256 );
-DECLARE_POINTS_PER_LATITUDE( 320 );
-DECLARE_POINTS_PER_LATITUDE( 400 );
-DECLARE_POINTS_PER_LATITUDE( 512 );
-DECLARE_POINTS_PER_LATITUDE( 576 );
-DECLARE_POINTS_PER_LATITUDE( 640 );
-DECLARE_POINTS_PER_LATITUDE( 800 );
-DECLARE_POINTS_PER_LATITUDE( 1024 );
-DECLARE_POINTS_PER_LATITUDE( 1280 );
-DECLARE_POINTS_PER_LATITUDE( 1600 );
-DECLARE_POINTS_PER_LATITUDE( 2000 );
-DECLARE_POINTS_PER_LATITUDE( 4000 );
-DECLARE_POINTS_PER_LATITUDE( 8000 );
-
-#undef DECLARE_POINTS_PER_LATITUDE
+/// @brief Tabulated points per latitude between North pole and equator
+/// @pre tabulated_points_per_latitude( N )
+/// @param nlon [out] points per latitude, of size N
+void tabulated_points_per_latitude( const size_t N, long nlon[] );
+void tabulated_points_per_latitude( const size_t N, int nlon[] );
 
 }  // namespace classic_gaussian
 }  // namespace pl
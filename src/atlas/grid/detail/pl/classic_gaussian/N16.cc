@@ -1,17 +0,0 @@
-// TL31
-
-#include "N.h"
-
-namespace atlas {
-namespace grid {
-namespace detail {
-namespace pl {
-namespace classic_gaussian {
-
-DEFINE_POINTS_PER_LATITUDE( 16, LIST( 20, 27, 32, 40, 45, 48, 60, 60, 64, 64, 64, 64, 64, 64, 64, 64 ) )
-
-}  // namespace classic_gaussian
-}  // namespace pl
-}  // namespace detail
-}  // namespace grid
-}  // namespace atlas
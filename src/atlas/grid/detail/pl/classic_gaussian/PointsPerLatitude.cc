@@ -13,12 +13,12 @@
 
 #include "PointsPerLatitude.h"
 
-#include "eckit/memory/ScopedPtr.h"
+#include <sstream>
+#include <string>
 
-#include "atlas/grid/detail/pl/classic_gaussian/N.h"
+#include "eckit/exception/Exceptions.h"
 
-using eckit::Factory;
-using eckit::ScopedPtr;
+#include "atlas/grid/detail/pl/classic_gaussian/N.h"
 
 namespace atlas {
 namespace grid {
@@ -30,14 +30,11 @@ namespace classic_gaussian {
 
 template <typename Int>
 void points_per_latitude_npole_equator_impl( const size_t N, Int nlon[] ) {
-    std::stringstream Nstream;
-    Nstream << N;
-    std::string Nstr = Nstream.str();
-    if ( Factory<PointsPerLatitude>::instance().exists( Nstr ) ) {
-        ScopedPtr<PointsPerLatitude> pl( Factory<PointsPerLatitude>::instance().get( Nstr ).create() );
-        pl->assign( nlon, N );
-    }
+    if ( tabulated_points_per_latitude( N ) ) { tabulated_points_per_latitude( N, nlon ); }
     else {
+        std::stringstream Nstream;
+        Nstream << N;
+        std::string Nstr = Nstream.str();
         throw eckit::BadParameter( "gaussian::classic::PointsPerLatitude not available for N" + Nstr, Here() );
     }
 }
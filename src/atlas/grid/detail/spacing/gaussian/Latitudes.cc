@@ -11,23 +11,22 @@
 /// @author Willem Deconinck
 /// @date Jan 2014
 
+#include <cmath>
 #include <limits>
+#include <sstream>
 
-#include "eckit/memory/ScopedPtr.h"
+#include "eckit/exception/Exceptions.h"
 
 #include "atlas/array.h"
 #include "atlas/array/MakeView.h"
 #include "atlas/grid/detail/spacing/gaussian/Latitudes.h"
 #include "atlas/grid/detail/spacing/gaussian/N.h"
 #include "atlas/library/config.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/Log.h"
 #include "atlas/util/Constants.h"
 #include "atlas/util/CoordinateEnums.h"
 
-using eckit::ConcreteBuilderT0;
-using eckit::Factory;
-using eckit::ScopedPtr;
-
 using atlas::array::Array;
 using atlas::array::ArrayView;
 using atlas::array::make_view;
@@ -44,13 +43,7 @@ void compute_gaussian_quadrature_npole_equator( const size_t N, double lat[], do
 //-----------------------------------------------------------------------------
 
 void gaussian_latitudes_npole_equator( const size_t N, double lats[] ) {
-    std::stringstream Nstream;
-    Nstream << N;
-    std::string Nstr = Nstream.str();
-    if ( Factory<GaussianLatitudes>::instance().exists( Nstr ) ) {
-        ScopedPtr<GaussianLatitudes> gl( Factory<GaussianLatitudes>::instance().get( Nstr ).create() );
-        gl->assign( lats, N );
-    }
+    if ( tabulated_gaussian_latitudes( N ) ) { tabulated_gaussian_latitudes( N, lats ); }
     else {
         std::vector<double> weights( N );
         compute_gaussian_quadrature_npole_equator( N, lats, weights.data() );
@@ -227,6 +220,172 @@ void legpol_quadrature( const int kn, const double pfn[], double& pl, double& pw
 
 //-----------------------------------------------------------------------------
 
+// Zeros of the Bessel function J0, and squares of J1 at these zeros, for which the
+// asymptotic expansions in bessel_j0_zero and bessel_j1_squared are not accurate enough
+const double bessel_j0_zeros[20] = {
+    2.4048255576957729, 5.5200781102863106, 8.6537279129110107, 11.791534439014285, 14.930917708487781,
+    18.071063967910924, 21.211636629879251, 24.352471530749298, 27.49347913204025,  30.634606468431976,
+    33.775820213573553, 36.917098353664066, 40.058425764628225, 43.199791713176701, 46.341188371661794,
+    49.482609897397779, 52.62405184111504,  55.765510755019925, 58.906983926080997, 62.048469190227124};
+
+const double bessel_j1_squared_at_j0_zeros[21] = {
+    0.26951412394191687,  0.1157801385822036,   0.073686351136408285, 0.054037573198116258, 0.042661429017243124,
+    0.035242103490996081, 0.03002107010305469,  0.026147391495308092, 0.023159121824691386, 0.020783829122267859,
+    0.018850450669317686, 0.017246157569664994, 0.015893518105923599, 0.014737626096472202, 0.013738465145387119,
+    0.012866181737615147, 0.012098051548626788, 0.011416471224491624, 0.010807592791180194, 0.010260372926280776,
+    0.0097658971397910667};
+
+// k-th zero of the Bessel function J0 (k >= 1)
+double bessel_j0_zero( const int k ) {
+    if ( k <= 20 ) { return bessel_j0_zeros[k - 1]; }
+    // McMahon's expansion in powers of 1/z
+    static const double c[] = {0.125,
+                               -0.807291666666666666666666666667e-1,
+                               0.246028645833333333333333333333,
+                               -1.82443074756335449218750000000,
+                               25.3364147973439050099206349206,
+                               -567.644412135183381139802038240,
+                               18690.4765282320653831636345064,
+                               -8.49353580299148769921876983660e5,
+                               5.09225462402226769498681286758e7};
+    const double z  = M_PI * ( k - 0.25 );
+    const double r  = 1. / z;
+    const double r2 = r * r;
+    double series   = c[8];
+    for ( int j = 7; j >= 0; --j ) {
+        series = c[j] + r2 * series;
+    }
+    return z + r * series;
+}
+
+// Square of the Bessel function J1 at the k-th zero of J0 (k >= 1)
+double bessel_j1_squared( const int k ) {
+    if ( k <= 21 ) { return bessel_j1_squared_at_j0_zeros[k - 1]; }
+    // expansion in powers of 1/(k-1/4), without the terms in 1/(k-1/4)^3
+    static const double c[] = {-0.303380429711290253026202643516e-3, 0.198924364245969295201137972743e-3,
+                               -0.228969902772111653038747229723e-3, 0.433710719130746277915572905025e-3,
+                               -0.123632349727175414724737657367e-2, 0.496101423268883102872271417616e-2,
+                               -0.266837393702323757700998557826e-1, .185395398206345628711318848386};
+    const double x  = 1. / ( k - 0.25 );
+    const double x2 = x * x;
+    double series   = c[7];
+    for ( int j = 6; j >= 0; --j ) {
+        series = c[j] + x2 * series;
+    }
+    return x * ( 0.202642367284675542887758926420 + x2 * x2 * series );
+}
+
+//-----------------------------------------------------------------------------
+
+// Colatitude (radians) and quadrature weight (normalised as by legpol_weight) of the k-th zero
+// (k = 1 .. n/2, from the North pole) of the Legendre polynomial of degree n, by the asymptotic
+// expansions of Bogaert, accurate to double precision for n > 100 in O(1) operations.
+//
+// Reference:
+// I. Bogaert, Iteration-free computation of Gauss-Legendre quadrature nodes and weights,
+//      SIAM J. Sci. Comput. Vol. 36 (3) pp. A1008-A1026 (2014)
+void legpol_quadrature_asymptotic( const int n, const int k, double& colat, double& weight ) {
+    const double w     = 1. / ( n + 0.5 );
+    const double nu    = bessel_j0_zero( k );
+    const double theta = w * nu;
+    const double x     = theta * theta;
+    const double B     = bessel_j1_squared( k );
+
+    // Chebyshev interpolants of the expansion coefficients of the nodes...
+    const double SF1T = ( ( ( ( ( -1.29052996274280508473467968379e-12 * x + 2.40724685864330121825976175184e-10 ) * x -
+                                3.13148654635992041468855740012e-8 ) *
+                                  x +
+                              0.275573168962061235623801563453e-5 ) *
+                                x -
+                            0.148809523713909147898955880165e-3 ) *
+                              x +
+                          0.416666666665193394525296923981e-2 ) *
+                            x -
+                        0.416666666666662959639712457549e-1;
+    const double SF2T = ( ( ( ( ( +2.20639421781871003734786884322e-9 * x - 7.53036771373769326811030753538e-8 ) * x +
+                                0.161969259453836261731700382098e-5 ) *
+                                  x -
+                              0.253300326008232025914059965302e-4 ) *
+                                x +
+                            0.282116886057560434805998583817e-3 ) *
+                              x -
+                          0.209022248387852902722635654229e-2 ) *
+                            x +
+                        0.815972221772932265640401128517e-2;
+    const double SF3T = ( ( ( ( ( -2.97058225375526229899781956673e-8 * x + 5.55845330223796209655886325712e-7 ) * x -
+                                0.567797841356833081642185432056e-5 ) *
+                                  x +
+                              0.418498100329504574443885193835e-4 ) *
+                                x -
+                            0.251395293283965914823026348764e-3 ) *
+                              x +
+                          0.128654198542845137196151147483e-2 ) *
+                            x -
+                        0.416012165620204364833694266818e-2;
+
+    // ...and of the weights
+    const double WSF1T =
+        ( ( ( ( ( ( ( ( -2.20902861044616638398573427475e-14 * x + 2.30365726860377376873232578871e-12 ) * x -
+                      1.75257700735423807659851042318e-10 ) *
+                        x +
+                    1.03756066927916795821098009353e-8 ) *
+                      x -
+                  4.63968647553221331251529631098e-7 ) *
+                    x +
+                0.149644593625028648361395938176e-4 ) *
+                  x -
+              0.326278659594412170300449074873e-3 ) *
+                x +
+            0.436507936507598105249726413120e-2 ) *
+              x -
+          0.305555555555553028279487898503e-1 ) *
+            x +
+        0.833333333333333302184063103900e-1;
+    const double WSF2T =
+        ( ( ( ( ( ( ( +3.63117412152654783455929483029e-12 * x + 7.67643545069893130779501844323e-11 ) * x -
+                    7.12912857233642220650643150625e-9 ) *
+                      x +
+                  2.11483880685947151466370130277e-7 ) *
+                    x -
+                0.381817918680045468483009307090e-5 ) *
+                  x +
+              0.465969530694968391417927388162e-4 ) *
+                x -
+            0.407297185611335764191683161117e-3 ) *
+              x +
+          0.268959435694729660779984493795e-2 ) *
+            x -
+        0.111111111111214923138249347172e-1;
+    const double WSF3T =
+        ( ( ( ( ( ( ( +2.01826791256703301806643264922e-9 * x - 4.38647122520206649251063212545e-8 ) * x +
+                    5.08898347288671653137451093208e-7 ) *
+                      x -
+                  0.397933316519135275712977531366e-5 ) *
+                    x +
+                0.200559326396458326778521795392e-4 ) *
+                  x -
+              0.422888059282921161626339411388e-4 ) *
+                x -
+            0.105646050254076140548678457002e-3 ) *
+              x -
+          0.947969308958577323145923317955e-4 ) *
+            x +
+        0.656966489926484797412985260842e-2;
+
+    // refinement with the expansions of the paper
+    const double NuoSin   = nu / std::sin( theta );
+    const double BNuoSin  = B * NuoSin;
+    const double WInvSinc = w * w * NuoSin;
+    const double WIS2     = WInvSinc * WInvSinc;
+
+    colat = w * ( nu + theta * WInvSinc * ( SF1T + WIS2 * ( SF2T + WIS2 * SF3T ) ) );
+    const double denominator = BNuoSin + BNuoSin * WIS2 * ( WSF1T + WIS2 * ( WSF2T + WIS2 * WSF3T ) );
+    // weights of the Gauss-Legendre quadrature sum to 2, those of legpol_weight to 1
+    weight = w / denominator;
+}
+
+//-----------------------------------------------------------------------------
+
 }  //  anonymous namespace
 
 //-----------------------------------------------------------------------------
@@ -234,6 +393,18 @@ void legpol_quadrature( const int kn, const double pfn[], double& pl, double& pw
 void compute_gaussian_quadrature_npole_equator( const size_t N, double lats[], double weights[] ) {
     Log::debug() << "Atlas computing Gaussian latitudes for N " << N << "\n";
 
+    const double pole = 90.;
+    if ( 2 * N > 100 ) {
+        // O(N) asymptotic expansions, each latitude independent of the others
+        atlas_omp_parallel_for( size_t jgl = 0; jgl < N; ++jgl ) {
+            legpol_quadrature_asymptotic( 2 * N, jgl + 1, lats[jgl], weights[jgl] );
+            lats[jgl] = pole - lats[jgl] * util::Constants::radiansToDegrees();
+        }
+        return;
+    }
+
+    // Newton iterations with Legendre polynomials evaluated by their Fourier series, in O(N^2)
+
     // Compute first guess for colatitudes in radians
     double z;
     for ( size_t i = 0; i < N; ++i ) {
@@ -275,7 +446,6 @@ void compute_gaussian_quadrature_npole_equator( const size_t N, double lats[], d
         ++ik;
     }
 
-    const double pole = 90.;
     for ( size_t jgl = 0; jgl < N; ++jgl ) {
         // refine colat first guess here via Newton's method
         legpol_quadrature( kdgl, zzfn.data(), lats[jgl], weights[jgl], iter[jgl], zmod[jgl] );
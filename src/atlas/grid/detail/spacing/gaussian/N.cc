@@ -13,54 +13,1806 @@
 
 #include "atlas/grid/detail/spacing/gaussian/N.h"
 
+#include <cstdint>
+#include <cstring>
+
+#include "eckit/exception/Exceptions.h"
+
 namespace atlas {
 namespace grid {
 namespace spacing {
 namespace gaussian {
 
-std::string GaussianLatitudes::className() {
-    return "GaussianLatitudes";
-}
+namespace {
 
-void GaussianLatitudes::assign( double lats[], const size_t size ) const {
-    ASSERT( size >= lats_.size() );
-    for ( size_t jlat = 0; jlat < lats_.size(); ++jlat )
-        lats[jlat] = lats_[jlat];
-}
+// Latitudes from the North pole to the equator, for each tabulated N in turn, encoded without loss.
+// The IEEE 754 bit patterns b[j] of the latitudes, as unsigned 64-bit integers, are predicted as 2 b[j-1] - b[j-2]
+// (taking b[-1] = b[-2] = 0), which is close for smoothly varying latitudes. The differences from the prediction,
+// modulo 2^64 and zigzag encoded ( 2 d for d >= 0, -2 d - 1 for d < 0 ), are stored as variable-length integers:
+// 7 bits per byte, least significant first, with the high bit set in all bytes but the last.
+const unsigned char data[] = {
+    // N16 (TL31)
+    210, 144, 208, 217, 174, 171, 184, 213, 128, 1, 197, 247, 133, 225, 231, 137, 232, 214, 128, 1, 149, 235, 184, 128,
+    235, 132, 1, 143, 191, 216, 213, 128, 30, 213, 148, 138, 148, 215, 175, 10, 173, 169, 233, 241, 170, 243, 166, 1,
+    145, 163, 247, 225, 142, 6, 235, 218, 241, 141, 222, 3, 205, 183, 252, 160, 183, 2, 141, 204, 253, 234, 211, 1, 161,
+    180, 141, 178, 240, 220, 98, 179, 143, 205, 243, 170, 217, 255, 1, 155, 201, 198, 242, 150, 1, 219, 231, 209, 229,
+    230, 244, 147, 2, 247, 132, 157, 225, 200, 247, 176, 3, 253, 179, 246, 215, 176, 190, 177, 15,
+    // N24 (TL47)
+    136, 231, 244, 174, 211, 139, 229, 213, 128, 1, 203, 187, 130, 254, 201, 237, 218, 214, 128, 1, 177, 196, 195, 181,
+    130, 89, 183, 133, 186, 172, 142, 20, 129, 217, 239, 172, 208, 7, 235, 128, 142, 164, 216, 3, 241, 192, 236, 223,
+    135, 2, 191, 161, 134, 251, 222, 204, 88, 129, 151, 171, 226, 241, 147, 30, 205, 251, 247, 152, 147, 1, 223, 137,
+    160, 224, 105, 179, 169, 218, 167, 78, 197, 241, 226, 177, 59, 177, 176, 246, 241, 45, 225, 165, 170, 252, 35, 233,
+    154, 201, 184, 190, 147, 29, 211, 191, 221, 249, 136, 174, 208, 1, 201, 138, 165, 162, 36, 237, 164, 185, 239, 28,
+    217, 143, 227, 223, 22, 165, 160, 171, 150, 198, 180, 129, 3, 227, 216, 141, 167, 247, 206, 89, 209, 165, 196, 226,
+    136, 246, 238, 4, 135, 246, 226, 216, 212, 252, 164, 12,
+    // N32 (TL63)
+    140, 212, 233, 174, 143, 210, 251, 213, 128, 1, 185, 167, 143, 229, 238, 152, 212, 214, 128, 1, 133, 131, 227, 129,
+    248, 66, 237, 177, 178, 236, 143, 15, 225, 252, 141, 163, 222, 5, 131, 190, 160, 163, 227, 2, 249, 241, 190, 192,
+    198, 1, 145, 212, 168, 132, 122, 167, 160, 216, 168, 80, 193, 204, 181, 196, 184, 231, 38, 213, 173, 143, 207, 192,
+    190, 50, 235, 155, 217, 211, 59, 237, 140, 234, 195, 45, 229, 197, 155, 191, 35, 235, 128, 225, 148, 28, 239, 228,
+    211, 214, 22, 231, 183, 171, 190, 18, 155, 155, 133, 157, 15, 187, 221, 244, 210, 12, 225, 208, 223, 201, 10, 225,
+    201, 221, 241, 8, 189, 211, 209, 131, 169, 219, 172, 1, 231, 208, 171, 231, 166, 241, 5, 169, 144, 219, 215, 10,
+    163, 240, 240, 254, 8, 221, 222, 178, 194, 7, 229, 168, 159, 175, 184, 180, 83, 175, 209, 240, 180, 253, 228, 145,
+    2, 219, 150, 176, 130, 8, 229, 200, 170, 190, 255, 128, 134, 2, 181, 171, 179, 154, 242, 177, 196, 3, 179, 129, 203,
+    243, 196, 231, 160, 15,
+    // N48 (TL95)
+    130, 246, 254, 138, 205, 167, 146, 214, 128, 1, 187, 198, 180, 238, 219, 191, 205, 214, 128, 1, 185, 227, 134, 237,
+    222, 44, 217, 163, 227, 247, 141, 10, 145, 184, 174, 232, 234, 3, 143, 158, 148, 192, 237, 1, 253, 208, 205, 220,
+    132, 1, 237, 160, 162, 207, 81, 223, 157, 174, 223, 53, 141, 184, 218, 160, 37, 199, 233, 199, 240, 26, 153, 168,
+    148, 131, 20, 189, 222, 162, 168, 15, 161, 135, 170, 252, 11, 205, 204, 131, 222, 150, 187, 48, 239, 201, 183, 149,
+    219, 156, 11, 187, 209, 251, 210, 12, 209, 179, 204, 191, 10, 205, 176, 225, 230, 8, 175, 155, 211, 185, 7, 207,
+    219, 221, 173, 6, 155, 148, 176, 187, 5, 217, 140, 251, 220, 4, 211, 198, 164, 142, 4, 133, 222, 148, 204, 3, 245,
+    221, 146, 148, 3, 227, 216, 171, 228, 2, 173, 137, 161, 187, 2, 153, 132, 220, 151, 2, 145, 241, 227, 248, 1, 147,
+    193, 215, 221, 1, 133, 134, 206, 174, 246, 164, 78, 247, 156, 159, 220, 158, 139, 41, 173, 138, 207, 187, 2, 181,
+    169, 234, 153, 2, 133, 177, 176, 251, 1, 221, 220, 226, 223, 1, 249, 187, 204, 198, 1, 179, 174, 192, 175, 1, 203,
+    205, 150, 163, 197, 204, 18, 171, 224, 179, 237, 238, 147, 220, 1, 165, 228, 216, 231, 1, 141, 135, 229, 196, 1,
+    139, 140, 214, 163, 1, 171, 242, 221, 174, 139, 221, 248, 2, 167, 148, 196, 212, 224, 227, 100, 157, 232, 250, 219,
+    191, 189, 231, 4, 165, 241, 252, 129, 149, 191, 162, 12,
+    // N64 (TL127)
+    168, 244, 202, 193, 128, 216, 157, 214, 128, 1, 241, 197, 165, 172, 188, 145, 202, 214, 128, 1, 155, 245, 146, 220,
+    204, 33, 223, 241, 194, 219, 203, 7, 231, 229, 247, 203, 240, 2, 247, 222, 168, 174, 178, 1, 223, 183, 219, 214, 99,
+    217, 193, 187, 166, 61, 133, 149, 152, 175, 40, 137, 128, 163, 254, 27, 153, 215, 128, 153, 20, 137, 161, 158, 134,
+    15, 163, 255, 207, 193, 11, 195, 216, 178, 128, 9, 247, 146, 142, 150, 7, 237, 130, 156, 231, 5, 227, 215, 130, 226,
+    4, 223, 247, 228, 250, 3, 227, 229, 133, 151, 178, 191, 8, 229, 253, 146, 144, 132, 170, 36, 209, 222, 221, 232, 4,
+    255, 238, 158, 147, 4, 207, 141, 223, 204, 3, 169, 197, 138, 146, 3, 161, 162, 239, 224, 2, 253, 185, 162, 183, 2,
+    163, 248, 237, 147, 2, 187, 253, 194, 245, 1, 217, 182, 176, 219, 1, 153, 150, 220, 196, 1, 163, 178, 253, 176, 1,
+    231, 165, 217, 159, 1, 135, 199, 191, 144, 1, 225, 218, 136, 131, 1, 241, 237, 147, 119, 213, 224, 197, 108, 143,
+    194, 135, 99, 211, 247, 197, 90, 235, 222, 240, 82, 239, 134, 250, 75, 225, 145, 214, 69, 177, 255, 239, 140, 223,
+    242, 30, 231, 140, 240, 152, 169, 224, 58, 137, 196, 248, 107, 241, 255, 149, 99, 167, 200, 139, 91, 239, 183, 207,
+    83, 163, 206, 216, 76, 177, 200, 159, 70, 203, 160, 157, 64, 255, 221, 203, 58, 201, 188, 165, 53, 171, 221, 165,
+    48, 211, 155, 156, 184, 152, 175, 165, 1, 157, 184, 165, 180, 253, 246, 13, 169, 184, 197, 69, 147, 128, 169, 61,
+    167, 199, 180, 53, 173, 231, 216, 176, 137, 220, 75, 227, 236, 205, 227, 163, 240, 154, 2, 159, 249, 161, 62, 151,
+    137, 214, 227, 158, 130, 255, 1, 201, 138, 204, 255, 187, 150, 206, 3, 171, 183, 165, 164, 241, 181, 152, 15,
+    // N80 (TL159)
+    136, 230, 248, 247, 212, 195, 164, 214, 128, 1, 205, 226, 254, 213, 228, 142, 200, 214, 128, 1, 205, 156, 147, 161,
+    243, 26, 225, 184, 163, 253, 137, 6, 235, 171, 189, 141, 167, 2, 159, 231, 207, 230, 142, 1, 191, 241, 138, 231, 79,
+    207, 239, 159, 138, 49, 217, 206, 151, 169, 32, 147, 170, 165, 180, 22, 203, 139, 241, 149, 16, 199, 159, 190, 134,
+    12, 167, 183, 146, 156, 9, 217, 223, 254, 154, 7, 221, 137, 185, 223, 5, 229, 147, 186, 211, 4, 169, 137, 236, 232,
+    3, 237, 248, 156, 150, 3, 179, 240, 154, 213, 2, 147, 150, 172, 161, 2, 167, 201, 187, 247, 1, 165, 196, 163, 213,
+    1, 197, 237, 139, 185, 1, 231, 162, 144, 158, 172, 173, 20, 141, 131, 178, 130, 155, 196, 15, 135, 159, 223, 250, 1,
+    199, 241, 188, 222, 1, 141, 240, 162, 198, 1, 155, 229, 182, 177, 1, 145, 169, 176, 159, 1, 167, 168, 213, 143, 1,
+    237, 212, 246, 129, 1, 143, 230, 237, 117, 203, 128, 155, 107, 255, 140, 228, 97, 231, 164, 179, 89, 179, 155, 246,
+    81, 219, 203, 157, 75, 161, 183, 156, 69, 233, 213, 231, 63, 179, 242, 245, 58, 183, 142, 191, 54, 243, 170, 188,
+    50, 199, 202, 231, 46, 135, 222, 187, 43, 147, 152, 180, 40, 223, 146, 205, 37, 167, 130, 131, 35, 181, 245, 210,
+    32, 199, 144, 186, 30, 251, 170, 182, 28, 165, 199, 191, 154, 213, 179, 2, 151, 211, 255, 184, 200, 175, 69, 209,
+    177, 170, 46, 195, 192, 165, 43, 157, 253, 185, 40, 199, 166, 229, 37, 249, 215, 165, 35, 211, 234, 248, 32, 149,
+    179, 221, 30, 129, 196, 209, 28, 151, 131, 212, 26, 243, 192, 227, 24, 137, 227, 254, 22, 241, 229, 164, 21, 193,
+    210, 212, 19, 177, 135, 146, 208, 180, 136, 110, 141, 154, 185, 208, 137, 190, 33, 253, 223, 171, 30, 227, 205, 200,
+    27, 143, 138, 241, 24, 131, 145, 164, 22, 135, 161, 224, 19, 205, 143, 213, 142, 209, 235, 181, 1, 199, 130, 157,
+    170, 172, 161, 105, 199, 227, 129, 25, 135, 209, 245, 233, 145, 165, 38, 201, 166, 234, 168, 233, 244, 151, 4, 213,
+    234, 192, 146, 143, 178, 197, 2, 173, 141, 247, 140, 241, 205, 186, 13,
+    // N96 (TL191)
+    156, 197, 233, 138, 153, 140, 169, 214, 128, 1, 169, 209, 136, 193, 141, 226, 198, 214, 128, 1, 143, 188, 249, 239,
+    182, 22, 225, 239, 200, 211, 136, 5, 131, 133, 166, 134, 246, 1, 167, 198, 146, 136, 119, 241, 203, 133, 197, 66,
+    171, 254, 253, 245, 40, 171, 153, 193, 249, 26, 215, 167, 199, 215, 18, 223, 197, 240, 189, 13, 189, 217, 148, 134,
+    10, 137, 234, 135, 216, 7, 143, 249, 212, 129, 6, 139, 246, 166, 229, 4, 247, 238, 203, 240, 3, 209, 172, 219, 151,
+    3, 237, 169, 235, 210, 2, 177, 236, 209, 156, 2, 207, 245, 179, 241, 1, 249, 208, 191, 206, 1, 219, 165, 128, 178,
+    1, 237, 201, 193, 154, 1, 235, 226, 252, 134, 1, 241, 216, 203, 118, 189, 129, 224, 104, 229, 250, 252, 92, 181,
+    238, 242, 82, 133, 165, 181, 131, 232, 162, 28, 155, 177, 152, 200, 148, 211, 1, 241, 234, 170, 120, 241, 205, 243,
+    108, 193, 216, 238, 98, 145, 217, 129, 90, 201, 226, 150, 82, 207, 215, 155, 75, 151, 158, 129, 69, 153, 210, 186,
+    63, 133, 136, 189, 58, 159, 167, 255, 53, 245, 194, 249, 49, 245, 135, 165, 46, 167, 134, 252, 42, 161, 203, 249,
+    39, 215, 172, 153, 37, 153, 203, 215, 34, 171, 254, 176, 32, 241, 225, 162, 30, 183, 176, 170, 28, 157, 206, 197,
+    26, 233, 194, 242, 24, 219, 182, 175, 23, 255, 227, 250, 21, 245, 156, 211, 20, 151, 195, 183, 19, 255, 212, 166,
+    18, 239, 210, 159, 17, 213, 204, 161, 16, 197, 225, 171, 15, 155, 181, 189, 14, 243, 252, 213, 13, 183, 233, 244,
+    12, 187, 202, 238, 214, 156, 157, 43, 167, 217, 191, 213, 229, 206, 16, 235, 191, 228, 21, 151, 156, 203, 20, 131,
+    152, 186, 19, 181, 241, 176, 18, 233, 212, 174, 17, 137, 243, 178, 16, 223, 155, 189, 15, 221, 149, 205, 14, 181,
+    141, 226, 13, 179, 254, 251, 12, 205, 153, 154, 12, 165, 183, 188, 11, 155, 189, 226, 10, 173, 255, 139, 10, 189,
+    218, 184, 9, 197, 160, 129, 192, 148, 147, 73, 203, 201, 138, 236, 241, 196, 46, 135, 165, 159, 15, 171, 205, 141,
+    14, 151, 142, 128, 13, 207, 187, 246, 11, 131, 152, 240, 10, 217, 154, 237, 9, 141, 226, 200, 149, 143, 167, 13,
+    253, 207, 129, 141, 254, 136, 226, 1, 221, 134, 231, 13, 147, 246, 243, 11, 153, 250, 131, 10, 159, 210, 180, 203,
+    162, 175, 244, 2, 183, 143, 140, 153, 248, 176, 106, 143, 162, 191, 240, 175, 223, 227, 4, 141, 225, 215, 163, 229,
+    159, 161, 12,
+    // N128 (TL255)
+    248, 235, 217, 229, 219, 231, 174, 214, 128, 1, 199, 195, 175, 153, 128, 138, 197, 214, 128, 1, 253, 194, 151, 199,
+    234, 16, 233, 133, 151, 231, 230, 3, 245, 181, 140, 212, 184, 1, 165, 209, 199, 173, 89, 167, 218, 250, 247, 49,
+    213, 234, 136, 219, 30, 213, 135, 236, 156, 20, 165, 145, 239, 130, 14, 249, 128, 165, 143, 10, 139, 150, 165, 197,
+    7, 227, 150, 201, 226, 5, 241, 145, 214, 193, 4, 131, 179, 170, 204, 3, 167, 169, 223, 244, 2, 191, 248, 133, 178,
+    2, 197, 145, 174, 254, 1, 181, 153, 216, 213, 1, 217, 202, 159, 181, 1, 157, 224, 134, 155, 1, 143, 131, 214, 133,
+    1, 227, 138, 134, 116, 251, 233, 177, 101, 179, 202, 140, 89, 249, 197, 219, 78, 145, 141, 241, 69, 247, 193, 169,
+    62, 245, 182, 232, 55, 231, 165, 151, 50, 187, 241, 163, 45, 137, 186, 255, 40, 155, 252, 157, 37, 189, 187, 245,
+    33, 219, 232, 253, 30, 139, 145, 176, 28, 219, 220, 134, 26, 255, 242, 226, 214, 251, 220, 15, 141, 131, 140, 212,
+    178, 221, 6, 227, 186, 239, 40, 151, 183, 236, 37, 237, 175, 142, 35, 245, 135, 209, 32, 219, 210, 176, 30, 183,
+    249, 169, 28, 241, 151, 186, 26, 249, 236, 222, 24, 177, 236, 149, 23, 133, 162, 221, 21, 249, 186, 179, 20, 155,
+    254, 150, 19, 233, 196, 134, 18, 233, 255, 128, 17, 161, 171, 133, 16, 175, 208, 146, 15, 185, 142, 168, 14, 237,
+    134, 197, 13, 217, 225, 232, 12, 129, 221, 146, 12, 177, 178, 194, 11, 131, 162, 247, 10, 209, 251, 176, 10, 177,
+    138, 239, 9, 141, 160, 177, 9, 229, 155, 247, 8, 193, 209, 192, 8, 131, 158, 141, 8, 225, 239, 220, 7, 201, 152,
+    175, 7, 207, 143, 132, 7, 223, 177, 219, 6, 219, 241, 180, 6, 153, 181, 144, 6, 251, 238, 237, 5, 209, 143, 205, 5,
+    253, 254, 173, 5, 239, 186, 144, 5, 189, 175, 244, 4, 203, 207, 217, 4, 209, 148, 192, 4, 157, 239, 167, 4, 169,
+    223, 144, 4, 239, 190, 205, 184, 183, 191, 4, 143, 147, 240, 191, 169, 181, 40, 163, 200, 162, 7, 139, 240, 251, 6,
+    205, 230, 214, 6, 181, 167, 179, 6, 197, 156, 145, 6, 157, 189, 240, 5, 177, 137, 209, 5, 219, 230, 178, 5, 253,
+    221, 149, 5, 177, 208, 249, 4, 241, 211, 222, 4, 179, 197, 196, 4, 129, 178, 171, 4, 179, 255, 146, 4, 147, 191,
+    251, 3, 183, 210, 228, 3, 167, 207, 206, 3, 141, 142, 185, 3, 139, 178, 164, 3, 211, 147, 144, 3, 201, 187, 252, 2,
+    197, 238, 162, 161, 226, 249, 26, 217, 178, 208, 177, 224, 239, 62, 167, 254, 136, 5, 141, 213, 229, 4, 163, 242,
+    194, 4, 131, 249, 160, 4, 191, 224, 255, 3, 171, 142, 223, 3, 227, 165, 191, 3, 149, 233, 159, 3, 217, 251, 128, 3,
+    233, 203, 226, 2, 147, 129, 194, 149, 133, 216, 161, 1, 159, 226, 239, 181, 128, 251, 17, 171, 131, 148, 4, 185,
+    131, 218, 3, 215, 254, 160, 3, 229, 200, 168, 143, 194, 238, 71, 227, 244, 163, 147, 201, 183, 159, 2, 171, 253,
+    240, 3, 241, 243, 156, 215, 199, 193, 251, 1, 181, 171, 229, 241, 206, 138, 211, 3, 225, 221, 236, 177, 188, 155,
+    148, 15,
+    // N160 (TL319)
+    254, 165, 143, 142, 139, 159, 178, 214, 128, 1, 149, 248, 134, 145, 154, 136, 196, 214, 128, 1, 173, 225, 210, 168,
+    188, 13, 131, 146, 179, 204, 133, 3, 145, 161, 161, 228, 147, 1, 209, 214, 207, 193, 71, 241, 208, 200, 251, 39,
+    185, 162, 139, 202, 24, 165, 250, 241, 151, 16, 141, 151, 187, 156, 11, 231, 181, 210, 140, 8, 189, 189, 197, 132,
+    6, 253, 196, 140, 207, 4, 175, 153, 170, 206, 3, 139, 232, 181, 240, 2, 191, 200, 169, 170, 2, 211, 141, 249, 244,
+    1, 211, 195, 202, 203, 1, 197, 158, 132, 171, 1, 225, 254, 136, 145, 1, 209, 227, 141, 124, 235, 212, 255, 106, 215,
+    170, 242, 92, 185, 236, 148, 81, 207, 239, 169, 71, 153, 174, 130, 63, 245, 227, 249, 55, 159, 193, 243, 49, 131,
+    246, 216, 44, 197, 244, 151, 40, 243, 242, 161, 36, 245, 144, 235, 32, 145, 243, 233, 29, 157, 169, 150, 27, 209,
+    228, 233, 24, 205, 240, 222, 22, 219, 254, 240, 20, 131, 169, 156, 19, 249, 197, 221, 17, 207, 255, 177, 16, 131,
+    161, 151, 15, 237, 168, 139, 14, 189, 189, 140, 13, 171, 157, 153, 12, 167, 161, 176, 11, 183, 186, 208, 10, 209,
+    160, 243, 177, 197, 152, 8, 239, 220, 152, 241, 236, 227, 9, 175, 221, 189, 17, 215, 146, 182, 16, 253, 161, 185,
+    15, 145, 250, 197, 14, 177, 186, 219, 13, 179, 229, 248, 12, 155, 174, 157, 12, 231, 188, 200, 11, 141, 194, 249,
+    10, 141, 135, 176, 10, 203, 199, 235, 9, 153, 211, 171, 9, 235, 240, 239, 8, 253, 133, 184, 8, 199, 217, 131, 8,
+    251, 206, 210, 7, 253, 205, 164, 7, 181, 168, 249, 6, 175, 211, 208, 6, 193, 171, 170, 6, 201, 161, 134, 6, 167,
+    157, 228, 5, 145, 141, 196, 5, 213, 225, 165, 5, 139, 135, 137, 5, 237, 246, 237, 4, 189, 150, 212, 4, 191, 234,
+    187, 4, 177, 216, 164, 4, 161, 224, 142, 4, 131, 247, 249, 3, 251, 136, 230, 3, 131, 161, 211, 3, 211, 162, 193, 3,
+    157, 157, 176, 3, 247, 241, 159, 3, 133, 174, 144, 3, 189, 198, 129, 3, 137, 174, 243, 2, 187, 235, 229, 2, 175,
+    241, 216, 2, 243, 191, 204, 2, 227, 212, 192, 2, 255, 164, 181, 2, 157, 183, 170, 2, 131, 252, 159, 2, 151, 252,
+    149, 2, 249, 174, 140, 2, 211, 141, 131, 2, 151, 161, 250, 1, 159, 220, 241, 1, 143, 193, 233, 1, 199, 205, 225, 1,
+    181, 255, 217, 1, 205, 214, 210, 1, 135, 222, 219, 177, 194, 150, 17, 201, 226, 204, 190, 164, 226, 18, 227, 178,
+    252, 2, 189, 215, 239, 2, 179, 181, 227, 2, 211, 195, 215, 2, 143, 139, 204, 2, 147, 250, 192, 2, 249, 157, 182, 2,
+    173, 233, 171, 2, 245, 215, 161, 2, 241, 246, 151, 2, 131, 185, 142, 2, 221, 162, 133, 2, 187, 162, 252, 1, 223,
+    201, 243, 1, 207, 152, 235, 1, 139, 249, 226, 1, 171, 248, 218, 1, 129, 146, 211, 1, 181, 202, 203, 1, 233, 152,
+    196, 1, 163, 253, 188, 1, 157, 243, 181, 1, 187, 140, 175, 1, 129, 170, 168, 1, 177, 230, 161, 1, 253, 175, 155, 1,
+    143, 139, 149, 1, 173, 240, 161, 170, 217, 139, 71, 173, 242, 185, 233, 244, 101, 189, 131, 134, 2, 253, 180, 250,
+    1, 255, 247, 238, 1, 133, 231, 227, 1, 215, 231, 216, 1, 213, 130, 206, 1, 191, 166, 195, 1, 191, 237, 184, 1, 163,
+    189, 174, 1, 157, 176, 164, 1, 211, 145, 154, 1, 227, 167, 144, 1, 169, 210, 251, 216, 191, 132, 107, 165, 146, 134,
+    225, 220, 222, 36, 245, 154, 230, 1, 203, 141, 211, 1, 187, 163, 192, 1, 171, 185, 173, 1, 175, 242, 154, 1, 181,
+    140, 171, 225, 141, 246, 178, 1, 243, 193, 144, 154, 171, 208, 108, 237, 199, 199, 1, 199, 152, 138, 159, 241, 146,
+    35, 225, 180, 250, 217, 128, 250, 155, 4, 245, 178, 198, 153, 170, 217, 194, 2, 231, 145, 184, 232, 213, 166, 189,
+    13,
+    // N200 (TL399)
+    242, 166, 183, 151, 234, 254, 180, 214, 128, 1, 143, 158, 145, 197, 165, 160, 195, 214, 128, 1, 129, 174, 160, 241,
+    227, 10, 213, 222, 150, 227, 183, 2, 249, 255, 221, 161, 118, 247, 229, 151, 157, 57, 219, 239, 221, 253, 31, 167,
+    160, 212, 213, 19, 149, 140, 132, 250, 12, 167, 253, 195, 253, 8, 219, 234, 201, 189, 6, 233, 188, 157, 234, 4, 155,
+    224, 131, 217, 3, 221, 228, 253, 241, 2, 203, 194, 234, 166, 2, 221, 195, 222, 238, 1, 229, 240, 130, 196, 1, 133,
+    247, 245, 162, 1, 183, 243, 239, 136, 1, 141, 192, 140, 116, 205, 167, 169, 99, 145, 217, 208, 85, 135, 131, 172,
+    74, 217, 190, 250, 64, 237, 134, 139, 57, 197, 254, 183, 50, 153, 148, 228, 44, 209, 202, 248, 39, 171, 151, 227,
+    35, 179, 186, 149, 32, 147, 228, 131, 29, 229, 215, 164, 26, 233, 183, 240, 23, 175, 223, 224, 21, 197, 162, 240,
+    19, 215, 220, 154, 18, 231, 178, 220, 16, 201, 158, 178, 15, 213, 208, 153, 14, 199, 175, 144, 13, 189, 202, 148,
+    12, 253, 212, 164, 11, 169, 151, 191, 10, 189, 128, 227, 9, 221, 132, 143, 9, 155, 182, 194, 8, 187, 173, 252, 7,
+    237, 148, 188, 7, 253, 155, 129, 7, 135, 130, 203, 6, 219, 139, 153, 6, 245, 129, 235, 5, 199, 182, 192, 5, 253,
+    129, 153, 5, 211, 188, 244, 4, 219, 198, 210, 4, 175, 130, 179, 4, 173, 213, 149, 4, 239, 134, 183, 221, 150, 249,
+    12, 189, 179, 188, 188, 219, 183, 1, 157, 243, 145, 7, 251, 159, 229, 6, 175, 192, 187, 6, 225, 172, 148, 6, 135,
+    205, 239, 5, 159, 139, 205, 5, 185, 211, 172, 5, 207, 141, 142, 5, 185, 172, 241, 4, 175, 158, 214, 4, 235, 209,
+    188, 4, 129, 190, 164, 4, 169, 209, 141, 4, 247, 130, 248, 3, 139, 202, 227, 3, 207, 153, 208, 3, 235, 234, 189, 3,
+    211, 176, 172, 3, 149, 237, 155, 3, 215, 140, 140, 3, 245, 151, 253, 2, 223, 246, 238, 2, 165, 182, 225, 2, 209,
+    192, 212, 2, 171, 156, 200, 2, 203, 192, 188, 2, 237, 166, 177, 2, 157, 209, 166, 2, 235, 180, 156, 2, 149, 216,
+    146, 2, 141, 174, 137, 2, 183, 180, 128, 2, 215, 241, 247, 1, 253, 218, 239, 1, 129, 238, 231, 1, 237, 170, 224, 1,
+    157, 143, 217, 1, 159, 155, 210, 1, 183, 202, 203, 1, 151, 150, 197, 1, 145, 133, 191, 1, 135, 149, 185, 1, 153,
+    189, 179, 1, 141, 132, 174, 1, 151, 227, 168, 1, 193, 218, 163, 1, 147, 236, 158, 1, 233, 147, 154, 1, 165, 207,
+    149, 1, 199, 158, 145, 1, 249, 133, 141, 1, 233, 252, 136, 1, 157, 133, 133, 1, 159, 159, 129, 1, 237, 202, 125,
+    239, 133, 122, 235, 203, 118, 235, 167, 115, 157, 136, 112, 203, 254, 108, 227, 253, 105, 221, 133, 103, 167, 159,
+    100, 159, 189, 97, 231, 236, 94, 223, 160, 92, 139, 228, 89, 209, 169, 87, 201, 254, 84, 175, 146, 240, 253, 189,
+    145, 20, 223, 134, 150, 209, 167, 208, 8, 165, 206, 156, 1, 143, 186, 152, 1, 253, 165, 148, 1, 251, 180, 144, 1,
+    233, 182, 140, 1, 157, 224, 136, 1, 205, 137, 133, 1, 185, 183, 129, 1, 209, 255, 125, 207, 208, 122, 207, 161, 119,
+    153, 132, 116, 251, 243, 112, 199, 236, 109, 143, 229, 106, 165, 239, 103, 161, 130, 101, 205, 153, 98, 147, 190,
+    95, 223, 226, 92, 135, 144, 90, 129, 207, 87, 149, 133, 85, 167, 209, 82, 207, 148, 80, 253, 237, 77, 191, 190, 75,
+    157, 156, 73, 175, 254, 70, 241, 228, 68, 153, 212, 66, 195, 195, 64, 159, 183, 62, 221, 209, 132, 230, 200, 224, 5,
+    161, 237, 150, 210, 130, 227, 51, 177, 226, 112, 203, 254, 108, 157, 137, 105, 185, 165, 101, 183, 202, 97, 161,
+    248, 93, 161, 157, 90, 187, 229, 86, 161, 147, 83, 189, 219, 79, 209, 163, 76, 239, 235, 72, 235, 188, 69, 235, 141,
+    66, 155, 249, 62, 155, 202, 59, 211, 223, 149, 129, 174, 194, 34, 165, 167, 229, 249, 232, 196, 80, 141, 135, 100,
+    239, 221, 93, 133, 163, 87, 251, 156, 81, 223, 243, 74, 161, 255, 68, 209, 231, 62, 247, 144, 235, 175, 249, 133,
+    92, 137, 184, 191, 202, 180, 136, 138, 1, 141, 206, 89, 207, 251, 76, 239, 181, 65, 137, 138, 154, 164, 190, 155,
+    181, 3, 253, 168, 138, 210, 157, 129, 23, 219, 251, 213, 158, 236, 169, 155, 5, 169, 176, 144, 138, 164, 227, 179,
+    12,
+    // N256 (TL511)
+    186, 153, 153, 185, 228, 178, 183, 214, 128, 1, 225, 243, 147, 218, 168, 197, 194, 214, 128, 1, 217, 251, 151, 170,
+    182, 8, 153, 174, 128, 210, 243, 1, 239, 147, 203, 181, 92, 215, 232, 174, 220, 44, 157, 164, 141, 255, 24, 253,
+    217, 186, 175, 15, 209, 204, 216, 143, 10, 251, 208, 168, 130, 7, 129, 188, 164, 136, 5, 147, 135, 144, 227, 3, 201,
+    255, 211, 241, 2, 131, 197, 144, 161, 2, 241, 184, 179, 230, 1, 191, 198, 200, 186, 1, 129, 230, 151, 153, 1, 135,
+    229, 168, 127, 163, 177, 251, 106, 223, 148, 221, 90, 183, 157, 207, 77, 143, 209, 245, 66, 213, 216, 140, 58, 191,
+    225, 225, 50, 245, 187, 206, 44, 235, 184, 181, 39, 219, 226, 255, 34, 143, 209, 155, 31, 157, 230, 250, 27, 197,
+    128, 146, 25, 151, 142, 216, 22, 253, 225, 197, 20, 187, 241, 212, 18, 239, 200, 128, 17, 169, 216, 196, 15, 129,
+    231, 157, 14, 151, 139, 137, 13, 233, 143, 132, 12, 195, 241, 140, 11, 141, 210, 161, 10, 191, 244, 192, 9, 179,
+    186, 233, 8, 253, 150, 154, 8, 201, 147, 210, 7, 207, 198, 144, 7, 157, 217, 212, 6, 129, 250, 157, 6, 253, 229,
+    235, 5, 205, 224, 189, 5, 141, 181, 147, 5, 157, 180, 236, 4, 161, 181, 200, 4, 135, 149, 167, 4, 143, 173, 136, 4,
+    219, 234, 235, 3, 225, 170, 209, 3, 169, 217, 184, 3, 249, 228, 161, 3, 187, 182, 140, 3, 189, 190, 248, 2, 223,
+    238, 229, 2, 147, 187, 212, 2, 135, 146, 196, 2, 145, 239, 180, 2, 251, 194, 166, 2, 255, 135, 153, 2, 173, 179,
+    140, 2, 141, 188, 128, 2, 171, 162, 245, 1, 227, 215, 234, 1, 243, 215, 224, 1, 135, 165, 215, 1, 201, 173, 206, 1,
+    145, 249, 197, 1, 151, 182, 220, 143, 155, 143, 8, 231, 197, 133, 209, 176, 143, 3, 213, 194, 222, 2, 235, 242, 208,
+    2, 253, 133, 196, 2, 187, 223, 183, 2, 247, 144, 172, 2, 173, 132, 161, 2, 201, 194, 150, 2, 247, 185, 140, 2, 161,
+    243, 130, 2, 205, 227, 249, 1, 217, 136, 241, 1, 197, 226, 232, 1, 233, 236, 224, 1, 211, 158, 217, 1, 235, 128,
+    210, 1, 187, 136, 203, 1, 231, 185, 196, 1, 155, 140, 190, 1, 193, 255, 183, 1, 137, 150, 178, 1, 151, 201, 172, 1,
+    165, 157, 167, 1, 201, 137, 162, 1, 137, 142, 157, 1, 195, 179, 152, 1, 177, 232, 147, 1, 211, 183, 143, 1, 239,
+    156, 139, 1, 219, 147, 135, 1, 221, 162, 131, 1, 147, 193, 127, 249, 238, 123, 249, 180, 120, 223, 131, 117, 143,
+    228, 113, 167, 216, 110, 239, 208, 107, 211, 225, 104, 203, 244, 101, 199, 157, 99, 141, 205, 96, 211, 135, 94, 151,
+    205, 91, 245, 159, 89, 185, 251, 86, 177, 219, 84, 139, 207, 82, 209, 192, 80, 169, 191, 78, 133, 201, 76, 223, 210,
+    74, 135, 238, 72, 147, 135, 71, 161, 171, 69, 145, 216, 67, 159, 135, 66, 247, 188, 64, 181, 251, 62, 165, 190, 61,
+    177, 131, 60, 213, 213, 58, 195, 163, 57, 157, 250, 55, 213, 217, 54, 149, 185, 53, 233, 154, 52, 191, 135, 51, 249,
+    241, 49, 157, 229, 48, 191, 216, 47, 145, 208, 46, 177, 206, 45, 215, 204, 44, 167, 207, 43, 149, 212, 42, 181, 221,
+    41, 137, 235, 40, 223, 248, 39, 223, 138, 39, 235, 156, 38, 213, 183, 37, 245, 203, 36, 171, 237, 35, 155, 136, 35,
+    211, 169, 34, 163, 205, 33, 245, 240, 32, 227, 150, 32, 255, 192, 31, 251, 138, 201, 247, 181, 222, 13, 139, 140,
+    247, 150, 226, 222, 8, 133, 145, 59, 167, 238, 57, 175, 212, 56, 183, 186, 55, 245, 164, 54, 149, 152, 53, 211, 130,
+    52, 165, 250, 50, 199, 237, 49, 207, 233, 48, 137, 234, 47, 221, 225, 46, 205, 230, 45, 183, 235, 44, 167, 240, 43,
+    149, 245, 42, 151, 135, 42, 239, 148, 41, 217, 153, 40, 201, 180, 39, 151, 194, 38, 137, 221, 37, 137, 239, 36, 251,
+    137, 36, 227, 164, 35, 211, 191, 34, 237, 222, 33, 145, 254, 32, 225, 161, 32, 255, 192, 31, 133, 233, 30, 165, 136,
+    30, 219, 180, 29, 149, 225, 28, 179, 128, 28, 211, 181, 27, 161, 217, 26, 141, 138, 26, 175, 191, 25, 175, 231, 24,
+    155, 152, 24, 187, 205, 23, 163, 254, 22, 219, 190, 168, 181, 232, 191, 2, 221, 146, 189, 244, 199, 186, 42, 225,
+    196, 42, 187, 166, 41, 217, 153, 40, 253, 140, 39, 157, 128, 38, 193, 243, 36, 223, 230, 35, 233, 226, 34, 239, 222,
+    33, 171, 201, 32, 129, 215, 31, 133, 211, 30, 169, 198, 29, 149, 203, 28, 155, 199, 27, 243, 212, 26, 245, 208, 25,
+    129, 205, 24, 211, 218, 23, 165, 232, 22, 199, 219, 21, 155, 175, 139, 162, 128, 253, 24, 187, 152, 213, 182, 224,
+    247, 64, 131, 137, 38, 147, 129, 36, 131, 174, 34, 173, 201, 32, 135, 211, 30, 173, 238, 28, 211, 137, 27, 249, 164,
+    25, 163, 192, 23, 197, 219, 21, 173, 222, 245, 158, 145, 236, 159, 1, 147, 197, 240, 148, 176, 253, 19, 245, 218,
+    32, 221, 180, 29, 193, 142, 26, 225, 133, 255, 194, 176, 247, 69, 211, 136, 172, 165, 210, 219, 161, 2, 129, 171,
+    31, 155, 217, 201, 246, 241, 224, 249, 1, 161, 168, 171, 218, 147, 197, 213, 3, 131, 201, 133, 142, 239, 141, 146,
+    15,
+    // N320 (TL639)
+    148, 228, 207, 197, 237, 142, 185, 214, 128, 1, 225, 138, 196, 136, 167, 132, 194, 214, 128, 1, 177, 222, 192, 234,
+    222, 6, 191, 144, 214, 249, 194, 1, 149, 153, 194, 249, 73, 165, 193, 177, 228, 35, 159, 153, 228, 255, 19, 129,
+    142, 163, 166, 12, 203, 232, 224, 140, 8, 155, 215, 229, 206, 5, 157, 176, 221, 134, 4, 251, 221, 201, 130, 3, 203,
+    157, 228, 167, 2, 255, 210, 172, 231, 1, 137, 232, 173, 184, 1, 193, 155, 164, 149, 1, 151, 174, 201, 122, 195, 131,
+    240, 101, 223, 167, 203, 85, 201, 180, 204, 72, 235, 229, 141, 62, 191, 246, 197, 53, 205, 202, 190, 46, 151, 166,
+    207, 40, 193, 173, 217, 35, 237, 155, 197, 31, 205, 206, 128, 28, 219, 155, 253, 24, 139, 218, 175, 22, 191, 255,
+    142, 20, 137, 237, 147, 18, 225, 167, 184, 16, 179, 206, 247, 14, 139, 218, 205, 13, 193, 175, 183, 12, 217, 236,
+    177, 11, 165, 238, 186, 10, 219, 187, 208, 9, 187, 135, 241, 8, 181, 160, 155, 8, 233, 237, 205, 7, 143, 240, 135,
+    7, 191, 187, 200, 6, 217, 232, 142, 6, 225, 171, 218, 5, 245, 184, 170, 5, 187, 210, 254, 4, 215, 194, 214, 4, 237,
+    214, 177, 4, 189, 231, 143, 4, 253, 204, 240, 3, 163, 230, 211, 3, 145, 153, 185, 3, 229, 200, 160, 3, 143, 220,
+    137, 3, 207, 195, 244, 2, 195, 235, 224, 2, 253, 190, 206, 2, 133, 180, 189, 2, 161, 186, 173, 2, 243, 201, 158, 2,
+    167, 208, 144, 2, 157, 203, 131, 2, 221, 175, 247, 1, 227, 242, 235, 1, 129, 144, 225, 1, 211, 255, 214, 1, 157,
+    187, 205, 1, 181, 192, 196, 1, 155, 131, 188, 1, 223, 133, 180, 1, 205, 194, 172, 1, 253, 177, 165, 1, 239, 210,
+    158, 1, 133, 163, 152, 1, 139, 158, 146, 1, 231, 193, 140, 1, 231, 137, 135, 1, 141, 246, 129, 1, 165, 130, 125,
+    199, 176, 120, 139, 248, 115, 173, 221, 111, 253, 220, 107, 187, 241, 103, 181, 160, 100, 139, 227, 96, 213, 186,
+    93, 239, 163, 90, 235, 160, 87, 179, 175, 84, 147, 203, 81, 215, 212, 254, 160, 222, 140, 2, 179, 185, 213, 180,
+    174, 242, 6, 229, 247, 147, 1, 157, 168, 143, 1, 169, 234, 138, 1, 247, 200, 134, 1, 149, 185, 130, 1, 181, 191,
+    126, 233, 221, 122, 155, 135, 119, 157, 205, 115, 231, 153, 112, 205, 254, 108, 177, 238, 105, 247, 241, 102, 143,
+    252, 99, 161, 156, 97, 131, 195, 94, 173, 251, 91, 143, 184, 89, 211, 136, 87, 201, 221, 84, 243, 193, 82, 207, 170,
+    80, 225, 162, 78, 133, 157, 76, 203, 164, 74, 239, 180, 72, 253, 205, 70, 139, 231, 68, 201, 143, 67, 215, 190, 65,
+    249, 239, 63, 135, 170, 62, 197, 232, 60, 155, 180, 59, 191, 251, 57, 229, 205, 56, 183, 164, 55, 247, 131, 54, 153,
+    225, 52, 161, 199, 51, 221, 177, 50, 179, 158, 49, 135, 150, 48, 167, 137, 47, 151, 131, 46, 209, 131, 45, 165, 134,
+    44, 147, 139, 43, 151, 146, 42, 135, 162, 41, 193, 173, 40, 145, 198, 39, 255, 213, 38, 211, 238, 37, 239, 141, 37,
+    223, 168, 36, 149, 202, 35, 233, 237, 34, 159, 143, 34, 189, 185, 33, 249, 229, 32, 251, 141, 32, 207, 188, 31, 181,
+    237, 30, 191, 160, 30, 191, 211, 29, 249, 138, 29, 151, 192, 28, 255, 251, 27, 209, 181, 27, 213, 243, 26, 217, 177,
+    26, 219, 239, 25, 173, 180, 25, 203, 244, 24, 153, 185, 24, 131, 128, 24, 237, 198, 23, 243, 143, 23, 215, 214, 22,
+    145, 164, 22, 173, 239, 21, 201, 186, 21, 153, 138, 21, 231, 217, 20, 211, 171, 20, 135, 249, 19, 137, 205, 19, 143,
+    161, 19, 141, 245, 18, 145, 201, 18, 175, 159, 18, 225, 247, 17, 129, 206, 17, 179, 166, 17, 157, 131, 17, 159, 215,
+    16, 161, 182, 16, 239, 144, 16, 219, 237, 15, 191, 202, 15, 169, 167, 15, 171, 134, 15, 175, 229, 14, 173, 196, 14,
+    203, 165, 14, 229, 134, 14, 231, 229, 13, 157, 201, 13, 183, 170, 13, 161, 146, 13, 133, 239, 12, 179, 186, 207,
+    176, 157, 204, 6, 181, 151, 192, 163, 252, 177, 11, 229, 191, 24, 133, 139, 24, 235, 209, 23, 163, 170, 23, 139,
+    241, 22, 167, 188, 22, 223, 148, 22, 251, 223, 21, 201, 175, 21, 205, 131, 21, 157, 211, 20, 207, 171, 20, 163, 251,
+    19, 213, 211, 19, 217, 167, 19, 143, 128, 19, 221, 207, 18, 249, 176, 18, 201, 128, 18, 179, 221, 17, 229, 181, 17,
+    155, 142, 17, 135, 235, 16, 235, 199, 16, 241, 155, 16, 187, 129, 16, 195, 213, 15, 219, 182, 15, 245, 151, 15, 175,
+    240, 14, 147, 205, 14, 227, 178, 14, 203, 143, 14, 181, 236, 13, 131, 210, 13, 181, 170, 13, 187, 148, 13, 211, 245,
+    12, 139, 206, 12, 187, 188, 12, 245, 148, 12, 245, 254, 11, 145, 224, 11, 169, 193, 11, 251, 166, 11, 249, 144, 11,
+    229, 237, 10, 177, 211, 10, 177, 189, 10, 209, 158, 10, 205, 136, 10, 159, 238, 9, 185, 207, 9, 237, 189, 9, 135,
+    159, 9, 163, 134, 153, 165, 169, 203, 15, 179, 186, 227, 137, 138, 177, 20, 177, 177, 17, 209, 252, 16, 211, 208,
+    16, 213, 164, 16, 243, 239, 15, 243, 195, 15, 247, 151, 15, 149, 227, 14, 251, 191, 14, 253, 147, 14, 157, 223, 13,
+    157, 179, 13, 133, 144, 13, 137, 228, 12, 165, 175, 12, 141, 140, 12, 247, 232, 11, 145, 180, 11, 251, 144, 11, 151,
+    220, 10, 231, 193, 10, 231, 149, 10, 235, 233, 9, 237, 189, 9, 215, 154, 9, 189, 247, 8, 191, 203, 8, 223, 205, 204,
+    147, 246, 197, 69, 239, 220, 131, 205, 240, 178, 2, 221, 160, 15, 171, 218, 14, 205, 165, 14, 131, 188, 13, 211,
+    245, 12, 165, 175, 12, 171, 215, 11, 197, 162, 11, 153, 220, 10, 133, 225, 9, 183, 207, 9, 243, 229, 8, 219, 248,
+    172, 190, 169, 194, 105, 193, 207, 131, 132, 164, 175, 38, 227, 200, 14, 213, 245, 12, 139, 140, 12, 153, 220, 10,
+    185, 207, 9, 199, 236, 160, 158, 144, 187, 177, 1, 163, 189, 252, 230, 138, 168, 110, 143, 140, 12, 241, 132, 174,
+    219, 194, 201, 33, 205, 154, 158, 175, 243, 252, 157, 4, 177, 178, 195, 224, 221, 172, 193, 2, 219, 217, 200, 159,
+    162, 211, 190, 13,
+    // N400 (TL799)
+    178, 205, 130, 223, 252, 190, 186, 214, 128, 1, 139, 159, 169, 181, 163, 208, 193, 214, 128, 1, 255, 255, 230, 175,
+    178, 5, 251, 152, 135, 254, 155, 1, 237, 173, 204, 149, 59, 241, 238, 240, 208, 28, 207, 218, 146, 128, 16, 225,
+    239, 206, 235, 9, 155, 184, 196, 189, 6, 169, 135, 144, 191, 4, 135, 155, 134, 159, 3, 211, 201, 167, 181, 2, 221,
+    245, 212, 236, 1, 205, 236, 141, 185, 1, 219, 154, 193, 147, 1, 251, 253, 184, 119, 227, 186, 137, 98, 219, 213,
+    193, 81, 129, 209, 189, 68, 191, 143, 139, 58, 173, 236, 216, 49, 191, 129, 236, 42, 193, 159, 153, 37, 187, 141,
+    192, 32, 211, 139, 200, 28, 131, 167, 158, 25, 221, 148, 180, 22, 133, 155, 254, 19, 183, 171, 243, 17, 211, 174,
+    140, 16, 191, 178, 195, 14, 223, 224, 147, 13, 185, 199, 249, 11, 199, 206, 241, 10, 167, 172, 249, 9, 187, 191,
+    142, 9, 203, 165, 175, 8, 183, 149, 218, 7, 137, 234, 141, 7, 239, 151, 201, 6, 163, 159, 139, 6, 241, 162, 211, 5,
+    237, 193, 160, 5, 215, 179, 242, 4, 151, 180, 200, 4, 169, 140, 162, 4, 173, 134, 255, 3, 187, 249, 222, 3, 235,
+    186, 193, 3, 139, 176, 166, 3, 205, 177, 141, 3, 243, 174, 246, 2, 155, 137, 225, 2, 225, 172, 205, 2, 175, 141,
+    187, 2, 223, 144, 170, 2, 159, 176, 154, 2, 149, 217, 139, 2, 251, 132, 254, 1, 251, 161, 241, 1, 137, 174, 229, 1,
+    251, 155, 218, 1, 129, 227, 207, 1, 219, 255, 197, 1, 175, 232, 188, 1, 211, 154, 180, 1, 219, 140, 172, 1, 171,
+    188, 164, 1, 173, 167, 157, 1, 235, 195, 150, 1, 229, 145, 144, 1, 249, 141, 138, 1, 135, 182, 132, 1, 203, 131,
+    127, 185, 246, 121, 185, 139, 117, 191, 194, 112, 133, 149, 108, 177, 134, 104, 255, 144, 100, 221, 178, 96, 243,
+    239, 92, 217, 190, 89, 205, 164, 86, 149, 157, 83, 181, 168, 80, 153, 196, 77, 195, 241, 74, 253, 170, 72, 145, 247,
+    69, 145, 205, 67, 215, 179, 65, 129, 163, 63, 191, 159, 61, 131, 167, 59, 195, 185, 57, 235, 212, 55, 247, 248, 53,
+    129, 168, 52, 207, 220, 50, 151, 156, 49, 165, 225, 47, 147, 175, 46, 197, 130, 45, 205, 221, 43, 137, 189, 42, 175,
+    165, 41, 241, 144, 40, 139, 131, 39, 223, 250, 37, 215, 245, 36, 149, 246, 35, 153, 253, 34, 161, 132, 34, 141, 148,
+    33, 161, 251, 159, 245, 212, 112, 195, 220, 152, 139, 174, 168, 6, 141, 166, 61, 155, 224, 59, 213, 158, 58, 227,
+    227, 56, 183, 175, 55, 145, 134, 54, 153, 214, 52, 135, 186, 51, 173, 151, 50, 205, 255, 48, 189, 238, 47, 247, 216,
+    46, 231, 210, 45, 187, 202, 44, 217, 200, 43, 255, 198, 42, 131, 206, 41, 137, 213, 40, 223, 226, 39, 201, 242, 38,
+    185, 130, 38, 137, 155, 37, 195, 177, 36, 225, 208, 35, 207, 235, 34, 161, 143, 34, 241, 178, 33, 223, 216, 32, 251,
+    130, 32, 157, 173, 31, 209, 217, 30, 215, 140, 30, 169, 187, 29, 199, 240, 28, 255, 167, 28, 153, 221, 27, 135, 153,
+    27, 215, 210, 26, 243, 146, 26, 249, 208, 25, 251, 142, 25, 229, 213, 24, 231, 147, 24, 135, 223, 23, 189, 161, 23,
+    215, 236, 22, 221, 181, 22, 197, 252, 21, 175, 206, 21, 177, 151, 21, 131, 231, 20, 233, 184, 20, 159, 134, 20, 165,
+    218, 19, 163, 174, 19, 247, 253, 18, 193, 216, 18, 175, 170, 18, 251, 132, 18, 255, 216, 17, 205, 179, 17, 131, 140,
+    17, 233, 232, 16, 163, 193, 16, 161, 160, 16, 241, 250, 15, 141, 220, 15, 193, 180, 15, 249, 151, 15, 247, 246, 14,
+    251, 213, 14, 177, 185, 14, 175, 152, 14, 129, 254, 13, 155, 223, 13, 181, 192, 13, 185, 170, 13, 185, 137, 13, 161,
+    241, 12, 239, 214, 12, 217, 190, 12, 139, 162, 12, 141, 140, 12, 221, 241, 11, 245, 221, 11, 199, 195, 11, 171, 171,
+    11, 223, 153, 11, 177, 255, 10, 201, 235, 10, 229, 215, 10, 205, 191, 10, 255, 173, 10, 155, 154, 10, 157, 132, 10,
+    233, 244, 9, 237, 222, 9, 159, 205, 9, 185, 185, 9, 137, 170, 9, 189, 152, 9, 213, 132, 9, 165, 245, 8, 243, 229, 8,
+    167, 212, 8, 217, 194, 8, 193, 181, 8, 145, 166, 8, 195, 148, 8, 171, 135, 8, 223, 245, 7, 225, 234, 7, 197, 221, 7,
+    225, 201, 7, 253, 192, 7, 201, 177, 7, 175, 164, 7, 179, 153, 7, 227, 135, 7, 129, 255, 6, 231, 241, 6, 203, 228, 6,
+    209, 217, 6, 181, 204, 6, 181, 193, 6, 183, 182, 6, 183, 171, 6, 157, 158, 6, 161, 147, 6, 185, 138, 6, 185, 255, 5,
+    187, 244, 5, 187, 233, 5, 213, 224, 5, 189, 211, 5, 137, 207, 5, 215, 191, 5, 137, 185, 5, 167, 176, 5, 139, 163, 5,
+    215, 158, 5, 181, 233, 190, 238, 148, 214, 11, 191, 205, 214, 167, 241, 219, 2, 231, 255, 9, 211, 242, 9, 183, 229,
+    9, 135, 203, 9, 159, 194, 9, 161, 172, 9, 189, 163, 9, 187, 141, 9, 243, 251, 8, 137, 243, 8, 141, 221, 8, 167, 212,
+    8, 217, 194, 8, 145, 177, 8, 245, 163, 8, 143, 155, 8, 147, 133, 8, 169, 252, 7, 227, 234, 7, 195, 221, 7, 227, 212,
+    7, 149, 195, 7, 253, 181, 7, 149, 173, 7, 151, 151, 7, 153, 151, 7, 151, 129, 7, 181, 248, 6, 229, 230, 6, 233, 230,
+    6, 231, 208, 6, 209, 195, 6, 155, 191, 6, 133, 178, 6, 233, 164, 6, 211, 151, 6, 237, 142, 6, 133, 134, 6, 237, 248,
+    5, 213, 235, 5, 163, 231, 5, 213, 213, 5, 239, 204, 5, 189, 200, 5, 241, 182, 5, 191, 178, 5, 165, 165, 5, 139, 152,
+    5, 219, 147, 5, 243, 138, 5, 219, 253, 4, 245, 244, 4, 143, 236, 4, 169, 227, 4, 195, 218, 4, 169, 205, 4, 249, 200,
+    4, 223, 187, 4, 171, 183, 4, 197, 174, 4, 173, 161, 4, 249, 156, 4, 227, 143, 4, 173, 139, 4, 199, 130, 4, 229, 249,
+    3, 249, 240, 3, 153, 232, 3, 175, 223, 3, 197, 254, 229, 174, 151, 239, 18, 143, 138, 255, 128, 245, 244, 9, 203,
+    155, 7, 177, 248, 6, 207, 239, 6, 231, 230, 6, 155, 213, 6, 207, 195, 6, 133, 178, 6, 155, 169, 6, 213, 151, 6, 159,
+    253, 5, 135, 134, 6, 237, 226, 5, 137, 218, 5, 163, 209, 5, 217, 191, 5, 137, 174, 5, 165, 165, 5, 219, 147, 5, 243,
+    138, 5, 193, 240, 4, 195, 240, 4, 247, 222, 4, 195, 196, 4, 169, 205, 4, 251, 178, 4, 171, 161, 4, 201, 152, 4, 223,
+    143, 4, 253, 134, 4, 225, 227, 3, 203, 236, 3, 253, 218, 3, 205, 192, 3, 171, 249, 135, 134, 145, 189, 4, 189, 160,
+    240, 218, 135, 139, 53, 131, 222, 6, 207, 151, 6, 161, 169, 6, 185, 244, 5, 237, 226, 5, 165, 209, 5, 191, 156, 5,
+    139, 174, 5, 167, 249, 4, 145, 214, 4, 219, 231, 4, 175, 161, 4, 171, 161, 4, 225, 143, 4, 253, 218, 3, 255, 218, 3,
+    211, 220, 201, 178, 157, 161, 33, 203, 133, 248, 143, 148, 239, 81, 133, 134, 6, 239, 226, 5, 215, 191, 5, 193, 156,
+    5, 247, 178, 4, 249, 178, 4, 201, 236, 3, 215, 215, 244, 146, 182, 233, 90, 157, 225, 177, 242, 172, 183, 139, 1,
+    133, 134, 6, 249, 178, 4, 249, 178, 4, 237, 188, 213, 218, 202, 154, 180, 3, 151, 148, 133, 176, 251, 166, 24, 217,
+    165, 253, 223, 173, 187, 154, 5, 209, 238, 170, 245, 185, 190, 179, 12,
+    // N512 (TL1023)
+    166, 147, 232, 232, 143, 217, 187, 214, 128, 1, 145, 138, 132, 194, 222, 162, 193, 214, 128, 1, 193, 159, 228, 182,
+    155, 4, 249, 193, 206, 240, 121, 151, 151, 215, 157, 46, 221, 160, 202, 175, 22, 225, 206, 170, 192, 12, 179, 236,
+    154, 216, 7, 193, 230, 148, 136, 5, 181, 180, 176, 193, 3, 137, 195, 166, 196, 2, 243, 148, 215, 241, 1, 189, 202,
+    245, 184, 1, 145, 172, 209, 144, 1, 171, 251, 160, 115, 179, 148, 170, 93, 131, 222, 208, 76, 167, 183, 216, 63,
+    203, 140, 193, 53, 243, 188, 177, 45, 133, 141, 234, 38, 147, 254, 188, 33, 217, 157, 136, 29, 177, 196, 178, 25,
+    151, 220, 168, 22, 139, 132, 220, 19, 139, 137, 193, 17, 185, 241, 206, 15, 217, 173, 254, 13, 137, 242, 201, 12,
+    255, 238, 172, 11, 141, 208, 163, 10, 169, 146, 171, 9, 231, 245, 192, 8, 143, 249, 226, 7, 137, 188, 143, 7, 153,
+    137, 197, 6, 217, 199, 130, 6, 239, 246, 198, 5, 157, 162, 145, 5, 225, 241, 224, 4, 139, 147, 181, 4, 205, 190,
+    141, 4, 163, 187, 233, 3, 131, 210, 200, 3, 183, 220, 170, 3, 139, 170, 143, 3, 183, 158, 246, 2, 219, 155, 223, 2,
+    183, 133, 202, 2, 159, 194, 182, 2, 251, 196, 164, 2, 141, 242, 147, 2, 215, 190, 132, 2, 179, 156, 246, 1, 249,
+    252, 232, 1, 147, 211, 220, 1, 193, 153, 209, 1, 203, 192, 198, 1, 165, 198, 188, 1, 167, 157, 179, 1, 189, 195,
+    170, 1, 139, 176, 162, 1, 189, 221, 154, 1, 181, 199, 147, 1, 177, 233, 140, 1, 145, 192, 134, 1, 153, 198, 128, 1,
+    129, 246, 122, 243, 210, 117, 139, 212, 112, 199, 249, 107, 231, 189, 103, 147, 164, 99, 255, 165, 95, 163, 195, 91,
+    229, 248, 87, 177, 197, 84, 163, 171, 81, 199, 160, 78, 141, 175, 75, 251, 203, 72, 181, 250, 69, 173, 185, 67, 243,
+    137, 65, 157, 227, 62, 159, 207, 60, 161, 198, 58, 151, 199, 56, 165, 213, 54, 191, 239, 52, 163, 144, 51, 165, 190,
+    49, 225, 241, 47, 161, 176, 46, 185, 246, 44, 155, 195, 43, 231, 152, 42, 249, 244, 40, 211, 214, 39, 245, 190, 38,
+    237, 174, 37, 145, 162, 36, 255, 155, 35, 173, 155, 34, 243, 156, 33, 173, 168, 32, 219, 178, 31, 225, 196, 30, 129,
+    217, 29, 237, 243, 28, 203, 141, 28, 145, 176, 27, 215, 210, 26, 195, 248, 25, 235, 163, 25, 155, 207, 24, 143, 129,
+    24, 227, 175, 23, 165, 232, 22, 197, 157, 22, 147, 215, 21, 151, 149, 21, 133, 209, 20, 171, 146, 20, 227, 212, 19,
+    181, 153, 19, 155, 224, 18, 251, 165, 18, 149, 241, 17, 179, 188, 17, 223, 136, 17, 169, 216, 16, 253, 167, 16, 215,
+    248, 15, 207, 203, 15, 219, 160, 15, 225, 244, 14, 135, 204, 14, 189, 164, 14, 231, 251, 13, 181, 214, 13, 145, 178,
+    13, 235, 141, 13, 215, 234, 12, 213, 201, 12, 203, 167, 12, 221, 135, 12, 161, 181, 197, 231, 228, 167, 4, 217, 152,
+    161, 148, 238, 167, 1, 141, 219, 22, 221, 159, 22, 199, 230, 21, 225, 177, 21, 207, 248, 20, 183, 202, 20, 183, 147,
+    20, 139, 227, 19, 215, 178, 19, 193, 132, 19, 171, 214, 18, 171, 170, 18, 203, 128, 18, 177, 210, 17, 205, 168, 17,
+    183, 133, 17, 185, 217, 16, 135, 180, 16, 215, 142, 16, 191, 235, 15, 141, 198, 15, 221, 160, 15, 249, 129, 15, 249,
+    224, 14, 227, 189, 14, 253, 158, 14, 153, 128, 14, 157, 223, 13, 231, 196, 13, 133, 166, 13, 187, 137, 13, 135, 239,
+    12, 163, 208, 12, 163, 186, 12, 193, 155, 12, 193, 133, 12, 143, 235, 11, 223, 208, 11, 247, 188, 11, 199, 162, 11,
+    199, 140, 11, 175, 244, 10, 229, 226, 10, 179, 200, 10, 203, 180, 10, 233, 160, 10, 231, 138, 10, 159, 249, 9, 183,
+    229, 9, 211, 209, 9, 235, 189, 9, 163, 172, 9, 215, 154, 9, 161, 139, 9, 165, 245, 8, 141, 232, 8, 165, 212, 8, 141,
+    199, 8, 195, 181, 8, 143, 166, 8, 221, 150, 8, 197, 137, 8, 221, 245, 7, 225, 234, 7, 199, 221, 7, 251, 203, 7, 149,
+    195, 7, 175, 175, 7, 203, 166, 7, 175, 153, 7, 129, 138, 7, 255, 254, 6, 255, 243, 6, 205, 228, 6, 233, 219, 6, 207,
+    206, 6, 207, 195, 6, 207, 184, 6, 209, 173, 6, 185, 160, 6, 211, 151, 6, 209, 140, 6, 237, 131, 6, 237, 248, 5, 213,
+    235, 5, 161, 231, 5, 239, 215, 5, 189, 211, 5, 163, 198, 5, 217, 191, 5, 239, 182, 5, 241, 171, 5, 141, 163, 5, 191,
+    156, 5, 193, 145, 5, 243, 138, 5, 167, 132, 5, 143, 247, 4, 243, 244, 4, 247, 233, 4, 143, 225, 4, 221, 220, 4, 247,
+    211, 4, 145, 203, 4, 221, 198, 4, 223, 187, 4, 197, 185, 4, 197, 174, 4, 249, 167, 4, 225, 165, 4, 223, 154, 4, 149,
+    148, 4, 225, 143, 4, 149, 137, 4, 199, 130, 4, 253, 251, 3, 199, 247, 3, 229, 238, 3, 173, 234, 3, 255, 229, 3, 177,
+    223, 3, 227, 216, 3, 177, 212, 3, 229, 205, 3, 179, 201, 3, 253, 196, 3, 155, 188, 3, 151, 188, 3, 181, 179, 3, 255,
+    174, 3, 205, 170, 3, 129, 164, 3, 231, 161, 3, 179, 157, 3, 233, 150, 3, 183, 146, 3, 255, 141, 3, 209, 137, 3, 155,
+    133, 3, 233, 128, 3, 183, 252, 2, 155, 250, 2, 185, 241, 2, 181, 241, 2, 235, 234, 2, 235, 234, 2, 235, 223, 2, 131,
+    226, 2, 211, 221, 2, 133, 215, 2, 209, 210, 2, 211, 210, 2, 133, 204, 2, 237, 201, 2, 211, 199, 2, 135, 193, 2, 209,
+    188, 2, 213, 188, 2, 161, 184, 2, 133, 182, 2, 189, 175, 2, 159, 173, 2, 137, 171, 2, 237, 168, 2, 163, 162, 2, 161,
+    162, 2, 239, 157, 2, 187, 153, 2, 189, 153, 2, 135, 149, 2, 215, 144, 2, 215, 144, 2, 135, 138, 2, 139, 138, 2, 215,
+    133, 2, 213, 133, 2, 139, 255, 1, 139, 255, 1, 215, 250, 1, 213, 250, 1, 153, 148, 177, 189, 203, 143, 7, 179, 208,
+    176, 196, 218, 143, 4, 231, 227, 3, 251, 218, 3, 203, 214, 3, 153, 210, 3, 151, 210, 3, 253, 196, 3, 129, 197, 3,
+    203, 192, 3, 231, 183, 3, 153, 188, 3, 203, 170, 3, 131, 175, 3, 203, 170, 3, 233, 161, 3, 179, 157, 3, 179, 157, 3,
+    209, 148, 3, 205, 148, 3, 233, 139, 3, 233, 139, 3, 129, 131, 3, 131, 131, 3, 209, 254, 2, 233, 245, 2, 233, 245, 2,
+    235, 245, 2, 209, 232, 2, 131, 237, 2, 157, 228, 2, 237, 223, 2, 233, 223, 2, 185, 219, 2, 135, 215, 2, 207, 210, 2,
+    161, 206, 2, 235, 201, 2, 237, 201, 2, 187, 197, 2, 133, 193, 2, 211, 188, 2, 211, 188, 2, 237, 179, 2, 239, 179, 2,
+    187, 175, 2, 185, 175, 2, 213, 166, 2, 135, 171, 2, 241, 157, 2, 159, 162, 2, 189, 153, 2, 239, 157, 2, 137, 149, 2,
+    213, 144, 2, 215, 144, 2, 213, 144, 2, 241, 135, 2, 189, 131, 2, 239, 135, 2, 189, 131, 2, 217, 250, 1, 213, 250, 1,
+    215, 250, 1, 165, 246, 1, 243, 241, 1, 187, 237, 1, 243, 241, 1, 139, 233, 1, 217, 228, 1, 139, 233, 1, 165, 224, 1,
+    243, 219, 1, 167, 224, 1, 241, 219, 1, 191, 215, 1, 141, 211, 1, 141, 211, 1, 217, 206, 1, 217, 206, 1, 219, 206, 1,
+    193, 193, 1, 165, 202, 1, 195, 193, 1, 191, 193, 1, 143, 189, 1, 141, 189, 1, 141, 189, 1, 169, 180, 1, 169, 180, 1,
+    245, 175, 1, 251, 130, 149, 144, 158, 223, 12, 215, 179, 132, 245, 173, 223, 9, 235, 223, 2, 187, 197, 2, 131, 215,
+    2, 185, 197, 2, 187, 197, 2, 211, 188, 2, 183, 197, 2, 139, 171, 2, 209, 188, 2, 137, 171, 2, 135, 171, 2, 161, 162,
+    2, 163, 162, 2, 161, 162, 2, 213, 144, 2, 189, 153, 2, 215, 144, 2, 213, 144, 2, 137, 255, 1, 241, 135, 2, 137, 255,
+    1, 139, 255, 1, 165, 246, 1, 189, 237, 1, 165, 246, 1, 215, 228, 1, 191, 237, 1, 243, 219, 1, 217, 228, 1, 241, 219,
+    1, 243, 219, 1, 167, 202, 1, 141, 211, 1, 165, 202, 1, 169, 202, 1, 191, 193, 1, 193, 193, 1, 221, 184, 1, 191, 193,
+    1, 143, 167, 1, 219, 184, 1, 245, 175, 1, 143, 167, 1, 241, 142, 157, 131, 248, 191, 1, 155, 179, 234, 135, 160,
+    189, 43, 213, 188, 2, 211, 188, 2, 187, 153, 2, 137, 171, 2, 135, 171, 2, 239, 135, 2, 189, 153, 2, 239, 135, 2,
+    165, 246, 1, 241, 135, 2, 215, 228, 1, 165, 246, 1, 215, 228, 1, 141, 211, 1, 141, 211, 1, 141, 211, 1, 141, 211, 1,
+    243, 175, 1, 195, 193, 1, 243, 175, 1, 247, 175, 1, 241, 188, 168, 134, 196, 254, 23, 189, 163, 142, 144, 236, 251,
+    65, 209, 188, 2, 165, 246, 1, 189, 153, 2, 187, 153, 2, 165, 246, 1, 139, 211, 1, 141, 211, 1, 141, 211, 1, 245,
+    175, 1, 245, 175, 1, 205, 235, 184, 167, 140, 246, 158, 1, 143, 196, 198, 133, 212, 254, 20, 233, 223, 2, 143, 211,
+    1, 141, 211, 1, 163, 142, 232, 144, 220, 251, 68, 251, 227, 157, 201, 228, 237, 162, 2, 221, 140, 1, 133, 190, 231,
+    189, 188, 240, 248, 1, 187, 166, 164, 246, 196, 226, 214, 3, 205, 171, 228, 227, 251, 134, 145, 15,
+    // N576 (TL1151)
+    204, 239, 202, 141, 167, 150, 188, 214, 128, 1, 129, 159, 173, 130, 213, 144, 193, 214, 128, 1, 135, 213, 159, 194,
+    223, 3, 149, 178, 251, 171, 108, 229, 142, 185, 140, 41, 201, 188, 197, 241, 19, 183, 152, 204, 142, 11, 175, 161,
+    243, 234, 6, 229, 191, 150, 192, 4, 143, 132, 188, 143, 3, 175, 158, 164, 160, 2, 235, 180, 235, 214, 1, 211, 227,
+    176, 164, 1, 171, 153, 201, 128, 1, 227, 186, 186, 102, 147, 177, 251, 82, 237, 172, 143, 68, 151, 128, 207, 56,
+    159, 180, 200, 47, 177, 162, 172, 40, 179, 142, 194, 34, 247, 137, 225, 29, 151, 135, 235, 25, 155, 195, 201, 22,
+    219, 185, 235, 19, 195, 217, 195, 17, 209, 149, 200, 15, 215, 241, 240, 13, 165, 195, 183, 12, 223, 139, 151, 11,
+    213, 192, 139, 10, 179, 193, 145, 9, 217, 180, 166, 8, 225, 253, 199, 7, 255, 184, 244, 6, 185, 159, 170, 6, 151,
+    141, 232, 5, 185, 255, 172, 5, 251, 249, 247, 4, 227, 164, 200, 4, 169, 161, 157, 4, 133, 178, 246, 3, 183, 143,
+    211, 3, 199, 141, 179, 3, 219, 248, 149, 3, 169, 169, 251, 2, 155, 252, 226, 2, 151, 217, 204, 2, 225, 153, 184, 2,
+    229, 177, 165, 2, 245, 133, 148, 2, 191, 133, 132, 2, 149, 160, 245, 1, 219, 201, 231, 1, 201, 239, 218, 1, 153,
+    141, 207, 1, 173, 147, 196, 1, 169, 251, 185, 1, 173, 188, 176, 1, 213, 205, 167, 1, 235, 170, 159, 1, 139, 203,
+    151, 1, 149, 172, 144, 1, 191, 198, 137, 1, 207, 150, 131, 1, 165, 152, 125, 151, 201, 119, 217, 161, 114, 139, 165,
+    109, 199, 202, 104, 153, 147, 100, 209, 250, 95, 225, 255, 91, 201, 162, 88, 177, 219, 84, 201, 174, 81, 209, 150,
+    78, 235, 149, 75, 201, 166, 72, 133, 202, 69, 139, 255, 66, 207, 196, 64, 199, 153, 62, 217, 251, 59, 153, 237, 57,
+    195, 231, 55, 169, 242, 53, 133, 135, 52, 183, 163, 50, 145, 206, 48, 181, 255, 46, 219, 187, 45, 203, 254, 43, 163,
+    202, 42, 225, 158, 41, 207, 247, 39, 165, 217, 38, 211, 194, 37, 185, 176, 36, 201, 162, 35, 199, 157, 34, 243, 156,
+    33, 187, 158, 32, 231, 168, 31, 189, 182, 30, 155, 197, 29, 237, 221, 28, 193, 246, 27, 185, 146, 27, 255, 180, 26,
+    209, 216, 25, 213, 128, 25, 245, 170, 24, 199, 217, 23, 161, 137, 23, 183, 189, 22, 211, 242, 21, 163, 172, 21, 245,
+    229, 20, 235, 162, 20, 149, 228, 19, 193, 165, 19, 231, 230, 18, 225, 174, 18, 203, 245, 17, 189, 189, 17, 235, 137,
+    17, 159, 215, 16, 187, 162, 16, 177, 245, 15, 131, 197, 15, 245, 151, 15, 251, 235, 14, 135, 193, 14, 167, 151, 14,
+    215, 239, 13, 159, 201, 13, 221, 162, 13, 173, 253, 12, 151, 218, 12, 137, 184, 12, 245, 148, 12, 129, 245, 11, 145,
+    213, 11, 173, 182, 11, 197, 151, 11, 253, 250, 10, 165, 221, 10, 227, 193, 10, 183, 167, 10, 129, 141, 10, 221, 243,
+    9, 173, 217, 9, 159, 194, 9, 135, 170, 9, 139, 148, 9, 239, 251, 8, 245, 229, 8, 151, 211, 8, 131, 187, 8, 181, 169,
+    8, 183, 147, 8, 235, 129, 8, 133, 238, 7, 187, 220, 7, 213, 200, 7, 167, 140, 128, 188, 223, 177, 1, 239, 235, 241,
+    249, 252, 205, 3, 149, 172, 14, 179, 141, 14, 179, 236, 13, 183, 203, 13, 157, 179, 13, 235, 141, 13, 239, 247, 12,
+    239, 214, 12, 191, 188, 12, 139, 162, 12, 193, 133, 12, 169, 237, 11, 145, 213, 11, 221, 186, 11, 175, 160, 11, 199,
+    140, 11, 175, 244, 10, 179, 222, 10, 253, 195, 10, 205, 180, 10, 157, 154, 10, 181, 134, 10, 207, 242, 9, 135, 225,
+    9, 235, 200, 9, 187, 185, 9, 213, 165, 9, 239, 145, 9, 189, 130, 9, 193, 236, 8, 189, 225, 8, 193, 203, 8, 143, 188,
+    8, 219, 172, 8, 143, 155, 8, 249, 141, 8, 197, 254, 7, 247, 236, 7, 201, 221, 7, 223, 212, 7, 253, 192, 7, 227, 179,
+    7, 225, 168, 7, 179, 153, 7, 177, 142, 7, 231, 252, 6, 151, 246, 6, 209, 228, 6, 229, 219, 6, 207, 206, 6, 183, 193,
+    6, 207, 184, 6, 185, 171, 6, 183, 160, 6, 185, 149, 6, 209, 140, 6, 187, 255, 5, 211, 246, 5, 213, 235, 5, 215, 224,
+    5, 135, 218, 5, 137, 207, 5, 137, 196, 5, 165, 187, 5, 191, 178, 5, 217, 169, 5, 241, 160, 5, 139, 152, 5, 143, 141,
+    5, 217, 136, 5, 245, 255, 4, 245, 244, 4, 169, 238, 4, 219, 231, 4, 245, 222, 4, 147, 214, 4, 193, 207, 4, 249, 200,
+    4, 145, 192, 4, 223, 187, 4, 221, 176, 4, 201, 174, 4, 195, 163, 4, 251, 156, 4, 225, 154, 4, 225, 143, 4, 173, 139,
+    4, 227, 132, 4, 149, 254, 3, 201, 247, 3, 149, 243, 3, 201, 236, 3, 151, 232, 3, 151, 221, 3, 151, 221, 3, 203, 214,
+    3, 253, 207, 3, 179, 201, 3, 153, 199, 3, 177, 190, 3, 153, 188, 3, 205, 181, 3, 155, 177, 3, 203, 170, 3, 181, 168,
+    3, 229, 161, 3, 183, 157, 3, 129, 153, 3, 205, 148, 3, 155, 144, 3, 209, 137, 3, 181, 135, 3, 129, 131, 3, 209, 254,
+    2, 157, 250, 2, 209, 243, 2, 207, 243, 2, 157, 239, 2, 183, 230, 2, 185, 230, 2, 157, 228, 2, 185, 219, 2, 183, 219,
+    2, 133, 215, 2, 185, 208, 2, 211, 210, 2, 209, 199, 2, 135, 204, 2, 135, 193, 2, 159, 195, 2, 211, 188, 2, 211, 188,
+    2, 239, 179, 2, 135, 182, 2, 185, 175, 2, 161, 173, 2, 137, 171, 2, 213, 166, 2, 185, 164, 2, 137, 160, 2, 137, 160,
+    2, 187, 153, 2, 163, 151, 2, 163, 151, 2, 213, 144, 2, 213, 144, 2, 165, 140, 2, 161, 140, 2, 215, 133, 2, 191, 131,
+    2, 187, 131, 2, 163, 129, 2, 217, 250, 1, 213, 250, 1, 191, 248, 1, 165, 246, 1, 241, 241, 1, 215, 239, 1, 215, 239,
+    1, 141, 233, 1, 163, 235, 1, 141, 233, 1, 191, 226, 1, 191, 226, 1, 163, 224, 1, 143, 222, 1, 139, 222, 1, 191, 215,
+    1, 191, 215, 1, 193, 215, 1, 139, 211, 1, 219, 206, 1, 141, 211, 1, 165, 202, 1, 193, 204, 1, 167, 202, 1, 243, 197,
+    1, 245, 197, 1, 217, 195, 1, 219, 195, 1, 141, 189, 1, 169, 191, 1, 243, 186, 1, 245, 186, 1, 219, 184, 1, 217, 184,
+    1, 145, 178, 1, 167, 180, 1, 143, 178, 1, 243, 175, 1, 221, 173, 1, 219, 173, 1, 195, 171, 1, 143, 167, 1, 169, 169,
+    1, 243, 164, 1, 249, 164, 1, 217, 162, 1, 223, 162, 1, 167, 158, 1, 197, 160, 1, 141, 156, 1, 247, 153, 1, 147, 167,
+    135, 184, 203, 241, 3, 179, 132, 250, 186, 237, 141, 6, 237, 179, 2, 135, 171, 2, 213, 166, 2, 211, 166, 2, 165,
+    162, 2, 237, 157, 2, 161, 162, 2, 189, 153, 2, 135, 149, 2, 189, 153, 2, 215, 144, 2, 213, 144, 2, 163, 140, 2, 213,
+    144, 2, 191, 131, 2, 237, 135, 2, 191, 131, 2, 189, 131, 2, 215, 250, 1, 139, 255, 1, 215, 250, 1, 163, 246, 1, 215,
+    250, 1, 191, 237, 1, 241, 241, 1, 191, 237, 1, 189, 237, 1, 191, 237, 1, 217, 228, 1, 215, 228, 1, 219, 228, 1, 163,
+    224, 1, 167, 224, 1, 163, 224, 1, 193, 215, 1, 193, 215, 1, 189, 215, 1, 193, 215, 1, 141, 211, 1, 217, 206, 1, 217,
+    206, 1, 169, 202, 1, 215, 206, 1, 167, 202, 1, 195, 193, 1, 165, 202, 1, 193, 193, 1, 193, 193, 1, 141, 189, 1, 143,
+    189, 1, 191, 193, 1, 171, 180, 1, 217, 184, 1, 219, 184, 1, 167, 180, 1, 247, 175, 1, 167, 180, 1, 193, 171, 1, 247,
+    175, 1, 193, 171, 1, 143, 167, 1, 193, 171, 1, 145, 167, 1, 219, 162, 1, 145, 167, 1, 167, 158, 1, 221, 162, 1, 245,
+    153, 1, 223, 162, 1, 193, 149, 1, 169, 158, 1, 197, 149, 1, 245, 153, 1, 145, 145, 1, 195, 149, 1, 143, 145, 1, 147,
+    145, 1, 219, 140, 1, 223, 140, 1, 143, 145, 1, 249, 131, 1, 221, 140, 1, 171, 136, 1, 245, 131, 1, 173, 136, 1, 195,
+    127, 249, 131, 1, 195, 127, 147, 123, 247, 131, 1, 223, 118, 195, 127, 223, 118, 223, 118, 223, 118, 147, 123, 247,
+    109, 171, 114, 225, 118, 195, 105, 173, 114, 129, 219, 191, 192, 224, 240, 18, 159, 222, 218, 166, 145, 142, 1, 169,
+    202, 1, 241, 219, 1, 167, 202, 1, 141, 211, 1, 167, 202, 1, 167, 202, 1, 191, 193, 1, 167, 202, 1, 195, 193, 1, 217,
+    184, 1, 193, 193, 1, 219, 184, 1, 219, 184, 1, 219, 184, 1, 245, 175, 1, 245, 175, 1, 243, 175, 1, 145, 167, 1, 245,
+    175, 1, 143, 167, 1, 145, 167, 1, 167, 158, 1, 169, 158, 1, 169, 158, 1, 171, 158, 1, 167, 158, 1, 223, 140, 1, 169,
+    158, 1, 221, 140, 1, 195, 149, 1, 223, 140, 1, 245, 131, 1, 197, 149, 1, 247, 131, 1, 247, 131, 1, 249, 131, 1, 247,
+    131, 1, 145, 123, 145, 123, 147, 123, 145, 123, 145, 123, 173, 114, 197, 105, 145, 123, 199, 105, 197, 105, 199,
+    105, 197, 105, 255, 180, 159, 172, 153, 240, 28, 173, 153, 209, 162, 202, 141, 11, 191, 193, 1, 195, 193, 1, 243,
+    175, 1, 195, 193, 1, 243, 175, 1, 245, 175, 1, 169, 158, 1, 247, 175, 1, 167, 158, 1, 247, 175, 1, 221, 140, 1, 219,
+    140, 1, 171, 158, 1, 223, 140, 1, 143, 123, 171, 158, 1, 197, 105, 221, 140, 1, 145, 123, 147, 123, 197, 105, 199,
+    105, 197, 105, 183, 150, 237, 194, 167, 241, 8, 223, 236, 142, 219, 159, 138, 71, 163, 246, 1, 223, 140, 1, 243,
+    175, 1, 247, 175, 1, 243, 175, 1, 223, 140, 1, 197, 105, 245, 175, 1, 199, 105, 221, 140, 1, 197, 105, 157, 188,
+    175, 145, 139, 239, 48, 229, 191, 213, 170, 131, 136, 111, 141, 211, 1, 141, 211, 1, 173, 70, 143, 211, 1, 171, 70,
+    175, 141, 171, 235, 224, 225, 160, 2, 177, 170, 228, 140, 188, 140, 31, 189, 153, 2, 255, 194, 175, 167, 239, 216,
+    192, 3, 191, 196, 144, 248, 156, 238, 191, 2, 255, 231, 222, 208, 173, 149, 255, 14,
+    // N640 (TL1279)
+    150, 224, 217, 223, 160, 199, 188, 214, 128, 1, 219, 151, 138, 133, 154, 130, 193, 214, 128, 1, 205, 243, 232, 202,
+    175, 3, 255, 229, 218, 193, 97, 239, 215, 205, 254, 36, 143, 161, 139, 243, 17, 231, 137, 178, 128, 10, 191, 245,
+    184, 147, 6, 195, 169, 202, 134, 4, 171, 232, 196, 231, 2, 199, 214, 187, 131, 2, 249, 195, 174, 193, 1, 141, 195,
+    249, 147, 1, 215, 143, 220, 115, 141, 196, 155, 92, 205, 236, 213, 74, 231, 225, 167, 61, 135, 203, 250, 50, 225,
+    230, 231, 42, 143, 134, 168, 36, 143, 188, 136, 31, 253, 168, 228, 26, 215, 190, 160, 23, 131, 215, 168, 20, 237,
+    203, 237, 17, 189, 183, 227, 15, 223, 132, 129, 14, 241, 160, 191, 12, 173, 184, 152, 11, 185, 132, 136, 10, 157,
+    181, 138, 9, 131, 205, 156, 8, 173, 154, 188, 7, 249, 157, 231, 6, 235, 132, 156, 6, 145, 160, 217, 5, 193, 220,
+    157, 5, 147, 194, 232, 4, 161, 229, 184, 4, 153, 241, 141, 4, 191, 147, 231, 3, 163, 150, 196, 3, 205, 183, 164, 3,
+    209, 205, 135, 3, 219, 175, 237, 2, 253, 178, 213, 2, 157, 191, 191, 2, 241, 183, 171, 2, 179, 129, 153, 2, 255,
+    134, 136, 2, 149, 185, 248, 1, 189, 135, 234, 1, 149, 222, 220, 1, 195, 182, 208, 1, 153, 128, 197, 1, 179, 179,
+    186, 1, 147, 197, 176, 1, 151, 178, 167, 1, 239, 232, 158, 1, 205, 237, 150, 1, 173, 180, 143, 1, 209, 184, 136, 1,
+    129, 245, 129, 1, 159, 231, 123, 217, 135, 118, 177, 215, 112, 225, 207, 107, 187, 236, 102, 179, 173, 98, 209, 146,
+    94, 137, 144, 90, 215, 176, 86, 165, 231, 82, 177, 185, 79, 159, 159, 76, 171, 157, 73, 165, 176, 70, 223, 211, 67,
+    231, 136, 65, 207, 209, 62, 201, 166, 60, 241, 138, 58, 195, 253, 55, 169, 253, 53, 143, 136, 52, 147, 160, 50, 235,
+    191, 48, 221, 236, 46, 181, 162, 45, 219, 222, 43, 151, 168, 42, 137, 246, 40, 209, 203, 39, 131, 170, 38, 253, 142,
+    37, 199, 250, 35, 193, 234, 34, 151, 226, 33, 169, 223, 32, 241, 224, 31, 249, 231, 30, 167, 242, 29, 183, 133, 29,
+    191, 151, 28, 145, 176, 27, 163, 206, 26, 197, 237, 25, 147, 145, 25, 141, 184, 24, 199, 228, 23, 239, 143, 23, 219,
+    192, 22, 237, 244, 21, 137, 170, 21, 221, 227, 20, 171, 157, 20, 175, 219, 19, 205, 155, 19, 247, 220, 18, 185, 160,
+    18, 165, 231, 17, 141, 174, 17, 171, 249, 16, 173, 194, 16, 239, 144, 16, 179, 223, 15, 143, 176, 15, 249, 129, 15,
+    225, 211, 14, 253, 169, 14, 255, 253, 13, 181, 214, 13, 247, 175, 13, 161, 135, 13, 253, 226, 12, 213, 190, 12, 205,
+    156, 12, 169, 248, 11, 195, 217, 11, 197, 184, 11, 199, 151, 11, 137, 252, 10, 163, 221, 10, 205, 191, 10, 155, 165,
+    10, 221, 137, 10, 157, 238, 9, 133, 214, 9, 223, 188, 9, 189, 163, 9, 177, 140, 9, 163, 245, 8, 153, 222, 8, 181,
+    202, 8, 155, 178, 8, 195, 159, 8, 221, 139, 8, 223, 245, 7, 147, 228, 7, 175, 208, 7, 239, 191, 7, 137, 172, 7, 201,
+    155, 7, 141, 139, 7, 193, 249, 6, 139, 234, 6, 219, 218, 6, 157, 202, 6, 233, 186, 6, 209, 173, 6, 171, 159, 6, 249,
+    143, 6, 237, 131, 6, 185, 244, 5, 189, 233, 5, 161, 220, 5, 137, 207, 5, 255, 194, 5, 253, 183, 5, 227, 170, 5, 245,
+    160, 5, 229, 148, 5, 243, 138, 5, 233, 254, 4, 243, 244, 4, 235, 185, 213, 148, 161, 198, 3, 217, 168, 224, 130,
+    194, 121, 215, 176, 9, 187, 152, 9, 163, 139, 9, 165, 245, 8, 217, 227, 8, 141, 210, 8, 217, 194, 8, 145, 177, 8,
+    193, 159, 8, 145, 144, 8, 197, 254, 7, 199, 243, 7, 197, 221, 7, 225, 212, 7, 151, 195, 7, 249, 181, 7, 205, 166, 7,
+    175, 153, 7, 153, 140, 7, 255, 254, 6, 231, 241, 6, 205, 228, 6, 205, 217, 6, 183, 204, 6, 131, 189, 6, 183, 182, 6,
+    157, 169, 6, 159, 158, 6, 235, 142, 6, 187, 138, 6, 133, 251, 5, 161, 242, 5, 163, 231, 5, 161, 220, 5, 189, 211, 5,
+    213, 202, 5, 217, 191, 5, 215, 180, 5, 163, 176, 5, 245, 160, 5, 189, 156, 5, 193, 145, 5, 219, 136, 5, 139, 130, 5,
+    145, 247, 4, 193, 240, 4, 221, 231, 4, 141, 225, 4, 173, 216, 4, 219, 209, 4, 221, 198, 4, 173, 194, 4, 221, 187, 4,
+    225, 176, 4, 197, 174, 4, 197, 163, 4, 251, 156, 4, 223, 154, 4, 201, 141, 4, 199, 141, 4, 175, 128, 4, 175, 128, 4,
+    199, 247, 3, 229, 238, 3, 201, 236, 3, 251, 229, 3, 179, 223, 3, 227, 216, 3, 177, 212, 3, 255, 207, 3, 151, 199, 3,
+    255, 196, 3, 181, 190, 3, 253, 185, 3, 153, 177, 3, 155, 177, 3, 205, 170, 3, 129, 164, 3, 205, 159, 3, 155, 155, 3,
+    233, 150, 3, 179, 146, 3, 131, 142, 3, 207, 137, 3, 131, 131, 3, 231, 128, 3, 185, 252, 2, 129, 248, 2, 211, 243, 2,
+    129, 237, 2, 133, 237, 2, 183, 230, 2, 159, 228, 2, 235, 223, 2, 183, 219, 2, 133, 215, 2, 237, 212, 2, 183, 208, 2,
+    135, 204, 2, 235, 201, 2, 187, 197, 2, 159, 195, 2, 211, 188, 2, 237, 190, 2, 237, 179, 2, 161, 184, 2, 187, 175, 2,
+    187, 175, 2, 133, 171, 2, 215, 166, 2, 213, 166, 2, 135, 160, 2, 137, 160, 2, 237, 157, 2, 163, 151, 2, 139, 149, 2,
+    135, 149, 2, 189, 142, 2, 187, 142, 2, 165, 140, 2, 239, 135, 2, 215, 133, 2, 163, 129, 2, 163, 129, 2, 139, 255, 1,
+    215, 250, 1, 189, 248, 1, 165, 246, 1, 139, 244, 1, 241, 241, 1, 189, 237, 1, 193, 237, 1, 163, 235, 1, 241, 230, 1,
+    243, 230, 1, 191, 226, 1, 191, 226, 1, 139, 222, 1, 141, 222, 1, 217, 217, 1, 217, 217, 1, 191, 215, 1, 141, 211, 1,
+    141, 211, 1, 243, 208, 1, 217, 206, 1, 193, 204, 1, 191, 204, 1, 245, 197, 1, 141, 200, 1, 243, 197, 1, 193, 193, 1,
+    219, 195, 1, 141, 189, 1, 167, 191, 1, 245, 186, 1, 245, 186, 1, 217, 184, 1, 221, 184, 1, 141, 178, 1, 169, 180, 1,
+    143, 178, 1, 243, 175, 1, 247, 175, 1, 193, 171, 1, 193, 171, 1, 171, 169, 1, 167, 169, 1, 143, 167, 1, 247, 164, 1,
+    219, 162, 1, 219, 162, 1, 197, 160, 1, 193, 160, 1, 171, 158, 1, 245, 153, 1, 169, 158, 1, 221, 151, 1, 221, 151, 1,
+    221, 151, 1, 219, 151, 1, 147, 145, 1, 193, 149, 1, 145, 145, 1, 247, 142, 1, 249, 142, 1, 141, 145, 1, 173, 136, 1,
+    245, 142, 1, 171, 136, 1, 197, 138, 1, 143, 134, 1, 147, 134, 1, 145, 134, 1, 143, 134, 1, 197, 127, 249, 131, 1,
+    221, 129, 1, 171, 125, 197, 127, 197, 127, 247, 120, 171, 125, 147, 123, 221, 118, 249, 120, 249, 120, 195, 116,
+    199, 116, 197, 116, 197, 116, 145, 112, 173, 114, 249, 109, 171, 114, 223, 107, 249, 109, 249, 109, 197, 105, 225,
+    107, 171, 103, 223, 107, 147, 101, 199, 105, 145, 101, 229, 149, 141, 223, 173, 166, 1, 237, 131, 255, 212, 152,
+    217, 7, 247, 197, 1, 191, 193, 1, 243, 197, 1, 193, 193, 1, 193, 193, 1, 143, 189, 1, 191, 193, 1, 169, 180, 1, 193,
+    193, 1, 169, 180, 1, 165, 180, 1, 221, 184, 1, 167, 180, 1, 247, 175, 1, 243, 175, 1, 245, 175, 1, 245, 175, 1, 195,
+    171, 1, 143, 167, 1, 193, 171, 1, 145, 167, 1, 191, 171, 1, 171, 158, 1, 143, 167, 1, 221, 162, 1, 169, 158, 1, 219,
+    162, 1, 247, 153, 1, 169, 158, 1, 169, 158, 1, 195, 149, 1, 171, 158, 1, 143, 145, 1, 245, 153, 1, 197, 149, 1, 145,
+    145, 1, 193, 149, 1, 147, 145, 1, 219, 140, 1, 145, 145, 1, 223, 140, 1, 219, 140, 1, 223, 140, 1, 171, 136, 1, 169,
+    136, 1, 247, 131, 1, 223, 140, 1, 197, 127, 169, 136, 1, 197, 127, 247, 131, 1, 247, 131, 1, 147, 123, 197, 127,
+    143, 123, 199, 127, 221, 118, 199, 127, 221, 118, 221, 118, 225, 118, 223, 118, 169, 114, 225, 118, 171, 114, 173,
+    114, 247, 109, 171, 114, 251, 109, 247, 109, 199, 105, 247, 109, 251, 109, 145, 101, 199, 105, 197, 105, 149, 101,
+    195, 105, 225, 96, 147, 101, 147, 101, 223, 96, 225, 96, 223, 96, 225, 96, 171, 92, 225, 96, 251, 87, 223, 96, 249,
+    87, 175, 92, 249, 87, 173, 92, 199, 83, 249, 87, 201, 83, 249, 87, 199, 83, 199, 83, 199, 83, 147, 79, 201, 83, 147,
+    79, 149, 79, 147, 79, 149, 79, 225, 74, 225, 74, 149, 79, 173, 70, 147, 79, 177, 70, 227, 147, 167, 219, 144, 230,
+    5, 181, 148, 224, 141, 252, 152, 12, 247, 131, 1, 197, 149, 1, 245, 131, 1, 223, 140, 1, 221, 140, 1, 145, 123, 223,
+    140, 1, 145, 123, 221, 140, 1, 145, 123, 145, 123, 147, 123, 247, 131, 1, 173, 114, 247, 131, 1, 197, 105, 247, 131,
+    1, 199, 105, 145, 123, 197, 105, 147, 123, 197, 105, 199, 105, 171, 114, 197, 105, 199, 105, 223, 96, 173, 114, 223,
+    96, 223, 96, 199, 105, 223, 96, 225, 96, 249, 87, 225, 96, 223, 96, 249, 87, 253, 87, 221, 96, 149, 79, 251, 87,
+    147, 79, 251, 87, 147, 79, 251, 87, 147, 79, 175, 70, 147, 79, 149, 79, 175, 70, 147, 79, 199, 61, 151, 79, 173, 70,
+    199, 61, 181, 242, 170, 137, 215, 229, 14, 163, 144, 144, 201, 194, 152, 21, 147, 123, 145, 123, 147, 123, 143, 123,
+    147, 123, 147, 123, 195, 105, 199, 105, 147, 123, 249, 87, 145, 123, 197, 105, 253, 87, 195, 105, 251, 87, 251, 87,
+    195, 105, 253, 87, 173, 70, 197, 105, 175, 70, 175, 70, 249, 87, 175, 70, 173, 70, 175, 70, 173, 70, 247, 241, 199,
+    195, 253, 226, 68, 141, 191, 194, 225, 181, 153, 3, 223, 140, 1, 197, 105, 199, 105, 197, 105, 197, 105, 199, 105,
+    197, 105, 175, 70, 173, 70, 199, 105, 173, 70, 175, 70, 173, 251, 224, 149, 151, 225, 104, 209, 204, 188, 180, 207,
+    151, 39, 221, 140, 1, 221, 140, 1, 175, 70, 173, 70, 175, 70, 171, 166, 229, 186, 202, 221, 176, 1, 203, 156, 218,
+    217, 130, 148, 111, 223, 140, 1, 143, 184, 196, 240, 227, 228, 32, 129, 193, 185, 184, 182, 254, 158, 4, 171, 238,
+    130, 133, 177, 214, 192, 2, 137, 222, 131, 251, 206, 169, 191, 13,
+    // N800 (TL1599)
+    154, 217, 246, 162, 176, 159, 189, 214, 128, 1, 153, 140, 226, 239, 149, 232, 192, 214, 128, 1, 237, 199, 218, 165,
+    217, 2, 225, 237, 146, 130, 78, 253, 208, 253, 203, 29, 175, 219, 129, 169, 14, 225, 167, 178, 128, 8, 239, 209,
+    128, 246, 4, 159, 231, 242, 158, 3, 175, 195, 211, 159, 2, 165, 181, 203, 207, 1, 177, 251, 217, 154, 1, 239, 154,
+    175, 118, 225, 208, 202, 92, 189, 198, 227, 73, 221, 241, 222, 59, 209, 216, 134, 49, 181, 189, 226, 40, 181, 152,
+    160, 34, 151, 220, 134, 29, 243, 183, 237, 24, 149, 238, 182, 21, 193, 176, 205, 18, 177, 219, 160, 16, 247, 206,
+    164, 14, 133, 214, 207, 12, 209, 196, 154, 11, 223, 193, 255, 9, 197, 133, 250, 8, 141, 193, 134, 8, 219, 255, 161,
+    7, 143, 148, 202, 6, 205, 131, 253, 5, 251, 132, 185, 5, 253, 239, 252, 4, 133, 185, 199, 4, 181, 234, 151, 4, 147,
+    160, 237, 3, 245, 137, 199, 3, 255, 220, 164, 3, 169, 226, 133, 3, 233, 224, 233, 2, 239, 176, 208, 2, 203, 167,
+    185, 2, 175, 168, 164, 2, 175, 147, 145, 2, 161, 207, 255, 1, 163, 200, 239, 1, 193, 233, 224, 1, 177, 161, 211, 1,
+    241, 228, 198, 1, 161, 160, 187, 1, 249, 205, 176, 1, 219, 223, 166, 1, 133, 208, 157, 1, 205, 144, 149, 1, 175,
+    160, 141, 1, 165, 244, 133, 1, 147, 138, 127, 159, 217, 120, 149, 222, 114, 203, 148, 109, 151, 249, 103, 201, 135,
+    99, 155, 186, 94, 177, 147, 90, 189, 141, 86, 169, 165, 82, 221, 217, 78, 179, 167, 75, 193, 143, 72, 199, 141, 69,
+    195, 160, 66, 175, 200, 63, 209, 255, 60, 253, 205, 58, 137, 165, 56, 143, 145, 54, 159, 137, 52, 185, 141, 50, 133,
+    161, 48, 159, 187, 46, 135, 231, 44, 159, 151, 43, 195, 211, 41, 231, 154, 40, 203, 231, 38, 161, 190, 37, 195, 155,
+    36, 195, 128, 35, 147, 237, 33, 171, 223, 32, 255, 214, 31, 161, 213, 30, 141, 218, 29, 159, 226, 28, 233, 238, 27,
+    147, 132, 27, 181, 152, 26, 183, 181, 25, 193, 210, 24, 169, 248, 23, 253, 155, 23, 167, 199, 22, 237, 244, 21, 215,
+    165, 21, 207, 215, 20, 135, 143, 20, 189, 198, 19, 193, 132, 19, 171, 192, 18, 213, 129, 18, 155, 197, 17, 219, 136,
+    17, 199, 207, 16, 201, 152, 16, 215, 226, 15, 159, 177, 15, 195, 253, 14, 175, 207, 14, 253, 158, 14, 245, 241, 13,
+    143, 200, 13, 157, 157, 13, 201, 244, 12, 253, 204, 12, 191, 166, 12, 155, 130, 12, 245, 221, 11, 223, 186, 11, 239,
+    154, 11, 213, 247, 10, 253, 217, 10, 143, 186, 10, 191, 157, 10, 221, 254, 9, 171, 228, 9, 225, 199, 9, 187, 174, 9,
+    135, 148, 9, 243, 251, 8, 203, 226, 8, 181, 202, 8, 191, 181, 8, 173, 157, 8, 181, 136, 8, 197, 243, 7, 213, 222, 7,
+    225, 201, 7, 151, 184, 7, 175, 164, 7, 215, 145, 7, 129, 255, 6, 205, 239, 6, 243, 220, 6, 183, 204, 6, 245, 187, 6,
+    209, 173, 6, 159, 158, 6, 211, 140, 6, 211, 129, 6, 135, 240, 5, 251, 227, 5, 227, 214, 5, 187, 200, 5, 167, 187, 5,
+    163, 176, 5, 255, 161, 5, 141, 152, 5, 245, 138, 5, 241, 255, 4, 235, 243, 4, 129, 235, 4, 233, 221, 4, 145, 214, 4,
+    247, 200, 4, 157, 193, 4, 161, 182, 4, 183, 173, 4, 199, 163, 4, 225, 154, 4, 251, 145, 4, 147, 137, 4, 175, 128, 4,
+    213, 248, 3, 241, 239, 3, 149, 232, 3, 191, 224, 3, 227, 216, 3, 139, 209, 3, 177, 201, 3, 243, 195, 3, 129, 186, 3,
+    203, 181, 3, 243, 173, 3, 179, 168, 3, 207, 159, 3, 155, 155, 3, 207, 148, 3, 129, 142, 3, 181, 135, 3, 143, 132, 3,
+    183, 252, 2, 235, 245, 2, 193, 242, 2, 135, 237, 2, 181, 230, 2, 247, 224, 2, 211, 221, 2, 133, 215, 2, 211, 210, 2,
+    159, 206, 2, 235, 201, 2, 161, 195, 2, 133, 193, 2, 199, 187, 2, 135, 182, 2, 239, 179, 2, 171, 174, 2, 139, 171, 2,
+    197, 165, 2, 175, 163, 2, 241, 157, 2, 199, 154, 2, 161, 151, 2, 241, 146, 2, 213, 144, 2, 139, 138, 2, 135, 138, 2,
+    191, 131, 2, 175, 130, 2, 229, 205, 152, 245, 135, 133, 2, 163, 149, 202, 133, 204, 199, 1, 227, 238, 3, 177, 234,
+    3, 201, 225, 3, 151, 221, 3, 203, 214, 3, 255, 207, 3, 203, 203, 3, 253, 196, 3, 181, 190, 3, 253, 185, 3, 181, 179,
+    3, 153, 177, 3, 179, 168, 3, 129, 164, 3, 207, 159, 3, 153, 155, 3, 209, 148, 3, 153, 144, 3, 233, 139, 3, 181, 135,
+    3, 133, 131, 3, 179, 252, 2, 133, 248, 2, 233, 245, 2, 185, 241, 2, 231, 234, 2, 211, 232, 2, 157, 228, 2, 211, 221,
+    2, 209, 221, 2, 133, 215, 2, 209, 210, 2, 185, 208, 2, 135, 204, 2, 209, 199, 2, 187, 197, 2, 133, 193, 2, 213, 188,
+    2, 185, 186, 2, 133, 182, 2, 215, 177, 2, 185, 175, 2, 161, 173, 2, 239, 168, 2, 213, 166, 2, 135, 160, 2, 163, 162,
+    2, 187, 153, 2, 213, 155, 2, 239, 146, 2, 137, 149, 2, 215, 144, 2, 189, 142, 2, 237, 135, 2, 141, 138, 2, 187, 131,
+    2, 163, 129, 2, 165, 129, 2, 239, 252, 1, 191, 248, 1, 215, 250, 1, 241, 241, 1, 139, 244, 1, 217, 239, 1, 213, 239,
+    1, 141, 233, 1, 139, 233, 1, 243, 230, 1, 215, 228, 1, 165, 224, 1, 167, 224, 1, 139, 222, 1, 243, 219, 1, 191, 215,
+    1, 193, 215, 1, 165, 213, 1, 243, 208, 1, 141, 211, 1, 191, 204, 1, 193, 204, 1, 193, 204, 1, 139, 200, 1, 245, 197,
+    1, 219, 195, 1, 243, 197, 1, 167, 191, 1, 169, 191, 1, 141, 189, 1, 243, 186, 1, 245, 186, 1, 219, 184, 1, 169, 180,
+    1, 193, 182, 1, 141, 178, 1, 247, 175, 1, 141, 178, 1, 195, 171, 1, 219, 173, 1, 195, 171, 1, 167, 169, 1, 247, 164,
+    1, 167, 169, 1, 223, 162, 1, 217, 162, 1, 221, 162, 1, 197, 160, 1, 167, 158, 1, 143, 156, 1, 171, 158, 1, 219, 151,
+    1, 145, 156, 1, 195, 149, 1, 221, 151, 1, 169, 147, 1, 197, 149, 1, 143, 145, 1, 145, 145, 1, 143, 145, 1, 249, 142,
+    1, 195, 138, 1, 245, 142, 1, 199, 138, 1, 169, 136, 1, 195, 138, 1, 147, 134, 1, 143, 134, 1, 147, 134, 1, 221, 129,
+    1, 247, 131, 1, 221, 129, 1, 225, 129, 1, 195, 127, 171, 125, 171, 125, 145, 123, 171, 125, 249, 120, 249, 120, 247,
+    120, 223, 118, 223, 118, 221, 118, 173, 114, 171, 114, 199, 116, 145, 112, 145, 112, 147, 112, 251, 109, 143, 112,
+    199, 105, 249, 109, 223, 107, 199, 105, 197, 105, 171, 103, 173, 103, 199, 105, 249, 98, 171, 103, 149, 101, 221,
+    96, 149, 101, 223, 96, 251, 98, 223, 96, 197, 94, 199, 94, 199, 94, 199, 94, 147, 90, 199, 94, 171, 92, 251, 87,
+    173, 92, 251, 87, 249, 87, 251, 87, 249, 87, 249, 87, 201, 83, 223, 85, 225, 85, 201, 83, 197, 83, 173, 81, 201, 83,
+    171, 81, 151, 79, 171, 81, 175, 81, 251, 76, 147, 79, 251, 76, 251, 76, 251, 76, 249, 76, 227, 74, 249, 76, 201, 72,
+    225, 74, 199, 72, 201, 72, 197, 72, 201, 72, 175, 70, 175, 70, 197, 72, 151, 68, 147, 68, 151, 68, 171, 70, 253, 65,
+    149, 68, 251, 65, 149, 68, 225, 63, 253, 65, 223, 63, 253, 65, 201, 61, 249, 65, 203, 61, 199, 61, 225, 63, 201, 61,
+    175, 59, 201, 61, 199, 61, 175, 59, 149, 57, 201, 61, 149, 57, 175, 59, 149, 57, 151, 57, 147, 57, 151, 57, 149, 57,
+    225, 52, 151, 57, 251, 54, 253, 54, 225, 52, 253, 54, 227, 52, 251, 54, 199, 50, 229, 52, 225, 52, 203, 50, 223, 52,
+    203, 50, 177, 48, 223, 52, 177, 48, 201, 50, 177, 48, 199, 50, 151, 46, 199, 50, 151, 46, 177, 48, 149, 46, 149, 46,
+    175, 48, 151, 46, 253, 43, 175, 48, 253, 43, 253, 43, 149, 46, 251, 43, 255, 43, 251, 43, 227, 41, 151, 46, 201, 39,
+    253, 43, 251, 43, 203, 39, 253, 43, 173, 185, 217, 225, 220, 30, 177, 175, 200, 150, 203, 250, 6, 147, 79, 251, 87,
+    225, 74, 147, 79, 201, 83, 147, 79, 225, 74, 147, 79, 149, 79, 149, 79, 173, 70, 149, 79, 225, 74, 225, 74, 225, 74,
+    225, 74, 175, 70, 223, 74, 227, 74, 251, 65, 225, 74, 175, 70, 173, 70, 175, 70, 175, 70, 249, 65, 175, 70, 175, 70,
+    251, 65, 251, 65, 251, 65, 251, 65, 175, 70, 201, 61, 249, 65, 203, 61, 249, 65, 253, 65, 147, 57, 253, 65, 251, 65,
+    149, 57, 201, 61, 201, 61, 199, 61, 199, 61, 151, 57, 201, 61, 149, 57, 149, 57, 199, 61, 151, 57, 225, 52, 201, 61,
+    151, 57, 225, 52, 149, 57, 227, 52, 199, 61, 177, 48, 149, 57, 225, 52, 229, 52, 147, 57, 177, 48, 225, 52, 227, 52,
+    227, 52, 227, 52, 173, 48, 177, 48, 227, 52, 225, 52, 253, 43, 227, 52, 175, 48, 175, 48, 177, 48, 173, 48, 255, 43,
+    175, 48, 173, 48, 179, 48, 249, 43, 255, 43, 175, 48, 251, 43, 255, 43, 251, 43, 253, 43, 175, 48, 201, 39, 253, 43,
+    253, 43, 201, 39, 253, 43, 253, 43, 199, 39, 205, 39, 251, 43, 201, 39, 201, 39, 253, 43, 151, 35, 253, 43, 151, 35,
+    201, 39, 201, 39, 201, 39, 151, 35, 203, 39, 199, 39, 153, 35, 149, 35, 203, 39, 149, 35, 151, 35, 203, 39, 227, 30,
+    201, 39, 227, 30, 151, 35, 151, 35, 151, 35, 151, 35, 227, 30, 149, 35, 231, 30, 147, 35, 231, 30, 149, 35, 175, 26,
+    203, 39, 177, 26, 229, 30, 225, 30, 153, 35, 175, 26, 227, 30, 229, 30, 229, 30, 207, 205, 147, 195, 216, 132, 11,
+    129, 163, 233, 173, 247, 173, 3, 201, 61, 225, 52, 201, 61, 225, 52, 227, 52, 201, 61, 227, 52, 225, 52, 201, 61,
+    251, 43, 229, 52, 199, 61, 253, 43, 225, 52, 227, 52, 227, 52, 253, 43, 199, 61, 151, 35, 199, 61, 153, 35, 199, 61,
+    151, 35, 227, 52, 251, 43, 227, 52, 151, 35, 227, 52, 251, 43, 253, 43, 253, 43, 253, 43, 149, 35, 227, 52, 151, 35,
+    253, 43, 251, 43, 151, 35, 253, 43, 151, 35, 251, 43, 153, 35, 251, 43, 149, 35, 153, 35, 251, 43, 153, 35, 149, 35,
+    175, 26, 255, 43, 149, 35, 153, 35, 149, 35, 149, 35, 179, 26, 251, 43, 205, 17, 251, 43, 177, 26, 149, 35, 179, 26,
+    149, 35, 177, 26, 151, 35, 177, 26, 177, 26, 175, 26, 153, 35, 175, 26, 189, 193, 192, 183, 128, 158, 18, 169, 255,
+    207, 170, 159, 199, 10, 225, 52, 227, 52, 151, 35, 175, 70, 225, 52, 151, 35, 227, 52, 225, 52, 151, 35, 227, 52,
+    227, 52, 151, 35, 225, 52, 151, 35, 149, 35, 229, 52, 149, 35, 151, 35, 227, 52, 149, 35, 205, 17, 225, 52, 151, 35,
+    151, 35, 149, 35, 153, 35, 201, 17, 227, 52, 203, 17, 149, 35, 205, 17, 149, 35, 153, 35, 191, 172, 181, 197, 176,
+    235, 3, 141, 142, 246, 254, 142, 223, 53, 149, 35, 175, 70, 151, 35, 151, 35, 173, 70, 151, 35, 175, 70, 0, 173, 70,
+    0, 175, 70, 151, 35, 0, 173, 70, 0, 151, 35, 209, 187, 171, 167, 208, 208, 32, 139, 214, 176, 225, 174, 196, 82,
+    175, 70, 0, 0, 221, 140, 1, 0, 1, 171, 70, 247, 252, 209, 235, 143, 155, 90, 165, 179, 231, 165, 238, 142, 140, 1,
+    221, 140, 1, 0, 221, 140, 1, 249, 142, 230, 133, 141, 218, 179, 3, 249, 234, 142, 157, 239, 249, 24, 129, 159, 162,
+    151, 139, 132, 154, 5, 227, 197, 144, 221, 131, 172, 179, 12,
+    // N1024 (TL2047)
+    188, 249, 228, 166, 191, 236, 189, 214, 128, 1, 205, 129, 186, 230, 177, 209, 192, 214, 128, 1, 157, 234, 232, 227,
+    141, 2, 135, 255, 154, 250, 60, 209, 133, 200, 143, 23, 137, 238, 145, 152, 11, 205, 168, 174, 160, 6, 167, 230,
+    156, 236, 3, 191, 194, 148, 196, 2, 147, 158, 223, 224, 1, 217, 169, 152, 162, 1, 215, 173, 239, 120, 227, 215, 189,
+    92, 215, 246, 170, 72, 143, 165, 210, 57, 141, 197, 214, 46, 179, 200, 169, 38, 153, 155, 237, 31, 235, 175, 225,
+    26, 231, 186, 217, 22, 213, 213, 181, 19, 137, 129, 223, 16, 141, 201, 196, 14, 239, 213, 217, 12, 149, 219, 148,
+    11, 195, 168, 238, 9, 177, 233, 224, 8, 247, 214, 231, 7, 129, 180, 255, 6, 181, 147, 165, 6, 189, 205, 214, 5, 177,
+    252, 145, 5, 193, 221, 213, 4, 247, 203, 160, 4, 191, 204, 241, 3, 243, 236, 199, 3, 227, 209, 162, 3, 203, 177,
+    129, 3, 241, 197, 227, 2, 141, 220, 200, 2, 227, 194, 176, 2, 183, 211, 154, 2, 197, 231, 134, 2, 241, 229, 244, 1,
+    219, 176, 228, 1, 185, 182, 213, 1, 199, 218, 199, 1, 171, 150, 187, 1, 245, 211, 175, 1, 155, 136, 165, 1, 159,
+    168, 155, 1, 229, 165, 146, 1, 199, 254, 137, 1, 177, 165, 130, 1, 189, 145, 123, 241, 194, 116, 193, 174, 110, 133,
+    208, 104, 149, 164, 99, 195, 167, 94, 191, 210, 89, 249, 163, 85, 239, 155, 81, 205, 178, 77, 243, 229, 73, 139,
+    185, 70, 161, 162, 67, 237, 165, 64, 177, 191, 61, 199, 234, 58, 241, 173, 56, 183, 254, 53, 209, 225, 51, 177, 213,
+    49, 139, 212, 47, 189, 229, 45, 193, 253, 43, 137, 167, 42, 153, 214, 40, 199, 147, 39, 211, 216, 37, 223, 168, 36,
+    191, 128, 35, 227, 221, 33, 145, 199, 32, 245, 180, 31, 151, 168, 30, 181, 166, 29, 215, 164, 28, 249, 173, 27, 165,
+    184, 26, 183, 203, 25, 229, 224, 24, 197, 250, 23, 239, 154, 23, 167, 188, 22, 175, 228, 21, 203, 142, 21, 143, 188,
+    20, 253, 236, 19, 153, 162, 19, 197, 216, 18, 159, 147, 18, 167, 209, 17, 155, 142, 17, 211, 208, 16, 175, 150, 16,
+    129, 219, 15, 143, 165, 15, 147, 238, 14, 201, 187, 14, 255, 136, 14, 219, 217, 13, 197, 171, 13, 185, 254, 12, 215,
+    212, 12, 217, 168, 12, 153, 130, 12, 209, 218, 11, 173, 182, 11, 237, 143, 11, 239, 238, 10, 219, 203, 10, 215, 170,
+    10, 249, 139, 10, 129, 236, 9, 173, 206, 9, 239, 178, 9, 137, 148, 9, 241, 251, 8, 177, 224, 8, 131, 198, 8, 231,
+    173, 8, 221, 150, 8, 197, 254, 7, 185, 231, 7, 201, 210, 7, 213, 189, 7, 201, 166, 7, 253, 148, 7, 155, 129, 7, 167,
+    236, 6, 229, 219, 6, 145, 201, 6, 195, 183, 6, 133, 167, 6, 197, 150, 6, 133, 134, 6, 201, 245, 5, 173, 232, 5, 253,
+    216, 5, 201, 201, 5, 177, 188, 5, 151, 175, 5, 243, 160, 5, 217, 147, 5, 207, 135, 5, 191, 251, 4, 183, 239, 4, 167,
+    227, 4, 171, 216, 4, 159, 204, 4, 181, 195, 4, 161, 182, 4, 197, 174, 4, 185, 162, 4, 199, 152, 4, 237, 144, 4, 239,
+    133, 4, 137, 253, 3, 163, 244, 3, 187, 235, 3, 215, 226, 3, 255, 218, 3, 139, 209, 3, 201, 203, 3, 231, 194, 3, 255,
+    185, 3, 193, 180, 3, 229, 172, 3, 129, 164, 3, 195, 158, 3, 243, 151, 3, 155, 144, 3, 219, 138, 3, 145, 132, 3, 195,
+    253, 2, 245, 246, 2, 197, 242, 2, 235, 234, 2, 195, 231, 2, 221, 222, 2, 185, 219, 2, 249, 213, 2, 185, 208, 2, 249,
+    202, 2, 185, 197, 2, 145, 194, 2, 201, 187, 2, 147, 183, 2, 237, 179, 2, 163, 173, 2, 133, 171, 2, 189, 164, 2, 149,
+    161, 2, 237, 157, 2, 165, 151, 2, 147, 150, 2, 203, 143, 2, 175, 141, 2, 251, 136, 2, 217, 133, 2, 163, 129, 2, 253,
+    253, 1, 203, 249, 1, 189, 248, 1, 241, 241, 1, 229, 240, 1, 177, 236, 1, 153, 234, 1, 241, 230, 1, 191, 226, 1, 167,
+    224, 1, 253, 220, 1, 231, 218, 1, 179, 214, 1, 165, 213, 1, 129, 210, 1, 217, 206, 1, 179, 203, 1, 169, 202, 1, 255,
+    198, 1, 217, 195, 1, 207, 194, 1, 167, 191, 1, 141, 189, 1, 233, 185, 1, 219, 184, 1, 191, 182, 1, 145, 178, 1, 141,
+    178, 1, 247, 175, 1, 193, 171, 1, 193, 171, 1, 169, 169, 1, 131, 166, 1, 245, 164, 1, 221, 162, 1, 195, 160, 1, 167,
+    158, 1, 159, 157, 1, 129, 155, 1, 235, 152, 1, 219, 151, 1, 197, 149, 1, 169, 147, 1, 171, 147, 1, 245, 142, 1, 247,
+    142, 1, 235, 141, 1, 197, 138, 1, 181, 137, 1, 185, 137, 1, 145, 134, 1, 131, 133, 1, 247, 131, 1, 223, 129, 1, 209,
+    128, 1, 197, 127, 171, 125, 159, 124, 157, 124, 249, 120, 235, 119, 235, 119, 211, 117, 183, 115, 199, 116, 157,
+    113, 161, 113, 131, 111, 251, 109, 247, 109, 225, 107, 209, 106, 199, 105, 185, 104, 183, 104, 161, 102, 135, 100,
+    159, 102, 237, 97, 249, 98, 223, 96, 225, 96, 197, 94, 211, 254, 173, 154, 248, 179, 2, 221, 186, 140, 197, 252, 51,
+    221, 184, 1, 191, 182, 1, 195, 182, 1, 167, 180, 1, 245, 175, 1, 245, 175, 1, 219, 173, 1, 221, 173, 1, 167, 169, 1,
+    169, 169, 1, 143, 167, 1, 145, 167, 1, 217, 162, 1, 223, 162, 1, 193, 160, 1, 169, 158, 1, 197, 160, 1, 243, 153, 1,
+    147, 156, 1, 243, 153, 1, 223, 151, 1, 195, 149, 1, 195, 149, 1, 195, 149, 1, 247, 142, 1, 169, 147, 1, 249, 142, 1,
+    245, 142, 1, 223, 140, 1, 195, 138, 1, 195, 138, 1, 197, 138, 1, 145, 134, 1, 171, 136, 1, 247, 131, 1, 247, 131, 1,
+    247, 131, 1, 223, 129, 1, 221, 129, 1, 173, 125, 195, 127, 171, 125, 173, 125, 245, 120, 149, 123, 221, 118, 145,
+    123, 197, 116, 223, 118, 173, 114, 221, 118, 147, 112, 197, 116, 249, 109, 173, 114, 247, 109, 223, 107, 147, 112,
+    197, 105, 225, 107, 221, 107, 173, 103, 199, 105, 147, 101, 197, 105, 147, 101, 145, 101, 251, 98, 251, 98, 145,
+    101, 199, 94, 249, 98, 197, 94, 225, 96, 199, 94, 173, 92, 199, 94, 147, 90, 197, 94, 251, 87, 147, 90, 149, 90,
+    147, 90, 223, 85, 251, 87, 225, 85, 249, 87, 199, 83, 201, 83, 223, 85, 173, 81, 199, 83, 201, 83, 147, 79, 173, 81,
+    149, 79, 147, 79, 149, 79, 149, 79, 249, 76, 251, 76, 225, 74, 251, 76, 251, 76, 199, 72, 225, 74, 199, 72, 227, 74,
+    199, 72, 173, 70, 201, 72, 175, 70, 147, 68, 201, 72, 147, 68, 175, 70, 253, 65, 147, 68, 149, 68, 251, 65, 149, 68,
+    225, 63, 253, 65, 223, 63, 253, 65, 227, 63, 199, 61, 225, 63, 227, 63, 199, 61, 201, 61, 201, 61, 175, 59, 199, 61,
+    175, 59, 201, 61, 149, 57, 149, 57, 201, 61, 253, 54, 173, 59, 253, 54, 173, 59, 253, 54, 253, 54, 249, 54, 151, 57,
+    227, 52, 251, 54, 253, 54, 225, 52, 227, 52, 253, 54, 199, 50, 227, 52, 201, 50, 227, 52, 201, 50, 201, 50, 199, 50,
+    203, 50, 175, 48, 201, 50, 175, 48, 201, 50, 149, 46, 177, 48, 175, 48, 175, 48, 151, 46, 149, 46, 149, 46, 177, 48,
+    253, 43, 149, 46, 149, 46, 255, 43, 251, 43, 149, 46, 255, 43, 225, 41, 151, 46, 227, 41, 251, 43, 229, 41, 251, 43,
+    203, 39, 251, 43, 229, 41, 199, 39, 229, 41, 227, 41, 199, 39, 229, 41, 203, 39, 199, 39, 203, 39, 175, 37, 229, 41,
+    173, 37, 205, 39, 173, 37, 203, 39, 177, 37, 175, 37, 175, 37, 177, 37, 151, 35, 203, 39, 149, 35, 149, 35, 179, 37,
+    149, 35, 151, 35, 175, 37, 255, 32, 175, 37, 253, 32, 151, 35, 253, 32, 149, 35, 255, 32, 151, 35, 253, 32, 251, 32,
+    255, 32, 253, 32, 253, 32, 253, 32, 253, 32, 229, 30, 225, 30, 255, 32, 253, 32, 201, 28, 255, 32, 227, 30, 227, 30,
+    227, 30, 203, 28, 255, 32, 199, 28, 205, 28, 251, 32, 177, 26, 229, 30, 201, 28, 227, 30, 203, 28, 177, 26, 227, 30,
+    177, 26, 229, 30, 175, 26, 203, 28, 177, 26, 201, 28, 203, 28, 151, 24, 201, 28, 203, 28, 153, 24, 199, 28, 179, 26,
+    151, 24, 201, 28, 153, 24, 175, 26, 177, 26, 177, 26, 153, 24, 149, 24, 177, 26, 151, 24, 177, 26, 151, 24, 153, 24,
+    149, 24, 153, 24, 149, 24, 179, 26, 253, 21, 253, 21, 177, 26, 255, 21, 149, 24, 255, 21, 151, 24, 151, 24, 229, 19,
+    151, 24, 151, 24, 229, 19, 151, 24, 253, 21, 253, 21, 229, 19, 153, 24, 251, 21, 231, 19, 149, 24, 229, 19, 229, 19,
+    151, 24, 201, 17, 153, 24, 229, 19, 227, 19, 227, 19, 129, 22, 225, 19, 255, 21, 203, 17, 255, 21, 201, 17, 255, 21,
+    201, 17, 255, 21, 203, 17, 229, 19, 227, 19, 227, 19, 205, 17, 227, 19, 205, 17, 225, 19, 205, 17, 229, 19, 227, 19,
+    177, 15, 229, 19, 201, 17, 205, 17, 227, 19, 203, 17, 177, 15, 229, 19, 203, 17, 177, 15, 229, 19, 177, 15, 227, 19,
+    179, 15, 177, 15, 227, 19, 177, 15, 179, 15, 229, 19, 175, 15, 179, 15, 201, 17, 179, 15, 177, 15, 203, 17, 177, 15,
+    203, 17, 151, 13, 203, 17, 179, 15, 175, 15, 179, 15, 177, 15, 225, 206, 164, 239, 241, 231, 3, 245, 155, 247, 208,
+    247, 231, 1, 225, 30, 229, 30, 229, 30, 175, 26, 151, 35, 177, 26, 175, 26, 153, 35, 253, 21, 149, 35, 179, 26, 227,
+    30, 175, 26, 179, 26, 227, 30, 227, 30, 177, 26, 177, 26, 175, 26, 179, 26, 227, 30, 177, 26, 175, 26, 229, 30, 253,
+    21, 177, 26, 229, 30, 253, 21, 175, 26, 231, 30, 251, 21, 177, 26, 177, 26, 255, 21, 225, 30, 129, 22, 175, 26, 253,
+    21, 177, 26, 177, 26, 177, 26, 255, 21, 251, 21, 179, 26, 175, 26, 205, 17, 225, 30, 205, 17, 175, 26, 177, 26, 255,
+    21, 253, 21, 253, 21, 255, 21, 175, 26, 205, 17, 175, 26, 255, 21, 253, 21, 177, 26, 203, 17, 253, 21, 253, 21, 255,
+    21, 255, 21, 251, 21, 205, 17, 175, 26, 205, 17, 253, 21, 253, 21, 253, 21, 203, 17, 255, 21, 253, 21, 203, 17, 255,
+    21, 251, 21, 205, 17, 203, 17, 175, 26, 153, 13, 253, 21, 255, 21, 201, 17, 205, 17, 251, 21, 155, 13, 175, 26, 151,
+    13, 255, 21, 203, 17, 253, 21, 151, 13, 255, 21, 203, 17, 203, 17, 201, 17, 205, 17, 201, 17, 205, 17, 251, 21, 153,
+    13, 203, 17, 203, 17, 255, 21, 149, 13, 153, 13, 255, 21, 201, 17, 153, 13, 253, 21, 153, 13, 151, 13, 253, 21, 153,
+    13, 203, 17, 151, 13, 255, 21, 151, 13, 151, 13, 205, 17, 201, 17, 151, 13, 153, 13, 255, 21, 227, 8, 205, 17, 201,
+    17, 151, 13, 153, 13, 203, 17, 153, 13, 201, 17, 153, 13, 151, 13, 151, 13, 205, 17, 149, 13, 155, 13, 201, 17, 229,
+    8, 203, 17, 153, 13, 149, 13, 155, 13, 149, 13, 205, 17, 229, 8, 151, 13, 203, 17, 227, 8, 205, 17, 229, 8, 151, 13,
+    203, 17, 229, 8, 151, 13, 153, 13, 153, 13, 149, 13, 231, 8, 151, 13, 151, 13, 153, 13, 153, 13, 227, 8, 153, 13,
+    151, 13, 151, 13, 231, 8, 151, 13, 229, 8, 151, 13, 153, 13, 227, 8, 153, 13, 229, 8, 153, 13, 227, 8, 213, 148,
+    224, 195, 230, 207, 6, 247, 219, 242, 188, 236, 207, 4, 179, 26, 175, 26, 229, 8, 177, 26, 177, 26, 203, 17, 203,
+    17, 175, 26, 205, 17, 201, 17, 205, 17, 175, 26, 203, 17, 177, 26, 229, 8, 175, 26, 205, 17, 175, 26, 231, 8, 175,
+    26, 229, 8, 177, 26, 203, 17, 203, 17, 203, 17, 175, 26, 231, 8, 203, 17, 201, 17, 177, 26, 229, 8, 203, 17, 177,
+    26, 229, 8, 203, 17, 201, 17, 205, 17, 201, 17, 231, 8, 175, 26, 229, 8, 177, 26, 229, 8, 229, 8, 177, 26, 229, 8,
+    175, 26, 1, 177, 26, 227, 8, 203, 17, 203, 17, 231, 8, 201, 17, 203, 17, 229, 8, 201, 17, 205, 17, 229, 8, 227, 8,
+    179, 26, 2, 177, 26, 1, 175, 26, 0, 203, 17, 203, 17, 229, 8, 203, 17, 229, 8, 227, 8, 205, 17, 227, 8, 231, 8, 201,
+    17, 231, 8, 201, 17, 0, 177, 26, 0, 229, 8, 203, 17, 229, 8, 203, 17, 0, 203, 17, 227, 8, 231, 8, 165, 182, 195,
+    129, 208, 159, 12, 191, 161, 237, 255, 213, 159, 10, 151, 35, 2, 153, 35, 201, 17, 205, 17, 201, 17, 203, 17, 203,
+    17, 203, 17, 203, 17, 203, 17, 203, 17, 201, 17, 205, 17, 201, 17, 205, 17, 201, 17, 0, 151, 35, 0, 151, 35, 0, 201,
+    17, 205, 17, 201, 17, 1, 201, 17, 205, 17, 201, 17, 203, 17, 0, 203, 17, 203, 17, 0, 203, 17, 201, 17, 205, 17, 0,
+    201, 17, 1, 201, 17, 203, 17, 1, 145, 228, 154, 128, 253, 127, 175, 214, 203, 130, 207, 254, 43, 149, 35, 151, 35,
+    0, 0, 151, 35, 0, 149, 35, 153, 35, 2, 0, 153, 35, 2, 0, 151, 35, 151, 35, 152, 35, 149, 35, 153, 35, 152, 35, 173,
+    70, 150, 35, 221, 173, 186, 129, 163, 191, 23, 145, 167, 149, 132, 245, 189, 66, 2, 177, 70, 176, 70, 173, 70, 0,
+    175, 70, 174, 70, 173, 70, 0, 0, 165, 221, 237, 137, 135, 187, 158, 1, 231, 146, 178, 129, 169, 191, 21, 1, 223,
+    140, 1, 224, 140, 1, 133, 194, 157, 132, 239, 189, 68, 213, 183, 164, 146, 241, 182, 163, 2, 0, 203, 197, 185, 143,
+    159, 184, 248, 1, 177, 148, 200, 157, 161, 177, 215, 3, 137, 242, 250, 248, 190, 195, 144, 15,
+    // N1280 (TL2559)
+    202, 169, 221, 238, 202, 163, 190, 214, 128, 1, 211, 156, 236, 210, 142, 193, 192, 214, 128, 1, 217, 240, 230, 234,
+    215, 1, 213, 178, 137, 226, 48, 157, 133, 226, 191, 18, 215, 160, 226, 249, 8, 163, 133, 169, 128, 5, 217, 165, 230,
+    137, 3, 253, 211, 171, 131, 2, 155, 243, 230, 179, 1, 231, 137, 225, 129, 1, 187, 215, 217, 96, 249, 205, 254, 73,
+    213, 193, 239, 57, 177, 245, 142, 46, 145, 238, 171, 37, 225, 210, 212, 30, 171, 246, 189, 25, 153, 185, 180, 21,
+    171, 189, 148, 18, 183, 206, 196, 15, 129, 193, 178, 13, 137, 195, 208, 11, 135, 205, 148, 10, 205, 131, 247, 8,
+    175, 243, 241, 7, 131, 218, 128, 7, 155, 228, 159, 6, 227, 173, 204, 5, 149, 146, 132, 5, 185, 169, 197, 4, 161,
+    180, 142, 4, 231, 153, 222, 3, 183, 217, 179, 3, 225, 139, 142, 3, 249, 217, 236, 2, 137, 247, 206, 2, 223, 168,
+    180, 2, 171, 186, 156, 2, 209, 254, 134, 2, 171, 208, 243, 1, 209, 144, 226, 1, 237, 161, 210, 1, 225, 235, 195, 1,
+    217, 219, 182, 1, 255, 222, 170, 1, 255, 227, 159, 1, 217, 222, 149, 1, 141, 197, 140, 1, 227, 134, 132, 1, 183,
+    160, 124, 135, 135, 117, 229, 177, 110, 191, 157, 104, 175, 195, 98, 245, 155, 93, 237, 165, 88, 211, 217, 83, 163,
+    184, 79, 255, 184, 75, 235, 219, 71, 179, 157, 68, 229, 253, 64, 153, 244, 61, 143, 135, 59, 217, 171, 56, 209, 234,
+    53, 225, 182, 51, 129, 154, 49, 167, 137, 47, 159, 138, 45, 183, 153, 43, 221, 180, 41, 173, 222, 39, 219, 144, 38,
+    169, 208, 36, 215, 152, 35, 139, 236, 33, 247, 196, 32, 245, 169, 31, 175, 148, 30, 199, 134, 29, 165, 255, 27, 239,
+    128, 27, 205, 132, 26, 137, 144, 25, 143, 162, 24, 187, 183, 23, 153, 209, 22, 199, 241, 21, 139, 148, 21, 143, 188,
+    20, 177, 230, 19, 141, 150, 19, 145, 201, 18, 161, 253, 17, 233, 181, 17, 221, 242, 16, 225, 176, 16, 255, 240, 15,
+    193, 180, 15, 159, 250, 14, 163, 195, 14, 165, 140, 14, 221, 217, 13, 143, 167, 13, 239, 247, 12, 213, 201, 12, 205,
+    156, 12, 233, 242, 11, 133, 201, 11, 185, 161, 11, 253, 250, 10, 201, 213, 10, 181, 178, 10, 167, 144, 10, 159, 238,
+    9, 159, 205, 9, 213, 176, 9, 227, 144, 9, 151, 244, 8, 205, 215, 8, 155, 189, 8, 233, 162, 8, 195, 137, 8, 149, 239,
+    7, 145, 217, 7, 139, 194, 7, 251, 170, 7, 255, 148, 7, 139, 128, 7, 169, 236, 6, 179, 215, 6, 233, 197, 6, 131, 178,
+    6, 185, 160, 6, 223, 141, 6, 173, 254, 5, 227, 236, 5, 173, 221, 5, 239, 204, 5, 191, 189, 5, 165, 176, 5, 241, 160,
+    5, 207, 146, 5, 191, 134, 5, 155, 248, 4, 129, 235, 4, 249, 222, 4, 231, 210, 4, 225, 198, 4, 219, 187, 4, 225, 176,
+    4, 211, 164, 4, 225, 154, 4, 237, 144, 4, 239, 133, 4, 251, 251, 3, 149, 243, 3, 153, 232, 3, 199, 225, 3, 205, 214,
+    3, 239, 206, 3, 143, 198, 3, 175, 190, 3, 193, 180, 3, 129, 175, 3, 153, 166, 3, 195, 158, 3, 231, 150, 3, 155, 144,
+    3, 207, 137, 3, 129, 131, 3, 171, 251, 2, 221, 244, 2, 159, 239, 2, 207, 232, 2, 131, 226, 2, 213, 221, 2, 245, 213,
+    2, 199, 209, 2, 249, 202, 2, 199, 198, 2, 249, 191, 2, 211, 188, 2, 249, 180, 2, 227, 178, 2, 147, 172, 2, 225, 167,
+    2, 175, 163, 2, 239, 157, 2, 201, 154, 2, 137, 149, 2, 225, 145, 2, 177, 141, 2, 253, 136, 2, 201, 132, 2, 163, 129,
+    2, 241, 252, 1, 191, 248, 1, 175, 247, 1, 231, 240, 1, 201, 238, 1, 165, 235, 1, 241, 230, 1, 205, 227, 1, 179, 225,
+    1, 139, 222, 1, 205, 216, 1, 203, 216, 1, 141, 211, 1, 255, 209, 1, 207, 205, 1, 179, 203, 1, 153, 201, 1, 231, 196,
+    1, 205, 194, 1, 181, 192, 1, 155, 190, 1, 231, 185, 1, 233, 185, 1, 165, 180, 1, 171, 180, 1, 141, 178, 1, 219, 173,
+    1, 195, 171, 1, 193, 171, 1, 145, 167, 1, 129, 166, 1, 221, 162, 1, 219, 162, 1, 169, 158, 1, 157, 157, 1, 145, 156,
+    1, 219, 151, 1, 235, 152, 1, 181, 148, 1, 171, 147, 1, 157, 146, 1, 247, 142, 1, 245, 142, 1, 211, 139, 1, 195, 138,
+    1, 183, 137, 1, 145, 134, 1, 145, 134, 1, 247, 131, 1, 223, 129, 1, 223, 129, 1, 169, 125, 197, 127, 147, 123, 131,
+    122, 133, 122, 237, 119, 209, 117, 209, 117, 173, 114, 183, 115, 161, 113, 133, 111, 247, 109, 251, 109, 209, 106,
+    223, 107, 199, 105, 171, 103, 173, 103, 161, 102, 133, 100, 133, 100, 251, 98, 235, 97, 213, 95, 197, 94, 213, 95,
+    171, 92, 187, 93, 147, 90, 159, 91, 137, 89, 247, 87, 253, 87, 223, 85, 225, 85, 225, 85, 185, 82, 199, 83, 187, 82,
+    161, 80, 175, 81, 145, 79, 151, 79, 249, 76, 135, 78, 239, 75, 237, 75, 225, 74, 227, 74, 197, 72, 201, 72, 187, 71,
+    187, 71, 187, 71, 161, 69, 149, 68, 163, 69, 133, 67, 151, 68, 251, 65, 237, 64, 253, 65, 237, 64, 215, 62, 237, 64,
+    201, 61, 211, 62, 203, 61, 187, 60, 187, 60, 175, 59, 173, 59, 177, 59, 163, 58, 135, 56, 161, 58, 151, 57, 251, 54,
+    253, 54, 137, 56, 237, 53, 253, 54, 227, 52, 225, 52, 227, 52, 227, 52, 201, 50, 213, 51, 201, 50, 201, 50, 189, 49,
+    187, 49, 189, 49, 163, 47, 187, 49, 151, 46, 175, 48, 161, 47, 139, 45, 163, 47, 137, 45, 137, 45, 137, 45, 253, 43,
+    137, 45, 241, 42, 251, 43, 239, 42, 241, 42, 227, 41, 227, 41, 227, 41, 227, 41, 215, 40, 213, 40, 203, 39, 213, 40,
+    189, 38, 215, 40, 175, 37, 233, 216, 180, 165, 148, 131, 2, 215, 212, 218, 192, 228, 28, 223, 74, 253, 76, 199, 72,
+    251, 76, 175, 70, 223, 74, 201, 72, 175, 70, 199, 72, 173, 70, 175, 70, 175, 70, 149, 68, 147, 68, 149, 68, 149, 68,
+    253, 65, 249, 65, 149, 68, 227, 63, 225, 63, 251, 65, 225, 63, 227, 63, 201, 61, 225, 63, 199, 61, 203, 61, 173, 59,
+    201, 61, 199, 61, 175, 59, 151, 57, 199, 61, 151, 57, 147, 57, 151, 57, 173, 59, 253, 54, 253, 54, 149, 57, 149, 57,
+    225, 52, 253, 54, 251, 54, 229, 52, 249, 54, 203, 50, 251, 54, 225, 52, 203, 50, 201, 50, 225, 52, 201, 50, 201, 50,
+    177, 48, 199, 50, 201, 50, 177, 48, 175, 48, 201, 50, 149, 46, 151, 46, 199, 50, 255, 43, 173, 48, 153, 46, 147, 46,
+    151, 46, 253, 43, 151, 46, 149, 46, 225, 41, 153, 46, 251, 43, 227, 41, 253, 43, 253, 43, 225, 41, 255, 43, 225, 41,
+    203, 39, 251, 43, 203, 39, 251, 43, 177, 37, 253, 43, 175, 37, 229, 41, 173, 37, 229, 41, 177, 37, 225, 41, 151, 35,
+    227, 41, 151, 35, 203, 39, 173, 37, 205, 39, 147, 35, 153, 35, 201, 39, 151, 35, 175, 37, 151, 35, 151, 35, 177, 37,
+    149, 35, 253, 32, 177, 37, 253, 32, 149, 35, 255, 32, 151, 35, 149, 35, 255, 32, 225, 30, 179, 37, 225, 30, 229, 30,
+    151, 35, 253, 32, 227, 30, 253, 32, 227, 30, 229, 30, 253, 32, 227, 30, 229, 30, 253, 32, 201, 28, 227, 30, 203, 28,
+    255, 32, 199, 28, 229, 30, 203, 28, 201, 28, 229, 30, 201, 28, 203, 28, 201, 28, 203, 28, 203, 28, 201, 28, 177, 26,
+    201, 28, 203, 28, 177, 26, 203, 28, 175, 26, 203, 28, 151, 24, 203, 28, 177, 26, 175, 26, 177, 26, 177, 26, 153, 24,
+    199, 28, 153, 24, 177, 26, 151, 24, 151, 24, 177, 26, 177, 26, 149, 24, 153, 24, 151, 24, 151, 24, 153, 24, 149, 24,
+    151, 24, 153, 24, 151, 24, 253, 21, 177, 26, 227, 19, 179, 26, 227, 19, 177, 26, 227, 19, 153, 24, 253, 21, 253, 21,
+    153, 24, 227, 19, 151, 24, 255, 21, 227, 19, 255, 21, 151, 24, 227, 19, 229, 19, 151, 24, 203, 17, 151, 24, 229, 19,
+    229, 19, 251, 21, 231, 19, 253, 21, 201, 17, 255, 21, 229, 19, 229, 19, 251, 21, 205, 17, 227, 19, 229, 19, 229, 19,
+    227, 19, 203, 17, 229, 19, 227, 19, 229, 19, 203, 17, 203, 17, 253, 21, 177, 15, 229, 19, 203, 17, 229, 19, 201, 17,
+    203, 17, 205, 17, 227, 19, 201, 17, 179, 15, 229, 19, 201, 17, 179, 15, 227, 19, 179, 15, 201, 17, 203, 17, 203, 17,
+    177, 15, 205, 17, 201, 17, 177, 15, 203, 17, 177, 15, 205, 17, 175, 15, 203, 17, 153, 13, 227, 19, 153, 13, 203, 17,
+    175, 15, 179, 15, 179, 15, 201, 17, 151, 13, 203, 17, 153, 13, 177, 15, 203, 17, 151, 13, 179, 15, 175, 15, 179, 15,
+    151, 13, 179, 15, 175, 15, 179, 15, 151, 13, 153, 13, 201, 17, 255, 10, 203, 17, 255, 10, 201, 17, 129, 11, 175, 15,
+    153, 13, 177, 15, 153, 13, 149, 13, 155, 13, 175, 15, 153, 13, 255, 10, 175, 15, 155, 13, 149, 13, 153, 13, 153, 13,
+    151, 13, 151, 13, 153, 13, 253, 10, 179, 15, 253, 10, 153, 13, 151, 13, 151, 13, 255, 10, 153, 13, 253, 10, 179, 15,
+    227, 8, 179, 15, 253, 10, 255, 10, 153, 13, 253, 10, 151, 13, 153, 13, 229, 8, 151, 13, 255, 10, 153, 13, 253, 10,
+    255, 10, 151, 13, 229, 8, 153, 13, 253, 10, 255, 10, 153, 13, 227, 8, 255, 10, 151, 13, 231, 8, 151, 13, 229, 8,
+    151, 13, 229, 8, 153, 13, 227, 8, 255, 10, 255, 10, 229, 8, 151, 13, 231, 8, 253, 10, 253, 10, 129, 11, 227, 8, 255,
+    10, 229, 8, 253, 10, 255, 10, 231, 8, 253, 10, 253, 10, 231, 8, 227, 8, 255, 10, 255, 10, 229, 8, 229, 8, 253, 10,
+    231, 8, 227, 8, 255, 10, 229, 8, 229, 8, 255, 10, 227, 8, 231, 8, 253, 10, 229, 8, 205, 6, 253, 10, 255, 10, 201, 6,
+    231, 8, 255, 10, 229, 8, 201, 6, 129, 11, 227, 8, 231, 8, 227, 8, 203, 6, 129, 11, 227, 8, 203, 6, 255, 10, 203, 6,
+    231, 8, 227, 8, 229, 8, 229, 8, 229, 8, 203, 6, 229, 8, 231, 8, 227, 8, 203, 6, 229, 8, 229, 8, 205, 6, 227, 8, 231,
+    8, 201, 6, 231, 8, 227, 8, 205, 6, 227, 8, 205, 6, 229, 8, 203, 6, 229, 8, 203, 6, 229, 8, 203, 6, 229, 8, 205, 6,
+    201, 6, 231, 8, 203, 6, 229, 8, 203, 6, 203, 6, 229, 8, 203, 6, 205, 6, 203, 6, 227, 8, 205, 6, 229, 8, 179, 4, 227,
+    8, 203, 6, 205, 6, 203, 6, 229, 8, 177, 4, 231, 8, 201, 6, 205, 6, 203, 6, 203, 6, 205, 6, 201, 6, 205, 6, 229, 8,
+    177, 4, 203, 6, 205, 6, 229, 8, 177, 4, 203, 6, 205, 6, 201, 6, 205, 6, 203, 6, 205, 6, 177, 4, 175, 223, 160, 158,
+    144, 147, 3, 223, 238, 211, 174, 225, 172, 1, 153, 13, 153, 13, 151, 13, 227, 8, 205, 17, 229, 8, 151, 13, 229, 8,
+    203, 17, 227, 8, 155, 13, 227, 8, 151, 13, 155, 13, 149, 13, 229, 8, 153, 13, 153, 13, 227, 8, 153, 13, 227, 8, 153,
+    13, 153, 13, 227, 8, 229, 8, 205, 17, 227, 8, 229, 8, 153, 13, 227, 8, 153, 13, 229, 8, 151, 13, 231, 8, 149, 13,
+    231, 8, 151, 13, 229, 8, 229, 8, 153, 13, 149, 13, 181, 4, 149, 13, 155, 13, 175, 4, 153, 13, 153, 13, 177, 4, 203,
+    17, 177, 4, 229, 8, 153, 13, 151, 13, 179, 4, 151, 13, 229, 8, 229, 8, 227, 8, 155, 13, 227, 8, 229, 8, 229, 8, 229,
+    8, 153, 13, 227, 8, 231, 8, 227, 8, 231, 8, 227, 8, 153, 13, 177, 4, 151, 13, 179, 4, 153, 13, 227, 8, 231, 8, 227,
+    8, 231, 8, 227, 8, 229, 8, 229, 8, 229, 8, 229, 8, 229, 8, 229, 8, 229, 8, 229, 8, 229, 8, 229, 8, 227, 8, 231, 8,
+    177, 4, 153, 13, 227, 8, 179, 4, 229, 8, 229, 8, 151, 13, 1, 149, 13, 231, 8, 177, 4, 153, 13, 177, 4, 229, 8, 229,
+    8, 177, 4, 153, 13, 177, 4, 231, 8, 175, 4, 155, 13, 175, 4, 231, 8, 227, 8, 179, 4, 229, 8, 229, 8, 229, 8, 179, 4,
+    227, 8, 229, 8, 179, 4, 229, 8, 227, 8, 179, 4, 229, 8, 229, 8, 179, 4, 227, 8, 231, 8, 175, 4, 181, 4, 151, 13,
+    177, 4, 177, 4, 231, 8, 229, 8, 177, 4, 229, 8, 177, 4, 231, 8, 227, 8, 179, 4, 177, 4, 231, 8, 227, 8, 179, 4, 177,
+    4, 229, 8, 179, 4, 227, 8, 231, 8, 177, 4, 177, 4, 231, 8, 177, 4, 229, 8, 177, 4, 179, 4, 227, 8, 181, 4, 227, 8,
+    177, 4, 231, 8, 0, 151, 13, 0, 229, 8, 229, 8, 0, 227, 8, 231, 8, 0, 229, 8, 229, 8, 2, 231, 8, 229, 8, 2, 231, 8,
+    177, 4, 177, 4, 231, 8, 177, 4, 177, 4, 231, 8, 2, 229, 8, 179, 4, 229, 8, 0, 227, 8, 181, 4, 175, 4, 231, 8, 2,
+    231, 8, 177, 4, 177, 4, 179, 4, 229, 8, 0, 229, 8, 179, 4, 175, 4, 181, 4, 175, 4, 231, 8, 0, 229, 8, 177, 4, 177,
+    4, 1, 229, 8, 227, 8, 1, 177, 4, 177, 4, 231, 8, 2, 229, 8, 1, 227, 8, 0, 147, 216, 163, 176, 151, 115, 221, 189,
+    211, 233, 203, 140, 8, 201, 17, 231, 8, 2, 203, 17, 231, 8, 2, 203, 17, 0, 203, 17, 0, 203, 17, 0, 203, 17, 0, 229,
+    8, 201, 17, 1, 229, 8, 227, 8, 231, 8, 2, 205, 17, 227, 8, 1, 201, 17, 0, 231, 8, 227, 8, 229, 8, 229, 8, 0, 203,
+    17, 0, 229, 8, 229, 8, 229, 8, 229, 8, 2, 231, 8, 203, 17, 230, 8, 201, 17, 231, 8, 2, 231, 8, 227, 8, 231, 8, 2,
+    229, 8, 231, 8, 227, 8, 0, 203, 17, 1, 2, 203, 17, 0, 229, 8, 0, 203, 17, 0, 2, 205, 17, 0, 229, 8, 0, 201, 17, 228,
+    8, 203, 17, 2, 231, 8, 227, 8, 1, 227, 8, 1, 227, 8, 229, 8, 1, 227, 8, 229, 8, 0, 231, 8, 227, 8, 0, 229, 8, 0,
+    229, 8, 0, 229, 8, 229, 8, 0, 229, 8, 0, 229, 8, 0, 227, 8, 231, 8, 0, 229, 8, 2, 1, 229, 8, 227, 8, 1, 227, 8, 1,
+    229, 8, 2, 229, 8, 1, 227, 8, 1, 135, 178, 204, 251, 136, 179, 5, 225, 211, 167, 184, 189, 204, 12, 0, 201, 17, 205,
+    17, 2, 1, 201, 17, 0, 205, 17, 2, 203, 17, 0, 1, 201, 17, 0, 203, 17, 0, 0, 203, 17, 203, 17, 206, 17, 205, 17, 0,
+    203, 17, 2, 205, 17, 0, 2, 1, 201, 17, 1, 201, 17, 1, 2, 203, 17, 202, 17, 149, 35, 204, 17, 203, 17, 1, 2, 203, 17,
+    0, 0, 203, 17, 0, 0, 0, 203, 17, 0, 0, 0, 201, 17, 1, 0, 203, 17, 213, 208, 147, 149, 236, 178, 14, 159, 137, 215,
+    210, 160, 204, 21, 2, 0, 153, 35, 2, 0, 0, 0, 151, 35, 152, 35, 151, 35, 0, 151, 35, 152, 35, 151, 35, 0, 0, 2, 1,
+    151, 35, 152, 35, 149, 35, 1, 2, 1, 0, 149, 35, 150, 35, 175, 207, 232, 176, 191, 177, 68, 151, 241, 237, 158, 218,
+    204, 3, 175, 70, 0, 2, 1, 175, 70, 178, 70, 1, 175, 70, 178, 70, 177, 70, 2, 1, 213, 148, 208, 152, 204, 176, 104,
+    153, 249, 221, 134, 231, 203, 39, 2, 1, 0, 0, 2, 185, 248, 166, 232, 229, 174, 176, 1, 169, 163, 181, 214, 128, 202,
+    111, 187, 153, 2, 185, 151, 247, 200, 178, 178, 32, 203, 134, 191, 180, 154, 191, 159, 4, 249, 191, 212, 135, 153,
+    171, 192, 2, 139, 141, 167, 248, 230, 212, 191, 13,
+    // N1600 (TL3199)
+    252, 140, 146, 206, 212, 207, 190, 214, 128, 1, 235, 129, 155, 253, 139, 180, 192, 214, 128, 1, 253, 159, 167, 214,
+    172, 1, 251, 161, 237, 129, 39, 139, 220, 164, 230, 14, 247, 150, 211, 148, 7, 205, 179, 163, 128, 4, 211, 204, 134,
+    187, 2, 243, 200, 189, 207, 1, 187, 209, 236, 143, 1, 209, 227, 231, 103, 203, 195, 174, 77, 221, 229, 152, 59, 199,
+    158, 166, 46, 231, 193, 242, 36, 163, 133, 240, 29, 139, 236, 195, 24, 233, 209, 177, 20, 223, 184, 144, 17, 175,
+    210, 195, 14, 237, 251, 182, 12, 153, 212, 219, 10, 215, 237, 166, 9, 159, 196, 144, 8, 205, 185, 146, 7, 237, 249,
+    167, 6, 233, 178, 205, 5, 179, 236, 255, 4, 167, 142, 189, 4, 129, 171, 131, 4, 223, 137, 209, 3, 225, 145, 165, 3,
+    247, 200, 254, 2, 151, 202, 220, 2, 203, 190, 190, 2, 141, 227, 163, 2, 137, 249, 139, 2, 211, 214, 246, 1, 161,
+    200, 227, 1, 185, 179, 210, 1, 255, 244, 194, 1, 221, 243, 180, 1, 219, 155, 168, 1, 153, 216, 156, 1, 175, 150,
+    146, 1, 185, 204, 136, 1, 231, 233, 127, 243, 230, 119, 191, 183, 112, 241, 210, 105, 197, 179, 99, 239, 210, 93,
+    151, 169, 88, 249, 176, 83, 155, 234, 78, 239, 200, 74, 173, 210, 70, 231, 251, 66, 149, 198, 63, 163, 174, 60, 207,
+    175, 57, 191, 204, 54, 133, 252, 51, 253, 197, 49, 155, 158, 47, 157, 138, 45, 235, 135, 43, 227, 147, 41, 247, 173,
+    39, 161, 212, 37, 225, 135, 36, 181, 200, 34, 243, 145, 33, 141, 227, 31, 199, 194, 30, 169, 165, 29, 165, 149, 28,
+    199, 136, 27, 207, 132, 26, 175, 136, 25, 183, 143, 24, 173, 160, 23, 183, 178, 22, 161, 205, 21, 167, 234, 20, 239,
+    140, 20, 239, 180, 19, 147, 223, 18, 237, 142, 18, 229, 192, 17, 145, 247, 16, 213, 175, 16, 205, 236, 15, 205, 170,
+    15, 135, 237, 14, 215, 177, 14, 191, 248, 13, 209, 194, 13, 211, 139, 13, 161, 219, 12, 243, 170, 12, 193, 250, 11,
+    209, 207, 11, 213, 163, 11, 135, 252, 10, 151, 209, 10, 245, 172, 10, 207, 136, 10, 159, 227, 9, 161, 194, 9, 159,
+    161, 9, 167, 128, 9, 203, 226, 8, 243, 196, 8, 181, 169, 8, 223, 139, 8, 173, 241, 7, 147, 217, 7, 239, 191, 7, 201,
+    166, 7, 203, 144, 7, 193, 249, 6, 205, 228, 6, 207, 206, 6, 219, 185, 6, 135, 167, 6, 171, 148, 6, 211, 129, 6, 237,
+    237, 5, 201, 223, 5, 227, 203, 5, 191, 189, 5, 253, 172, 5, 191, 156, 5, 167, 143, 5, 129, 129, 5, 207, 241, 4, 183,
+    228, 4, 155, 215, 4, 133, 202, 4, 247, 189, 4, 237, 177, 4, 235, 166, 4, 213, 153, 4, 213, 142, 4, 237, 133, 4, 213,
+    248, 3, 253, 240, 3, 241, 228, 3, 137, 220, 3, 153, 210, 3, 177, 201, 3, 191, 191, 3, 243, 184, 3, 243, 173, 3, 155,
+    166, 3, 205, 159, 3, 231, 150, 3, 131, 142, 3, 195, 136, 3, 221, 255, 2, 141, 249, 2, 185, 241, 2, 247, 235, 2, 171,
+    229, 2, 209, 221, 2, 145, 216, 2, 199, 209, 2, 133, 204, 2, 185, 197, 2, 133, 193, 2, 189, 186, 2, 247, 180, 2, 189,
+    175, 2, 135, 171, 2, 199, 165, 2, 137, 160, 2, 213, 155, 2, 163, 151, 2, 227, 145, 2, 187, 142, 2, 253, 136, 2, 203,
+    132, 2, 163, 129, 2, 227, 251, 1, 189, 248, 1, 141, 244, 1, 227, 240, 1, 179, 236, 1, 137, 233, 1, 231, 229, 1, 177,
+    225, 1, 141, 222, 1, 217, 217, 1, 205, 216, 1, 151, 212, 1, 233, 207, 1, 215, 206, 1, 155, 201, 1, 143, 200, 1, 229,
+    196, 1, 193, 193, 1, 167, 191, 1, 245, 186, 1, 233, 185, 1, 179, 181, 1, 169, 180, 1, 141, 178, 1, 221, 173, 1, 205,
+    172, 1, 169, 169, 1, 145, 167, 1, 129, 166, 1, 207, 161, 1, 195, 160, 1, 169, 158, 1, 145, 156, 1, 245, 153, 1, 221,
+    151, 1, 183, 148, 1, 195, 149, 1, 131, 144, 1, 133, 144, 1, 233, 141, 1, 209, 139, 1, 197, 138, 1, 155, 135, 1, 161,
+    135, 1, 245, 131, 1, 235, 130, 1, 211, 128, 1, 207, 128, 1, 173, 125, 157, 124, 133, 122, 135, 122, 221, 118, 209,
+    117, 211, 117, 171, 114, 173, 114, 133, 111, 145, 112, 237, 108, 223, 107, 223, 107, 187, 104, 183, 104, 173, 103,
+    159, 102, 135, 100, 249, 98, 249, 98, 211, 95, 225, 96, 197, 94, 187, 93, 185, 93, 149, 90, 159, 91, 133, 89, 253,
+    87, 249, 87, 223, 85, 225, 85, 213, 84, 187, 82, 197, 83, 161, 80, 187, 82, 135, 78, 163, 80, 247, 76, 139, 78, 223,
+    74, 251, 76, 225, 74, 199, 72, 227, 74, 185, 71, 187, 71, 175, 70, 175, 70, 161, 69, 147, 68, 151, 68, 135, 67, 137,
+    67, 237, 64, 239, 64, 239, 64, 225, 63, 213, 62, 213, 62, 201, 61, 201, 61, 185, 60, 177, 59, 175, 59, 173, 59, 151,
+    57, 161, 58, 151, 57, 135, 56, 253, 54, 135, 56, 253, 54, 251, 54, 227, 52, 227, 52, 227, 52, 225, 52, 213, 51, 203,
+    50, 211, 51, 191, 49, 187, 49, 187, 49, 177, 48, 189, 49, 161, 47, 163, 47, 163, 47, 149, 46, 151, 46, 151, 46, 135,
+    45, 139, 45, 251, 43, 253, 43, 253, 43, 239, 42, 241, 42, 239, 42, 227, 41, 227, 41, 227, 41, 215, 40, 213, 40, 215,
+    40, 203, 39, 187, 38, 215, 40, 187, 38, 191, 38, 175, 37, 189, 38, 189, 38, 163, 36, 165, 36, 175, 37, 163, 36, 149,
+    35, 165, 36, 165, 36, 135, 34, 139, 34, 151, 35, 137, 34, 139, 34, 253, 32, 137, 34, 253, 32, 255, 32, 239, 31, 239,
+    31, 255, 32, 227, 30, 241, 31, 239, 31, 217, 29, 239, 31, 215, 29, 227, 30, 203, 28, 229, 30, 213, 29, 203, 28, 215,
+    29, 201, 28, 203, 28, 203, 28, 187, 27, 205, 28, 175, 26, 203, 28, 189, 27, 177, 26, 189, 27, 163, 25, 191, 27, 177,
+    26, 163, 25, 177, 26, 163, 25, 165, 25, 165, 25, 163, 25, 163, 25, 153, 24, 149, 24, 153, 24, 151, 24, 163, 25, 255,
+    21, 151, 24, 151, 24, 253, 21, 151, 24, 255, 21, 139, 23, 253, 21, 137, 23, 255, 21, 255, 21, 137, 23, 229, 19, 137,
+    23, 243, 20, 239, 20, 255, 21, 241, 20, 227, 19, 255, 21, 229, 19, 241, 20, 227, 19, 229, 19, 239, 20, 219, 18, 239,
+    20, 215, 18, 229, 19, 215, 18, 229, 19, 229, 19, 201, 17, 217, 18, 229, 19, 201, 17, 215, 18, 205, 17, 215, 18, 215,
+    18, 189, 16, 217, 18, 203, 17, 201, 17, 191, 16, 217, 18, 189, 16, 189, 16, 203, 17, 191, 16, 203, 17, 177, 15, 189,
+    16, 205, 17, 175, 15, 191, 16, 191, 16, 177, 15, 129, 169, 138, 196, 249, 104, 251, 190, 198, 135, 181, 125, 227,
+    30, 229, 30, 227, 30, 253, 32, 201, 28, 229, 30, 203, 28, 225, 30, 231, 30, 199, 28, 229, 30, 203, 28, 201, 28, 203,
+    28, 201, 28, 203, 28, 203, 28, 175, 26, 229, 30, 175, 26, 179, 26, 201, 28, 201, 28, 153, 24, 201, 28, 177, 26, 177,
+    26, 177, 26, 177, 26, 175, 26, 179, 26, 175, 26, 151, 24, 153, 24, 175, 26, 177, 26, 151, 24, 153, 24, 175, 26, 255,
+    21, 175, 26, 153, 24, 149, 24, 255, 21, 177, 26, 255, 21, 149, 24, 153, 24, 251, 21, 153, 24, 255, 21, 251, 21, 153,
+    24, 255, 21, 149, 24, 229, 19, 151, 24, 253, 21, 231, 19, 149, 24, 229, 19, 253, 21, 253, 21, 255, 21, 229, 19, 253,
+    21, 253, 21, 229, 19, 229, 19, 253, 21, 229, 19, 227, 19, 255, 21, 201, 17, 255, 21, 229, 19, 227, 19, 229, 19, 201,
+    17, 129, 22, 201, 17, 253, 21, 179, 15, 253, 21, 201, 17, 231, 19, 201, 17, 229, 19, 203, 17, 203, 17, 227, 19, 205,
+    17, 227, 19, 177, 15, 229, 19, 201, 17, 205, 17, 201, 17, 205, 17, 201, 17, 179, 15, 227, 19, 177, 15, 229, 19, 151,
+    13, 229, 19, 177, 15, 203, 17, 203, 17, 177, 15, 177, 15, 203, 17, 179, 15, 201, 17, 177, 15, 179, 15, 201, 17, 179,
+    15, 177, 15, 175, 15, 181, 15, 175, 15, 177, 15, 203, 17, 153, 13, 177, 15, 177, 15, 177, 15, 179, 15, 149, 13, 205,
+    17, 255, 10, 201, 17, 153, 13, 175, 15, 179, 15, 153, 13, 151, 13, 177, 15, 177, 15, 153, 13, 151, 13, 177, 15, 153,
+    13, 151, 13, 151, 13, 179, 15, 151, 13, 151, 13, 153, 13, 153, 13, 175, 15, 255, 10, 153, 13, 177, 15, 253, 10, 153,
+    13, 177, 15, 255, 10, 253, 10, 179, 15, 253, 10, 179, 15, 253, 10, 255, 10, 151, 13, 153, 13, 151, 13, 255, 10, 151,
+    13, 255, 10, 151, 13, 255, 10, 151, 13, 129, 11, 251, 10, 155, 13, 253, 10, 151, 13, 255, 10, 255, 10, 253, 10, 153,
+    13, 229, 8, 151, 13, 153, 13, 227, 8, 255, 10, 153, 13, 229, 8, 151, 13, 229, 8, 151, 13, 231, 8, 151, 13, 227, 8,
+    129, 11, 253, 10, 255, 10, 253, 10, 129, 11, 227, 8, 255, 10, 253, 10, 255, 10, 231, 8, 251, 10, 231, 8, 151, 13,
+    231, 8, 227, 8, 255, 10, 253, 10, 231, 8, 227, 8, 255, 10, 255, 10, 229, 8, 227, 8, 129, 11, 227, 8, 255, 10, 229,
+    8, 229, 8, 253, 10, 205, 6, 153, 13, 201, 6, 255, 10, 203, 6, 129, 11, 251, 10, 205, 6, 229, 8, 255, 10, 227, 8,
+    231, 8, 227, 8, 205, 6, 253, 10, 229, 8, 231, 8, 227, 8, 229, 8, 229, 8, 229, 8, 229, 8, 203, 6, 255, 10, 203, 6,
+    229, 8, 229, 8, 229, 8, 229, 8, 203, 6, 229, 8, 229, 8, 229, 8, 203, 6, 229, 8, 229, 8, 205, 6, 227, 8, 229, 8, 203,
+    6, 231, 8, 201, 6, 231, 8, 227, 8, 205, 6, 227, 8, 205, 6, 229, 8, 203, 6, 229, 8, 203, 6, 205, 6, 227, 8, 229, 8,
+    205, 6, 201, 6, 205, 6, 229, 8, 229, 8, 177, 4, 229, 8, 205, 6, 227, 8, 205, 6, 203, 6, 203, 6, 203, 6, 229, 8, 203,
+    6, 205, 6, 203, 6, 229, 8, 203, 6, 177, 4, 229, 8, 205, 6, 203, 6, 229, 8, 177, 4, 203, 6, 231, 8, 177, 4, 229, 8,
+    177, 4, 229, 8, 179, 4, 229, 8, 177, 4, 203, 6, 229, 8, 179, 4, 203, 6, 205, 6, 201, 6, 205, 6, 203, 6, 203, 6, 177,
+    4, 231, 8, 177, 4, 203, 6, 203, 6, 179, 4, 229, 8, 177, 4, 205, 6, 177, 4, 229, 8, 177, 4, 205, 6, 177, 4, 203, 6,
+    205, 6, 201, 6, 181, 4, 201, 6, 205, 6, 177, 4, 203, 6, 205, 6, 177, 4, 177, 4, 231, 8, 151, 2, 229, 8, 179, 4, 177,
+    4, 203, 6, 205, 6, 177, 4, 203, 6, 177, 4, 181, 4, 201, 6, 203, 6, 181, 4, 175, 4, 205, 6, 177, 4, 203, 6, 179, 4,
+    203, 6, 179, 4, 177, 4, 203, 6, 179, 4, 177, 4, 205, 6, 177, 4, 177, 4, 205, 6, 177, 4, 203, 6, 153, 2, 203, 6, 179,
+    4, 203, 6, 177, 4, 179, 4, 177, 4, 179, 4, 203, 6, 179, 4, 177, 4, 203, 6, 153, 2, 203, 6, 179, 4, 177, 4, 177, 4,
+    205, 6, 153, 2, 201, 6, 181, 4, 175, 4, 179, 4, 179, 4, 177, 4, 179, 4, 203, 6, 151, 2, 205, 6, 151, 2, 205, 6, 177,
+    4, 179, 4, 151, 2, 205, 6, 177, 4, 177, 4, 179, 4, 179, 4, 151, 2, 205, 6, 175, 4, 181, 4, 151, 2, 203, 6, 179, 4,
+    153, 2, 201, 6, 155, 2, 177, 4, 177, 4, 205, 6, 151, 2, 155, 2, 201, 6, 179, 4, 151, 2, 205, 6, 153, 2, 177, 4, 177,
+    4, 179, 4, 153, 2, 177, 4, 203, 6, 153, 2, 153, 2, 203, 6, 153, 2, 203, 6, 0, 203, 6, 179, 4, 151, 2, 179, 4, 179,
+    4, 151, 2, 177, 4, 181, 4, 175, 4, 153, 2, 179, 4, 177, 4, 153, 2, 179, 4, 177, 4, 177, 4, 153, 2, 179, 4, 151, 2,
+    179, 4, 177, 4, 153, 2, 179, 4, 177, 4, 151, 2, 181, 4, 175, 4, 155, 2, 177, 4, 151, 2, 179, 4, 179, 4, 151, 2, 153,
+    2, 203, 6, 1, 201, 6, 153, 2, 153, 2, 179, 4, 177, 4, 151, 2, 155, 2, 177, 4, 177, 4, 153, 2, 177, 4, 155, 2, 151,
+    2, 177, 4, 179, 4, 153, 2, 177, 4, 153, 2, 153, 2, 177, 4, 151, 2, 181, 4, 151, 2, 177, 4, 155, 2, 175, 4, 155, 2,
+    151, 2, 179, 4, 151, 2, 179, 4, 153, 2, 151, 2, 179, 4, 153, 2, 177, 4, 153, 2, 151, 2, 153, 2, 179, 4, 179, 4, 149,
+    2, 155, 2, 153, 2, 177, 4, 151, 2, 155, 2, 177, 4, 151, 2, 155, 2, 175, 4, 155, 2, 151, 2, 179, 4, 151, 2, 155, 2,
+    151, 2, 177, 4, 153, 2, 153, 2, 153, 2, 177, 4, 153, 2, 153, 2, 177, 4, 153, 2, 151, 2, 155, 2, 151, 2, 177, 4, 153,
+    2, 153, 2, 153, 2, 177, 4, 153, 2, 153, 2, 151, 2, 155, 2, 175, 4, 1, 177, 4, 153, 2, 149, 221, 191, 196, 144, 220,
+    1, 215, 149, 142, 211, 204, 240, 1, 229, 8, 2, 231, 8, 177, 4, 177, 4, 231, 8, 2, 231, 8, 177, 4, 177, 4, 179, 4,
+    177, 4, 179, 4, 177, 4, 229, 8, 0, 231, 8, 175, 4, 179, 4, 179, 4, 177, 4, 179, 4, 177, 4, 177, 4, 229, 8, 1, 227,
+    8, 1, 227, 8, 179, 4, 0, 227, 8, 181, 4, 175, 4, 179, 4, 179, 4, 177, 4, 179, 4, 177, 4, 177, 4, 181, 4, 175, 4,
+    179, 4, 177, 4, 179, 4, 179, 4, 177, 4, 177, 4, 229, 8, 1, 175, 4, 181, 4, 175, 4, 181, 4, 175, 4, 1, 229, 8, 177,
+    4, 177, 4, 179, 4, 0, 229, 8, 0, 229, 8, 0, 229, 8, 0, 179, 4, 227, 8, 0, 179, 4, 177, 4, 1, 227, 8, 177, 4, 1, 229,
+    8, 2, 181, 4, 175, 4, 179, 4, 179, 4, 177, 4, 177, 4, 1, 227, 8, 1, 177, 4, 177, 4, 179, 4, 177, 4, 1, 227, 8, 0,
+    179, 4, 177, 4, 179, 4, 177, 4, 0, 179, 4, 177, 4, 179, 4, 177, 4, 179, 4, 2, 179, 4, 179, 4, 177, 4, 177, 4, 1,
+    227, 8, 1, 177, 4, 2, 231, 8, 0, 177, 4, 179, 4, 0, 177, 4, 231, 8, 182, 4, 231, 8, 177, 4, 0, 179, 4, 0, 227, 8, 1,
+    177, 4, 179, 4, 2, 179, 4, 179, 4, 177, 4, 0, 177, 4, 179, 4, 177, 4, 1, 177, 4, 177, 4, 0, 179, 4, 179, 4, 175, 4,
+    1, 177, 4, 179, 4, 0, 177, 4, 179, 4, 2, 231, 8, 180, 4, 229, 8, 0, 179, 4, 177, 4, 0, 179, 4, 2, 231, 8, 180, 4,
+    229, 8, 2, 181, 4, 177, 4, 0, 177, 4, 0, 179, 4, 179, 4, 175, 4, 1, 0, 229, 8, 0, 2, 181, 4, 175, 4, 179, 4, 1, 2,
+    229, 8, 0, 0, 179, 4, 177, 4, 177, 4, 178, 4, 229, 8, 1, 175, 4, 1, 175, 4, 181, 4, 2, 179, 4, 0, 179, 4, 2, 179, 4,
+    177, 4, 1, 175, 4, 1, 179, 4, 2, 179, 4, 177, 4, 0, 179, 4, 0, 177, 4, 0, 179, 4, 2, 181, 4, 175, 4, 1, 2, 231, 8,
+    180, 4, 179, 4, 177, 4, 0, 177, 4, 1, 177, 4, 0, 177, 4, 179, 4, 178, 4, 227, 8, 1, 2, 179, 4, 0, 177, 4, 179, 4,
+    180, 4, 231, 8, 2, 0, 179, 4, 0, 177, 4, 1, 175, 4, 1, 177, 4, 1, 175, 4, 1, 177, 4, 0, 179, 4, 0, 2, 179, 4, 1,
+    175, 4, 179, 4, 178, 4, 227, 8, 178, 4, 179, 4, 177, 4, 0, 0, 179, 4, 177, 4, 180, 4, 231, 8, 182, 4, 181, 4, 177,
+    4, 0, 0, 177, 4, 1, 175, 4, 137, 193, 146, 163, 156, 143, 7, 233, 187, 144, 140, 158, 10, 231, 8, 0, 227, 8, 1, 0,
+    227, 8, 231, 8, 232, 8, 231, 8, 227, 8, 1, 2, 231, 8, 2, 1, 227, 8, 231, 8, 232, 8, 229, 8, 231, 8, 232, 8, 203, 17,
+    228, 8, 227, 8, 0, 229, 8, 0, 1, 227, 8, 0, 229, 8, 0, 0, 0, 229, 8, 1, 227, 8, 0, 0, 227, 8, 1, 0, 229, 8, 0, 229,
+    8, 230, 8, 229, 8, 229, 8, 2, 1, 0, 229, 8, 0, 2, 231, 8, 0, 2, 231, 8, 0, 2, 231, 8, 0, 2, 1, 227, 8, 1, 227, 8, 1,
+    2, 1, 227, 8, 1, 2, 1, 227, 8, 0, 231, 8, 232, 8, 231, 8, 227, 8, 230, 8, 231, 8, 2, 0, 229, 8, 1, 2, 229, 8, 0, 1,
+    2, 0, 229, 8, 0, 229, 8, 230, 8, 231, 8, 2, 229, 8, 230, 8, 229, 8, 0, 229, 8, 230, 8, 229, 8, 0, 0, 229, 8, 0, 0,
+    0, 229, 8, 0, 0, 2, 1, 229, 8, 0, 0, 229, 8, 230, 8, 227, 8, 1, 0, 229, 8, 232, 8, 231, 8, 0, 229, 8, 232, 8, 231,
+    8, 0, 0, 227, 8, 228, 8, 229, 8, 2, 1, 2, 231, 8, 217, 144, 222, 185, 249, 219, 10, 171, 227, 234, 164, 251, 214, 3,
+    2, 0, 0, 203, 17, 0, 1, 2, 203, 17, 204, 17, 203, 17, 0, 0, 203, 17, 204, 17, 203, 17, 204, 17, 201, 17, 205, 17,
+    204, 17, 0, 203, 17, 0, 2, 1, 0, 203, 17, 204, 17, 201, 17, 1, 0, 2, 1, 203, 17, 2, 202, 17, 203, 17, 2, 1, 201, 17,
+    202, 17, 201, 17, 1, 204, 17, 201, 17, 203, 17, 202, 17, 2, 205, 17, 206, 17, 205, 17, 2, 1, 2, 0, 205, 17, 206, 17,
+    203, 17, 202, 17, 201, 17, 0, 1, 2, 0, 203, 17, 202, 17, 201, 17, 204, 17, 203, 17, 1, 197, 186, 226, 232, 179, 245,
+    17, 183, 221, 176, 212, 181, 240, 10, 1, 2, 0, 1, 149, 35, 152, 35, 153, 35, 2, 0, 152, 35, 153, 35, 2, 151, 35,
+    152, 35, 0, 0, 151, 35, 150, 35, 149, 35, 152, 35, 151, 35, 0, 152, 35, 151, 35, 0, 0, 0, 0, 0, 151, 35, 152, 35, 0,
+    0, 129, 251, 144, 138, 191, 194, 3, 173, 251, 149, 240, 147, 137, 54, 173, 70, 174, 70, 175, 70, 2, 174, 70, 175,
+    70, 0, 176, 70, 173, 70, 1, 2, 1, 0, 2, 1, 2, 169, 174, 162, 199, 168, 168, 32, 229, 132, 172, 173, 253, 238, 82, 1,
+    2, 0, 0, 0, 223, 140, 1, 224, 140, 1, 193, 129, 201, 193, 251, 243, 89, 219, 228, 211, 167, 208, 186, 140, 1, 0,
+    189, 153, 2, 188, 153, 2, 235, 154, 180, 159, 237, 185, 179, 3, 207, 177, 133, 179, 170, 163, 25, 193, 205, 215,
+    136, 185, 232, 153, 5, 203, 128, 194, 173, 232, 162, 179, 12,
+    // N2000 (TL3999)
+    196, 222, 190, 169, 246, 242, 190, 214, 128, 1, 207, 250, 166, 198, 214, 169, 192, 214, 128, 1, 247, 248, 178, 146,
+    138, 1, 143, 204, 154, 155, 31, 217, 130, 189, 235, 11, 157, 241, 171, 221, 5, 231, 224, 234, 153, 3, 173, 166, 134,
+    252, 1, 169, 219, 254, 165, 1, 245, 200, 138, 115, 203, 199, 134, 83, 243, 161, 242, 61, 249, 207, 173, 47, 211,
+    146, 133, 37, 165, 143, 194, 29, 187, 171, 243, 23, 253, 247, 207, 19, 179, 229, 167, 16, 199, 128, 218, 13, 157,
+    225, 207, 11, 143, 232, 248, 9, 193, 173, 201, 8, 143, 222, 184, 7, 187, 183, 192, 6, 155, 203, 219, 5, 159, 178,
+    134, 5, 211, 245, 189, 4, 155, 243, 255, 3, 205, 192, 202, 3, 149, 164, 156, 3, 159, 136, 244, 2, 157, 247, 208, 2,
+    217, 136, 178, 2, 197, 238, 150, 2, 231, 230, 254, 1, 143, 182, 233, 1, 181, 175, 214, 1, 149, 172, 197, 1, 133,
+    135, 182, 1, 131, 170, 168, 1, 185, 247, 155, 1, 211, 221, 144, 1, 133, 202, 134, 1, 135, 172, 125, 239, 249, 116,
+    251, 163, 109, 229, 162, 102, 159, 235, 95, 253, 248, 89, 163, 196, 84, 153, 194, 79, 245, 245, 74, 189, 211, 70,
+    245, 219, 66, 191, 135, 63, 155, 213, 59, 213, 193, 56, 211, 201, 53, 245, 234, 50, 185, 165, 48, 227, 243, 45, 245,
+    213, 43, 235, 203, 41, 131, 208, 39, 225, 228, 37, 247, 137, 36, 247, 183, 34, 197, 247, 32, 217, 189, 31, 253, 143,
+    30, 173, 238, 28, 169, 211, 27, 253, 191, 26, 211, 183, 25, 219, 179, 24, 201, 184, 23, 255, 195, 22, 239, 211, 21,
+    169, 234, 20, 159, 134, 20, 217, 167, 19, 169, 203, 18, 203, 245, 17, 155, 164, 17, 135, 213, 16, 175, 139, 16, 231,
+    194, 15, 237, 128, 15, 225, 189, 14, 165, 129, 14, 235, 196, 13, 223, 140, 13, 253, 215, 12, 255, 160, 12, 233, 242,
+    11, 157, 192, 11, 149, 147, 11, 163, 232, 10, 181, 189, 10, 229, 149, 10, 159, 238, 9, 251, 201, 9, 211, 165, 9,
+    189, 130, 9, 205, 226, 8, 219, 194, 8, 245, 163, 8, 145, 133, 8, 225, 234, 7, 135, 205, 7, 239, 180, 7, 189, 154, 7,
+    167, 130, 7, 141, 234, 6, 129, 211, 6, 145, 190, 6, 131, 167, 6, 173, 148, 6, 185, 255, 5, 227, 236, 5, 249, 216, 5,
+    191, 200, 5, 227, 181, 5, 167, 165, 5, 241, 149, 5, 181, 133, 5, 131, 246, 4, 217, 231, 4, 173, 216, 4, 155, 204, 4,
+    235, 188, 4, 225, 176, 4, 209, 164, 4, 189, 151, 4, 171, 139, 4, 177, 128, 4, 161, 244, 3, 189, 235, 3, 165, 222, 3,
+    187, 213, 3, 207, 203, 3, 201, 192, 3, 231, 183, 3, 141, 176, 3, 141, 165, 3, 181, 157, 3, 193, 147, 3, 131, 142, 3,
+    143, 132, 3, 181, 252, 2, 235, 245, 2, 131, 237, 2, 183, 230, 2, 249, 224, 2, 133, 215, 2, 223, 211, 2, 247, 202, 2,
+    187, 197, 2, 237, 190, 2, 173, 185, 2, 237, 179, 2, 161, 173, 2, 227, 167, 2, 173, 163, 2, 225, 156, 2, 189, 153, 2,
+    227, 145, 2, 201, 143, 2, 241, 135, 2, 213, 133, 2, 151, 128, 2, 227, 251, 1, 179, 247, 1, 253, 242, 1, 203, 238, 1,
+    165, 235, 1, 241, 230, 1, 191, 226, 1, 155, 223, 1, 227, 218, 1, 205, 216, 1, 155, 212, 1, 241, 208, 1, 193, 204, 1,
+    167, 202, 1, 129, 199, 1, 217, 195, 1, 181, 192, 1, 255, 187, 1, 131, 188, 1, 193, 182, 1, 169, 180, 1, 155, 179, 1,
+    219, 173, 1, 205, 172, 1, 171, 169, 1, 143, 167, 1, 245, 164, 1, 207, 161, 1, 181, 159, 1, 171, 158, 1, 245, 153, 1,
+    235, 152, 1, 207, 150, 1, 171, 147, 1, 155, 146, 1, 133, 144, 1, 235, 141, 1, 219, 140, 1, 173, 136, 1, 169, 136, 1,
+    145, 134, 1, 235, 130, 1, 235, 130, 1, 209, 128, 1, 183, 126, 159, 124, 159, 124, 235, 119, 249, 120, 209, 117, 197,
+    116, 171, 114, 159, 113, 161, 113, 235, 108, 247, 109, 213, 106, 209, 106, 185, 104, 187, 104, 133, 100, 159, 102,
+    249, 98, 237, 97, 225, 96, 211, 95, 197, 94, 187, 93, 159, 91, 161, 91, 147, 90, 137, 89, 235, 86, 237, 86, 213, 84,
+    223, 85, 189, 82, 183, 82, 189, 82, 147, 79, 161, 80, 135, 78, 135, 78, 239, 75, 237, 75, 239, 75, 211, 73, 201, 72,
+    199, 72, 199, 72, 163, 69, 173, 70, 161, 69, 151, 68, 133, 67, 139, 67, 249, 65, 253, 65, 223, 63, 229, 63, 223, 63,
+    215, 62, 187, 60, 201, 61, 199, 61, 163, 58, 175, 59, 173, 59, 151, 57, 149, 57, 137, 56, 149, 57, 251, 54, 253, 54,
+    239, 53, 239, 53, 227, 52, 225, 52, 227, 52, 201, 50, 213, 51, 189, 49, 201, 50, 189, 49, 187, 49, 163, 47, 187, 49,
+    153, 46, 159, 47, 153, 46, 149, 46, 149, 46, 139, 45, 251, 43, 137, 45, 241, 42, 251, 43, 255, 43, 213, 40, 251, 43,
+    215, 40, 215, 40, 227, 41, 215, 40, 213, 40, 189, 38, 215, 40, 189, 38, 187, 38, 191, 38, 187, 38, 165, 36, 187, 38,
+    165, 36, 175, 37, 151, 35, 163, 36, 163, 36, 151, 35, 139, 34, 149, 35, 139, 34, 137, 34, 255, 32, 135, 34, 255, 32,
+    253, 32, 253, 32, 239, 31, 229, 30, 253, 32, 227, 30, 241, 31, 215, 29, 241, 31, 215, 29, 213, 29, 217, 29, 213, 29,
+    215, 29, 203, 28, 215, 29, 191, 27, 199, 28, 205, 28, 187, 27, 191, 27, 189, 27, 177, 26, 189, 27, 177, 26, 189, 27,
+    165, 25, 175, 26, 165, 25, 177, 26, 163, 25, 153, 24, 175, 26, 151, 24, 153, 24, 149, 24, 165, 25, 139, 23, 151, 24,
+    139, 23, 149, 24, 141, 23, 253, 21, 151, 24, 253, 21, 139, 23, 255, 21, 253, 21, 253, 21, 255, 21, 253, 21, 241, 20,
+    253, 21, 229, 19, 253, 21, 243, 20, 239, 20, 229, 19, 241, 20, 229, 19, 241, 20, 215, 18, 241, 20, 215, 18, 229, 19,
+    227, 19, 217, 18, 215, 18, 229, 19, 201, 17, 231, 19, 201, 17, 215, 18, 217, 18, 201, 17, 205, 17, 201, 17, 217, 18,
+    201, 17, 191, 16, 203, 17, 203, 17, 191, 16, 201, 17, 191, 16, 189, 16, 191, 16, 189, 16, 191, 16, 191, 16, 175, 15,
+    193, 16, 187, 16, 167, 14, 189, 16, 177, 15, 191, 16, 163, 14, 179, 15, 177, 15, 163, 14, 179, 15, 177, 15, 151, 13,
+    191, 16, 153, 13, 175, 15, 153, 13, 177, 15, 153, 13, 163, 14, 165, 14, 153, 13, 163, 14, 153, 13, 163, 14, 153, 13,
+    153, 13, 149, 13, 167, 14, 139, 12, 151, 13, 151, 13, 153, 13, 139, 12, 153, 13, 137, 12, 153, 13, 139, 12, 139, 12,
+    139, 12, 153, 13, 137, 12, 255, 10, 153, 13, 253, 10, 141, 12, 137, 12, 141, 12, 253, 10, 255, 10, 151, 13, 243, 9,
+    137, 12, 129, 11, 253, 10, 255, 10, 253, 10, 255, 10, 139, 12, 243, 9, 253, 10, 243, 9, 137, 12, 243, 9, 241, 9,
+    255, 10, 255, 10, 241, 9, 241, 9, 241, 9, 129, 11, 239, 9, 243, 9, 241, 9, 243, 9, 239, 9, 245, 9, 239, 9, 229, 8,
+    129, 11, 227, 8, 241, 9, 229, 8, 243, 9, 227, 8, 243, 9, 229, 8, 229, 8, 241, 9, 229, 8, 229, 8, 229, 8, 241, 9,
+    217, 7, 241, 9, 217, 7, 241, 9, 217, 7, 229, 8, 227, 8, 217, 7, 243, 9, 215, 7, 215, 7, 231, 8, 229, 8, 215, 7, 215,
+    7, 231, 8, 229, 8, 201, 6, 231, 8, 215, 7, 231, 8, 201, 6, 231, 8, 201, 6, 231, 8, 215, 7, 205, 6, 227, 8, 203, 6,
+    219, 7, 213, 7, 219, 7, 215, 7, 203, 6, 215, 7, 219, 7, 201, 6, 205, 6, 227, 8, 193, 5, 215, 7, 217, 7, 201, 6, 205,
+    6, 217, 7, 203, 6, 203, 6, 203, 6, 205, 6, 215, 7, 203, 6, 205, 6, 189, 5, 217, 7, 203, 6, 205, 6, 201, 6, 193, 172,
+    225, 190, 239, 165, 1, 197, 181, 199, 194, 182, 18, 255, 10, 151, 13, 151, 13, 153, 13, 255, 10, 151, 13, 151, 13,
+    129, 11, 149, 13, 153, 13, 255, 10, 253, 10, 153, 13, 151, 13, 231, 8, 175, 15, 229, 8, 153, 13, 151, 13, 229, 8,
+    153, 13, 253, 10, 153, 13, 227, 8, 153, 13, 255, 10, 253, 10, 231, 8, 175, 15, 231, 8, 253, 10, 255, 10, 253, 10,
+    255, 10, 255, 10, 229, 8, 151, 13, 255, 10, 229, 8, 255, 10, 253, 10, 229, 8, 153, 13, 229, 8, 227, 8, 153, 13, 229,
+    8, 229, 8, 255, 10, 253, 10, 255, 10, 203, 6, 153, 13, 201, 6, 155, 13, 201, 6, 255, 10, 255, 10, 229, 8, 227, 8,
+    129, 11, 201, 6, 153, 13, 205, 6, 253, 10, 229, 8, 227, 8, 231, 8, 229, 8, 253, 10, 231, 8, 227, 8, 229, 8, 231, 8,
+    227, 8, 229, 8, 229, 8, 255, 10, 203, 6, 229, 8, 227, 8, 231, 8, 229, 8, 229, 8, 203, 6, 253, 10, 205, 6, 255, 10,
+    201, 6, 205, 6, 255, 10, 203, 6, 229, 8, 227, 8, 231, 8, 203, 6, 229, 8, 203, 6, 255, 10, 177, 4, 255, 10, 203, 6,
+    203, 6, 229, 8, 231, 8, 201, 6, 231, 8, 201, 6, 231, 8, 203, 6, 227, 8, 205, 6, 203, 6, 229, 8, 205, 6, 227, 8, 205,
+    6, 201, 6, 231, 8, 203, 6, 203, 6, 229, 8, 203, 6, 205, 6, 201, 6, 231, 8, 203, 6, 203, 6, 203, 6, 203, 6, 231, 8,
+    201, 6, 205, 6, 203, 6, 203, 6, 205, 6, 203, 6, 203, 6, 227, 8, 181, 4, 227, 8, 179, 4, 227, 8, 181, 4, 227, 8, 177,
+    4, 231, 8, 177, 4, 203, 6, 229, 8, 179, 4, 203, 6, 203, 6, 203, 6, 179, 4, 229, 8, 177, 4, 203, 6, 205, 6, 203, 6,
+    203, 6, 177, 4, 205, 6, 203, 6, 203, 6, 179, 4, 201, 6, 207, 6, 175, 4, 231, 8, 177, 4, 177, 4, 205, 6, 201, 6, 205,
+    6, 179, 4, 177, 4, 229, 8, 177, 4, 179, 4, 205, 6, 201, 6, 179, 4, 203, 6, 177, 4, 205, 6, 177, 4, 205, 6, 201, 6,
+    153, 2, 231, 8, 151, 2, 229, 8, 153, 2, 201, 6, 207, 6, 175, 4, 179, 4, 205, 6, 175, 4, 181, 4, 201, 6, 179, 4, 203,
+    6, 179, 4, 177, 4, 203, 6, 179, 4, 177, 4, 179, 4, 203, 6, 179, 4, 177, 4, 203, 6, 177, 4, 179, 4, 179, 4, 203, 6,
+    177, 4, 179, 4, 177, 4, 179, 4, 201, 6, 155, 2, 203, 6, 177, 4, 205, 6, 151, 2, 179, 4, 203, 6, 177, 4, 179, 4, 177,
+    4, 179, 4, 177, 4, 179, 4, 177, 4, 205, 6, 151, 2, 205, 6, 151, 2, 203, 6, 153, 2, 205, 6, 151, 2, 203, 6, 179, 4,
+    151, 2, 205, 6, 151, 2, 205, 6, 151, 2, 205, 6, 151, 2, 179, 4, 203, 6, 153, 2, 177, 4, 179, 4, 177, 4, 179, 4, 151,
+    2, 205, 6, 151, 2, 205, 6, 151, 2, 179, 4, 177, 4, 153, 2, 203, 6, 153, 2, 203, 6, 153, 2, 153, 2, 203, 6, 177, 4,
+    153, 2, 177, 4, 179, 4, 153, 2, 177, 4, 205, 6, 2, 205, 6, 151, 2, 179, 4, 177, 4, 179, 4, 153, 2, 177, 4, 153, 2,
+    203, 6, 151, 2, 155, 2, 201, 6, 155, 2, 177, 4, 151, 2, 179, 4, 179, 4, 151, 2, 179, 4, 177, 4, 153, 2, 177, 4, 155,
+    2, 175, 4, 179, 4, 153, 2, 179, 4, 177, 4, 151, 2, 153, 2, 179, 4, 177, 4, 153, 2, 179, 4, 177, 4, 151, 2, 155, 2,
+    177, 4, 177, 4, 153, 2, 179, 4, 151, 2, 153, 2, 179, 4, 177, 4, 151, 2, 181, 4, 151, 2, 177, 4, 153, 2, 153, 2, 177,
+    4, 179, 4, 0, 203, 6, 153, 2, 153, 2, 151, 2, 203, 6, 1, 177, 4, 151, 2, 181, 4, 151, 2, 177, 4, 153, 2, 153, 2,
+    177, 4, 153, 2, 153, 2, 177, 4, 153, 2, 179, 4, 151, 2, 153, 2, 179, 4, 151, 2, 153, 2, 177, 4, 153, 2, 153, 2, 179,
+    4, 151, 2, 151, 2, 181, 4, 151, 2, 153, 2, 151, 2, 179, 4, 153, 2, 177, 4, 0, 179, 4, 151, 2, 179, 4, 153, 2, 151,
+    2, 153, 2, 153, 2, 177, 4, 153, 2, 153, 2, 177, 4, 153, 2, 0, 205, 6, 2, 179, 4, 2, 179, 4, 179, 4, 0, 177, 4, 0,
+    179, 4, 177, 4, 0, 151, 2, 181, 4, 151, 2, 151, 2, 155, 2, 177, 4, 0, 177, 4, 153, 2, 153, 2, 153, 2, 151, 2, 155,
+    2, 175, 4, 1, 177, 4, 153, 2, 151, 2, 153, 2, 153, 2, 179, 4, 2, 179, 4, 0, 179, 4, 151, 2, 153, 2, 153, 2, 151, 2,
+    153, 2, 153, 2, 153, 2, 151, 2, 179, 4, 0, 177, 4, 0, 179, 4, 0, 177, 4, 153, 2, 153, 2, 2, 181, 4, 151, 2, 151, 2,
+    155, 2, 151, 2, 0, 179, 4, 151, 2, 153, 2, 153, 2, 153, 2, 151, 2, 153, 2, 153, 2, 151, 2, 153, 2, 1, 175, 4, 155,
+    2, 151, 2, 0, 179, 4, 151, 2, 1, 177, 4, 151, 2, 1, 151, 2, 179, 4, 0, 153, 2, 177, 4, 0, 153, 2, 151, 2, 153, 2, 1,
+    175, 4, 155, 2, 2, 179, 4, 0, 179, 4, 2, 153, 2, 153, 2, 153, 2, 0, 177, 4, 153, 2, 2, 155, 2, 177, 4, 0, 153, 2, 0,
+    177, 4, 153, 2, 0, 153, 2, 177, 4, 0, 1, 175, 4, 155, 2, 2, 153, 2, 153, 2, 153, 2, 151, 2, 153, 2, 1, 149, 2, 155,
+    2, 151, 2, 155, 2, 2, 177, 4, 1, 151, 2, 153, 2, 0, 179, 4, 2, 153, 2, 153, 2, 0, 179, 4, 2, 153, 2, 1, 175, 4, 1,
+    151, 2, 155, 2, 149, 2, 1, 179, 4, 156, 2, 179, 4, 153, 2, 0, 153, 2, 151, 2, 0, 153, 2, 153, 2, 153, 2, 151, 2, 0,
+    153, 2, 153, 2, 0, 151, 2, 153, 2, 153, 2, 0, 153, 2, 151, 2, 153, 2, 1, 151, 2, 151, 2, 1, 151, 2, 153, 2, 153, 2,
+    0, 153, 2, 151, 2, 0, 153, 2, 153, 2, 153, 2, 2, 153, 2, 1, 151, 2, 151, 2, 155, 2, 2, 155, 2, 151, 2, 0, 151, 2,
+    155, 2, 2, 153, 2, 153, 2, 0, 153, 2, 151, 2, 1, 151, 2, 0, 177, 4, 1, 0, 151, 2, 153, 2, 153, 2, 0, 151, 2, 1, 151,
+    2, 153, 2, 0, 153, 2, 151, 2, 1, 151, 2, 0, 153, 2, 153, 2, 0, 151, 2, 153, 2, 0, 153, 2, 0, 153, 2, 151, 2, 1, 151,
+    2, 0, 153, 2, 151, 2, 1, 151, 2, 1, 151, 2, 153, 2, 2, 1, 179, 4, 2, 0, 153, 2, 153, 2, 0, 151, 2, 1, 151, 2, 153,
+    2, 0, 153, 2, 2, 155, 2, 2, 155, 2, 2, 153, 2, 151, 2, 1, 151, 2, 1, 151, 2, 0, 153, 2, 0, 153, 2, 151, 2, 0, 153,
+    2, 0, 153, 2, 0, 0, 177, 4, 1, 2, 153, 2, 0, 153, 2, 151, 2, 1, 2, 155, 2, 151, 2, 0, 0, 151, 2, 155, 2, 2, 153, 2,
+    1, 2, 179, 4, 154, 2, 151, 2, 155, 2, 2, 153, 2, 0, 153, 2, 0, 0, 153, 2, 151, 2, 0, 155, 2, 2, 0, 153, 2, 151, 2,
+    1, 221, 159, 192, 167, 130, 130, 2, 161, 253, 167, 219, 201, 110, 179, 4, 1, 2, 177, 4, 1, 177, 4, 0, 179, 4, 2,
+    179, 4, 0, 179, 4, 2, 1, 177, 4, 177, 4, 0, 1, 177, 4, 0, 177, 4, 1, 175, 4, 1, 0, 177, 4, 1, 177, 4, 177, 4, 178,
+    4, 229, 8, 180, 4, 179, 4, 177, 4, 0, 0, 179, 4, 0, 177, 4, 0, 0, 179, 4, 0, 177, 4, 0, 179, 4, 2, 179, 4, 178, 4,
+    227, 8, 176, 4, 227, 8, 180, 4, 179, 4, 179, 4, 180, 4, 177, 4, 179, 4, 0, 179, 4, 180, 4, 229, 8, 180, 4, 179, 4,
+    177, 4, 1, 2, 1, 177, 4, 177, 4, 0, 1, 2, 179, 4, 177, 4, 1, 2, 0, 179, 4, 177, 4, 178, 4, 177, 4, 179, 4, 0, 0,
+    177, 4, 0, 0, 179, 4, 0, 2, 179, 4, 1, 175, 4, 1, 0, 177, 4, 0, 177, 4, 178, 4, 179, 4, 177, 4, 0, 0, 179, 4, 2, 1,
+    177, 4, 0, 0, 177, 4, 1, 177, 4, 180, 4, 179, 4, 179, 4, 2, 1, 177, 4, 180, 4, 229, 8, 178, 4, 179, 4, 2, 179, 4, 0,
+    0, 177, 4, 0, 1, 177, 4, 2, 1, 177, 4, 1, 2, 0, 179, 4, 177, 4, 178, 4, 177, 4, 1, 175, 4, 1, 0, 177, 4, 178, 4,
+    227, 8, 178, 4, 179, 4, 0, 177, 4, 178, 4, 177, 4, 177, 4, 176, 4, 175, 4, 179, 4, 178, 4, 177, 4, 179, 4, 180, 4,
+    177, 4, 1, 177, 4, 180, 4, 231, 8, 180, 4, 177, 4, 1, 2, 1, 177, 4, 0, 177, 4, 1, 2, 1, 177, 4, 0, 0, 0, 177, 4, 0,
+    179, 4, 178, 4, 177, 4, 177, 4, 178, 4, 177, 4, 1, 2, 179, 4, 0, 2, 181, 4, 2, 0, 1, 177, 4, 180, 4, 229, 8, 178, 4,
+    177, 4, 0, 1, 175, 4, 176, 4, 175, 4, 181, 4, 182, 4, 181, 4, 2, 179, 4, 180, 4, 177, 4, 1, 177, 4, 0, 1, 2, 0, 179,
+    4, 2, 1, 177, 4, 0, 0, 0, 0, 179, 4, 0, 2, 179, 4, 0, 0, 0, 179, 4, 180, 4, 179, 4, 177, 4, 180, 4, 179, 4, 0, 0,
+    179, 4, 180, 4, 177, 4, 179, 4, 178, 4, 177, 4, 0, 0, 0, 177, 4, 0, 1, 2, 179, 4, 178, 4, 177, 4, 177, 4, 178, 4,
+    177, 4, 1, 2, 0, 179, 4, 0, 0, 0, 177, 4, 178, 4, 177, 4, 179, 4, 178, 4, 175, 4, 176, 4, 227, 8, 178, 4, 0, 177, 4,
+    0, 1, 2, 179, 4, 2, 1, 0, 0, 177, 4, 0, 0, 1, 175, 4, 176, 4, 175, 4, 1, 177, 4, 178, 4, 177, 4, 0, 1, 2, 177, 4,
+    176, 4, 175, 4, 1, 177, 4, 178, 4, 177, 4, 0, 0, 0, 179, 4, 180, 4, 179, 4, 2, 179, 4, 178, 4, 177, 4, 0, 0, 0, 0,
+    179, 4, 0, 2, 1, 2, 179, 4, 0, 178, 4, 227, 8, 178, 4, 0, 179, 4, 2, 1, 0, 2, 179, 4, 0, 178, 4, 227, 8, 178, 4, 0,
+    177, 4, 1, 2, 1, 2, 1, 133, 198, 129, 163, 220, 73, 251, 206, 210, 226, 187, 151, 5, 0, 0, 0, 229, 8, 0, 232, 8,
+    231, 8, 229, 8, 230, 8, 0, 229, 8, 2, 1, 0, 0, 227, 8, 228, 8, 229, 8, 0, 2, 231, 8, 230, 8, 227, 8, 228, 8, 229, 8,
+    0, 2, 231, 8, 230, 8, 227, 8, 1, 2, 1, 0, 227, 8, 228, 8, 227, 8, 1, 0, 2, 231, 8, 232, 8, 231, 8, 232, 8, 231, 8,
+    2, 231, 8, 232, 8, 231, 8, 230, 8, 227, 8, 0, 1, 2, 231, 8, 232, 8, 231, 8, 2, 228, 8, 227, 8, 229, 8, 228, 8, 2,
+    231, 8, 2, 0, 1, 2, 1, 2, 229, 8, 1, 232, 8, 229, 8, 1, 227, 8, 230, 8, 1, 227, 8, 0, 228, 8, 227, 8, 0, 229, 8,
+    228, 8, 2, 229, 8, 0, 228, 8, 227, 8, 0, 229, 8, 230, 8, 1, 227, 8, 0, 230, 8, 229, 8, 1, 2, 229, 8, 230, 8, 0, 229,
+    8, 1, 2, 230, 8, 203, 17, 230, 8, 0, 0, 229, 8, 228, 8, 227, 8, 0, 0, 0, 0, 0, 229, 8, 230, 8, 229, 8, 230, 8, 229,
+    8, 0, 0, 0, 0, 229, 8, 230, 8, 229, 8, 230, 8, 229, 8, 0, 0, 0, 0, 0, 0, 229, 8, 230, 8, 229, 8, 230, 8, 229, 8, 0,
+    0, 0, 0, 0, 229, 8, 232, 8, 231, 8, 230, 8, 229, 8, 0, 0, 0, 0, 0, 2, 1, 229, 8, 230, 8, 229, 8, 0, 230, 8, 227, 8,
+    1, 0, 0, 0, 227, 8, 228, 8, 0, 229, 8, 230, 8, 139, 129, 149, 165, 168, 186, 3, 187, 234, 148, 230, 135, 136, 8, 2,
+    202, 17, 201, 17, 1, 201, 17, 202, 17, 0, 2, 205, 17, 206, 17, 205, 17, 206, 17, 205, 17, 2, 0, 1, 2, 1, 2, 1, 2,
+    205, 17, 206, 17, 203, 17, 202, 17, 201, 17, 1, 206, 17, 203, 17, 1, 2, 0, 1, 2, 1, 201, 17, 204, 17, 1, 201, 17,
+    204, 17, 203, 17, 202, 17, 201, 17, 0, 1, 2, 0, 204, 17, 153, 35, 206, 17, 0, 0, 1, 201, 17, 204, 17, 0, 203, 17,
+    202, 17, 201, 17, 204, 17, 203, 17, 0, 1, 206, 17, 203, 17, 0, 0, 0, 1, 2, 203, 17, 204, 17, 0, 0, 203, 17, 202, 17,
+    2, 203, 17, 204, 17, 203, 17, 0, 204, 17, 203, 17, 0, 204, 17, 203, 17, 1, 133, 252, 212, 170, 192, 155, 9, 181,
+    161, 255, 235, 159, 233, 13, 0, 1, 2, 0, 0, 0, 0, 151, 35, 152, 35, 0, 0, 151, 35, 152, 35, 151, 35, 152, 35, 151,
+    35, 152, 35, 151, 35, 150, 35, 147, 35, 148, 35, 147, 35, 1, 0, 152, 35, 151, 35, 0, 0, 152, 35, 151, 35, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 1, 151, 35, 152, 35, 0, 253, 174, 206, 204, 208, 226, 43, 147, 175, 218, 224, 239, 166, 2, 1, 175,
+    70, 176, 70, 2, 177, 70, 176, 70, 2, 177, 70, 176, 70, 0, 173, 70, 174, 70, 0, 173, 70, 174, 70, 173, 70, 174, 70,
+    175, 70, 178, 70, 177, 70, 171, 249, 160, 227, 176, 231, 66, 169, 137, 177, 247, 207, 171, 25, 222, 140, 1, 221,
+    140, 1, 224, 140, 1, 223, 140, 1, 222, 140, 1, 221, 140, 1, 224, 140, 1, 223, 140, 1, 0, 251, 237, 200, 144, 241,
+    240, 112, 175, 151, 219, 164, 144, 181, 71, 186, 153, 2, 185, 153, 2, 1, 197, 222, 245, 181, 240, 221, 20, 147, 172,
+    210, 180, 146, 238, 219, 2, 248, 178, 4, 167, 176, 160, 235, 241, 131, 205, 1, 135, 152, 244, 233, 147, 148, 148, 4,
+    231, 217, 198, 128, 239, 183, 220, 14,
+    // N4000 (TL7999)
+    254, 153, 194, 204, 186, 185, 191, 214, 128, 1, 153, 235, 190, 184, 235, 148, 192, 214, 128, 1, 157, 141, 224, 137,
+    69, 253, 166, 221, 205, 15, 133, 201, 228, 245, 5, 175, 237, 216, 238, 2, 145, 133, 247, 204, 1, 221, 146, 132, 126,
+    227, 129, 128, 83, 245, 224, 197, 57, 189, 204, 195, 41, 201, 179, 249, 30, 139, 255, 214, 23, 241, 218, 194, 18,
+    205, 151, 225, 14, 245, 226, 249, 11, 227, 132, 232, 9, 251, 250, 147, 8, 179, 135, 237, 6, 157, 247, 231, 5, 255,
+    184, 252, 4, 217, 219, 164, 4, 217, 176, 220, 3, 159, 161, 160, 3, 229, 231, 237, 2, 169, 155, 195, 2, 203, 253,
+    158, 2, 169, 252, 255, 1, 239, 160, 229, 1, 163, 148, 206, 1, 167, 134, 186, 1, 207, 187, 168, 1, 141, 135, 153, 1,
+    147, 182, 139, 1, 149, 182, 127, 147, 220, 116, 217, 151, 107, 153, 215, 98, 191, 131, 91, 157, 151, 84, 147, 251,
+    77, 177, 175, 72, 201, 165, 67, 157, 216, 62, 163, 187, 58, 137, 211, 54, 191, 146, 51, 137, 245, 47, 145, 254, 44,
+    191, 160, 42, 221, 226, 39, 251, 186, 37, 165, 170, 35, 191, 174, 33, 153, 195, 31, 205, 234, 29, 177, 161, 28, 175,
+    229, 26, 187, 181, 25, 231, 147, 24, 229, 248, 22, 135, 236, 21, 231, 228, 20, 201, 232, 19, 131, 244, 18, 225, 130,
+    18, 219, 158, 17, 201, 185, 16, 189, 224, 15, 185, 135, 15, 151, 183, 14, 153, 234, 13, 197, 160, 13, 151, 218, 12,
+    191, 155, 12, 221, 219, 11, 197, 162, 11, 179, 233, 10, 215, 181, 10, 145, 131, 10, 237, 211, 9, 211, 165, 9, 241,
+    251, 8, 129, 209, 8, 195, 170, 8, 157, 134, 8, 251, 225, 7, 225, 190, 7, 137, 161, 7, 129, 255, 6, 193, 227, 6, 231,
+    197, 6, 199, 172, 6, 131, 145, 6, 225, 247, 5, 215, 224, 5, 213, 202, 5, 203, 179, 5, 217, 158, 5, 243, 138, 5, 143,
+    247, 4, 193, 229, 4, 223, 209, 4, 171, 194, 4, 223, 176, 4, 185, 162, 4, 237, 144, 4, 201, 130, 4, 175, 245, 3, 151,
+    232, 3, 227, 216, 3, 229, 205, 3, 205, 192, 3, 205, 181, 3, 191, 169, 3, 205, 159, 3, 195, 147, 3, 195, 136, 3, 245,
+    129, 3, 221, 244, 2, 131, 237, 2, 159, 228, 2, 183, 219, 2, 211, 210, 2, 249, 202, 2, 147, 194, 2, 199, 187, 2, 237,
+    179, 2, 135, 171, 2, 227, 167, 2, 237, 157, 2, 177, 152, 2, 225, 145, 2, 163, 140, 2, 215, 133, 2, 151, 128, 2, 203,
+    249, 1, 163, 246, 1, 217, 239, 1, 139, 233, 1, 241, 230, 1, 179, 225, 1, 229, 218, 1, 191, 215, 1, 143, 211, 1, 215,
+    206, 1, 169, 202, 1, 255, 198, 1, 193, 193, 1, 155, 190, 1, 243, 186, 1, 195, 182, 1, 169, 180, 1, 229, 174, 1, 209,
+    172, 1, 169, 169, 1, 129, 166, 1, 207, 161, 1, 197, 160, 1, 141, 156, 1, 133, 155, 1, 195, 149, 1, 181, 148, 1, 147,
+    145, 1, 245, 142, 1, 221, 140, 1, 171, 136, 1, 171, 136, 1, 247, 131, 1, 235, 130, 1, 197, 127, 183, 126, 145, 123,
+    135, 122, 233, 119, 199, 116, 183, 115, 173, 114, 133, 111, 237, 108, 235, 108, 209, 106, 175, 103, 171, 103, 133,
+    100, 137, 100, 235, 97, 223, 96, 187, 93, 185, 93, 173, 92, 147, 90, 251, 87, 251, 87, 235, 86, 213, 84, 185, 82,
+    201, 83, 159, 80, 163, 80, 133, 78, 137, 78, 237, 75, 227, 74, 223, 74, 213, 73, 175, 70, 185, 71, 175, 70, 163, 69,
+    135, 67, 135, 67, 253, 65, 237, 64, 239, 64, 213, 62, 213, 62, 201, 61, 187, 60, 175, 59, 187, 60, 151, 57, 147, 57,
+    151, 57, 137, 56, 249, 54, 255, 54, 225, 52, 239, 53, 215, 51, 225, 52, 201, 50, 189, 49, 201, 50, 175, 48, 187, 49,
+    151, 46, 177, 48, 161, 47, 137, 45, 137, 45, 151, 46, 239, 42, 139, 45, 239, 42, 225, 41, 241, 42, 229, 41, 225, 41,
+    201, 39, 229, 41, 187, 38, 203, 39, 187, 38, 189, 38, 191, 38, 175, 37, 163, 36, 175, 37, 153, 35, 175, 37, 137, 34,
+    151, 35, 139, 34, 149, 35, 255, 32, 135, 34, 243, 31, 253, 32, 251, 32, 243, 31, 225, 30, 243, 31, 227, 30, 213, 29,
+    243, 31, 201, 28, 215, 29, 213, 29, 205, 28, 201, 28, 203, 28, 187, 27, 205, 28, 189, 27, 175, 26, 177, 26, 191, 27,
+    175, 26, 165, 25, 177, 26, 163, 25, 165, 25, 163, 25, 153, 24, 149, 24, 165, 25, 139, 23, 149, 24, 141, 23, 151, 24,
+    253, 21, 137, 23, 141, 23, 239, 20, 153, 24, 239, 20, 243, 20, 137, 23, 229, 19, 255, 21, 239, 20, 243, 20, 227, 19,
+    241, 20, 227, 19, 231, 19, 227, 19, 227, 19, 217, 18, 229, 19, 213, 18, 217, 18, 217, 18, 213, 18, 217, 18, 203, 17,
+    215, 18, 189, 16, 217, 18, 189, 16, 217, 18, 189, 16, 191, 16, 201, 17, 179, 15, 203, 17, 189, 16, 191, 16, 175, 15,
+    193, 16, 175, 15, 191, 16, 179, 15, 163, 14, 189, 16, 167, 14, 187, 16, 155, 13, 175, 15, 179, 15, 151, 13, 177, 15,
+    165, 14, 153, 13, 163, 14, 165, 14, 165, 14, 151, 13, 153, 13, 163, 14, 153, 13, 139, 12, 165, 14, 137, 12, 167, 14,
+    139, 12, 137, 12, 153, 13, 141, 12, 149, 13, 141, 12, 253, 10, 153, 13, 139, 12, 139, 12, 253, 10, 141, 12, 253, 10,
+    141, 12, 137, 12, 255, 10, 255, 10, 255, 10, 253, 10, 255, 10, 139, 12, 241, 9, 241, 9, 141, 12, 241, 9, 255, 10,
+    239, 9, 129, 11, 229, 8, 137, 12, 231, 8, 253, 10, 229, 8, 255, 10, 229, 8, 241, 9, 243, 9, 241, 9, 241, 9, 229, 8,
+    229, 8, 255, 10, 215, 7, 243, 9, 227, 8, 231, 8, 241, 9, 215, 7, 243, 9, 227, 8, 219, 7, 239, 9, 217, 7, 231, 8,
+    227, 8, 215, 7, 231, 8, 227, 8, 219, 7, 213, 7, 231, 8, 215, 7, 229, 8, 205, 6, 227, 8, 217, 7, 217, 7, 215, 7, 215,
+    7, 219, 7, 215, 7, 215, 7, 217, 7, 203, 6, 217, 7, 203, 6, 229, 8, 191, 5, 229, 8, 203, 6, 203, 6, 217, 7, 201, 6,
+    207, 6, 201, 6, 217, 7, 203, 6, 205, 6, 201, 6, 217, 7, 193, 5, 201, 6, 203, 6, 217, 7, 179, 4, 215, 7, 203, 6, 191,
+    5, 205, 6, 201, 6, 193, 5, 203, 6, 201, 6, 193, 5, 191, 5, 215, 7, 177, 4, 205, 6, 191, 5, 203, 6, 177, 4, 217, 7,
+    177, 4, 193, 5, 201, 6, 191, 5, 193, 5, 189, 5, 189, 5, 193, 5, 191, 5, 189, 5, 179, 4, 203, 6, 191, 5, 177, 4, 191,
+    5, 191, 5, 191, 5, 179, 4, 189, 5, 191, 5, 177, 4, 193, 5, 189, 5, 179, 4, 177, 4, 191, 5, 191, 5, 165, 3, 203, 6,
+    165, 3, 191, 5, 191, 5, 165, 3, 191, 5, 191, 5, 165, 3, 191, 5, 165, 3, 189, 5, 179, 4, 191, 5, 167, 3, 175, 4, 191,
+    5, 167, 3, 177, 4, 191, 5, 165, 3, 177, 4, 179, 4, 177, 4, 179, 4, 179, 4, 163, 3, 179, 4, 177, 4, 179, 4, 179, 4,
+    163, 3, 179, 4, 165, 3, 191, 5, 151, 2, 193, 5, 163, 3, 167, 3, 177, 4, 179, 4, 163, 3, 181, 4, 163, 3, 179, 4, 165,
+    3, 165, 3, 177, 4, 167, 3, 163, 3, 179, 4, 167, 3, 175, 4, 167, 3, 165, 3, 165, 3, 165, 3, 179, 4, 165, 3, 163, 3,
+    167, 3, 179, 4, 151, 2, 179, 4, 163, 3, 167, 3, 153, 2, 177, 4, 165, 3, 165, 3, 167, 3, 163, 3, 167, 3, 163, 3, 167,
+    3, 165, 3, 153, 2, 177, 4, 153, 2, 177, 4, 153, 2, 165, 3, 165, 3, 153, 2, 179, 4, 151, 2, 165, 3, 167, 3, 151, 2,
+    165, 3, 167, 3, 163, 3, 153, 2, 167, 3, 151, 2, 177, 4, 141, 1, 179, 4, 151, 2, 165, 3, 153, 2, 165, 3, 153, 2, 165,
+    3, 153, 2, 163, 3, 167, 3, 153, 2, 151, 2, 167, 3, 151, 2, 165, 3, 153, 2, 153, 2, 177, 4, 141, 1, 165, 3, 151, 2,
+    153, 2, 167, 3, 151, 2, 165, 3, 153, 2, 151, 2, 155, 2, 163, 3, 153, 2, 153, 2, 153, 2, 165, 3, 151, 2, 153, 2, 167,
+    3, 139, 1, 163, 3, 155, 2, 151, 2, 153, 2, 167, 3, 137, 1, 167, 3, 151, 2, 141, 1, 165, 3, 151, 2, 167, 3, 139, 1,
+    153, 2, 151, 2, 167, 3, 139, 1, 153, 2, 165, 3, 139, 1, 165, 3, 141, 1, 151, 2, 167, 3, 139, 1, 151, 2, 155, 2, 163,
+    3, 141, 1, 139, 1, 167, 3, 151, 2, 153, 2, 139, 1, 165, 3, 141, 1, 151, 2, 153, 2, 153, 2, 139, 1, 167, 3, 137, 1,
+    155, 2, 151, 2, 141, 1, 163, 3, 141, 1, 153, 2, 153, 2, 137, 1, 155, 2, 151, 2, 153, 2, 141, 1, 165, 3, 2, 167, 3,
+    139, 1, 153, 2, 151, 2, 141, 1, 153, 2, 139, 1, 151, 2, 155, 2, 151, 2, 141, 1, 151, 2, 139, 1, 155, 2, 151, 2, 141,
+    1, 137, 1, 167, 3, 141, 1, 139, 1, 151, 2, 153, 2, 141, 1, 139, 1, 165, 3, 0, 165, 3, 0, 165, 3, 1, 163, 3, 0, 167,
+    3, 2, 155, 2, 151, 2, 139, 1, 153, 2, 139, 1, 141, 1, 153, 2, 139, 1, 151, 2, 141, 1, 153, 2, 139, 1, 141, 1, 151,
+    2, 139, 1, 155, 2, 137, 1, 141, 1, 153, 2, 139, 1, 141, 1, 151, 2, 141, 1, 139, 1, 153, 2, 139, 1, 153, 2, 2, 155,
+    2, 151, 2, 1, 151, 2, 153, 2, 2, 155, 2, 139, 1, 151, 2, 1, 151, 2, 141, 1, 153, 2, 2, 153, 2, 153, 2, 0, 153, 2, 0,
+    151, 2, 153, 2, 1, 149, 2, 143, 1, 137, 1, 141, 1, 153, 2, 0, 151, 2, 141, 1, 141, 1, 151, 2, 0, 151, 2, 141, 1,
+    141, 1, 139, 1, 139, 1, 153, 2, 0, 151, 2, 1, 151, 2, 141, 1, 139, 1, 153, 2, 0, 139, 1, 153, 2, 0, 153, 2, 139, 1,
+    139, 1, 141, 1, 139, 1, 141, 1, 139, 1, 139, 1, 141, 1, 139, 1, 153, 2, 0, 139, 1, 153, 2, 2, 155, 2, 0, 151, 2, 0,
+    153, 2, 1, 149, 2, 1, 153, 2, 2, 155, 2, 2, 153, 2, 0, 153, 2, 0, 151, 2, 1, 139, 1, 151, 2, 1, 139, 1, 139, 1, 141,
+    1, 139, 1, 139, 1, 141, 1, 139, 1, 141, 1, 0, 151, 2, 0, 153, 2, 0, 141, 1, 151, 2, 0, 141, 1, 2, 153, 2, 141, 1, 0,
+    151, 2, 0, 141, 1, 139, 1, 141, 1, 137, 1, 143, 1, 2, 139, 1, 155, 2, 2, 141, 1, 2, 155, 2, 2, 153, 2, 1, 137, 1,
+    141, 1, 0, 153, 2, 2, 141, 1, 141, 1, 137, 1, 1, 153, 2, 2, 141, 1, 0, 151, 2, 1, 139, 1, 139, 1, 141, 1, 139, 1, 0,
+    139, 1, 141, 1, 0, 153, 2, 2, 141, 1, 0, 153, 2, 2, 141, 1, 141, 1, 2, 141, 1, 139, 1, 139, 1, 1, 151, 2, 140, 1,
+    151, 2, 141, 1, 0, 0, 153, 2, 0, 139, 1, 139, 1, 1, 151, 2, 140, 1, 151, 2, 1, 139, 1, 139, 1, 0, 141, 1, 139, 1,
+    139, 1, 1, 2, 153, 2, 0, 141, 1, 139, 1, 0, 139, 1, 0, 153, 2, 0, 0, 139, 1, 141, 1, 139, 1, 0, 141, 1, 137, 1, 1,
+    139, 1, 0, 141, 1, 139, 1, 0, 153, 2, 142, 1, 153, 2, 0, 0, 139, 1, 141, 1, 139, 1, 0, 141, 1, 2, 141, 1, 139, 1, 1,
+    137, 1, 1, 139, 1, 139, 1, 0, 141, 1, 0, 139, 1, 139, 1, 1, 139, 1, 0, 139, 1, 139, 1, 1, 139, 1, 0, 139, 1, 141, 1,
+    2, 141, 1, 0, 141, 1, 2, 141, 1, 139, 1, 0, 0, 153, 2, 0, 0, 139, 1, 0, 141, 1, 139, 1, 0, 139, 1, 1, 137, 1, 1,
+    139, 1, 0, 141, 1, 139, 1, 2, 1, 139, 1, 141, 1, 2, 141, 1, 0, 141, 1, 2, 141, 1, 2, 141, 1, 0, 141, 1, 2, 141, 1,
+    0, 139, 1, 139, 1, 1, 2, 141, 1, 0, 139, 1, 141, 1, 0, 2, 141, 1, 0, 141, 1, 137, 1, 1, 0, 139, 1, 0, 139, 1, 1,
+    139, 1, 2, 143, 1, 2, 139, 1, 1, 139, 1, 0, 139, 1, 0, 1, 137, 1, 141, 1, 1, 2, 139, 1, 0, 141, 1, 0, 139, 1, 0,
+    141, 1, 2, 1, 139, 1, 139, 1, 0, 0, 141, 1, 0, 2, 155, 2, 142, 1, 139, 1, 0, 141, 1, 139, 1, 140, 1, 139, 1, 139, 1,
+    1, 2, 141, 1, 139, 1, 140, 1, 139, 1, 141, 1, 0, 2, 141, 1, 0, 139, 1, 1, 137, 1, 1, 0, 139, 1, 0, 0, 139, 1, 141,
+    1, 140, 1, 151, 2, 142, 1, 143, 1, 137, 1, 140, 1, 153, 2, 140, 1, 139, 1, 139, 1, 0, 0, 1, 137, 1, 141, 1, 140, 1,
+    151, 2, 140, 1, 141, 1, 2, 141, 1, 2, 143, 1, 144, 1, 155, 2, 142, 1, 139, 1, 141, 1, 140, 1, 151, 2, 140, 1, 139,
+    1, 0, 141, 1, 2, 1, 139, 1, 163, 156, 158, 233, 161, 11, 207, 167, 233, 245, 241, 80, 154, 2, 177, 4, 152, 2, 151,
+    2, 1, 151, 2, 0, 0, 153, 2, 0, 151, 2, 1, 0, 2, 153, 2, 1, 151, 2, 0, 0, 153, 2, 2, 1, 153, 2, 2, 1, 151, 2, 0, 1,
+    151, 2, 0, 151, 2, 1, 0, 0, 151, 2, 1, 2, 153, 2, 1, 151, 2, 2, 1, 0, 153, 2, 0, 2, 155, 2, 2, 153, 2, 152, 2, 151,
+    2, 153, 2, 154, 2, 153, 2, 153, 2, 154, 2, 151, 2, 155, 2, 156, 2, 155, 2, 2, 153, 2, 0, 0, 1, 149, 2, 1, 153, 2, 2,
+    1, 0, 151, 2, 152, 2, 177, 4, 154, 2, 153, 2, 0, 153, 2, 0, 0, 2, 155, 2, 2, 1, 151, 2, 152, 2, 177, 4, 154, 2, 153,
+    2, 0, 0, 153, 2, 0, 2, 1, 153, 2, 2, 153, 2, 152, 2, 151, 2, 153, 2, 154, 2, 153, 2, 0, 0, 153, 2, 0, 2, 155, 2,
+    156, 2, 155, 2, 151, 2, 152, 2, 151, 2, 0, 153, 2, 154, 2, 153, 2, 153, 2, 154, 2, 151, 2, 1, 2, 155, 2, 2, 1, 151,
+    2, 154, 2, 153, 2, 0, 153, 2, 0, 0, 0, 153, 2, 156, 2, 155, 2, 151, 2, 152, 2, 151, 2, 1, 151, 2, 154, 2, 153, 2, 0,
+    153, 2, 0, 154, 2, 179, 4, 156, 2, 155, 2, 2, 1, 0, 151, 2, 0, 0, 153, 2, 152, 2, 151, 2, 153, 2, 154, 2, 151, 2, 1,
+    0, 0, 151, 2, 1, 2, 1, 151, 2, 0, 0, 1, 151, 2, 0, 0, 0, 151, 2, 1, 0, 2, 155, 2, 154, 2, 151, 2, 153, 2, 152, 2,
+    151, 2, 0, 0, 1, 149, 2, 1, 0, 0, 153, 2, 154, 2, 153, 2, 151, 2, 152, 2, 151, 2, 0, 1, 2, 153, 2, 1, 2, 0, 0, 153,
+    2, 0, 0, 151, 2, 152, 2, 153, 2, 2, 1, 151, 2, 152, 2, 151, 2, 1, 151, 2, 154, 2, 153, 2, 0, 0, 153, 2, 154, 2, 153,
+    2, 0, 0, 151, 2, 1, 154, 2, 177, 4, 152, 2, 2, 155, 2, 2, 0, 153, 2, 154, 2, 155, 2, 2, 0, 0, 151, 2, 1, 0, 0, 151,
+    2, 152, 2, 153, 2, 2, 1, 151, 2, 154, 2, 155, 2, 2, 0, 153, 2, 154, 2, 153, 2, 0, 0, 153, 2, 154, 2, 153, 2, 0, 2,
+    155, 2, 154, 2, 151, 2, 0, 1, 151, 2, 152, 2, 151, 2, 0, 0, 0, 153, 2, 152, 2, 151, 2, 2, 155, 2, 154, 2, 153, 2, 2,
+    1, 0, 2, 155, 2, 2, 152, 2, 177, 4, 152, 2, 2, 153, 2, 0, 0, 1, 151, 2, 154, 2, 153, 2, 2, 1, 0, 153, 2, 0, 156, 2,
+    155, 2, 151, 2, 152, 2, 151, 2, 152, 2, 151, 2, 1, 151, 2, 154, 2, 153, 2, 0, 152, 2, 177, 4, 154, 2, 0, 153, 2, 0,
+    2, 1, 153, 2, 154, 2, 151, 2, 1, 2, 1, 0, 151, 2, 0, 152, 2, 177, 4, 154, 2, 0, 155, 2, 156, 2, 153, 2, 0, 153, 2,
+    154, 2, 153, 2, 154, 2, 151, 2, 1, 0, 153, 2, 156, 2, 155, 2, 2, 1, 0, 151, 2, 154, 2, 155, 2, 2, 0, 0, 1, 151, 2,
+    154, 2, 153, 2, 0, 0, 0, 153, 2, 154, 2, 151, 2, 1, 0, 0, 151, 2, 152, 2, 151, 2, 1, 2, 1, 2, 155, 2, 156, 2, 153,
+    2, 0, 1, 2, 153, 2, 154, 2, 153, 2, 0, 0, 0, 0, 0, 151, 2, 1, 154, 2, 179, 4, 156, 2, 1, 0, 151, 2, 0, 1, 2, 1, 2,
+    153, 2, 152, 2, 151, 2, 0, 0, 0, 153, 2, 152, 2, 149, 2, 1, 0, 0, 0, 0, 153, 2, 154, 2, 151, 2, 1, 2, 1, 153, 2,
+    156, 2, 155, 2, 2, 0, 1, 2, 0, 155, 2, 156, 2, 153, 2, 0, 0, 0, 1, 149, 2, 152, 2, 153, 2, 0, 0, 0, 0, 0, 151, 2,
+    152, 2, 153, 2, 2, 1, 2, 155, 2, 156, 2, 155, 2, 156, 2, 155, 2, 2, 0, 1, 151, 2, 154, 2, 153, 2, 0, 154, 2, 155, 2,
+    149, 2, 152, 2, 0, 153, 2, 154, 2, 153, 2, 0, 0, 0, 151, 2, 152, 2, 0, 151, 2, 1, 2, 1, 2, 1, 151, 2, 152, 2, 151,
+    2, 0, 1, 2, 0, 1, 151, 2, 154, 2, 153, 2, 154, 2, 153, 2, 0, 153, 2, 154, 2, 0, 153, 2, 154, 2, 151, 2, 1, 0, 0, 2,
+    155, 2, 154, 2, 151, 2, 152, 2, 151, 2, 1, 2, 1, 151, 2, 152, 2, 151, 2, 154, 2, 155, 2, 2, 0, 0, 1, 151, 2, 154, 2,
+    153, 2, 154, 2, 153, 2, 0, 0, 0, 0, 153, 2, 156, 2, 155, 2, 0, 0, 154, 2, 177, 4, 152, 2, 2, 1, 153, 2, 2, 152, 2,
+    151, 2, 1, 2, 0, 155, 2, 156, 2, 1, 151, 2, 0, 0, 0, 0, 1, 2, 153, 2, 154, 2, 153, 2, 154, 2, 153, 2, 0, 0, 0, 0,
+    151, 2, 152, 2, 153, 2, 2, 152, 2, 153, 2, 0, 2, 1, 151, 2, 152, 2, 151, 2, 152, 2, 153, 2, 2, 0, 1, 2, 0, 155, 2,
+    156, 2, 153, 2, 152, 2, 151, 2, 0, 0, 0, 0, 0, 153, 2, 154, 2, 153, 2, 154, 2, 153, 2, 0, 0, 0, 0, 151, 2, 152, 2,
+    153, 2, 154, 2, 151, 2, 1, 154, 2, 151, 2, 155, 2, 156, 2, 1, 2, 155, 2, 156, 2, 155, 2, 2, 0, 1, 2, 0, 1, 2, 153,
+    2, 152, 2, 151, 2, 0, 0, 0, 0, 0, 0, 0, 153, 2, 154, 2, 153, 2, 154, 2, 153, 2, 0, 2, 1, 0, 0, 151, 2, 152, 2, 153,
+    2, 154, 2, 151, 2, 1, 2, 1, 2, 1, 0, 2, 153, 2, 152, 2, 151, 2, 1, 2, 154, 2, 155, 2, 2, 153, 2, 154, 2, 1, 151, 2,
+    154, 2, 153, 2, 154, 2, 153, 2, 0, 0, 0, 0, 153, 2, 154, 2, 0, 153, 2, 154, 2, 153, 2, 0, 2, 1, 0, 0, 2, 1, 0, 151,
+    2, 152, 2, 153, 2, 2, 1, 156, 2, 155, 2, 2, 155, 2, 156, 2, 1, 151, 2, 154, 2, 155, 2, 156, 2, 153, 2, 1, 2, 0, 0,
+    1, 2, 0, 153, 2, 154, 2, 153, 2, 152, 2, 151, 2, 0, 0, 0, 0, 0, 2, 155, 2, 154, 2, 0, 153, 2, 0, 154, 2, 151, 2, 1,
+    0, 2, 1, 0, 0, 151, 2, 152, 2, 151, 2, 152, 2, 151, 2, 1, 154, 2, 151, 2, 1, 2, 153, 2, 152, 2, 2, 1, 151, 2, 154,
+    2, 153, 2, 1, 156, 2, 153, 2, 0, 1, 2, 0, 153, 2, 154, 2, 0, 153, 2, 154, 2, 153, 2, 152, 2, 149, 2, 1, 0, 0, 0, 0,
+    0, 153, 2, 154, 2, 0, 151, 2, 152, 2, 153, 2, 0, 2, 1, 154, 2, 177, 4, 152, 2, 0, 2, 1, 151, 2, 152, 2, 151, 2, 152,
+    2, 151, 2, 1, 2, 152, 2, 151, 2, 153, 2, 152, 2, 2, 1, 2, 153, 2, 152, 2, 151, 2, 154, 2, 153, 2, 0, 1, 2, 0, 0, 0,
+    0, 0, 153, 2, 154, 2, 1, 149, 2, 1, 152, 2, 149, 2, 1, 0, 0, 0, 0, 0, 0, 2, 155, 2, 154, 2, 153, 2, 156, 2, 155, 2,
+    0, 154, 2, 151, 2, 1, 2, 1, 0, 2, 155, 2, 156, 2, 1, 151, 2, 152, 2, 151, 2, 1, 156, 2, 153, 2, 1, 2, 1, 2, 0, 1, 2,
+    153, 2, 154, 2, 1, 151, 2, 154, 2, 153, 2, 0, 1, 156, 2, 153, 2, 0, 0, 0, 0, 153, 2, 154, 2, 0, 153, 2, 154, 2, 153,
+    2, 154, 2, 153, 2, 0, 154, 2, 153, 2, 0, 2, 1, 0, 0, 151, 2, 152, 2, 0, 153, 2, 154, 2, 151, 2, 152, 2, 153, 2, 2,
+    152, 2, 151, 2, 1, 0, 2, 1, 2, 155, 2, 156, 2, 1, 151, 2, 152, 2, 151, 2, 152, 2, 151, 2, 0, 152, 2, 151, 2, 0, 1,
+    2, 0, 1, 2, 0, 153, 2, 154, 2, 155, 2, 156, 2, 153, 2, 154, 2, 153, 2, 152, 2, 151, 2, 0, 0, 0, 0, 0, 0, 0, 0, 153,
+    2, 154, 2, 0, 153, 2, 154, 2, 151, 2, 1, 154, 2, 153, 2, 0, 0, 2, 1, 0, 0, 2, 1, 0, 153, 2, 156, 2, 155, 2, 154, 2,
+    151, 2, 152, 2, 151, 2, 152, 2, 153, 2, 2, 1, 2, 1, 2, 1, 2, 1, 151, 2, 152, 2, 2, 153, 2, 152, 2, 151, 2, 152, 2,
+    151, 2, 0, 152, 2, 151, 2, 0, 0, 1, 2, 0, 1, 2, 153, 2, 154, 2, 0, 153, 2, 152, 2, 151, 2, 154, 2, 153, 2, 154, 2,
+    153, 2, 0, 0, 0, 154, 2, 153, 2, 0, 153, 2, 154, 2, 0, 0, 0, 153, 2, 154, 2, 151, 2, 152, 2, 153, 2, 154, 2, 153, 2,
+    0, 154, 2, 151, 2, 1, 0, 2, 1, 0, 0, 2, 1, 153, 2, 156, 2, 1, 153, 2, 156, 2, 155, 2, 156, 2, 155, 2, 154, 2, 151,
+    2, 1, 2, 1, 156, 2, 155, 2, 2, 153, 2, 152, 2, 2, 1, 2, 153, 2, 152, 2, 2, 155, 2, 156, 2, 153, 2, 152, 2, 151, 2,
+    0, 152, 2, 151, 2, 0, 0, 0, 1, 2, 0, 0, 0, 1, 151, 2, 154, 2, 0, 153, 2, 154, 2, 153, 2, 154, 2, 153, 2, 0, 154, 2,
+    153, 2, 0, 0, 154, 2, 153, 2, 0, 0, 0, 153, 2, 154, 2, 0, 0, 0, 151, 2, 152, 2, 153, 2, 154, 2, 153, 2, 154, 2, 151,
+    2, 152, 2, 153, 2, 0, 2, 1, 154, 2, 151, 2, 1, 0, 0, 151, 2, 152, 2, 2, 1, 0, 151, 2, 152, 2, 151, 2, 152, 2, 151,
+    2, 152, 2, 151, 2, 152, 2, 151, 2, 1, 2, 152, 2, 151, 2, 1, 2, 1, 2, 0, 1, 151, 2, 154, 2, 1, 2, 153, 2, 152, 2,
+    151, 2, 154, 2, 155, 2, 156, 2, 153, 2, 152, 2, 151, 2, 0, 0, 154, 2, 155, 2, 2, 0, 0, 0, 0, 1, 2, 153, 2, 154, 2,
+    0, 0, 153, 2, 154, 2, 153, 2, 154, 2, 153, 2, 154, 2, 153, 2, 154, 2, 153, 2, 0, 0, 0, 154, 2, 153, 2, 0, 0, 0, 2,
+    1, 153, 2, 154, 2, 0, 0, 0, 151, 2, 152, 2, 153, 2, 154, 2, 151, 2, 152, 2, 153, 2, 154, 2, 151, 2, 1, 154, 2, 151,
+    2, 1, 0, 2, 1, 0, 2, 1, 2, 1, 0, 151, 2, 152, 2, 2, 1, 151, 2, 152, 2, 151, 2, 152, 2, 151, 2, 152, 2, 151, 2, 152,
+    2, 151, 2, 1, 2, 152, 2, 151, 2, 0, 1, 2, 1, 2, 0, 1, 2, 0, 155, 2, 156, 2, 0, 153, 2, 152, 2, 2, 153, 2, 152, 2,
+    151, 2, 154, 2, 153, 2, 0, 152, 2, 151, 2, 0, 154, 2, 153, 2, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 153, 2, 154, 2, 0, 0,
+    153, 2, 154, 2, 153, 2, 154, 2, 153, 2, 154, 2, 153, 2, 154, 2, 153, 2, 0, 154, 2, 153, 2, 0, 0, 2, 150, 2, 149, 2,
+    1, 0, 0, 0, 151, 2, 152, 2, 0, 0, 0, 151, 2, 152, 2, 0, 153, 2, 156, 2, 155, 2, 154, 2, 151, 2, 152, 2, 153, 2, 154,
+    2, 151, 2, 1, 154, 2, 151, 2, 1, 2, 1, 0, 156, 2, 155, 2, 0, 2, 153, 2, 152, 2, 0, 2, 1, 2, 155, 2, 156, 2, 1, 151,
+    2, 152, 2, 2, 155, 2, 156, 2, 155, 2, 2, 154, 2, 155, 2, 156, 2, 155, 2, 2, 0, 152, 2, 151, 2, 1, 2, 0, 0, 1, 2, 0,
+    1, 2, 0, 153, 2, 152, 2, 2, 0, 153, 2, 152, 2, 2, 153, 2, 154, 2, 153, 2, 152, 2, 151, 2, 154, 2, 153, 2, 152, 2,
+    151, 2, 0, 0, 154, 2, 153, 2, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 153, 2, 154, 2, 0, 153, 2, 154, 2, 0, 151,
+    2, 150, 2, 149, 2, 152, 2, 153, 2, 0, 154, 2, 153, 2, 154, 2, 153, 2, 2, 1, 205, 176, 234, 177, 191, 149, 1, 233,
+    191, 167, 140, 232, 34, 179, 4, 2, 1, 2, 1, 0, 2, 1, 2, 1, 0, 177, 4, 180, 4, 1, 2, 179, 4, 178, 4, 0, 177, 4, 180,
+    4, 179, 4, 178, 4, 177, 4, 178, 4, 177, 4, 180, 4, 179, 4, 0, 178, 4, 177, 4, 0, 0, 178, 4, 177, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 175, 4, 178, 4, 0, 179, 4, 180, 4, 0, 177, 4, 178, 4, 0, 179, 4, 180, 4, 179, 4, 2, 178, 4,
+    179, 4, 180, 4, 177, 4, 1, 180, 4, 177, 4, 1, 0, 2, 178, 4, 179, 4, 2, 1, 2, 1, 2, 1, 2, 1, 177, 4, 180, 4, 1, 0, 2,
+    179, 4, 178, 4, 2, 1, 177, 4, 180, 4, 179, 4, 178, 4, 177, 4, 180, 4, 179, 4, 178, 4, 177, 4, 180, 4, 179, 4, 0,
+    178, 4, 177, 4, 0, 0, 178, 4, 177, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 177, 4, 178, 4, 0, 0, 179, 4,
+    180, 4, 0, 177, 4, 178, 4, 179, 4, 180, 4, 177, 4, 178, 4, 179, 4, 180, 4, 177, 4, 1, 180, 4, 177, 4, 1, 180, 4,
+    177, 4, 1, 2, 178, 4, 179, 4, 2, 1, 2, 1, 2, 1, 2, 0, 1, 2, 1, 2, 1, 177, 4, 180, 4, 1, 2, 179, 4, 178, 4, 2, 179,
+    4, 178, 4, 2, 179, 4, 178, 4, 177, 4, 180, 4, 179, 4, 178, 4, 175, 4, 176, 4, 177, 4, 0, 180, 4, 179, 4, 0, 178, 4,
+    177, 4, 0, 0, 180, 4, 179, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 177, 4, 178, 4, 0, 0, 0, 177, 4, 178, 4, 0,
+    179, 4, 180, 4, 0, 177, 4, 178, 4, 177, 4, 178, 4, 179, 4, 180, 4, 177, 4, 178, 4, 179, 4, 180, 4, 177, 4, 0, 178,
+    4, 179, 4, 2, 1, 180, 4, 177, 4, 1, 2, 0, 178, 4, 179, 4, 2, 1, 2, 1, 2, 0, 1, 2, 1, 2, 179, 4, 180, 4, 1, 2, 1,
+    177, 4, 180, 4, 1, 2, 179, 4, 180, 4, 1, 177, 4, 180, 4, 179, 4, 180, 4, 179, 4, 178, 4, 177, 4, 180, 4, 179, 4,
+    180, 4, 179, 4, 178, 4, 177, 4, 0, 180, 4, 179, 4, 0, 0, 180, 4, 179, 4, 0, 0, 0, 180, 4, 179, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 2, 1, 0, 0, 179, 4, 182, 4, 1, 0, 0, 179, 4, 182, 4, 1, 0, 179, 4, 180, 4, 2, 181, 4, 180, 4, 177, 4, 178, 4,
+    0, 177, 4, 178, 4, 179, 4, 2, 178, 4, 177, 4, 178, 4, 179, 4, 180, 4, 177, 4, 0, 178, 4, 179, 4, 2, 0, 178, 4, 179,
+    4, 2, 0, 1, 2, 178, 4, 179, 4, 2, 0, 1, 2, 0, 1, 2, 1, 2, 0, 1, 177, 4, 180, 4, 0, 1, 2, 1, 175, 4, 176, 4, 2, 1,
+    175, 4, 176, 4, 2, 179, 4, 180, 4, 179, 4, 178, 4, 2, 179, 4, 180, 4, 179, 4, 178, 4, 175, 4, 176, 4, 177, 4, 0,
+    180, 4, 179, 4, 180, 4, 179, 4, 0, 180, 4, 179, 4, 0, 0, 180, 4, 179, 4, 0, 0, 0, 180, 4, 179, 4, 0, 0, 2, 1, 0, 0,
+    0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 177, 4, 178, 4, 0, 0, 2, 181, 4, 180, 4, 2, 1, 179, 4, 180, 4, 2, 181, 4, 180, 4, 177,
+    4, 178, 4, 0, 177, 4, 178, 4, 177, 4, 178, 4, 177, 4, 178, 4, 179, 4, 182, 4, 181, 4, 2, 178, 4, 177, 4, 178, 4,
+    177, 4, 1, 180, 4, 177, 4, 0, 1, 180, 4, 177, 4, 0, 1, 2, 178, 4, 177, 4, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1,
+    2, 0, 1, 2, 179, 4, 180, 4, 1, 2, 0, 179, 4, 180, 4, 1, 2, 179, 4, 180, 4, 1, 175, 4, 176, 4, 2, 179, 4, 180, 4,
+    179, 4, 180, 4, 1, 175, 4, 176, 4, 177, 4, 180, 4, 179, 4, 180, 4, 179, 4, 0, 180, 4, 179, 4, 180, 4, 179, 4, 0,
+    180, 4, 179, 4, 0, 180, 4, 179, 4, 0, 0, 180, 4, 179, 4, 2, 1, 0, 180, 4, 179, 4, 0, 0, 0, 2, 1, 0, 0, 0, 0, 2, 1,
+    0, 0, 0, 2, 1, 0, 0, 0, 2, 181, 4, 180, 4, 2, 1, 0, 177, 4, 178, 4, 0, 0, 177, 4, 178, 4, 0, 2, 181, 4, 182, 4, 181,
+    4, 180, 4, 2, 181, 4, 182, 4, 181, 4, 180, 4, 2, 181, 4, 182, 4, 181, 4, 180, 4, 177, 4, 0, 178, 4, 177, 4, 178, 4,
+    177, 4, 178, 4, 177, 4, 1, 180, 4, 177, 4, 0, 178, 4, 177, 4, 0, 1, 180, 4, 177, 4, 0, 0, 178, 4, 179, 4, 2, 0, 0,
+    1, 2, 178, 4, 177, 4, 0, 1, 2, 0, 0, 1, 2, 0, 1, 2, 0, 0, 1, 2, 0, 179, 4, 180, 4, 1, 2, 0, 0, 1, 177, 4, 180, 4, 0,
+    0, 179, 4, 180, 4, 1, 2, 179, 4, 180, 4, 0, 179, 4, 180, 4, 1, 175, 4, 176, 4, 2, 179, 4, 180, 4, 179, 4, 180, 4,
+    179, 4, 180, 4, 179, 4, 180, 4, 179, 4, 180, 4, 179, 4, 180, 4, 179, 4, 180, 4, 179, 4, 180, 4, 179, 4, 0, 180, 4,
+    179, 4, 0, 180, 4, 179, 4, 2, 176, 4, 177, 4, 2, 176, 4, 175, 4, 1, 0, 0, 180, 4, 179, 4, 2, 1, 0, 180, 4, 179, 4,
+    0, 2, 1, 0, 0, 0, 2, 1, 0, 0, 2, 1, 0, 0, 2, 1, 0, 0, 2, 1, 0, 0, 2, 1, 0, 177, 4, 178, 4, 0, 2, 1, 177, 4, 178, 4,
+    0, 0, 177, 4, 178, 4, 2, 1, 177, 4, 178, 4, 0, 177, 4, 247, 234, 144, 144, 211, 241, 1, 195, 179, 147, 236, 251,
+    126, 227, 8, 228, 8, 2, 229, 8, 228, 8, 227, 8, 228, 8, 0, 227, 8, 228, 8, 227, 8, 230, 8, 231, 8, 232, 8, 231, 8,
+    232, 8, 231, 8, 232, 8, 231, 8, 232, 8, 231, 8, 2, 228, 8, 227, 8, 228, 8, 227, 8, 1, 232, 8, 231, 8, 2, 228, 8,
+    227, 8, 1, 232, 8, 231, 8, 2, 228, 8, 227, 8, 1, 2, 1, 232, 8, 231, 8, 2, 1, 2, 228, 8, 227, 8, 0, 1, 2, 1, 2, 228,
+    8, 227, 8, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 0, 1, 2, 1, 2, 1, 2, 1, 2, 231, 8, 232, 8, 1, 2, 1, 2, 0, 1, 227, 8, 228,
+    8, 2, 1, 2, 231, 8, 232, 8, 1, 2, 229, 8, 228, 8, 2, 1, 227, 8, 228, 8, 2, 231, 8, 232, 8, 1, 227, 8, 228, 8, 2,
+    229, 8, 228, 8, 227, 8, 228, 8, 2, 231, 8, 232, 8, 231, 8, 232, 8, 0, 231, 8, 232, 8, 231, 8, 232, 8, 231, 8, 232,
+    8, 231, 8, 232, 8, 229, 8, 228, 8, 227, 8, 1, 232, 8, 231, 8, 232, 8, 231, 8, 232, 8, 229, 8, 1, 232, 8, 231, 8, 2,
+    228, 8, 227, 8, 0, 228, 8, 227, 8, 1, 232, 8, 231, 8, 2, 228, 8, 227, 8, 0, 1, 232, 8, 231, 8, 2, 1, 232, 8, 229, 8,
+    1, 2, 1, 2, 228, 8, 227, 8, 0, 1, 2, 1, 2, 228, 8, 227, 8, 0, 1, 2, 1, 2, 0, 1, 2, 1, 2, 1, 2, 0, 1, 2, 1, 2, 1, 2,
+    0, 1, 2, 1, 2, 0, 1, 2, 1, 227, 8, 230, 8, 1, 2, 1, 2, 1, 227, 8, 230, 8, 1, 2, 1, 227, 8, 230, 8, 1, 2, 1, 227, 8,
+    230, 8, 1, 2, 231, 8, 232, 8, 1, 227, 8, 230, 8, 1, 2, 231, 8, 232, 8, 0, 231, 8, 232, 8, 1, 227, 8, 230, 8, 231, 8,
+    232, 8, 1, 227, 8, 230, 8, 1, 227, 8, 228, 8, 227, 8, 230, 8, 231, 8, 232, 8, 231, 8, 232, 8, 0, 231, 8, 232, 8,
+    231, 8, 232, 8, 229, 8, 228, 8, 227, 8, 230, 8, 231, 8, 232, 8, 231, 8, 232, 8, 229, 8, 1, 232, 8, 231, 8, 232, 8,
+    229, 8, 228, 8, 227, 8, 1, 232, 8, 229, 8, 228, 8, 227, 8, 0, 228, 8, 227, 8, 1, 232, 8, 229, 8, 1, 232, 8, 231, 8,
+    2, 230, 8, 231, 8, 2, 228, 8, 227, 8, 0, 1, 232, 8, 229, 8, 1, 2, 228, 8, 227, 8, 0, 1, 232, 8, 229, 8, 1, 2, 1,
+    232, 8, 229, 8, 1, 2, 1, 232, 8, 229, 8, 1, 2, 0, 1, 2, 228, 8, 227, 8, 0, 1, 2, 0, 1, 2, 1, 2, 0, 228, 8, 227, 8,
+    0, 1, 2, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 1, 2, 0, 1, 2, 0, 1, 2, 1, 227, 8, 230, 8, 1, 245, 253, 232, 209, 171, 57,
+    149, 226, 223, 166, 242, 167, 5, 2, 1, 0, 0, 2, 1, 203, 17, 206, 17, 1, 0, 0, 2, 1, 0, 203, 17, 206, 17, 1, 0, 2, 1,
+    203, 17, 204, 17, 2, 1, 0, 201, 17, 202, 17, 0, 0, 201, 17, 202, 17, 0, 0, 2, 205, 17, 204, 17, 2, 1, 203, 17, 206,
+    17, 1, 203, 17, 204, 17, 2, 1, 203, 17, 206, 17, 1, 203, 17, 204, 17, 2, 205, 17, 204, 17, 2, 205, 17, 204, 17, 0,
+    201, 17, 202, 17, 0, 201, 17, 202, 17, 0, 201, 17, 202, 17, 0, 203, 17, 206, 17, 205, 17, 204, 17, 2, 205, 17, 204,
+    17, 201, 17, 202, 17, 0, 203, 17, 206, 17, 205, 17, 204, 17, 201, 17, 202, 17, 203, 17, 206, 17, 1, 203, 17, 204,
+    17, 201, 17, 202, 17, 203, 17, 206, 17, 205, 17, 204, 17, 201, 17, 202, 17, 203, 17, 206, 17, 205, 17, 204, 17, 201,
+    17, 202, 17, 203, 17, 204, 17, 201, 17, 202, 17, 203, 17, 206, 17, 205, 17, 204, 17, 201, 17, 202, 17, 203, 17, 206,
+    17, 205, 17, 0, 206, 17, 205, 17, 204, 17, 201, 17, 202, 17, 203, 17, 2, 202, 17, 203, 17, 204, 17, 201, 17, 202,
+    17, 203, 17, 2, 202, 17, 203, 17, 2, 202, 17, 203, 17, 206, 17, 205, 17, 0, 206, 17, 205, 17, 204, 17, 201, 17, 1,
+    204, 17, 201, 17, 1, 204, 17, 201, 17, 1, 204, 17, 201, 17, 1, 204, 17, 201, 17, 1, 204, 17, 201, 17, 1, 204, 17,
+    201, 17, 1, 204, 17, 201, 17, 1, 0, 204, 17, 201, 17, 1, 204, 17, 201, 17, 1, 2, 202, 17, 203, 17, 2, 202, 17, 203,
+    17, 137, 141, 136, 206, 250, 169, 3, 217, 196, 137, 163, 193, 152, 8, 150, 35, 149, 35, 0, 1, 154, 35, 151, 35, 1,
+    2, 152, 35, 153, 35, 2, 0, 150, 35, 149, 35, 0, 0, 150, 35, 149, 35, 0, 1, 2, 150, 35, 149, 35, 0, 0, 1, 154, 35,
+    151, 35, 1, 2, 0, 150, 35, 149, 35, 0, 1, 2, 152, 35, 153, 35, 2, 0, 0, 150, 35, 149, 35, 0, 1, 2, 0, 150, 35, 149,
+    35, 0, 1, 2, 0, 0, 150, 35, 149, 35, 0, 1, 2, 0, 150, 35, 149, 35, 0, 1, 2, 0, 0, 1, 154, 35, 151, 35, 1, 2, 0, 1,
+    2, 0, 150, 35, 149, 35, 0, 0, 1, 2, 0, 0, 150, 35, 149, 35, 1, 133, 198, 207, 198, 152, 139, 9, 193, 221, 211, 155,
+    223, 249, 13, 1, 2, 1, 2, 1, 176, 70, 173, 70, 1, 0, 2, 1, 2, 1, 2, 1, 2, 174, 70, 175, 70, 2, 1, 0, 2, 1, 2, 1, 2,
+    1, 2, 174, 70, 175, 70, 0, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 0, 2, 217, 174, 131, 154, 204, 210, 43, 187, 152, 195, 170,
+    163, 183, 2, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 222, 140, 1, 221, 140, 1, 0, 0, 0, 0, 211, 152, 167, 252,
+    195, 215, 66, 213, 245, 229, 140, 155, 188, 25, 0, 0, 1, 2, 0, 0, 0, 1, 2, 197, 236, 238, 192, 179, 225, 112, 149,
+    253, 166, 209, 138, 198, 71, 247, 178, 4, 1, 2, 223, 196, 223, 183, 212, 205, 20, 201, 244, 212, 236, 167, 129, 220,
+    2, 0, 179, 225, 249, 201, 146, 245, 204, 1, 155, 145, 239, 254, 229, 168, 148, 4, 141, 168, 197, 165, 150, 166, 220,
+    14,
+    // N8000 (TL15999)
+    174, 192, 153, 148, 221, 220, 191, 214, 128, 1, 149, 140, 202, 225, 181, 138, 192, 214, 128, 1, 245, 226, 129, 197,
+    34, 243, 217, 242, 230, 7, 165, 227, 243, 250, 2, 165, 144, 173, 183, 1, 189, 254, 187, 102, 167, 164, 130, 63, 137,
+    153, 192, 41, 153, 254, 226, 28, 255, 243, 225, 20, 149, 222, 188, 15, 145, 198, 235, 11, 167, 177, 161, 9, 163,
+    209, 176, 7, 143, 243, 252, 5, 227, 134, 244, 4, 155, 128, 138, 4, 151, 195, 182, 3, 169, 254, 243, 2, 207, 157,
+    190, 2, 165, 173, 146, 2, 211, 155, 238, 1, 135, 144, 208, 1, 243, 243, 182, 1, 179, 208, 161, 1, 159, 190, 143, 1,
+    219, 254, 127, 241, 207, 114, 169, 140, 103, 205, 130, 93, 231, 157, 84, 211, 196, 76, 221, 220, 69, 239, 216, 63,
+    151, 175, 58, 223, 202, 53, 229, 173, 49, 153, 193, 45, 205, 139, 42, 203, 253, 38, 157, 152, 36, 239, 211, 33, 131,
+    171, 31, 209, 157, 29, 197, 169, 27, 159, 201, 25, 207, 251, 23, 195, 190, 22, 229, 144, 21, 173, 241, 19, 247, 220,
+    18, 217, 213, 17, 159, 215, 16, 205, 225, 15, 235, 245, 14, 203, 143, 14, 159, 179, 13, 161, 219, 12, 245, 137, 12,
+    235, 187, 11, 201, 246, 10, 179, 178, 10, 221, 243, 9, 201, 186, 9, 187, 130, 9, 219, 205, 8, 171, 157, 8, 157, 240,
+    7, 163, 196, 7, 203, 155, 7, 255, 243, 6, 231, 208, 6, 211, 173, 6, 223, 141, 6, 237, 237, 5, 151, 208, 5, 227, 181,
+    5, 167, 154, 5, 141, 130, 5, 247, 233, 4, 233, 210, 4, 235, 188, 4, 147, 170, 4, 161, 149, 4, 187, 129, 4, 137, 242,
+    3, 177, 223, 3, 253, 207, 3, 205, 192, 3, 153, 177, 3, 245, 162, 3, 231, 150, 3, 181, 135, 3, 183, 252, 2, 171, 240,
+    2, 169, 229, 2, 171, 218, 2, 161, 206, 2, 197, 198, 2, 199, 187, 2, 211, 177, 2, 253, 169, 2, 147, 161, 2, 163, 151,
+    2, 227, 145, 2, 253, 136, 2, 163, 129, 2, 201, 249, 1, 153, 245, 1, 177, 236, 1, 231, 229, 1, 175, 225, 1, 233, 218,
+    1, 151, 212, 1, 231, 207, 1, 155, 201, 1, 243, 197, 1, 167, 191, 1, 129, 188, 1, 181, 181, 1, 141, 178, 1, 235, 174,
+    1, 155, 168, 1, 245, 164, 1, 219, 162, 1, 145, 156, 1, 131, 155, 1, 197, 149, 1, 167, 147, 1, 249, 142, 1, 219, 140,
+    1, 185, 137, 1, 133, 133, 1, 233, 130, 1, 209, 128, 1, 173, 125, 131, 122, 237, 119, 209, 117, 171, 114, 147, 112,
+    135, 111, 209, 106, 197, 105, 187, 104, 133, 100, 133, 100, 213, 95, 223, 96, 173, 92, 173, 92, 135, 89, 251, 87,
+    223, 85, 211, 84, 201, 83, 173, 81, 147, 79, 149, 79, 239, 75, 237, 75, 223, 74, 189, 71, 201, 72, 159, 69, 151, 68,
+    147, 68, 135, 67, 241, 64, 225, 63, 213, 62, 213, 62, 173, 59, 203, 61, 147, 57, 165, 58, 147, 57, 253, 54, 135, 56,
+    229, 52, 225, 52, 239, 53, 187, 49, 215, 51, 189, 49, 175, 48, 175, 48, 175, 48, 137, 45, 151, 46, 137, 45, 137, 45,
+    253, 43, 227, 41, 251, 43, 217, 40, 225, 41, 201, 39, 217, 40, 199, 39, 177, 37, 201, 39, 177, 37, 163, 36, 177, 37,
+    149, 35, 151, 35, 163, 36, 255, 32, 149, 35, 253, 32, 253, 32, 241, 31, 253, 32, 241, 31, 227, 30, 227, 30, 217, 29,
+    225, 30, 203, 28, 217, 29, 199, 28, 205, 28, 201, 28, 177, 26, 201, 28, 165, 25, 189, 27, 177, 26, 163, 25, 165, 25,
+    177, 26, 137, 23, 165, 25, 165, 25, 137, 23, 139, 23, 151, 24, 253, 21, 141, 23, 135, 23, 129, 22, 239, 20, 139, 23,
+    241, 20, 241, 20, 241, 20, 241, 20, 229, 19, 227, 19, 243, 20, 213, 18, 243, 20, 201, 17, 231, 19, 213, 18, 217, 18,
+    201, 17, 205, 17, 227, 19, 191, 16, 201, 17, 191, 16, 217, 18, 175, 15, 205, 17, 187, 16, 181, 15, 201, 17, 177, 15,
+    177, 15, 179, 15, 189, 16, 163, 14, 179, 15, 179, 15, 163, 14, 163, 14, 179, 15, 153, 13, 175, 15, 153, 13, 165, 14,
+    151, 13, 151, 13, 167, 14, 149, 13, 155, 13, 149, 13, 141, 12, 151, 13, 153, 13, 253, 10, 165, 14, 255, 10, 137, 12,
+    141, 12, 139, 12, 139, 12, 255, 10, 137, 12, 129, 11, 253, 10, 253, 10, 141, 12, 241, 9, 139, 12, 243, 9, 253, 10,
+    243, 9, 253, 10, 255, 10, 227, 8, 129, 11, 241, 9, 241, 9, 241, 9, 243, 9, 241, 9, 229, 8, 243, 9, 239, 9, 231, 8,
+    241, 9, 215, 7, 243, 9, 241, 9, 217, 7, 229, 8, 241, 9, 215, 7, 231, 8, 215, 7, 243, 9, 215, 7, 215, 7, 231, 8, 227,
+    8, 205, 6, 229, 8, 215, 7, 229, 8, 205, 6, 215, 7, 229, 8, 203, 6, 215, 7, 219, 7, 201, 6, 231, 8, 201, 6, 205, 6,
+    217, 7, 203, 6, 215, 7, 203, 6, 205, 6, 215, 7, 191, 5, 217, 7, 203, 6, 203, 6, 205, 6, 201, 6, 193, 5, 215, 7, 189,
+    5, 205, 6, 205, 6, 189, 5, 203, 6, 191, 5, 205, 6, 201, 6, 179, 4, 217, 7, 177, 4, 203, 6, 193, 5, 189, 5, 203, 6,
+    179, 4, 201, 6, 193, 5, 177, 4, 205, 6, 177, 4, 203, 6, 179, 4, 189, 5, 191, 5, 191, 5, 179, 4, 191, 5, 189, 5, 179,
+    4, 189, 5, 179, 4, 191, 5, 179, 4, 189, 5, 179, 4, 177, 4, 191, 5, 177, 4, 193, 5, 163, 3, 193, 5, 175, 4, 181, 4,
+    175, 4, 193, 5, 165, 3, 177, 4, 191, 5, 165, 3, 179, 4, 177, 4, 177, 4, 179, 4, 179, 4, 177, 4, 165, 3, 177, 4, 179,
+    4, 167, 3, 175, 4, 179, 4, 179, 4, 163, 3, 167, 3, 179, 4, 175, 4, 167, 3, 165, 3, 177, 4, 179, 4, 165, 3, 165, 3,
+    167, 3, 175, 4, 167, 3, 177, 4, 167, 3, 163, 3, 167, 3, 163, 3, 181, 4, 149, 2, 181, 4, 163, 3, 167, 3, 165, 3, 177,
+    4, 153, 2, 165, 3, 165, 3, 165, 3, 165, 3, 167, 3, 163, 3, 167, 3, 165, 3, 165, 3, 151, 2, 167, 3, 165, 3, 165, 3,
+    165, 3, 151, 2, 167, 3, 165, 3, 153, 2, 177, 4, 141, 1, 177, 4, 151, 2, 167, 3, 153, 2, 165, 3, 151, 2, 167, 3, 163,
+    3, 155, 2, 163, 3, 153, 2, 153, 2, 165, 3, 153, 2, 165, 3, 165, 3, 141, 1, 163, 3, 167, 3, 139, 1, 177, 4, 141, 1,
+    165, 3, 153, 2, 151, 2, 167, 3, 139, 1, 165, 3, 165, 3, 139, 1, 167, 3, 151, 2, 153, 2, 153, 2, 165, 3, 139, 1, 165,
+    3, 153, 2, 153, 2, 153, 2, 151, 2, 153, 2, 153, 2, 153, 2, 151, 2, 165, 3, 141, 1, 151, 2, 155, 2, 163, 3, 141, 1,
+    151, 2, 153, 2, 153, 2, 153, 2, 151, 2, 141, 1, 165, 3, 139, 1, 165, 3, 141, 1, 153, 2, 151, 2, 139, 1, 167, 3, 139,
+    1, 153, 2, 151, 2, 153, 2, 141, 1, 151, 2, 153, 2, 153, 2, 139, 1, 153, 2, 153, 2, 151, 2, 141, 1, 153, 2, 139, 1,
+    151, 2, 155, 2, 151, 2, 139, 1, 153, 2, 141, 1, 151, 2, 141, 1, 151, 2, 153, 2, 141, 1, 151, 2, 153, 2, 139, 1, 141,
+    1, 153, 2, 151, 2, 139, 1, 141, 1, 165, 3, 0, 153, 2, 153, 2, 137, 1, 143, 1, 151, 2, 151, 2, 1, 165, 3, 0, 151, 2,
+    155, 2, 137, 1, 141, 1, 153, 2, 139, 1, 141, 1, 151, 2, 141, 1, 151, 2, 141, 1, 139, 1, 153, 2, 0, 165, 3, 0, 151,
+    2, 141, 1, 153, 2, 0, 151, 2, 155, 2, 2, 153, 2, 139, 1, 141, 1, 151, 2, 141, 1, 141, 1, 137, 1, 141, 1, 153, 2,
+    139, 1, 139, 1, 141, 1, 153, 2, 2, 153, 2, 141, 1, 151, 2, 1, 137, 1, 155, 2, 139, 1, 139, 1, 141, 1, 139, 1, 151,
+    2, 1, 151, 2, 1, 151, 2, 141, 1, 137, 1, 143, 1, 137, 1, 141, 1, 153, 2, 0, 151, 2, 1, 151, 2, 0, 153, 2, 0, 153, 2,
+    139, 1, 139, 1, 1, 151, 2, 141, 1, 139, 1, 139, 1, 139, 1, 1, 151, 2, 141, 1, 139, 1, 0, 153, 2, 141, 1, 2, 153, 2,
+    139, 1, 0, 155, 2, 2, 139, 1, 141, 1, 151, 2, 1, 139, 1, 139, 1, 0, 153, 2, 141, 1, 2, 153, 2, 1, 137, 1, 153, 2, 1,
+    2, 153, 2, 139, 1, 0, 153, 2, 1, 137, 1, 141, 1, 0, 151, 2, 1, 151, 2, 0, 141, 1, 0, 151, 2, 0, 141, 1, 139, 1, 141,
+    1, 139, 1, 0, 151, 2, 1, 2, 155, 2, 2, 141, 1, 139, 1, 139, 1, 1, 151, 2, 0, 0, 153, 2, 0, 141, 1, 137, 1, 141, 1,
+    0, 141, 1, 139, 1, 2, 141, 1, 141, 1, 139, 1, 0, 139, 1, 141, 1, 139, 1, 0, 139, 1, 0, 153, 2, 0, 1, 149, 2, 1, 139,
+    1, 1, 137, 1, 141, 1, 139, 1, 1, 137, 1, 1, 153, 2, 142, 1, 151, 2, 1, 139, 1, 0, 153, 2, 140, 1, 151, 2, 0, 141, 1,
+    0, 139, 1, 139, 1, 0, 141, 1, 0, 139, 1, 139, 1, 1, 139, 1, 139, 1, 0, 141, 1, 2, 141, 1, 139, 1, 1, 137, 1, 1, 139,
+    1, 141, 1, 2, 141, 1, 0, 139, 1, 139, 1, 1, 2, 155, 2, 144, 1, 155, 2, 0, 2, 141, 1, 141, 1, 2, 141, 1, 0, 139, 1,
+    0, 139, 1, 1, 139, 1, 139, 1, 0, 141, 1, 2, 141, 1, 0, 0, 153, 2, 2, 1, 139, 1, 0, 141, 1, 2, 141, 1, 139, 1, 0, 0,
+    141, 1, 2, 141, 1, 141, 1, 2, 0, 141, 1, 139, 1, 0, 0, 139, 1, 0, 141, 1, 139, 1, 140, 1, 153, 2, 142, 1, 153, 2,
+    142, 1, 153, 2, 140, 1, 153, 2, 142, 1, 139, 1, 141, 1, 0, 0, 141, 1, 137, 1, 1, 0, 139, 1, 0, 139, 1, 1, 2, 141, 1,
+    139, 1, 0, 0, 141, 1, 0, 2, 153, 2, 140, 1, 141, 1, 2, 139, 1, 1, 139, 1, 0, 139, 1, 1, 2, 141, 1, 0, 139, 1, 140,
+    1, 151, 2, 1, 2, 141, 1, 0, 0, 139, 1, 0, 141, 1, 2, 141, 1, 140, 1, 151, 2, 140, 1, 139, 1, 141, 1, 0, 0, 139, 1,
+    0, 0, 139, 1, 1, 2, 141, 1, 139, 1, 140, 1, 139, 1, 141, 1, 2, 1, 2, 141, 1, 139, 1, 140, 1, 141, 1, 137, 1, 140, 1,
+    155, 2, 144, 1, 141, 1, 0, 141, 1, 2, 0, 141, 1, 0, 0, 139, 1, 0, 0, 139, 1, 1, 2, 141, 1, 0, 139, 1, 1, 2, 0, 141,
+    1, 2, 141, 1, 0, 0, 0, 141, 1, 2, 141, 1, 2, 1, 139, 1, 140, 1, 139, 1, 139, 1, 1, 2, 1, 137, 1, 1, 139, 1, 140, 1,
+    139, 1, 141, 1, 142, 1, 141, 1, 139, 1, 142, 1, 141, 1, 0, 139, 1, 1, 2, 0, 141, 1, 2, 141, 1, 140, 1, 139, 1, 0,
+    141, 1, 2, 0, 1, 137, 1, 1, 139, 1, 140, 1, 139, 1, 0, 141, 1, 2, 1, 2, 141, 1, 0, 0, 139, 1, 140, 1, 139, 1, 141,
+    1, 142, 1, 141, 1, 139, 1, 142, 1, 141, 1, 0, 0, 141, 1, 2, 0, 1, 137, 1, 1, 0, 139, 1, 140, 1, 139, 1, 139, 1, 140,
+    1, 141, 1, 2, 1, 137, 1, 1, 0, 139, 1, 140, 1, 139, 1, 0, 141, 1, 142, 1, 141, 1, 139, 1, 142, 1, 141, 1, 0, 0, 0,
+    139, 1, 0, 1, 137, 1, 1, 0, 2, 1, 139, 1, 0, 0, 141, 1, 142, 1, 139, 1, 0, 141, 1, 140, 1, 137, 1, 1, 139, 1, 140,
+    1, 139, 1, 0, 141, 1, 142, 1, 139, 1, 1, 2, 141, 1, 0, 140, 1, 151, 2, 140, 1, 139, 1, 0, 0, 1, 2, 141, 1, 2, 1,
+    139, 1, 0, 142, 1, 155, 2, 142, 1, 0, 139, 1, 0, 1, 137, 1, 138, 1, 139, 1, 2, 141, 1, 140, 1, 139, 1, 0, 0, 0, 141,
+    1, 2, 1, 2, 1, 137, 1, 1, 0, 0, 139, 1, 140, 1, 139, 1, 0, 141, 1, 142, 1, 141, 1, 2, 1, 2, 141, 1, 140, 1, 139, 1,
+    0, 139, 1, 140, 1, 139, 1, 1, 2, 0, 141, 1, 142, 1, 141, 1, 2, 141, 1, 140, 1, 139, 1, 0, 0, 0, 0, 141, 1, 2, 1, 2,
+    0, 141, 1, 0, 0, 2, 1, 139, 1, 140, 1, 139, 1, 0, 141, 1, 142, 1, 141, 1, 142, 1, 139, 1, 141, 1, 140, 1, 2, 141, 1,
+    0, 0, 0, 139, 1, 140, 1, 139, 1, 0, 1, 2, 139, 1, 1, 142, 1, 141, 1, 139, 1, 142, 1, 141, 1, 140, 1, 139, 1, 0, 0,
+    139, 1, 140, 1, 141, 1, 2, 0, 1, 139, 1, 142, 1, 141, 1, 2, 1, 0, 139, 1, 140, 1, 139, 1, 0, 0, 0, 0, 141, 1, 2, 0,
+    1, 2, 1, 139, 1, 142, 1, 141, 1, 0, 0, 139, 1, 140, 1, 139, 1, 0, 140, 1, 151, 2, 138, 1, 2, 139, 1, 1, 142, 1, 141,
+    1, 139, 1, 142, 1, 1, 139, 1, 0, 0, 0, 2, 143, 1, 142, 1, 139, 1, 0, 1, 2, 0, 141, 1, 142, 1, 141, 1, 0, 2, 1, 139,
+    1, 140, 1, 139, 1, 142, 1, 141, 1, 0, 141, 1, 142, 1, 0, 139, 1, 1, 2, 1, 2, 0, 141, 1, 0, 142, 1, 141, 1, 0, 0,
+    139, 1, 140, 1, 139, 1, 0, 0, 0, 0, 1, 2, 139, 1, 1, 2, 140, 1, 153, 2, 140, 1, 2, 141, 1, 140, 1, 139, 1, 2, 1, 0,
+    139, 1, 140, 1, 141, 1, 142, 1, 139, 1, 0, 0, 1, 137, 1, 140, 1, 141, 1, 0, 2, 1, 0, 2, 1, 139, 1, 142, 1, 141, 1,
+    0, 0, 0, 141, 1, 142, 1, 0, 139, 1, 0, 1, 2, 1, 2, 141, 1, 142, 1, 141, 1, 142, 1, 141, 1, 0, 2, 141, 1, 140, 1, 0,
+    139, 1, 0, 0, 0, 0, 0, 0, 141, 1, 142, 1, 141, 1, 2, 140, 1, 141, 1, 137, 1, 138, 1, 2, 141, 1, 140, 1, 137, 1, 1,
+    0, 0, 0, 0, 139, 1, 140, 1, 139, 1, 0, 140, 1, 139, 1, 0, 141, 1, 142, 1, 0, 141, 1, 142, 1, 141, 1, 2, 1, 2, 1,
+    139, 1, 142, 1, 141, 1, 140, 1, 139, 1, 0, 0, 0, 0, 0, 139, 1, 140, 1, 139, 1, 140, 1, 139, 1, 1, 2, 0, 1, 137, 1,
+    138, 1, 137, 1, 138, 1, 137, 1, 1, 0, 2, 1, 0, 139, 1, 140, 1, 139, 1, 0, 142, 1, 141, 1, 0, 0, 0, 141, 1, 142, 1,
+    139, 1, 140, 1, 141, 1, 2, 1, 2, 1, 2, 0, 141, 1, 140, 1, 137, 1, 138, 1, 139, 1, 2, 1, 0, 0, 2, 143, 1, 144, 1,
+    143, 1, 144, 1, 141, 1, 1, 2, 0, 0, 0, 141, 1, 142, 1, 139, 1, 138, 1, 137, 1, 1, 2, 1, 2, 1, 2, 1, 139, 1, 142, 1,
+    141, 1, 0, 0, 142, 1, 141, 1, 141, 1, 144, 1, 1, 0, 141, 1, 144, 1, 143, 1, 2, 140, 1, 139, 1, 0, 1, 2, 141, 1, 142,
+    1, 0, 141, 1, 2, 138, 1, 137, 1, 1, 2, 1, 0, 2, 141, 1, 140, 1, 0, 139, 1, 0, 142, 1, 141, 1, 0, 0, 0, 0, 0, 141, 1,
+    142, 1, 139, 1, 140, 1, 139, 1, 1, 142, 1, 139, 1, 0, 1, 137, 1, 138, 1, 2, 141, 1, 142, 1, 141, 1, 142, 1, 141, 1,
+    0, 0, 2, 1, 0, 0, 2, 141, 1, 140, 1, 139, 1, 140, 1, 139, 1, 0, 0, 0, 1, 2, 0, 0, 0, 139, 1, 138, 1, 137, 1, 0, 138,
+    1, 137, 1, 1, 2, 0, 1, 2, 1, 139, 1, 142, 1, 141, 1, 140, 1, 137, 1, 1, 140, 1, 139, 1, 2, 1, 0, 139, 1, 140, 1, 0,
+    0, 139, 1, 140, 1, 139, 1, 0, 0, 140, 1, 141, 1, 2, 0, 0, 141, 1, 142, 1, 0, 141, 1, 142, 1, 141, 1, 142, 1, 139, 1,
+    1, 2, 1, 0, 2, 1, 2, 1, 139, 1, 142, 1, 141, 1, 140, 1, 139, 1, 140, 1, 137, 1, 1, 0, 0, 0, 0, 0, 141, 1, 144, 1, 1,
+    141, 1, 142, 1, 139, 1, 0, 140, 1, 141, 1, 2, 0, 1, 2, 0, 0, 141, 1, 142, 1, 1, 137, 1, 138, 1, 137, 1, 1, 142, 1,
+    141, 1, 0, 0, 2, 1, 0, 139, 1, 142, 1, 1, 139, 1, 140, 1, 139, 1, 140, 1, 139, 1, 142, 1, 141, 1, 0, 0, 0, 1, 2, 0,
+    139, 1, 140, 1, 0, 141, 1, 142, 1, 139, 1, 140, 1, 141, 1, 2, 0, 140, 1, 141, 1, 2, 1, 2, 141, 1, 142, 1, 1, 139, 1,
+    142, 1, 0, 141, 1, 0, 142, 1, 141, 1, 0, 0, 0, 142, 1, 153, 2, 140, 1, 0, 0, 2, 143, 1, 144, 1, 1, 139, 1, 140, 1,
+    139, 1, 0, 1, 144, 1, 141, 1, 1, 2, 0, 0, 0, 141, 1, 142, 1, 0, 141, 1, 142, 1, 0, 141, 1, 2, 140, 1, 141, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 0, 137, 1, 138, 1, 2, 141, 1, 140, 1, 139, 1, 142, 1, 141, 1, 0, 0, 0, 142, 1, 141, 1, 0, 141, 1,
+    144, 1, 1, 0, 0, 139, 1, 140, 1, 141, 1, 144, 1, 143, 1, 142, 1, 139, 1, 0, 140, 1, 139, 1, 1, 2, 0, 0, 1, 2, 141,
+    1, 142, 1, 0, 141, 1, 142, 1, 0, 141, 1, 0, 142, 1, 139, 1, 1, 142, 1, 141, 1, 0, 2, 1, 2, 1, 0, 139, 1, 142, 1, 1,
+    0, 139, 1, 142, 1, 141, 1, 140, 1, 139, 1, 0, 140, 1, 139, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 139, 1, 140, 1, 0, 139,
+    1, 140, 1, 141, 1, 142, 1, 139, 1, 1, 2, 140, 1, 139, 1, 1, 2, 0, 1, 2, 1, 2, 141, 1, 142, 1, 0, 141, 1, 140, 1, 2,
+    141, 1, 2, 138, 1, 137, 1, 138, 1, 139, 1, 2, 1, 0, 0, 2, 1, 0, 0, 2, 1, 139, 1, 140, 1, 0, 139, 1, 142, 1, 143, 1,
+    144, 1, 141, 1, 140, 1, 139, 1, 0, 140, 1, 139, 1, 0, 0, 1, 2, 0, 0, 0, 0, 141, 1, 142, 1, 0, 0, 139, 1, 138, 1,
+    137, 1, 140, 1, 141, 1, 142, 1, 139, 1, 1, 142, 1, 139, 1, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 141, 1, 142, 1, 1, 139, 1,
+    142, 1, 141, 1, 140, 1, 137, 1, 138, 1, 139, 1, 0, 142, 1, 141, 1, 0, 0, 2, 1, 0, 0, 0, 0, 0, 2, 1, 139, 1, 140, 1,
+    0, 139, 1, 140, 1, 139, 1, 140, 1, 139, 1, 140, 1, 141, 1, 2, 140, 1, 139, 1, 0, 0, 0, 1, 2, 0, 0, 1, 2, 0, 0, 0,
+    141, 1, 142, 1, 0, 141, 1, 142, 1, 141, 1, 142, 1, 141, 1, 142, 1, 139, 1, 1, 142, 1, 141, 1, 2, 1, 0, 2, 140, 1,
+    141, 1, 0, 139, 1, 142, 1, 1, 2, 1, 2, 141, 1, 140, 1, 0, 139, 1, 142, 1, 141, 1, 140, 1, 139, 1, 142, 1, 141, 1, 0,
+    140, 1, 139, 1, 0, 0, 0, 2, 138, 1, 139, 1, 0, 139, 1, 140, 1, 0, 0, 0, 0, 139, 1, 140, 1, 0, 141, 1, 142, 1, 0,
+    139, 1, 140, 1, 139, 1, 0, 140, 1, 141, 1, 2, 140, 1, 139, 1, 1, 2, 0, 1, 142, 1, 139, 1, 0, 141, 1, 142, 1, 1, 2,
+    0, 1, 137, 1, 138, 1, 2, 141, 1, 142, 1, 141, 1, 142, 1, 0, 141, 1, 0, 142, 1, 141, 1, 2, 138, 1, 137, 1, 1, 0, 2,
+    138, 1, 137, 1, 1, 0, 2, 1, 139, 1, 140, 1, 0, 2, 1, 0, 139, 1, 142, 1, 1, 139, 1, 140, 1, 139, 1, 140, 1, 139, 1,
+    142, 1, 141, 1, 1, 144, 1, 141, 1, 0, 140, 1, 139, 1, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 139, 1, 140, 1, 0, 0, 141,
+    1, 142, 1, 139, 1, 140, 1, 141, 1, 142, 1, 139, 1, 140, 1, 141, 1, 142, 1, 139, 1, 1, 2, 140, 1, 141, 1, 2, 1, 2, 0,
+    1, 142, 1, 153, 2, 142, 1, 1, 2, 0, 1, 2, 1, 137, 1, 138, 1, 2, 141, 1, 140, 1, 2, 141, 1, 142, 1, 141, 1, 142, 1,
+    141, 1, 0, 142, 1, 141, 1, 0, 140, 1, 137, 1, 1, 0, 142, 1, 141, 1, 0, 0, 0, 2, 1, 0, 0, 0, 2, 141, 1, 140, 1, 0, 0,
+    139, 1, 140, 1, 0, 139, 1, 140, 1, 2, 143, 1, 144, 1, 143, 1, 144, 1, 141, 1, 1, 144, 1, 143, 1, 2, 140, 1, 139, 1,
+    0, 0, 140, 1, 139, 1, 0, 0, 1, 2, 0, 0, 0, 0, 1, 2, 139, 1, 140, 1, 1, 2, 139, 1, 140, 1, 1, 137, 1, 140, 1, 1, 137,
+    1, 140, 1, 141, 1, 142, 1, 139, 1, 138, 1, 137, 1, 1, 142, 1, 139, 1, 1, 2, 138, 1, 137, 1, 1, 2, 1, 2, 1, 2, 138,
+    1, 149, 2, 138, 1, 0, 2, 1, 2, 1, 2, 141, 1, 140, 1, 2, 141, 1, 140, 1, 2, 141, 1, 140, 1, 2, 141, 1, 140, 1, 137,
+    1, 1, 140, 1, 139, 1, 142, 1, 141, 1, 0, 140, 1, 139, 1, 0, 2, 138, 1, 139, 1, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 139, 1, 140, 1, 0, 0, 139, 1, 140, 1, 0, 139, 1, 140, 1, 139, 1, 140, 1, 0, 139, 1, 140, 1, 139, 1, 1, 142, 1,
+    139, 1, 140, 1, 139, 1, 0, 140, 1, 139, 1, 1, 2, 0, 140, 1, 139, 1, 1, 2, 0, 1, 2, 0, 0, 1, 2, 0, 0, 141, 1, 142, 1,
+    1, 2, 0, 141, 1, 142, 1, 0, 141, 1, 142, 1, 1, 137, 1, 138, 1, 137, 1, 140, 1, 141, 1, 142, 1, 141, 1, 142, 1, 141,
+    1, 0, 142, 1, 139, 1, 1, 142, 1, 141, 1, 0, 2, 138, 1, 137, 1, 1, 2, 149, 173, 190, 161, 142, 26, 131, 225, 209,
+    229, 251, 19, 2, 0, 0, 1, 2, 0, 1, 2, 0, 0, 153, 2, 152, 2, 2, 0, 153, 2, 152, 2, 2, 0, 153, 2, 154, 2, 153, 2, 152,
+    2, 2, 153, 2, 154, 2, 153, 2, 152, 2, 151, 2, 0, 154, 2, 153, 2, 0, 154, 2, 153, 2, 0, 152, 2, 151, 2, 0, 0, 0, 154,
+    2, 153, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 153, 2, 154, 2, 0, 0, 153, 2, 154, 2, 0, 0, 153, 2, 154, 2, 0,
+    153, 2, 154, 2, 151, 2, 152, 2, 153, 2, 154, 2, 153, 2, 154, 2, 153, 2, 154, 2, 151, 2, 1, 154, 2, 153, 2, 0, 154,
+    2, 151, 2, 1, 0, 0, 154, 2, 153, 2, 2, 1, 0, 0, 2, 1, 0, 0, 2, 1, 0, 0, 2, 1, 0, 0, 151, 2, 152, 2, 0, 2, 155, 2,
+    154, 2, 2, 1, 153, 2, 156, 2, 155, 2, 154, 2, 0, 151, 2, 152, 2, 151, 2, 152, 2, 153, 2, 156, 2, 155, 2, 154, 2,
+    151, 2, 1, 156, 2, 155, 2, 2, 152, 2, 153, 2, 2, 1, 156, 2, 155, 2, 2, 1, 2, 1, 154, 2, 151, 2, 1, 2, 1, 2, 1, 2, 0,
+    1, 2, 155, 2, 156, 2, 1, 2, 1, 2, 153, 2, 152, 2, 2, 1, 151, 2, 152, 2, 2, 153, 2, 152, 2, 2, 155, 2, 156, 2, 153,
+    2, 152, 2, 151, 2, 152, 2, 151, 2, 154, 2, 155, 2, 156, 2, 153, 2, 152, 2, 151, 2, 0, 152, 2, 151, 2, 0, 152, 2,
+    151, 2, 0, 0, 152, 2, 151, 2, 0, 1, 2, 0, 0, 1, 156, 2, 153, 2, 0, 1, 2, 0, 0, 1, 151, 2, 154, 2, 0, 0, 1, 2, 0,
+    153, 2, 154, 2, 0, 1, 151, 2, 154, 2, 0, 153, 2, 154, 2, 1, 151, 2, 154, 2, 0, 153, 2, 154, 2, 153, 2, 154, 2, 153,
+    2, 152, 2, 151, 2, 154, 2, 153, 2, 154, 2, 153, 2, 0, 154, 2, 153, 2, 0, 154, 2, 153, 2, 0, 152, 2, 151, 2, 0, 0, 2,
+    150, 2, 151, 2, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 153, 2, 154, 2, 0, 0, 0, 151, 2, 152, 2, 0,
+    153, 2, 154, 2, 0, 153, 2, 154, 2, 0, 151, 2, 152, 2, 153, 2, 154, 2, 0, 153, 2, 154, 2, 151, 2, 1, 154, 2, 153, 2,
+    154, 2, 151, 2, 152, 2, 153, 2, 0, 154, 2, 153, 2, 2, 152, 2, 153, 2, 0, 2, 152, 2, 153, 2, 0, 2, 1, 154, 2, 153, 2,
+    0, 2, 1, 0, 2, 1, 0, 0, 2, 1, 0, 2, 1, 0, 2, 1, 0, 151, 2, 152, 2, 0, 2, 1, 153, 2, 156, 2, 1, 0, 151, 2, 152, 2, 0,
+    151, 2, 152, 2, 2, 155, 2, 154, 2, 2, 155, 2, 154, 2, 151, 2, 152, 2, 151, 2, 152, 2, 151, 2, 152, 2, 151, 2, 152,
+    2, 153, 2, 156, 2, 155, 2, 2, 152, 2, 151, 2, 1, 156, 2, 155, 2, 2, 152, 2, 153, 2, 2, 0, 152, 2, 153, 2, 2, 0, 1,
+    154, 2, 151, 2, 1, 2, 0, 1, 2, 1, 2, 1, 2, 1, 2, 0, 1, 2, 1, 2, 1, 2, 1, 151, 2, 154, 2, 1, 2, 1, 2, 153, 2, 152, 2,
+    2, 153, 2, 152, 2, 2, 1, 151, 2, 154, 2, 1, 151, 2, 154, 2, 153, 2, 152, 2, 2, 155, 2, 156, 2, 153, 2, 152, 2, 151,
+    2, 154, 2, 153, 2, 152, 2, 151, 2, 0, 152, 2, 151, 2, 154, 2, 155, 2, 2, 154, 2, 153, 2, 1, 156, 2, 153, 2, 0, 152,
+    2, 151, 2, 0, 0, 1, 156, 2, 153, 2, 0, 1, 2, 0, 154, 2, 155, 2, 2, 0, 0, 0, 0, 1, 2, 0, 0, 0, 1, 2, 0, 0, 0, 0, 153,
+    2, 152, 2, 2, 0, 0, 0, 153, 2, 154, 2, 1, 2, 153, 2, 154, 2, 0, 0, 153, 2, 154, 2, 1, 149, 2, 150, 2, 2, 153, 2,
+    154, 2, 153, 2, 154, 2, 0, 153, 2, 154, 2, 153, 2, 154, 2, 153, 2, 152, 2, 149, 2, 150, 2, 151, 2, 154, 2, 153, 2,
+    0, 154, 2, 153, 2, 154, 2, 153, 2, 0, 154, 2, 153, 2, 0, 154, 2, 153, 2, 0, 0, 154, 2, 153, 2, 0, 0, 154, 2, 153, 2,
+    0, 0, 2, 1, 0, 152, 2, 149, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 153, 2, 154, 2, 0, 0, 2, 1, 153,
+    2, 154, 2, 0, 0, 0, 151, 2, 152, 2, 0, 0, 153, 2, 154, 2, 0, 151, 2, 152, 2, 0, 153, 2, 154, 2, 151, 2, 152, 2, 0,
+    153, 2, 154, 2, 151, 2, 152, 2, 153, 2, 154, 2, 153, 2, 154, 2, 151, 2, 152, 2, 153, 2, 154, 2, 151, 2, 152, 2, 153,
+    2, 0, 154, 2, 151, 2, 1, 154, 2, 151, 2, 1, 154, 2, 153, 2, 2, 152, 2, 153, 2, 0, 2, 152, 2, 153, 2, 2, 1, 154, 2,
+    153, 2, 2, 1, 0, 2, 1, 154, 2, 153, 2, 2, 1, 0, 2, 1, 0, 2, 1, 0, 2, 1, 2, 1, 0, 2, 1, 0, 2, 155, 2, 156, 2, 1, 0,
+    2, 1, 153, 2, 156, 2, 1, 0, 2, 155, 2, 156, 2, 1, 0, 151, 2, 152, 2, 2, 1, 151, 2, 152, 2, 0, 151, 2, 152, 2, 151,
+    2, 152, 2, 2, 155, 2, 156, 2, 155, 2, 154, 2, 2, 155, 2, 156, 2, 155, 2, 156, 2, 155, 2, 156, 2, 155, 2, 156, 2,
+    155, 2, 2, 152, 2, 151, 2, 152, 2, 151, 2, 152, 2, 151, 2, 1, 156, 2, 155, 2, 2, 152, 2, 151, 2, 1, 156, 2, 155, 2,
+    2, 0, 152, 2, 153, 2, 2, 0, 152, 2, 151, 2, 1, 2, 1, 2, 152, 2, 151, 2, 0, 1, 2, 1, 2, 0, 1, 156, 2, 155, 2, 2, 1,
+    2, 0, 1, 2, 1, 2, 0, 1, 151, 2, 154, 2, 1, 2, 1, 2, 0, 1, 2, 153, 2, 152, 2, 2, 0, 1, 2, 153, 2, 152, 2, 2, 1, 151,
+    2, 154, 2, 1, 2, 153, 2, 154, 2, 1, 151, 2, 154, 2, 1, 151, 2, 154, 2, 1, 151, 2, 154, 2, 153, 2, 152, 2, 2, 153, 2,
+    152, 2, 151, 2, 154, 2, 153, 2, 152, 2, 151, 2, 154, 2, 153, 2, 152, 2, 151, 2, 154, 2, 153, 2, 152, 2, 151, 2, 154,
+    2, 155, 2, 2, 154, 2, 153, 2, 152, 2, 151, 2, 0, 154, 2, 153, 2, 1, 156, 2, 153, 2, 0, 152, 2, 151, 2, 0, 0, 154, 2,
+    153, 2, 1, 2, 154, 2, 153, 2, 0, 1, 2, 154, 2, 153, 2, 0, 0, 1, 2, 0, 0, 154, 2, 155, 2, 2, 0, 0, 0, 0, 0, 0, 1, 2,
+    0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 153, 2, 154, 2, 0, 0, 1, 2, 0, 0, 153, 2, 154, 2, 0, 0, 0, 153, 2, 154, 2, 0, 1, 149,
+    2, 150, 2, 2, 0, 153, 2, 154, 2, 0, 153, 2, 154, 2, 0, 0, 153, 2, 154, 2, 153, 2, 154, 2, 0, 153, 2, 154, 2, 153, 2,
+    154, 2, 1, 149, 2, 150, 2, 149, 2, 150, 2, 149, 2, 150, 2, 149, 2, 150, 2, 149, 2, 150, 2, 149, 2, 150, 2, 149, 2,
+    150, 2, 149, 2, 150, 2, 149, 2, 150, 2, 149, 2, 1, 154, 2, 153, 2, 0, 154, 2, 153, 2, 154, 2, 153, 2, 0, 154, 2,
+    153, 2, 0, 154, 2, 153, 2, 0, 0, 154, 2, 153, 2, 0, 2, 150, 2, 149, 2, 1, 0, 0, 154, 2, 153, 2, 0, 0, 0, 0, 154, 2,
+    153, 2, 2, 1, 0, 0, 0, 0, 0, 0, 154, 2, 153, 2, 2, 1, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 153, 2, 154, 2, 2, 1, 0, 0, 0,
+    0, 0, 2, 155, 2, 154, 2, 0, 0, 0, 2, 155, 2, 154, 2, 0, 0, 0, 151, 2, 152, 2, 0, 0, 151, 2, 152, 2, 0, 0, 153, 2,
+    156, 2, 1, 153, 2, 154, 2, 0, 151, 2, 152, 2, 0, 153, 2, 154, 2, 2, 155, 2, 154, 2, 151, 2, 152, 2, 0, 153, 2, 154,
+    2, 151, 2, 152, 2, 153, 2, 154, 2, 151, 2, 152, 2, 153, 2, 154, 2, 151, 2, 152, 2, 153, 2, 154, 2, 151, 2, 152, 2,
+    153, 2, 154, 2, 151, 2, 152, 2, 153, 2, 2, 152, 2, 153, 2, 154, 2, 151, 2, 1, 154, 2, 151, 2, 1, 154, 2, 151, 2, 1,
+    154, 2, 151, 2, 1, 154, 2, 153, 2, 2, 152, 2, 153, 2, 2, 1, 154, 2, 151, 2, 1, 0, 2, 152, 2, 153, 2, 2, 1, 2, 152,
+    2, 153, 2, 0, 2, 1, 2, 152, 2, 153, 2, 2, 1, 0, 2, 1, 0, 2, 1, 2, 1, 0, 2, 152, 2, 153, 2, 2, 1, 0, 2, 1, 151, 2,
+    152, 2, 2, 1, 0, 2, 1, 2, 1, 0, 2, 1, 2, 155, 2, 156, 2, 1, 0, 2, 1, 2, 155, 2, 156, 2, 1, 0, 2, 153, 2, 152, 2, 0,
+    2, 1, 151, 2, 152, 2, 2, 1, 151, 2, 152, 2, 0, 151, 2, 152, 2, 2, 1, 151, 2, 152, 2, 2, 155, 2, 156, 2, 1, 151, 2,
+    152, 2, 151, 2, 152, 2, 2, 155, 2, 156, 2, 155, 2, 156, 2, 1, 151, 2, 152, 2, 151, 2, 152, 2, 151, 2, 152, 2, 151,
+    2, 152, 2, 151, 2, 152, 2, 151, 2, 152, 2, 151, 2, 152, 2, 151, 2, 152, 2, 151, 2, 152, 2, 151, 2, 152, 2, 151, 2,
+    152, 2, 151, 2, 0, 152, 2, 151, 2, 152, 2, 151, 2, 0, 152, 2, 151, 2, 1, 156, 2, 155, 2, 2, 152, 2, 151, 2, 0, 152,
+    2, 151, 2, 1, 156, 2, 155, 2, 2, 152, 2, 151, 2, 0, 1, 156, 2, 155, 2, 2, 0, 1, 156, 2, 155, 2, 2, 0, 1, 156, 2,
+    155, 2, 2, 0, 1, 2, 152, 2, 151, 2, 0, 1, 2, 0, 1, 2, 0, 152, 2, 151, 2, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 1, 2,
+    0, 1, 2, 1, 2, 0, 1, 2, 0, 1, 151, 2, 154, 2, 0, 1, 2, 0, 1, 2, 0, 155, 2, 156, 2, 0, 1, 2, 0, 153, 2, 152, 2, 2, 0,
+    1, 2, 153, 2, 152, 2, 2, 0, 153, 2, 152, 2, 2, 0, 153, 2, 152, 2, 2, 0, 155, 2, 156, 2, 0, 153, 2, 152, 2, 2, 153,
+    2, 154, 2, 1, 151, 2, 154, 2, 1, 151, 2, 154, 2, 0, 153, 2, 152, 2, 151, 2, 154, 2, 1, 151, 2, 154, 2, 153, 2, 154,
+    2, 153, 2, 152, 2, 2, 153, 2, 152, 2, 151, 2, 154, 2, 153, 2, 154, 2, 155, 2, 156, 2, 153, 2, 154, 2, 153, 2, 152,
+    2, 151, 2, 154, 2, 153, 2, 152, 2, 151, 2, 154, 2, 153, 2, 0, 152, 2, 151, 2, 154, 2, 153, 2, 154, 2, 155, 2, 2,
+    154, 2, 153, 2, 0, 154, 2, 155, 2, 156, 2, 153, 2, 0, 154, 2, 153, 2, 1, 156, 2, 153, 2, 0, 0, 152, 2, 151, 2, 0,
+    154, 2, 153, 2, 0, 0, 152, 2, 151, 2, 0, 0, 154, 2, 153, 2, 0, 0, 152, 2, 151, 2, 0, 0, 0, 152, 2, 151, 2, 0, 0, 0,
+    0, 154, 2, 153, 2, 0, 1, 2, 0, 0, 0, 154, 2, 153, 2, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 152, 2, 151, 2, 0, 0, 0,
+    0, 0, 0, 153, 2, 154, 2, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 153, 2, 154, 2, 0, 0, 1, 2, 0, 153, 2, 154, 2, 0,
+    0, 0, 0, 153, 2, 154, 2, 0, 0, 0, 0, 153, 2, 154, 2, 0, 0, 153, 2, 154, 2, 0, 0, 153, 2, 154, 2, 0, 0, 153, 2, 154,
+    2, 0, 153, 2, 154, 2, 0, 0, 153, 2, 154, 2, 0, 153, 2, 154, 2, 0, 153, 2, 154, 2, 0, 153, 2, 154, 2, 153, 2, 154, 2,
+    0, 153, 2, 154, 2, 0, 153, 2, 154, 2, 153, 2, 154, 2, 153, 2, 154, 2, 0, 153, 2, 154, 2, 153, 2, 154, 2, 153, 2,
+    154, 2, 153, 2, 154, 2, 153, 2, 154, 2, 0, 153, 2, 154, 2, 151, 2, 1, 154, 2, 153, 2, 154, 2, 153, 2, 154, 2, 153,
+    2, 154, 2, 153, 2, 154, 2, 153, 2, 154, 2, 153, 2, 0, 154, 2, 151, 2, 150, 2, 149, 2, 1, 154, 2, 153, 2, 154, 2,
+    153, 2, 0, 154, 2, 153, 2, 0, 154, 2, 151, 2, 1, 154, 2, 153, 2, 154, 2, 153, 2, 0, 0, 154, 2, 153, 2, 2, 150, 2,
+    149, 2, 1, 154, 2, 153, 2, 0, 0, 154, 2, 153, 2, 2, 1, 154, 2, 153, 2, 0, 0, 0, 154, 2, 153, 2, 2, 1, 154, 2, 153,
+    2, 0, 0, 0, 2, 152, 2, 153, 2, 0, 0, 0, 0, 2, 152, 2, 153, 2, 0, 0, 0, 0, 2, 1, 0, 154, 2, 153, 2, 0, 0, 2, 1, 0, 0,
+    0, 0, 2, 1, 0, 0, 0, 2, 1, 0, 0, 0, 0, 2, 1, 0, 0, 0, 2, 1, 0, 0, 0, 0, 2, 1, 0, 0, 0, 2, 155, 2, 154, 2, 0, 0, 2,
+    1, 0, 0, 0, 151, 2, 152, 2, 0, 0, 2, 1, 0, 153, 2, 156, 2, 1, 0, 0, 0, 151, 2, 152, 2, 0, 0, 0, 151, 2, 152, 2, 0,
+    0, 151, 2, 152, 2, 0, 0, 151, 2, 152, 2, 0, 0, 151, 2, 152, 2, 0, 0, 151, 2, 152, 2, 0, 151, 2, 152, 2, 0, 153, 2,
+    156, 2, 1, 0, 153, 2, 154, 2, 151, 2, 152, 2, 0, 151, 2, 152, 2, 0, 151, 2, 152, 2, 0, 153, 2, 154, 2, 151, 2, 152,
+    2, 0, 151, 2, 152, 2, 153, 2, 156, 2, 1, 153, 2, 154, 2, 151, 2, 152, 2, 153, 2, 156, 2, 1, 153, 2, 154, 2, 151, 2,
+    152, 2, 153, 2, 156, 2, 155, 2, 154, 2, 151, 2, 152, 2, 153, 2, 154, 2, 151, 2, 152, 2, 151, 2, 152, 2, 153, 2, 154,
+    2, 151, 2, 152, 2, 153, 2, 156, 2, 155, 2, 154, 2, 151, 2, 1, 154, 2, 151, 2, 152, 2, 153, 2, 154, 2, 151, 2, 1,
+    156, 2, 155, 2, 154, 2, 151, 2, 1, 154, 2, 151, 2, 1, 154, 2, 151, 2, 152, 2, 153, 2, 2, 152, 2, 153, 2, 2, 152, 2,
+    153, 2, 2, 152, 2, 151, 2, 1, 154, 2, 151, 2, 1, 0, 156, 2, 155, 2, 2, 152, 2, 153, 2, 2, 1, 154, 2, 151, 2, 1, 154,
+    2, 151, 2, 1, 2, 1, 154, 2, 151, 2, 1, 2, 152, 2, 153, 2, 2, 1, 0, 156, 2, 155, 2, 2, 1, 0, 156, 2, 155, 2, 0, 2, 1,
+    2, 152, 2, 153, 2, 2, 1, 2, 1, 2, 1, 154, 2, 151, 2, 1, 2, 1, 0, 2, 1, 2, 152, 2, 153, 2, 2, 1, 2, 1, 2, 1, 2, 1, 0,
+    2, 1, 2, 1, 2, 1, 0, 2, 1, 2, 1, 2, 1, 2, 1, 0, 2, 1, 2, 1, 2, 1, 2, 1, 0, 2, 1, 2, 1, 2, 1, 151, 2, 152, 2, 2, 1,
+    2, 1, 0, 2, 1, 2, 155, 2, 156, 2, 1, 2, 1, 2, 1, 151, 2, 152, 2, 2, 1, 2, 1, 0, 151, 2, 154, 2, 1, 0, 2, 153, 2,
+    152, 2, 0, 2, 1, 151, 2, 154, 2, 1, 0, 2, 153, 2, 152, 2, 0, 2, 153, 2, 152, 2, 0, 2, 153, 2, 152, 2, 0, 2, 153, 2,
+    152, 2, 2, 155, 2, 156, 2, 1, 2, 155, 2, 156, 2, 1, 151, 2, 152, 2, 2, 155, 2, 156, 2, 1, 151, 2, 152, 2, 2, 153, 2,
+    152, 2, 0, 151, 2, 154, 2, 1, 151, 2, 152, 2, 151, 2, 152, 2, 2, 155, 2, 156, 2, 1, 151, 2, 154, 2, 155, 2, 156, 2,
+    1, 151, 2, 152, 2, 151, 2, 152, 2, 151, 2, 154, 2, 1, 151, 2, 152, 2, 151, 2, 152, 2, 151, 2, 152, 2, 151, 2, 154,
+    2, 155, 2, 156, 2, 1, 151, 2, 152, 2, 151, 2, 152, 2, 151, 2, 154, 2, 155, 2, 156, 2, 155, 2, 156, 2, 153, 2, 152,
+    2, 151, 2, 152, 2, 151, 2, 0, 152, 2, 151, 2, 152, 2, 151, 2, 152, 2, 151, 2, 152, 2, 151, 2, 154, 2, 155, 2, 2,
+    152, 2, 151, 2, 154, 2, 155, 2, 2, 152, 2, 151, 2, 154, 2, 155, 2, 2, 152, 2, 151, 2, 154, 2, 155, 2, 2, 152, 2,
+    151, 2, 154, 2, 155, 2, 2, 152, 2, 151, 2, 0, 152, 2, 151, 2, 0, 152, 2, 151, 2, 0, 152, 2, 151, 2, 1, 156, 2, 153,
+    2, 1, 156, 2, 155, 2, 2, 0, 152, 2, 151, 2, 0, 152, 2, 151, 2, 1, 2, 154, 2, 155, 2, 2, 0, 152, 2, 151, 2, 0, 1,
+    156, 2, 155, 2, 2, 0, 152, 2, 151, 2, 0, 1, 156, 2, 153, 2, 1, 2, 0, 152, 2, 151, 2, 1, 2, 0, 152, 2, 151, 2, 0, 1,
+    2, 0, 152, 2, 151, 2, 0, 1, 2, 0, 0, 152, 2, 151, 2, 1, 2, 0, 1, 2, 0, 152, 2, 151, 2, 0, 1, 2, 0, 0, 1, 2, 0, 152,
+    2, 151, 2, 1, 2, 0, 0, 1, 2, 0, 1, 2, 0, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 0, 1, 2, 0, 1,
+    2, 0, 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 0, 153, 2, 152, 2, 2, 0, 1, 2, 0, 1, 2, 0, 0, 153, 2, 152, 2, 2, 0, 1, 2, 0, 1,
+    151, 2, 154, 2, 0, 0, 1, 2, 153, 2, 154, 2, 1, 2, 0, 1, 151, 2, 154, 2, 0, 0, 1, 2, 153, 2, 154, 2, 1, 2, 0, 153, 2,
+    152, 2, 2, 0, 1, 151, 2, 154, 2, 0, 0, 153, 2, 152, 2, 2, 0, 153, 2, 152, 2, 2, 0, 153, 2, 152, 2, 2, 0, 153, 2,
+    152, 2, 2, 153, 2, 154, 2, 0, 1, 151, 2, 154, 2, 0, 153, 2, 152, 2, 2, 0, 153, 2, 152, 2, 2, 153, 2, 154, 2, 1, 151,
+    2, 154, 2, 0, 153, 2, 152, 2, 2, 153, 2, 154, 2, 0, 153, 2, 152, 2, 151, 2, 154, 2, 0, 153, 2, 152, 2, 2, 153, 2,
+    154, 2, 153, 2, 152, 2, 2, 153, 2, 154, 2, 1, 151, 2, 154, 2, 153, 2, 154, 2, 153, 2, 152, 2, 2, 153, 2, 154, 2,
+    153, 2, 152, 2, 151, 2, 154, 2, 0, 153, 2, 152, 2, 151, 2, 154, 2, 153, 2, 154, 2, 153, 2, 152, 2, 2, 153, 2, 154,
+    2, 153, 2, 154, 2, 153, 2, 152, 2, 151, 2, 154, 2, 153, 2, 154, 2, 153, 2, 152, 2, 151, 2, 154, 2, 153, 2, 154, 2,
+    153, 2, 152, 2, 151, 2, 154, 2, 153, 2, 154, 2, 153, 2, 152, 2, 151, 2, 0, 154, 2, 153, 2, 154, 2, 153, 2, 152, 2,
+    151, 2, 154, 2, 153, 2, 0, 154, 2, 155, 2, 156, 2, 153, 2, 154, 2, 153, 2, 0, 152, 2, 151, 2, 154, 2, 153, 2, 0,
+    154, 2, 153, 2, 152, 2, 151, 2, 0, 154, 2, 153, 2, 154, 2, 153, 2, 0, 152, 2, 151, 2, 0, 154, 2, 153, 2, 154, 2,
+    153, 2, 0, 152, 2, 151, 2, 0, 154, 2, 153, 2, 0, 154, 2, 153, 2, 0, 152, 2, 151, 2, 0, 154, 2, 153, 2, 0, 154, 2,
+    153, 2, 1, 156, 2, 153, 2, 0, 0, 154, 2, 153, 2, 0, 152, 2, 151, 2, 0, 0, 154, 2, 153, 2, 0, 0, 154, 2, 153, 2, 0,
+    152, 2, 151, 2, 0, 0, 0, 154, 2, 153, 2, 0, 0, 152, 2, 151, 2, 0, 0, 154, 2, 153, 2, 0, 0, 0, 154, 2, 153, 2, 0, 1,
+    2, 154, 2, 153, 2, 0, 0, 0, 154, 2, 153, 2, 0, 0, 0, 0, 152, 2, 151, 2, 0, 0, 0, 0, 154, 2, 153, 2, 0, 0, 0, 0, 0,
+    152, 2, 151, 2, 0, 0, 0, 0, 0, 0, 154, 2, 153, 2, 0, 0, 0, 0, 0, 0, 1, 2, 154, 2, 153, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 152, 2, 151, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 153, 2, 154, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 153, 2, 154, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 153, 2, 154, 2, 0, 0, 0, 0, 0, 0, 153, 2, 154, 2, 0, 0, 0, 0, 0, 153, 2, 154, 2, 0, 0, 0, 0, 0, 153, 2,
+    154, 2, 0, 0, 0, 0, 153, 2, 154, 2, 0, 0, 0, 153, 2, 154, 2, 0, 0, 0, 153, 2, 154, 2, 0, 0, 0, 153, 2, 154, 2, 0, 0,
+    0, 153, 2, 154, 2, 0, 0, 151, 2, 152, 2, 1, 2, 151, 2, 152, 2, 0, 0, 153, 2, 154, 2, 0, 0, 153, 2, 154, 2, 0, 0,
+    153, 2, 154, 2, 0, 0, 153, 2, 154, 2, 0, 153, 2, 154, 2, 0, 0, 153, 2, 154, 2, 0, 151, 2, 152, 2, 0, 153, 2, 154, 2,
+    0, 0, 153, 2, 154, 2, 0, 153, 2, 154, 2, 0, 153, 2, 154, 2, 0, 153, 2, 154, 2, 0, 151, 2, 152, 2, 0, 153, 2, 154, 2,
+    153, 2, 154, 2, 0, 153, 2, 154, 2, 0, 153, 2, 154, 2, 0, 153, 2, 154, 2, 151, 2, 152, 2, 0, 153, 2, 154, 2, 153, 2,
+    154, 2, 0, 153, 2, 154, 2, 0, 153, 2, 154, 2, 153, 2, 154, 2, 151, 2, 152, 2, 0, 153, 2, 154, 2, 153, 2, 154, 2, 0,
+    153, 2, 154, 2, 153, 2, 154, 2, 151, 2, 152, 2, 153, 2, 154, 2, 0, 153, 2, 154, 2, 153, 2, 154, 2, 153, 2, 154, 2,
+    151, 2, 150, 2, 149, 2, 152, 2, 0, 153, 2, 154, 2, 153, 2, 154, 2, 153, 2, 154, 2, 153, 2, 154, 2, 151, 2, 152, 2,
+    153, 2, 154, 2, 153, 2, 154, 2, 153, 2, 154, 2, 153, 2, 154, 2, 151, 2, 152, 2, 153, 2, 154, 2, 153, 2, 154, 2, 153,
+    2, 154, 2, 153, 2, 154, 2, 151, 2, 1, 154, 2, 153, 2, 154, 2, 153, 2, 154, 2, 153, 2, 154, 2, 151, 2, 152, 2, 153,
+    2, 0, 154, 2, 153, 2, 154, 2, 153, 2, 154, 2, 151, 2, 152, 2, 153, 2, 0, 154, 2, 153, 2, 154, 2, 153, 2, 2, 152, 2,
+    153, 2, 154, 2, 153, 2, 154, 2, 153, 2, 0, 154, 2, 151, 2, 152, 2, 153, 2, 0, 154, 2, 153, 2, 2, 150, 2, 149, 2,
+    152, 2, 153, 2, 0, 154, 2, 153, 2, 2, 152, 2, 153, 2, 154, 2, 153, 2, 0, 154, 2, 153, 2, 2, 152, 2, 153, 2, 0, 154,
+    2, 153, 2, 0, 154, 2, 151, 2, 1, 154, 2, 153, 2, 0, 154, 2, 151, 2, 1, 154, 2, 153, 2, 0, 154, 2, 153, 2, 2, 152, 2,
+    153, 2, 0, 154, 2, 153, 2, 0, 2, 152, 2, 153, 2, 0, 154, 2, 153, 2, 2, 1, 154, 2, 153, 2, 0, 154, 2, 153, 2, 2, 1,
+    154, 2, 153, 2, 0, 0, 154, 2, 151, 2, 1, 0, 154, 2, 153, 2, 2, 1, 154, 2, 153, 2, 0, 0, 154, 2, 151, 2, 1, 0, 154,
+    2, 153, 2, 0, 2, 1, 154, 2, 153, 2, 0, 2, 152, 2, 153, 2, 0, 0, 0, 154, 2, 151, 2, 1, 0, 0, 154, 2, 151, 2, 1, 0, 0,
+    0, 154, 2, 151, 2, 1, 0, 0, 2, 152, 2, 153, 2, 0, 0, 0, 2, 152, 2, 153, 2, 0, 203, 247, 181, 156, 137, 3, 249, 210,
+    234, 241, 138, 89, 2, 178, 4, 179, 4, 0, 2, 1, 2, 1, 180, 4, 177, 4, 1, 2, 1, 0, 2, 1, 180, 4, 177, 4, 1, 2, 1, 2,
+    1, 2, 1, 180, 4, 179, 4, 2, 1, 2, 1, 2, 1, 2, 1, 2, 176, 4, 175, 4, 1, 2, 1, 2, 1, 2, 1, 2, 1, 0, 2, 1, 2, 178, 4,
+    179, 4, 2, 1, 2, 1, 2, 1, 0, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 0, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 0, 2, 1, 2, 1, 2,
+    1, 2, 1, 2, 1, 0, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 0, 2, 1, 2, 1, 2, 1, 177, 4, 180, 4, 1, 2, 1, 0, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 179, 4, 178, 4, 2, 1, 0, 2, 1, 2, 1, 2, 1, 177, 4, 180, 4, 1, 2, 1, 0, 2, 1, 2, 1, 177, 4, 180, 4, 1, 2, 1,
+    2, 1, 0, 177, 4, 180, 4, 1, 2, 1, 2, 1, 177, 4, 180, 4, 1, 2, 1, 0, 2, 179, 4, 178, 4, 2, 1, 2, 1, 2, 179, 4, 178,
+    4, 2, 1, 0, 177, 4, 180, 4, 1, 2, 1, 2, 179, 4, 178, 4, 2, 1, 2, 179, 4, 178, 4, 0, 2, 1, 2, 179, 4, 178, 4, 2, 1,
+    2, 179, 4, 178, 4, 2, 1, 177, 4, 178, 4, 2, 1, 2, 179, 4, 178, 4, 2, 1, 177, 4, 180, 4, 1, 0, 2, 179, 4, 178, 4, 2,
+    1, 177, 4, 180, 4, 1, 2, 179, 4, 178, 4, 2, 1, 177, 4, 178, 4, 2, 1, 177, 4, 180, 4, 1, 177, 4, 180, 4, 1, 2, 179,
+    4, 178, 4, 2, 1, 177, 4, 178, 4, 2, 179, 4, 178, 4, 2, 1, 177, 4, 180, 4, 1, 177, 4, 180, 4, 1, 177, 4, 178, 4, 2,
+    1, 177, 4, 180, 4, 1, 177, 4, 180, 4, 1, 177, 4, 180, 4, 1, 177, 4, 180, 4, 1, 177, 4, 178, 4, 2, 179, 4, 178, 4, 2,
+    179, 4, 178, 4, 2, 179, 4, 178, 4, 2, 179, 4, 178, 4, 0, 177, 4, 180, 4, 1, 177, 4, 180, 4, 1, 177, 4, 180, 4, 1,
+    177, 4, 180, 4, 179, 4, 178, 4, 0, 177, 4, 180, 4, 1, 177, 4, 180, 4, 179, 4, 178, 4, 2, 179, 4, 178, 4, 2, 179, 4,
+    178, 4, 177, 4, 178, 4, 2, 179, 4, 178, 4, 177, 4, 180, 4, 1, 177, 4, 180, 4, 179, 4, 178, 4, 2, 179, 4, 178, 4,
+    177, 4, 178, 4, 2, 179, 4, 178, 4, 177, 4, 180, 4, 179, 4, 178, 4, 2, 179, 4, 178, 4, 177, 4, 180, 4, 179, 4, 178,
+    4, 2, 181, 4, 182, 4, 179, 4, 178, 4, 177, 4, 180, 4, 179, 4, 178, 4, 2, 179, 4, 178, 4, 177, 4, 180, 4, 179, 4,
+    178, 4, 177, 4, 178, 4, 177, 4, 180, 4, 1, 177, 4, 180, 4, 179, 4, 178, 4, 177, 4, 180, 4, 179, 4, 178, 4, 177, 4,
+    180, 4, 179, 4, 178, 4, 177, 4, 178, 4, 177, 4, 180, 4, 179, 4, 178, 4, 177, 4, 180, 4, 179, 4, 178, 4, 177, 4, 180,
+    4, 179, 4, 178, 4, 177, 4, 180, 4, 179, 4, 178, 4, 177, 4, 178, 4, 177, 4, 180, 4, 179, 4, 178, 4, 177, 4, 180, 4,
+    179, 4, 178, 4, 177, 4, 180, 4, 179, 4, 178, 4, 177, 4, 178, 4, 177, 4, 180, 4, 179, 4, 0, 178, 4, 177, 4, 180, 4,
+    179, 4, 178, 4, 177, 4, 180, 4, 179, 4, 178, 4, 177, 4, 0, 180, 4, 179, 4, 178, 4, 177, 4, 178, 4, 177, 4, 180, 4,
+    179, 4, 0, 178, 4, 177, 4, 180, 4, 179, 4, 178, 4, 177, 4, 0, 180, 4, 179, 4, 178, 4, 177, 4, 178, 4, 177, 4, 0,
+    180, 4, 179, 4, 178, 4, 177, 4, 0, 180, 4, 179, 4, 178, 4, 177, 4, 0, 180, 4, 179, 4, 178, 4, 177, 4, 0, 178, 4,
+    177, 4, 180, 4, 179, 4, 0, 178, 4, 177, 4, 180, 4, 179, 4, 0, 178, 4, 177, 4, 0, 180, 4, 179, 4, 178, 4, 177, 4, 0,
+    178, 4, 177, 4, 0, 180, 4, 179, 4, 178, 4, 177, 4, 0, 180, 4, 179, 4, 0, 178, 4, 177, 4, 0, 180, 4, 179, 4, 0, 178,
+    4, 177, 4, 0, 178, 4, 177, 4, 0, 180, 4, 179, 4, 178, 4, 177, 4, 0, 180, 4, 179, 4, 0, 0, 178, 4, 177, 4, 0, 180, 4,
+    179, 4, 0, 178, 4, 177, 4, 0, 178, 4, 177, 4, 0, 180, 4, 179, 4, 0, 178, 4, 177, 4, 0, 0, 180, 4, 179, 4, 0, 178, 4,
+    177, 4, 0, 180, 4, 181, 4, 2, 0, 180, 4, 179, 4, 0, 178, 4, 177, 4, 0, 0, 180, 4, 179, 4, 0, 178, 4, 177, 4, 0, 0,
+    180, 4, 179, 4, 0, 0, 178, 4, 177, 4, 0, 178, 4, 177, 4, 0, 0, 180, 4, 179, 4, 0, 0, 178, 4, 177, 4, 0, 0, 180, 4,
+    179, 4, 0, 0, 178, 4, 177, 4, 0, 0, 178, 4, 177, 4, 0, 0, 0, 180, 4, 179, 4, 0, 0, 178, 4, 177, 4, 0, 0, 180, 4,
+    179, 4, 0, 0, 0, 178, 4, 177, 4, 0, 0, 0, 178, 4, 177, 4, 0, 0, 0, 180, 4, 179, 4, 0, 0, 0, 178, 4, 177, 4, 0, 0, 0,
+    180, 4, 179, 4, 0, 1, 2, 180, 4, 179, 4, 0, 0, 0, 0, 178, 4, 177, 4, 0, 0, 0, 180, 4, 179, 4, 0, 0, 0, 0, 178, 4,
+    177, 4, 0, 0, 0, 0, 178, 4, 177, 4, 0, 0, 0, 0, 0, 180, 4, 179, 4, 0, 0, 0, 0, 0, 178, 4, 177, 4, 0, 0, 0, 0, 0,
+    178, 4, 177, 4, 0, 0, 0, 0, 0, 0, 180, 4, 179, 4, 0, 0, 0, 0, 0, 0, 0, 178, 4, 177, 4, 0, 0, 0, 0, 0, 0, 0, 178, 4,
+    177, 4, 0, 0, 0, 0, 0, 0, 0, 0, 180, 4, 179, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 178, 4, 177, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 178, 4, 177, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 178, 4, 177, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 177, 4, 178, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 177, 4, 178, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 179, 4, 180, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 179, 4, 180, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 177, 4, 178, 4, 0, 0, 0, 0, 0, 0, 0, 0, 179, 4, 180, 4, 0, 0,
+    0, 0, 0, 0, 0, 179, 4, 180, 4, 0, 0, 0, 0, 0, 0, 177, 4, 178, 4, 0, 0, 0, 0, 0, 0, 179, 4, 180, 4, 0, 0, 0, 0, 0,
+    177, 4, 178, 4, 0, 0, 0, 0, 0, 179, 4, 180, 4, 0, 0, 0, 0, 0, 179, 4, 180, 4, 0, 0, 0, 0, 177, 4, 178, 4, 0, 0, 0,
+    0, 0, 179, 4, 180, 4, 0, 0, 0, 0, 177, 4, 178, 4, 0, 0, 0, 179, 4, 180, 4, 0, 0, 0, 0, 177, 4, 178, 4, 0, 1, 2, 177,
+    4, 178, 4, 0, 0, 0, 0, 179, 4, 180, 4, 0, 0, 0, 177, 4, 178, 4, 0, 0, 0, 179, 4, 180, 4, 0, 0, 0, 177, 4, 178, 4, 0,
+    0, 179, 4, 180, 4, 0, 0, 0, 177, 4, 178, 4, 0, 0, 0, 179, 4, 180, 4, 0, 0, 179, 4, 180, 4, 0, 0, 0, 177, 4, 178, 4,
+    0, 0, 179, 4, 180, 4, 0, 0, 177, 4, 178, 4, 0, 0, 0, 179, 4, 180, 4, 0, 0, 177, 4, 178, 4, 0, 0, 179, 4, 180, 4, 0,
+    0, 177, 4, 178, 4, 0, 0, 179, 4, 180, 4, 0, 0, 177, 4, 178, 4, 0, 0, 179, 4, 180, 4, 0, 179, 4, 180, 4, 0, 0, 177,
+    4, 178, 4, 0, 0, 179, 4, 180, 4, 0, 0, 177, 4, 178, 4, 0, 179, 4, 180, 4, 0, 0, 177, 4, 178, 4, 0, 179, 4, 180, 4,
+    0, 0, 177, 4, 178, 4, 0, 179, 4, 180, 4, 0, 0, 177, 4, 178, 4, 0, 179, 4, 180, 4, 0, 0, 177, 4, 178, 4, 0, 179, 4,
+    180, 4, 0, 177, 4, 176, 4, 2, 177, 4, 178, 4, 0, 0, 179, 4, 180, 4, 0, 177, 4, 178, 4, 0, 179, 4, 180, 4, 0, 177, 4,
+    178, 4, 0, 179, 4, 180, 4, 0, 177, 4, 178, 4, 0, 0, 179, 4, 180, 4, 0, 177, 4, 178, 4, 0, 179, 4, 180, 4, 0, 177, 4,
+    178, 4, 0, 179, 4, 180, 4, 0, 177, 4, 178, 4, 0, 179, 4, 180, 4, 177, 4, 178, 4, 0, 179, 4, 180, 4, 0, 177, 4, 176,
+    4, 2, 177, 4, 178, 4, 0, 179, 4, 180, 4, 0, 177, 4, 178, 4, 0, 179, 4, 180, 4, 177, 4, 178, 4, 0, 179, 4, 180, 4, 0,
+    177, 4, 178, 4, 0, 179, 4, 180, 4, 177, 4, 178, 4, 0, 179, 4, 180, 4, 0, 177, 4, 178, 4, 179, 4, 180, 4, 0, 177, 4,
+    178, 4, 0, 179, 4, 180, 4, 177, 4, 178, 4, 0, 179, 4, 180, 4, 0, 177, 4, 178, 4, 179, 4, 180, 4, 0, 177, 4, 178, 4,
+    179, 4, 180, 4, 0, 177, 4, 178, 4, 179, 4, 180, 4, 0, 177, 4, 176, 4, 175, 4, 178, 4, 0, 179, 4, 180, 4, 177, 4,
+    178, 4, 0, 179, 4, 180, 4, 177, 4, 178, 4, 0, 179, 4, 180, 4, 177, 4, 178, 4, 0, 179, 4, 180, 4, 177, 4, 178, 4,
+    179, 4, 180, 4, 0, 177, 4, 178, 4, 179, 4, 180, 4, 0, 177, 4, 178, 4, 179, 4, 180, 4, 177, 4, 178, 4, 0, 179, 4,
+    180, 4, 177, 4, 178, 4, 179, 4, 180, 4, 0, 177, 4, 178, 4, 179, 4, 180, 4, 177, 4, 178, 4, 0, 179, 4, 180, 4, 177,
+    4, 178, 4, 179, 4, 180, 4, 177, 4, 178, 4, 0, 179, 4, 180, 4, 177, 4, 178, 4, 179, 4, 180, 4, 177, 4, 178, 4, 179,
+    4, 180, 4, 0, 179, 4, 180, 4, 177, 4, 178, 4, 179, 4, 180, 4, 177, 4, 178, 4, 179, 4, 180, 4, 0, 177, 4, 178, 4,
+    179, 4, 180, 4, 177, 4, 178, 4, 179, 4, 180, 4, 177, 4, 178, 4, 179, 4, 180, 4, 177, 4, 178, 4, 0, 179, 4, 180, 4,
+    177, 4, 178, 4, 179, 4, 180, 4, 177, 4, 178, 4, 179, 4, 180, 4, 177, 4, 178, 4, 179, 4, 180, 4, 177, 4, 178, 4, 179,
+    4, 180, 4, 177, 4, 178, 4, 179, 4, 180, 4, 177, 4, 178, 4, 0, 179, 4, 180, 4, 177, 4, 178, 4, 179, 4, 180, 4, 177,
+    4, 178, 4, 179, 4, 180, 4, 177, 4, 178, 4, 179, 4, 180, 4, 177, 4, 178, 4, 179, 4, 180, 4, 177, 4, 178, 4, 179, 4,
+    180, 4, 177, 4, 178, 4, 179, 4, 180, 4, 177, 4, 178, 4, 179, 4, 2, 178, 4, 179, 4, 180, 4, 177, 4, 178, 4, 179, 4,
+    180, 4, 177, 4, 178, 4, 179, 4, 180, 4, 177, 4, 176, 4, 175, 4, 178, 4, 179, 4, 180, 4, 177, 4, 178, 4, 179, 4, 180,
+    4, 177, 4, 178, 4, 179, 4, 2, 178, 4, 179, 4, 180, 4, 177, 4, 178, 4, 179, 4, 180, 4, 177, 4, 178, 4, 179, 4, 180,
+    4, 177, 4, 178, 4, 179, 4, 2, 178, 4, 179, 4, 180, 4, 177, 4, 169, 142, 206, 177, 167, 141, 1, 199, 143, 243, 234,
+    128, 43, 230, 8, 229, 8, 230, 8, 229, 8, 230, 8, 229, 8, 0, 230, 8, 229, 8, 230, 8, 229, 8, 230, 8, 229, 8, 230, 8,
+    229, 8, 0, 230, 8, 229, 8, 230, 8, 229, 8, 230, 8, 229, 8, 230, 8, 229, 8, 0, 230, 8, 229, 8, 228, 8, 225, 8, 226,
+    8, 227, 8, 230, 8, 229, 8, 0, 230, 8, 229, 8, 230, 8, 229, 8, 230, 8, 229, 8, 0, 230, 8, 229, 8, 230, 8, 229, 8,
+    230, 8, 229, 8, 0, 230, 8, 229, 8, 230, 8, 229, 8, 230, 8, 229, 8, 0, 230, 8, 229, 8, 230, 8, 229, 8, 0, 230, 8,
+    229, 8, 230, 8, 229, 8, 230, 8, 229, 8, 0, 230, 8, 229, 8, 230, 8, 229, 8, 0, 230, 8, 229, 8, 230, 8, 229, 8, 0,
+    230, 8, 229, 8, 230, 8, 229, 8, 230, 8, 229, 8, 0, 230, 8, 229, 8, 230, 8, 229, 8, 0, 230, 8, 229, 8, 230, 8, 229,
+    8, 0, 230, 8, 229, 8, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 230, 8, 229, 8, 0, 230, 8, 229, 8, 230,
+    8, 229, 8, 0, 230, 8, 229, 8, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 230, 8, 229, 8, 0, 230, 8, 229,
+    8, 0, 230, 8, 229, 8, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0,
+    230, 8, 229, 8, 0, 230, 8, 229, 8, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 230, 8,
+    229, 8, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 230, 8, 229,
+    8, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8,
+    0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0,
+    230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0,
+    230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0,
+    230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8,
+    0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 230, 8, 229,
+    8, 0, 0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 0,
+    230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 230, 8, 229,
+    8, 0, 0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0,
+    0, 230, 8, 229, 8, 0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 0, 0,
+    230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 0, 230,
+    8, 229, 8, 0, 0, 0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 0, 0, 230, 8, 229, 8, 0, 0, 230,
+    8, 229, 8, 0, 0, 0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 0, 0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 0, 0,
+    230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 230, 8, 229, 8, 0,
+    0, 0, 230, 8, 229, 8, 0, 0, 0, 230, 8, 229, 8, 0, 0, 230, 8, 229, 8, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 0, 230, 8,
+    229, 8, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0,
+    0, 230, 8, 229, 8, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 0, 230, 8, 229, 8, 0, 2, 1, 228, 8, 227, 8, 2, 1, 0, 0, 230, 8,
+    229, 8, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 0, 230, 8, 229, 8,
+    0, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 0, 230, 8, 229, 8, 0,
+    0, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 0, 230, 8, 229, 8,
+    0, 0, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 0, 0, 230, 8,
+    229, 8, 0, 0, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 0,
+    0, 230, 8, 229, 8, 0, 2, 1, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 0, 0, 0, 230, 8,
+    229, 8, 0, 0, 0, 0, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 0, 0, 0, 230, 8, 229, 8, 0, 0, 0, 0, 251, 172, 233, 191, 187,
+    233, 1, 229, 142, 153, 249, 148, 135, 1, 0, 204, 17, 203, 17, 0, 0, 0, 0, 0, 0, 0, 204, 17, 203, 17, 0, 0, 0, 0, 0,
+    0, 0, 204, 17, 203, 17, 0, 0, 0, 0, 0, 0, 0, 204, 17, 203, 17, 0, 0, 0, 0, 2, 1, 0, 202, 17, 199, 17, 1, 0, 0, 0, 0,
+    0, 0, 0, 204, 17, 203, 17, 0, 0, 0, 0, 0, 0, 0, 0, 204, 17, 203, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 204, 17, 203, 17, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 204, 17, 203, 17, 0, 0, 0, 0, 2, 1, 0, 0, 0, 204, 17, 203, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    204, 17, 203, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 204, 17, 203, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 204, 17, 203, 17, 0,
+    0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 204, 17, 203, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 204, 17, 203, 17, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 204, 17, 203, 17, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 204, 17, 203, 17, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 204, 17, 203, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 204, 17, 203, 17, 0, 0, 0, 0, 0, 2, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 204, 17, 203, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 204, 17, 203, 17, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 204, 17, 203, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 204, 17, 203, 17, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 204, 17, 203, 17, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 204, 17, 203, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    199, 227, 166, 163, 147, 49, 251, 147, 222, 206, 141, 176, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 152, 35,
+    151, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 152, 35,
+    151, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 152, 35, 151, 35, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 152, 35, 151, 35, 0, 0, 0, 0, 0, 0, 0, 2, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 173, 243, 168, 220, 227, 161, 3, 215, 251, 224, 135, 222, 160,
+    8, 1, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0,
+    0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 176, 70, 175, 70, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0,
+    0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 2, 167, 217, 173, 206, 132, 131, 9, 233, 132, 230, 249, 254, 129, 14, 2, 1,
+    0, 0, 2, 1, 0, 0, 2, 1, 0, 0, 2, 1, 0, 0, 2, 1, 0, 0, 2, 1, 0, 0, 0, 2, 1, 0, 0, 2, 1, 0, 0, 2, 1, 0, 0, 2, 1, 0, 0,
+    2, 1, 211, 201, 203, 250, 201, 202, 43, 203, 242, 219, 149, 189, 191, 2, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1,
+    2, 1, 2, 1, 2, 1, 145, 238, 223, 194, 205, 207, 66, 171, 138, 239, 221, 192, 196, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    145, 183, 136, 211, 212, 217, 112, 235, 185, 149, 238, 199, 206, 71, 0, 0, 0, 143, 216, 187, 178, 198, 197, 20, 235,
+    137, 128, 208, 242, 138, 220, 2, 0, 133, 252, 221, 243, 226, 237, 204, 1, 243, 199, 153, 145, 143, 179, 148, 4, 199,
+    151, 206, 241, 169, 157, 220, 14,
+};
+
+// Tabulated N, and position of its first latitude in data[], followed by the end of data[]
+struct Table {
+    uint16_t N;
+    uint32_t begin;
+};
+const Table tables[] = {
+    {16, 0}, {24, 117}, {32, 273}, {48, 471}, {64, 750}, {80, 1090}, {96, 1494}, {128, 1955}, {160, 2546}, {200, 3264},
+    {256, 4075}, {320, 5041}, {400, 6181}, {512, 7548}, {576, 9250}, {640, 11102}, {800, 13008}, {1024, 15138},
+    {1280, 17639}, {1600, 20507}, {2000, 23888}, {4000, 27856}, {8000, 34631}, {0, 47069},
+};
+const size_t nb_tables = sizeof( tables ) / sizeof( Table ) - 1;
 
-void GaussianLatitudes::assign( std::vector<double>& lats ) const {
-    lats = lats_;
+const Table* find( const size_t N ) {
+    for ( size_t t = 0; t < nb_tables; ++t ) {
+        if ( tables[t].N == N ) { return tables + t; }
+    }
+    return nullptr;
 }
 
-template <typename CONCRETE>
-void load() {
-    eckit::ConcreteBuilderT0<GaussianLatitudes, CONCRETE> builder( "tmp" );
+}  // namespace
+
+bool tabulated_gaussian_latitudes( const size_t N ) {
+    return find( N ) != nullptr;
 }
 
-void regist() {
-    load<N16>();
-    load<N24>();
-    load<N32>();
-    load<N48>();
-    load<N64>();
-    load<N80>();
-    load<N96>();
-    load<N128>();
-    load<N160>();
-    load<N200>();
-    load<N256>();
-    load<N320>();
-    load<N400>();
-    load<N512>();
-    load<N576>();
-    load<N640>();
-    load<N800>();
-    load<N1024>();
-    load<N1280>();
-    load<N1600>();
-    load<N2000>();
-    load<N4000>();
-    load<N8000>();
+void tabulated_gaussian_latitudes( const size_t N, double lats[] ) {
+    const Table* table = find( N );
+    ASSERT( table );
+    const unsigned char* byte = data + table[0].begin;
+    uint64_t b1               = 0;  // b[j-1]
+    uint64_t b2               = 0;  // b[j-2]
+    for ( size_t jlat = 0; jlat < N; ++jlat ) {
+        uint64_t z = 0;
+        for ( int shift = 0;; shift += 7 ) {
+            z |= uint64_t( *byte & 127 ) << shift;
+            if ( not( *byte++ & 128 ) ) { break; }
+        }
+        const uint64_t d = ( z >> 1 ) ^ ( ~( z & 1 ) + 1 );
+        const uint64_t b = 2 * b1 - b2 + d;
+        std::memcpy( lats + jlat, &b, sizeof( double ) );
+        b2 = b1;
+        b1 = b;
+    }
+    ASSERT( byte == data + table[1].begin );
 }
 
 }  // namespace gaussian
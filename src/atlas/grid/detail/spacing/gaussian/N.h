@@ -13,74 +13,24 @@
 
 #pragma once
 
-#include "eckit/memory/Builder.h"
-#include "eckit/memory/Owned.h"
+#include <cstddef>
 
 namespace atlas {
 namespace grid {
 namespace spacing {
 namespace gaussian {
 
-class GaussianLatitudes : public eckit::Owned {
-public:
-    typedef eckit::BuilderT0<GaussianLatitudes> builder_t;
+/// Gaussian latitudes are tabulated for N = 16, 24, 32, 48, 64, 80, 96, 128, 160, 200, 256, 320, 400, 512, 576, 640,
+/// 800, 1024, 1280, 1600, 2000, 4000 and 8000, so that these are bit-reproducible. The tables are stored in compact
+/// form, and decoded exactly on request, so that they need neither static initialisation nor relocations.
 
-    static std::string className();
+/// @return true if the Gaussian latitudes are tabulated for N
+bool tabulated_gaussian_latitudes( const size_t N );
 
-    /// @pre nlats has enough allocated memory to store the latitudes
-    /// @param size of lats vector
-    void assign( double lats[], const size_t size ) const;
-
-    /// @post resizes the vector to the number of latitutes
-    void assign( std::vector<double>& lats ) const;
-
-    size_t N() const { return lats_.size(); }
-
-protected:
-    std::vector<double> lats_;
-};
-
-#define DECLARE_GAUSSIAN_LATITUDES( NUMBER )     \
-    class N##NUMBER : public GaussianLatitudes { \
-    public:                                      \
-        N##NUMBER();                             \
-    };
-
-#define LIST( ... ) __VA_ARGS__
-#define DEFINE_GAUSSIAN_LATITUDES( NUMBER, LATS )                                        \
-    eckit::ConcreteBuilderT0<GaussianLatitudes, N##NUMBER> builder_N##NUMBER( #NUMBER ); \
-                                                                                         \
-    N##NUMBER::N##NUMBER() {                                                             \
-        size_t N     = NUMBER;                                                           \
-        double lat[] = {LATS};                                                           \
-        lats_.assign( lat, lat + N );                                                    \
-    }
-
-DECLARE_GAUSSIAN_LATITUDES( 16 );
-DECLARE_GAUSSIAN_LATITUDES( 24 );
-DECLARE_GAUSSIAN_LATITUDES( 32 );
-DECLARE_GAUSSIAN_LATITUDES( 48 );
-DECLARE_GAUSSIAN_LATITUDES( 64 );
-DECLARE_GAUSSIAN_LATITUDES( 80 );
-DECLARE_GAUSSIAN_LATITUDES( 96 );
-DECLARE_GAUSSIAN_LATITUDES( 128 );
-DECLARE_GAUSSIAN_LATITUDES( 160 );
-DECLARE_GAUSSIAN_LATITUDES( 200 );
-DECLARE_GAUSSIAN_LATITUDES( 256 );
-DECLARE_GAUSSIAN_LATITUDES( 320 );
-DECLARE_GAUSSIAN_LATITUDES( 400 );
-DECLARE_GAUSSIAN_LATITUDES( 512 );
-DECLARE_GAUSSIAN_LATITUDES( 576 );
-DECLARE_GAUSSIAN_LATITUDES( 640 );
-DECLARE_GAUSSIAN_LATITUDES( 800 );
-DECLARE_GAUSSIAN_LATITUDES( 1024 );
-DECLARE_GAUSSIAN_LATITUDES( 1280 );
-DECLARE_GAUSSIAN_LATITUDES( 1600 );
-DECLARE_GAUSSIAN_LATITUDES( 2000 );
-DECLARE_GAUSSIAN_LATITUDES( 4000 );
-DECLARE_GAUSSIAN_LATITUDES( 8000 );
-
-#undef DECLARE_GAUSSIAN_LATITUDES
+/// @brief Tabulated Gaussian latitudes between North pole and equator
+/// @pre tabulated_gaussian_latitudes( N )
+/// @param lats [out] latitudes in degrees, of size N
+void tabulated_gaussian_latitudes( const size_t N, double lats[] );
 
 }  // namespace gaussian
 }  // namespace spacing
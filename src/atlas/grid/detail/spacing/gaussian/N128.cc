@@ -1,37 +0,0 @@
-// TL255
-
-#include "atlas/grid/detail/spacing/gaussian/N.h"
-
-namespace atlas {
-namespace grid {
-namespace spacing {
-namespace gaussian {
-
-DEFINE_GAUSSIAN_LATITUDES(
-    128, LIST( 89.462821568577, 88.766951352842, 88.066971647431, 87.366063433082, 86.664803013441, 85.963372160880,
-               85.261846060713, 84.560261383053, 83.858638128608, 83.156988128542, 82.455318827164, 81.753635141838,
-               81.051940450936, 80.350237152036, 79.648526993666, 78.946811280967, 78.245091007821, 77.543366944409,
-               76.841639696782, 76.139909748368, 75.438177489488, 74.736443238739, 74.034707258747, 73.332969767937,
-               72.631230949459, 71.929490958033, 71.227749925260, 70.526007963782, 69.824265170583, 69.122521629614,
-               68.420777413915, 67.719032587332, 67.017287205917, 66.315541319089, 65.613794970579, 64.912048199233,
-               64.210301039674, 63.508553522860, 62.806805676556, 62.105057525741, 61.403309092943, 60.701560398538,
-               59.999811460996, 59.298062297105, 58.596312922156, 57.894563350105, 57.192813593719, 56.491063664698,
-               55.789313573786, 55.087563330867, 54.385812945049, 53.684062424740, 52.982311777713, 52.280561011166,
-               51.578810131776, 50.877059145743, 50.175308058833, 49.473556876418, 48.771805603506, 48.070054244773,
-               47.368302804592, 46.666551287055, 45.964799695997, 45.263048035017, 44.561296307493, 43.859544516602,
-               43.157792665336, 42.456040756510, 41.754288792783, 41.052536776662, 40.350784710518, 39.649032596592,
-               38.947280437007, 38.245528233774, 37.543775988799, 36.842023703894, 36.140271380778, 35.438519021086,
-               34.736766626375, 34.035014198127, 33.333261737756, 32.631509246608, 31.929756725971, 31.228004177076,
-               30.526251601098, 29.824498999163, 29.122746372350, 28.420993721692, 27.719241048181, 27.017488352770,
-               26.315735636373, 25.613982899871, 24.912230144110, 24.210477369908, 23.508724578050, 22.806971769296,
-               22.105218944378, 21.403466104006, 20.701713248864, 19.999960379617, 19.298207496906, 18.596454601357,
-               17.894701693573, 17.192948774143, 16.491195843640, 15.789442902620, 15.087689951625, 14.385936991186,
-               13.684184021817, 12.982431044024, 12.280678058301, 11.578925065131, 10.877172064989, 10.175419058338,
-               9.473666045636, 8.771913027332, 8.070160003868, 7.368406975680, 6.666653943198, 5.964900906845,
-               5.263147867043, 4.561394824207, 3.859641778748, 3.157888731076, 2.456135681596, 1.754382630712,
-               1.052629578828, 0.350876526343 ) )
-
-}  // namespace gaussian
-}  // namespace spacing
-}  // namespace grid
-}  // namespace atlas
@@ -1,229 +0,0 @@
-// TL2559
-
-#include "atlas/grid/detail/spacing/gaussian/N.h"
-
-namespace atlas {
-namespace grid {
-namespace spacing {
-namespace gaussian {
-
-DEFINE_GAUSSIAN_LATITUDES(
-    1280, LIST( 89.946187715666, 89.876478353332, 89.806357319542, 89.736143271610, 89.665893941216, 89.595627537554,
-                89.525351592371, 89.455069779123, 89.384784101392, 89.314495744374, 89.244205453805, 89.173913722284,
-                89.103620888239, 89.033327191846, 88.963032808263, 88.892737868231, 88.822442471310, 88.752146694651,
-                88.681850598962, 88.611554232668, 88.541257634869, 88.470960837475, 88.400663866794, 88.330366744703,
-                88.260069489546, 88.189772116821, 88.119474639706, 88.049177069484, 87.978879415867, 87.908581687262,
-                87.838283890982, 87.767986033420, 87.697688120188, 87.627390156234, 87.557092145936, 87.486794093181,
-                87.416496001435, 87.346197873796, 87.275899713042, 87.205601521672, 87.135303301940, 87.065005055883,
-                86.994706785348, 86.924408492014, 86.854110177409, 86.783811842927, 86.713513489844, 86.643215119329,
-                86.572916732453, 86.502618330204, 86.432319913490, 86.362021483149, 86.291723039957, 86.221424584631,
-                86.151126117835, 86.080827640187, 86.010529152260, 85.940230654589, 85.869932147670, 85.799633631968,
-                85.729335107917, 85.659036575923, 85.588738036364, 85.518439489598, 85.448140935957, 85.377842375757,
-                85.307543809290, 85.237245236836, 85.166946658654, 85.096648074992, 85.026349486082, 84.956050892143,
-                84.885752293383, 84.815453689997, 84.745155082172, 84.674856470083, 84.604557853897, 84.534259233771,
-                84.463960609857, 84.393661982296, 84.323363351224, 84.253064716770, 84.182766079057, 84.112467438200,
-                84.042168794312, 83.971870147499, 83.901571497861, 83.831272845495, 83.760974190494, 83.690675532945,
-                83.620376872933, 83.550078210538, 83.479779545838, 83.409480878906, 83.339182209812, 83.268883538625,
-                83.198584865410, 83.128286190228, 83.057987513139, 82.987688834201, 82.917390153469, 82.847091470996,
-                82.776792786832, 82.706494101027, 82.636195413627, 82.565896724678, 82.495598034223, 82.425299342304,
-                82.355000648962, 82.284701954235, 82.214403258161, 82.144104560776, 82.073805862115, 82.003507162212,
-                81.933208461099, 81.862909758807, 81.792611055367, 81.722312350809, 81.652013645159, 81.581714938446,
-                81.511416230696, 81.441117521935, 81.370818812187, 81.300520101476, 81.230221389825, 81.159922677258,
-                81.089623963795, 81.019325249457, 80.949026534265, 80.878727818239, 80.808429101398, 80.738130383760,
-                80.667831665344, 80.597532946166, 80.527234226244, 80.456935505594, 80.386636784233, 80.316338062175,
-                80.246039339436, 80.175740616030, 80.105441891972, 80.035143167276, 79.964844441954, 79.894545716020,
-                79.824246989487, 79.753948262366, 79.683649534670, 79.613350806411, 79.543052077600, 79.472753348248,
-                79.402454618366, 79.332155887964, 79.261857157052, 79.191558425641, 79.121259693740, 79.050960961358,
-                78.980662228505, 78.910363495190, 78.840064761421, 78.769766027208, 78.699467292557, 78.629168557478,
-                78.558869821978, 78.488571086065, 78.418272349746, 78.347973613030, 78.277674875922, 78.207376138430,
-                78.137077400561, 78.066778662322, 77.996479923719, 77.926181184758, 77.855882445445, 77.785583705787,
-                77.715284965790, 77.644986225459, 77.574687484800, 77.504388743819, 77.434090002520, 77.363791260910,
-                77.293492518993, 77.223193776775, 77.152895034260, 77.082596291454, 77.012297548360, 76.941998804985,
-                76.871700061331, 76.801401317404, 76.731102573208, 76.660803828747, 76.590505084026, 76.520206339048,
-                76.449907593818, 76.379608848339, 76.309310102615, 76.239011356650, 76.168712610448, 76.098413864012,
-                76.028115117346, 75.957816370454, 75.887517623337, 75.817218876001, 75.746920128448, 75.676621380681,
-                75.606322632704, 75.536023884520, 75.465725136131, 75.395426387540, 75.325127638752, 75.254828889767,
-                75.184530140590, 75.114231391222, 75.043932641667, 74.973633891927, 74.903335142004, 74.833036391902,
-                74.762737641623, 74.692438891169, 74.622140140542, 74.551841389746, 74.481542638781, 74.411243887652,
-                74.340945136359, 74.270646384904, 74.200347633291, 74.130048881522, 74.059750129597, 73.989451377520,
-                73.919152625292, 73.848853872916, 73.778555120392, 73.708256367724, 73.637957614913, 73.567658861960,
-                73.497360108869, 73.427061355639, 73.356762602274, 73.286463848775, 73.216165095143, 73.145866341381,
-                73.075567587489, 73.005268833470, 72.934970079325, 72.864671325055, 72.794372570663, 72.724073816149,
-                72.653775061515, 72.583476306763, 72.513177551893, 72.442878796909, 72.372580041809, 72.302281286597,
-                72.231982531274, 72.161683775840, 72.091385020297, 72.021086264647, 71.950787508890, 71.880488753029,
-                71.810189997063, 71.739891240994, 71.669592484824, 71.599293728554, 71.528994972184, 71.458696215717,
-                71.388397459152, 71.318098702491, 71.247799945736, 71.177501188887, 71.107202431945, 71.036903674912,
-                70.966604917788, 70.896306160574, 70.826007403271, 70.755708645881, 70.685409888405, 70.615111130842,
-                70.544812373195, 70.474513615463, 70.404214857649, 70.333916099752, 70.263617341774, 70.193318583716,
-                70.123019825578, 70.052721067362, 69.982422309068, 69.912123550696, 69.841824792249, 69.771526033726,
-                69.701227275128, 69.630928516457, 69.560629757712, 69.490330998895, 69.420032240006, 69.349733481047,
-                69.279434722017, 69.209135962918, 69.138837203750, 69.068538444514, 68.998239685210, 68.927940925840,
-                68.857642166404, 68.787343406903, 68.717044647337, 68.646745887706, 68.576447128012, 68.506148368256,
-                68.435849608437, 68.365550848557, 68.295252088615, 68.224953328613, 68.154654568552, 68.084355808431,
-                68.014057048251, 67.943758288014, 67.873459527718, 67.803160767366, 67.732862006957, 67.662563246492,
-                67.592264485972, 67.521965725397, 67.451666964768, 67.381368204085, 67.311069443348, 67.240770682558,
-                67.170471921717, 67.100173160823, 67.029874399877, 66.959575638881, 66.889276877835, 66.818978116738,
-                66.748679355592, 66.678380594396, 66.608081833152, 66.537783071860, 66.467484310520, 66.397185549132,
-                66.326886787698, 66.256588026217, 66.186289264690, 66.115990503117, 66.045691741499, 65.975392979836,
-                65.905094218128, 65.834795456377, 65.764496694581, 65.694197932743, 65.623899170861, 65.553600408936,
-                65.483301646970, 65.413002884961, 65.342704122911, 65.272405360820, 65.202106598688, 65.131807836516,
-                65.061509074303, 64.991210312051, 64.920911549759, 64.850612787428, 64.780314025058, 64.710015262650,
-                64.639716500204, 64.569417737720, 64.499118975198, 64.428820212639, 64.358521450043, 64.288222687411,
-                64.217923924742, 64.147625162038, 64.077326399297, 64.007027636522, 63.936728873711, 63.866430110865,
-                63.796131347985, 63.725832585070, 63.655533822122, 63.585235059139, 63.514936296124, 63.444637533075,
-                63.374338769993, 63.304040006879, 63.233741243732, 63.163442480553, 63.093143717342, 63.022844954099,
-                62.952546190825, 62.882247427520, 62.811948664184, 62.741649900817, 62.671351137420, 62.601052373993,
-                62.530753610535, 62.460454847048, 62.390156083532, 62.319857319986, 62.249558556411, 62.179259792807,
-                62.108961029175, 62.038662265514, 61.968363501825, 61.898064738108, 61.827765974364, 61.757467210592,
-                61.687168446792, 61.616869682965, 61.546570919112, 61.476272155231, 61.405973391324, 61.335674627391,
-                61.265375863432, 61.195077099446, 61.124778335435, 61.054479571399, 60.984180807337, 60.913882043249,
-                60.843583279137, 60.773284515000, 60.702985750838, 60.632686986652, 60.562388222441, 60.492089458207,
-                60.421790693948, 60.351491929665, 60.281193165359, 60.210894401030, 60.140595636677, 60.070296872301,
-                59.999998107902, 59.929699343481, 59.859400579037, 59.789101814570, 59.718803050081, 59.648504285570,
-                59.578205521036, 59.507906756481, 59.437607991905, 59.367309227306, 59.297010462687, 59.226711698046,
-                59.156412933384, 59.086114168701, 59.015815403997, 58.945516639273, 58.875217874528, 58.804919109762,
-                58.734620344977, 58.664321580171, 58.594022815345, 58.523724050500, 58.453425285635, 58.383126520750,
-                58.312827755846, 58.242528990922, 58.172230225979, 58.101931461018, 58.031632696037, 57.961333931038,
-                57.891035166019, 57.820736400983, 57.750437635927, 57.680138870854, 57.609840105762, 57.539541340653,
-                57.469242575525, 57.398943810380, 57.328645045216, 57.258346280036, 57.188047514837, 57.117748749622,
-                57.047449984389, 56.977151219139, 56.906852453871, 56.836553688587, 56.766254923287, 56.695956157969,
-                56.625657392635, 56.555358627284, 56.485059861917, 56.414761096534, 56.344462331134, 56.274163565718,
-                56.203864800287, 56.133566034839, 56.063267269376, 55.992968503897, 55.922669738403, 55.852370972893,
-                55.782072207367, 55.711773441826, 55.641474676271, 55.571175910699, 55.500877145113, 55.430578379513,
-                55.360279613897, 55.289980848266, 55.219682082621, 55.149383316961, 55.079084551287, 55.008785785599,
-                54.938487019896, 54.868188254179, 54.797889488448, 54.727590722702, 54.657291956943, 54.586993191170,
-                54.516694425384, 54.446395659583, 54.376096893769, 54.305798127941, 54.235499362100, 54.165200596246,
-                54.094901830378, 54.024603064497, 53.954304298603, 53.884005532696, 53.813706766776, 53.743408000843,
-                53.673109234897, 53.602810468939, 53.532511702968, 53.462212936984, 53.391914170988, 53.321615404979,
-                53.251316638958, 53.181017872924, 53.110719106879, 53.040420340821, 52.970121574751, 52.899822808669,
-                52.829524042575, 52.759225276469, 52.688926510352, 52.618627744222, 52.548328978081, 52.478030211928,
-                52.407731445764, 52.337432679589, 52.267133913402, 52.196835147203, 52.126536380993, 52.056237614772,
-                51.985938848540, 51.915640082297, 51.845341316043, 51.775042549778, 51.704743783502, 51.634445017215,
-                51.564146250917, 51.493847484609, 51.423548718289, 51.353249951960, 51.282951185619, 51.212652419269,
-                51.142353652907, 51.072054886536, 51.001756120154, 50.931457353762, 50.861158587360, 50.790859820947,
-                50.720561054525, 50.650262288092, 50.579963521649, 50.509664755197, 50.439365988735, 50.369067222262,
-                50.298768455780, 50.228469689289, 50.158170922787, 50.087872156277, 50.017573389756, 49.947274623226,
-                49.876975856687, 49.806677090138, 49.736378323580, 49.666079557012, 49.595780790436, 49.525482023850,
-                49.455183257255, 49.384884490651, 49.314585724037, 49.244286957415, 49.173988190784, 49.103689424144,
-                49.033390657495, 48.963091890837, 48.892793124171, 48.822494357496, 48.752195590812, 48.681896824119,
-                48.611598057418, 48.541299290709, 48.471000523990, 48.400701757264, 48.330402990529, 48.260104223786,
-                48.189805457034, 48.119506690274, 48.049207923506, 47.978909156730, 47.908610389945, 47.838311623152,
-                47.768012856352, 47.697714089543, 47.627415322726, 47.557116555902, 47.486817789069, 47.416519022229,
-                47.346220255381, 47.275921488525, 47.205622721661, 47.135323954790, 47.065025187911, 46.994726421024,
-                46.924427654130, 46.854128887228, 46.783830120319, 46.713531353402, 46.643232586478, 46.572933819546,
-                46.502635052608, 46.432336285661, 46.362037518708, 46.291738751747, 46.221439984779, 46.151141217804,
-                46.080842450822, 46.010543683832, 45.940244916836, 45.869946149832, 45.799647382822, 45.729348615805,
-                45.659049848780, 45.588751081749, 45.518452314711, 45.448153547666, 45.377854780614, 45.307556013556,
-                45.237257246491, 45.166958479419, 45.096659712340, 45.026360945255, 44.956062178164, 44.885763411065,
-                44.815464643961, 44.745165876849, 44.674867109732, 44.604568342607, 44.534269575477, 44.463970808340,
-                44.393672041197, 44.323373274047, 44.253074506891, 44.182775739729, 44.112476972561, 44.042178205386,
-                43.971879438205, 43.901580671019, 43.831281903826, 43.760983136627, 43.690684369422, 43.620385602211,
-                43.550086834994, 43.479788067771, 43.409489300542, 43.339190533307, 43.268891766067, 43.198592998820,
-                43.128294231568, 43.057995464310, 42.987696697046, 42.917397929776, 42.847099162501, 42.776800395220,
-                42.706501627934, 42.636202860641, 42.565904093344, 42.495605326040, 42.425306558731, 42.355007791417,
-                42.284709024097, 42.214410256772, 42.144111489441, 42.073812722104, 42.003513954763, 41.933215187416,
-                41.862916420064, 41.792617652706, 41.722318885343, 41.652020117975, 41.581721350601, 41.511422583223,
-                41.441123815839, 41.370825048450, 41.300526281056, 41.230227513656, 41.159928746252, 41.089629978843,
-                41.019331211428, 40.949032444009, 40.878733676584, 40.808434909155, 40.738136141720, 40.667837374281,
-                40.597538606836, 40.527239839387, 40.456941071933, 40.386642304474, 40.316343537011, 40.246044769542,
-                40.175746002069, 40.105447234591, 40.035148467108, 39.964849699620, 39.894550932128, 39.824252164631,
-                39.753953397130, 39.683654629624, 39.613355862113, 39.543057094598, 39.472758327078, 39.402459559553,
-                39.332160792024, 39.261862024491, 39.191563256953, 39.121264489410, 39.050965721863, 38.980666954312,
-                38.910368186756, 38.840069419196, 38.769770651632, 38.699471884063, 38.629173116490, 38.558874348913,
-                38.488575581331, 38.418276813745, 38.347978046155, 38.277679278560, 38.207380510961, 38.137081743359,
-                38.066782975752, 37.996484208140, 37.926185440525, 37.855886672906, 37.785587905282, 37.715289137654,
-                37.644990370023, 37.574691602387, 37.504392834747, 37.434094067103, 37.363795299455, 37.293496531804,
-                37.223197764148, 37.152898996488, 37.082600228825, 37.012301461157, 36.942002693486, 36.871703925811,
-                36.801405158132, 36.731106390449, 36.660807622762, 36.590508855071, 36.520210087377, 36.449911319679,
-                36.379612551977, 36.309313784271, 36.239015016562, 36.168716248849, 36.098417481132, 36.028118713412,
-                35.957819945688, 35.887521177960, 35.817222410229, 35.746923642494, 35.676624874755, 35.606326107013,
-                35.536027339267, 35.465728571518, 35.395429803765, 35.325131036009, 35.254832268249, 35.184533500486,
-                35.114234732719, 35.043935964949, 34.973637197175, 34.903338429398, 34.833039661618, 34.762740893834,
-                34.692442126047, 34.622143358256, 34.551844590462, 34.481545822665, 34.411247054864, 34.340948287060,
-                34.270649519253, 34.200350751443, 34.130051983629, 34.059753215812, 33.989454447991, 33.919155680168,
-                33.848856912341, 33.778558144511, 33.708259376678, 33.637960608842, 33.567661841002, 33.497363073160,
-                33.427064305314, 33.356765537465, 33.286466769613, 33.216168001758, 33.145869233900, 33.075570466039,
-                33.005271698175, 32.934972930308, 32.864674162437, 32.794375394564, 32.724076626688, 32.653777858809,
-                32.583479090926, 32.513180323041, 32.442881555153, 32.372582787262, 32.302284019368, 32.231985251471,
-                32.161686483571, 32.091387715668, 32.021088947763, 31.950790179854, 31.880491411943, 31.810192644029,
-                31.739893876112, 31.669595108192, 31.599296340270, 31.528997572344, 31.458698804416, 31.388400036485,
-                31.318101268552, 31.247802500615, 31.177503732676, 31.107204964734, 31.036906196790, 30.966607428843,
-                30.896308660893, 30.826009892940, 30.755711124985, 30.685412357027, 30.615113589066, 30.544814821103,
-                30.474516053137, 30.404217285169, 30.333918517198, 30.263619749224, 30.193320981248, 30.123022213270,
-                30.052723445288, 29.982424677304, 29.912125909318, 29.841827141329, 29.771528373338, 29.701229605344,
-                29.630930837348, 29.560632069349, 29.490333301348, 29.420034533344, 29.349735765338, 29.279436997329,
-                29.209138229318, 29.138839461305, 29.068540693289, 28.998241925270, 28.927943157250, 28.857644389227,
-                28.787345621201, 28.717046853174, 28.646748085144, 28.576449317111, 28.506150549077, 28.435851781039,
-                28.365553013000, 28.295254244959, 28.224955476915, 28.154656708868, 28.084357940820, 28.014059172769,
-                27.943760404716, 27.873461636661, 27.803162868604, 27.732864100544, 27.662565332482, 27.592266564418,
-                27.521967796352, 27.451669028284, 27.381370260213, 27.311071492140, 27.240772724065, 27.170473955988,
-                27.100175187909, 27.029876419828, 26.959577651744, 26.889278883659, 26.818980115571, 26.748681347482,
-                26.678382579390, 26.608083811296, 26.537785043200, 26.467486275102, 26.397187507002, 26.326888738900,
-                26.256589970796, 26.186291202690, 26.115992434582, 26.045693666472, 25.975394898360, 25.905096130246,
-                25.834797362130, 25.764498594012, 25.694199825892, 25.623901057770, 25.553602289646, 25.483303521520,
-                25.413004753393, 25.342705985263, 25.272407217131, 25.202108448998, 25.131809680863, 25.061510912726,
-                24.991212144586, 24.920913376446, 24.850614608303, 24.780315840158, 24.710017072012, 24.639718303863,
-                24.569419535713, 24.499120767561, 24.428821999407, 24.358523231252, 24.288224463094, 24.217925694935,
-                24.147626926774, 24.077328158612, 24.007029390447, 23.936730622281, 23.866431854113, 23.796133085943,
-                23.725834317772, 23.655535549599, 23.585236781424, 23.514938013247, 23.444639245069, 23.374340476889,
-                23.304041708707, 23.233742940524, 23.163444172339, 23.093145404152, 23.022846635964, 22.952547867774,
-                22.882249099582, 22.811950331389, 22.741651563194, 22.671352794997, 22.601054026799, 22.530755258600,
-                22.460456490398, 22.390157722195, 22.319858953991, 22.249560185785, 22.179261417577, 22.108962649368,
-                22.038663881157, 21.968365112945, 21.898066344731, 21.827767576515, 21.757468808298, 21.687170040080,
-                21.616871271860, 21.546572503638, 21.476273735415, 21.405974967191, 21.335676198965, 21.265377430738,
-                21.195078662509, 21.124779894278, 21.054481126046, 20.984182357813, 20.913883589578, 20.843584821342,
-                20.773286053104, 20.702987284865, 20.632688516625, 20.562389748383, 20.492090980140, 20.421792211895,
-                20.351493443649, 20.281194675401, 20.210895907153, 20.140597138902, 20.070298370651, 19.999999602398,
-                19.929700834143, 19.859402065888, 19.789103297631, 19.718804529372, 19.648505761113, 19.578206992852,
-                19.507908224589, 19.437609456326, 19.367310688061, 19.297011919794, 19.226713151527, 19.156414383258,
-                19.086115614988, 19.015816846717, 18.945518078444, 18.875219310170, 18.804920541895, 18.734621773618,
-                18.664323005341, 18.594024237062, 18.523725468782, 18.453426700500, 18.383127932218, 18.312829163934,
-                18.242530395649, 18.172231627363, 18.101932859075, 18.031634090787, 17.961335322497, 17.891036554206,
-                17.820737785914, 17.750439017621, 17.680140249326, 17.609841481031, 17.539542712734, 17.469243944436,
-                17.398945176137, 17.328646407837, 17.258347639536, 17.188048871233, 17.117750102930, 17.047451334625,
-                16.977152566319, 16.906853798012, 16.836555029705, 16.766256261396, 16.695957493085, 16.625658724774,
-                16.555359956462, 16.485061188149, 16.414762419834, 16.344463651519, 16.274164883202, 16.203866114885,
-                16.133567346566, 16.063268578247, 15.992969809926, 15.922671041605, 15.852372273282, 15.782073504958,
-                15.711774736634, 15.641475968308, 15.571177199981, 15.500878431654, 15.430579663325, 15.360280894996,
-                15.289982126665, 15.219683358334, 15.149384590001, 15.079085821668, 15.008787053333, 14.938488284998,
-                14.868189516662, 14.797890748324, 14.727591979986, 14.657293211647, 14.586994443307, 14.516695674966,
-                14.446396906625, 14.376098138282, 14.305799369938, 14.235500601594, 14.165201833248, 14.094903064902,
-                14.024604296555, 13.954305528207, 13.884006759858, 13.813707991508, 13.743409223158, 13.673110454806,
-                13.602811686454, 13.532512918101, 13.462214149747, 13.391915381392, 13.321616613036, 13.251317844680,
-                13.181019076323, 13.110720307964, 13.040421539606, 12.970122771246, 12.899824002885, 12.829525234524,
-                12.759226466162, 12.688927697799, 12.618628929435, 12.548330161071, 12.478031392706, 12.407732624340,
-                12.337433855973, 12.267135087606, 12.196836319237, 12.126537550868, 12.056238782499, 11.985940014128,
-                11.915641245757, 11.845342477385, 11.775043709013, 11.704744940639, 11.634446172265, 11.564147403891,
-                11.493848635515, 11.423549867139, 11.353251098762, 11.282952330385, 11.212653562006, 11.142354793628,
-                11.072056025248, 11.001757256868, 10.931458488487, 10.861159720105, 10.790860951723, 10.720562183340,
-                10.650263414957, 10.579964646573, 10.509665878188, 10.439367109803, 10.369068341417, 10.298769573030,
-                10.228470804643, 10.158172036255, 10.087873267866, 10.017574499477, 9.947275731087, 9.876976962697,
-                9.806678194306, 9.736379425915, 9.666080657523, 9.595781889130, 9.525483120737, 9.455184352343,
-                9.384885583949, 9.314586815554, 9.244288047159, 9.173989278763, 9.103690510366, 9.033391741969,
-                8.963092973571, 8.892794205173, 8.822495436775, 8.752196668376, 8.681897899976, 8.611599131576,
-                8.541300363175, 8.471001594774, 8.400702826372, 8.330404057970, 8.260105289567, 8.189806521164,
-                8.119507752760, 8.049208984356, 7.978910215951, 7.908611447546, 7.838312679141, 7.768013910735,
-                7.697715142328, 7.627416373921, 7.557117605514, 7.486818837106, 7.416520068698, 7.346221300289,
-                7.275922531880, 7.205623763470, 7.135324995060, 7.065026226650, 6.994727458239, 6.924428689828,
-                6.854129921416, 6.783831153004, 6.713532384592, 6.643233616179, 6.572934847765, 6.502636079352,
-                6.432337310938, 6.362038542524, 6.291739774109, 6.221441005694, 6.151142237278, 6.080843468862,
-                6.010544700446, 5.940245932030, 5.869947163613, 5.799648395196, 5.729349626778, 5.659050858360,
-                5.588752089942, 5.518453321523, 5.448154553105, 5.377855784685, 5.307557016266, 5.237258247846,
-                5.166959479426, 5.096660711006, 5.026361942585, 4.956063174164, 4.885764405743, 4.815465637321,
-                4.745166868899, 4.674868100477, 4.604569332055, 4.534270563632, 4.463971795209, 4.393673026786,
-                4.323374258363, 4.253075489939, 4.182776721515, 4.112477953091, 4.042179184666, 3.971880416242,
-                3.901581647817, 3.831282879392, 3.760984110967, 3.690685342541, 3.620386574115, 3.550087805689,
-                3.479789037263, 3.409490268837, 3.339191500410, 3.268892731984, 3.198593963557, 3.128295195130,
-                3.057996426702, 2.987697658275, 2.917398889847, 2.847100121419, 2.776801352991, 2.706502584563,
-                2.636203816135, 2.565905047706, 2.495606279278, 2.425307510849, 2.355008742420, 2.284709973991,
-                2.214411205562, 2.144112437133, 2.073813668703, 2.003514900274, 1.933216131844, 1.862917363415,
-                1.792618594985, 1.722319826555, 1.652021058125, 1.581722289695, 1.511423521264, 1.441124752834,
-                1.370825984404, 1.300527215973, 1.230228447543, 1.159929679112, 1.089630910681, 1.019332142250,
-                0.949033373820, 0.878734605389, 0.808435836958, 0.738137068527, 0.667838300096, 0.597539531665,
-                0.527240763234, 0.456941994803, 0.386643226372, 0.316344457940, 0.246045689509, 0.175746921078,
-                0.105448152647, 0.035149384216 ) )
-
-}  // namespace gaussian
-}  // namespace spacing
-}  // namespace grid
-}  // namespace atlas
@@ -1,42 +0,0 @@
-// TL319
-
-#include "atlas/grid/detail/spacing/gaussian/N.h"
-
-namespace atlas {
-namespace grid {
-namespace spacing {
-namespace gaussian {
-
-DEFINE_GAUSSIAN_LATITUDES(
-    160, LIST( 89.570089550607, 89.013176131022, 88.452973836713, 87.892028445344, 87.330801179738, 86.769437514528,
-               86.207997621423, 85.646510847953, 85.084993200912, 84.523454148914, 83.961899649718, 83.400333638737,
-               82.838758819710, 82.277177111434, 81.715589913266, 81.153998269713, 80.592402976178, 80.030804649031,
-               79.469203773292, 78.907600735838, 78.345995849036, 77.784389367849, 77.222781502445, 76.661172427620,
-               76.099562289938, 75.537951213208, 74.976339302737, 74.414726648662, 73.853113328584, 73.291499409676,
-               72.729884950380, 72.168270001775, 71.606654608708, 71.045038810711, 70.483422642771, 69.921806135960,
-               69.360189317972, 68.798572213565, 68.236954844948, 67.675337232092, 67.113719393011, 66.552101343996,
-               65.990483099813, 65.428864673879, 64.867246078414, 64.305627324571, 63.744008422549, 63.182389381694,
-               62.620770210586, 62.059150917117, 61.497531508556, 60.935911991615, 60.374292372493, 59.812672656933,
-               59.251052850257, 58.689432957406, 58.127812982976, 57.566192931243, 57.004572806194, 56.442952611549,
-               55.881332350787, 55.319712027158, 54.758091643709, 54.196471203297, 53.634850708600, 53.073230162138,
-               52.511609566278, 51.949988923250, 51.388368235154, 50.826747503971, 50.265126731571, 49.703505919720,
-               49.141885070089, 48.580264184257, 48.018643263723, 47.457022309904, 46.895401324147, 46.333780307729,
-               45.772159261862, 45.210538187702, 44.648917086344, 44.087295958835, 43.525674806167, 42.964053629291,
-               42.402432429111, 41.840811206489, 41.279189962251, 40.717568697184, 40.155947412042, 39.594326107546,
-               39.032704784385, 38.471083443221, 37.909462084686, 37.347840709389, 36.786219317912, 36.224597910814,
-               35.662976488634, 35.101355051887, 34.539733601070, 33.978112136661, 33.416490659120, 32.854869168890,
-               32.293247666397, 31.731626152053, 31.170004626255, 30.608383089386, 30.046761541816, 29.485139983902,
-               28.923518415990, 28.361896838413, 27.800275251495, 27.238653655548, 26.677032050875, 26.115410437771,
-               25.553788816520, 24.992167187398, 24.430545550672, 23.868923906604, 23.307302255447, 22.745680597445,
-               22.184058932838, 21.622437261859, 21.060815584735, 20.499193901686, 19.937572212927, 19.375950518668,
-               18.814328819115, 18.252707114466, 17.691085404918, 17.129463690661, 16.567841971882, 16.006220248764,
-               15.444598521486, 14.882976790224, 14.321355055149, 13.759733316430, 13.198111574234, 12.636489828723,
-               12.074868080057, 11.513246328393, 10.951624573887, 10.390002816691, 9.828381056956, 9.266759294829,
-               8.705137530459, 8.143515763989, 7.581893995562, 7.020272225320, 6.458650453403, 5.897028679950,
-               5.335406905098, 4.773785128984, 4.212163351743, 3.650541573510, 3.088919794419, 2.527298014602,
-               1.965676234193, 1.404054453324, 0.842432672126, 0.280810890730 ) )
-
-}  // namespace gaussian
-}  // namespace spacing
-}  // namespace grid
-}  // namespace atlas
@@ -1,49 +0,0 @@
-// TL399
-
-#include "atlas/grid/detail/spacing/gaussian/N.h"
-
-namespace atlas {
-namespace grid {
-namespace spacing {
-namespace gaussian {
-
-DEFINE_GAUSSIAN_LATITUDES(
-    200, LIST( 89.655964246870, 89.210294391654, 88.761992615075, 88.313096175209, 87.863974165523, 87.414743002061,
-               86.965450837218, 86.516121156344, 86.066766768868, 85.617395252044, 85.168011373562, 84.718618282731,
-               84.269218143214, 83.819812490525, 83.370402444494, 82.920988840982, 82.471572316507, 82.022153364315,
-               81.572732372538, 81.123309650771, 80.673885448980, 80.224459971196, 79.775033385601, 79.325605832072,
-               78.876177427890, 78.426748272132, 77.977318449063, 77.527888030811, 77.078457079472, 76.629025648798,
-               76.179593785550, 75.730161530601, 75.280728919836, 74.831295984884, 74.381862753740, 73.932429251264,
-               73.482995499613, 73.033561518596, 72.584127325979, 72.134692937741, 71.685258368293, 71.235823630664,
-               70.786388736668, 70.336953697036, 69.887518521543, 69.438083219108, 68.988647797888, 68.539212265356,
-               68.089776628374, 67.640340893252, 67.190905065802, 66.741469151388, 66.292033154968, 65.842597081130,
-               65.393160934128, 64.943724717911, 64.494288436150, 64.044852092262, 63.595415689431, 63.145979230630,
-               62.696542718633, 62.247106156039, 61.797669545278, 61.348232888629, 60.898796188231, 60.449359446093,
-               59.999922664103, 59.550485844039, 59.101048987575, 58.651612096289, 58.202175171671, 57.752738215127,
-               57.303301227987, 56.853864211509, 56.404427166883, 55.954990095237, 55.505552997640, 55.056115875108,
-               54.606678728603, 54.157241559042, 53.707804367293, 53.258367154186, 52.808929920507, 52.359492667008,
-               51.910055394404, 51.460618103377, 51.011180794579, 50.561743468631, 50.112306126128, 49.662868767636,
-               49.213431393698, 48.763994004835, 48.314556601543, 47.865119184298, 47.415681753557, 46.966244309758,
-               46.516806853321, 46.067369384648, 45.617931904125, 45.168494412125, 44.719056909005, 44.269619395107,
-               43.820181870762, 43.370744336287, 42.921306791988, 42.471869238160, 42.022431675086, 41.572994103039,
-               41.123556522283, 40.674118933073, 40.224681335653, 39.775243730260, 39.325806117123, 38.876368496463,
-               38.426930868493, 37.977493233419, 37.528055591442, 37.078617942753, 36.629180287541, 36.179742625985,
-               35.730304958260, 35.280867284537, 34.831429604979, 34.381991919747, 33.932554228994, 33.483116532871,
-               33.033678831522, 32.584241125090, 32.134803413711, 31.685365697518, 31.235927976641, 30.786490251206,
-               30.337052521334, 29.887614787146, 29.438177048755, 28.988739306277, 28.539301559819, 28.089863809488,
-               27.640426055390, 27.190988297625, 26.741550536291, 26.292112771486, 25.842675003304, 25.393237231836,
-               24.943799457171, 24.494361679398, 24.044923898602, 23.595486114866, 23.146048328272, 22.696610538899,
-               22.247172746826, 21.797734952130, 21.348297154884, 20.898859355163, 20.449421553037, 19.999983748578,
-               19.550545941853, 19.101108132931, 18.651670321878, 18.202232508759, 17.752794693638, 17.303356876577,
-               16.853919057638, 16.404481236882, 15.955043414368, 15.505605590154, 15.056167764299, 14.606729936858,
-               14.157292107888, 13.707854277444, 13.258416445580, 12.808978612349, 12.359540777805, 11.910102941998,
-               11.460665104981, 11.011227266804, 10.561789427517, 10.112351587170, 9.662913745812, 9.213475903492,
-               8.764038060256, 8.314600216153, 7.865162371230, 7.415724525534, 6.966286679110, 6.516848832004,
-               6.067410984263, 5.617973135931, 5.168535287054, 4.719097437675, 4.269659587839, 3.820221737591,
-               3.370783886975, 2.921346036033, 2.471908184811, 2.022470333351, 1.573032481696, 1.123594629891,
-               0.674156777978, 0.224718926000 ) )
-
-}  // namespace gaussian
-}  // namespace spacing
-}  // namespace grid
-}  // namespace atlas
@@ -1,20 +0,0 @@
-// TL47
-
-#include "atlas/grid/detail/spacing/gaussian/N.h"
-
-namespace atlas {
-namespace grid {
-namespace spacing {
-namespace gaussian {
-
-DEFINE_GAUSSIAN_LATITUDES( 24, LIST( 87.1590945558628505, 83.4789366693171644, 79.7770456548256419, 76.0702444625451335,
-                                     72.3615810293448476, 68.6520167895174893, 64.9419494887575155, 61.2315731880771352,
-                                     57.5209937979699646, 53.8102740319414252, 50.0994534129868470, 46.3885581116054269,
-                                     42.6776061726049036, 38.9666104694540252, 35.2555804613681829, 31.5445232840216754,
-                                     27.8334444519932376, 24.1223483260879874, 20.4112384335677852, 16.7001176938426745,
-                                     12.9889885820881474, 9.2778532515078656, 5.5667136279135834, 1.8555714859932551 ) )
-
-}  // namespace gaussian
-}  // namespace spacing
-}  // namespace grid
-}  // namespace atlas
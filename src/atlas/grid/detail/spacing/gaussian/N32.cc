@@ -1,22 +0,0 @@
-// TL63
-
-#include "atlas/grid/detail/spacing/gaussian/N.h"
-
-namespace atlas {
-namespace grid {
-namespace spacing {
-namespace gaussian {
-
-DEFINE_GAUSSIAN_LATITUDES( 32,
-                           LIST( 87.863798839233, 85.096526988317, 82.312912947886, 79.525606572659, 76.736899680368,
-                                 73.947515153990, 71.157752011587, 68.367756108313, 65.577607010828, 62.787351798963,
-                                 59.997020108491, 57.206631527643, 54.416199526086, 51.625733674938, 48.835240966251,
-                                 46.044726631102, 43.254194665351, 40.463648178115, 37.673089629045, 34.882520993773,
-                                 32.091943881744, 29.301359621763, 26.510769325211, 23.720173933535, 20.929574254490,
-                                 18.138970990239, 15.348364759491, 12.557756115231, 9.767145559196, 6.976533553949,
-                                 4.185920533189, 1.395306910819 ) )
-
-}  // namespace gaussian
-}  // namespace spacing
-}  // namespace grid
-}  // namespace atlas
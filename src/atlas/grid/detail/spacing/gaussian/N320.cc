@@ -1,69 +0,0 @@
-// TL639
-
-#include "atlas/grid/detail/spacing/gaussian/N.h"
-
-namespace atlas {
-namespace grid {
-namespace spacing {
-namespace gaussian {
-
-DEFINE_GAUSSIAN_LATITUDES(
-    320, LIST( 89.784876907219, 89.506202738206, 89.225882847612, 88.945191118316, 88.664358341823, 88.383457312248,
-               88.102518138937, 87.821555507111, 87.540577426411, 87.259588634840, 86.978592113597, 86.697589831922,
-               86.416583142736, 86.135573006184, 85.854560122485, 85.573545014297, 85.292528079627, 85.011509626898,
-               84.730489898803, 84.449469088929, 84.168447353577, 83.887424820323, 83.606401594330, 83.325377763059,
-               83.044353399845, 82.763328566637, 82.482303316125, 82.201277693408, 81.920251737312, 81.639225481447,
-               81.358198955050, 81.077172183679, 80.796145189767, 80.515117993094, 80.234090611161, 79.953063059512,
-               79.672035351999, 79.391007501008, 79.109979517646, 78.828951411902, 78.547923192786, 78.266894868445,
-               77.985866446261, 77.704837932945, 77.423809334606, 77.142780656820, 76.861751904686, 76.580723082875,
-               76.299694195676, 76.018665247032, 75.737636240576, 75.456607179661, 75.175578067384, 74.894548906612,
-               74.613519700005, 74.332490450030, 74.051461158979, 73.770431828988, 73.489402462046, 73.208373060010,
-               72.927343624612, 72.646314157476, 72.365284660120, 72.084255133966, 71.803225580350, 71.522196000526,
-               71.241166395673, 70.960136766901, 70.679107115253, 70.398077441716, 70.117047747219, 69.836018032638,
-               69.554988298803, 69.273958546499, 68.992928776468, 68.711898989413, 68.430869186000, 68.149839366862,
-               67.868809532599, 67.587779683782, 67.306749820951, 67.025719944623, 66.744690055288, 66.463660153412,
-               66.182630239442, 65.901600313801, 65.620570376894, 65.339540429107, 65.058510470810, 64.777480502355,
-               64.496450524078, 64.215420536303, 63.934390539337, 63.653360533475, 63.372330519002, 63.091300496187,
-               62.810270465291, 62.529240426562, 62.248210380240, 61.967180326555, 61.686150265726, 61.405120197967,
-               61.124090123479, 60.843060042460, 60.562029955097, 60.280999861572, 59.999969762058, 59.718939656725,
-               59.437909545733, 59.156879429239, 58.875849307392, 58.594819180339, 58.313789048218, 58.032758911165,
-               57.751728769309, 57.470698622777, 57.189668471689, 56.908638316164, 56.627608156315, 56.346577992251,
-               56.065547824077, 55.784517651898, 55.503487475812, 55.222457295914, 54.941427112298, 54.660396925054,
-               54.379366734270, 54.098336540028, 53.817306342412, 53.536276141501, 53.255245937372, 52.974215730098,
-               52.693185519753, 52.412155306407, 52.131125090128, 51.850094870983, 51.569064649034, 51.288034424345,
-               51.007004196977, 50.725973966988, 50.444943734435, 50.163913499374, 49.882883261860, 49.601853021944,
-               49.320822779679, 49.039792535112, 48.758762288294, 48.477732039272, 48.196701788090, 47.915671534794,
-               47.634641279427, 47.353611022031, 47.072580762649, 46.791550501320, 46.510520238082, 46.229489972975,
-               45.948459706036, 45.667429437301, 45.386399166805, 45.105368894583, 44.824338620668, 44.543308345094,
-               44.262278067892, 43.981247789094, 43.700217508730, 43.419187226830, 43.138156943424, 42.857126658539,
-               42.576096372204, 42.295066084446, 42.014035795291, 41.733005504765, 41.451975212893, 41.170944919701,
-               40.889914625212, 40.608884329450, 40.327854032439, 40.046823734201, 39.765793434758, 39.484763134131,
-               39.203732832343, 38.922702529414, 38.641672225364, 38.360641920213, 38.079611613981, 37.798581306687,
-               37.517550998349, 37.236520688986, 36.955490378616, 36.674460067255, 36.393429754923, 36.112399441635,
-               35.831369127408, 35.550338812258, 35.269308496201, 34.988278179253, 34.707247861429, 34.426217542744,
-               34.145187223213, 33.864156902850, 33.583126581669, 33.302096259685, 33.021065936911, 32.740035613361,
-               32.459005289046, 32.177974963982, 31.896944638180, 31.615914311652, 31.334883984411, 31.053853656469,
-               30.772823327839, 30.491792998530, 30.210762668555, 29.929732337926, 29.648702006652, 29.367671674745,
-               29.086641342216, 28.805611009075, 28.524580675333, 28.243550340999, 27.962520006084, 27.681489670597,
-               27.400459334548, 27.119428997946, 26.838398660802, 26.557368323123, 26.276337984920, 25.995307646201,
-               25.714277306975, 25.433246967251, 25.152216627037, 24.871186286341, 24.590155945173, 24.309125603539,
-               24.028095261449, 23.747064918910, 23.466034575929, 23.185004232515, 22.903973888676, 22.622943544418,
-               22.341913199749, 22.060882854677, 21.779852509208, 21.498822163351, 21.217791817111, 20.936761470495,
-               20.655731123512, 20.374700776166, 20.093670428466, 19.812640080417, 19.531609732026, 19.250579383300,
-               18.969549034245, 18.688518684866, 18.407488335171, 18.126457985166, 17.845427634856, 17.564397284248,
-               17.283366933347, 17.002336582159, 16.721306230691, 16.440275878947, 16.159245526934, 15.878215174657,
-               15.597184822122, 15.316154469334, 15.035124116299, 14.754093763022, 14.473063409508, 14.192033055763,
-               13.911002701792, 13.629972347600, 13.348941993193, 13.067911638575, 12.786881283751, 12.505850928727,
-               12.224820573508, 11.943790218098, 11.662759862502, 11.381729506726, 11.100699150774, 10.819668794650,
-               10.538638438360, 10.257608081908, 9.976577725300, 9.695547368539, 9.414517011630, 9.133486654578,
-               8.852456297388, 8.571425940064, 8.290395582610, 8.009365225031, 7.728334867332, 7.447304509516,
-               7.166274151589, 6.885243793555, 6.604213435417, 6.323183077181, 6.042152718851, 5.761122360431,
-               5.480092001926, 5.199061643339, 4.918031284674, 4.637000925938, 4.355970567132, 4.074940208262,
-               3.793909849332, 3.512879490347, 3.231849131309, 2.950818772224, 2.669788413095, 2.388758053927,
-               2.107727694724, 1.826697335490, 1.545666976229, 1.264636616946, 0.983606257644, 0.702575898327,
-               0.421545539000, 0.140515179668 ) )
-
-}  // namespace gaussian
-}  // namespace spacing
-}  // namespace grid
-}  // namespace atlas
@@ -1,82 +0,0 @@
-// TL799
-
-#include "atlas/grid/detail/spacing/gaussian/N.h"
-
-namespace atlas {
-namespace grid {
-namespace spacing {
-namespace gaussian {
-
-DEFINE_GAUSSIAN_LATITUDES(
-    400, LIST( 89.827874645894, 89.604900490023, 89.380609551250, 89.156021095055, 88.931319783477, 88.706563860905,
-               88.481777418577, 88.256972206505, 88.032154633403, 87.807328490264, 87.582496162420, 87.357659225510,
-               87.132818762040, 86.907975540243, 86.683130120384, 86.458282920653, 86.233434259507, 86.008584383722,
-               85.783733487483, 85.558881725682, 85.334029223381, 85.109176082657, 84.884322387651, 84.659468208345,
-               84.434613603414, 84.209758622426, 83.984903307540, 83.760047694839, 83.535191815391, 83.310335696085,
-               83.085479360317, 82.860622828534, 82.635766118687, 82.410909246602, 82.186052226280, 81.961195070160,
-               81.736337789325, 81.511480393685, 81.286622892127, 81.061765292642, 80.836907602441, 80.612049828040,
-               80.387191975348, 80.162334049733, 79.937476056084, 79.712617998861, 79.487759882144, 79.262901709670,
-               79.038043484872, 78.813185210903, 78.588326890672, 78.363468526859, 78.138610121943, 77.913751678220,
-               77.688893197814, 77.464034682701, 77.239176134715, 77.014317555565, 76.789458946841, 76.564600310030,
-               76.339741646518, 76.114882957602, 75.890024244498, 75.665165508344, 75.440306750209, 75.215447971095,
-               74.990589171946, 74.765730353650, 74.540871517041, 74.316012662908, 74.091153791995, 73.866294905004,
-               73.641436002597, 73.416577085402, 73.191718154013, 72.966859208993, 72.742000250874, 72.517141280163,
-               72.292282297339, 72.067423302858, 71.842564297155, 71.617705280640, 71.392846253707, 71.167987216729,
-               70.943128170062, 70.718269114045, 70.493410049002, 70.268550975241, 70.043691893059, 69.818832802736,
-               69.593973704543, 69.369114598736, 69.144255485563, 68.919396365260, 68.694537238053, 68.469678104158,
-               68.244818963783, 68.019959817128, 67.795100664383, 67.570241505733, 67.345382341353, 67.120523171413,
-               66.895663996075, 66.670804815496, 66.445945629826, 66.221086439211, 65.996227243789, 65.771368043695,
-               65.546508839058, 65.321649630002, 65.096790416648, 64.871931199112, 64.647071977504, 64.422212751934,
-               64.197353522504, 63.972494289316, 63.747635052466, 63.522775812048, 63.297916568152, 63.073057320866,
-               62.848198070275, 62.623338816461, 62.398479559501, 62.173620299475, 61.948761036454, 61.723901770512,
-               61.499042501718, 61.274183230138, 61.049323955840, 60.824464678885, 60.599605399335, 60.374746117249,
-               60.149886832686, 59.925027545701, 59.700168256349, 59.475308964682, 59.250449670751, 59.025590374607,
-               58.800731076297, 58.575871775869, 58.351012473367, 58.126153168837, 57.901293862321, 57.676434553861,
-               57.451575243498, 57.226715931271, 57.001856617219, 56.776997301380, 56.552137983789, 56.327278664483,
-               56.102419343496, 55.877560020861, 55.652700696612, 55.427841370780, 55.202982043397, 54.978122714492,
-               54.753263384095, 54.528404052236, 54.303544718941, 54.078685384240, 53.853826048157, 53.628966710720,
-               53.404107371953, 53.179248031881, 52.954388690530, 52.729529347921, 52.504670004079, 52.279810659026,
-               52.054951312783, 51.830091965373, 51.605232616816, 51.380373267132, 51.155513916343, 50.930654564466,
-               50.705795211522, 50.480935857528, 50.256076502504, 50.031217146467, 49.806357789435, 49.581498431424,
-               49.356639072452, 49.131779712534, 48.906920351687, 48.682060989925, 48.457201627266, 48.232342263723,
-               48.007482899311, 47.782623534045, 47.557764167938, 47.332904801005, 47.108045433258, 46.883186064711,
-               46.658326695378, 46.433467325269, 46.208607954399, 45.983748582779, 45.758889210421, 45.534029837336,
-               45.309170463537, 45.084311089034, 44.859451713839, 44.634592337961, 44.409732961412, 44.184873584203,
-               43.960014206342, 43.735154827841, 43.510295448709, 43.285436068955, 43.060576688590, 42.835717307622,
-               42.610857926060, 42.385998543914, 42.161139161191, 41.936279777901, 41.711420394052, 41.486561009653,
-               41.261701624711, 41.036842239234, 40.811982853231, 40.587123466709, 40.362264079675, 40.137404692137,
-               39.912545304103, 39.687685915579, 39.462826526572, 39.237967137090, 39.013107747139, 38.788248356727,
-               38.563388965859, 38.338529574541, 38.113670182782, 37.888810790586, 37.663951397960, 37.439092004910,
-               37.214232611441, 36.989373217561, 36.764513823274, 36.539654428586, 36.314795033503, 36.089935638030,
-               35.865076242173, 35.640216845937, 35.415357449327, 35.190498052348, 34.965638655006, 34.740779257306,
-               34.515919859252, 34.291060460849, 34.066201062102, 33.841341663016, 33.616482263595, 33.391622863845,
-               33.166763463768, 32.941904063371, 32.717044662657, 32.492185261630, 32.267325860296, 32.042466458657,
-               31.817607056718, 31.592747654483, 31.367888251957, 31.143028849143, 30.918169446044, 30.693310042666,
-               30.468450639011, 30.243591235084, 30.018731830887, 29.793872426425, 29.569013021702, 29.344153616720,
-               29.119294211484, 28.894434805996, 28.669575400260, 28.444715994280, 28.219856588059, 27.994997181599,
-               27.770137774905, 27.545278367979, 27.320418960825, 27.095559553446, 26.870700145844, 26.645840738023,
-               26.420981329986, 26.196121921735, 25.971262513275, 25.746403104606, 25.521543695733, 25.296684286658,
-               25.071824877385, 24.846965467914, 24.622106058250, 24.397246648396, 24.172387238353, 23.947527828124,
-               23.722668417712, 23.497809007120, 23.272949596350, 23.048090185404, 22.823230774285, 22.598371362996,
-               22.373511951538, 22.148652539915, 21.923793128129, 21.698933716181, 21.474074304075, 21.249214891812,
-               21.024355479395, 20.799496066827, 20.574636654109, 20.349777241243, 20.124917828232, 19.900058415078,
-               19.675199001783, 19.450339588349, 19.225480174778, 19.000620761073, 18.775761347235, 18.550901933267,
-               18.326042519170, 18.101183104946, 17.876323690598, 17.651464276127, 17.426604861536, 17.201745446826,
-               16.976886031999, 16.752026617057, 16.527167202002, 16.302307786836, 16.077448371561, 15.852588956178,
-               15.627729540690, 15.402870125097, 15.178010709403, 14.953151293609, 14.728291877716, 14.503432461726,
-               14.278573045641, 14.053713629463, 13.828854213193, 13.603994796833, 13.379135380386, 13.154275963851,
-               12.929416547232, 12.704557130530, 12.479697713746, 12.254838296882, 12.029978879940, 11.805119462921,
-               11.580260045827, 11.355400628659, 11.130541211420, 10.905681794110, 10.680822376731, 10.455962959286,
-               10.231103541774, 10.006244124198, 9.781384706560, 9.556525288861, 9.331665871102, 9.106806453284,
-               8.881947035411, 8.657087617482, 8.432228199499, 8.207368781465, 7.982509363379, 7.757649945245,
-               7.532790527062, 7.307931108834, 7.083071690560, 6.858212272243, 6.633352853884, 6.408493435484,
-               6.183634017046, 5.958774598569, 5.733915180056, 5.509055761509, 5.284196342927, 5.059336924314,
-               4.834477505670, 4.609618086996, 4.384758668295, 4.159899249567, 3.935039830814, 3.710180412037,
-               3.485320993238, 3.260461574418, 3.035602155578, 2.810742736719, 2.585883317844, 2.361023898953,
-               2.136164480048, 1.911305061130, 1.686445642201, 1.461586223261, 1.236726804313, 1.011867385357,
-               0.787007966395, 0.562148547428, 0.337289128458, 0.112429709486 ) )
-
-}  // namespace gaussian
-}  // namespace spacing
-}  // namespace grid
-}  // namespace atlas
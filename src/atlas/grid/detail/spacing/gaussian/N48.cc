@@ -1,23 +0,0 @@
-// TL95
-
-#include "atlas/grid/detail/spacing/gaussian/N.h"
-
-namespace atlas {
-namespace grid {
-namespace spacing {
-namespace gaussian {
-
-DEFINE_GAUSSIAN_LATITUDES(
-    48, LIST( 88.572168514007, 86.722530954668, 84.861970292042, 82.998941642838, 81.134976837677, 79.270559034860,
-              77.405888082079, 75.541061452879, 73.676132313209, 71.811132114274, 69.946080646983, 68.080990985651,
-              66.215872113999, 64.350730408872, 62.485570522036, 60.620395926826, 58.755209269380, 56.890012601357,
-              55.024807538312, 53.159595370020, 51.294377138951, 49.429153697123, 47.563925747979, 45.698693877702,
-              43.833458578951, 41.968220269075, 40.102979304249, 38.237735990565, 36.372490592812, 34.507243341501,
-              32.641994438518, 30.776744061723, 28.911492368718, 27.046239499945, 25.180985581271, 23.315730726141,
-              21.450475037398, 19.585218608822, 17.719961526447, 15.854703869695, 13.989445712357, 12.124187123456,
-              10.258928168006, 8.393668907692, 6.528409401480, 4.663149706178, 2.797889876957, 0.932629967838 ) )
-
-}  // namespace gaussian
-}  // namespace spacing
-}  // namespace grid
-}  // namespace atlas
@@ -1,101 +0,0 @@
-// TL1023
-
-#include "atlas/grid/detail/spacing/gaussian/N.h"
-
-namespace atlas {
-namespace grid {
-namespace spacing {
-namespace gaussian {
-
-DEFINE_GAUSSIAN_LATITUDES(
-    512, LIST( 89.865508687700, 89.691286319427, 89.516035073908, 89.340551361134, 89.164979468040, 88.989364904277,
-               88.813726493695, 88.638073417245, 88.462410682421, 88.286741251340, 88.111066987798, 87.935389122929,
-               87.759708502558, 87.584025726950, 87.408341233871, 87.232655350076, 87.056968324394, 86.881280349644,
-               86.705591577554, 86.529902129152, 86.354212102154, 86.178521576318, 86.002830617390, 85.827139280050,
-               85.651447610144, 85.475755646402, 85.300063421765, 85.124370964427, 84.948678298664, 84.772985445485,
-               84.597292423170, 84.421599247696, 84.245905933089, 84.070212491715, 83.894518934514, 83.718825271204,
-               83.543131510446, 83.367437659983, 83.191743726757, 83.016049717015, 82.840355636389, 82.664661489971,
-               82.488967282378, 82.313273017804, 82.137578700070, 81.961884332659, 81.786189918760, 81.610495461294,
-               81.434800962941, 81.259106426166, 81.083411853242, 80.907717246262, 80.732022607164, 80.556327937741,
-               80.380633239654, 80.204938514445, 80.029243763549, 79.853548988299, 79.677854189940, 79.502159369631,
-               79.326464528457, 79.150769667431, 78.975074787502, 78.799379889560, 78.623684974440, 78.447990042926,
-               78.272295095754, 78.096600133617, 77.920905157170, 77.745210167027, 77.569515163769, 77.393820147944,
-               77.218125120072, 77.042430080642, 76.866735030118, 76.691039968939, 76.515344897522, 76.339649816263,
-               76.163954725535, 75.988259625697, 75.812564517085, 75.636869400022, 75.461174274815, 75.285479141756,
-               75.109784001121, 74.934088853178, 74.758393698178, 74.582698536362, 74.407003367962, 74.231308193198,
-               74.055613012279, 73.879917825408, 73.704222632776, 73.528527434569, 73.352832230963, 73.177137022127,
-               73.001441808224, 72.825746589409, 72.650051365831, 72.474356137634, 72.298660904956, 72.122965667928,
-               71.947270426678, 71.771575181328, 71.595879931995, 71.420184678794, 71.244489421831, 71.068794161213,
-               70.893098897040, 70.717403629410, 70.541708358415, 70.366013084148, 70.190317806694, 70.014622526138,
-               69.838927242562, 69.663231956043, 69.487536666658, 69.311841374478, 69.136146079577, 68.960450782020,
-               68.784755481875, 68.609060179206, 68.433364874073, 68.257669566538, 68.081974256658, 67.906278944489,
-               67.730583630085, 67.554888313498, 67.379192994781, 67.203497673982, 67.027802351149, 66.852107026329,
-               66.676411699566, 66.500716370904, 66.325021040386, 66.149325708053, 65.973630373944, 65.797935038099,
-               65.622239700555, 65.446544361348, 65.270849020515, 65.095153678090, 64.919458334106, 64.743762988596,
-               64.568067641592, 64.392372293124, 64.216676943223, 64.040981591918, 63.865286239237, 63.689590885209,
-               63.513895529859, 63.338200173214, 63.162504815300, 62.986809456141, 62.811114095763, 62.635418734187,
-               62.459723371438, 62.284028007538, 62.108332642509, 61.932637276372, 61.756941909148, 61.581246540857,
-               61.405551171518, 61.229855801152, 61.054160429778, 60.878465057412, 60.702769684074, 60.527074309781,
-               60.351378934550, 60.175683558397, 59.999988181339, 59.824292803393, 59.648597424573, 59.472902044894,
-               59.297206664372, 59.121511283021, 58.945815900855, 58.770120517889, 58.594425134135, 58.418729749607,
-               58.243034364318, 58.067338978280, 57.891643591507, 57.715948204009, 57.540252815800, 57.364557426890,
-               57.188862037291, 57.013166647015, 56.837471256071, 56.661775864471, 56.486080472225, 56.310385079344,
-               56.134689685836, 55.958994291713, 55.783298896984, 55.607603501658, 55.431908105745, 55.256212709253,
-               55.080517312191, 54.904821914568, 54.729126516393, 54.553431117674, 54.377735718419, 54.202040318635,
-               54.026344918332, 53.850649517516, 53.674954116196, 53.499258714378, 53.323563312070, 53.147867909279,
-               52.972172506012, 52.796477102275, 52.620781698077, 52.445086293423, 52.269390888319, 52.093695482773,
-               51.918000076789, 51.742304670376, 51.566609263538, 51.390913856281, 51.215218448612, 51.039523040536,
-               50.863827632058, 50.688132223185, 50.512436813921, 50.336741404272, 50.161045994243, 49.985350583839,
-               49.809655173065, 49.633959761927, 49.458264350429, 49.282568938576, 49.106873526372, 48.931178113822,
-               48.755482700932, 48.579787287704, 48.404091874145, 48.228396460257, 48.052701046046, 47.877005631515,
-               47.701310216668, 47.525614801510, 47.349919386045, 47.174223970276, 46.998528554208, 46.822833137844,
-               46.647137721187, 46.471442304243, 46.295746887013, 46.120051469502, 45.944356051714, 45.768660633651,
-               45.592965215317, 45.417269796716, 45.241574377850, 45.065878958724, 44.890183539339, 44.714488119700,
-               44.538792699810, 44.363097279670, 44.187401859285, 44.011706438658, 43.836011017791, 43.660315596687,
-               43.484620175349, 43.308924753780, 43.133229331982, 42.957533909959, 42.781838487713, 42.606143065246,
-               42.430447642561, 42.254752219661, 42.079056796548, 41.903361373225, 41.727665949694, 41.551970525957,
-               41.376275102018, 41.200579677877, 41.024884253538, 40.849188829003, 40.673493404274, 40.497797979354,
-               40.322102554244, 40.146407128946, 39.970711703463, 39.795016277797, 39.619320851950, 39.443625425924,
-               39.267929999721, 39.092234573343, 38.916539146792, 38.740843720069, 38.565148293178, 38.389452866119,
-               38.213757438895, 38.038062011506, 37.862366583957, 37.686671156247, 37.510975728378, 37.335280300353,
-               37.159584872174, 36.983889443841, 36.808194015357, 36.632498586723, 36.456803157940, 36.281107729011,
-               36.105412299938, 35.929716870721, 35.754021441362, 35.578326011862, 35.402630582224, 35.226935152449,
-               35.051239722538, 34.875544292492, 34.699848862314, 34.524153432004, 34.348458001564, 34.172762570996,
-               33.997067140300, 33.821371709478, 33.645676278532, 33.469980847462, 33.294285416271, 33.118589984959,
-               32.942894553528, 32.767199121978, 32.591503690312, 32.415808258530, 32.240112826634, 32.064417394624,
-               31.888721962503, 31.713026530271, 31.537331097929, 31.361635665479, 31.185940232922, 31.010244800259,
-               30.834549367490, 30.658853934618, 30.483158501643, 30.307463068566, 30.131767635389, 29.956072202111,
-               29.780376768736, 29.604681335263, 29.428985901693, 29.253290468028, 29.077595034269, 28.901899600416,
-               28.726204166471, 28.550508732434, 28.374813298307, 28.199117864090, 28.023422429785, 27.847726995392,
-               27.672031560912, 27.496336126347, 27.320640691697, 27.144945256962, 26.969249822145, 26.793554387245,
-               26.617858952264, 26.442163517203, 26.266468082062, 26.090772646842, 25.915077211544, 25.739381776169,
-               25.563686340718, 25.387990905192, 25.212295469591, 25.036600033916, 24.860904598168, 24.685209162348,
-               24.509513726456, 24.333818290494, 24.158122854462, 23.982427418361, 23.806731982191, 23.631036545954,
-               23.455341109649, 23.279645673279, 23.103950236843, 22.928254800343, 22.752559363778, 22.576863927150,
-               22.401168490460, 22.225473053708, 22.049777616894, 21.874082180020, 21.698386743087, 21.522691306094,
-               21.346995869042, 21.171300431933, 20.995604994767, 20.819909557544, 20.644214120265, 20.468518682931,
-               20.292823245543, 20.117127808100, 19.941432370604, 19.765736933056, 19.590041495455, 19.414346057803,
-               19.238650620101, 19.062955182348, 18.887259744545, 18.711564306693, 18.535868868793, 18.360173430845,
-               18.184477992850, 18.008782554808, 17.833087116719, 17.657391678586, 17.481696240407, 17.306000802184,
-               17.130305363917, 16.954609925607, 16.778914487254, 16.603219048858, 16.427523610421, 16.251828171943,
-               16.076132733425, 15.900437294866, 15.724741856268, 15.549046417630, 15.373350978955, 15.197655540241,
-               15.021960101490, 14.846264662702, 14.670569223878, 14.494873785017, 14.319178346122, 14.143482907191,
-               13.967787468226, 13.792092029227, 13.616396590195, 13.440701151130, 13.265005712032, 13.089310272903,
-               12.913614833742, 12.737919394550, 12.562223955327, 12.386528516075, 12.210833076793, 12.035137637482,
-               11.859442198142, 11.683746758774, 11.508051319379, 11.332355879956, 11.156660440507, 10.980965001031,
-               10.805269561530, 10.629574122003, 10.453878682451, 10.278183242874, 10.102487803274, 9.926792363650,
-               9.751096924003, 9.575401484333, 9.399706044641, 9.224010604927, 9.048315165192, 8.872619725435,
-               8.696924285659, 8.521228845862, 8.345533406045, 8.169837966209, 7.994142526355, 7.818447086482,
-               7.642751646591, 7.467056206682, 7.291360766757, 7.115665326815, 6.939969886856, 6.764274446882,
-               6.588579006892, 6.412883566887, 6.237188126868, 6.061492686834, 5.885797246787, 5.710101806726,
-               5.534406366652, 5.358710926566, 5.183015486468, 5.007320046358, 4.831624606236, 4.655929166104,
-               4.480233725961, 4.304538285808, 4.128842845645, 3.953147405473, 3.777451965292, 3.601756525102,
-               3.426061084905, 3.250365644700, 3.074670204487, 2.898974764267, 2.723279324041, 2.547583883809,
-               2.371888443571, 2.196193003328, 2.020497563080, 1.844802122827, 1.669106682571, 1.493411242310,
-               1.317715802046, 1.142020361779, 0.966324921510, 0.790629481238, 0.614934040965, 0.439238600690,
-               0.263543160415, 0.087847720138 ) )
-
-}  // namespace gaussian
-}  // namespace spacing
-}  // namespace grid
-}  // namespace atlas
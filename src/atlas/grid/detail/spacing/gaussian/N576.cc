@@ -1,111 +0,0 @@
-// TL1151
-
-#include "atlas/grid/detail/spacing/gaussian/N.h"
-
-namespace atlas {
-namespace grid {
-namespace spacing {
-namespace gaussian {
-
-DEFINE_GAUSSIAN_LATITUDES(
-    576, LIST( 89.880445682778, 89.725572955853, 89.569785621770, 89.413791638920, 89.257719269313, 89.101608968163,
-               88.945477468692, 88.789332932188, 88.633179809996, 88.477020735252, 88.320857364755, 88.164690792905,
-               88.008521771586, 87.852350834397, 87.696178370484, 87.540004670312, 87.383829955074, 87.227654396174,
-               87.071478128490, 86.915301259606, 86.759123876386, 86.602946049731, 86.446767838084, 86.290589290052,
-               86.134410446389, 85.978231341525, 85.822052004742, 85.665872461102, 85.509692732184, 85.353512836665,
-               85.197332790795, 85.041152608776, 84.884972303076, 84.728791884688, 84.572611363337, 84.416430747661,
-               84.260250045360, 84.104069263315, 83.947888407701, 83.791707484067, 83.635526497422, 83.479345452291,
-               83.323164352780, 83.166983202616, 83.010802005194, 82.854620763613, 82.698439480708, 82.542258159072,
-               82.386076801091, 82.229895408955, 82.073713984683, 81.917532530138, 81.761351047042, 81.605169536987,
-               81.448988001452, 81.292806441807, 81.136624859327, 80.980443255198, 80.824261630525, 80.668079986340,
-               80.511898323606, 80.355716643225, 80.199534946040, 80.043353232842, 79.887171504373, 79.730989761330,
-               79.574808004367, 79.418626234102, 79.262444451114, 79.106262655951, 78.950080849129, 78.793899031136,
-               78.637717202433, 78.481535363454, 78.325353514613, 78.169171656300, 78.012989788886, 77.856807912721,
-               77.700626028139, 77.544444135457, 77.388262234976, 77.232080326982, 77.075898411747, 76.919716489531,
-               76.763534560580, 76.607352625132, 76.451170683410, 76.294988735628, 76.138806781993, 75.982624822699,
-               75.826442857934, 75.670260887876, 75.514078912697, 75.357896932561, 75.201714947624, 75.045532958038,
-               74.889350963947, 74.733168965488, 74.576986962794, 74.420804955994, 74.264622945209, 74.108440930556,
-               73.952258912150, 73.796076890098, 73.639894864504, 73.483712835471, 73.327530803093, 73.171348767464,
-               73.015166728675, 72.858984686811, 72.702802641956, 72.546620594190, 72.390438543591, 72.234256490233,
-               72.078074434189, 71.921892375528, 71.765710314318, 71.609528250623, 71.453346184507, 71.297164116031,
-               71.140982045252, 70.984799972227, 70.828617897013, 70.672435819661, 70.516253740223, 70.360071658750,
-               70.203889575289, 70.047707489886, 69.891525402589, 69.735343313439, 69.579161222480, 69.422979129753,
-               69.266797035298, 69.110614939154, 68.954432841359, 68.798250741949, 68.642068640959, 68.485886538424,
-               68.329704434378, 68.173522328853, 68.017340221880, 67.861158113491, 67.704976003715, 67.548793892581,
-               67.392611780117, 67.236429666351, 67.080247551309, 66.924065435018, 66.767883317503, 66.611701198788,
-               66.455519078897, 66.299336957853, 66.143154835680, 65.986972712399, 65.830790588032, 65.674608462599,
-               65.518426336122, 65.362244208621, 65.206062080113, 65.049879950620, 64.893697820158, 64.737515688747,
-               64.581333556403, 64.425151423144, 64.268969288986, 64.112787153947, 63.956605018041, 63.800422881284,
-               63.644240743692, 63.488058605279, 63.331876466060, 63.175694326050, 63.019512185260, 62.863330043707,
-               62.707147901401, 62.550965758357, 62.394783614587, 62.238601470103, 62.082419324918, 61.926237179043,
-               61.770055032489, 61.613872885268, 61.457690737392, 61.301508588870, 61.145326439713, 60.989144289931,
-               60.832962139536, 60.676779988535, 60.520597836940, 60.364415684760, 60.208233532004, 60.052051378680,
-               59.895869224799, 59.739687070368, 59.583504915396, 59.427322759892, 59.271140603863, 59.114958447319,
-               58.958776290265, 58.802594132711, 58.646411974664, 58.490229816131, 58.334047657120, 58.177865497637,
-               58.021683337689, 57.865501177284, 57.709319016429, 57.553136855128, 57.396954693390, 57.240772531221,
-               57.084590368626, 56.928408205612, 56.772226042184, 56.616043878350, 56.459861714113, 56.303679549481,
-               56.147497384458, 55.991315219050, 55.835133053263, 55.678950887101, 55.522768720570, 55.366586553675,
-               55.210404386421, 55.054222218812, 54.898040050854, 54.741857882551, 54.585675713908, 54.429493544930,
-               54.273311375620, 54.117129205983, 53.960947036024, 53.804764865747, 53.648582695156, 53.492400524255,
-               53.336218353048, 53.180036181539, 53.023854009733, 52.867671837632, 52.711489665240, 52.555307492562,
-               52.399125319601, 52.242943146360, 52.086760972843, 51.930578799054, 51.774396624996, 51.618214450672,
-               51.462032276086, 51.305850101240, 51.149667926139, 50.993485750784, 50.837303575180, 50.681121399330,
-               50.524939223235, 50.368757046900, 50.212574870327, 50.056392693519, 49.900210516479, 49.744028339210,
-               49.587846161714, 49.431663983994, 49.275481806052, 49.119299627893, 48.963117449517, 48.806935270927,
-               48.650753092126, 48.494570913117, 48.338388733901, 48.182206554482, 48.026024374861, 47.869842195041,
-               47.713660015024, 47.557477834813, 47.401295654409, 47.245113473815, 47.088931293033, 46.932749112065,
-               46.776566930913, 46.620384749579, 46.464202568066, 46.308020386375, 46.151838204508, 45.995656022467,
-               45.839473840254, 45.683291657872, 45.527109475321, 45.370927292603, 45.214745109722, 45.058562926678,
-               44.902380743472, 44.746198560108, 44.590016376586, 44.433834192908, 44.277652009077, 44.121469825092,
-               43.965287640958, 43.809105456673, 43.652923272242, 43.496741087664, 43.340558902942, 43.184376718076,
-               43.028194533070, 42.872012347923, 42.715830162638, 42.559647977216, 42.403465791658, 42.247283605966,
-               42.091101420141, 41.934919234185, 41.778737048098, 41.622554861883, 41.466372675541, 41.310190489072,
-               41.154008302479, 40.997826115762, 40.841643928923, 40.685461741962, 40.529279554882, 40.373097367684,
-               40.216915180368, 40.060732992935, 39.904550805388, 39.748368617727, 39.592186429953, 39.436004242067,
-               39.279822054071, 39.123639865966, 38.967457677752, 38.811275489432, 38.655093301005, 38.498911112472,
-               38.342728923836, 38.186546735097, 38.030364546256, 37.874182357314, 37.718000168271, 37.561817979130,
-               37.405635789891, 37.249453600554, 37.093271411121, 36.937089221594, 36.780907031971, 36.624724842256,
-               36.468542652448, 36.312360462548, 36.156178272558, 35.999996082478, 35.843813892309, 35.687631702051,
-               35.531449511707, 35.375267321276, 35.219085130760, 35.062902940159, 34.906720749474, 34.750538558705,
-               34.594356367855, 34.438174176923, 34.281991985910, 34.125809794817, 33.969627603645, 33.813445412394,
-               33.657263221065, 33.501081029660, 33.344898838178, 33.188716646621, 33.032534454989, 32.876352263283,
-               32.720170071503, 32.563987879651, 32.407805687726, 32.251623495730, 32.095441303664, 31.939259111527,
-               31.783076919322, 31.626894727047, 31.470712534704, 31.314530342294, 31.158348149817, 31.002165957274,
-               30.845983764666, 30.689801571992, 30.533619379254, 30.377437186453, 30.221254993588, 30.065072800661,
-               29.908890607672, 29.752708414622, 29.596526221510, 29.440344028339, 29.284161835108, 29.127979641818,
-               28.971797448469, 28.815615255063, 28.659433061599, 28.503250868078, 28.347068674501, 28.190886480867,
-               28.034704287179, 27.878522093436, 27.722339899639, 27.566157705788, 27.409975511883, 27.253793317926,
-               27.097611123917, 26.941428929856, 26.785246735744, 26.629064541581, 26.472882347367, 26.316700153104,
-               26.160517958792, 26.004335764431, 25.848153570021, 25.691971375563, 25.535789181058, 25.379606986506,
-               25.223424791908, 25.067242597263, 24.911060402572, 24.754878207837, 24.598696013056, 24.442513818231,
-               24.286331623362, 24.130149428450, 23.973967233495, 23.817785038496, 23.661602843456, 23.505420648374,
-               23.349238453250, 23.193056258085, 23.036874062880, 22.880691867634, 22.724509672349, 22.568327477024,
-               22.412145281660, 22.255963086258, 22.099780890817, 21.943598695338, 21.787416499822, 21.631234304268,
-               21.475052108678, 21.318869913051, 21.162687717389, 21.006505521690, 20.850323325957, 20.694141130188,
-               20.537958934385, 20.381776738547, 20.225594542676, 20.069412346771, 19.913230150833, 19.757047954862,
-               19.600865758859, 19.444683562824, 19.288501366756, 19.132319170658, 18.976136974528, 18.819954778367,
-               18.663772582176, 18.507590385954, 18.351408189703, 18.195225993422, 18.039043797112, 17.882861600774,
-               17.726679404406, 17.570497208011, 17.414315011587, 17.258132815136, 17.101950618658, 16.945768422153,
-               16.789586225620, 16.633404029062, 16.477221832478, 16.321039635867, 16.164857439232, 16.008675242571,
-               15.852493045885, 15.696310849174, 15.540128652440, 15.383946455681, 15.227764258899, 15.071582062093,
-               14.915399865264, 14.759217668412, 14.603035471538, 14.446853274641, 14.290671077722, 14.134488880782,
-               13.978306683820, 13.822124486837, 13.665942289833, 13.509760092808, 13.353577895763, 13.197395698698,
-               13.041213501613, 12.885031304509, 12.728849107385, 12.572666910242, 12.416484713080, 12.260302515900,
-               12.104120318702, 11.947938121486, 11.791755924252, 11.635573727000, 11.479391529732, 11.323209332446,
-               11.167027135144, 11.010844937825, 10.854662740490, 10.698480543140, 10.542298345773, 10.386116148391,
-               10.229933950994, 10.073751753582, 9.917569556155, 9.761387358714, 9.605205161259, 9.449022963790,
-               9.292840766307, 9.136658568810, 8.980476371300, 8.824294173778, 8.668111976242, 8.511929778694,
-               8.355747581134, 8.199565383562, 8.043383185978, 7.887200988383, 7.731018790776, 7.574836593158,
-               7.418654395529, 7.262472197890, 7.106290000240, 6.950107802580, 6.793925604910, 6.637743407231,
-               6.481561209542, 6.325379011844, 6.169196814136, 6.013014616420, 5.856832418696, 5.700650220963,
-               5.544468023222, 5.388285825474, 5.232103627717, 5.075921429954, 4.919739232183, 4.763557034405,
-               4.607374836620, 4.451192638829, 4.295010441032, 4.138828243229, 3.982646045419, 3.826463847605,
-               3.670281649784, 3.514099451959, 3.357917254129, 3.201735056294, 3.045552858454, 2.889370660610,
-               2.733188462763, 2.577006264911, 2.420824067056, 2.264641869197, 2.108459671335, 1.952277473470,
-               1.796095275603, 1.639913077733, 1.483730879860, 1.327548681986, 1.171366484109, 1.015184286231,
-               0.859002088352, 0.702819890472, 0.546637692590, 0.390455494708, 0.234273296825, 0.078091098942 ) )
-
-}  // namespace gaussian
-}  // namespace spacing
-}  // namespace grid
-}  // namespace atlas
@@ -1,26 +0,0 @@
-// TL127
-
-#include "atlas/grid/detail/spacing/gaussian/N.h"
-
-namespace atlas {
-namespace grid {
-namespace spacing {
-namespace gaussian {
-
-DEFINE_GAUSSIAN_LATITUDES(
-    64, LIST( 88.927735352296, 87.538705213027, 86.141472101528, 84.742385590714, 83.342596044070, 81.942466299173,
-              80.542146434617, 79.141709648622, 77.741195865514, 76.340628702372, 74.940023019649, 73.539388633767,
-              72.138732289162, 70.738058772518, 69.337371574961, 67.936673302579, 66.535965940176, 65.135251026035,
-              63.734529770843, 62.333803140532, 60.933071915207, 59.532336731827, 58.131598115644, 56.730856503714,
-              55.330112262703, 53.929365702556, 52.528617087100, 51.127866642353, 49.727114563110, 48.326361018188,
-              46.925606154665, 45.524850101302, 44.124092971356, 42.723334864877, 41.322575870623, 39.921816067646,
-              38.521055526624, 37.120294310979, 35.719532477824, 34.318770078771, 32.918007160614, 31.517243765923,
-              30.116479933546, 28.715715699055, 27.314951095120, 25.914186151847, 24.513420897063, 23.112655356578,
-              21.711889554404, 20.311123512960, 18.910357253245, 17.509590794999, 16.108824156841, 14.708057356405,
-              13.307290410446, 11.906523334954, 10.505756145244, 9.104988856049, 7.704221481600, 6.303454035708,
-              4.902686531827, 3.501918983131, 2.101151402579, 0.700383802973 ) )
-
-}  // namespace gaussian
-}  // namespace spacing
-}  // namespace grid
-}  // namespace atlas
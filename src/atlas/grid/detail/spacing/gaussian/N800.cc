@@ -1,149 +0,0 @@
-// TL1599
-
-#include "atlas/grid/detail/spacing/gaussian/N.h"
-
-namespace atlas {
-namespace grid {
-namespace spacing {
-namespace gaussian {
-
-DEFINE_GAUSSIAN_LATITUDES(
-    800, LIST( 89.913910432567, 89.802388520364, 89.690208010997, 89.577878696439, 89.465492936558, 89.353079862649,
-               89.240651524094, 89.128213797733, 89.015769888926, 88.903321693762, 88.790870405278, 88.678416811542,
-               88.565961453973, 88.453504716809, 88.341046880271, 88.228588153518, 88.116128695829, 88.003668630629,
-               87.891208055042, 87.778747046539, 87.666285667668, 87.553823969486, 87.441361994075, 87.328899776437,
-               87.216437345920, 87.103974727314, 86.991511941706, 86.879049007143, 86.766585939163, 86.654122751216,
-               86.541659455003, 86.429196060750, 86.316732577436, 86.204269012976, 86.091805374374, 85.979341667850,
-               85.866877898947, 85.754414072622, 85.641950193319, 85.529486265037, 85.417022291380, 85.304558275609,
-               85.192094220678, 85.079630129273, 84.967166003838, 84.854701846604, 84.742237659612, 84.629773444731,
-               84.517309203677, 84.404844938029, 84.292380649239, 84.179916338650, 84.067452007501, 83.954987656940,
-               83.842523288029, 83.730058901757, 83.617594499041, 83.505130080736, 83.392665647637, 83.280201200487,
-               83.167736739980, 83.055272266765, 82.942807781449, 82.830343284601, 82.717878776757, 82.605414258418,
-               82.492949730055, 82.380485192112, 82.268020645007, 82.155556089135, 82.043091524867, 81.930626952554,
-               81.818162372528, 81.705697785102, 81.593233190575, 81.480768589225, 81.368303981322, 81.255839367117,
-               81.143374746850, 81.030910120750, 80.918445489032, 80.805980851905, 80.693516209562, 80.581051562192,
-               80.468586909973, 80.356122253073, 80.243657591655, 80.131192925873, 80.018728255875, 79.906263581802,
-               79.793798903788, 79.681334221962, 79.568869536448, 79.456404847364, 79.343940154822, 79.231475458931,
-               79.119010759796, 79.006546057514, 78.894081352183, 78.781616643893, 78.669151932734, 78.556687218788,
-               78.444222502139, 78.331757782864, 78.219293061038, 78.106828336733, 77.994363610020, 77.881898880965,
-               77.769434149634, 77.656969416087, 77.544504680386, 77.432039942588, 77.319575202748, 77.207110460921,
-               77.094645717159, 76.982180971512, 76.869716224029, 76.757251474755, 76.644786723737, 76.532321971017,
-               76.419857216639, 76.307392460644, 76.194927703070, 76.082462943956, 75.969998183339, 75.857533421255,
-               75.745068657739, 75.632603892824, 75.520139126543, 75.407674358928, 75.295209590008, 75.182744819815,
-               75.070280048376, 74.957815275720, 74.845350501873, 74.732885726863, 74.620420950714, 74.507956173452,
-               74.395491395100, 74.283026615682, 74.170561835220, 74.058097053737, 73.945632271255, 73.833167487793,
-               73.720702703373, 73.608237918014, 73.495773131735, 73.383308344555, 73.270843556493, 73.158378767565,
-               73.045913977789, 72.933449187182, 72.820984395761, 72.708519603540, 72.596054810536, 72.483590016764,
-               72.371125222239, 72.258660426974, 72.146195630983, 72.033730834282, 71.921266036881, 71.808801238796,
-               71.696336440038, 71.583871640619, 71.471406840552, 71.358942039849, 71.246477238520, 71.134012436578,
-               71.021547634032, 70.909082830894, 70.796618027174, 70.684153222883, 70.571688418029, 70.459223612624,
-               70.346758806675, 70.234294000194, 70.121829193188, 70.009364385667, 69.896899577639, 69.784434769113,
-               69.671969960097, 69.559505150599, 69.447040340627, 69.334575530189, 69.222110719292, 69.109645907944,
-               68.997181096152, 68.884716283923, 68.772251471264, 68.659786658182, 68.547321844684, 68.434857030775,
-               68.322392216464, 68.209927401755, 68.097462586655, 67.984997771169, 67.872532955305, 67.760068139067,
-               67.647603322461, 67.535138505493, 67.422673688169, 67.310208870492, 67.197744052469, 67.085279234106,
-               66.972814415406, 66.860349596374, 66.747884777016, 66.635419957337, 66.522955137340, 66.410490317031,
-               66.298025496414, 66.185560675493, 66.073095854272, 65.960631032757, 65.848166210950, 65.735701388856,
-               65.623236566480, 65.510771743824, 65.398306920893, 65.285842097690, 65.173377274220, 65.060912450485,
-               64.948447626490, 64.835982802238, 64.723517977732, 64.611053152976, 64.498588327972, 64.386123502726,
-               64.273658677238, 64.161193851514, 64.048729025555, 63.936264199365, 63.823799372947, 63.711334546304,
-               63.598869719438, 63.486404892353, 63.373940065051, 63.261475237535, 63.149010409808, 63.036545581872,
-               62.924080753730, 62.811615925385, 62.699151096839, 62.586686268095, 62.474221439154, 62.361756610020,
-               62.249291780695, 62.136826951181, 62.024362121480, 61.911897291595, 61.799432461528, 61.686967631281,
-               61.574502800856, 61.462037970255, 61.349573139481, 61.237108308536, 61.124643477421, 61.012178646138,
-               60.899713814690, 60.787248983078, 60.674784151304, 60.562319319371, 60.449854487279, 60.337389655031,
-               60.224924822629, 60.112459990074, 59.999995157368, 59.887530324513, 59.775065491510, 59.662600658361,
-               59.550135825068, 59.437670991632, 59.325206158055, 59.212741324339, 59.100276490485, 58.987811656494,
-               58.875346822368, 58.762881988108, 58.650417153717, 58.537952319194, 58.425487484543, 58.313022649763,
-               58.200557814858, 58.088092979827, 57.975628144672, 57.863163309394, 57.750698473996, 57.638233638477,
-               57.525768802840, 57.413303967086, 57.300839131215, 57.188374295229, 57.075909459130, 56.963444622917,
-               56.850979786594, 56.738514950160, 56.626050113617, 56.513585276965, 56.401120440207, 56.288655603343,
-               56.176190766374, 56.063725929301, 55.951261092126, 55.838796254849, 55.726331417471, 55.613866579993,
-               55.501401742417, 55.388936904743, 55.276472066972, 55.164007229106, 55.051542391144, 54.939077553089,
-               54.826612714941, 54.714147876700, 54.601683038368, 54.489218199946, 54.376753361435, 54.264288522834,
-               54.151823684146, 54.039358845371, 53.926894006510, 53.814429167564, 53.701964328533, 53.589499489418,
-               53.477034650221, 53.364569810941, 53.252104971580, 53.139640132139, 53.027175292617, 52.914710453017,
-               52.802245613338, 52.689780773581, 52.577315933747, 52.464851093838, 52.352386253852, 52.239921413792,
-               52.127456573658, 52.014991733450, 51.902526893169, 51.790062052816, 51.677597212392, 51.565132371896,
-               51.452667531331, 51.340202690695, 51.227737849991, 51.115273009218, 51.002808168378, 50.890343327470,
-               50.777878486496, 50.665413645456, 50.552948804350, 50.440483963179, 50.328019121945, 50.215554280646,
-               50.103089439284, 49.990624597860, 49.878159756373, 49.765694914825, 49.653230073216, 49.540765231546,
-               49.428300389817, 49.315835548028, 49.203370706180, 49.090905864273, 48.978441022308, 48.865976180286,
-               48.753511338207, 48.641046496072, 48.528581653880, 48.416116811633, 48.303651969331, 48.191187126974,
-               48.078722284563, 47.966257442098, 47.853792599579, 47.741327757008, 47.628862914385, 47.516398071709,
-               47.403933228982, 47.291468386204, 47.179003543375, 47.066538700496, 46.954073857566, 46.841609014588,
-               46.729144171560, 46.616679328483, 46.504214485358, 46.391749642185, 46.279284798965, 46.166819955698,
-               46.054355112383, 45.941890269023, 45.829425425616, 45.716960582163, 45.604495738666, 45.492030895123,
-               45.379566051536, 45.267101207904, 45.154636364228, 45.042171520509, 44.929706676747, 44.817241832942,
-               44.704776989094, 44.592312145205, 44.479847301273, 44.367382457299, 44.254917613285, 44.142452769229,
-               44.029987925133, 43.917523080997, 43.805058236821, 43.692593392605, 43.580128548349, 43.467663704055,
-               43.355198859722, 43.242734015350, 43.130269170940, 43.017804326492, 42.905339482007, 42.792874637484,
-               42.680409792924, 42.567944948328, 42.455480103695, 42.343015259025, 42.230550414320, 42.118085569579,
-               42.005620724803, 41.893155879992, 41.780691035146, 41.668226190265, 41.555761345350, 41.443296500400,
-               41.330831655417, 41.218366810400, 41.105901965350, 40.993437120267, 40.880972275151, 40.768507430002,
-               40.656042584821, 40.543577739608, 40.431112894362, 40.318648049085, 40.206183203777, 40.093718358438,
-               39.981253513067, 39.868788667666, 39.756323822234, 39.643858976772, 39.531394131279, 39.418929285757,
-               39.306464440205, 39.193999594624, 39.081534749013, 38.969069903374, 38.856605057705, 38.744140212008,
-               38.631675366283, 38.519210520529, 38.406745674747, 38.294280828938, 38.181815983101, 38.069351137236,
-               37.956886291344, 37.844421445426, 37.731956599480, 37.619491753508, 37.507026907509, 37.394562061484,
-               37.282097215433, 37.169632369356, 37.057167523253, 36.944702677124, 36.832237830971, 36.719772984792,
-               36.607308138588, 36.494843292359, 36.382378446106, 36.269913599828, 36.157448753526, 36.044983907199,
-               35.932519060849, 35.820054214475, 35.707589368077, 35.595124521656, 35.482659675211, 35.370194828743,
-               35.257729982253, 35.145265135739, 35.032800289203, 34.920335442644, 34.807870596063, 34.695405749459,
-               34.582940902834, 34.470476056186, 34.358011209517, 34.245546362826, 34.133081516114, 34.020616669381,
-               33.908151822626, 33.795686975850, 33.683222129054, 33.570757282236, 33.458292435398, 33.345827588540,
-               33.233362741661, 33.120897894762, 33.008433047843, 32.895968200904, 32.783503353946, 32.671038506967,
-               32.558573659970, 32.446108812953, 32.333643965916, 32.221179118861, 32.108714271786, 31.996249424693,
-               31.883784577581, 31.771319730451, 31.658854883301, 31.546390036134, 31.433925188949, 31.321460341745,
-               31.208995494523, 31.096530647284, 30.984065800027, 30.871600952752, 30.759136105459, 30.646671258150,
-               30.534206410823, 30.421741563479, 30.309276716118, 30.196811868740, 30.084347021345, 29.971882173934,
-               29.859417326506, 29.746952479061, 29.634487631601, 29.522022784124, 29.409557936631, 29.297093089122,
-               29.184628241597, 29.072163394056, 28.959698546500, 28.847233698928, 28.734768851340, 28.622304003737,
-               28.509839156119, 28.397374308486, 28.284909460838, 28.172444613174, 28.059979765496, 27.947514917803,
-               27.835050070096, 27.722585222374, 27.610120374637, 27.497655526887, 27.385190679122, 27.272725831342,
-               27.160260983549, 27.047796135742, 26.935331287921, 26.822866440086, 26.710401592237, 26.597936744375,
-               26.485471896499, 26.373007048610, 26.260542200708, 26.148077352792, 26.035612504863, 25.923147656922,
-               25.810682808967, 25.698217960999, 25.585753113019, 25.473288265026, 25.360823417021, 25.248358569002,
-               25.135893720972, 25.023428872929, 24.910964024874, 24.798499176807, 24.686034328727, 24.573569480636,
-               24.461104632533, 24.348639784418, 24.236174936291, 24.123710088152, 24.011245240002, 23.898780391841,
-               23.786315543668, 23.673850695483, 23.561385847288, 23.448920999081, 23.336456150863, 23.223991302634,
-               23.111526454394, 22.999061606143, 22.886596757882, 22.774131909610, 22.661667061327, 22.549202213033,
-               22.436737364729, 22.324272516415, 22.211807668090, 22.099342819755, 21.986877971410, 21.874413123055,
-               21.761948274690, 21.649483426314, 21.537018577929, 21.424553729534, 21.312088881129, 21.199624032715,
-               21.087159184291, 20.974694335857, 20.862229487414, 20.749764638962, 20.637299790500, 20.524834942029,
-               20.412370093549, 20.299905245059, 20.187440396561, 20.074975548053, 19.962510699537, 19.850045851012,
-               19.737581002478, 19.625116153935, 19.512651305384, 19.400186456824, 19.287721608255, 19.175256759678,
-               19.062791911093, 18.950327062499, 18.837862213897, 18.725397365287, 18.612932516668, 18.500467668042,
-               18.388002819407, 18.275537970765, 18.163073122115, 18.050608273457, 17.938143424791, 17.825678576117,
-               17.713213727436, 17.600748878747, 17.488284030051, 17.375819181347, 17.263354332636, 17.150889483917,
-               17.038424635192, 16.925959786458, 16.813494937718, 16.701030088971, 16.588565240217, 16.476100391455,
-               16.363635542687, 16.251170693912, 16.138705845130, 16.026240996341, 15.913776147546, 15.801311298744,
-               15.688846449935, 15.576381601120, 15.463916752298, 15.351451903470, 15.238987054636, 15.126522205795,
-               15.014057356948, 14.901592508095, 14.789127659235, 14.676662810370, 14.564197961499, 14.451733112621,
-               14.339268263738, 14.226803414849, 14.114338565954, 14.001873717053, 13.889408868147, 13.776944019234,
-               13.664479170317, 13.552014321393, 13.439549472465, 13.327084623530, 13.214619774591, 13.102154925646,
-               12.989690076696, 12.877225227740, 12.764760378780, 12.652295529814, 12.539830680843, 12.427365831867,
-               12.314900982886, 12.202436133900, 12.089971284910, 11.977506435914, 11.865041586914, 11.752576737909,
-               11.640111888899, 11.527647039885, 11.415182190866, 11.302717341843, 11.190252492815, 11.077787643783,
-               10.965322794746, 10.852857945705, 10.740393096660, 10.627928247610, 10.515463398556, 10.402998549498,
-               10.290533700437, 10.178068851371, 10.065604002301, 9.953139153227, 9.840674304149, 9.728209455067,
-               9.615744605982, 9.503279756892, 9.390814907800, 9.278350058703, 9.165885209603, 9.053420360499,
-               8.940955511392, 8.828490662281, 8.716025813167, 8.603560964049, 8.491096114928, 8.378631265804,
-               8.266166416677, 8.153701567546, 8.041236718412, 7.928771869275, 7.816307020135, 7.703842170992,
-               7.591377321846, 7.478912472698, 7.366447623546, 7.253982774391, 7.141517925234, 7.029053076074,
-               6.916588226911, 6.804123377746, 6.691658528578, 6.579193679407, 6.466728830234, 6.354263981058,
-               6.241799131880, 6.129334282700, 6.016869433517, 5.904404584332, 5.791939735145, 5.679474885955,
-               5.567010036763, 5.454545187570, 5.342080338374, 5.229615489176, 5.117150639976, 5.004685790774,
-               4.892220941570, 4.779756092365, 4.667291243157, 4.554826393948, 4.442361544737, 4.329896695525,
-               4.217431846311, 4.104966997095, 3.992502147877, 3.880037298658, 3.767572449438, 3.655107600216,
-               3.542642750993, 3.430177901769, 3.317713052543, 3.205248203316, 3.092783354087, 2.980318504858,
-               2.867853655627, 2.755388806396, 2.642923957163, 2.530459107929, 2.417994258695, 2.305529409459,
-               2.193064560223, 2.080599710986, 1.968134861748, 1.855670012509, 1.743205163269, 1.630740314029,
-               1.518275464789, 1.405810615547, 1.293345766305, 1.180880917063, 1.068416067820, 0.955951218577,
-               0.843486369334, 0.731021520090, 0.618556670846, 0.506091821601, 0.393626972357, 0.281162123112,
-               0.168697273867, 0.056232424622 ) )
-
-}  // namespace gaussian
-}  // namespace spacing
-}  // namespace grid
-}  // namespace atlas
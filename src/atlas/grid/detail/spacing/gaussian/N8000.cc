@@ -1,1330 +0,0 @@
-// TL15999
-
-#include "atlas/grid/detail/spacing/gaussian/N.h"
-
-namespace atlas {
-namespace grid {
-namespace spacing {
-namespace gaussian {
-
-DEFINE_GAUSSIAN_LATITUDES(
-    8000,
-    LIST(
-        89.991388621915, 89.980233294064, 89.969012087973, 89.957775997170, 89.946534260250, 89.935289791164,
-        89.924043795176, 89.912796860149, 89.901549306701, 89.890301324497, 89.879053032872, 89.867804510659,
-        89.856555812013, 89.845306975370, 89.834058028757, 89.822808993098, 89.811559884324, 89.800310714781,
-        89.789061494187, 89.777812230288, 89.766562929342, 89.755313596457, 89.744064235840, 89.732814850994,
-        89.721565444855, 89.710316019900, 89.699066578241, 89.687817121682, 89.676567651779, 89.665318169874,
-        89.654068677140, 89.642819174600, 89.631569663150, 89.620320143583, 89.609070616601, 89.597821082824,
-        89.586571542809, 89.575321997048, 89.564072445989, 89.552822890030, 89.541573329533, 89.530323764823,
-        89.519074196195, 89.507824623919, 89.496575048240, 89.485325469380, 89.474075887543, 89.462826302916,
-        89.451576715671, 89.440327125966, 89.429077533946, 89.417827939746, 89.406578343489, 89.395328745290,
-        89.384079145256, 89.372829543485, 89.361579940070, 89.350330335095, 89.339080728640, 89.327831120779,
-        89.316581511583, 89.305331901115, 89.294082289437, 89.282832676606, 89.271583062674, 89.260333447692,
-        89.249083831708, 89.237834214766, 89.226584596907, 89.215334978171, 89.204085358595, 89.192835738215,
-        89.181586117063, 89.170336495171, 89.159086872568, 89.147837249283, 89.136587625343, 89.125338000772,
-        89.114088375595, 89.102838749834, 89.091589123511, 89.080339496647, 89.069089869262, 89.057840241373,
-        89.046590612999, 89.035340984158, 89.024091354864, 89.012841725134, 89.001592094982, 88.990342464422,
-        88.979092833468, 88.967843202133, 88.956593570428, 88.945343938367, 88.934094305960, 88.922844673218,
-        88.911595040151, 88.900345406769, 88.889095773083, 88.877846139100, 88.866596504830, 88.855346870282,
-        88.844097235463, 88.832847600381, 88.821597965045, 88.810348329460, 88.799098693634, 88.787849057574,
-        88.776599421287, 88.765349784777, 88.754100148052, 88.742850511118, 88.731600873979, 88.720351236641,
-        88.709101599110, 88.697851961390, 88.686602323487, 88.675352685404, 88.664103047147, 88.652853408719,
-        88.641603770126, 88.630354131371, 88.619104492457, 88.607854853390, 88.596605214173, 88.585355574808,
-        88.574105935301, 88.562856295653, 88.551606655869, 88.540357015951, 88.529107375903, 88.517857735727,
-        88.506608095426, 88.495358455004, 88.484108814463, 88.472859173805, 88.461609533033, 88.450359892150,
-        88.439110251158, 88.427860610059, 88.416610968856, 88.405361327551, 88.394111686145, 88.382862044642,
-        88.371612403043, 88.360362761349, 88.349113119564, 88.337863477688, 88.326613835725, 88.315364193674,
-        88.304114551539, 88.292864909320, 88.281615267020, 88.270365624640, 88.259115982182, 88.247866339647,
-        88.236616697036, 88.225367054351, 88.214117411594, 88.202867768765, 88.191618125867, 88.180368482900,
-        88.169118839865, 88.157869196765, 88.146619553599, 88.135369910370, 88.124120267079, 88.112870623726,
-        88.101620980312, 88.090371336839, 88.079121693308, 88.067872049720, 88.056622406075, 88.045372762376,
-        88.034123118621, 88.022873474814, 88.011623830954, 88.000374187042, 87.989124543080, 87.977874899067,
-        87.966625255006, 87.955375610897, 87.944125966739, 87.932876322536, 87.921626678286, 87.910377033991,
-        87.899127389652, 87.887877745269, 87.876628100842, 87.865378456374, 87.854128811864, 87.842879167313,
-        87.831629522721, 87.820379878089, 87.809130233419, 87.797880588709, 87.786630943962, 87.775381299177,
-        87.764131654356, 87.752882009498, 87.741632364604, 87.730382719676, 87.719133074712, 87.707883429714,
-        87.696633784683, 87.685384139618, 87.674134494521, 87.662884849392, 87.651635204230, 87.640385559038,
-        87.629135913814, 87.617886268560, 87.606636623276, 87.595386977963, 87.584137332620, 87.572887687248,
-        87.561638041848, 87.550388396420, 87.539138750965, 87.527889105482, 87.516639459973, 87.505389814437,
-        87.494140168875, 87.482890523287, 87.471640877673, 87.460391232035, 87.449141586371, 87.437891940684,
-        87.426642294972, 87.415392649236, 87.404143003477, 87.392893357695, 87.381643711889, 87.370394066062,
-        87.359144420212, 87.347894774339, 87.336645128445, 87.325395482530, 87.314145836593, 87.302896190636,
-        87.291646544658, 87.280396898659, 87.269147252640, 87.257897606602, 87.246647960543, 87.235398314465,
-        87.224148668368, 87.212899022252, 87.201649376117, 87.190399729964, 87.179150083793, 87.167900437603,
-        87.156650791396, 87.145401145170, 87.134151498928, 87.122901852668, 87.111652206391, 87.100402560097,
-        87.089152913787, 87.077903267461, 87.066653621117, 87.055403974758, 87.044154328383, 87.032904681993,
-        87.021655035586, 87.010405389165, 86.999155742728, 86.987906096276, 86.976656449810, 86.965406803328,
-        86.954157156832, 86.942907510322, 86.931657863798, 86.920408217259, 86.909158570707, 86.897908924141,
-        86.886659277561, 86.875409630968, 86.864159984362, 86.852910337742, 86.841660691110, 86.830411044464,
-        86.819161397806, 86.807911751135, 86.796662104452, 86.785412457757, 86.774162811049, 86.762913164329,
-        86.751663517597, 86.740413870853, 86.729164224098, 86.717914577331, 86.706664930552, 86.695415283763,
-        86.684165636961, 86.672915990149, 86.661666343326, 86.650416696492, 86.639167049647, 86.627917402791,
-        86.616667755925, 86.605418109048, 86.594168462161, 86.582918815264, 86.571669168357, 86.560419521439,
-        86.549169874512, 86.537920227574, 86.526670580627, 86.515420933670, 86.504171286704, 86.492921639728,
-        86.481671992742, 86.470422345748, 86.459172698744, 86.447923051731, 86.436673404709, 86.425423757678,
-        86.414174110638, 86.402924463589, 86.391674816532, 86.380425169466, 86.369175522391, 86.357925875308,
-        86.346676228216, 86.335426581117, 86.324176934009, 86.312927286892, 86.301677639768, 86.290427992636,
-        86.279178345495, 86.267928698347, 86.256679051191, 86.245429404028, 86.234179756856, 86.222930109677,
-        86.211680462491, 86.200430815297, 86.189181168095, 86.177931520887, 86.166681873671, 86.155432226448,
-        86.144182579217, 86.132932931980, 86.121683284736, 86.110433637484, 86.099183990226, 86.087934342961,
-        86.076684695689, 86.065435048411, 86.054185401125, 86.042935753833, 86.031686106535, 86.020436459230,
-        86.009186811919, 85.997937164601, 85.986687517277, 85.975437869947, 85.964188222610, 85.952938575268,
-        85.941688927919, 85.930439280564, 85.919189633203, 85.907939985836, 85.896690338463, 85.885440691085,
-        85.874191043700, 85.862941396310, 85.851691748914, 85.840442101512, 85.829192454105, 85.817942806692,
-        85.806693159274, 85.795443511850, 85.784193864420, 85.772944216986, 85.761694569545, 85.750444922100,
-        85.739195274649, 85.727945627193, 85.716695979732, 85.705446332265, 85.694196684794, 85.682947037317,
-        85.671697389835, 85.660447742349, 85.649198094857, 85.637948447361, 85.626698799859, 85.615449152353,
-        85.604199504842, 85.592949857326, 85.581700209805, 85.570450562280, 85.559200914750, 85.547951267215,
-        85.536701619676, 85.525451972132, 85.514202324584, 85.502952677031, 85.491703029474, 85.480453381912,
-        85.469203734346, 85.457954086776, 85.446704439201, 85.435454791622, 85.424205144038, 85.412955496451,
-        85.401705848859, 85.390456201263, 85.379206553663, 85.367956906059, 85.356707258450, 85.345457610838,
-        85.334207963222, 85.322958315601, 85.311708667977, 85.300459020349, 85.289209372717, 85.277959725081,
-        85.266710077441, 85.255460429797, 85.244210782149, 85.232961134498, 85.221711486843, 85.210461839184,
-        85.199212191522, 85.187962543856, 85.176712896186, 85.165463248512, 85.154213600835, 85.142963953155,
-        85.131714305471, 85.120464657783, 85.109215010092, 85.097965362398, 85.086715714700, 85.075466066998,
-        85.064216419293, 85.052966771585, 85.041717123874, 85.030467476159, 85.019217828441, 85.007968180719,
-        84.996718532994, 84.985468885266, 84.974219237535, 84.962969589801, 84.951719942063, 84.940470294323,
-        84.929220646579, 84.917970998832, 84.906721351082, 84.895471703329, 84.884222055572, 84.872972407813,
-        84.861722760051, 84.850473112286, 84.839223464518, 84.827973816747, 84.816724168973, 84.805474521196,
-        84.794224873416, 84.782975225633, 84.771725577847, 84.760475930059, 84.749226282268, 84.737976634474,
-        84.726726986677, 84.715477338877, 84.704227691075, 84.692978043270, 84.681728395462, 84.670478747652,
-        84.659229099838, 84.647979452023, 84.636729804204, 84.625480156383, 84.614230508559, 84.602980860733,
-        84.591731212904, 84.580481565073, 84.569231917239, 84.557982269402, 84.546732621563, 84.535482973721,
-        84.524233325877, 84.512983678031, 84.501734030182, 84.490484382331, 84.479234734477, 84.467985086620,
-        84.456735438762, 84.445485790901, 84.434236143037, 84.422986495172, 84.411736847303, 84.400487199433,
-        84.389237551560, 84.377987903685, 84.366738255808, 84.355488607928, 84.344238960047, 84.332989312163,
-        84.321739664276, 84.310490016388, 84.299240368497, 84.287990720604, 84.276741072709, 84.265491424812,
-        84.254241776912, 84.242992129011, 84.231742481107, 84.220492833201, 84.209243185293, 84.197993537383,
-        84.186743889471, 84.175494241557, 84.164244593641, 84.152994945723, 84.141745297803, 84.130495649880,
-        84.119246001956, 84.107996354030, 84.096746706102, 84.085497058171, 84.074247410239, 84.062997762305,
-        84.051748114369, 84.040498466431, 84.029248818491, 84.017999170549, 84.006749522606, 83.995499874660,
-        83.984250226713, 83.973000578763, 83.961750930812, 83.950501282859, 83.939251634904, 83.928001986948,
-        83.916752338989, 83.905502691029, 83.894253043067, 83.883003395103, 83.871753747137, 83.860504099170,
-        83.849254451201, 83.838004803230, 83.826755155257, 83.815505507283, 83.804255859307, 83.793006211329,
-        83.781756563349, 83.770506915368, 83.759257267385, 83.748007619401, 83.736757971415, 83.725508323427,
-        83.714258675437, 83.703009027446, 83.691759379453, 83.680509731459, 83.669260083463, 83.658010435466,
-        83.646760787467, 83.635511139466, 83.624261491464, 83.613011843460, 83.601762195454, 83.590512547447,
-        83.579262899439, 83.568013251429, 83.556763603417, 83.545513955404, 83.534264307390, 83.523014659373,
-        83.511765011356, 83.500515363337, 83.489265715316, 83.478016067294, 83.466766419271, 83.455516771246,
-        83.444267123219, 83.433017475192, 83.421767827162, 83.410518179132, 83.399268531100, 83.388018883066,
-        83.376769235031, 83.365519586995, 83.354269938957, 83.343020290918, 83.331770642878, 83.320520994836,
-        83.309271346793, 83.298021698748, 83.286772050702, 83.275522402655, 83.264272754606, 83.253023106557,
-        83.241773458505, 83.230523810453, 83.219274162399, 83.208024514344, 83.196774866287, 83.185525218230,
-        83.174275570171, 83.163025922110, 83.151776274049, 83.140526625986, 83.129276977922, 83.118027329857,
-        83.106777681790, 83.095528033722, 83.084278385653, 83.073028737583, 83.061779089512, 83.050529441439,
-        83.039279793365, 83.028030145290, 83.016780497214, 83.005530849136, 82.994281201058, 82.983031552978,
-        82.971781904897, 82.960532256814, 82.949282608731, 82.938032960647, 82.926783312561, 82.915533664474,
-        82.904284016386, 82.893034368297, 82.881784720207, 82.870535072115, 82.859285424023, 82.848035775929,
-        82.836786127835, 82.825536479739, 82.814286831642, 82.803037183544, 82.791787535445, 82.780537887345,
-        82.769288239244, 82.758038591141, 82.746788943038, 82.735539294933, 82.724289646828, 82.713039998721,
-        82.701790350614, 82.690540702505, 82.679291054396, 82.668041406285, 82.656791758173, 82.645542110060,
-        82.634292461947, 82.623042813832, 82.611793165716, 82.600543517599, 82.589293869481, 82.578044221362,
-        82.566794573243, 82.555544925122, 82.544295277000, 82.533045628877, 82.521795980754, 82.510546332629,
-        82.499296684503, 82.488047036377, 82.476797388249, 82.465547740120, 82.454298091991, 82.443048443860,
-        82.431798795729, 82.420549147597, 82.409299499464, 82.398049851329, 82.386800203194, 82.375550555058,
-        82.364300906921, 82.353051258784, 82.341801610645, 82.330551962505, 82.319302314365, 82.308052666223,
-        82.296803018081, 82.285553369938, 82.274303721793, 82.263054073648, 82.251804425503, 82.240554777356,
-        82.229305129208, 82.218055481060, 82.206805832910, 82.195556184760, 82.184306536609, 82.173056888457,
-        82.161807240305, 82.150557592151, 82.139307943997, 82.128058295841, 82.116808647685, 82.105558999528,
-        82.094309351371, 82.083059703212, 82.071810055053, 82.060560406893, 82.049310758732, 82.038061110570,
-        82.026811462407, 82.015561814244, 82.004312166079, 81.993062517914, 81.981812869749, 81.970563221582,
-        81.959313573415, 81.948063925247, 81.936814277078, 81.925564628908, 81.914314980738, 81.903065332566,
-        81.891815684394, 81.880566036222, 81.869316388048, 81.858066739874, 81.846817091699, 81.835567443523,
-        81.824317795346, 81.813068147169, 81.801818498991, 81.790568850812, 81.779319202633, 81.768069554453,
-        81.756819906272, 81.745570258090, 81.734320609908, 81.723070961725, 81.711821313541, 81.700571665356,
-        81.689322017171, 81.678072368985, 81.666822720799, 81.655573072611, 81.644323424423, 81.633073776235,
-        81.621824128045, 81.610574479855, 81.599324831664, 81.588075183473, 81.576825535281, 81.565575887088,
-        81.554326238894, 81.543076590700, 81.531826942505, 81.520577294310, 81.509327646113, 81.498077997917,
-        81.486828349719, 81.475578701521, 81.464329053322, 81.453079405123, 81.441829756922, 81.430580108722,
-        81.419330460520, 81.408080812318, 81.396831164115, 81.385581515912, 81.374331867708, 81.363082219503,
-        81.351832571298, 81.340582923092, 81.329333274886, 81.318083626679, 81.306833978471, 81.295584330263,
-        81.284334682054, 81.273085033844, 81.261835385634, 81.250585737423, 81.239336089212, 81.228086441000,
-        81.216836792787, 81.205587144574, 81.194337496360, 81.183087848146, 81.171838199931, 81.160588551715,
-        81.149338903499, 81.138089255282, 81.126839607065, 81.115589958847, 81.104340310628, 81.093090662409,
-        81.081841014190, 81.070591365969, 81.059341717749, 81.048092069527, 81.036842421305, 81.025592773083,
-        81.014343124860, 81.003093476636, 80.991843828412, 80.980594180187, 80.969344531962, 80.958094883736,
-        80.946845235510, 80.935595587283, 80.924345939056, 80.913096290828, 80.901846642599, 80.890596994370,
-        80.879347346140, 80.868097697910, 80.856848049679, 80.845598401448, 80.834348753217, 80.823099104984,
-        80.811849456751, 80.800599808518, 80.789350160284, 80.778100512050, 80.766850863815, 80.755601215580,
-        80.744351567344, 80.733101919107, 80.721852270870, 80.710602622633, 80.699352974395, 80.688103326157,
-        80.676853677918, 80.665604029678, 80.654354381438, 80.643104733198, 80.631855084957, 80.620605436715,
-        80.609355788473, 80.598106140231, 80.586856491988, 80.575606843745, 80.564357195501, 80.553107547256,
-        80.541857899012, 80.530608250766, 80.519358602521, 80.508108954274, 80.496859306028, 80.485609657780,
-        80.474360009533, 80.463110361284, 80.451860713036, 80.440611064787, 80.429361416537, 80.418111768287,
-        80.406862120037, 80.395612471786, 80.384362823534, 80.373113175282, 80.361863527030, 80.350613878777,
-        80.339364230524, 80.328114582270, 80.316864934016, 80.305615285762, 80.294365637507, 80.283115989251,
-        80.271866340995, 80.260616692739, 80.249367044482, 80.238117396225, 80.226867747968, 80.215618099709,
-        80.204368451451, 80.193118803192, 80.181869154933, 80.170619506673, 80.159369858413, 80.148120210152,
-        80.136870561891, 80.125620913629, 80.114371265367, 80.103121617105, 80.091871968842, 80.080622320579,
-        80.069372672315, 80.058123024052, 80.046873375787, 80.035623727522, 80.024374079257, 80.013124430991,
-        80.001874782725, 79.990625134459, 79.979375486192, 79.968125837925, 79.956876189657, 79.945626541389,
-        79.934376893120, 79.923127244852, 79.911877596582, 79.900627948313, 79.889378300043, 79.878128651772,
-        79.866879003501, 79.855629355230, 79.844379706958, 79.833130058686, 79.821880410414, 79.810630762141,
-        79.799381113868, 79.788131465595, 79.776881817321, 79.765632169046, 79.754382520772, 79.743132872497,
-        79.731883224221, 79.720633575945, 79.709383927669, 79.698134279393, 79.686884631116, 79.675634982838,
-        79.664385334561, 79.653135686283, 79.641886038004, 79.630636389726, 79.619386741446, 79.608137093167,
-        79.596887444887, 79.585637796607, 79.574388148326, 79.563138500045, 79.551888851764, 79.540639203482,
-        79.529389555200, 79.518139906918, 79.506890258635, 79.495640610352, 79.484390962069, 79.473141313785,
-        79.461891665501, 79.450642017217, 79.439392368932, 79.428142720647, 79.416893072361, 79.405643424075,
-        79.394393775789, 79.383144127503, 79.371894479216, 79.360644830929, 79.349395182641, 79.338145534353,
-        79.326895886065, 79.315646237777, 79.304396589488, 79.293146941199, 79.281897292909, 79.270647644619,
-        79.259397996329, 79.248148348038, 79.236898699748, 79.225649051457, 79.214399403165, 79.203149754873,
-        79.191900106581, 79.180650458289, 79.169400809996, 79.158151161703, 79.146901513409, 79.135651865116,
-        79.124402216822, 79.113152568527, 79.101902920233, 79.090653271938, 79.079403623642, 79.068153975347,
-        79.056904327051, 79.045654678755, 79.034405030458, 79.023155382161, 79.011905733864, 79.000656085567,
-        78.989406437269, 78.978156788971, 78.966907140672, 78.955657492374, 78.944407844075, 78.933158195776,
-        78.921908547476, 78.910658899176, 78.899409250876, 78.888159602576, 78.876909954275, 78.865660305974,
-        78.854410657672, 78.843161009371, 78.831911361069, 78.820661712767, 78.809412064464, 78.798162416161,
-        78.786912767858, 78.775663119555, 78.764413471251, 78.753163822947, 78.741914174643, 78.730664526338,
-        78.719414878034, 78.708165229729, 78.696915581423, 78.685665933118, 78.674416284812, 78.663166636505,
-        78.651916988199, 78.640667339892, 78.629417691585, 78.618168043278, 78.606918394970, 78.595668746662,
-        78.584419098354, 78.573169450046, 78.561919801737, 78.550670153428, 78.539420505119, 78.528170856809,
-        78.516921208500, 78.505671560190, 78.494421911879, 78.483172263569, 78.471922615258, 78.460672966947,
-        78.449423318636, 78.438173670324, 78.426924022012, 78.415674373700, 78.404424725387, 78.393175077075,
-        78.381925428762, 78.370675780449, 78.359426132135, 78.348176483822, 78.336926835508, 78.325677187193,
-        78.314427538879, 78.303177890564, 78.291928242249, 78.280678593934, 78.269428945619, 78.258179297303,
-        78.246929648987, 78.235680000671, 78.224430352354, 78.213180704037, 78.201931055720, 78.190681407403,
-        78.179431759086, 78.168182110768, 78.156932462450, 78.145682814132, 78.134433165813, 78.123183517495,
-        78.111933869176, 78.100684220857, 78.089434572537, 78.078184924218, 78.066935275898, 78.055685627578,
-        78.044435979257, 78.033186330937, 78.021936682616, 78.010687034295, 77.999437385973, 77.988187737652,
-        77.976938089330, 77.965688441008, 77.954438792686, 77.943189144363, 77.931939496040, 77.920689847718,
-        77.909440199394, 77.898190551071, 77.886940902747, 77.875691254423, 77.864441606099, 77.853191957775,
-        77.841942309451, 77.830692661126, 77.819443012801, 77.808193364476, 77.796943716150, 77.785694067824,
-        77.774444419499, 77.763194771172, 77.751945122846, 77.740695474520, 77.729445826193, 77.718196177866,
-        77.706946529539, 77.695696881211, 77.684447232884, 77.673197584556, 77.661947936228, 77.650698287899,
-        77.639448639571, 77.628198991242, 77.616949342913, 77.605699694584, 77.594450046255, 77.583200397925,
-        77.571950749595, 77.560701101265, 77.549451452935, 77.538201804605, 77.526952156274, 77.515702507943,
-        77.504452859612, 77.493203211281, 77.481953562949, 77.470703914618, 77.459454266286, 77.448204617954,
-        77.436954969621, 77.425705321289, 77.414455672956, 77.403206024623, 77.391956376290, 77.380706727957,
-        77.369457079623, 77.358207431290, 77.346957782956, 77.335708134622, 77.324458486287, 77.313208837953,
-        77.301959189618, 77.290709541283, 77.279459892948, 77.268210244613, 77.256960596277, 77.245710947942,
-        77.234461299606, 77.223211651270, 77.211962002933, 77.200712354597, 77.189462706260, 77.178213057923,
-        77.166963409586, 77.155713761249, 77.144464112912, 77.133214464574, 77.121964816236, 77.110715167898,
-        77.099465519560, 77.088215871222, 77.076966222883, 77.065716574544, 77.054466926205, 77.043217277866,
-        77.031967629527, 77.020717981187, 77.009468332848, 76.998218684508, 76.986969036168, 76.975719387827,
-        76.964469739487, 76.953220091146, 76.941970442806, 76.930720794465, 76.919471146123, 76.908221497782,
-        76.896971849441, 76.885722201099, 76.874472552757, 76.863222904415, 76.851973256073, 76.840723607730,
-        76.829473959388, 76.818224311045, 76.806974662702, 76.795725014359, 76.784475366016, 76.773225717672,
-        76.761976069328, 76.750726420985, 76.739476772641, 76.728227124296, 76.716977475952, 76.705727827607,
-        76.694478179263, 76.683228530918, 76.671978882573, 76.660729234228, 76.649479585882, 76.638229937537,
-        76.626980289191, 76.615730640845, 76.604480992499, 76.593231344153, 76.581981695806, 76.570732047460,
-        76.559482399113, 76.548232750766, 76.536983102419, 76.525733454072, 76.514483805724, 76.503234157377,
-        76.491984509029, 76.480734860681, 76.469485212333, 76.458235563985, 76.446985915637, 76.435736267288,
-        76.424486618939, 76.413236970590, 76.401987322241, 76.390737673892, 76.379488025543, 76.368238377193,
-        76.356988728844, 76.345739080494, 76.334489432144, 76.323239783794, 76.311990135443, 76.300740487093,
-        76.289490838742, 76.278241190391, 76.266991542041, 76.255741893689, 76.244492245338, 76.233242596987,
-        76.221992948635, 76.210743300283, 76.199493651932, 76.188244003580, 76.176994355227, 76.165744706875,
-        76.154495058523, 76.143245410170, 76.131995761817, 76.120746113464, 76.109496465111, 76.098246816758,
-        76.086997168404, 76.075747520051, 76.064497871697, 76.053248223343, 76.041998574989, 76.030748926635,
-        76.019499278281, 76.008249629926, 75.996999981572, 75.985750333217, 75.974500684862, 75.963251036507,
-        75.952001388152, 75.940751739796, 75.929502091441, 75.918252443085, 75.907002794730, 75.895753146374,
-        75.884503498018, 75.873253849661, 75.862004201305, 75.850754552949, 75.839504904592, 75.828255256235,
-        75.817005607878, 75.805755959521, 75.794506311164, 75.783256662807, 75.772007014449, 75.760757366091,
-        75.749507717734, 75.738258069376, 75.727008421018, 75.715758772660, 75.704509124301, 75.693259475943,
-        75.682009827584, 75.670760179225, 75.659510530866, 75.648260882507, 75.637011234148, 75.625761585789,
-        75.614511937430, 75.603262289070, 75.592012640710, 75.580762992350, 75.569513343991, 75.558263695630,
-        75.547014047270, 75.535764398910, 75.524514750549, 75.513265102189, 75.502015453828, 75.490765805467,
-        75.479516157106, 75.468266508745, 75.457016860383, 75.445767212022, 75.434517563660, 75.423267915299,
-        75.412018266937, 75.400768618575, 75.389518970213, 75.378269321851, 75.367019673488, 75.355770025126,
-        75.344520376763, 75.333270728400, 75.322021080037, 75.310771431674, 75.299521783311, 75.288272134948,
-        75.277022486585, 75.265772838221, 75.254523189858, 75.243273541494, 75.232023893130, 75.220774244766,
-        75.209524596402, 75.198274948037, 75.187025299673, 75.175775651309, 75.164526002944, 75.153276354579,
-        75.142026706214, 75.130777057849, 75.119527409484, 75.108277761119, 75.097028112753, 75.085778464388,
-        75.074528816022, 75.063279167657, 75.052029519291, 75.040779870925, 75.029530222559, 75.018280574192,
-        75.007030925826, 74.995781277460, 74.984531629093, 74.973281980726, 74.962032332359, 74.950782683992,
-        74.939533035625, 74.928283387258, 74.917033738891, 74.905784090523, 74.894534442156, 74.883284793788,
-        74.872035145420, 74.860785497053, 74.849535848685, 74.838286200316, 74.827036551948, 74.815786903580,
-        74.804537255211, 74.793287606843, 74.782037958474, 74.770788310105, 74.759538661736, 74.748289013367,
-        74.737039364998, 74.725789716629, 74.714540068259, 74.703290419890, 74.692040771520, 74.680791123150,
-        74.669541474781, 74.658291826411, 74.647042178041, 74.635792529670, 74.624542881300, 74.613293232930,
-        74.602043584559, 74.590793936189, 74.579544287818, 74.568294639447, 74.557044991076, 74.545795342705,
-        74.534545694334, 74.523296045962, 74.512046397591, 74.500796749219, 74.489547100848, 74.478297452476,
-        74.467047804104, 74.455798155732, 74.444548507360, 74.433298858988, 74.422049210616, 74.410799562243,
-        74.399549913871, 74.388300265498, 74.377050617126, 74.365800968753, 74.354551320380, 74.343301672007,
-        74.332052023634, 74.320802375261, 74.309552726887, 74.298303078514, 74.287053430140, 74.275803781767,
-        74.264554133393, 74.253304485019, 74.242054836645, 74.230805188271, 74.219555539897, 74.208305891523,
-        74.197056243148, 74.185806594774, 74.174556946399, 74.163307298024, 74.152057649650, 74.140808001275,
-        74.129558352900, 74.118308704525, 74.107059056150, 74.095809407774, 74.084559759399, 74.073310111023,
-        74.062060462648, 74.050810814272, 74.039561165896, 74.028311517520, 74.017061869144, 74.005812220768,
-        73.994562572392, 73.983312924016, 73.972063275639, 73.960813627263, 73.949563978886, 73.938314330510,
-        73.927064682133, 73.915815033756, 73.904565385379, 73.893315737002, 73.882066088625, 73.870816440248,
-        73.859566791870, 73.848317143493, 73.837067495115, 73.825817846738, 73.814568198360, 73.803318549982,
-        73.792068901604, 73.780819253226, 73.769569604848, 73.758319956470, 73.747070308091, 73.735820659713,
-        73.724571011334, 73.713321362956, 73.702071714577, 73.690822066198, 73.679572417819, 73.668322769440,
-        73.657073121061, 73.645823472682, 73.634573824303, 73.623324175924, 73.612074527544, 73.600824879165,
-        73.589575230785, 73.578325582405, 73.567075934025, 73.555826285646, 73.544576637266, 73.533326988885,
-        73.522077340505, 73.510827692125, 73.499578043745, 73.488328395364, 73.477078746984, 73.465829098603,
-        73.454579450222, 73.443329801842, 73.432080153461, 73.420830505080, 73.409580856699, 73.398331208318,
-        73.387081559936, 73.375831911555, 73.364582263174, 73.353332614792, 73.342082966410, 73.330833318029,
-        73.319583669647, 73.308334021265, 73.297084372883, 73.285834724501, 73.274585076119, 73.263335427737,
-        73.252085779354, 73.240836130972, 73.229586482590, 73.218336834207, 73.207087185824, 73.195837537442,
-        73.184587889059, 73.173338240676, 73.162088592293, 73.150838943910, 73.139589295527, 73.128339647144,
-        73.117089998760, 73.105840350377, 73.094590701993, 73.083341053610, 73.072091405226, 73.060841756842,
-        73.049592108459, 73.038342460075, 73.027092811691, 73.015843163307, 73.004593514922, 72.993343866538,
-        72.982094218154, 72.970844569769, 72.959594921385, 72.948345273000, 72.937095624616, 72.925845976231,
-        72.914596327846, 72.903346679461, 72.892097031076, 72.880847382691, 72.869597734306, 72.858348085921,
-        72.847098437536, 72.835848789150, 72.824599140765, 72.813349492379, 72.802099843994, 72.790850195608,
-        72.779600547222, 72.768350898836, 72.757101250450, 72.745851602064, 72.734601953678, 72.723352305292,
-        72.712102656906, 72.700853008520, 72.689603360133, 72.678353711747, 72.667104063360, 72.655854414973,
-        72.644604766587, 72.633355118200, 72.622105469813, 72.610855821426, 72.599606173039, 72.588356524652,
-        72.577106876265, 72.565857227878, 72.554607579490, 72.543357931103, 72.532108282715, 72.520858634328,
-        72.509608985940, 72.498359337552, 72.487109689165, 72.475860040777, 72.464610392389, 72.453360744001,
-        72.442111095613, 72.430861447224, 72.419611798836, 72.408362150448, 72.397112502060, 72.385862853671,
-        72.374613205283, 72.363363556894, 72.352113908505, 72.340864260116, 72.329614611728, 72.318364963339,
-        72.307115314950, 72.295865666561, 72.284616018172, 72.273366369782, 72.262116721393, 72.250867073004,
-        72.239617424614, 72.228367776225, 72.217118127835, 72.205868479446, 72.194618831056, 72.183369182666,
-        72.172119534276, 72.160869885886, 72.149620237496, 72.138370589106, 72.127120940716, 72.115871292326,
-        72.104621643936, 72.093371995545, 72.082122347155, 72.070872698764, 72.059623050374, 72.048373401983,
-        72.037123753593, 72.025874105202, 72.014624456811, 72.003374808420, 71.992125160029, 71.980875511638,
-        71.969625863247, 71.958376214856, 71.947126566464, 71.935876918073, 71.924627269682, 71.913377621290,
-        71.902127972899, 71.890878324507, 71.879628676115, 71.868379027724, 71.857129379332, 71.845879730940,
-        71.834630082548, 71.823380434156, 71.812130785764, 71.800881137372, 71.789631488980, 71.778381840587,
-        71.767132192195, 71.755882543803, 71.744632895410, 71.733383247018, 71.722133598625, 71.710883950232,
-        71.699634301840, 71.688384653447, 71.677135005054, 71.665885356661, 71.654635708268, 71.643386059875,
-        71.632136411482, 71.620886763088, 71.609637114695, 71.598387466302, 71.587137817908, 71.575888169515,
-        71.564638521121, 71.553388872728, 71.542139224334, 71.530889575941, 71.519639927547, 71.508390279153,
-        71.497140630759, 71.485890982365, 71.474641333971, 71.463391685577, 71.452142037183, 71.440892388788,
-        71.429642740394, 71.418393092000, 71.407143443605, 71.395893795211, 71.384644146816, 71.373394498422,
-        71.362144850027, 71.350895201632, 71.339645553237, 71.328395904843, 71.317146256448, 71.305896608053,
-        71.294646959658, 71.283397311263, 71.272147662867, 71.260898014472, 71.249648366077, 71.238398717681,
-        71.227149069286, 71.215899420891, 71.204649772495, 71.193400124099, 71.182150475704, 71.170900827308,
-        71.159651178912, 71.148401530516, 71.137151882120, 71.125902233725, 71.114652585328, 71.103402936932,
-        71.092153288536, 71.080903640140, 71.069653991744, 71.058404343347, 71.047154694951, 71.035905046555,
-        71.024655398158, 71.013405749762, 71.002156101365, 70.990906452968, 70.979656804571, 70.968407156175,
-        70.957157507778, 70.945907859381, 70.934658210984, 70.923408562587, 70.912158914190, 70.900909265793,
-        70.889659617395, 70.878409968998, 70.867160320601, 70.855910672203, 70.844661023806, 70.833411375409,
-        70.822161727011, 70.810912078613, 70.799662430216, 70.788412781818, 70.777163133420, 70.765913485022,
-        70.754663836624, 70.743414188226, 70.732164539828, 70.720914891430, 70.709665243032, 70.698415594634,
-        70.687165946236, 70.675916297837, 70.664666649439, 70.653417001041, 70.642167352642, 70.630917704244,
-        70.619668055845, 70.608418407447, 70.597168759048, 70.585919110649, 70.574669462250, 70.563419813851,
-        70.552170165453, 70.540920517054, 70.529670868655, 70.518421220255, 70.507171571856, 70.495921923457,
-        70.484672275058, 70.473422626659, 70.462172978259, 70.450923329860, 70.439673681460, 70.428424033061,
-        70.417174384661, 70.405924736262, 70.394675087862, 70.383425439462, 70.372175791063, 70.360926142663,
-        70.349676494263, 70.338426845863, 70.327177197463, 70.315927549063, 70.304677900663, 70.293428252263,
-        70.282178603862, 70.270928955462, 70.259679307062, 70.248429658661, 70.237180010261, 70.225930361861,
-        70.214680713460, 70.203431065059, 70.192181416659, 70.180931768258, 70.169682119857, 70.158432471457,
-        70.147182823056, 70.135933174655, 70.124683526254, 70.113433877853, 70.102184229452, 70.090934581051,
-        70.079684932650, 70.068435284248, 70.057185635847, 70.045935987446, 70.034686339045, 70.023436690643,
-        70.012187042242, 70.000937393840, 69.989687745439, 69.978438097037, 69.967188448635, 69.955938800234,
-        69.944689151832, 69.933439503430, 69.922189855028, 69.910940206626, 69.899690558224, 69.888440909822,
-        69.877191261420, 69.865941613018, 69.854691964616, 69.843442316214, 69.832192667812, 69.820943019409,
-        69.809693371007, 69.798443722605, 69.787194074202, 69.775944425800, 69.764694777397, 69.753445128995,
-        69.742195480592, 69.730945832189, 69.719696183786, 69.708446535384, 69.697196886981, 69.685947238578,
-        69.674697590175, 69.663447941772, 69.652198293369, 69.640948644966, 69.629698996563, 69.618449348160,
-        69.607199699756, 69.595950051353, 69.584700402950, 69.573450754546, 69.562201106143, 69.550951457740,
-        69.539701809336, 69.528452160932, 69.517202512529, 69.505952864125, 69.494703215722, 69.483453567318,
-        69.472203918914, 69.460954270510, 69.449704622106, 69.438454973702, 69.427205325298, 69.415955676894,
-        69.404706028490, 69.393456380086, 69.382206731682, 69.370957083278, 69.359707434873, 69.348457786469,
-        69.337208138065, 69.325958489660, 69.314708841256, 69.303459192851, 69.292209544447, 69.280959896042,
-        69.269710247638, 69.258460599233, 69.247210950828, 69.235961302424, 69.224711654019, 69.213462005614,
-        69.202212357209, 69.190962708804, 69.179713060399, 69.168463411994, 69.157213763589, 69.145964115184,
-        69.134714466779, 69.123464818373, 69.112215169968, 69.100965521563, 69.089715873158, 69.078466224752,
-        69.067216576347, 69.055966927941, 69.044717279536, 69.033467631130, 69.022217982725, 69.010968334319,
-        68.999718685913, 68.988469037508, 68.977219389102, 68.965969740696, 68.954720092290, 68.943470443884,
-        68.932220795478, 68.920971147072, 68.909721498666, 68.898471850260, 68.887222201854, 68.875972553448,
-        68.864722905042, 68.853473256635, 68.842223608229, 68.830973959823, 68.819724311416, 68.808474663010,
-        68.797225014603, 68.785975366197, 68.774725717790, 68.763476069384, 68.752226420977, 68.740976772570,
-        68.729727124164, 68.718477475757, 68.707227827350, 68.695978178943, 68.684728530536, 68.673478882129,
-        68.662229233722, 68.650979585315, 68.639729936908, 68.628480288501, 68.617230640094, 68.605980991687,
-        68.594731343280, 68.583481694872, 68.572232046465, 68.560982398058, 68.549732749650, 68.538483101243,
-        68.527233452835, 68.515983804428, 68.504734156020, 68.493484507613, 68.482234859205, 68.470985210797,
-        68.459735562390, 68.448485913982, 68.437236265574, 68.425986617166, 68.414736968758, 68.403487320350,
-        68.392237671942, 68.380988023534, 68.369738375126, 68.358488726718, 68.347239078310, 68.335989429902,
-        68.324739781494, 68.313490133086, 68.302240484677, 68.290990836269, 68.279741187861, 68.268491539452,
-        68.257241891044, 68.245992242635, 68.234742594227, 68.223492945818, 68.212243297410, 68.200993649001,
-        68.189744000592, 68.178494352184, 68.167244703775, 68.155995055366, 68.144745406957, 68.133495758548,
-        68.122246110139, 68.110996461731, 68.099746813322, 68.088497164913, 68.077247516503, 68.065997868094,
-        68.054748219685, 68.043498571276, 68.032248922867, 68.020999274458, 68.009749626048, 67.998499977639,
-        67.987250329230, 67.976000680820, 67.964751032411, 67.953501384001, 67.942251735592, 67.931002087182,
-        67.919752438773, 67.908502790363, 67.897253141953, 67.886003493544, 67.874753845134, 67.863504196724,
-        67.852254548314, 67.841004899904, 67.829755251494, 67.818505603085, 67.807255954675, 67.796006306265,
-        67.784756657854, 67.773507009444, 67.762257361034, 67.751007712624, 67.739758064214, 67.728508415804,
-        67.717258767393, 67.706009118983, 67.694759470573, 67.683509822162, 67.672260173752, 67.661010525342,
-        67.649760876931, 67.638511228521, 67.627261580110, 67.616011931699, 67.604762283289, 67.593512634878,
-        67.582262986467, 67.571013338057, 67.559763689646, 67.548514041235, 67.537264392824, 67.526014744413,
-        67.514765096002, 67.503515447592, 67.492265799181, 67.481016150770, 67.469766502358, 67.458516853947,
-        67.447267205536, 67.436017557125, 67.424767908714, 67.413518260303, 67.402268611891, 67.391018963480,
-        67.379769315069, 67.368519666657, 67.357270018246, 67.346020369834, 67.334770721423, 67.323521073012,
-        67.312271424600, 67.301021776188, 67.289772127777, 67.278522479365, 67.267272830953, 67.256023182542,
-        67.244773534130, 67.233523885718, 67.222274237306, 67.211024588894, 67.199774940483, 67.188525292071,
-        67.177275643659, 67.166025995247, 67.154776346835, 67.143526698423, 67.132277050010, 67.121027401598,
-        67.109777753186, 67.098528104774, 67.087278456362, 67.076028807950, 67.064779159537, 67.053529511125,
-        67.042279862713, 67.031030214300, 67.019780565888, 67.008530917475, 66.997281269063, 66.986031620650,
-        66.974781972238, 66.963532323825, 66.952282675412, 66.941033027000, 66.929783378587, 66.918533730174,
-        66.907284081762, 66.896034433349, 66.884784784936, 66.873535136523, 66.862285488110, 66.851035839697,
-        66.839786191284, 66.828536542871, 66.817286894458, 66.806037246045, 66.794787597632, 66.783537949219,
-        66.772288300806, 66.761038652393, 66.749789003979, 66.738539355566, 66.727289707153, 66.716040058740,
-        66.704790410326, 66.693540761913, 66.682291113499, 66.671041465086, 66.659791816672, 66.648542168259,
-        66.637292519845, 66.626042871432, 66.614793223018, 66.603543574605, 66.592293926191, 66.581044277777,
-        66.569794629363, 66.558544980950, 66.547295332536, 66.536045684122, 66.524796035708, 66.513546387294,
-        66.502296738880, 66.491047090466, 66.479797442053, 66.468547793638, 66.457298145224, 66.446048496810,
-        66.434798848396, 66.423549199982, 66.412299551568, 66.401049903154, 66.389800254740, 66.378550606325,
-        66.367300957911, 66.356051309497, 66.344801661082, 66.333552012668, 66.322302364254, 66.311052715839,
-        66.299803067425, 66.288553419010, 66.277303770596, 66.266054122181, 66.254804473766, 66.243554825352,
-        66.232305176937, 66.221055528522, 66.209805880108, 66.198556231693, 66.187306583278, 66.176056934863,
-        66.164807286449, 66.153557638034, 66.142307989619, 66.131058341204, 66.119808692789, 66.108559044374,
-        66.097309395959, 66.086059747544, 66.074810099129, 66.063560450714, 66.052310802299, 66.041061153883,
-        66.029811505468, 66.018561857053, 66.007312208638, 65.996062560222, 65.984812911807, 65.973563263392,
-        65.962313614976, 65.951063966561, 65.939814318146, 65.928564669730, 65.917315021315, 65.906065372899,
-        65.894815724484, 65.883566076068, 65.872316427652, 65.861066779237, 65.849817130821, 65.838567482405,
-        65.827317833990, 65.816068185574, 65.804818537158, 65.793568888742, 65.782319240327, 65.771069591911,
-        65.759819943495, 65.748570295079, 65.737320646663, 65.726070998247, 65.714821349831, 65.703571701415,
-        65.692322052999, 65.681072404583, 65.669822756167, 65.658573107751, 65.647323459334, 65.636073810918,
-        65.624824162502, 65.613574514086, 65.602324865669, 65.591075217253, 65.579825568837, 65.568575920420,
-        65.557326272004, 65.546076623588, 65.534826975171, 65.523577326755, 65.512327678338, 65.501078029922,
-        65.489828381505, 65.478578733089, 65.467329084672, 65.456079436255, 65.444829787839, 65.433580139422,
-        65.422330491005, 65.411080842588, 65.399831194172, 65.388581545755, 65.377331897338, 65.366082248921,
-        65.354832600504, 65.343582952087, 65.332333303670, 65.321083655253, 65.309834006837, 65.298584358419,
-        65.287334710002, 65.276085061585, 65.264835413168, 65.253585764751, 65.242336116334, 65.231086467917,
-        65.219836819500, 65.208587171082, 65.197337522665, 65.186087874248, 65.174838225830, 65.163588577413,
-        65.152338928996, 65.141089280578, 65.129839632161, 65.118589983744, 65.107340335326, 65.096090686909,
-        65.084841038491, 65.073591390073, 65.062341741656, 65.051092093238, 65.039842444821, 65.028592796403,
-        65.017343147985, 65.006093499568, 64.994843851150, 64.983594202732, 64.972344554314, 64.961094905897,
-        64.949845257479, 64.938595609061, 64.927345960643, 64.916096312225, 64.904846663807, 64.893597015389,
-        64.882347366971, 64.871097718553, 64.859848070135, 64.848598421717, 64.837348773299, 64.826099124881,
-        64.814849476463, 64.803599828045, 64.792350179626, 64.781100531208, 64.769850882790, 64.758601234372,
-        64.747351585953, 64.736101937535, 64.724852289117, 64.713602640698, 64.702352992280, 64.691103343861,
-        64.679853695443, 64.668604047025, 64.657354398606, 64.646104750188, 64.634855101769, 64.623605453350,
-        64.612355804932, 64.601106156513, 64.589856508095, 64.578606859676, 64.567357211257, 64.556107562839,
-        64.544857914420, 64.533608266001, 64.522358617582, 64.511108969163, 64.499859320745, 64.488609672326,
-        64.477360023907, 64.466110375488, 64.454860727069, 64.443611078650, 64.432361430231, 64.421111781812,
-        64.409862133393, 64.398612484974, 64.387362836555, 64.376113188136, 64.364863539717, 64.353613891297,
-        64.342364242878, 64.331114594459, 64.319864946040, 64.308615297621, 64.297365649201, 64.286116000782,
-        64.274866352363, 64.263616703943, 64.252367055524, 64.241117407105, 64.229867758685, 64.218618110266,
-        64.207368461846, 64.196118813427, 64.184869165007, 64.173619516588, 64.162369868168, 64.151120219749,
-        64.139870571329, 64.128620922909, 64.117371274490, 64.106121626070, 64.094871977650, 64.083622329231,
-        64.072372680811, 64.061123032391, 64.049873383971, 64.038623735552, 64.027374087132, 64.016124438712,
-        64.004874790292, 63.993625141872, 63.982375493452, 63.971125845032, 63.959876196612, 63.948626548192,
-        63.937376899772, 63.926127251352, 63.914877602932, 63.903627954512, 63.892378306092, 63.881128657672,
-        63.869879009252, 63.858629360831, 63.847379712411, 63.836130063991, 63.824880415571, 63.813630767150,
-        63.802381118730, 63.791131470310, 63.779881821890, 63.768632173469, 63.757382525049, 63.746132876628,
-        63.734883228208, 63.723633579788, 63.712383931367, 63.701134282947, 63.689884634526, 63.678634986106,
-        63.667385337685, 63.656135689264, 63.644886040844, 63.633636392423, 63.622386744002, 63.611137095582,
-        63.599887447161, 63.588637798740, 63.577388150320, 63.566138501899, 63.554888853478, 63.543639205057,
-        63.532389556636, 63.521139908216, 63.509890259795, 63.498640611374, 63.487390962953, 63.476141314532,
-        63.464891666111, 63.453642017690, 63.442392369269, 63.431142720848, 63.419893072427, 63.408643424006,
-        63.397393775585, 63.386144127164, 63.374894478743, 63.363644830322, 63.352395181900, 63.341145533479,
-        63.329895885058, 63.318646236637, 63.307396588215, 63.296146939794, 63.284897291373, 63.273647642952,
-        63.262397994530, 63.251148346109, 63.239898697688, 63.228649049266, 63.217399400845, 63.206149752423,
-        63.194900104002, 63.183650455580, 63.172400807159, 63.161151158737, 63.149901510316, 63.138651861894,
-        63.127402213473, 63.116152565051, 63.104902916629, 63.093653268208, 63.082403619786, 63.071153971364,
-        63.059904322943, 63.048654674521, 63.037405026099, 63.026155377677, 63.014905729255, 63.003656080834,
-        62.992406432412, 62.981156783990, 62.969907135568, 62.958657487146, 62.947407838724, 62.936158190302,
-        62.924908541880, 62.913658893458, 62.902409245036, 62.891159596614, 62.879909948192, 62.868660299770,
-        62.857410651348, 62.846161002926, 62.834911354504, 62.823661706082, 62.812412057660, 62.801162409237,
-        62.789912760815, 62.778663112393, 62.767413463971, 62.756163815548, 62.744914167126, 62.733664518704,
-        62.722414870282, 62.711165221859, 62.699915573437, 62.688665925014, 62.677416276592, 62.666166628170,
-        62.654916979747, 62.643667331325, 62.632417682902, 62.621168034480, 62.609918386057, 62.598668737635,
-        62.587419089212, 62.576169440790, 62.564919792367, 62.553670143944, 62.542420495522, 62.531170847099,
-        62.519921198676, 62.508671550254, 62.497421901831, 62.486172253408, 62.474922604985, 62.463672956563,
-        62.452423308140, 62.441173659717, 62.429924011294, 62.418674362871, 62.407424714448, 62.396175066026,
-        62.384925417603, 62.373675769180, 62.362426120757, 62.351176472334, 62.339926823911, 62.328677175488,
-        62.317427527065, 62.306177878642, 62.294928230219, 62.283678581796, 62.272428933372, 62.261179284949,
-        62.249929636526, 62.238679988103, 62.227430339680, 62.216180691257, 62.204931042833, 62.193681394410,
-        62.182431745987, 62.171182097564, 62.159932449140, 62.148682800717, 62.137433152294, 62.126183503870,
-        62.114933855447, 62.103684207024, 62.092434558600, 62.081184910177, 62.069935261753, 62.058685613330,
-        62.047435964906, 62.036186316483, 62.024936668059, 62.013687019636, 62.002437371212, 61.991187722789,
-        61.979938074365, 61.968688425942, 61.957438777518, 61.946189129094, 61.934939480671, 61.923689832247,
-        61.912440183823, 61.901190535400, 61.889940886976, 61.878691238552, 61.867441590128, 61.856191941705,
-        61.844942293281, 61.833692644857, 61.822442996433, 61.811193348009, 61.799943699585, 61.788694051161,
-        61.777444402737, 61.766194754314, 61.754945105890, 61.743695457466, 61.732445809042, 61.721196160618,
-        61.709946512194, 61.698696863770, 61.687447215346, 61.676197566921, 61.664947918497, 61.653698270073,
-        61.642448621649, 61.631198973225, 61.619949324801, 61.608699676377, 61.597450027952, 61.586200379528,
-        61.574950731104, 61.563701082680, 61.552451434255, 61.541201785831, 61.529952137407, 61.518702488982,
-        61.507452840558, 61.496203192134, 61.484953543709, 61.473703895285, 61.462454246861, 61.451204598436,
-        61.439954950012, 61.428705301587, 61.417455653163, 61.406206004738, 61.394956356314, 61.383706707889,
-        61.372457059465, 61.361207411040, 61.349957762616, 61.338708114191, 61.327458465766, 61.316208817342,
-        61.304959168917, 61.293709520492, 61.282459872068, 61.271210223643, 61.259960575218, 61.248710926794,
-        61.237461278369, 61.226211629944, 61.214961981519, 61.203712333094, 61.192462684670, 61.181213036245,
-        61.169963387820, 61.158713739395, 61.147464090970, 61.136214442545, 61.124964794120, 61.113715145695,
-        61.102465497270, 61.091215848845, 61.079966200420, 61.068716551995, 61.057466903570, 61.046217255145,
-        61.034967606720, 61.023717958295, 61.012468309870, 61.001218661445, 60.989969013020, 60.978719364595,
-        60.967469716170, 60.956220067744, 60.944970419319, 60.933720770894, 60.922471122469, 60.911221474044,
-        60.899971825618, 60.888722177193, 60.877472528768, 60.866222880342, 60.854973231917, 60.843723583492,
-        60.832473935066, 60.821224286641, 60.809974638216, 60.798724989790, 60.787475341365, 60.776225692939,
-        60.764976044514, 60.753726396089, 60.742476747663, 60.731227099238, 60.719977450812, 60.708727802386,
-        60.697478153961, 60.686228505535, 60.674978857110, 60.663729208684, 60.652479560259, 60.641229911833,
-        60.629980263407, 60.618730614982, 60.607480966556, 60.596231318130, 60.584981669705, 60.573732021279,
-        60.562482372853, 60.551232724427, 60.539983076002, 60.528733427576, 60.517483779150, 60.506234130724,
-        60.494984482298, 60.483734833873, 60.472485185447, 60.461235537021, 60.449985888595, 60.438736240169,
-        60.427486591743, 60.416236943317, 60.404987294891, 60.393737646465, 60.382487998039, 60.371238349613,
-        60.359988701187, 60.348739052761, 60.337489404335, 60.326239755909, 60.314990107483, 60.303740459057,
-        60.292490810631, 60.281241162205, 60.269991513778, 60.258741865352, 60.247492216926, 60.236242568500,
-        60.224992920074, 60.213743271647, 60.202493623221, 60.191243974795, 60.179994326369, 60.168744677942,
-        60.157495029516, 60.146245381090, 60.134995732663, 60.123746084237, 60.112496435811, 60.101246787384,
-        60.089997138958, 60.078747490532, 60.067497842105, 60.056248193679, 60.044998545252, 60.033748896826,
-        60.022499248399, 60.011249599973, 59.999999951546, 59.988750303120, 59.977500654693, 59.966251006267,
-        59.955001357840, 59.943751709414, 59.932502060987, 59.921252412560, 59.910002764134, 59.898753115707,
-        59.887503467280, 59.876253818854, 59.865004170427, 59.853754522000, 59.842504873574, 59.831255225147,
-        59.820005576720, 59.808755928293, 59.797506279867, 59.786256631440, 59.775006983013, 59.763757334586,
-        59.752507686159, 59.741258037733, 59.730008389306, 59.718758740879, 59.707509092452, 59.696259444025,
-        59.685009795598, 59.673760147171, 59.662510498744, 59.651260850317, 59.640011201890, 59.628761553463,
-        59.617511905036, 59.606262256609, 59.595012608182, 59.583762959755, 59.572513311328, 59.561263662901,
-        59.550014014474, 59.538764366047, 59.527514717620, 59.516265069193, 59.505015420765, 59.493765772338,
-        59.482516123911, 59.471266475484, 59.460016827057, 59.448767178630, 59.437517530202, 59.426267881775,
-        59.415018233348, 59.403768584920, 59.392518936493, 59.381269288066, 59.370019639639, 59.358769991211,
-        59.347520342784, 59.336270694357, 59.325021045929, 59.313771397502, 59.302521749074, 59.291272100647,
-        59.280022452220, 59.268772803792, 59.257523155365, 59.246273506937, 59.235023858510, 59.223774210082,
-        59.212524561655, 59.201274913227, 59.190025264800, 59.178775616372, 59.167525967944, 59.156276319517,
-        59.145026671089, 59.133777022662, 59.122527374234, 59.111277725806, 59.100028077379, 59.088778428951,
-        59.077528780523, 59.066279132096, 59.055029483668, 59.043779835240, 59.032530186813, 59.021280538385,
-        59.010030889957, 58.998781241529, 58.987531593101, 58.976281944674, 58.965032296246, 58.953782647818,
-        58.942532999390, 58.931283350962, 58.920033702534, 58.908784054107, 58.897534405679, 58.886284757251,
-        58.875035108823, 58.863785460395, 58.852535811967, 58.841286163539, 58.830036515111, 58.818786866683,
-        58.807537218255, 58.796287569827, 58.785037921399, 58.773788272971, 58.762538624543, 58.751288976115,
-        58.740039327687, 58.728789679259, 58.717540030831, 58.706290382402, 58.695040733974, 58.683791085546,
-        58.672541437118, 58.661291788690, 58.650042140262, 58.638792491833, 58.627542843405, 58.616293194977,
-        58.605043546549, 58.593793898120, 58.582544249692, 58.571294601264, 58.560044952836, 58.548795304407,
-        58.537545655979, 58.526296007551, 58.515046359122, 58.503796710694, 58.492547062266, 58.481297413837,
-        58.470047765409, 58.458798116980, 58.447548468552, 58.436298820124, 58.425049171695, 58.413799523267,
-        58.402549874838, 58.391300226410, 58.380050577981, 58.368800929553, 58.357551281124, 58.346301632696,
-        58.335051984267, 58.323802335839, 58.312552687410, 58.301303038981, 58.290053390553, 58.278803742124,
-        58.267554093696, 58.256304445267, 58.245054796838, 58.233805148410, 58.222555499981, 58.211305851552,
-        58.200056203124, 58.188806554695, 58.177556906266, 58.166307257837, 58.155057609409, 58.143807960980,
-        58.132558312551, 58.121308664122, 58.110059015694, 58.098809367265, 58.087559718836, 58.076310070407,
-        58.065060421978, 58.053810773549, 58.042561125120, 58.031311476692, 58.020061828263, 58.008812179834,
-        57.997562531405, 57.986312882976, 57.975063234547, 57.963813586118, 57.952563937689, 57.941314289260,
-        57.930064640831, 57.918814992402, 57.907565343973, 57.896315695544, 57.885066047115, 57.873816398686,
-        57.862566750257, 57.851317101828, 57.840067453399, 57.828817804970, 57.817568156540, 57.806318508111,
-        57.795068859682, 57.783819211253, 57.772569562824, 57.761319914395, 57.750070265965, 57.738820617536,
-        57.727570969107, 57.716321320678, 57.705071672249, 57.693822023819, 57.682572375390, 57.671322726961,
-        57.660073078532, 57.648823430102, 57.637573781673, 57.626324133244, 57.615074484814, 57.603824836385,
-        57.592575187956, 57.581325539526, 57.570075891097, 57.558826242667, 57.547576594238, 57.536326945809,
-        57.525077297379, 57.513827648950, 57.502578000520, 57.491328352091, 57.480078703661, 57.468829055232,
-        57.457579406802, 57.446329758373, 57.435080109943, 57.423830461514, 57.412580813084, 57.401331164655,
-        57.390081516225, 57.378831867796, 57.367582219366, 57.356332570936, 57.345082922507, 57.333833274077,
-        57.322583625647, 57.311333977218, 57.300084328788, 57.288834680358, 57.277585031929, 57.266335383499,
-        57.255085735069, 57.243836086640, 57.232586438210, 57.221336789780, 57.210087141350, 57.198837492921,
-        57.187587844491, 57.176338196061, 57.165088547631, 57.153838899202, 57.142589250772, 57.131339602342,
-        57.120089953912, 57.108840305482, 57.097590657052, 57.086341008622, 57.075091360193, 57.063841711763,
-        57.052592063333, 57.041342414903, 57.030092766473, 57.018843118043, 57.007593469613, 56.996343821183,
-        56.985094172753, 56.973844524323, 56.962594875893, 56.951345227463, 56.940095579033, 56.928845930603,
-        56.917596282173, 56.906346633743, 56.895096985313, 56.883847336883, 56.872597688453, 56.861348040023,
-        56.850098391592, 56.838848743162, 56.827599094732, 56.816349446302, 56.805099797872, 56.793850149442,
-        56.782600501011, 56.771350852581, 56.760101204151, 56.748851555721, 56.737601907291, 56.726352258860,
-        56.715102610430, 56.703852962000, 56.692603313570, 56.681353665139, 56.670104016709, 56.658854368279,
-        56.647604719849, 56.636355071418, 56.625105422988, 56.613855774558, 56.602606126127, 56.591356477697,
-        56.580106829266, 56.568857180836, 56.557607532406, 56.546357883975, 56.535108235545, 56.523858587114,
-        56.512608938684, 56.501359290254, 56.490109641823, 56.478859993393, 56.467610344962, 56.456360696532,
-        56.445111048101, 56.433861399671, 56.422611751240, 56.411362102810, 56.400112454379, 56.388862805948,
-        56.377613157518, 56.366363509087, 56.355113860657, 56.343864212226, 56.332614563796, 56.321364915365,
-        56.310115266934, 56.298865618504, 56.287615970073, 56.276366321642, 56.265116673212, 56.253867024781,
-        56.242617376350, 56.231367727920, 56.220118079489, 56.208868431058, 56.197618782627, 56.186369134197,
-        56.175119485766, 56.163869837335, 56.152620188904, 56.141370540474, 56.130120892043, 56.118871243612,
-        56.107621595181, 56.096371946750, 56.085122298319, 56.073872649889, 56.062623001458, 56.051373353027,
-        56.040123704596, 56.028874056165, 56.017624407734, 56.006374759303, 55.995125110872, 55.983875462441,
-        55.972625814011, 55.961376165580, 55.950126517149, 55.938876868718, 55.927627220287, 55.916377571856,
-        55.905127923425, 55.893878274994, 55.882628626563, 55.871378978132, 55.860129329701, 55.848879681270,
-        55.837630032838, 55.826380384407, 55.815130735976, 55.803881087545, 55.792631439114, 55.781381790683,
-        55.770132142252, 55.758882493821, 55.747632845390, 55.736383196958, 55.725133548527, 55.713883900096,
-        55.702634251665, 55.691384603234, 55.680134954803, 55.668885306371, 55.657635657940, 55.646386009509,
-        55.635136361078, 55.623886712646, 55.612637064215, 55.601387415784, 55.590137767353, 55.578888118921,
-        55.567638470490, 55.556388822059, 55.545139173627, 55.533889525196, 55.522639876765, 55.511390228333,
-        55.500140579902, 55.488890931471, 55.477641283039, 55.466391634608, 55.455141986176, 55.443892337745,
-        55.432642689314, 55.421393040882, 55.410143392451, 55.398893744019, 55.387644095588, 55.376394447156,
-        55.365144798725, 55.353895150293, 55.342645501862, 55.331395853430, 55.320146204999, 55.308896556567,
-        55.297646908136, 55.286397259704, 55.275147611273, 55.263897962841, 55.252648314410, 55.241398665978,
-        55.230149017546, 55.218899369115, 55.207649720683, 55.196400072252, 55.185150423820, 55.173900775388,
-        55.162651126957, 55.151401478525, 55.140151830093, 55.128902181662, 55.117652533230, 55.106402884798,
-        55.095153236367, 55.083903587935, 55.072653939503, 55.061404291071, 55.050154642640, 55.038904994208,
-        55.027655345776, 55.016405697344, 55.005156048913, 54.993906400481, 54.982656752049, 54.971407103617,
-        54.960157455185, 54.948907806754, 54.937658158322, 54.926408509890, 54.915158861458, 54.903909213026,
-        54.892659564594, 54.881409916162, 54.870160267730, 54.858910619299, 54.847660970867, 54.836411322435,
-        54.825161674003, 54.813912025571, 54.802662377139, 54.791412728707, 54.780163080275, 54.768913431843,
-        54.757663783411, 54.746414134979, 54.735164486547, 54.723914838115, 54.712665189683, 54.701415541251,
-        54.690165892819, 54.678916244387, 54.667666595955, 54.656416947523, 54.645167299091, 54.633917650659,
-        54.622668002226, 54.611418353794, 54.600168705362, 54.588919056930, 54.577669408498, 54.566419760066,
-        54.555170111634, 54.543920463202, 54.532670814769, 54.521421166337, 54.510171517905, 54.498921869473,
-        54.487672221041, 54.476422572608, 54.465172924176, 54.453923275744, 54.442673627312, 54.431423978879,
-        54.420174330447, 54.408924682015, 54.397675033583, 54.386425385150, 54.375175736718, 54.363926088286,
-        54.352676439853, 54.341426791421, 54.330177142989, 54.318927494557, 54.307677846124, 54.296428197692,
-        54.285178549259, 54.273928900827, 54.262679252395, 54.251429603962, 54.240179955530, 54.228930307097,
-        54.217680658665, 54.206431010233, 54.195181361800, 54.183931713368, 54.172682064935, 54.161432416503,
-        54.150182768070, 54.138933119638, 54.127683471205, 54.116433822773, 54.105184174340, 54.093934525908,
-        54.082684877475, 54.071435229043, 54.060185580610, 54.048935932178, 54.037686283745, 54.026436635313,
-        54.015186986880, 54.003937338448, 53.992687690015, 53.981438041582, 53.970188393150, 53.958938744717,
-        53.947689096284, 53.936439447852, 53.925189799419, 53.913940150987, 53.902690502554, 53.891440854121,
-        53.880191205689, 53.868941557256, 53.857691908823, 53.846442260391, 53.835192611958, 53.823942963525,
-        53.812693315092, 53.801443666660, 53.790194018227, 53.778944369794, 53.767694721361, 53.756445072929,
-        53.745195424496, 53.733945776063, 53.722696127630, 53.711446479197, 53.700196830765, 53.688947182332,
-        53.677697533899, 53.666447885466, 53.655198237033, 53.643948588600, 53.632698940168, 53.621449291735,
-        53.610199643302, 53.598949994869, 53.587700346436, 53.576450698003, 53.565201049570, 53.553951401137,
-        53.542701752704, 53.531452104271, 53.520202455839, 53.508952807406, 53.497703158973, 53.486453510540,
-        53.475203862107, 53.463954213674, 53.452704565241, 53.441454916808, 53.430205268375, 53.418955619942,
-        53.407705971509, 53.396456323076, 53.385206674643, 53.373957026210, 53.362707377776, 53.351457729343,
-        53.340208080910, 53.328958432477, 53.317708784044, 53.306459135611, 53.295209487178, 53.283959838745,
-        53.272710190312, 53.261460541879, 53.250210893445, 53.238961245012, 53.227711596579, 53.216461948146,
-        53.205212299713, 53.193962651280, 53.182713002846, 53.171463354413, 53.160213705980, 53.148964057547,
-        53.137714409114, 53.126464760680, 53.115215112247, 53.103965463814, 53.092715815381, 53.081466166947,
-        53.070216518514, 53.058966870081, 53.047717221648, 53.036467573214, 53.025217924781, 53.013968276348,
-        53.002718627914, 52.991468979481, 52.980219331048, 52.968969682614, 52.957720034181, 52.946470385748,
-        52.935220737314, 52.923971088881, 52.912721440448, 52.901471792014, 52.890222143581, 52.878972495147,
-        52.867722846714, 52.856473198281, 52.845223549847, 52.833973901414, 52.822724252980, 52.811474604547,
-        52.800224956113, 52.788975307680, 52.777725659246, 52.766476010813, 52.755226362379, 52.743976713946,
-        52.732727065512, 52.721477417079, 52.710227768645, 52.698978120212, 52.687728471778, 52.676478823345,
-        52.665229174911, 52.653979526478, 52.642729878044, 52.631480229611, 52.620230581177, 52.608980932743,
-        52.597731284310, 52.586481635876, 52.575231987443, 52.563982339009, 52.552732690575, 52.541483042142,
-        52.530233393708, 52.518983745274, 52.507734096841, 52.496484448407, 52.485234799973, 52.473985151540,
-        52.462735503106, 52.451485854672, 52.440236206239, 52.428986557805, 52.417736909371, 52.406487260938,
-        52.395237612504, 52.383987964070, 52.372738315636, 52.361488667203, 52.350239018769, 52.338989370335,
-        52.327739721901, 52.316490073467, 52.305240425034, 52.293990776600, 52.282741128166, 52.271491479732,
-        52.260241831298, 52.248992182865, 52.237742534431, 52.226492885997, 52.215243237563, 52.203993589129,
-        52.192743940695, 52.181494292262, 52.170244643828, 52.158994995394, 52.147745346960, 52.136495698526,
-        52.125246050092, 52.113996401658, 52.102746753224, 52.091497104790, 52.080247456356, 52.068997807922,
-        52.057748159488, 52.046498511054, 52.035248862620, 52.023999214187, 52.012749565753, 52.001499917319,
-        51.990250268885, 51.979000620451, 51.967750972017, 51.956501323583, 51.945251675148, 51.934002026714,
-        51.922752378280, 51.911502729846, 51.900253081412, 51.889003432978, 51.877753784544, 51.866504136110,
-        51.855254487676, 51.844004839242, 51.832755190808, 51.821505542374, 51.810255893940, 51.799006245505,
-        51.787756597071, 51.776506948637, 51.765257300203, 51.754007651769, 51.742758003335, 51.731508354901,
-        51.720258706466, 51.709009058032, 51.697759409598, 51.686509761164, 51.675260112730, 51.664010464295,
-        51.652760815861, 51.641511167427, 51.630261518993, 51.619011870559, 51.607762222124, 51.596512573690,
-        51.585262925256, 51.574013276822, 51.562763628387, 51.551513979953, 51.540264331519, 51.529014683084,
-        51.517765034650, 51.506515386216, 51.495265737782, 51.484016089347, 51.472766440913, 51.461516792479,
-        51.450267144044, 51.439017495610, 51.427767847176, 51.416518198741, 51.405268550307, 51.394018901872,
-        51.382769253438, 51.371519605004, 51.360269956569, 51.349020308135, 51.337770659700, 51.326521011266,
-        51.315271362832, 51.304021714397, 51.292772065963, 51.281522417528, 51.270272769094, 51.259023120659,
-        51.247773472225, 51.236523823790, 51.225274175356, 51.214024526921, 51.202774878487, 51.191525230052,
-        51.180275581618, 51.169025933183, 51.157776284749, 51.146526636314, 51.135276987880, 51.124027339445,
-        51.112777691011, 51.101528042576, 51.090278394142, 51.079028745707, 51.067779097273, 51.056529448838,
-        51.045279800403, 51.034030151969, 51.022780503534, 51.011530855100, 51.000281206665, 50.989031558230,
-        50.977781909796, 50.966532261361, 50.955282612926, 50.944032964492, 50.932783316057, 50.921533667622,
-        50.910284019188, 50.899034370753, 50.887784722318, 50.876535073884, 50.865285425449, 50.854035777014,
-        50.842786128580, 50.831536480145, 50.820286831710, 50.809037183276, 50.797787534841, 50.786537886406,
-        50.775288237971, 50.764038589537, 50.752788941102, 50.741539292667, 50.730289644232, 50.719039995797,
-        50.707790347363, 50.696540698928, 50.685291050493, 50.674041402058, 50.662791753623, 50.651542105189,
-        50.640292456754, 50.629042808319, 50.617793159884, 50.606543511449, 50.595293863014, 50.584044214580,
-        50.572794566145, 50.561544917710, 50.550295269275, 50.539045620840, 50.527795972405, 50.516546323970,
-        50.505296675535, 50.494047027100, 50.482797378666, 50.471547730231, 50.460298081796, 50.449048433361,
-        50.437798784926, 50.426549136491, 50.415299488056, 50.404049839621, 50.392800191186, 50.381550542751,
-        50.370300894316, 50.359051245881, 50.347801597446, 50.336551949011, 50.325302300576, 50.314052652141,
-        50.302803003706, 50.291553355271, 50.280303706836, 50.269054058401, 50.257804409966, 50.246554761531,
-        50.235305113096, 50.224055464661, 50.212805816226, 50.201556167791, 50.190306519355, 50.179056870920,
-        50.167807222485, 50.156557574050, 50.145307925615, 50.134058277180, 50.122808628745, 50.111558980310,
-        50.100309331875, 50.089059683439, 50.077810035004, 50.066560386569, 50.055310738134, 50.044061089699,
-        50.032811441264, 50.021561792828, 50.010312144393, 49.999062495958, 49.987812847523, 49.976563199088,
-        49.965313550653, 49.954063902217, 49.942814253782, 49.931564605347, 49.920314956912, 49.909065308476,
-        49.897815660041, 49.886566011606, 49.875316363171, 49.864066714735, 49.852817066300, 49.841567417865,
-        49.830317769430, 49.819068120994, 49.807818472559, 49.796568824124, 49.785319175688, 49.774069527253,
-        49.762819878818, 49.751570230382, 49.740320581947, 49.729070933512, 49.717821285076, 49.706571636641,
-        49.695321988206, 49.684072339770, 49.672822691335, 49.661573042900, 49.650323394464, 49.639073746029,
-        49.627824097593, 49.616574449158, 49.605324800723, 49.594075152287, 49.582825503852, 49.571575855416,
-        49.560326206981, 49.549076558545, 49.537826910110, 49.526577261675, 49.515327613239, 49.504077964804,
-        49.492828316368, 49.481578667933, 49.470329019497, 49.459079371062, 49.447829722626, 49.436580074191,
-        49.425330425755, 49.414080777320, 49.402831128884, 49.391581480449, 49.380331832013, 49.369082183578,
-        49.357832535142, 49.346582886707, 49.335333238271, 49.324083589836, 49.312833941400, 49.301584292964,
-        49.290334644529, 49.279084996093, 49.267835347658, 49.256585699222, 49.245336050787, 49.234086402351,
-        49.222836753915, 49.211587105480, 49.200337457044, 49.189087808608, 49.177838160173, 49.166588511737,
-        49.155338863302, 49.144089214866, 49.132839566430, 49.121589917995, 49.110340269559, 49.099090621123,
-        49.087840972688, 49.076591324252, 49.065341675816, 49.054092027380, 49.042842378945, 49.031592730509,
-        49.020343082073, 49.009093433638, 48.997843785202, 48.986594136766, 48.975344488330, 48.964094839895,
-        48.952845191459, 48.941595543023, 48.930345894587, 48.919096246152, 48.907846597716, 48.896596949280,
-        48.885347300844, 48.874097652409, 48.862848003973, 48.851598355537, 48.840348707101, 48.829099058665,
-        48.817849410230, 48.806599761794, 48.795350113358, 48.784100464922, 48.772850816486, 48.761601168050,
-        48.750351519615, 48.739101871179, 48.727852222743, 48.716602574307, 48.705352925871, 48.694103277435,
-        48.682853628999, 48.671603980563, 48.660354332128, 48.649104683692, 48.637855035256, 48.626605386820,
-        48.615355738384, 48.604106089948, 48.592856441512, 48.581606793076, 48.570357144640, 48.559107496204,
-        48.547857847768, 48.536608199332, 48.525358550896, 48.514108902460, 48.502859254024, 48.491609605589,
-        48.480359957153, 48.469110308717, 48.457860660281, 48.446611011845, 48.435361363409, 48.424111714973,
-        48.412862066537, 48.401612418100, 48.390362769664, 48.379113121228, 48.367863472792, 48.356613824356,
-        48.345364175920, 48.334114527484, 48.322864879048, 48.311615230612, 48.300365582176, 48.289115933740,
-        48.277866285304, 48.266616636868, 48.255366988432, 48.244117339996, 48.232867691560, 48.221618043123,
-        48.210368394687, 48.199118746251, 48.187869097815, 48.176619449379, 48.165369800943, 48.154120152507,
-        48.142870504070, 48.131620855634, 48.120371207198, 48.109121558762, 48.097871910326, 48.086622261890,
-        48.075372613453, 48.064122965017, 48.052873316581, 48.041623668145, 48.030374019709, 48.019124371273,
-        48.007874722836, 47.996625074400, 47.985375425964, 47.974125777528, 47.962876129091, 47.951626480655,
-        47.940376832219, 47.929127183783, 47.917877535346, 47.906627886910, 47.895378238474, 47.884128590038,
-        47.872878941601, 47.861629293165, 47.850379644729, 47.839129996292, 47.827880347856, 47.816630699420,
-        47.805381050984, 47.794131402547, 47.782881754111, 47.771632105675, 47.760382457238, 47.749132808802,
-        47.737883160366, 47.726633511929, 47.715383863493, 47.704134215057, 47.692884566620, 47.681634918184,
-        47.670385269747, 47.659135621311, 47.647885972875, 47.636636324438, 47.625386676002, 47.614137027566,
-        47.602887379129, 47.591637730693, 47.580388082256, 47.569138433820, 47.557888785383, 47.546639136947,
-        47.535389488511, 47.524139840074, 47.512890191638, 47.501640543201, 47.490390894765, 47.479141246328,
-        47.467891597892, 47.456641949455, 47.445392301019, 47.434142652582, 47.422893004146, 47.411643355710,
-        47.400393707273, 47.389144058837, 47.377894410400, 47.366644761963, 47.355395113527, 47.344145465090,
-        47.332895816654, 47.321646168217, 47.310396519781, 47.299146871344, 47.287897222908, 47.276647574471,
-        47.265397926035, 47.254148277598, 47.242898629162, 47.231648980725, 47.220399332288, 47.209149683852,
-        47.197900035415, 47.186650386979, 47.175400738542, 47.164151090105, 47.152901441669, 47.141651793232,
-        47.130402144796, 47.119152496359, 47.107902847922, 47.096653199486, 47.085403551049, 47.074153902612,
-        47.062904254176, 47.051654605739, 47.040404957302, 47.029155308866, 47.017905660429, 47.006656011993,
-        46.995406363556, 46.984156715119, 46.972907066682, 46.961657418246, 46.950407769809, 46.939158121372,
-        46.927908472936, 46.916658824499, 46.905409176062, 46.894159527626, 46.882909879189, 46.871660230752,
-        46.860410582315, 46.849160933879, 46.837911285442, 46.826661637005, 46.815411988568, 46.804162340132,
-        46.792912691695, 46.781663043258, 46.770413394821, 46.759163746384, 46.747914097948, 46.736664449511,
-        46.725414801074, 46.714165152637, 46.702915504201, 46.691665855764, 46.680416207327, 46.669166558890,
-        46.657916910453, 46.646667262016, 46.635417613580, 46.624167965143, 46.612918316706, 46.601668668269,
-        46.590419019832, 46.579169371395, 46.567919722958, 46.556670074522, 46.545420426085, 46.534170777648,
-        46.522921129211, 46.511671480774, 46.500421832337, 46.489172183900, 46.477922535463, 46.466672887026,
-        46.455423238590, 46.444173590153, 46.432923941716, 46.421674293279, 46.410424644842, 46.399174996405,
-        46.387925347968, 46.376675699531, 46.365426051094, 46.354176402657, 46.342926754220, 46.331677105783,
-        46.320427457346, 46.309177808909, 46.297928160472, 46.286678512035, 46.275428863598, 46.264179215161,
-        46.252929566724, 46.241679918287, 46.230430269850, 46.219180621413, 46.207930972976, 46.196681324539,
-        46.185431676102, 46.174182027665, 46.162932379228, 46.151682730791, 46.140433082354, 46.129183433917,
-        46.117933785480, 46.106684137043, 46.095434488606, 46.084184840169, 46.072935191732, 46.061685543295,
-        46.050435894858, 46.039186246421, 46.027936597983, 46.016686949546, 46.005437301109, 45.994187652672,
-        45.982938004235, 45.971688355798, 45.960438707361, 45.949189058924, 45.937939410487, 45.926689762049,
-        45.915440113612, 45.904190465175, 45.892940816738, 45.881691168301, 45.870441519864, 45.859191871427,
-        45.847942222989, 45.836692574552, 45.825442926115, 45.814193277678, 45.802943629241, 45.791693980804,
-        45.780444332366, 45.769194683929, 45.757945035492, 45.746695387055, 45.735445738618, 45.724196090180,
-        45.712946441743, 45.701696793306, 45.690447144869, 45.679197496431, 45.667947847994, 45.656698199557,
-        45.645448551120, 45.634198902682, 45.622949254245, 45.611699605808, 45.600449957371, 45.589200308933,
-        45.577950660496, 45.566701012059, 45.555451363622, 45.544201715184, 45.532952066747, 45.521702418310,
-        45.510452769872, 45.499203121435, 45.487953472998, 45.476703824560, 45.465454176123, 45.454204527686,
-        45.442954879249, 45.431705230811, 45.420455582374, 45.409205933936, 45.397956285499, 45.386706637062,
-        45.375456988624, 45.364207340187, 45.352957691750, 45.341708043312, 45.330458394875, 45.319208746438,
-        45.307959098000, 45.296709449563, 45.285459801125, 45.274210152688, 45.262960504251, 45.251710855813,
-        45.240461207376, 45.229211558938, 45.217961910501, 45.206712262064, 45.195462613626, 45.184212965189,
-        45.172963316751, 45.161713668314, 45.150464019876, 45.139214371439, 45.127964723002, 45.116715074564,
-        45.105465426127, 45.094215777689, 45.082966129252, 45.071716480814, 45.060466832377, 45.049217183939,
-        45.037967535502, 45.026717887064, 45.015468238627, 45.004218590189, 44.992968941752, 44.981719293314,
-        44.970469644877, 44.959219996439, 44.947970348002, 44.936720699564, 44.925471051127, 44.914221402689,
-        44.902971754252, 44.891722105814, 44.880472457377, 44.869222808939, 44.857973160502, 44.846723512064,
-        44.835473863626, 44.824224215189, 44.812974566751, 44.801724918314, 44.790475269876, 44.779225621439,
-        44.767975973001, 44.756726324563, 44.745476676126, 44.734227027688, 44.722977379251, 44.711727730813,
-        44.700478082375, 44.689228433938, 44.677978785500, 44.666729137062, 44.655479488625, 44.644229840187,
-        44.632980191750, 44.621730543312, 44.610480894874, 44.599231246437, 44.587981597999, 44.576731949561,
-        44.565482301124, 44.554232652686, 44.542983004248, 44.531733355811, 44.520483707373, 44.509234058935,
-        44.497984410498, 44.486734762060, 44.475485113622, 44.464235465184, 44.452985816747, 44.441736168309,
-        44.430486519871, 44.419236871434, 44.407987222996, 44.396737574558, 44.385487926120, 44.374238277683,
-        44.362988629245, 44.351738980807, 44.340489332370, 44.329239683932, 44.317990035494, 44.306740387056,
-        44.295490738618, 44.284241090181, 44.272991441743, 44.261741793305, 44.250492144867, 44.239242496430,
-        44.227992847992, 44.216743199554, 44.205493551116, 44.194243902678, 44.182994254241, 44.171744605803,
-        44.160494957365, 44.149245308927, 44.137995660489, 44.126746012052, 44.115496363614, 44.104246715176,
-        44.092997066738, 44.081747418300, 44.070497769862, 44.059248121425, 44.047998472987, 44.036748824549,
-        44.025499176111, 44.014249527673, 44.002999879235, 43.991750230797, 43.980500582359, 43.969250933922,
-        43.958001285484, 43.946751637046, 43.935501988608, 43.924252340170, 43.913002691732, 43.901753043294,
-        43.890503394856, 43.879253746418, 43.868004097981, 43.856754449543, 43.845504801105, 43.834255152667,
-        43.823005504229, 43.811755855791, 43.800506207353, 43.789256558915, 43.778006910477, 43.766757262039,
-        43.755507613601, 43.744257965163, 43.733008316725, 43.721758668287, 43.710509019849, 43.699259371411,
-        43.688009722973, 43.676760074535, 43.665510426097, 43.654260777659, 43.643011129221, 43.631761480783,
-        43.620511832345, 43.609262183907, 43.598012535469, 43.586762887031, 43.575513238593, 43.564263590155,
-        43.553013941717, 43.541764293279, 43.530514644841, 43.519264996403, 43.508015347965, 43.496765699527,
-        43.485516051089, 43.474266402651, 43.463016754213, 43.451767105775, 43.440517457337, 43.429267808899,
-        43.418018160461, 43.406768512023, 43.395518863584, 43.384269215146, 43.373019566708, 43.361769918270,
-        43.350520269832, 43.339270621394, 43.328020972956, 43.316771324518, 43.305521676080, 43.294272027642,
-        43.283022379203, 43.271772730765, 43.260523082327, 43.249273433889, 43.238023785451, 43.226774137013,
-        43.215524488575, 43.204274840136, 43.193025191698, 43.181775543260, 43.170525894822, 43.159276246384,
-        43.148026597946, 43.136776949508, 43.125527301069, 43.114277652631, 43.103028004193, 43.091778355755,
-        43.080528707317, 43.069279058878, 43.058029410440, 43.046779762002, 43.035530113564, 43.024280465126,
-        43.013030816687, 43.001781168249, 42.990531519811, 42.979281871373, 42.968032222935, 42.956782574496,
-        42.945532926058, 42.934283277620, 42.923033629182, 42.911783980743, 42.900534332305, 42.889284683867,
-        42.878035035429, 42.866785386990, 42.855535738552, 42.844286090114, 42.833036441676, 42.821786793237,
-        42.810537144799, 42.799287496361, 42.788037847922, 42.776788199484, 42.765538551046, 42.754288902608,
-        42.743039254169, 42.731789605731, 42.720539957293, 42.709290308854, 42.698040660416, 42.686791011978,
-        42.675541363539, 42.664291715101, 42.653042066663, 42.641792418224, 42.630542769786, 42.619293121348,
-        42.608043472909, 42.596793824471, 42.585544176033, 42.574294527594, 42.563044879156, 42.551795230718,
-        42.540545582279, 42.529295933841, 42.518046285402, 42.506796636964, 42.495546988526, 42.484297340087,
-        42.473047691649, 42.461798043211, 42.450548394772, 42.439298746334, 42.428049097895, 42.416799449457,
-        42.405549801019, 42.394300152580, 42.383050504142, 42.371800855703, 42.360551207265, 42.349301558826,
-        42.338051910388, 42.326802261950, 42.315552613511, 42.304302965073, 42.293053316634, 42.281803668196,
-        42.270554019757, 42.259304371319, 42.248054722880, 42.236805074442, 42.225555426003, 42.214305777565,
-        42.203056129127, 42.191806480688, 42.180556832250, 42.169307183811, 42.158057535373, 42.146807886934,
-        42.135558238496, 42.124308590057, 42.113058941619, 42.101809293180, 42.090559644742, 42.079309996303,
-        42.068060347865, 42.056810699426, 42.045561050988, 42.034311402549, 42.023061754110, 42.011812105672,
-        42.000562457233, 41.989312808795, 41.978063160356, 41.966813511918, 41.955563863479, 41.944314215041,
-        41.933064566602, 41.921814918164, 41.910565269725, 41.899315621286, 41.888065972848, 41.876816324409,
-        41.865566675971, 41.854317027532, 41.843067379093, 41.831817730655, 41.820568082216, 41.809318433778,
-        41.798068785339, 41.786819136900, 41.775569488462, 41.764319840023, 41.753070191585, 41.741820543146,
-        41.730570894707, 41.719321246269, 41.708071597830, 41.696821949392, 41.685572300953, 41.674322652514,
-        41.663073004076, 41.651823355637, 41.640573707198, 41.629324058760, 41.618074410321, 41.606824761882,
-        41.595575113444, 41.584325465005, 41.573075816566, 41.561826168128, 41.550576519689, 41.539326871250,
-        41.528077222812, 41.516827574373, 41.505577925934, 41.494328277496, 41.483078629057, 41.471828980618,
-        41.460579332179, 41.449329683741, 41.438080035302, 41.426830386863, 41.415580738425, 41.404331089986,
-        41.393081441547, 41.381831793108, 41.370582144670, 41.359332496231, 41.348082847792, 41.336833199353,
-        41.325583550915, 41.314333902476, 41.303084254037, 41.291834605598, 41.280584957160, 41.269335308721,
-        41.258085660282, 41.246836011843, 41.235586363405, 41.224336714966, 41.213087066527, 41.201837418088,
-        41.190587769650, 41.179338121211, 41.168088472772, 41.156838824333, 41.145589175894, 41.134339527456,
-        41.123089879017, 41.111840230578, 41.100590582139, 41.089340933700, 41.078091285262, 41.066841636823,
-        41.055591988384, 41.044342339945, 41.033092691506, 41.021843043067, 41.010593394629, 40.999343746190,
-        40.988094097751, 40.976844449312, 40.965594800873, 40.954345152434, 40.943095503995, 40.931845855557,
-        40.920596207118, 40.909346558679, 40.898096910240, 40.886847261801, 40.875597613362, 40.864347964923,
-        40.853098316484, 40.841848668046, 40.830599019607, 40.819349371168, 40.808099722729, 40.796850074290,
-        40.785600425851, 40.774350777412, 40.763101128973, 40.751851480534, 40.740601832095, 40.729352183657,
-        40.718102535218, 40.706852886779, 40.695603238340, 40.684353589901, 40.673103941462, 40.661854293023,
-        40.650604644584, 40.639354996145, 40.628105347706, 40.616855699267, 40.605606050828, 40.594356402389,
-        40.583106753950, 40.571857105511, 40.560607457072, 40.549357808633, 40.538108160194, 40.526858511755,
-        40.515608863316, 40.504359214877, 40.493109566438, 40.481859917999, 40.470610269560, 40.459360621121,
-        40.448110972682, 40.436861324243, 40.425611675804, 40.414362027365, 40.403112378926, 40.391862730487,
-        40.380613082048, 40.369363433609, 40.358113785170, 40.346864136731, 40.335614488292, 40.324364839853,
-        40.313115191414, 40.301865542975, 40.290615894536, 40.279366246097, 40.268116597658, 40.256866949219,
-        40.245617300780, 40.234367652341, 40.223118003902, 40.211868355463, 40.200618707024, 40.189369058585,
-        40.178119410146, 40.166869761706, 40.155620113267, 40.144370464828, 40.133120816389, 40.121871167950,
-        40.110621519511, 40.099371871072, 40.088122222633, 40.076872574194, 40.065622925755, 40.054373277316,
-        40.043123628876, 40.031873980437, 40.020624331998, 40.009374683559, 39.998125035120, 39.986875386681,
-        39.975625738242, 39.964376089803, 39.953126441363, 39.941876792924, 39.930627144485, 39.919377496046,
-        39.908127847607, 39.896878199168, 39.885628550728, 39.874378902289, 39.863129253850, 39.851879605411,
-        39.840629956972, 39.829380308533, 39.818130660093, 39.806881011654, 39.795631363215, 39.784381714776,
-        39.773132066337, 39.761882417898, 39.750632769458, 39.739383121019, 39.728133472580, 39.716883824141,
-        39.705634175702, 39.694384527262, 39.683134878823, 39.671885230384, 39.660635581945, 39.649385933506,
-        39.638136285066, 39.626886636627, 39.615636988188, 39.604387339749, 39.593137691309, 39.581888042870,
-        39.570638394431, 39.559388745992, 39.548139097552, 39.536889449113, 39.525639800674, 39.514390152235,
-        39.503140503795, 39.491890855356, 39.480641206917, 39.469391558478, 39.458141910038, 39.446892261599,
-        39.435642613160, 39.424392964720, 39.413143316281, 39.401893667842, 39.390644019403, 39.379394370963,
-        39.368144722524, 39.356895074085, 39.345645425645, 39.334395777206, 39.323146128767, 39.311896480328,
-        39.300646831888, 39.289397183449, 39.278147535010, 39.266897886570, 39.255648238131, 39.244398589692,
-        39.233148941252, 39.221899292813, 39.210649644374, 39.199399995934, 39.188150347495, 39.176900699056,
-        39.165651050616, 39.154401402177, 39.143151753738, 39.131902105298, 39.120652456859, 39.109402808419,
-        39.098153159980, 39.086903511541, 39.075653863101, 39.064404214662, 39.053154566223, 39.041904917783,
-        39.030655269344, 39.019405620904, 39.008155972465, 38.996906324026, 38.985656675586, 38.974407027147,
-        38.963157378708, 38.951907730268, 38.940658081829, 38.929408433389, 38.918158784950, 38.906909136510,
-        38.895659488071, 38.884409839632, 38.873160191192, 38.861910542753, 38.850660894313, 38.839411245874,
-        38.828161597434, 38.816911948995, 38.805662300556, 38.794412652116, 38.783163003677, 38.771913355237,
-        38.760663706798, 38.749414058358, 38.738164409919, 38.726914761479, 38.715665113040, 38.704415464601,
-        38.693165816161, 38.681916167722, 38.670666519282, 38.659416870843, 38.648167222403, 38.636917573964,
-        38.625667925524, 38.614418277085, 38.603168628645, 38.591918980206, 38.580669331766, 38.569419683327,
-        38.558170034887, 38.546920386448, 38.535670738008, 38.524421089569, 38.513171441129, 38.501921792690,
-        38.490672144250, 38.479422495811, 38.468172847371, 38.456923198932, 38.445673550492, 38.434423902053,
-        38.423174253613, 38.411924605173, 38.400674956734, 38.389425308294, 38.378175659855, 38.366926011415,
-        38.355676362976, 38.344426714536, 38.333177066097, 38.321927417657, 38.310677769217, 38.299428120778,
-        38.288178472338, 38.276928823899, 38.265679175459, 38.254429527020, 38.243179878580, 38.231930230140,
-        38.220680581701, 38.209430933261, 38.198181284822, 38.186931636382, 38.175681987942, 38.164432339503,
-        38.153182691063, 38.141933042624, 38.130683394184, 38.119433745744, 38.108184097305, 38.096934448865,
-        38.085684800426, 38.074435151986, 38.063185503546, 38.051935855107, 38.040686206667, 38.029436558227,
-        38.018186909788, 38.006937261348, 37.995687612909, 37.984437964469, 37.973188316029, 37.961938667590,
-        37.950689019150, 37.939439370710, 37.928189722271, 37.916940073831, 37.905690425391, 37.894440776952,
-        37.883191128512, 37.871941480072, 37.860691831633, 37.849442183193, 37.838192534753, 37.826942886314,
-        37.815693237874, 37.804443589434, 37.793193940995, 37.781944292555, 37.770694644115, 37.759444995676,
-        37.748195347236, 37.736945698796, 37.725696050356, 37.714446401917, 37.703196753477, 37.691947105037,
-        37.680697456598, 37.669447808158, 37.658198159718, 37.646948511278, 37.635698862839, 37.624449214399,
-        37.613199565959, 37.601949917519, 37.590700269080, 37.579450620640, 37.568200972200, 37.556951323761,
-        37.545701675321, 37.534452026881, 37.523202378441, 37.511952730001, 37.500703081562, 37.489453433122,
-        37.478203784682, 37.466954136242, 37.455704487803, 37.444454839363, 37.433205190923, 37.421955542483,
-        37.410705894044, 37.399456245604, 37.388206597164, 37.376956948724, 37.365707300284, 37.354457651845,
-        37.343208003405, 37.331958354965, 37.320708706525, 37.309459058085, 37.298209409646, 37.286959761206,
-        37.275710112766, 37.264460464326, 37.253210815886, 37.241961167447, 37.230711519007, 37.219461870567,
-        37.208212222127, 37.196962573687, 37.185712925247, 37.174463276808, 37.163213628368, 37.151963979928,
-        37.140714331488, 37.129464683048, 37.118215034608, 37.106965386169, 37.095715737729, 37.084466089289,
-        37.073216440849, 37.061966792409, 37.050717143969, 37.039467495529, 37.028217847090, 37.016968198650,
-        37.005718550210, 36.994468901770, 36.983219253330, 36.971969604890, 36.960719956450, 36.949470308010,
-        36.938220659571, 36.926971011131, 36.915721362691, 36.904471714251, 36.893222065811, 36.881972417371,
-        36.870722768931, 36.859473120491, 36.848223472051, 36.836973823611, 36.825724175172, 36.814474526732,
-        36.803224878292, 36.791975229852, 36.780725581412, 36.769475932972, 36.758226284532, 36.746976636092,
-        36.735726987652, 36.724477339212, 36.713227690772, 36.701978042332, 36.690728393892, 36.679478745452,
-        36.668229097012, 36.656979448573, 36.645729800133, 36.634480151693, 36.623230503253, 36.611980854813,
-        36.600731206373, 36.589481557933, 36.578231909493, 36.566982261053, 36.555732612613, 36.544482964173,
-        36.533233315733, 36.521983667293, 36.510734018853, 36.499484370413, 36.488234721973, 36.476985073533,
-        36.465735425093, 36.454485776653, 36.443236128213, 36.431986479773, 36.420736831333, 36.409487182893,
-        36.398237534453, 36.386987886013, 36.375738237573, 36.364488589133, 36.353238940693, 36.341989292253,
-        36.330739643813, 36.319489995373, 36.308240346933, 36.296990698493, 36.285741050053, 36.274491401613,
-        36.263241753173, 36.251992104733, 36.240742456293, 36.229492807853, 36.218243159413, 36.206993510973,
-        36.195743862532, 36.184494214092, 36.173244565652, 36.161994917212, 36.150745268772, 36.139495620332,
-        36.128245971892, 36.116996323452, 36.105746675012, 36.094497026572, 36.083247378132, 36.071997729692,
-        36.060748081252, 36.049498432812, 36.038248784371, 36.026999135931, 36.015749487491, 36.004499839051,
-        35.993250190611, 35.982000542171, 35.970750893731, 35.959501245291, 35.948251596851, 35.937001948411,
-        35.925752299971, 35.914502651530, 35.903253003090, 35.892003354650, 35.880753706210, 35.869504057770,
-        35.858254409330, 35.847004760890, 35.835755112450, 35.824505464009, 35.813255815569, 35.802006167129,
-        35.790756518689, 35.779506870249, 35.768257221809, 35.757007573369, 35.745757924928, 35.734508276488,
-        35.723258628048, 35.712008979608, 35.700759331168, 35.689509682728, 35.678260034288, 35.667010385847,
-        35.655760737407, 35.644511088967, 35.633261440527, 35.622011792087, 35.610762143647, 35.599512495206,
-        35.588262846766, 35.577013198326, 35.565763549886, 35.554513901446, 35.543264253005, 35.532014604565,
-        35.520764956125, 35.509515307685, 35.498265659245, 35.487016010804, 35.475766362364, 35.464516713924,
-        35.453267065484, 35.442017417044, 35.430767768603, 35.419518120163, 35.408268471723, 35.397018823283,
-        35.385769174843, 35.374519526402, 35.363269877962, 35.352020229522, 35.340770581082, 35.329520932641,
-        35.318271284201, 35.307021635761, 35.295771987321, 35.284522338880, 35.273272690440, 35.262023042000,
-        35.250773393560, 35.239523745119, 35.228274096679, 35.217024448239, 35.205774799799, 35.194525151358,
-        35.183275502918, 35.172025854478, 35.160776206038, 35.149526557597, 35.138276909157, 35.127027260717,
-        35.115777612277, 35.104527963836, 35.093278315396, 35.082028666956, 35.070779018515, 35.059529370075,
-        35.048279721635, 35.037030073195, 35.025780424754, 35.014530776314, 35.003281127874, 34.992031479433,
-        34.980781830993, 34.969532182553, 34.958282534112, 34.947032885672, 34.935783237232, 34.924533588792,
-        34.913283940351, 34.902034291911, 34.890784643471, 34.879534995030, 34.868285346590, 34.857035698150,
-        34.845786049709, 34.834536401269, 34.823286752829, 34.812037104388, 34.800787455948, 34.789537807508,
-        34.778288159067, 34.767038510627, 34.755788862187, 34.744539213746, 34.733289565306, 34.722039916865,
-        34.710790268425, 34.699540619985, 34.688290971544, 34.677041323104, 34.665791674664, 34.654542026223,
-        34.643292377783, 34.632042729343, 34.620793080902, 34.609543432462, 34.598293784021, 34.587044135581,
-        34.575794487141, 34.564544838700, 34.553295190260, 34.542045541819, 34.530795893379, 34.519546244939,
-        34.508296596498, 34.497046948058, 34.485797299618, 34.474547651177, 34.463298002737, 34.452048354296,
-        34.440798705856, 34.429549057415, 34.418299408975, 34.407049760535, 34.395800112094, 34.384550463654,
-        34.373300815213, 34.362051166773, 34.350801518333, 34.339551869892, 34.328302221452, 34.317052573011,
-        34.305802924571, 34.294553276130, 34.283303627690, 34.272053979249, 34.260804330809, 34.249554682369,
-        34.238305033928, 34.227055385488, 34.215805737047, 34.204556088607, 34.193306440166, 34.182056791726,
-        34.170807143285, 34.159557494845, 34.148307846404, 34.137058197964, 34.125808549524, 34.114558901083,
-        34.103309252643, 34.092059604202, 34.080809955762, 34.069560307321, 34.058310658881, 34.047061010440,
-        34.035811362000, 34.024561713559, 34.013312065119, 34.002062416678, 33.990812768238, 33.979563119797,
-        33.968313471357, 33.957063822916, 33.945814174476, 33.934564526035, 33.923314877595, 33.912065229154,
-        33.900815580714, 33.889565932273, 33.878316283833, 33.867066635392, 33.855816986952, 33.844567338511,
-        33.833317690071, 33.822068041630, 33.810818393190, 33.799568744749, 33.788319096308, 33.777069447868,
-        33.765819799427, 33.754570150987, 33.743320502546, 33.732070854106, 33.720821205665, 33.709571557225,
-        33.698321908784, 33.687072260344, 33.675822611903, 33.664572963462, 33.653323315022, 33.642073666581,
-        33.630824018141, 33.619574369700, 33.608324721260, 33.597075072819, 33.585825424379, 33.574575775938,
-        33.563326127497, 33.552076479057, 33.540826830616, 33.529577182176, 33.518327533735, 33.507077885294,
-        33.495828236854, 33.484578588413, 33.473328939973, 33.462079291532, 33.450829643092, 33.439579994651,
-        33.428330346210, 33.417080697770, 33.405831049329, 33.394581400889, 33.383331752448, 33.372082104007,
-        33.360832455567, 33.349582807126, 33.338333158685, 33.327083510245, 33.315833861804, 33.304584213364,
-        33.293334564923, 33.282084916482, 33.270835268042, 33.259585619601, 33.248335971160, 33.237086322720,
-        33.225836674279, 33.214587025839, 33.203337377398, 33.192087728957, 33.180838080517, 33.169588432076,
-        33.158338783635, 33.147089135195, 33.135839486754, 33.124589838313, 33.113340189873, 33.102090541432,
-        33.090840892991, 33.079591244551, 33.068341596110, 33.057091947669, 33.045842299229, 33.034592650788,
-        33.023343002347, 33.012093353907, 33.000843705466, 32.989594057025, 32.978344408585, 32.967094760144,
-        32.955845111703, 32.944595463263, 32.933345814822, 32.922096166381, 32.910846517941, 32.899596869500,
-        32.888347221059, 32.877097572619, 32.865847924178, 32.854598275737, 32.843348627296, 32.832098978856,
-        32.820849330415, 32.809599681974, 32.798350033534, 32.787100385093, 32.775850736652, 32.764601088211,
-        32.753351439771, 32.742101791330, 32.730852142889, 32.719602494449, 32.708352846008, 32.697103197567,
-        32.685853549126, 32.674603900686, 32.663354252245, 32.652104603804, 32.640854955363, 32.629605306923,
-        32.618355658482, 32.607106010041, 32.595856361600, 32.584606713160, 32.573357064719, 32.562107416278,
-        32.550857767837, 32.539608119397, 32.528358470956, 32.517108822515, 32.505859174074, 32.494609525634,
-        32.483359877193, 32.472110228752, 32.460860580311, 32.449610931871, 32.438361283430, 32.427111634989,
-        32.415861986548, 32.404612338107, 32.393362689667, 32.382113041226, 32.370863392785, 32.359613744344,
-        32.348364095904, 32.337114447463, 32.325864799022, 32.314615150581, 32.303365502140, 32.292115853700,
-        32.280866205259, 32.269616556818, 32.258366908377, 32.247117259936, 32.235867611496, 32.224617963055,
-        32.213368314614, 32.202118666173, 32.190869017732, 32.179619369291, 32.168369720851, 32.157120072410,
-        32.145870423969, 32.134620775528, 32.123371127087, 32.112121478646, 32.100871830206, 32.089622181765,
-        32.078372533324, 32.067122884883, 32.055873236442, 32.044623588001, 32.033373939561, 32.022124291120,
-        32.010874642679, 31.999624994238, 31.988375345797, 31.977125697356, 31.965876048916, 31.954626400475,
-        31.943376752034, 31.932127103593, 31.920877455152, 31.909627806711, 31.898378158270, 31.887128509830,
-        31.875878861389, 31.864629212948, 31.853379564507, 31.842129916066, 31.830880267625, 31.819630619184,
-        31.808380970743, 31.797131322303, 31.785881673862, 31.774632025421, 31.763382376980, 31.752132728539,
-        31.740883080098, 31.729633431657, 31.718383783216, 31.707134134775, 31.695884486335, 31.684634837894,
-        31.673385189453, 31.662135541012, 31.650885892571, 31.639636244130, 31.628386595689, 31.617136947248,
-        31.605887298807, 31.594637650366, 31.583388001925, 31.572138353485, 31.560888705044, 31.549639056603,
-        31.538389408162, 31.527139759721, 31.515890111280, 31.504640462839, 31.493390814398, 31.482141165957,
-        31.470891517516, 31.459641869075, 31.448392220634, 31.437142572193, 31.425892923752, 31.414643275311,
-        31.403393626871, 31.392143978430, 31.380894329989, 31.369644681548, 31.358395033107, 31.347145384666,
-        31.335895736225, 31.324646087784, 31.313396439343, 31.302146790902, 31.290897142461, 31.279647494020,
-        31.268397845579, 31.257148197138, 31.245898548697, 31.234648900256, 31.223399251815, 31.212149603374,
-        31.200899954933, 31.189650306492, 31.178400658051, 31.167151009610, 31.155901361169, 31.144651712728,
-        31.133402064287, 31.122152415846, 31.110902767405, 31.099653118964, 31.088403470523, 31.077153822082,
-        31.065904173641, 31.054654525200, 31.043404876759, 31.032155228318, 31.020905579877, 31.009655931436,
-        30.998406282995, 30.987156634554, 30.975906986113, 30.964657337672, 30.953407689231, 30.942158040790,
-        30.930908392349, 30.919658743908, 30.908409095467, 30.897159447026, 30.885909798585, 30.874660150144,
-        30.863410501703, 30.852160853262, 30.840911204821, 30.829661556380, 30.818411907939, 30.807162259498,
-        30.795912611057, 30.784662962616, 30.773413314175, 30.762163665734, 30.750914017293, 30.739664368852,
-        30.728414720411, 30.717165071969, 30.705915423528, 30.694665775087, 30.683416126646, 30.672166478205,
-        30.660916829764, 30.649667181323, 30.638417532882, 30.627167884441, 30.615918236000, 30.604668587559,
-        30.593418939118, 30.582169290677, 30.570919642236, 30.559669993795, 30.548420345353, 30.537170696912,
-        30.525921048471, 30.514671400030, 30.503421751589, 30.492172103148, 30.480922454707, 30.469672806266,
-        30.458423157825, 30.447173509384, 30.435923860943, 30.424674212501, 30.413424564060, 30.402174915619,
-        30.390925267178, 30.379675618737, 30.368425970296, 30.357176321855, 30.345926673414, 30.334677024973,
-        30.323427376532, 30.312177728090, 30.300928079649, 30.289678431208, 30.278428782767, 30.267179134326,
-        30.255929485885, 30.244679837444, 30.233430189003, 30.222180540561, 30.210930892120, 30.199681243679,
-        30.188431595238, 30.177181946797, 30.165932298356, 30.154682649915, 30.143433001473, 30.132183353032,
-        30.120933704591, 30.109684056150, 30.098434407709, 30.087184759268, 30.075935110827, 30.064685462385,
-        30.053435813944, 30.042186165503, 30.030936517062, 30.019686868621, 30.008437220180, 29.997187571739,
-        29.985937923297, 29.974688274856, 29.963438626415, 29.952188977974, 29.940939329533, 29.929689681091,
-        29.918440032650, 29.907190384209, 29.895940735768, 29.884691087327, 29.873441438886, 29.862191790444,
-        29.850942142003, 29.839692493562, 29.828442845121, 29.817193196680, 29.805943548238, 29.794693899797,
-        29.783444251356, 29.772194602915, 29.760944954474, 29.749695306033, 29.738445657591, 29.727196009150,
-        29.715946360709, 29.704696712268, 29.693447063827, 29.682197415385, 29.670947766944, 29.659698118503,
-        29.648448470062, 29.637198821620, 29.625949173179, 29.614699524738, 29.603449876297, 29.592200227856,
-        29.580950579414, 29.569700930973, 29.558451282532, 29.547201634091, 29.535951985649, 29.524702337208,
-        29.513452688767, 29.502203040326, 29.490953391885, 29.479703743443, 29.468454095002, 29.457204446561,
-        29.445954798120, 29.434705149678, 29.423455501237, 29.412205852796, 29.400956204355, 29.389706555913,
-        29.378456907472, 29.367207259031, 29.355957610590, 29.344707962148, 29.333458313707, 29.322208665266,
-        29.310959016825, 29.299709368383, 29.288459719942, 29.277210071501, 29.265960423059, 29.254710774618,
-        29.243461126177, 29.232211477736, 29.220961829294, 29.209712180853, 29.198462532412, 29.187212883971,
-        29.175963235529, 29.164713587088, 29.153463938647, 29.142214290205, 29.130964641764, 29.119714993323,
-        29.108465344882, 29.097215696440, 29.085966047999, 29.074716399558, 29.063466751116, 29.052217102675,
-        29.040967454234, 29.029717805792, 29.018468157351, 29.007218508910, 28.995968860469, 28.984719212027,
-        28.973469563586, 28.962219915145, 28.950970266703, 28.939720618262, 28.928470969821, 28.917221321379,
-        28.905971672938, 28.894722024497, 28.883472376055, 28.872222727614, 28.860973079173, 28.849723430731,
-        28.838473782290, 28.827224133849, 28.815974485407, 28.804724836966, 28.793475188525, 28.782225540083,
-        28.770975891642, 28.759726243201, 28.748476594759, 28.737226946318, 28.725977297877, 28.714727649435,
-        28.703478000994, 28.692228352553, 28.680978704111, 28.669729055670, 28.658479407229, 28.647229758787,
-        28.635980110346, 28.624730461905, 28.613480813463, 28.602231165022, 28.590981516581, 28.579731868139,
-        28.568482219698, 28.557232571256, 28.545982922815, 28.534733274374, 28.523483625932, 28.512233977491,
-        28.500984329050, 28.489734680608, 28.478485032167, 28.467235383725, 28.455985735284, 28.444736086843,
-        28.433486438401, 28.422236789960, 28.410987141519, 28.399737493077, 28.388487844636, 28.377238196194,
-        28.365988547753, 28.354738899312, 28.343489250870, 28.332239602429, 28.320989953987, 28.309740305546,
-        28.298490657105, 28.287241008663, 28.275991360222, 28.264741711780, 28.253492063339, 28.242242414898,
-        28.230992766456, 28.219743118015, 28.208493469573, 28.197243821132, 28.185994172691, 28.174744524249,
-        28.163494875808, 28.152245227366, 28.140995578925, 28.129745930483, 28.118496282042, 28.107246633601,
-        28.095996985159, 28.084747336718, 28.073497688276, 28.062248039835, 28.050998391393, 28.039748742952,
-        28.028499094511, 28.017249446069, 28.005999797628, 27.994750149186, 27.983500500745, 27.972250852303,
-        27.961001203862, 27.949751555420, 27.938501906979, 27.927252258538, 27.916002610096, 27.904752961655,
-        27.893503313213, 27.882253664772, 27.871004016330, 27.859754367889, 27.848504719447, 27.837255071006,
-        27.826005422564, 27.814755774123, 27.803506125682, 27.792256477240, 27.781006828799, 27.769757180357,
-        27.758507531916, 27.747257883474, 27.736008235033, 27.724758586591, 27.713508938150, 27.702259289708,
-        27.691009641267, 27.679759992825, 27.668510344384, 27.657260695942, 27.646011047501, 27.634761399059,
-        27.623511750618, 27.612262102176, 27.601012453735, 27.589762805293, 27.578513156852, 27.567263508410,
-        27.556013859969, 27.544764211527, 27.533514563086, 27.522264914644, 27.511015266203, 27.499765617761,
-        27.488515969320, 27.477266320878, 27.466016672437, 27.454767023995, 27.443517375554, 27.432267727112,
-        27.421018078671, 27.409768430229, 27.398518781788, 27.387269133346, 27.376019484905, 27.364769836463,
-        27.353520188022, 27.342270539580, 27.331020891139, 27.319771242697, 27.308521594256, 27.297271945814,
-        27.286022297373, 27.274772648931, 27.263523000490, 27.252273352048, 27.241023703606, 27.229774055165,
-        27.218524406723, 27.207274758282, 27.196025109840, 27.184775461399, 27.173525812957, 27.162276164516,
-        27.151026516074, 27.139776867633, 27.128527219191, 27.117277570749, 27.106027922308, 27.094778273866,
-        27.083528625425, 27.072278976983, 27.061029328542, 27.049779680100, 27.038530031659, 27.027280383217,
-        27.016030734775, 27.004781086334, 26.993531437892, 26.982281789451, 26.971032141009, 26.959782492568,
-        26.948532844126, 26.937283195684, 26.926033547243, 26.914783898801, 26.903534250360, 26.892284601918,
-        26.881034953477, 26.869785305035, 26.858535656593, 26.847286008152, 26.836036359710, 26.824786711269,
-        26.813537062827, 26.802287414385, 26.791037765944, 26.779788117502, 26.768538469061, 26.757288820619,
-        26.746039172177, 26.734789523736, 26.723539875294, 26.712290226853, 26.701040578411, 26.689790929969,
-        26.678541281528, 26.667291633086, 26.656041984645, 26.644792336203, 26.633542687761, 26.622293039320,
-        26.611043390878, 26.599793742437, 26.588544093995, 26.577294445553, 26.566044797112, 26.554795148670,
-        26.543545500228, 26.532295851787, 26.521046203345, 26.509796554904, 26.498546906462, 26.487297258020,
-        26.476047609579, 26.464797961137, 26.453548312695, 26.442298664254, 26.431049015812, 26.419799367371,
-        26.408549718929, 26.397300070487, 26.386050422046, 26.374800773604, 26.363551125162, 26.352301476721,
-        26.341051828279, 26.329802179837, 26.318552531396, 26.307302882954, 26.296053234512, 26.284803586071,
-        26.273553937629, 26.262304289187, 26.251054640746, 26.239804992304, 26.228555343862, 26.217305695421,
-        26.206056046979, 26.194806398538, 26.183556750096, 26.172307101654, 26.161057453213, 26.149807804771,
-        26.138558156329, 26.127308507887, 26.116058859446, 26.104809211004, 26.093559562562, 26.082309914121,
-        26.071060265679, 26.059810617237, 26.048560968796, 26.037311320354, 26.026061671912, 26.014812023471,
-        26.003562375029, 25.992312726587, 25.981063078146, 25.969813429704, 25.958563781262, 25.947314132821,
-        25.936064484379, 25.924814835937, 25.913565187495, 25.902315539054, 25.891065890612, 25.879816242170,
-        25.868566593729, 25.857316945287, 25.846067296845, 25.834817648404, 25.823567999962, 25.812318351520,
-        25.801068703078, 25.789819054637, 25.778569406195, 25.767319757753, 25.756070109312, 25.744820460870,
-        25.733570812428, 25.722321163986, 25.711071515545, 25.699821867103, 25.688572218661, 25.677322570220,
-        25.666072921778, 25.654823273336, 25.643573624894, 25.632323976453, 25.621074328011, 25.609824679569,
-        25.598575031127, 25.587325382686, 25.576075734244, 25.564826085802, 25.553576437361, 25.542326788919,
-        25.531077140477, 25.519827492035, 25.508577843594, 25.497328195152, 25.486078546710, 25.474828898268,
-        25.463579249827, 25.452329601385, 25.441079952943, 25.429830304501, 25.418580656060, 25.407331007618,
-        25.396081359176, 25.384831710734, 25.373582062293, 25.362332413851, 25.351082765409, 25.339833116967,
-        25.328583468526, 25.317333820084, 25.306084171642, 25.294834523200, 25.283584874758, 25.272335226317,
-        25.261085577875, 25.249835929433, 25.238586280991, 25.227336632550, 25.216086984108, 25.204837335666,
-        25.193587687224, 25.182338038783, 25.171088390341, 25.159838741899, 25.148589093457, 25.137339445015,
-        25.126089796574, 25.114840148132, 25.103590499690, 25.092340851248, 25.081091202806, 25.069841554365,
-        25.058591905923, 25.047342257481, 25.036092609039, 25.024842960597, 25.013593312156, 25.002343663714,
-        24.991094015272, 24.979844366830, 24.968594718388, 24.957345069947, 24.946095421505, 24.934845773063,
-        24.923596124621, 24.912346476179, 24.901096827738, 24.889847179296, 24.878597530854, 24.867347882412,
-        24.856098233970, 24.844848585529, 24.833598937087, 24.822349288645, 24.811099640203, 24.799849991761,
-        24.788600343319, 24.777350694878, 24.766101046436, 24.754851397994, 24.743601749552, 24.732352101110,
-        24.721102452669, 24.709852804227, 24.698603155785, 24.687353507343, 24.676103858901, 24.664854210459,
-        24.653604562018, 24.642354913576, 24.631105265134, 24.619855616692, 24.608605968250, 24.597356319808,
-        24.586106671367, 24.574857022925, 24.563607374483, 24.552357726041, 24.541108077599, 24.529858429157,
-        24.518608780715, 24.507359132274, 24.496109483832, 24.484859835390, 24.473610186948, 24.462360538506,
-        24.451110890064, 24.439861241622, 24.428611593181, 24.417361944739, 24.406112296297, 24.394862647855,
-        24.383612999413, 24.372363350971, 24.361113702529, 24.349864054088, 24.338614405646, 24.327364757204,
-        24.316115108762, 24.304865460320, 24.293615811878, 24.282366163436, 24.271116514994, 24.259866866553,
-        24.248617218111, 24.237367569669, 24.226117921227, 24.214868272785, 24.203618624343, 24.192368975901,
-        24.181119327459, 24.169869679017, 24.158620030576, 24.147370382134, 24.136120733692, 24.124871085250,
-        24.113621436808, 24.102371788366, 24.091122139924, 24.079872491482, 24.068622843040, 24.057373194599,
-        24.046123546157, 24.034873897715, 24.023624249273, 24.012374600831, 24.001124952389, 23.989875303947,
-        23.978625655505, 23.967376007063, 23.956126358621, 23.944876710180, 23.933627061738, 23.922377413296,
-        23.911127764854, 23.899878116412, 23.888628467970, 23.877378819528, 23.866129171086, 23.854879522644,
-        23.843629874202, 23.832380225760, 23.821130577318, 23.809880928877, 23.798631280435, 23.787381631993,
-        23.776131983551, 23.764882335109, 23.753632686667, 23.742383038225, 23.731133389783, 23.719883741341,
-        23.708634092899, 23.697384444457, 23.686134796015, 23.674885147573, 23.663635499131, 23.652385850689,
-        23.641136202248, 23.629886553806, 23.618636905364, 23.607387256922, 23.596137608480, 23.584887960038,
-        23.573638311596, 23.562388663154, 23.551139014712, 23.539889366270, 23.528639717828, 23.517390069386,
-        23.506140420944, 23.494890772502, 23.483641124060, 23.472391475618, 23.461141827176, 23.449892178734,
-        23.438642530292, 23.427392881850, 23.416143233408, 23.404893584967, 23.393643936525, 23.382394288083,
-        23.371144639641, 23.359894991199, 23.348645342757, 23.337395694315, 23.326146045873, 23.314896397431,
-        23.303646748989, 23.292397100547, 23.281147452105, 23.269897803663, 23.258648155221, 23.247398506779,
-        23.236148858337, 23.224899209895, 23.213649561453, 23.202399913011, 23.191150264569, 23.179900616127,
-        23.168650967685, 23.157401319243, 23.146151670801, 23.134902022359, 23.123652373917, 23.112402725475,
-        23.101153077033, 23.089903428591, 23.078653780149, 23.067404131707, 23.056154483265, 23.044904834823,
-        23.033655186381, 23.022405537939, 23.011155889497, 22.999906241055, 22.988656592613, 22.977406944171,
-        22.966157295729, 22.954907647287, 22.943657998845, 22.932408350403, 22.921158701961, 22.909909053519,
-        22.898659405077, 22.887409756635, 22.876160108193, 22.864910459751, 22.853660811309, 22.842411162867,
-        22.831161514425, 22.819911865983, 22.808662217541, 22.797412569099, 22.786162920657, 22.774913272215,
-        22.763663623773, 22.752413975331, 22.741164326889, 22.729914678447, 22.718665030005, 22.707415381563,
-        22.696165733121, 22.684916084679, 22.673666436237, 22.662416787794, 22.651167139352, 22.639917490910,
-        22.628667842468, 22.617418194026, 22.606168545584, 22.594918897142, 22.583669248700, 22.572419600258,
-        22.561169951816, 22.549920303374, 22.538670654932, 22.527421006490, 22.516171358048, 22.504921709606,
-        22.493672061164, 22.482422412722, 22.471172764280, 22.459923115838, 22.448673467396, 22.437423818954,
-        22.426174170512, 22.414924522069, 22.403674873627, 22.392425225185, 22.381175576743, 22.369925928301,
-        22.358676279859, 22.347426631417, 22.336176982975, 22.324927334533, 22.313677686091, 22.302428037649,
-        22.291178389207, 22.279928740765, 22.268679092323, 22.257429443881, 22.246179795438, 22.234930146996,
-        22.223680498554, 22.212430850112, 22.201181201670, 22.189931553228, 22.178681904786, 22.167432256344,
-        22.156182607902, 22.144932959460, 22.133683311018, 22.122433662576, 22.111184014133, 22.099934365691,
-        22.088684717249, 22.077435068807, 22.066185420365, 22.054935771923, 22.043686123481, 22.032436475039,
-        22.021186826597, 22.009937178155, 21.998687529713, 21.987437881270, 21.976188232828, 21.964938584386,
-        21.953688935944, 21.942439287502, 21.931189639060, 21.919939990618, 21.908690342176, 21.897440693734,
-        21.886191045292, 21.874941396849, 21.863691748407, 21.852442099965, 21.841192451523, 21.829942803081,
-        21.818693154639, 21.807443506197, 21.796193857755, 21.784944209313, 21.773694560870, 21.762444912428,
-        21.751195263986, 21.739945615544, 21.728695967102, 21.717446318660, 21.706196670218, 21.694947021776,
-        21.683697373333, 21.672447724891, 21.661198076449, 21.649948428007, 21.638698779565, 21.627449131123,
-        21.616199482681, 21.604949834239, 21.593700185796, 21.582450537354, 21.571200888912, 21.559951240470,
-        21.548701592028, 21.537451943586, 21.526202295144, 21.514952646701, 21.503702998259, 21.492453349817,
-        21.481203701375, 21.469954052933, 21.458704404491, 21.447454756049, 21.436205107606, 21.424955459164,
-        21.413705810722, 21.402456162280, 21.391206513838, 21.379956865396, 21.368707216954, 21.357457568511,
-        21.346207920069, 21.334958271627, 21.323708623185, 21.312458974743, 21.301209326301, 21.289959677858,
-        21.278710029416, 21.267460380974, 21.256210732532, 21.244961084090, 21.233711435648, 21.222461787206,
-        21.211212138763, 21.199962490321, 21.188712841879, 21.177463193437, 21.166213544995, 21.154963896553,
-        21.143714248110, 21.132464599668, 21.121214951226, 21.109965302784, 21.098715654342, 21.087466005899,
-        21.076216357457, 21.064966709015, 21.053717060573, 21.042467412131, 21.031217763689, 21.019968115246,
-        21.008718466804, 20.997468818362, 20.986219169920, 20.974969521478, 20.963719873035, 20.952470224593,
-        20.941220576151, 20.929970927709, 20.918721279267, 20.907471630825, 20.896221982382, 20.884972333940,
-        20.873722685498, 20.862473037056, 20.851223388614, 20.839973740171, 20.828724091729, 20.817474443287,
-        20.806224794845, 20.794975146403, 20.783725497960, 20.772475849518, 20.761226201076, 20.749976552634,
-        20.738726904192, 20.727477255749, 20.716227607307, 20.704977958865, 20.693728310423, 20.682478661980,
-        20.671229013538, 20.659979365096, 20.648729716654, 20.637480068212, 20.626230419769, 20.614980771327,
-        20.603731122885, 20.592481474443, 20.581231826001, 20.569982177558, 20.558732529116, 20.547482880674,
-        20.536233232232, 20.524983583789, 20.513733935347, 20.502484286905, 20.491234638463, 20.479984990021,
-        20.468735341578, 20.457485693136, 20.446236044694, 20.434986396252, 20.423736747809, 20.412487099367,
-        20.401237450925, 20.389987802483, 20.378738154040, 20.367488505598, 20.356238857156, 20.344989208714,
-        20.333739560272, 20.322489911829, 20.311240263387, 20.299990614945, 20.288740966503, 20.277491318060,
-        20.266241669618, 20.254992021176, 20.243742372734, 20.232492724291, 20.221243075849, 20.209993427407,
-        20.198743778965, 20.187494130522, 20.176244482080, 20.164994833638, 20.153745185196, 20.142495536753,
-        20.131245888311, 20.119996239869, 20.108746591427, 20.097496942984, 20.086247294542, 20.074997646100,
-        20.063747997658, 20.052498349215, 20.041248700773, 20.029999052331, 20.018749403888, 20.007499755446,
-        19.996250107004, 19.985000458562, 19.973750810119, 19.962501161677, 19.951251513235, 19.940001864793,
-        19.928752216350, 19.917502567908, 19.906252919466, 19.895003271024, 19.883753622581, 19.872503974139,
-        19.861254325697, 19.850004677254, 19.838755028812, 19.827505380370, 19.816255731928, 19.805006083485,
-        19.793756435043, 19.782506786601, 19.771257138158, 19.760007489716, 19.748757841274, 19.737508192832,
-        19.726258544389, 19.715008895947, 19.703759247505, 19.692509599062, 19.681259950620, 19.670010302178,
-        19.658760653736, 19.647511005293, 19.636261356851, 19.625011708409, 19.613762059966, 19.602512411524,
-        19.591262763082, 19.580013114640, 19.568763466197, 19.557513817755, 19.546264169313, 19.535014520870,
-        19.523764872428, 19.512515223986, 19.501265575543, 19.490015927101, 19.478766278659, 19.467516630216,
-        19.456266981774, 19.445017333332, 19.433767684890, 19.422518036447, 19.411268388005, 19.400018739563,
-        19.388769091120, 19.377519442678, 19.366269794236, 19.355020145793, 19.343770497351, 19.332520848909,
-        19.321271200466, 19.310021552024, 19.298771903582, 19.287522255139, 19.276272606697, 19.265022958255,
-        19.253773309812, 19.242523661370, 19.231274012928, 19.220024364486, 19.208774716043, 19.197525067601,
-        19.186275419159, 19.175025770716, 19.163776122274, 19.152526473832, 19.141276825389, 19.130027176947,
-        19.118777528505, 19.107527880062, 19.096278231620, 19.085028583178, 19.073778934735, 19.062529286293,
-        19.051279637851, 19.040029989408, 19.028780340966, 19.017530692524, 19.006281044081, 18.995031395639,
-        18.983781747196, 18.972532098754, 18.961282450312, 18.950032801869, 18.938783153427, 18.927533504985,
-        18.916283856542, 18.905034208100, 18.893784559658, 18.882534911215, 18.871285262773, 18.860035614331,
-        18.848785965888, 18.837536317446, 18.826286669004, 18.815037020561, 18.803787372119, 18.792537723677,
-        18.781288075234, 18.770038426792, 18.758788778349, 18.747539129907, 18.736289481465, 18.725039833022,
-        18.713790184580, 18.702540536138, 18.691290887695, 18.680041239253, 18.668791590811, 18.657541942368,
-        18.646292293926, 18.635042645483, 18.623792997041, 18.612543348599, 18.601293700156, 18.590044051714,
-        18.578794403272, 18.567544754829, 18.556295106387, 18.545045457944, 18.533795809502, 18.522546161060,
-        18.511296512617, 18.500046864175, 18.488797215733, 18.477547567290, 18.466297918848, 18.455048270405,
-        18.443798621963, 18.432548973521, 18.421299325078, 18.410049676636, 18.398800028194, 18.387550379751,
-        18.376300731309, 18.365051082866, 18.353801434424, 18.342551785982, 18.331302137539, 18.320052489097,
-        18.308802840654, 18.297553192212, 18.286303543770, 18.275053895327, 18.263804246885, 18.252554598442,
-        18.241304950000, 18.230055301558, 18.218805653115, 18.207556004673, 18.196306356230, 18.185056707788,
-        18.173807059346, 18.162557410903, 18.151307762461, 18.140058114018, 18.128808465576, 18.117558817134,
-        18.106309168691, 18.095059520249, 18.083809871806, 18.072560223364, 18.061310574922, 18.050060926479,
-        18.038811278037, 18.027561629594, 18.016311981152, 18.005062332710, 17.993812684267, 17.982563035825,
-        17.971313387382, 17.960063738940, 17.948814090497, 17.937564442055, 17.926314793613, 17.915065145170,
-        17.903815496728, 17.892565848285, 17.881316199843, 17.870066551401, 17.858816902958, 17.847567254516,
-        17.836317606073, 17.825067957631, 17.813818309188, 17.802568660746, 17.791319012304, 17.780069363861,
-        17.768819715419, 17.757570066976, 17.746320418534, 17.735070770091, 17.723821121649, 17.712571473207,
-        17.701321824764, 17.690072176322, 17.678822527879, 17.667572879437, 17.656323230994, 17.645073582552,
-        17.633823934110, 17.622574285667, 17.611324637225, 17.600074988782, 17.588825340340, 17.577575691897,
-        17.566326043455, 17.555076395012, 17.543826746570, 17.532577098128, 17.521327449685, 17.510077801243,
-        17.498828152800, 17.487578504358, 17.476328855915, 17.465079207473, 17.453829559030, 17.442579910588,
-        17.431330262145, 17.420080613703, 17.408830965261, 17.397581316818, 17.386331668376, 17.375082019933,
-        17.363832371491, 17.352582723048, 17.341333074606, 17.330083426163, 17.318833777721, 17.307584129278,
-        17.296334480836, 17.285084832394, 17.273835183951, 17.262585535509, 17.251335887066, 17.240086238624,
-        17.228836590181, 17.217586941739, 17.206337293296, 17.195087644854, 17.183837996411, 17.172588347969,
-        17.161338699526, 17.150089051084, 17.138839402641, 17.127589754199, 17.116340105757, 17.105090457314,
-        17.093840808872, 17.082591160429, 17.071341511987, 17.060091863544, 17.048842215102, 17.037592566659,
-        17.026342918217, 17.015093269774, 17.003843621332, 16.992593972889, 16.981344324447, 16.970094676004,
-        16.958845027562, 16.947595379119, 16.936345730677, 16.925096082234, 16.913846433792, 16.902596785349,
-        16.891347136907, 16.880097488464, 16.868847840022, 16.857598191579, 16.846348543137, 16.835098894695,
-        16.823849246252, 16.812599597810, 16.801349949367, 16.790100300925, 16.778850652482, 16.767601004040,
-        16.756351355597, 16.745101707155, 16.733852058712, 16.722602410270, 16.711352761827, 16.700103113385,
-        16.688853464942, 16.677603816500, 16.666354168057, 16.655104519615, 16.643854871172, 16.632605222730,
-        16.621355574287, 16.610105925845, 16.598856277402, 16.587606628960, 16.576356980517, 16.565107332075,
-        16.553857683632, 16.542608035190, 16.531358386747, 16.520108738305, 16.508859089862, 16.497609441419,
-        16.486359792977, 16.475110144534, 16.463860496092, 16.452610847649, 16.441361199207, 16.430111550764,
-        16.418861902322, 16.407612253879, 16.396362605437, 16.385112956994, 16.373863308552, 16.362613660109,
-        16.351364011667, 16.340114363224, 16.328864714782, 16.317615066339, 16.306365417897, 16.295115769454,
-        16.283866121012, 16.272616472569, 16.261366824127, 16.250117175684, 16.238867527242, 16.227617878799,
-        16.216368230356, 16.205118581914, 16.193868933471, 16.182619285029, 16.171369636586, 16.160119988144,
-        16.148870339701, 16.137620691259, 16.126371042816, 16.115121394374, 16.103871745931, 16.092622097489,
-        16.081372449046, 16.070122800604, 16.058873152161, 16.047623503718, 16.036373855276, 16.025124206833,
-        16.013874558391, 16.002624909948, 15.991375261506, 15.980125613063, 15.968875964621, 15.957626316178,
-        15.946376667736, 15.935127019293, 15.923877370851, 15.912627722408, 15.901378073965, 15.890128425523,
-        15.878878777080, 15.867629128638, 15.856379480195, 15.845129831753, 15.833880183310, 15.822630534868,
-        15.811380886425, 15.800131237982, 15.788881589540, 15.777631941097, 15.766382292655, 15.755132644212,
-        15.743882995770, 15.732633347327, 15.721383698885, 15.710134050442, 15.698884401999, 15.687634753557,
-        15.676385105114, 15.665135456672, 15.653885808229, 15.642636159787, 15.631386511344, 15.620136862902,
-        15.608887214459, 15.597637566016, 15.586387917574, 15.575138269131, 15.563888620689, 15.552638972246,
-        15.541389323804, 15.530139675361, 15.518890026918, 15.507640378476, 15.496390730033, 15.485141081591,
-        15.473891433148, 15.462641784706, 15.451392136263, 15.440142487820, 15.428892839378, 15.417643190935,
-        15.406393542493, 15.395143894050, 15.383894245608, 15.372644597165, 15.361394948722, 15.350145300280,
-        15.338895651837, 15.327646003395, 15.316396354952, 15.305146706509, 15.293897058067, 15.282647409624,
-        15.271397761182, 15.260148112739, 15.248898464297, 15.237648815854, 15.226399167411, 15.215149518969,
-        15.203899870526, 15.192650222084, 15.181400573641, 15.170150925198, 15.158901276756, 15.147651628313,
-        15.136401979871, 15.125152331428, 15.113902682985, 15.102653034543, 15.091403386100, 15.080153737658,
-        15.068904089215, 15.057654440773, 15.046404792330, 15.035155143887, 15.023905495445, 15.012655847002,
-        15.001406198560, 14.990156550117, 14.978906901674, 14.967657253232, 14.956407604789, 14.945157956347,
-        14.933908307904, 14.922658659461, 14.911409011019, 14.900159362576, 14.888909714134, 14.877660065691,
-        14.866410417248, 14.855160768806, 14.843911120363, 14.832661471920, 14.821411823478, 14.810162175035,
-        14.798912526593, 14.787662878150, 14.776413229707, 14.765163581265, 14.753913932822, 14.742664284380,
-        14.731414635937, 14.720164987494, 14.708915339052, 14.697665690609, 14.686416042167, 14.675166393724,
-        14.663916745281, 14.652667096839, 14.641417448396, 14.630167799953, 14.618918151511, 14.607668503068,
-        14.596418854626, 14.585169206183, 14.573919557740, 14.562669909298, 14.551420260855, 14.540170612412,
-        14.528920963970, 14.517671315527, 14.506421667085, 14.495172018642, 14.483922370199, 14.472672721757,
-        14.461423073314, 14.450173424871, 14.438923776429, 14.427674127986, 14.416424479544, 14.405174831101,
-        14.393925182658, 14.382675534216, 14.371425885773, 14.360176237330, 14.348926588888, 14.337676940445,
-        14.326427292002, 14.315177643560, 14.303927995117, 14.292678346675, 14.281428698232, 14.270179049789,
-        14.258929401347, 14.247679752904, 14.236430104461, 14.225180456019, 14.213930807576, 14.202681159133,
-        14.191431510691, 14.180181862248, 14.168932213806, 14.157682565363, 14.146432916920, 14.135183268478,
-        14.123933620035, 14.112683971592, 14.101434323150, 14.090184674707, 14.078935026264, 14.067685377822,
-        14.056435729379, 14.045186080936, 14.033936432494, 14.022686784051, 14.011437135608, 14.000187487166,
-        13.988937838723, 13.977688190281, 13.966438541838, 13.955188893395, 13.943939244953, 13.932689596510,
-        13.921439948067, 13.910190299625, 13.898940651182, 13.887691002739, 13.876441354297, 13.865191705854,
-        13.853942057411, 13.842692408969, 13.831442760526, 13.820193112083, 13.808943463641, 13.797693815198,
-        13.786444166755, 13.775194518313, 13.763944869870, 13.752695221427, 13.741445572985, 13.730195924542,
-        13.718946276099, 13.707696627657, 13.696446979214, 13.685197330771, 13.673947682329, 13.662698033886,
-        13.651448385443, 13.640198737001, 13.628949088558, 13.617699440115, 13.606449791673, 13.595200143230,
-        13.583950494787, 13.572700846345, 13.561451197902, 13.550201549459, 13.538951901017, 13.527702252574,
-        13.516452604131, 13.505202955689, 13.493953307246, 13.482703658803, 13.471454010361, 13.460204361918,
-        13.448954713475, 13.437705065033, 13.426455416590, 13.415205768147, 13.403956119704, 13.392706471262,
-        13.381456822819, 13.370207174376, 13.358957525934, 13.347707877491, 13.336458229048, 13.325208580606,
-        13.313958932163, 13.302709283720, 13.291459635278, 13.280209986835, 13.268960338392, 13.257710689950,
-        13.246461041507, 13.235211393064, 13.223961744622, 13.212712096179, 13.201462447736, 13.190212799293,
-        13.178963150851, 13.167713502408, 13.156463853965, 13.145214205523, 13.133964557080, 13.122714908637,
-        13.111465260195, 13.100215611752, 13.088965963309, 13.077716314867, 13.066466666424, 13.055217017981,
-        13.043967369538, 13.032717721096, 13.021468072653, 13.010218424210, 12.998968775768, 12.987719127325,
-        12.976469478882, 12.965219830440, 12.953970181997, 12.942720533554, 12.931470885111, 12.920221236669,
-        12.908971588226, 12.897721939783, 12.886472291341, 12.875222642898, 12.863972994455, 12.852723346012,
-        12.841473697570, 12.830224049127, 12.818974400684, 12.807724752242, 12.796475103799, 12.785225455356,
-        12.773975806913, 12.762726158471, 12.751476510028, 12.740226861585, 12.728977213143, 12.717727564700,
-        12.706477916257, 12.695228267815, 12.683978619372, 12.672728970929, 12.661479322486, 12.650229674044,
-        12.638980025601, 12.627730377158, 12.616480728715, 12.605231080273, 12.593981431830, 12.582731783387,
-        12.571482134945, 12.560232486502, 12.548982838059, 12.537733189616, 12.526483541174, 12.515233892731,
-        12.503984244288, 12.492734595846, 12.481484947403, 12.470235298960, 12.458985650517, 12.447736002075,
-        12.436486353632, 12.425236705189, 12.413987056746, 12.402737408304, 12.391487759861, 12.380238111418,
-        12.368988462976, 12.357738814533, 12.346489166090, 12.335239517647, 12.323989869205, 12.312740220762,
-        12.301490572319, 12.290240923876, 12.278991275434, 12.267741626991, 12.256491978548, 12.245242330106,
-        12.233992681663, 12.222743033220, 12.211493384777, 12.200243736335, 12.188994087892, 12.177744439449,
-        12.166494791006, 12.155245142564, 12.143995494121, 12.132745845678, 12.121496197235, 12.110246548793,
-        12.098996900350, 12.087747251907, 12.076497603464, 12.065247955022, 12.053998306579, 12.042748658136,
-        12.031499009693, 12.020249361251, 12.008999712808, 11.997750064365, 11.986500415922, 11.975250767480,
-        11.964001119037, 11.952751470594, 11.941501822152, 11.930252173709, 11.919002525266, 11.907752876823,
-        11.896503228381, 11.885253579938, 11.874003931495, 11.862754283052, 11.851504634610, 11.840254986167,
-        11.829005337724, 11.817755689281, 11.806506040839, 11.795256392396, 11.784006743953, 11.772757095510,
-        11.761507447067, 11.750257798625, 11.739008150182, 11.727758501739, 11.716508853296, 11.705259204854,
-        11.694009556411, 11.682759907968, 11.671510259525, 11.660260611083, 11.649010962640, 11.637761314197,
-        11.626511665754, 11.615262017312, 11.604012368869, 11.592762720426, 11.581513071983, 11.570263423541,
-        11.559013775098, 11.547764126655, 11.536514478212, 11.525264829770, 11.514015181327, 11.502765532884,
-        11.491515884441, 11.480266235998, 11.469016587556, 11.457766939113, 11.446517290670, 11.435267642227,
-        11.424017993785, 11.412768345342, 11.401518696899, 11.390269048456, 11.379019400014, 11.367769751571,
-        11.356520103128, 11.345270454685, 11.334020806242, 11.322771157800, 11.311521509357, 11.300271860914,
-        11.289022212471, 11.277772564029, 11.266522915586, 11.255273267143, 11.244023618700, 11.232773970257,
-        11.221524321815, 11.210274673372, 11.199025024929, 11.187775376486, 11.176525728044, 11.165276079601,
-        11.154026431158, 11.142776782715, 11.131527134272, 11.120277485830, 11.109027837387, 11.097778188944,
-        11.086528540501, 11.075278892059, 11.064029243616, 11.052779595173, 11.041529946730, 11.030280298287,
-        11.019030649845, 11.007781001402, 10.996531352959, 10.985281704516, 10.974032056074, 10.962782407631,
-        10.951532759188, 10.940283110745, 10.929033462302, 10.917783813860, 10.906534165417, 10.895284516974,
-        10.884034868531, 10.872785220088, 10.861535571646, 10.850285923203, 10.839036274760, 10.827786626317,
-        10.816536977874, 10.805287329432, 10.794037680989, 10.782788032546, 10.771538384103, 10.760288735660,
-        10.749039087218, 10.737789438775, 10.726539790332, 10.715290141889, 10.704040493446, 10.692790845004,
-        10.681541196561, 10.670291548118, 10.659041899675, 10.647792251233, 10.636542602790, 10.625292954347,
-        10.614043305904, 10.602793657461, 10.591544009019, 10.580294360576, 10.569044712133, 10.557795063690,
-        10.546545415247, 10.535295766804, 10.524046118362, 10.512796469919, 10.501546821476, 10.490297173033,
-        10.479047524590, 10.467797876148, 10.456548227705, 10.445298579262, 10.434048930819, 10.422799282376,
-        10.411549633934, 10.400299985491, 10.389050337048, 10.377800688605, 10.366551040162, 10.355301391720,
-        10.344051743277, 10.332802094834, 10.321552446391, 10.310302797948, 10.299053149506, 10.287803501063,
-        10.276553852620, 10.265304204177, 10.254054555734, 10.242804907291, 10.231555258849, 10.220305610406,
-        10.209055961963, 10.197806313520, 10.186556665077, 10.175307016635, 10.164057368192, 10.152807719749,
-        10.141558071306, 10.130308422863, 10.119058774420, 10.107809125978, 10.096559477535, 10.085309829092,
-        10.074060180649, 10.062810532206, 10.051560883764, 10.040311235321, 10.029061586878, 10.017811938435,
-        10.006562289992, 9.995312641549, 9.984062993107, 9.972813344664, 9.961563696221, 9.950314047778, 9.939064399335,
-        9.927814750893, 9.916565102450, 9.905315454007, 9.894065805564, 9.882816157121, 9.871566508678, 9.860316860236,
-        9.849067211793, 9.837817563350, 9.826567914907, 9.815318266464, 9.804068618021, 9.792818969579, 9.781569321136,
-        9.770319672693, 9.759070024250, 9.747820375807, 9.736570727364, 9.725321078922, 9.714071430479, 9.702821782036,
-        9.691572133593, 9.680322485150, 9.669072836707, 9.657823188265, 9.646573539822, 9.635323891379, 9.624074242936,
-        9.612824594493, 9.601574946050, 9.590325297608, 9.579075649165, 9.567826000722, 9.556576352279, 9.545326703836,
-        9.534077055393, 9.522827406951, 9.511577758508, 9.500328110065, 9.489078461622, 9.477828813179, 9.466579164736,
-        9.455329516294, 9.444079867851, 9.432830219408, 9.421580570965, 9.410330922522, 9.399081274079, 9.387831625636,
-        9.376581977194, 9.365332328751, 9.354082680308, 9.342833031865, 9.331583383422, 9.320333734979, 9.309084086537,
-        9.297834438094, 9.286584789651, 9.275335141208, 9.264085492765, 9.252835844322, 9.241586195879, 9.230336547437,
-        9.219086898994, 9.207837250551, 9.196587602108, 9.185337953665, 9.174088305222, 9.162838656780, 9.151589008337,
-        9.140339359894, 9.129089711451, 9.117840063008, 9.106590414565, 9.095340766122, 9.084091117680, 9.072841469237,
-        9.061591820794, 9.050342172351, 9.039092523908, 9.027842875465, 9.016593227022, 9.005343578580, 8.994093930137,
-        8.982844281694, 8.971594633251, 8.960344984808, 8.949095336365, 8.937845687922, 8.926596039480, 8.915346391037,
-        8.904096742594, 8.892847094151, 8.881597445708, 8.870347797265, 8.859098148822, 8.847848500380, 8.836598851937,
-        8.825349203494, 8.814099555051, 8.802849906608, 8.791600258165, 8.780350609722, 8.769100961280, 8.757851312837,
-        8.746601664394, 8.735352015951, 8.724102367508, 8.712852719065, 8.701603070622, 8.690353422180, 8.679103773737,
-        8.667854125294, 8.656604476851, 8.645354828408, 8.634105179965, 8.622855531522, 8.611605883079, 8.600356234637,
-        8.589106586194, 8.577856937751, 8.566607289308, 8.555357640865, 8.544107992422, 8.532858343979, 8.521608695537,
-        8.510359047094, 8.499109398651, 8.487859750208, 8.476610101765, 8.465360453322, 8.454110804879, 8.442861156436,
-        8.431611507994, 8.420361859551, 8.409112211108, 8.397862562665, 8.386612914222, 8.375363265779, 8.364113617336,
-        8.352863968893, 8.341614320451, 8.330364672008, 8.319115023565, 8.307865375122, 8.296615726679, 8.285366078236,
-        8.274116429793, 8.262866781350, 8.251617132908, 8.240367484465, 8.229117836022, 8.217868187579, 8.206618539136,
-        8.195368890693, 8.184119242250, 8.172869593807, 8.161619945364, 8.150370296922, 8.139120648479, 8.127871000036,
-        8.116621351593, 8.105371703150, 8.094122054707, 8.082872406264, 8.071622757821, 8.060373109379, 8.049123460936,
-        8.037873812493, 8.026624164050, 8.015374515607, 8.004124867164, 7.992875218721, 7.981625570278, 7.970375921835,
-        7.959126273393, 7.947876624950, 7.936626976507, 7.925377328064, 7.914127679621, 7.902878031178, 7.891628382735,
-        7.880378734292, 7.869129085849, 7.857879437407, 7.846629788964, 7.835380140521, 7.824130492078, 7.812880843635,
-        7.801631195192, 7.790381546749, 7.779131898306, 7.767882249863, 7.756632601421, 7.745382952978, 7.734133304535,
-        7.722883656092, 7.711634007649, 7.700384359206, 7.689134710763, 7.677885062320, 7.666635413877, 7.655385765435,
-        7.644136116992, 7.632886468549, 7.621636820106, 7.610387171663, 7.599137523220, 7.587887874777, 7.576638226334,
-        7.565388577891, 7.554138929449, 7.542889281006, 7.531639632563, 7.520389984120, 7.509140335677, 7.497890687234,
-        7.486641038791, 7.475391390348, 7.464141741905, 7.452892093462, 7.441642445020, 7.430392796577, 7.419143148134,
-        7.407893499691, 7.396643851248, 7.385394202805, 7.374144554362, 7.362894905919, 7.351645257476, 7.340395609033,
-        7.329145960591, 7.317896312148, 7.306646663705, 7.295397015262, 7.284147366819, 7.272897718376, 7.261648069933,
-        7.250398421490, 7.239148773047, 7.227899124604, 7.216649476161, 7.205399827719, 7.194150179276, 7.182900530833,
-        7.171650882390, 7.160401233947, 7.149151585504, 7.137901937061, 7.126652288618, 7.115402640175, 7.104152991732,
-        7.092903343289, 7.081653694847, 7.070404046404, 7.059154397961, 7.047904749518, 7.036655101075, 7.025405452632,
-        7.014155804189, 7.002906155746, 6.991656507303, 6.980406858860, 6.969157210417, 6.957907561975, 6.946657913532,
-        6.935408265089, 6.924158616646, 6.912908968203, 6.901659319760, 6.890409671317, 6.879160022874, 6.867910374431,
-        6.856660725988, 6.845411077545, 6.834161429103, 6.822911780660, 6.811662132217, 6.800412483774, 6.789162835331,
-        6.777913186888, 6.766663538445, 6.755413890002, 6.744164241559, 6.732914593116, 6.721664944673, 6.710415296230,
-        6.699165647788, 6.687915999345, 6.676666350902, 6.665416702459, 6.654167054016, 6.642917405573, 6.631667757130,
-        6.620418108687, 6.609168460244, 6.597918811801, 6.586669163358, 6.575419514915, 6.564169866473, 6.552920218030,
-        6.541670569587, 6.530420921144, 6.519171272701, 6.507921624258, 6.496671975815, 6.485422327372, 6.474172678929,
-        6.462923030486, 6.451673382043, 6.440423733600, 6.429174085157, 6.417924436715, 6.406674788272, 6.395425139829,
-        6.384175491386, 6.372925842943, 6.361676194500, 6.350426546057, 6.339176897614, 6.327927249171, 6.316677600728,
-        6.305427952285, 6.294178303842, 6.282928655399, 6.271679006956, 6.260429358514, 6.249179710071, 6.237930061628,
-        6.226680413185, 6.215430764742, 6.204181116299, 6.192931467856, 6.181681819413, 6.170432170970, 6.159182522527,
-        6.147932874084, 6.136683225641, 6.125433577198, 6.114183928755, 6.102934280313, 6.091684631870, 6.080434983427,
-        6.069185334984, 6.057935686541, 6.046686038098, 6.035436389655, 6.024186741212, 6.012937092769, 6.001687444326,
-        5.990437795883, 5.979188147440, 5.967938498997, 5.956688850554, 5.945439202112, 5.934189553669, 5.922939905226,
-        5.911690256783, 5.900440608340, 5.889190959897, 5.877941311454, 5.866691663011, 5.855442014568, 5.844192366125,
-        5.832942717682, 5.821693069239, 5.810443420796, 5.799193772353, 5.787944123910, 5.776694475467, 5.765444827025,
-        5.754195178582, 5.742945530139, 5.731695881696, 5.720446233253, 5.709196584810, 5.697946936367, 5.686697287924,
-        5.675447639481, 5.664197991038, 5.652948342595, 5.641698694152, 5.630449045709, 5.619199397266, 5.607949748823,
-        5.596700100380, 5.585450451938, 5.574200803495, 5.562951155052, 5.551701506609, 5.540451858166, 5.529202209723,
-        5.517952561280, 5.506702912837, 5.495453264394, 5.484203615951, 5.472953967508, 5.461704319065, 5.450454670622,
-        5.439205022179, 5.427955373736, 5.416705725293, 5.405456076850, 5.394206428407, 5.382956779965, 5.371707131522,
-        5.360457483079, 5.349207834636, 5.337958186193, 5.326708537750, 5.315458889307, 5.304209240864, 5.292959592421,
-        5.281709943978, 5.270460295535, 5.259210647092, 5.247960998649, 5.236711350206, 5.225461701763, 5.214212053320,
-        5.202962404877, 5.191712756434, 5.180463107992, 5.169213459549, 5.157963811106, 5.146714162663, 5.135464514220,
-        5.124214865777, 5.112965217334, 5.101715568891, 5.090465920448, 5.079216272005, 5.067966623562, 5.056716975119,
-        5.045467326676, 5.034217678233, 5.022968029790, 5.011718381347, 5.000468732904, 4.989219084461, 4.977969436018,
-        4.966719787575, 4.955470139133, 4.944220490690, 4.932970842247, 4.921721193804, 4.910471545361, 4.899221896918,
-        4.887972248475, 4.876722600032, 4.865472951589, 4.854223303146, 4.842973654703, 4.831724006260, 4.820474357817,
-        4.809224709374, 4.797975060931, 4.786725412488, 4.775475764045, 4.764226115602, 4.752976467159, 4.741726818716,
-        4.730477170273, 4.719227521830, 4.707977873388, 4.696728224945, 4.685478576502, 4.674228928059, 4.662979279616,
-        4.651729631173, 4.640479982730, 4.629230334287, 4.617980685844, 4.606731037401, 4.595481388958, 4.584231740515,
-        4.572982092072, 4.561732443629, 4.550482795186, 4.539233146743, 4.527983498300, 4.516733849857, 4.505484201414,
-        4.494234552971, 4.482984904528, 4.471735256085, 4.460485607642, 4.449235959199, 4.437986310757, 4.426736662314,
-        4.415487013871, 4.404237365428, 4.392987716985, 4.381738068542, 4.370488420099, 4.359238771656, 4.347989123213,
-        4.336739474770, 4.325489826327, 4.314240177884, 4.302990529441, 4.291740880998, 4.280491232555, 4.269241584112,
-        4.257991935669, 4.246742287226, 4.235492638783, 4.224242990340, 4.212993341897, 4.201743693454, 4.190494045011,
-        4.179244396568, 4.167994748125, 4.156745099682, 4.145495451240, 4.134245802797, 4.122996154354, 4.111746505911,
-        4.100496857468, 4.089247209025, 4.077997560582, 4.066747912139, 4.055498263696, 4.044248615253, 4.032998966810,
-        4.021749318367, 4.010499669924, 3.999250021481, 3.988000373038, 3.976750724595, 3.965501076152, 3.954251427709,
-        3.943001779266, 3.931752130823, 3.920502482380, 3.909252833937, 3.898003185494, 3.886753537051, 3.875503888608,
-        3.864254240165, 3.853004591722, 3.841754943279, 3.830505294836, 3.819255646393, 3.808005997951, 3.796756349508,
-        3.785506701065, 3.774257052622, 3.763007404179, 3.751757755736, 3.740508107293, 3.729258458850, 3.718008810407,
-        3.706759161964, 3.695509513521, 3.684259865078, 3.673010216635, 3.661760568192, 3.650510919749, 3.639261271306,
-        3.628011622863, 3.616761974420, 3.605512325977, 3.594262677534, 3.583013029091, 3.571763380648, 3.560513732205,
-        3.549264083762, 3.538014435319, 3.526764786876, 3.515515138433, 3.504265489990, 3.493015841547, 3.481766193104,
-        3.470516544661, 3.459266896218, 3.448017247775, 3.436767599332, 3.425517950889, 3.414268302447, 3.403018654004,
-        3.391769005561, 3.380519357118, 3.369269708675, 3.358020060232, 3.346770411789, 3.335520763346, 3.324271114903,
-        3.313021466460, 3.301771818017, 3.290522169574, 3.279272521131, 3.268022872688, 3.256773224245, 3.245523575802,
-        3.234273927359, 3.223024278916, 3.211774630473, 3.200524982030, 3.189275333587, 3.178025685144, 3.166776036701,
-        3.155526388258, 3.144276739815, 3.133027091372, 3.121777442929, 3.110527794486, 3.099278146043, 3.088028497600,
-        3.076778849157, 3.065529200714, 3.054279552271, 3.043029903828, 3.031780255385, 3.020530606942, 3.009280958499,
-        2.998031310056, 2.986781661613, 2.975532013170, 2.964282364727, 2.953032716284, 2.941783067841, 2.930533419399,
-        2.919283770956, 2.908034122513, 2.896784474070, 2.885534825627, 2.874285177184, 2.863035528741, 2.851785880298,
-        2.840536231855, 2.829286583412, 2.818036934969, 2.806787286526, 2.795537638083, 2.784287989640, 2.773038341197,
-        2.761788692754, 2.750539044311, 2.739289395868, 2.728039747425, 2.716790098982, 2.705540450539, 2.694290802096,
-        2.683041153653, 2.671791505210, 2.660541856767, 2.649292208324, 2.638042559881, 2.626792911438, 2.615543262995,
-        2.604293614552, 2.593043966109, 2.581794317666, 2.570544669223, 2.559295020780, 2.548045372337, 2.536795723894,
-        2.525546075451, 2.514296427008, 2.503046778565, 2.491797130122, 2.480547481679, 2.469297833236, 2.458048184793,
-        2.446798536350, 2.435548887907, 2.424299239464, 2.413049591021, 2.401799942578, 2.390550294135, 2.379300645692,
-        2.368050997249, 2.356801348806, 2.345551700363, 2.334302051920, 2.323052403478, 2.311802755035, 2.300553106592,
-        2.289303458149, 2.278053809706, 2.266804161263, 2.255554512820, 2.244304864377, 2.233055215934, 2.221805567491,
-        2.210555919048, 2.199306270605, 2.188056622162, 2.176806973719, 2.165557325276, 2.154307676833, 2.143058028390,
-        2.131808379947, 2.120558731504, 2.109309083061, 2.098059434618, 2.086809786175, 2.075560137732, 2.064310489289,
-        2.053060840846, 2.041811192403, 2.030561543960, 2.019311895517, 2.008062247074, 1.996812598631, 1.985562950188,
-        1.974313301745, 1.963063653302, 1.951814004859, 1.940564356416, 1.929314707973, 1.918065059530, 1.906815411087,
-        1.895565762644, 1.884316114201, 1.873066465758, 1.861816817315, 1.850567168872, 1.839317520429, 1.828067871986,
-        1.816818223543, 1.805568575100, 1.794318926657, 1.783069278214, 1.771819629771, 1.760569981328, 1.749320332885,
-        1.738070684442, 1.726821035999, 1.715571387556, 1.704321739113, 1.693072090670, 1.681822442227, 1.670572793784,
-        1.659323145341, 1.648073496898, 1.636823848455, 1.625574200012, 1.614324551569, 1.603074903126, 1.591825254683,
-        1.580575606240, 1.569325957797, 1.558076309354, 1.546826660911, 1.535577012468, 1.524327364025, 1.513077715582,
-        1.501828067139, 1.490578418696, 1.479328770253, 1.468079121810, 1.456829473367, 1.445579824924, 1.434330176482,
-        1.423080528039, 1.411830879596, 1.400581231153, 1.389331582710, 1.378081934267, 1.366832285824, 1.355582637381,
-        1.344332988938, 1.333083340495, 1.321833692052, 1.310584043609, 1.299334395166, 1.288084746723, 1.276835098280,
-        1.265585449837, 1.254335801394, 1.243086152951, 1.231836504508, 1.220586856065, 1.209337207622, 1.198087559179,
-        1.186837910736, 1.175588262293, 1.164338613850, 1.153088965407, 1.141839316964, 1.130589668521, 1.119340020078,
-        1.108090371635, 1.096840723192, 1.085591074749, 1.074341426306, 1.063091777863, 1.051842129420, 1.040592480977,
-        1.029342832534, 1.018093184091, 1.006843535648, 0.995593887205, 0.984344238762, 0.973094590319, 0.961844941876,
-        0.950595293433, 0.939345644990, 0.928095996547, 0.916846348104, 0.905596699661, 0.894347051218, 0.883097402775,
-        0.871847754332, 0.860598105889, 0.849348457446, 0.838098809003, 0.826849160560, 0.815599512117, 0.804349863674,
-        0.793100215231, 0.781850566788, 0.770600918345, 0.759351269902, 0.748101621459, 0.736851973016, 0.725602324573,
-        0.714352676130, 0.703103027687, 0.691853379244, 0.680603730801, 0.669354082358, 0.658104433915, 0.646854785472,
-        0.635605137029, 0.624355488586, 0.613105840143, 0.601856191700, 0.590606543257, 0.579356894814, 0.568107246371,
-        0.556857597928, 0.545607949485, 0.534358301042, 0.523108652599, 0.511859004156, 0.500609355713, 0.489359707270,
-        0.478110058827, 0.466860410384, 0.455610761941, 0.444361113498, 0.433111465055, 0.421861816612, 0.410612168169,
-        0.399362519726, 0.388112871283, 0.376863222840, 0.365613574397, 0.354363925954, 0.343114277511, 0.331864629068,
-        0.320614980625, 0.309365332182, 0.298115683739, 0.286866035296, 0.275616386853, 0.264366738410, 0.253117089967,
-        0.241867441524, 0.230617793081, 0.219368144638, 0.208118496195, 0.196868847752, 0.185619199309, 0.174369550866,
-        0.163119902423, 0.151870253980, 0.140620605537, 0.129370957094, 0.118121308651, 0.106871660208, 0.095622011765,
-        0.084372363322, 0.073122714879, 0.061873066436, 0.050623417993, 0.039373769550, 0.028124121107, 0.016874472664,
-        0.005624824221 ) )
-
-}  // namespace gaussian
-}  // namespace spacing
-}  // namespace grid
-}  // namespace atlas
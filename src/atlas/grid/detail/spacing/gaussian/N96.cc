@@ -1,31 +0,0 @@
-// TL191
-
-#include "atlas/grid/detail/spacing/gaussian/N.h"
-
-namespace atlas {
-namespace grid {
-namespace spacing {
-namespace gaussian {
-
-DEFINE_GAUSSIAN_LATITUDES(
-    96, LIST( 89.284227532514, 88.357003518665, 87.424303746070, 86.490366766281, 85.555960484893, 84.621327107649,
-              83.686566816564, 82.751728473431, 81.816838728603, 80.881913346797, 79.946962247386, 79.011991982672,
-              78.077007054304, 77.142010657054, 76.207005120861, 75.271992184860, 74.336973173452, 73.401949112957,
-              72.466920811004, 71.531888911827, 70.596853935603, 69.661816306938, 68.726776375860, 67.791734433501,
-              66.856690723993, 65.921645453587, 64.986598797727, 64.051550906600, 63.116501909529, 62.181451918473,
-              61.246401030854, 60.311349331843, 59.376296896232, 58.441243789970, 57.506190071435, 56.571135792495,
-              55.636080999393, 54.701025733491, 53.765970031901, 52.830913928020, 51.895857451987, 50.960800631070,
-              50.025743490008, 49.090686051296, 48.155628335437, 47.220570361160, 46.285512145613, 45.350453704525,
-              44.415395052354, 43.480336202416, 42.545277166998, 41.610217957456, 40.675158584305, 39.740099057298,
-              38.805039385498, 37.869979577337, 36.934919640674, 35.999859582846, 35.064799410712, 34.129739130695,
-              33.194678748816, 32.259618270730, 31.324557701757, 30.389497046905, 29.454436310897, 28.519375498194,
-              27.584314613017, 26.649253659362, 25.714192641019, 24.779131561590, 23.844070424500, 22.909009233010,
-              21.973947990236, 21.038886699150, 20.103825362598, 19.168763983309, 18.233702563901, 17.298641106891,
-              16.363579614703, 15.428518089674, 14.493456534065, 13.558394950061, 12.623333339782, 11.688271705287,
-              10.753210048579, 9.818148371612, 8.883086676292, 7.948024964486, 7.012963238024, 6.077901498705,
-              5.142839748298, 4.207777988549, 3.272716221183, 2.337654447911, 1.402592670428, 0.467530890423 ) )
-
-}  // namespace gaussian
-}  // namespace spacing
-}  // namespace grid
-}  // namespace atlas
@@ -37,6 +37,13 @@ public:
     void execute( const FieldSet& source, FieldSet& target ) const { get()->execute( source, target ); }
     void execute( const Field& source, Field& target ) const { get()->execute( source, target ); }
 
+    /// @brief Recompute interpolation weights for new target points, e.g. moving observations,
+    /// keeping the search structures of the source
+    void updateTarget( const FunctionSpace& target ) { implementation_->updateTarget( target ); }
+
+    void execute_adjoint( FieldSet& source, const FieldSet& target ) const { get()->execute_adjoint( source, target ); }
+    void execute_adjoint( Field& source, const Field& target ) const { get()->execute_adjoint( source, target ); }
+
     const Implementation* get() const { return implementation_.get(); }
 
     operator bool() const { return implementation_; }
@@ -47,7 +54,7 @@ public:
     const FunctionSpace& target() const { return implementation_->target(); }
 
 private:
-    eckit::SharedPtr<const Implementation> implementation_;
+    eckit::SharedPtr<Implementation> implementation_;
 };
 
 /// C-interface
@@ -70,6 +77,10 @@ void atlas__Interpolation__execute_field( Interpolation::Implementation* This, c
                                           field::FieldImpl* target );
 void atlas__Interpolation__execute_fieldset( Interpolation::Implementation* This, const field::FieldSetImpl* source,
                                              field::FieldSetImpl* target );
+void atlas__Interpolation__execute_adjoint_field( Interpolation::Implementation* This, field::FieldImpl* source,
+                                                  const field::FieldImpl* target );
+void atlas__Interpolation__execute_adjoint_fieldset( Interpolation::Implementation* This, field::FieldSetImpl* source,
+                                                     const field::FieldSetImpl* target );
 }
 
 }  // namespace atlas
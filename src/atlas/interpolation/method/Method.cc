@@ -188,6 +188,10 @@ void interpolate_field( const Field& src, Field& tgt, const eckit::linalg::Spars
 }
 }  // namespace
 
+void Method::updateTarget( const FunctionSpace& ) {
+    NOTIMP;
+}
+
 void Method::execute( const FieldSet& fieldsSource, FieldSet& fieldsTarget ) const {
     ATLAS_TRACE( "atlas::interpolation::method::Method::execute()" );
 
@@ -216,6 +220,55 @@ void Method::execute( const Field& src, Field& tgt ) const {
     if ( src.datatype().kind() == array::DataType::KIND_REAL32 ) { interpolate_field<float>( src, tgt, matrix_ ); }
 }
 
+void Method::execute_adjoint( FieldSet& fieldsSource, const FieldSet& fieldsTarget ) const {
+    ATLAS_TRACE( "atlas::interpolation::method::Method::execute_adjoint()" );
+
+    const idx_t N = fieldsSource.size();
+    ASSERT( N == fieldsTarget.size() );
+
+    for ( idx_t i = 0; i < fieldsSource.size(); ++i ) {
+        Log::debug() << "Method::execute_adjoint() on field " << ( i + 1 ) << '/' << N << "..." << std::endl;
+
+        Field& src       = fieldsSource[i];
+        const Field& tgt = fieldsTarget[i];
+
+        execute_adjoint( src, tgt );
+    }
+}
+
+void Method::execute_adjoint( Field& src, const Field& tgt ) const {
+    if ( not adjoint_ ) {
+        throw eckit::UserError( "Interpolation method was not set up with \"adjoint\" = true", Here() );
+    }
+
+    ATLAS_TRACE( "atlas::interpolation::method::Method::execute_adjoint()" );
+
+    // The transpose is stored in CSR format too, so this is a race-free gather over source points
+    if ( tgt.datatype().kind() == array::DataType::KIND_REAL64 ) {
+        interpolate_field<double>( tgt, src, matrix_transpose_ );
+    }
+    if ( tgt.datatype().kind() == array::DataType::KIND_REAL32 ) {
+        interpolate_field<float>( tgt, src, matrix_transpose_ );
+    }
+
+    source().adjointHaloExchange( src );
+}
+
+void Method::setMatrix( Matrix& matrix ) {
+    matrix_.swap( matrix );
+
+    if ( adjoint_ ) {
+        ATLAS_TRACE( "atlas::interpolation::method::Method::setMatrix() transpose" );
+        Triplets triplets;
+        triplets.reserve( matrix_.nonZeros() );
+        for ( Matrix::const_iterator it = matrix_.begin(); it != matrix_.end(); ++it ) {
+            triplets.emplace_back( it.col(), it.row(), *it );
+        }
+        Matrix transpose( matrix_.cols(), matrix_.rows(), triplets );
+        matrix_transpose_.swap( transpose );
+    }
+}
+
 void Method::normalise( Triplets& triplets ) {
     // sum all calculated weights for normalisation
     double sum = 0.0;
@@ -33,7 +33,7 @@ class Method : public eckit::Owned {
 public:
     typedef eckit::Parametrisation Config;
 
-    Method( const Config& config ) : config_( config ) {}
+    Method( const Config& config ) : config_( config ), adjoint_( false ) { config.get( "adjoint", adjoint_ ); }
     virtual ~Method() {}
 
     /**
@@ -45,9 +45,26 @@ public:
 
     virtual void setup( const Grid& source, const Grid& target ) = 0;
 
+    /**
+   * @brief Recompute the interpolator for a new set of target points, reusing
+   * the search structures built for the source during setup
+   * @param target functionspace containing the new target points
+   */
+    virtual void updateTarget( const FunctionSpace& target );
+
     virtual void execute( const FieldSet& source, FieldSet& target ) const;
     virtual void execute( const Field& source, Field& target ) const;
 
+    /**
+   * @brief Apply the transpose of the interpolation operator, followed by an
+   * adjoint halo exchange of the source fields into the owned points.
+   * Requires the method to be configured with "adjoint" = true before setup
+   * @param source fields to receive the adjoint (overwritten)
+   * @param target fields containing target point values
+   */
+    virtual void execute_adjoint( FieldSet& source, const FieldSet& target ) const;
+    virtual void execute_adjoint( Field& source, const Field& target ) const;
+
     virtual void print( std::ostream& ) const = 0;
 
     virtual const FunctionSpace& source() const = 0;
@@ -60,6 +77,9 @@ protected:
 
     static void normalise( Triplets& triplets );
 
+    /// @brief Take ownership of the interpolation matrix, and cache its transpose if required
+    void setMatrix( Matrix& );
+
     const Config& config_;
 
     // NOTE : Matrix-free or non-linear interpolation operators do not have
@@ -67,6 +87,9 @@ protected:
     //        so do not expose here, even though only linear operators are now
     //        implemented.
     Matrix matrix_;
+
+    bool adjoint_;
+    Matrix matrix_transpose_;
 };
 
 struct MethodFactory {
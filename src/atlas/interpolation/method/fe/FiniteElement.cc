@@ -74,39 +74,10 @@ void FiniteElement::setup( const FunctionSpace& source, const FunctionSpace& tar
     ATLAS_TRACE( "atlas::interpolation::method::FiniteElement::setup()" );
 
     source_ = source;
-    target_ = target;
-
-    ATLAS_TRACE_SCOPE( "Setup target" ) {
-        if ( functionspace::NodeColumns tgt = target ) {
-            Mesh meshTarget = tgt.mesh();
-
-            // generate 3D point coordinates
-            target_xyz_    = mesh::actions::BuildXYZField( "xyz" )( meshTarget );
-            target_ghost_  = meshTarget.nodes().ghost();
-            target_lonlat_ = meshTarget.nodes().lonlat();
-        }
-        else if ( functionspace::PointCloud tgt = target ) {
-            const idx_t N  = tgt.size();
-            target_xyz_    = Field( "xyz", array::make_datatype<double>(), array::make_shape( N, 3 ) );
-            target_ghost_  = tgt.ghost();
-            target_lonlat_ = tgt.lonlat();
-            array::ArrayView<double, 2> lonlat = array::make_view<double, 2>( tgt.lonlat() );
-            array::ArrayView<double, 2> xyz    = array::make_view<double, 2>( target_xyz_ );
-            PointXYZ p2;
-            for ( idx_t n = 0; n < N; ++n ) {
-                const PointLonLat p1( lonlat( n, 0 ), lonlat( n, 1 ) );
-                util::Earth::convertSphericalToCartesian( p1, p2 );
-                xyz( n, 0 ) = p2.x();
-                xyz( n, 1 ) = p2.y();
-                xyz( n, 2 ) = p2.z();
-            }
-        }
-        else {
-            NOTIMP;
-        }
-    }
 
     setup( source );
+
+    updateTarget( target );
 }
 
 struct Stencil {
@@ -197,26 +168,60 @@ void FiniteElement::setup( const FunctionSpace& source ) {
     config.set( "flatten_virtual_elements", false );
     Field cell_centres = mesh::actions::BuildCellCentres( config )( meshSource );
 
-    eckit::ScopedPtr<ElemIndex3> eTree( create_element_kdtree( cell_centres ) );
-
-    trace_setup_source.stop();
-
+    eTree_.reset( create_element_kdtree( cell_centres ) );
 
     icoords_.reset( new array::ArrayView<double, 2>( array::make_view<double, 2>( source_xyz ) ) );
-    ocoords_.reset( new array::ArrayView<double, 2>( array::make_view<double, 2>( target_xyz_ ) ) );
     igidx_.reset( new array::ArrayView<gidx_t, 1>( array::make_view<gidx_t, 1>( src.nodes().global_index() ) ) );
-    connectivity_              = &meshSource.cells().node_connectivity();
-    const mesh::Nodes& i_nodes = meshSource.nodes();
+    connectivity_ = &meshSource.cells().node_connectivity();
+    nb_elements_  = meshSource.cells().size();
+}
+
+void FiniteElement::updateTarget( const FunctionSpace& target ) {
+    ATLAS_TRACE( "atlas::interpolation::method::FiniteElement::updateTarget()" );
+    ASSERT( eTree_ );
 
+    target_ = target;
+
+    ATLAS_TRACE_SCOPE( "Setup target" ) {
+        if ( functionspace::NodeColumns tgt = target ) {
+            Mesh meshTarget = tgt.mesh();
+
+            // generate 3D point coordinates
+            target_xyz_    = mesh::actions::BuildXYZField( "xyz" )( meshTarget );
+            target_ghost_  = meshTarget.nodes().ghost();
+            target_lonlat_ = meshTarget.nodes().lonlat();
+        }
+        else if ( functionspace::PointCloud tgt = target ) {
+            const idx_t N  = tgt.size();
+            target_xyz_    = Field( "xyz", array::make_datatype<double>(), array::make_shape( N, 3 ) );
+            target_ghost_  = tgt.ghost();
+            target_lonlat_ = tgt.lonlat();
+            array::ArrayView<double, 2> lonlat = array::make_view<double, 2>( tgt.lonlat() );
+            array::ArrayView<double, 2> xyz    = array::make_view<double, 2>( target_xyz_ );
+            PointXYZ p2;
+            for ( idx_t n = 0; n < N; ++n ) {
+                const PointLonLat p1( lonlat( n, 0 ), lonlat( n, 1 ) );
+                util::Earth::convertSphericalToCartesian( p1, p2 );
+                xyz( n, 0 ) = p2.x();
+                xyz( n, 1 ) = p2.y();
+                xyz( n, 2 ) = p2.z();
+            }
+        }
+        else {
+            NOTIMP;
+        }
+    }
+
+    ocoords_.reset( new array::ArrayView<double, 2>( array::make_view<double, 2>( target_xyz_ ) ) );
 
-    idx_t inp_npts = i_nodes.size();
+    idx_t inp_npts = icoords_->shape( 0 );
     idx_t out_npts = ocoords_->shape( 0 );
 
     array::ArrayView<int, 1> out_ghosts = array::make_view<int, 1>( target_ghost_ );
 
     array::ArrayView<double, 2> out_lonlat = array::make_view<double, 2>( target_lonlat_ );
 
-    idx_t Nelements                    = meshSource.cells().size();
+    idx_t Nelements                    = nb_elements_;
     const double maxFractionElemsToTry = 0.2;
 
     // weights -- one per vertex of element, triangles (3) or quads (4)
@@ -246,7 +251,7 @@ void FiniteElement::setup( const FunctionSpace& source ) {
             while ( !success && kpts <= maxNbElemsToTry ) {
                 max_neighbours = std::max( kpts, max_neighbours );
 
-                ElemIndex3::NodeList cs = eTree->kNearestNeighbours( p, kpts );
+                ElemIndex3::NodeList cs = eTree_->kNearestNeighbours( p, kpts );
                 Triplets triplets       = projectPointToElements( ip, cs, failures_log );
 
                 if ( triplets.size() ) {
@@ -284,7 +289,7 @@ void FiniteElement::setup( const FunctionSpace& source ) {
 
     // fill sparse matrix and return
     Matrix A( out_npts, inp_npts, weights_triplets );
-    matrix_.swap( A );
+    setMatrix( A );
 }
 
 struct ElementEdge {
@@ -16,6 +16,7 @@
 
 #include "eckit/config/Configuration.h"
 #include "eckit/memory/NonCopyable.h"
+#include "eckit/memory/ScopedPtr.h"
 
 #include "atlas/array/ArrayView.h"
 #include "atlas/interpolation/method/PointIndex3.h"
@@ -35,6 +36,8 @@ public:
 
     virtual void setup( const Grid& source, const Grid& target ) override;
 
+    virtual void updateTarget( const FunctionSpace& target ) override;
+
     virtual void print( std::ostream& ) const override;
 
 protected:
@@ -63,6 +66,9 @@ protected:
     virtual const FunctionSpace& target() const override { return target_; }
 
 protected:
+    eckit::ScopedPtr<ElemIndex3> eTree_;
+    idx_t nb_elements_;
+
     mesh::MultiBlockConnectivity* connectivity_;
     std::unique_ptr<array::ArrayView<double, 2>> icoords_;
     std::unique_ptr<array::ArrayView<double, 2>> ocoords_;
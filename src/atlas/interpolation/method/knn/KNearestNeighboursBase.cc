@@ -10,11 +10,15 @@
 
 #include "eckit/config/Resource.h"
 
+#include "atlas/functionspace/NodeColumns.h"
+#include "atlas/functionspace/PointCloud.h"
 #include "atlas/interpolation/method/knn/KNearestNeighboursBase.h"
 #include "atlas/library/Library.h"
 #include "atlas/mesh/Nodes.h"
 #include "atlas/mesh/actions/BuildXYZField.h"
 #include "atlas/runtime/Trace.h"
+#include "atlas/util/Earth.h"
+#include "atlas/util/Point.h"
 
 namespace atlas {
 namespace interpolation {
@@ -50,6 +54,29 @@ void KNearestNeighboursBase::buildPointSearchTree( Mesh& meshSource ) {
     }
 }
 
+Field KNearestNeighboursBase::targetXYZ( const FunctionSpace& target ) const {
+    if ( functionspace::NodeColumns tgt = target ) {
+        Mesh meshTarget = tgt.mesh();
+        return mesh::actions::BuildXYZField( "xyz" )( meshTarget );
+    }
+    if ( functionspace::PointCloud tgt = target ) {
+        const idx_t N = tgt.size();
+        Field field( "xyz", array::make_datatype<double>(), array::make_shape( N, 3 ) );
+        auto lonlat = array::make_view<double, 2>( tgt.lonlat() );
+        auto xyz    = array::make_view<double, 2>( field );
+        PointXYZ p2;
+        for ( idx_t n = 0; n < N; ++n ) {
+            const PointLonLat p1( lonlat( n, 0 ), lonlat( n, 1 ) );
+            util::Earth::convertSphericalToCartesian( p1, p2 );
+            xyz( n, 0 ) = p2.x();
+            xyz( n, 1 ) = p2.y();
+            xyz( n, 2 ) = p2.z();
+        }
+        return field;
+    }
+    NOTIMP;
+}
+
 }  // namespace method
 }  // namespace interpolation
 }  // namespace atlas
@@ -12,6 +12,7 @@
 
 #include "eckit/memory/ScopedPtr.h"
 
+#include "atlas/field/Field.h"
 #include "atlas/interpolation/method/Method.h"
 #include "atlas/interpolation/method/PointIndex3.h"
 
@@ -27,6 +28,9 @@ public:
 protected:
     void buildPointSearchTree( Mesh& meshSource );
 
+    /// @brief 3D coordinates of target points, for NodeColumns or PointCloud targets
+    Field targetXYZ( const FunctionSpace& target ) const;
+
     eckit::ScopedPtr<PointIndex3> pTree_;
 };
 
@@ -48,31 +48,33 @@ void NearestNeighbour::setup( const Grid& source, const Grid& target ) {
 
 void NearestNeighbour::setup( const FunctionSpace& source, const FunctionSpace& target ) {
     source_                        = source;
-    target_                        = target;
     functionspace::NodeColumns src = source;
-    functionspace::NodeColumns tgt = target;
     ASSERT( src );
-    ASSERT( tgt );
 
     Mesh meshSource = src.mesh();
-    Mesh meshTarget = tgt.mesh();
 
     // build point-search tree
     buildPointSearchTree( meshSource );
+
+    updateTarget( target );
+}
+
+void NearestNeighbour::updateTarget( const FunctionSpace& target ) {
     ASSERT( pTree_ );
+    target_ = target;
 
     // generate 3D point coordinates
-    mesh::actions::BuildXYZField( "xyz" )( meshTarget );
-    array::ArrayView<double, 2> coords = array::make_view<double, 2>( meshTarget.nodes().field( "xyz" ) );
+    Field target_xyz                   = targetXYZ( target );
+    array::ArrayView<double, 2> coords = array::make_view<double, 2>( target_xyz );
 
-    size_t inp_npts = meshSource.nodes().size();
-    size_t out_npts = meshTarget.nodes().size();
+    size_t inp_npts = source_.size();
+    size_t out_npts = target_xyz.shape( 0 );
 
     // fill the sparse matrix
     std::vector<Triplet> weights_triplets;
     weights_triplets.reserve( out_npts );
     {
-        Trace timer( Here(), "atlas::interpolation::method::NearestNeighbour::setup()" );
+        Trace timer( Here(), "atlas::interpolation::method::NearestNeighbour::updateTarget()" );
         for ( size_t ip = 0; ip < out_npts; ++ip ) {
             if ( ip && ( ip % 1000 == 0 ) ) {
                 double rate = ip / timer.elapsed();
@@ -92,7 +94,7 @@ void NearestNeighbour::setup( const FunctionSpace& source, const FunctionSpace&
 
     // fill sparse matrix and return
     Matrix A( out_npts, inp_npts, weights_triplets );
-    matrix_.swap( A );
+    setMatrix( A );
 }
 
 }  // namespace method
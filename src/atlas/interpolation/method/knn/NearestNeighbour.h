@@ -36,6 +36,8 @@ protected:
 
     virtual void setup( const Grid& source, const Grid& target ) override;
 
+    virtual void updateTarget( const FunctionSpace& target ) override;
+
     virtual const FunctionSpace& source() const override { return source_; }
     virtual const FunctionSpace& target() const override { return target_; }
 
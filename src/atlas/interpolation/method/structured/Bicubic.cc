@@ -468,7 +468,7 @@ void Bicubic::setup( const FunctionSpace& source ) {
             }
             // fill sparse matrix and return
             Matrix A( out_npts, inp_npts, triplets );
-            matrix_.swap( A );
+            setMatrix( A );
         }
     }
 }
@@ -74,7 +74,8 @@ Library::Library() :
     info_( getEnv( "ATLAS_INFO", true ) ),
     trace_( getEnv( "ATLAS_TRACE", false ) ),
     trace_report_( getEnv( "ATLAS_TRACE_REPORT", false ) ),
-    trace_barriers_( getEnv( "ATLAS_TRACE_BARRIERS", false ) ) {}
+    trace_barriers_( getEnv( "ATLAS_TRACE_BARRIERS", false ) ),
+    grid_cache_( getEnv( "ATLAS_GRID_CACHE", false ) ) {}
 
 Library& Library::instance() {
     return libatlas;
@@ -120,6 +121,7 @@ void Library::initialise( const eckit::Parametrisation& config ) {
         config.get( "trace.barriers", trace_barriers_ );
         config.get( "trace.report", trace_report_ );
     }
+    if ( config.has( "grid" ) ) { config.get( "grid.cache", grid_cache_ ); }
 
     if ( not debug_ ) debug_channel_.reset();
     if ( not trace_ ) trace_channel_.reset();
@@ -142,6 +144,7 @@ void Library::initialise( const eckit::Parametrisation& config ) {
         out << "  log.debug       [" << str( debug() ) << "] \n";
         out << "  trace.barriers  [" << str( traceBarriers() ) << "] \n";
         out << "  trace.report    [" << str( trace_report_ ) << "] \n";
+        out << "  grid.cache      [" << str( grid_cache_ ) << "] \n";
         out << " \n";
         out << atlas::Library::instance().information();
         out << std::flush;
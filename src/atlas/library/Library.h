@@ -57,6 +57,9 @@ public:
 
     bool traceBarriers() const { return trace_barriers_; }
 
+    /// @brief Share grids created by name or configuration within the process, see atlas::grid::GridCache
+    bool gridCache() const { return grid_cache_; }
+
 protected:
     virtual const void* addr() const override;
 
@@ -65,6 +68,7 @@ protected:
     bool debug_{false};
     bool trace_barriers_{false};
     bool trace_report_{false};
+    bool grid_cache_{false};
     mutable std::unique_ptr<eckit::Channel> info_channel_;
     mutable std::unique_ptr<eckit::Channel> trace_channel_;
     mutable std::unique_ptr<eckit::Channel> debug_channel_;
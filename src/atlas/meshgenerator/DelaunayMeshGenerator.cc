@@ -8,6 +8,7 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include "eckit/exception/Exceptions.h"
 #include "eckit/utils/Hash.h"
 
 #include "atlas/array/ArrayView.h"
@@ -81,16 +82,14 @@ void DelaunayMeshGenerator::createNodes( const Grid& grid, Mesh& mesh ) const {
     array::ArrayView<double, 2> xy     = array::make_view<double, 2>( mesh.nodes().xy() );
     array::ArrayView<double, 2> lonlat = array::make_view<double, 2>( mesh.nodes().lonlat() );
     size_t jnode( 0 );
-    Projection projection = grid.projection();
-    PointLonLat Pll;
     for ( PointXY Pxy : grid.xy() ) {
-        xy( jnode, XX )      = Pxy.x();
-        xy( jnode, YY )      = Pxy.y();
-        Pll                  = projection.lonlat( Pxy );
-        lonlat( jnode, LON ) = Pll.lon();
-        lonlat( jnode, LAT ) = Pll.lat();
+        xy( jnode, XX ) = Pxy.x();
+        xy( jnode, YY ) = Pxy.y();
         ++jnode;
     }
+    ASSERT( xy.stride( 0 ) == lonlat.stride( 0 ) );
+    grid.projection().xy2lonlat( nb_nodes, xy.data() + XX, xy.data() + YY, lonlat.data() + LON, lonlat.data() + LAT,
+                                 xy.stride( 0 ) );
 }
 
 namespace {
@@ -195,29 +195,26 @@ void RegularMeshGenerator::generate_mesh( const grid::RegularGrid& rg, const std
                                   // surrounding rectangle
     int nnodes_SR, ii;
 
-    // loop over all points to determine local indices and surroundig rectangle
+    // loop over all points, row by row, to determine local indices and surroundig rectangle
     ix_min          = nx + 1;
     ix_max          = 0;
     iy_min          = ny + 1;
     iy_max          = 0;
     nnodes_nonghost = 0;
 
-    ii_glb = 0;
-    for ( iy = 0; iy < ny; iy++ ) {
-        for ( ix = 0; ix < nx; ix++ ) {
-            local_idx[ii_glb] = current_idx[parts[ii_glb]]++;  // store local index on
-                                                               // the local proc of
-                                                               // this point
-            if ( parts[ii_glb] == mypart ) {
+    rg.for_each_row( [&]( const grid::StructuredGrid::Row& row ) {
+        for ( idx_t i = row.i_begin; i < row.i_end; ++i ) {
+            const idx_t n = row.n + i - row.i_begin;  // global index
+            local_idx[n]  = current_idx[parts[n]]++;  // store local index on the local proc of this point
+            if ( parts[n] == mypart ) {
                 ++nnodes_nonghost;  // non-ghost node: belongs to this part
-                ix_min = std::min( ix_min, ix );
-                ix_max = std::max( ix_max, ix );
-                iy_min = std::min( iy_min, iy );
-                iy_max = std::max( iy_max, iy );
+                ix_min = std::min( ix_min, int( i ) );
+                ix_max = std::max( ix_max, int( i ) );
+                iy_min = std::min( iy_min, int( row.j ) );
+                iy_max = std::max( iy_max, int( row.j ) );
             }
-            ++ii_glb;  // global index
         }
-    }
+    } );
 
     // add one row/column for ghost nodes (which include periodicity points)
     ix_max = ix_max + 1;
@@ -430,27 +427,23 @@ void RegularMeshGenerator::generate_mesh( const grid::RegularGrid& rg, const std
                 double _xy[2];
                 if ( iy_glb < ny ) {
                     // normal calculation
-                    rg.xy( ix_glb, iy_glb, _xy );
+                    const grid::StructuredGrid::Row row = rg.row( iy_glb );
+                    _xy[0]                              = row.x( ix_glb );
+                    _xy[1]                              = row.y;
                 }
                 else {
                     // for periodic_y grids, iy_glb==ny lies outside the range of
                     // latitudes in the Structured grid...
                     // so we extrapolate from two other points -- this is okay for regular
                     // grids with uniform spacing.
-                    double xy1[2], xy2[2];
-                    rg.xy( ix_glb, iy_glb - 1, xy1 );
-                    rg.xy( ix_glb, iy_glb - 2, xy2 );
-                    _xy[0] = 2 * xy1[0] - xy2[0];
-                    _xy[1] = 2 * xy1[1] - xy2[1];
+                    const grid::StructuredGrid::Row row1 = rg.row( iy_glb - 1 );
+                    const grid::StructuredGrid::Row row2 = rg.row( iy_glb - 2 );
+                    _xy[0]                               = 2 * row1.x( ix_glb ) - row2.x( ix_glb );
+                    _xy[1]                               = 2 * row1.y - row2.y;
                 }
                 xy( inode, LON ) = _xy[LON];
                 xy( inode, LAT ) = _xy[LAT];
 
-                // geographic coordinates by using projection
-                rg.projection().xy2lonlat( _xy );
-                lonlat( inode, LON ) = _xy[LON];
-                lonlat( inode, LAT ) = _xy[LAT];
-
                 // part
                 part( inode ) = parts_SR[ii];
                 // ghost nodes
@@ -475,7 +468,7 @@ void RegularMeshGenerator::generate_mesh( const grid::RegularGrid& rg, const std
                           << "\tinode=" << inode << "; ix_glb=" << ix_glb << "; iy_glb=" << iy_glb
                           << "; glb_idx=" << ii_glb << std::endl;
                 std::cout << "[" << mypart << "] : "
-                          << "\tglon=" << lonlat( inode, 0 ) << "; glat=" << lonlat( inode, 1 )
+                          << "\tx=" << xy( inode, XX ) << "; y=" << xy( inode, YY )
                           << "; glb_idx=" << glb_idx( inode ) << std::endl;
 #endif
             }
@@ -483,6 +476,11 @@ void RegularMeshGenerator::generate_mesh( const grid::RegularGrid& rg, const std
         }
     }
 
+    // geographic coordinates by using projection, for all nodes at once
+    ASSERT( xy.stride( 0 ) == lonlat.stride( 0 ) );
+    rg.projection().xy2lonlat( nnodes, xy.data() + XX, xy.data() + YY, lonlat.data() + LON, lonlat.data() + LAT,
+                               xy.stride( 0 ) );
+
     // loop over nodes and define cells
     for ( iy = 0; iy < nyl - 1; iy++ ) {      // don't loop into ghost/periodicity row
         for ( ix = 0; ix < nxl - 1; ix++ ) {  // don't loop into ghost/periodicity column
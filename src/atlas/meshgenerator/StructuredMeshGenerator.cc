@@ -192,12 +192,12 @@ void StructuredMeshGenerator::generate( const Grid& grid, const grid::Distributi
 
     ASSERT( !mesh.generated() );
 
-    if ( grid.size() != idx_t( distribution.partition().size() ) ) {
+    if ( grid.size() != idx_t( distribution.size() ) ) {
         std::stringstream msg;
         msg << "Number of points in grid (" << grid.size()
             << ") different from "
                "number of points in grid distribution ("
-            << distribution.partition().size() << ")";
+            << distribution.size() << ")";
         throw eckit::AssertionFailed( msg.str(), Here() );
     }
 
@@ -205,12 +205,11 @@ void StructuredMeshGenerator::generate( const Grid& grid, const grid::Distributi
 
 // show distribution
 #if DEBUG_OUTPUT
-    int inode              = 0;
-    std::vector<int> parts = distribution;
+    int inode = 0;
     Log::info() << "Partition : " << std::endl;
     for ( size_t ilat = 0; ilat < rg.ny(); ilat++ ) {
         for ( size_t ilon = 0; ilon < rg.nx( ilat ); ilon++ ) {
-            Log::info() << std::setw( 3 ) << parts[inode];
+            Log::info() << std::setw( 3 ) << distribution.partition( inode );
             inode++;
         }
         Log::info() << std::endl;
@@ -226,7 +225,7 @@ void StructuredMeshGenerator::generate( const Grid& grid, const grid::Distributi
     generate_mesh( rg, distribution, region, mesh );
 }
 
-void StructuredMeshGenerator::generate_region( const grid::StructuredGrid& rg, const std::vector<int>& parts,
+void StructuredMeshGenerator::generate_region( const grid::StructuredGrid& rg, const grid::Distribution& distribution,
                                                int mypart, Region& region ) const {
     ATLAS_TRACE();
 
@@ -240,33 +239,22 @@ void StructuredMeshGenerator::generate_region( const grid::StructuredGrid& rg, c
 
     int n;
     /*
-Find min and max latitudes used by this part.
+Find min and max latitudes used by this part, from the first and last point it owns.
 */
-    n             = 0;
-    int lat_north = -1;
-    for ( idx_t jlat = 0; jlat < rg.ny(); ++jlat ) {
-        for ( idx_t jlon = 0; jlon < rg.nx( jlat ); ++jlon ) {
-            if ( parts.at( n ) == mypart ) {
-                lat_north = jlat;
-                goto end_north;
-            }
-            ++n;
+    gidx_t n_first = -1;
+    gidx_t n_last  = -1;
+    distribution.for_each_run( [&]( gidx_t begin, gidx_t end, int part ) {
+        if ( part == mypart ) {
+            if ( n_first < 0 ) n_first = begin;
+            n_last = end - 1;
         }
-    }
-end_north:
-
-    n             = rg.size() - 1;
+    } );
+    int lat_north = -1;
     int lat_south = -1;
-    for ( int jlat = rg.ny() - 1; jlat >= 0; --jlat ) {
-        for ( int jlon = rg.nx( jlat ) - 1; jlon >= 0; --jlon ) {
-            if ( parts.at( n ) == mypart ) {
-                lat_south = jlat;
-                goto end_south;
-            }
-            --n;
-        }
+    if ( n_first >= 0 ) {
+        rg.for_each_row( n_first, n_first + 1, [&]( const grid::StructuredGrid::Row& row ) { lat_north = row.j; } );
+        rg.for_each_row( n_last, n_last + 1, [&]( const grid::StructuredGrid::Row& row ) { lat_south = row.j; } );
     }
-end_south:
 
     std::vector<int> offset( rg.ny(), 0 );
 
@@ -334,7 +322,7 @@ We need to connect to next region
         ipS2 = std::min( ipS1 + 1, endS );
 
         int jelem = 0;
-        int pE    = parts.at( offset.at( latN ) );
+        int pE    = distribution.partition( offset.at( latN ) );
 
 #if DEBUG_OUTPUT
         Log::info() << "=================\n";
@@ -353,22 +341,22 @@ We need to connect to next region
 
             int pN1, pS1, pN2, pS2;
             if ( ipN1 != rg.nx( latN ) )
-                pN1 = parts.at( offset.at( latN ) + ipN1 );
+                pN1 = distribution.partition( offset.at( latN ) + ipN1 );
             else
-                pN1 = parts.at( offset.at( latN ) );
+                pN1 = distribution.partition( offset.at( latN ) );
             if ( ipS1 != rg.nx( latS ) )
-                pS1 = parts.at( offset.at( latS ) + ipS1 );
+                pS1 = distribution.partition( offset.at( latS ) + ipS1 );
             else
-                pS1 = parts.at( offset.at( latS ) );
+                pS1 = distribution.partition( offset.at( latS ) );
 
             if ( ipN2 == rg.nx( latN ) )
-                pN2 = parts.at( offset.at( latN ) );
+                pN2 = distribution.partition( offset.at( latN ) );
             else
-                pN2 = parts.at( offset.at( latN ) + ipN2 );
+                pN2 = distribution.partition( offset.at( latN ) + ipN2 );
             if ( ipS2 == rg.nx( latS ) )
-                pS2 = parts.at( offset.at( latS ) );
+                pS2 = distribution.partition( offset.at( latS ) );
             else
-                pS2 = parts.at( offset.at( latS ) + ipS2 );
+                pS2 = distribution.partition( offset.at( latS ) + ipS2 );
 
                 // Log::info()  << ipN1 << "("<<pN1<<") " << ipN2 <<"("<<pN2<<")" <<  std::endl;
                 // Log::info()  << ipS1 << "("<<pS2<<") " << ipS2 <<"("<<pS2<<")" <<  std::endl;
@@ -642,17 +630,25 @@ We need to connect to next region
     //  Log::info()  << "nb_quads = " << region.nquads << std::endl;
     //  Log::info()  << "nb_elems = " << nelems << std::endl;
 
-    int nb_region_nodes = 0;
     for ( int jlat = region.north; jlat <= region.south; ++jlat ) {
-        n                           = offset.at( jlat );
         region.lat_begin.at( jlat ) = std::max( 0, region.lat_begin.at( jlat ) );
-        for ( size_t jlon = 0; jlon < rg.nx( jlat ); ++jlon ) {
-            if ( parts.at( n ) == mypart ) {
-                region.lat_begin.at( jlat ) = std::min( region.lat_begin.at( jlat ), int( jlon ) );
-                region.lat_end.at( jlat )   = std::max( region.lat_end.at( jlat ), int( jlon ) );
-            }
-            ++n;
-        }
+    }
+    // Extend the rows of the region to the points owned by this part, from its runs of points in the
+    // rows of the region, without a lookup of the partition of each point
+    const gidx_t n_region_begin = offset.at( region.north );
+    const gidx_t n_region_end   = offset.at( region.south ) + rg.nx( region.south );
+
+    auto extend_row = [&]( const grid::StructuredGrid::Row& row ) {
+        region.lat_begin.at( row.j ) = std::min( region.lat_begin.at( row.j ), int( row.i_begin ) );
+        region.lat_end.at( row.j )   = std::max( region.lat_end.at( row.j ), int( row.i_end - 1 ) );
+    };
+    distribution.for_each_run( [&]( gidx_t begin, gidx_t end, int part ) {
+        if ( part != mypart || end <= n_region_begin || begin >= n_region_end ) { return; }
+        rg.for_each_row( std::max( begin, n_region_begin ), std::min( end, n_region_end ), extend_row );
+    } );
+
+    int nb_region_nodes = 0;
+    for ( int jlat = region.north; jlat <= region.south; ++jlat ) {
         nb_region_nodes += region.lat_end.at( jlat ) - region.lat_begin.at( jlat ) + 1;
 
         // Count extra periodic node
@@ -685,7 +681,7 @@ struct GhostNode {
 };
 }  // namespace
 
-void StructuredMeshGenerator::generate_mesh( const grid::StructuredGrid& rg, const std::vector<int>& parts,
+void StructuredMeshGenerator::generate_mesh( const grid::StructuredGrid& rg, const grid::Distribution& distribution,
                                              const Region& region, Mesh& mesh ) const {
     ATLAS_TRACE();
 
@@ -823,7 +819,7 @@ void StructuredMeshGenerator::generate_mesh( const grid::StructuredGrid& rg, con
             for ( int jlon = region.lat_begin.at( jlat ); jlon <= region.lat_end.at( jlat ); ++jlon ) {
                 if ( jlon < rg.nx( jlat ) ) {
                     n = offset_glb.at( jlat ) + jlon;
-                    if ( parts.at( n ) == mypart ) {
+                    if ( distribution.partition( n ) == mypart ) {
                         node_numbering.at( jnode ) = node_number;
                         ++node_number;
                     }
@@ -836,7 +832,7 @@ void StructuredMeshGenerator::generate_mesh( const grid::StructuredGrid& rg, con
                 {
                     //#warning TODO: use commented approach
                     part( jnode ) = mypart;
-                    // part(jnode)      = parts.at( offset_glb.at(jlat) );
+                    // part(jnode)      = distribution.partition( offset_glb.at(jlat) );
                     ghost( jnode ) = 1;
                     halo( jnode )  = 0;
                     ghost_nodes.push_back( GhostNode( jlat, rg.nx( jlat ), jnode ) );
@@ -874,13 +870,14 @@ void StructuredMeshGenerator::generate_mesh( const grid::StructuredGrid& rg, con
         offset_loc.at( ilat ) = l;
         l += region.lat_end.at( jlat ) - region.lat_begin.at( jlat ) + 1;
 
-        double y = rg.y( jlat );
+        const grid::StructuredGrid::Row row = rg.row( jlat );
+        double y                            = row.y;
         for ( int jlon = region.lat_begin.at( jlat ); jlon <= region.lat_end.at( jlat ); ++jlon ) {
             if ( jlon < rg.nx( jlat ) ) {
                 int inode = node_numbering.at( jnode );
                 n         = offset_glb.at( jlat ) + jlon;
 
-                double x = rg.x( jlon, jlat );
+                double x = row.x( jlon );
                 // std::cout << "jlat = " << jlat << "; jlon = " << jlon << "; x = " <<
                 // x << std::endl;
                 if ( stagger && ( jlat + 1 ) % 2 == 0 ) x += 180. / static_cast<double>( rg.nx( jlat ) );
@@ -888,14 +885,8 @@ void StructuredMeshGenerator::generate_mesh( const grid::StructuredGrid& rg, con
                 xy( inode, XX ) = x;
                 xy( inode, YY ) = y;
 
-                // geographic coordinates by using projection
-                double crd[] = {x, y};
-                rg.projection().xy2lonlat( crd );
-                lonlat( inode, LON ) = crd[LON];
-                lonlat( inode, LAT ) = crd[LAT];
-
                 glb_idx( inode ) = n + 1;
-                part( inode )    = parts.at( n );
+                part( inode )    = distribution.partition( n );
                 ghost( inode )   = 0;
                 halo( inode )    = 0;
                 Topology::reset( flags( inode ) );
@@ -918,21 +909,15 @@ void StructuredMeshGenerator::generate_mesh( const grid::StructuredGrid& rg, con
             {
                 int inode = node_numbering.at( jnode );
                 // int inode_left = node_numbering.at(jnode-1);
-                double x = rg.x( rg.nx( jlat ), jlat );
+                double x = row.x( row.i_end );
                 if ( stagger && ( jlat + 1 ) % 2 == 0 ) x += 180. / static_cast<double>( rg.nx( jlat ) );
 
                 xy( inode, XX ) = x;
                 xy( inode, YY ) = y;
 
-                // geographic coordinates by using projection
-                double crd[] = {x, y};
-                rg.projection().xy2lonlat( crd );
-                lonlat( inode, LON ) = crd[LON];
-                lonlat( inode, LAT ) = crd[LAT];
-
                 glb_idx( inode ) = periodic_glb.at( jlat ) + 1;
                 //#warning TODO: use commented approach
-                //        part(inode)      = parts.at( offset_glb.at(jlat) );
+                //        part(inode)      = distribution.partition( offset_glb.at(jlat) );
                 part( inode )  = mypart;  // The actual part will be fixed later
                 ghost( inode ) = 1;
                 halo( inode )  = 0;
@@ -956,12 +941,6 @@ void StructuredMeshGenerator::generate_mesh( const grid::StructuredGrid& rg, con
         xy( inode, XX ) = x;
         xy( inode, YY ) = y;
 
-        // geographic coordinates by using projection
-        double crd[] = {x, y};
-        rg.projection().xy2lonlat( crd );
-        lonlat( inode, LON ) = crd[LON];
-        lonlat( inode, LAT ) = crd[LAT];
-
         glb_idx( inode ) = periodic_glb.at( rg.ny() - 1 ) + 2;
         part( inode )    = mypart;
         ghost( inode )   = 0;
@@ -980,12 +959,6 @@ void StructuredMeshGenerator::generate_mesh( const grid::StructuredGrid& rg, con
         xy( inode, XX ) = x;
         xy( inode, YY ) = y;
 
-        // geographic coordinates by using projection
-        double crd[] = {x, y};
-        rg.projection().xy2lonlat( crd );
-        lonlat( inode, LON ) = crd[LON];
-        lonlat( inode, LAT ) = crd[LAT];
-
         glb_idx( inode ) = periodic_glb.at( rg.ny() - 1 ) + 3;
         part( inode )    = mypart;
         ghost( inode )   = 0;
@@ -995,6 +968,11 @@ void StructuredMeshGenerator::generate_mesh( const grid::StructuredGrid& rg, con
         ++jnode;
     }
 
+    // geographic coordinates by using projection, for all nodes at once
+    ASSERT( xy.stride( 0 ) == lonlat.stride( 0 ) );
+    rg.projection().xy2lonlat( nnodes, xy.data() + XX, xy.data() + YY, lonlat.data() + LON, lonlat.data() + LAT,
+                               xy.stride( 0 ) );
+
     mesh.metadata().set<size_t>( "nb_nodes_including_halo[0]", nodes.size() );
     nodes.metadata().set<size_t>( "NbRealPts", size_t( nnodes - nnewnodes ) );
     nodes.metadata().set<size_t>( "NbVirtualPts", size_t( nnewnodes ) );
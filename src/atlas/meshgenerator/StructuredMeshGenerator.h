@@ -52,13 +52,12 @@ private:
 
     void configure_defaults();
 
-    void generate_region( const grid::StructuredGrid&, const std::vector<int>& parts, int mypart,
-                          Region& region ) const;
+    void generate_region( const grid::StructuredGrid&, const grid::Distribution&, int mypart, Region& region ) const;
 
-    void generate_mesh_new( const grid::StructuredGrid&, const std::vector<int>& parts, const Region& region,
+    void generate_mesh_new( const grid::StructuredGrid&, const grid::Distribution&, const Region& region,
                             Mesh& m ) const;
 
-    void generate_mesh( const grid::StructuredGrid&, const std::vector<int>& parts, const Region& region,
+    void generate_mesh( const grid::StructuredGrid&, const grid::Distribution&, const Region& region,
                         Mesh& m ) const;
 
 private:
@@ -58,6 +58,11 @@ public:  // methods
     template <typename DATA_TYPE, int RANK, typename ParallelDim = array::FirstDim>
     void execute( array::Array& field, bool on_device = false ) const;
 
+    /// @brief Transpose of execute(): halo values are sent back to their owners and accumulated
+    /// onto the owned values, after which the halo is set to zero.
+    template <typename DATA_TYPE, int RANK, typename ParallelDim = array::FirstDim>
+    void execute_adjoint( array::Array& field ) const;
+
 private:  // methods
     void create_mappings( std::vector<int>& send_map, std::vector<int>& recv_map, idx_t nb_vars ) const;
 
@@ -201,6 +206,27 @@ struct halo_packer {
             halo_unpacker_impl<ParallelDim, RANK, 0>::apply( ibuf, node_idx, recv_buffer, field );
         }
     }
+
+    template <typename DATA_TYPE>
+    static void unpack_adjoint( const unsigned int recvcnt, array::SVector<int> const& recvmap,
+                                array::SVector<DATA_TYPE> const& recv_buffer,
+                                array::ArrayView<DATA_TYPE, RANK>& field ) {
+        idx_t ibuf = 0;
+        for ( int node_cnt = 0; node_cnt < recvcnt; ++node_cnt ) {
+            const idx_t node_idx = recvmap[node_cnt];
+            halo_adjoint_unpacker_impl<ParallelDim, RANK, 0>::apply( ibuf, node_idx, recv_buffer, field );
+        }
+    }
+
+    template <typename DATA_TYPE>
+    static void zero( const unsigned int cnt, array::SVector<int> const& map, const idx_t var_size,
+                      array::ArrayView<DATA_TYPE, RANK>& field ) {
+        array::SVector<DATA_TYPE> zeros( cnt * var_size );
+        for ( idx_t i = 0; i < zeros.size(); ++i ) {
+            zeros[i] = DATA_TYPE( 0 );
+        }
+        unpack( cnt, map, zeros, field );
+    }
 };
 
 template <int ParallelDim, typename DATA_TYPE, int RANK>
@@ -231,6 +257,76 @@ void HaloExchange::unpack_recv_buffer( const array::SVector<DATA_TYPE>& recv_buf
         halo_packer<ParallelDim, RANK>::unpack( recvcnt_, recvmap_, recv_buffer, dfield );
 }
 
+template <typename DATA_TYPE, int RANK, typename ParallelDim>
+void HaloExchange::execute_adjoint( array::Array& field ) const {
+    if ( !is_setup_ ) { throw eckit::SeriousBug( "HaloExchange was not setup", Here() ); }
+
+    ATLAS_TRACE( "HaloExchange adjoint", {"halo-exchange-adjoint"} );
+
+    auto field_hv = array::make_host_view<DATA_TYPE, RANK>( field );
+
+    int tag                   = 1;
+    constexpr int parallelDim = array::get_parallel_dim<ParallelDim>( field_hv );
+    idx_t var_size            = array::get_var_size<parallelDim>( field_hv );
+
+    // Roles of send and receive are swapped with respect to execute()
+    int send_size = recvcnt_ * var_size;
+    int recv_size = sendcnt_ * var_size;
+
+    array::SVector<DATA_TYPE> send_buffer( send_size );
+    array::SVector<DATA_TYPE> recv_buffer( recv_size );
+    std::vector<int> send_displs( nproc );
+    std::vector<int> recv_displs( nproc );
+    std::vector<int> send_counts( nproc );
+    std::vector<int> recv_counts( nproc );
+
+    std::vector<eckit::mpi::Request> send_req( nproc );
+    std::vector<eckit::mpi::Request> recv_req( nproc );
+
+    for ( int jproc = 0; jproc < nproc; ++jproc ) {
+        send_counts[jproc] = recvcounts_[jproc] * var_size;
+        recv_counts[jproc] = sendcounts_[jproc] * var_size;
+        send_displs[jproc] = recvdispls_[jproc] * var_size;
+        recv_displs[jproc] = senddispls_[jproc] * var_size;
+    }
+
+    ATLAS_TRACE_MPI( IRECEIVE ) {
+        for ( int jproc = 0; jproc < nproc; ++jproc ) {
+            if ( recv_counts[jproc] > 0 ) {
+                recv_req[jproc] =
+                    mpi::comm().iReceive( &recv_buffer[recv_displs[jproc]], recv_counts[jproc], jproc, tag );
+            }
+        }
+    }
+
+    /// Pack halo values, then zero the halo
+    halo_packer<parallelDim, RANK>::pack( recvcnt_, recvmap_, field_hv, send_buffer );
+    halo_packer<parallelDim, RANK>::zero( recvcnt_, recvmap_, var_size, field_hv );
+
+    ATLAS_TRACE_MPI( ISEND ) {
+        for ( int jproc = 0; jproc < nproc; ++jproc ) {
+            if ( send_counts[jproc] > 0 ) {
+                send_req[jproc] = mpi::comm().iSend( &send_buffer[send_displs[jproc]], send_counts[jproc], jproc, tag );
+            }
+        }
+    }
+
+    ATLAS_TRACE_MPI( WAIT, "mpi-wait receive" ) {
+        for ( int jproc = 0; jproc < nproc; ++jproc ) {
+            if ( recv_counts[jproc] > 0 ) { mpi::comm().wait( recv_req[jproc] ); }
+        }
+    }
+
+    /// Accumulate onto owned values
+    halo_packer<parallelDim, RANK>::unpack_adjoint( sendcnt_, sendmap_, recv_buffer, field_hv );
+
+    ATLAS_TRACE_MPI( WAIT, "mpi-wait send" ) {
+        for ( int jproc = 0; jproc < nproc; ++jproc ) {
+            if ( send_counts[jproc] > 0 ) { mpi::comm().wait( send_req[jproc] ); }
+        }
+    }
+}
+
 // template<typename DATA_TYPE>
 // void HaloExchange::execute( DATA_TYPE field[], idx_t nb_vars ) const
 //{
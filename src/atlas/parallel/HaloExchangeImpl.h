@@ -104,5 +104,45 @@ struct halo_unpacker_impl<ParallelDim, 0, CurrentDim> {
     }
 };
 
+template <int ParallelDim, int Cnt, int CurrentDim>
+struct halo_adjoint_unpacker_impl {
+    template <typename DATA_TYPE, int RANK, typename... Idx>
+    static void apply( idx_t& buf_idx, const idx_t node_idx, array::SVector<DATA_TYPE> const& recv_buffer,
+                       array::ArrayView<DATA_TYPE, RANK>& field, Idx... idxs ) {
+        for ( idx_t i = 0; i < field.template shape<CurrentDim>(); ++i ) {
+            halo_adjoint_unpacker_impl<ParallelDim, Cnt - 1, CurrentDim + 1>::apply( buf_idx, node_idx, recv_buffer,
+                                                                                     field, idxs..., i );
+        }
+    }
+};
+
+template <int ParallelDim>
+struct halo_adjoint_unpacker_impl<ParallelDim, 0, ParallelDim> {
+    template <typename DATA_TYPE, int RANK, typename... Idx>
+    static void apply( idx_t& buf_idx, const idx_t node_idx, array::SVector<DATA_TYPE> const& recv_buffer,
+                       array::ArrayView<DATA_TYPE, RANK>& field, Idx... idxs ) {
+        field( idxs... ) += recv_buffer[buf_idx++];
+    }
+};
+
+template <int ParallelDim, int Cnt>
+struct halo_adjoint_unpacker_impl<ParallelDim, Cnt, ParallelDim> {
+    template <typename DATA_TYPE, int RANK, typename... Idx>
+    static void apply( idx_t& buf_idx, const idx_t node_idx, array::SVector<DATA_TYPE> const& recv_buffer,
+                       array::ArrayView<DATA_TYPE, RANK>& field, Idx... idxs ) {
+        halo_adjoint_unpacker_impl<ParallelDim, Cnt - 1, ParallelDim + 1>::apply( buf_idx, node_idx, recv_buffer,
+                                                                                  field, idxs..., node_idx );
+    }
+};
+
+template <int ParallelDim, int CurrentDim>
+struct halo_adjoint_unpacker_impl<ParallelDim, 0, CurrentDim> {
+    template <typename DATA_TYPE, int RANK, typename... Idx>
+    static void apply( idx_t& buf_idx, const idx_t node_idx, array::SVector<DATA_TYPE> const& recv_buffer,
+                       array::ArrayView<DATA_TYPE, RANK>& field, Idx... idxs ) {
+        field( idxs... ) += recv_buffer[buf_idx++];
+    }
+};
+
 }  // namespace parallel
 }  // namespace atlas
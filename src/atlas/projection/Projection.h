@@ -46,6 +46,16 @@ public:
     void xy2lonlat( double crd[] ) const;
     void lonlat2xy( double crd[] ) const;
 
+    /// @brief Projection of n points at once, with coordinates of point i in x[i*stride], y[i*stride],
+    /// lon[i*stride] and lat[i*stride]; lon and lat may point to x and y to project in place.
+    /// Use this instead of a loop over xy2lonlat( double crd[] ) for many points.
+    void xy2lonlat( const idx_t n, const double x[], const double y[], double lon[], double lat[],
+                    const idx_t stride = 1 ) const;
+
+    /// @brief Inverse projection of n points at once, see xy2lonlat for n points
+    void lonlat2xy( const idx_t n, const double lon[], const double lat[], double x[], double y[],
+                    const idx_t stride = 1 ) const;
+
     PointLonLat lonlat( const PointXY& ) const;
     PointXY xy( const PointLonLat& ) const;
 
@@ -73,6 +83,14 @@ inline void Projection::xy2lonlat( double crd[] ) const {
 inline void Projection::lonlat2xy( double crd[] ) const {
     return projection_->lonlat2xy( crd );
 }
+inline void Projection::xy2lonlat( const idx_t n, const double x[], const double y[], double lon[], double lat[],
+                                   const idx_t stride ) const {
+    return projection_->xy2lonlat( n, x, y, lon, lat, stride );
+}
+inline void Projection::lonlat2xy( const idx_t n, const double lon[], const double lat[], double x[], double y[],
+                                   const idx_t stride ) const {
+    return projection_->lonlat2xy( n, lon, lat, x, y, stride );
+}
 inline PointLonLat Projection::lonlat( const PointXY& xy ) const {
     return projection_->lonlat( xy );
 }
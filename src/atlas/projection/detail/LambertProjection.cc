@@ -88,6 +88,31 @@ void LambertProjection::xy2lonlat( double crd[] ) const {
     }
 }
 
+void LambertProjection::lonlat2xy( const idx_t n, const double lon[], const double lat[], double x[], double y[],
+                                   const idx_t stride ) const {
+    const double radius_F = radius_ * F_;
+    for ( idx_t i = 0; i < n; ++i ) {
+        const double rho   = radius_F / std::pow( std::tan( D2R( 45 + lat[i * stride] * 0.5 ) ), n_ );
+        const double theta = D2R( n_ * ( lon[i * stride] - lon0_ ) );
+        x[i * stride]      = rho * std::sin( theta );
+        y[i * stride]      = rho0_ - rho * std::cos( theta );
+    }
+}
+
+void LambertProjection::xy2lonlat( const idx_t n, const double x[], const double y[], double lon[], double lat[],
+                                   const idx_t stride ) const {
+    const double radius_F = radius_ * F_;
+    for ( idx_t i = 0; i < n; ++i ) {
+        const double xi    = x[i * stride];
+        const double y0    = rho0_ - y[i * stride];
+        const double rho   = sign_ * std::sqrt( xi * xi + y0 * y0 );
+        const double theta = R2D( std::atan2( sign_ * xi, sign_ * y0 ) );
+
+        lon[i * stride] = theta * inv_n_ + lon0_;
+        lat[i * stride] = rho == 0. ? sign_ * 90. : 2. * R2D( std::atan( std::pow( radius_F / rho, inv_n_ ) ) ) - 90.;
+    }
+}
+
 // specification
 LambertProjection::Spec LambertProjection::spec() const {
     Spec proj_spec;
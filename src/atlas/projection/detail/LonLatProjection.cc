@@ -19,6 +19,26 @@ LonLatProjectionT<Rotation>::LonLatProjectionT( const eckit::Parametrisation& co
     ProjectionImpl(),
     rotation_( config ) {}
 
+template <typename Rotation>
+void LonLatProjectionT<Rotation>::xy2lonlat( const idx_t n, const double x[], const double y[], double lon[],
+                                             double lat[], const idx_t stride ) const {
+    for ( idx_t i = 0; i < n; ++i ) {
+        lon[i * stride] = x[i * stride];
+        lat[i * stride] = y[i * stride];
+    }
+    rotation_.rotate( n, lon, lat, stride );
+}
+
+template <typename Rotation>
+void LonLatProjectionT<Rotation>::lonlat2xy( const idx_t n, const double lon[], const double lat[], double x[],
+                                             double y[], const idx_t stride ) const {
+    for ( idx_t i = 0; i < n; ++i ) {
+        x[i * stride] = lon[i * stride];
+        y[i * stride] = lat[i * stride];
+    }
+    rotation_.unrotate( n, x, y, stride );
+}
+
 template <typename Rotation>
 typename LonLatProjectionT<Rotation>::Spec LonLatProjectionT<Rotation>::spec() const {
     Spec proj_spec;
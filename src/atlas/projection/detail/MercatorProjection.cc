@@ -68,6 +68,39 @@ void MercatorProjectionT<Rotation>::xy2lonlat( double crd[] ) const {
     rotation_.rotate( crd );
 }
 
+template <typename Rotation>
+void MercatorProjectionT<Rotation>::lonlat2xy( const idx_t n, const double lon[], const double lat[], double x[],
+                                               double y[], const idx_t stride ) const {
+    for ( idx_t i = 0; i < n; ++i ) {
+        x[i * stride] = lon[i * stride];
+        y[i * stride] = lat[i * stride];
+    }
+
+    // first unrotate
+    rotation_.unrotate( n, x, y, stride );
+
+    // then project
+    for ( idx_t i = 0; i < n; ++i ) {
+        x[i * stride] = radius_ * ( D2R( x[i * stride] - lon0_ ) );
+        y[i * stride] = radius_ * std::log( std::tan( D2R( 45. + y[i * stride] * 0.5 ) ) );
+    }
+}
+
+template <typename Rotation>
+void MercatorProjectionT<Rotation>::xy2lonlat( const idx_t n, const double x[], const double y[], double lon[],
+                                               double lat[], const idx_t stride ) const {
+    // first projection
+    for ( idx_t i = 0; i < n; ++i ) {
+        const double xi = x[i * stride];
+        const double yi = y[i * stride];
+        lon[i * stride] = lon0_ + R2D( xi * inv_radius_ );
+        lat[i * stride] = 2. * R2D( std::atan( std::exp( yi * inv_radius_ ) ) ) - 90.;
+    }
+
+    // then rotate
+    rotation_.rotate( n, lon, lat, stride );
+}
+
 // specification
 template <typename Rotation>
 typename MercatorProjectionT<Rotation>::Spec MercatorProjectionT<Rotation>::spec() const {
@@ -29,6 +29,10 @@ public:
     // projection and inverse projection
     virtual void xy2lonlat( double crd[] ) const override;
     virtual void lonlat2xy( double crd[] ) const override;
+    virtual void xy2lonlat( const idx_t n, const double x[], const double y[], double lon[], double lat[],
+                            const idx_t stride = 1 ) const override;
+    virtual void lonlat2xy( const idx_t n, const double lon[], const double lat[], double x[], double y[],
+                            const idx_t stride = 1 ) const override;
 
     virtual bool strictlyRegional() const override {
         return true;
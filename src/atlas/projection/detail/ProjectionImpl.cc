@@ -31,6 +31,26 @@ ProjectionImpl* ProjectionImpl::create( const eckit::Parametrisation& p ) {
     throw eckit::BadParameter( "type missing in Params", Here() );
 }
 
+void ProjectionImpl::xy2lonlat( const idx_t n, const double x[], const double y[], double lon[], double lat[],
+                                const idx_t stride ) const {
+    for ( idx_t i = 0; i < n; ++i ) {
+        double crd[] = {x[i * stride], y[i * stride]};
+        xy2lonlat( crd );
+        lon[i * stride] = crd[0];
+        lat[i * stride] = crd[1];
+    }
+}
+
+void ProjectionImpl::lonlat2xy( const idx_t n, const double lon[], const double lat[], double x[], double y[],
+                                const idx_t stride ) const {
+    for ( idx_t i = 0; i < n; ++i ) {
+        double crd[] = {lon[i * stride], lat[i * stride]};
+        lonlat2xy( crd );
+        x[i * stride] = crd[0];
+        y[i * stride] = crd[1];
+    }
+}
+
 Rotated::Rotated( const PointLonLat& south_pole, double rotation_angle ) :
     util::Rotation( south_pole, rotation_angle ) {}
 
@@ -17,6 +17,7 @@
 #include "eckit/memory/Owned.h"
 #include "eckit/utils/Hash.h"
 
+#include "atlas/library/config.h"
 #include "atlas/util/Config.h"
 #include "atlas/util/Point.h"
 #include "atlas/util/Rotation.h"
@@ -44,6 +45,16 @@ public:
     virtual void xy2lonlat( double crd[] ) const = 0;
     virtual void lonlat2xy( double crd[] ) const = 0;
 
+    /// @brief Projection of n points, with coordinates of point i in x[i*stride], y[i*stride], lon[i*stride]
+    /// and lat[i*stride]. Output may overwrite input (lon == x and lat == y).
+    /// The default implementation calls xy2lonlat( double crd[] ) for each point.
+    virtual void xy2lonlat( const idx_t n, const double x[], const double y[], double lon[], double lat[],
+                            const idx_t stride = 1 ) const;
+
+    /// @brief Inverse projection of n points, with the same conventions as xy2lonlat for n points
+    virtual void lonlat2xy( const idx_t n, const double lon[], const double lat[], double x[], double y[],
+                            const idx_t stride = 1 ) const;
+
     PointLonLat lonlat( const PointXY& ) const;
     PointXY xy( const PointLonLat& ) const;
 
@@ -101,6 +112,10 @@ public:
     }
     void unrotate( double crd[] ) const { /* do nothing */
     }
+    void rotate( const idx_t, double[], double[], const idx_t = 1 ) const { /* do nothing */
+    }
+    void unrotate( const idx_t, double[], double[], const idx_t = 1 ) const { /* do nothing */
+    }
 
     bool rotated() const { return false; }
 
@@ -55,6 +55,32 @@ void SchmidtProjectionT<Rotation>::lonlat2xy( double crd[] ) const {
         R2D( std::asin( std::cos( 2. * std::atan( c_ * std::tan( std::acos( std::sin( D2R( crd[1] ) ) ) * 0.5 ) ) ) ) );
 }
 
+template <typename Rotation>
+void SchmidtProjectionT<Rotation>::xy2lonlat( const idx_t n, const double x[], const double y[], double lon[],
+                                              double lat[], const idx_t stride ) const {
+    const double inv_c = 1. / c_;
+    for ( idx_t i = 0; i < n; ++i ) {
+        const double half_colat = 0.5 * std::acos( std::sin( D2R( y[i * stride] ) ) );
+        lon[i * stride]         = x[i * stride];
+        lat[i * stride]         = R2D( std::asin( std::cos( 2. * std::atan( inv_c * std::tan( half_colat ) ) ) ) );
+    }
+    rotation_.rotate( n, lon, lat, stride );
+}
+
+template <typename Rotation>
+void SchmidtProjectionT<Rotation>::lonlat2xy( const idx_t n, const double lon[], const double lat[], double x[],
+                                              double y[], const idx_t stride ) const {
+    for ( idx_t i = 0; i < n; ++i ) {
+        x[i * stride] = lon[i * stride];
+        y[i * stride] = lat[i * stride];
+    }
+    rotation_.unrotate( n, x, y, stride );
+    for ( idx_t i = 0; i < n; ++i ) {
+        const double half_colat = 0.5 * std::acos( std::sin( D2R( y[i * stride] ) ) );
+        y[i * stride]           = R2D( std::asin( std::cos( 2. * std::atan( c_ * std::tan( half_colat ) ) ) ) );
+    }
+}
+
 // specification
 template <typename Rotation>
 typename SchmidtProjectionT<Rotation>::Spec SchmidtProjectionT<Rotation>::spec() const {
@@ -9,8 +9,12 @@
  */
 
 #include "atlas/trans/Cache.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
 #include <cstdlib>
 
+#include "eckit/config/Configuration.h"
 #include "eckit/exception/Exceptions.h"
 #include "eckit/io/DataHandle.h"
 #include "eckit/thread/AutoLock.h"
@@ -40,6 +44,25 @@ TransCacheFileEntry::TransCacheFileEntry( const eckit::PathName& path ) : buffer
     dh->close();
 }
 
+TransCacheMemoryMappedFileEntry::TransCacheMemoryMappedFileEntry( const eckit::PathName& path ) :
+    size_( path.size() ) {
+    ATLAS_TRACE();
+    Log::debug() << "Mapping cache from file " << path << std::endl;
+    if ( size_ == 0 ) { return; }
+    int fd = ::open( path.localPath(), O_RDONLY );
+    if ( fd < 0 ) { throw eckit::CantOpenFile( path ); }
+    data_ = ::mmap( nullptr, size_, PROT_READ, MAP_SHARED, fd, 0 );
+    ::close( fd );  // the mapping remains valid
+    if ( data_ == MAP_FAILED ) {
+        data_ = nullptr;
+        throw eckit::FailedSystemCall( "mmap " + path.asString() );
+    }
+}
+
+TransCacheMemoryMappedFileEntry::~TransCacheMemoryMappedFileEntry() {
+    if ( data_ ) { ::munmap( data_, size_ ); }
+}
+
 TransCacheMemoryEntry::TransCacheMemoryEntry( const void* data, size_t size ) : data_( data ), size_( size ) {
     ASSERT( data_ );
     ASSERT( size_ );
@@ -57,6 +80,18 @@ LegendreFFTCache::LegendreFFTCache( const eckit::PathName& legendre_path, const
 LegendreCache::LegendreCache( const eckit::PathName& path ) :
     Cache( std::shared_ptr<TransCacheEntry>( new TransCacheFileEntry( path ) ) ) {}
 
+namespace {
+std::shared_ptr<TransCacheEntry> file_entry( const eckit::PathName& path, const eckit::Configuration& config ) {
+    if ( config.getBool( "memory_map", false ) ) {
+        return std::shared_ptr<TransCacheEntry>( new TransCacheMemoryMappedFileEntry( path ) );
+    }
+    return std::shared_ptr<TransCacheEntry>( new TransCacheFileEntry( path ) );
+}
+}  // namespace
+
+LegendreCache::LegendreCache( const eckit::PathName& path, const eckit::Configuration& config ) :
+    Cache( file_entry( path, config ) ) {}
+
 LegendreCache::LegendreCache( size_t size ) : Cache( std::make_shared<TransCacheOwnedMemoryEntry>( size ) ) {}
 
 LegendreCache::LegendreCache( const void* address, size_t size ) :
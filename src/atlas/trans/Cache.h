@@ -19,6 +19,10 @@
 //-----------------------------------------------------------------------------
 // Forward declarations
 
+namespace eckit {
+class Configuration;
+}
+
 namespace atlas {
 class Field;
 class FieldSet;
@@ -66,6 +70,26 @@ public:
 
 //-----------------------------------------------------------------------------
 
+/// @class TransCacheMemoryMappedFileEntry
+///
+/// Cache file mapped read-only into memory. Pages are loaded on first access, and are
+/// shared through the page cache of the operating system between all processes of a node
+/// mapping the same file, so that only one physical copy is resident per node.
+/// The file must not be modified while it is mapped.
+class TransCacheMemoryMappedFileEntry final : public TransCacheEntry {
+public:
+    TransCacheMemoryMappedFileEntry( const eckit::PathName& path );
+    ~TransCacheMemoryMappedFileEntry();
+    virtual size_t size() const override { return size_; }
+    virtual const void* data() const override { return data_; }
+
+private:
+    void* data_  = nullptr;
+    size_t size_ = 0;
+};
+
+//-----------------------------------------------------------------------------
+
 class TransCacheMemoryEntry final : public TransCacheEntry {
 public:
     TransCacheMemoryEntry( const void* data, size_t size );
@@ -126,6 +150,11 @@ public:
     LegendreCache( size_t size );
     LegendreCache( const void* address, size_t size );
     LegendreCache( const eckit::PathName& path );
+
+    /// @brief Cache read from file, with configuration option:
+    ///  - memory_map (default false): map the file into memory instead of reading it,
+    ///                                see TransCacheMemoryMappedFileEntry
+    LegendreCache( const eckit::PathName& path, const eckit::Configuration& );
 };
 
 class LegendreFFTCache : public Cache {
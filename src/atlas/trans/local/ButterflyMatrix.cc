@@ -0,0 +1,395 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "eckit/exception/Exceptions.h"
+
+#include "atlas/trans/local/ButterflyMatrix.h"
+
+namespace atlas {
+namespace trans {
+
+namespace {
+
+// The encoding starts with a header holding the number of rows, the number of columns and the number of
+// levels L, followed by the ranks of the interpolative decompositions of the L levels (2^L per level),
+// followed by the interpolation matrices of all levels and the dense blocks of the leaves.
+constexpr int header_size = 3;
+
+// Begin of block j out of nb_blocks of the range [0,n)
+int block_begin( const int n, const int j, const int nb_blocks ) {
+    return int( ( long( n ) * j ) / nb_blocks );
+}
+
+// Interpolative decomposition of the column-major matrix B (rows x cols), computed with a column-pivoted
+// QR decomposition: B ~ B(:,skeleton) * P, where the skeleton is a subset of rank columns of B, and the
+// interpolation matrix P (rank x cols) contains the identity in the skeleton columns.
+// The rank is chosen such that the norms of the remaining columns after elimination of the skeleton are
+// below tolerance times the largest column norm of B.
+void interpolative_decomposition( const int rows, const int cols, std::vector<double>& B, const double tolerance,
+                                  int& rank_out, std::vector<double>& P ) {
+    auto b = [&]( int i, int j ) -> double& { return B[i + size_t( rows ) * j]; };
+
+    std::vector<int> pivots( cols );
+    for ( int j = 0; j < cols; ++j ) {
+        pivots[j] = j;
+    }
+    std::vector<double> norms( cols );
+    double reference = 0.;
+    int rank         = 0;
+    for ( ; rank < std::min( rows, cols ); ++rank ) {
+        const int s = rank;
+        int jmax    = s;
+        for ( int j = s; j < cols; ++j ) {
+            double norm = 0.;
+            for ( int i = s; i < rows; ++i ) {
+                norm += b( i, j ) * b( i, j );
+            }
+            norms[j] = norm;
+            if ( norm > norms[jmax] ) { jmax = j; }
+        }
+        const double norm = std::sqrt( norms[jmax] );
+        if ( s == 0 ) { reference = norm; }
+        if ( norm == 0. || norm <= tolerance * reference ) { break; }
+
+        if ( jmax != s ) {
+            std::swap( pivots[s], pivots[jmax] );
+            for ( int i = 0; i < rows; ++i ) {
+                std::swap( b( i, s ), b( i, jmax ) );
+            }
+        }
+
+        // Householder reflection eliminating column s below the diagonal
+        const double alpha = b( s, s ) > 0. ? -norm : norm;
+        b( s, s ) -= alpha;
+        double vnorm2 = 0.;
+        for ( int i = s; i < rows; ++i ) {
+            vnorm2 += b( i, s ) * b( i, s );
+        }
+        if ( vnorm2 > 0. ) {
+            for ( int j = s + 1; j < cols; ++j ) {
+                double dot = 0.;
+                for ( int i = s; i < rows; ++i ) {
+                    dot += b( i, s ) * b( i, j );
+                }
+                const double f = 2. * dot / vnorm2;
+                for ( int i = s; i < rows; ++i ) {
+                    b( i, j ) -= f * b( i, s );
+                }
+            }
+        }
+        b( s, s ) = alpha;
+    }
+
+    // P(:,pivots) = [ I, R11^-1 R12 ], stored as the pivots followed by R11^-1 R12 (row-major)
+    P.assign( pivots.begin(), pivots.end() );
+    P.resize( cols + size_t( rank ) * ( cols - rank ) );
+    double* t = P.data() + cols;
+    for ( int j = rank; j < cols; ++j ) {
+        for ( int a = rank - 1; a >= 0; --a ) {
+            double sum = b( a, j );
+            for ( int c = a + 1; c < rank; ++c ) {
+                sum -= b( a, c ) * t[c * size_t( cols - rank ) + j - rank];
+            }
+            t[a * size_t( cols - rank ) + j - rank] = sum / b( a, a );
+        }
+    }
+    rank_out = rank;
+}
+
+// out(rank x nvec) = P(rank x input) * in(input x nvec), with P encoded as by interpolative_decomposition
+void interpolate( const int rank, const int input, const double P[], const int nvec, const double in[],
+                  double out[] ) {
+    const double* pivots = P;
+    const double* t      = P + input;
+    for ( int a = 0; a < rank; ++a ) {
+        double* outa      = out + size_t( a ) * nvec;
+        const double* ina = in + size_t( pivots[a] ) * nvec;
+        for ( int v = 0; v < nvec; ++v ) {
+            outa[v] = ina[v];
+        }
+        for ( int c = rank; c < input; ++c ) {
+            const double tac  = t[size_t( a ) * ( input - rank ) + c - rank];
+            const double* inc = in + size_t( pivots[c] ) * nvec;
+            for ( int v = 0; v < nvec; ++v ) {
+                outa[v] += tac * inc[v];
+            }
+        }
+    }
+}
+
+// out(input x nvec) += P(rank x input)^T * in(rank x nvec)
+void interpolate_transpose( const int rank, const int input, const double P[], const int nvec, const double in[],
+                            double out[] ) {
+    const double* pivots = P;
+    const double* t      = P + input;
+    for ( int a = 0; a < rank; ++a ) {
+        const double* ina = in + size_t( a ) * nvec;
+        double* outa      = out + size_t( pivots[a] ) * nvec;
+        for ( int v = 0; v < nvec; ++v ) {
+            outa[v] += ina[v];
+        }
+        for ( int c = rank; c < input; ++c ) {
+            const double tac = t[size_t( a ) * ( input - rank ) + c - rank];
+            double* outc     = out + size_t( pivots[c] ) * nvec;
+            for ( int v = 0; v < nvec; ++v ) {
+                outc[v] += tac * ina[v];
+            }
+        }
+    }
+}
+
+// out(m x nvec) = M(m x n, row-major) * in(n x nvec)
+void apply( const int m, const int n, const double M[], const int nvec, const double in[], double out[] ) {
+    for ( int a = 0; a < m; ++a ) {
+        double* outa = out + size_t( a ) * nvec;
+        for ( int v = 0; v < nvec; ++v ) {
+            outa[v] = 0.;
+        }
+        for ( int c = 0; c < n; ++c ) {
+            const double mac  = M[size_t( a ) * n + c];
+            const double* inc = in + size_t( c ) * nvec;
+            for ( int v = 0; v < nvec; ++v ) {
+                outa[v] += mac * inc[v];
+            }
+        }
+    }
+}
+
+// out(n x nvec) += M(m x n, row-major)^T * in(m x nvec)
+void apply_transpose( const int m, const int n, const double M[], const int nvec, const double in[], double out[] ) {
+    for ( int a = 0; a < m; ++a ) {
+        const double* ina = in + size_t( a ) * nvec;
+        for ( int c = 0; c < n; ++c ) {
+            const double mac = M[size_t( a ) * n + c];
+            double* outc     = out + size_t( c ) * nvec;
+            for ( int v = 0; v < nvec; ++v ) {
+                outc[v] += mac * ina[v];
+            }
+        }
+    }
+}
+
+}  // namespace
+
+// --------------------------------------------------------------------------------------------------------------------
+
+void ButterflyMatrix::compress( const int rows, const int cols, const double A[], const size_t lda,
+                                const double tolerance, std::vector<double>& encoded, const int leaf_size ) {
+    ASSERT( rows >= 0 && cols >= 0 && leaf_size > 0 );
+    int levels = 0;
+    while ( ( rows >> ( levels + 1 ) ) >= leaf_size && ( cols >> ( levels + 1 ) ) >= leaf_size ) {
+        ++levels;
+    }
+    const int nb_nodes = 1 << levels;
+
+    auto submatrix = [&]( int row_begin, int row_end, const std::vector<int>& columns ) {
+        const int nrows = row_end - row_begin;
+        std::vector<double> B( size_t( nrows ) * columns.size() );
+        for ( size_t c = 0; c < columns.size(); ++c ) {
+            for ( int i = 0; i < nrows; ++i ) {
+                B[i + nrows * c] = A[row_begin + i + lda * columns[c]];
+            }
+        }
+        return B;
+    };
+
+    // skeleton columns of the nodes of the previous and current level
+    std::vector<std::vector<int>> skeletons_prev, skeletons( nb_nodes );
+    std::vector<int> ranks;
+    std::vector<double> values;
+    std::vector<double> P;
+    for ( int level = 0; level < levels; ++level ) {
+        const int nb_row_blocks = 1 << level;
+        const int nb_col_blocks = nb_nodes >> level;
+        std::swap( skeletons_prev, skeletons );
+        skeletons.assign( nb_nodes, std::vector<int>() );
+        for ( int i = 0; i < nb_row_blocks; ++i ) {
+            const int row_begin = block_begin( rows, i, nb_row_blocks );
+            const int row_end   = block_begin( rows, i + 1, nb_row_blocks );
+            for ( int j = 0; j < nb_col_blocks; ++j ) {
+                std::vector<int> input;
+                if ( level == 0 ) {
+                    for ( int c = block_begin( cols, j, nb_col_blocks ); c < block_begin( cols, j + 1, nb_col_blocks );
+                          ++c ) {
+                        input.push_back( c );
+                    }
+                }
+                else {
+                    const int parent = ( i / 2 ) * ( 2 * nb_col_blocks ) + 2 * j;
+                    input            = skeletons_prev[parent];
+                    input.insert( input.end(), skeletons_prev[parent + 1].begin(), skeletons_prev[parent + 1].end() );
+                }
+                std::vector<double> B = submatrix( row_begin, row_end, input );
+                int rank;
+                interpolative_decomposition( row_end - row_begin, input.size(), B, tolerance, rank, P );
+                std::vector<int>& skeleton = skeletons[i * nb_col_blocks + j];
+                for ( int s = 0; s < rank; ++s ) {
+                    skeleton.push_back( input[int( P[s] )] );
+                }
+                ranks.push_back( rank );
+                values.insert( values.end(), P.begin(), P.end() );
+            }
+        }
+    }
+    for ( int i = 0; i < nb_nodes; ++i ) {
+        const int row_begin = block_begin( rows, i, nb_nodes );
+        const int row_end   = block_begin( rows, i + 1, nb_nodes );
+        std::vector<int> input;
+        if ( levels == 0 ) {
+            for ( int c = 0; c < cols; ++c ) {
+                input.push_back( c );
+            }
+        }
+        else {
+            const int parent = ( i / 2 ) * 2;
+            input            = skeletons[parent];
+            input.insert( input.end(), skeletons[parent + 1].begin(), skeletons[parent + 1].end() );
+        }
+        // dense block, row-major
+        for ( int r = row_begin; r < row_end; ++r ) {
+            for ( int c : input ) {
+                values.push_back( A[r + lda * c] );
+            }
+        }
+    }
+
+    encoded.push_back( rows );
+    encoded.push_back( cols );
+    encoded.push_back( levels );
+    encoded.insert( encoded.end(), ranks.begin(), ranks.end() );
+    encoded.insert( encoded.end(), values.begin(), values.end() );
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+ButterflyMatrix::ButterflyMatrix( const double data[] ) : data_( data ) {
+    rows_              = int( data_[0] );
+    cols_              = int( data_[1] );
+    levels_            = int( data_[2] );
+    const int nb_nodes = 1 << levels_;
+
+    size_t pos = header_size + size_t( levels_ ) * nb_nodes;
+    nodes_.resize( levels_ );
+    level_size_.resize( levels_ );
+    for ( int level = 0; level < levels_; ++level ) {
+        const int nb_row_blocks = 1 << level;
+        const int nb_col_blocks = nb_nodes >> level;
+        nodes_[level].resize( nb_nodes );
+        size_t offset = 0;
+        for ( int i = 0; i < nb_row_blocks; ++i ) {
+            for ( int j = 0; j < nb_col_blocks; ++j ) {
+                Node& node = nodes_[level][i * nb_col_blocks + j];
+                node.rank  = int( data_[header_size + size_t( level ) * nb_nodes + i * nb_col_blocks + j] );
+                if ( level == 0 ) {
+                    node.input = block_begin( cols_, j + 1, nb_col_blocks ) - block_begin( cols_, j, nb_col_blocks );
+                }
+                else {
+                    const int parent = ( i / 2 ) * ( 2 * nb_col_blocks ) + 2 * j;
+                    node.input       = nodes_[level - 1][parent].rank + nodes_[level - 1][parent + 1].rank;
+                }
+                node.values = pos;
+                node.offset = offset;
+                pos += node.input + size_t( node.rank ) * ( node.input - node.rank );
+                offset += node.rank;
+            }
+        }
+        level_size_[level] = offset;
+    }
+    leaves_.resize( nb_nodes );
+    for ( int i = 0; i < nb_nodes; ++i ) {
+        Leaf& leaf     = leaves_[i];
+        leaf.row_begin = block_begin( rows_, i, nb_nodes );
+        leaf.row_end   = block_begin( rows_, i + 1, nb_nodes );
+        if ( levels_ == 0 ) { leaf.input = cols_; }
+        else {
+            const int parent = ( i / 2 ) * 2;
+            leaf.input       = nodes_[levels_ - 1][parent].rank + nodes_[levels_ - 1][parent + 1].rank;
+        }
+        leaf.values = pos;
+        pos += size_t( leaf.row_end - leaf.row_begin ) * leaf.input;
+    }
+    size_ = pos;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+void ButterflyMatrix::multiply( const int nvec, const double X[], double Y[] ) const {
+    const int nb_nodes = 1 << levels_;
+    std::vector<double> in, out;
+    for ( int level = 0; level < levels_; ++level ) {
+        const int nb_col_blocks = nb_nodes >> level;
+        out.resize( level_size_[level] * nvec );
+        for ( int n = 0; n < nb_nodes; ++n ) {
+            const Node& node = nodes_[level][n];
+            const double* x;
+            if ( level == 0 ) { x = X + size_t( block_begin( cols_, n, nb_col_blocks ) ) * nvec; }
+            else {
+                const int i      = n / nb_col_blocks;
+                const int j      = n % nb_col_blocks;
+                const int parent = ( i / 2 ) * ( 2 * nb_col_blocks ) + 2 * j;
+                x                = in.data() + nodes_[level - 1][parent].offset * nvec;
+            }
+            interpolate( node.rank, node.input, data_ + node.values, nvec, x, out.data() + node.offset * nvec );
+        }
+        std::swap( in, out );
+    }
+    for ( int i = 0; i < nb_nodes; ++i ) {
+        const Leaf& leaf = leaves_[i];
+        const double* x  = levels_ == 0 ? X : in.data() + nodes_[levels_ - 1][( i / 2 ) * 2].offset * nvec;
+        apply( leaf.row_end - leaf.row_begin, leaf.input, data_ + leaf.values, nvec, x,
+               Y + size_t( leaf.row_begin ) * nvec );
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+void ButterflyMatrix::multiply_transpose( const int nvec, const double Y[], double X[] ) const {
+    const int nb_nodes = 1 << levels_;
+    std::vector<double> in, out;
+    if ( levels_ == 0 ) { std::fill( X, X + size_t( cols_ ) * nvec, 0. ); }
+    else {
+        out.assign( level_size_[levels_ - 1] * nvec, 0. );
+    }
+    for ( int i = 0; i < nb_nodes; ++i ) {
+        const Leaf& leaf = leaves_[i];
+        double* x        = levels_ == 0 ? X : out.data() + nodes_[levels_ - 1][( i / 2 ) * 2].offset * nvec;
+        apply_transpose( leaf.row_end - leaf.row_begin, leaf.input, data_ + leaf.values, nvec,
+                         Y + size_t( leaf.row_begin ) * nvec, x );
+    }
+    for ( int level = levels_ - 1; level >= 0; --level ) {
+        const int nb_col_blocks = nb_nodes >> level;
+        std::swap( in, out );
+        if ( level == 0 ) { std::fill( X, X + size_t( cols_ ) * nvec, 0. ); }
+        else {
+            out.assign( level_size_[level - 1] * nvec, 0. );
+        }
+        for ( int n = 0; n < nb_nodes; ++n ) {
+            const Node& node = nodes_[level][n];
+            double* x;
+            if ( level == 0 ) { x = X + size_t( block_begin( cols_, n, nb_col_blocks ) ) * nvec; }
+            else {
+                const int i      = n / nb_col_blocks;
+                const int j      = n % nb_col_blocks;
+                const int parent = ( i / 2 ) * ( 2 * nb_col_blocks ) + 2 * j;
+                x                = out.data() + nodes_[level - 1][parent].offset * nvec;
+            }
+            interpolate_transpose( node.rank, node.input, data_ + node.values, nvec, in.data() + node.offset * nvec,
+                                   x );
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+}  // namespace trans
+}  // namespace atlas
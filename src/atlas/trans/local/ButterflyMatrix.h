@@ -0,0 +1,90 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace atlas {
+namespace trans {
+
+//-----------------------------------------------------------------------------
+
+/// @class ButterflyMatrix
+///
+/// Butterfly compression of a dense matrix, used for fast Legendre transforms at high truncations.
+/// Matrices of associated Legendre functions have blocks of low numerical rank whenever the number of rows
+/// of a block times its number of columns is about constant (complementary low-rank property). The
+/// compression factorises the matrix with interpolative decompositions over a hierarchy of row and column
+/// blocks, so that applying it costs O(N log N) instead of O(N^2) operations for an N x N matrix, with
+/// a relative accuracy given by the tolerance of the compression.
+///
+/// The compressed matrix is encoded in a contiguous array of doubles, which can be stored in a cache.
+/// A ButterflyMatrix does not own the encoded data, but only refers to it.
+///
+/// Reference:
+/// M. O'Neil, F. Woolfe, V. Rokhlin, An algorithm for the rapid evaluation of special function transforms,
+///      Appl. Comput. Harmon. Anal. Vol. 28 (2) pp. 203-226 (2010)
+/// M. Tygert, Fast algorithms for spherical harmonic expansions, III,
+///      J. Comput. Phys. Vol. 229 (18) pp. 6181-6192 (2010)
+class ButterflyMatrix {
+public:
+    /// @brief Compress the column-major matrix A of size rows x cols with leading dimension lda,
+    /// and append its encoding to the array encoded
+    static void compress( const int rows, const int cols, const double A[], const size_t lda,
+                          const double tolerance, std::vector<double>& encoded, const int leaf_size = 32 );
+
+    ButterflyMatrix() = default;
+
+    /// @brief Refer to a compressed matrix, encoded starting at the address data
+    ButterflyMatrix( const double data[] );
+
+    int rows() const { return rows_; }
+    int cols() const { return cols_; }
+
+    /// @brief Number of doubles of the encoding
+    size_t size() const { return size_; }
+
+    /// @brief Y = A X, with X of size cols x nvec and Y of size rows x nvec.
+    /// Vectors are interleaved: element (j,v) is stored at position v + nvec * j.
+    void multiply( const int nvec, const double X[], double Y[] ) const;
+
+    /// @brief X = A^T Y, with Y of size rows x nvec and X of size cols x nvec (layout as for multiply)
+    void multiply_transpose( const int nvec, const double Y[], double X[] ) const;
+
+private:
+    struct Node {
+        int rank;        // number of skeleton columns
+        int input;       // number of input columns
+        size_t values;   // position of the interpolation matrix (pivots, then R11^-1 R12) in data_
+        size_t offset;   // position of the skeleton coefficients within the workspace of the level
+    };
+    struct Leaf {
+        int row_begin;
+        int row_end;
+        int input;
+        size_t values;  // position of the dense block (rows x input, row-major) in data_
+    };
+
+    const double* data_{nullptr};
+    size_t size_{0};
+    int rows_{0};
+    int cols_{0};
+    int levels_{0};
+    std::vector<std::vector<Node>> nodes_;  // for each level, nodes ordered by row block, then column block
+    std::vector<size_t> level_size_;        // number of skeleton coefficients per vector for each level
+    std::vector<Leaf> leaves_;
+};
+
+// --------------------------------------------------------------------------------------------------------------------
+
+}  // namespace trans
+}  // namespace atlas
@@ -50,6 +50,16 @@ std::string hash( const eckit::Configuration& config ) {
     // Add options and other unique keys
     h << "flt" << config.getBool( "flt", false );
 
+    // Only hashed when not default, so that identifiers of existing double precision caches are unchanged
+    std::string legendre_storage = config.getString( "legendre_storage", "double" );
+    if ( legendre_storage != "double" ) { h << "legendre_storage" << legendre_storage; }
+    std::string legendre_method = config.getString( "legendre_method", "precomputed" );
+    if ( legendre_method != "precomputed" ) {
+        h << "legendre_method" << legendre_method;
+        h << "butterfly_tolerance" << config.getDouble( "butterfly_tolerance", 1.e-12 );
+        h << "butterfly_leaf_size" << config.getLong( "butterfly_leaf_size", 32 );
+    }
+
     return truncate( h.digest() );
 }
 
@@ -118,6 +128,8 @@ LegendreCacheCreatorLocal::LegendreCacheCreatorLocal( const Grid& grid, int trun
 bool LegendreCacheCreatorLocal::supported() const {
     if ( not grid::StructuredGrid( grid_ ) ) return false;
     if ( grid_.projection() ) return false;
+    // Legendre coefficients computed on the fly are not cached
+    if ( config_.getString( "legendre_method", "precomputed" ) == "on_the_fly" ) return false;
     return true;
 }
 
@@ -133,7 +145,11 @@ Cache LegendreCacheCreatorLocal::create() const {
 }
 
 size_t LegendreCacheCreatorLocal::estimate() const {
-    return size_t( truncation_ * truncation_ * truncation_ ) / 2 * sizeof( double );
+    const size_t value_size =
+        config_.getString( "legendre_storage", "double" ) == "single" ? sizeof( float ) : sizeof( double );
+    // The size of a butterfly compression is not known in advance, and is estimated by the dense size,
+    // which it undercuts at high truncations.
+    return size_t( truncation_ * truncation_ * truncation_ ) / 2 * value_size;
 }
 
 
@@ -9,11 +9,16 @@
  * does it submit to any jurisdiction.
  */
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <vector>
+
+#include "eckit/exception/Exceptions.h"
 
 #include "atlas/array.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/trans/local/LegendrePolynomials.h"
 
 namespace atlas {
@@ -35,6 +40,7 @@ void compute_zfn( const size_t trc, double zfn[] ) {
         }
         iodd                  = jn % 2;
         zfn[idxzfn( jn, jn )] = zfnn;
+        if ( iodd ) { zfn[idxzfn( jn, 0 )] = 0.; }
         for ( int jgl = 2; jgl <= jn - iodd; jgl += 2 ) {
             double zfjn = ( ( jgl - 1. ) * ( 2. * jn - jgl + 2. ) );  // new factor numerator
             double zfjd = ( jgl * ( 2. * jn - jgl + 1. ) );           // new factor denominator
@@ -149,6 +155,166 @@ void compute_legendre_polynomials_lat( const size_t trc,  // truncation (in)
 }
 
 
+namespace {
+
+// Number of latitudes for which the Legendre polynomials are computed together.
+// All recurrences are evaluated with the latitude as innermost (vectorisable) loop.
+constexpr int nlats_block = legendre_band_size;
+
+struct LegendreBlockWorkspace {
+    std::vector<double> vsin;
+    std::vector<double> vcos;
+    std::vector<double> diag;
+    std::vector<double> columns;  // 3 columns (wavenumbers m-2, m-1, m) used in recurrence
+};
+
+//-----------------------------------------------------------------------------
+// Same algorithm as compute_legendre_polynomials_lat, but for a block of latitudes, and
+// one zonal wavenumber at a time. For each zonal wavenumber jm, the polynomials are passed
+// to store( jm, leg ), with leg[jl + nlats_block * jn] the value for latitude jl, jn=jm..trc
+//
+template <typename Store>
+void compute_legendre_polynomials_block( const size_t trc, const double lats[], const double zfn[],
+                                         LegendreBlockWorkspace& w, Store store ) {
+    constexpr int NB = nlats_block;
+    auto idxzfn      = [&]( int jn, int jk ) { return jk + ( trc + 1 ) * jn; };
+    auto idx         = [&]( int jn, int jl ) { return jl + NB * jn; };
+
+    const size_t column_size = NB * ( trc + 1 );
+    w.vsin.resize( column_size );
+    w.vcos.resize( column_size );
+    w.diag.resize( column_size );
+    w.columns.resize( 3 * column_size );
+    double* vsin = w.vsin.data();
+    double* vcos = w.vcos.data();
+    double* diag = w.diag.data();
+    auto column  = [&]( int jm ) { return w.columns.data() + ( jm % 3 ) * column_size; };
+
+    // --------------------
+    // 1. First two columns
+    // --------------------
+    double zdlx[NB], zdlsita[NB], zdls[NB];
+    for ( int jl = 0; jl < NB; ++jl ) {
+        double zdlx1 = ( M_PI_2 - lats[jl] );         // theta
+        zdlx[jl]     = std::cos( zdlx1 );              // cos(theta)
+        zdlsita[jl]  = std::sqrt( 1. - zdlx[jl] * zdlx[jl] );  // sin(theta) (this is how trans library does it)
+        for ( int j = 1; j <= trc; j++ ) {
+            vsin[idx( j, jl )] = std::sin( j * zdlx1 );
+            vcos[idx( j, jl )] = std::cos( j * zdlx1 );
+        }
+        double zdl1sita = 0.;
+        // if we are less than 1 meter from the pole,
+        if ( std::abs( zdlsita[jl] ) <= std::sqrt( std::numeric_limits<double>::epsilon() ) ) {
+            zdlx[jl]    = 1.;
+            zdlsita[jl] = 0.;
+        }
+        else {
+            zdl1sita = 1. / zdlsita[jl];
+        }
+        zdls[jl] = zdl1sita * std::numeric_limits<double>::min();
+    }
+
+    double* col0 = column( 0 );
+    double* col1 = column( 1 );
+    for ( int jl = 0; jl < NB; ++jl ) {
+        col0[idx( 0, jl )] = 1.;
+    }
+
+    // ordinary Legendre polynomials from series expansion
+    // even N and odd N, represented by only even k resp. odd k
+    for ( int jn = 1; jn <= trc; ++jn ) {
+        const int iodd    = jn % 2;
+        const double zdsq = 1. / std::sqrt( jn * ( jn + 1. ) );
+        for ( int jl = 0; jl < NB; ++jl ) {
+            col0[idx( jn, jl )] = iodd ? 0. : 0.5 * zfn[idxzfn( jn, 0 )];
+            col1[idx( jn, jl )] = 0.;
+        }
+        for ( int jk = 2 - iodd; jk <= jn; jk += 2 ) {
+            const double zfnk = zfn[idxzfn( jn, jk )];
+            for ( int jl = 0; jl < NB; ++jl ) {
+                // normalised ordinary Legendre polynomial == \overbar{P_n}^0
+                col0[idx( jn, jl )] = col0[idx( jn, jl )] + zfnk * vcos[idx( jk, jl )];
+                // normalised associated Legendre polynomial == \overbar{P_n}^1
+                col1[idx( jn, jl )] = col1[idx( jn, jl )] + zdsq * zfnk * jk * vsin[idx( jk, jl )];
+            }
+        }
+    }
+
+    // --------------------------------------------------------------
+    // 2. Diagonal (the terms 0,0 and 1,1 have already been computed)
+    //    Belousov, equation (23)
+    // --------------------------------------------------------------
+    for ( int jl = 0; jl < NB; ++jl ) {
+        diag[idx( 0, jl )] = col0[idx( 0, jl )];
+        if ( trc > 0 ) { diag[idx( 1, jl )] = col1[idx( 1, jl )]; }
+    }
+    for ( int jn = 2; jn <= trc; ++jn ) {
+        const double sq = std::sqrt( ( 2. * jn + 1. ) / ( 2. * jn ) );
+        for ( int jl = 0; jl < NB; ++jl ) {
+            double d           = diag[idx( jn - 1, jl )] * zdlsita[jl] * sq;
+            diag[idx( jn, jl )] = ( std::abs( d ) < zdls[jl] ) ? 0. : d;
+        }
+    }
+
+    store( 0, col0 );
+    if ( trc > 0 ) { store( 1, col1 ); }
+
+    // ---------------------------------------------
+    // 3. General recurrence (Belousov, equation 17)
+    // ---------------------------------------------
+    for ( int jm = 2; jm <= trc; ++jm ) {
+        double* col         = column( jm );
+        const double* colm2 = column( jm - 2 );
+        for ( int jl = 0; jl < NB; ++jl ) {
+            col[idx( jm, jl )] = diag[idx( jm, jl )];
+        }
+        for ( int jn = jm + 1; jn <= trc; ++jn ) {
+            double cn = ( ( 2. * jn + 1. ) * ( jn + jm - 3. ) * ( jn + jm - 1. ) );  // numerator of c in Belousov
+            double cd = ( ( 2. * jn - 3. ) * ( jn + jm - 2. ) * ( jn + jm ) );       // denominator of c in Belousov
+            double dn = ( ( 2. * jn + 1. ) * ( jn - jm + 1. ) * ( jn + jm - 1. ) );  // numerator of d in Belousov
+            double dd = ( ( 2. * jn - 1. ) * ( jn + jm - 2. ) * ( jn + jm ) );       // denominator of d in Belousov
+            double en = ( ( 2. * jn + 1. ) * ( jn - jm ) );                          // numerator of e in Belousov
+            double ed = ( ( 2. * jn - 1. ) * ( jn + jm ) );                          // denominator of e in Belousov
+            const double c = std::sqrt( cn / cd );
+            const double d = std::sqrt( dn / dd );
+            const double e = std::sqrt( en / ed );
+            for ( int jl = 0; jl < NB; ++jl ) {
+                col[idx( jn, jl )] = c * colm2[idx( jn - 2, jl )] - d * colm2[idx( jn - 1, jl )] * zdlx[jl] +
+                                     e * col[idx( jn - 1, jl )] * zdlx[jl];
+            }
+        }
+        store( jm, col );
+    }
+}
+
+// Loop over blocks of latitudes in parallel
+template <typename Store>
+void compute_legendre_polynomials_blocked( const size_t trc, const int nlats, const double lats[], Store store ) {
+    std::vector<double> zfn( ( trc + 1 ) * ( trc + 1 ) );
+    compute_zfn( trc, zfn.data() );
+
+    const int nblocks = ( nlats + nlats_block - 1 ) / nlats_block;
+    atlas_omp_parallel {
+        LegendreBlockWorkspace workspace;
+        double lats_block[nlats_block];
+        atlas_omp_for( int jb = 0; jb < nblocks; ++jb ) {
+            const int jlat_begin = jb * nlats_block;
+            const int nb_valid   = std::min( nlats_block, nlats - jlat_begin );
+            for ( int jl = 0; jl < nlats_block; ++jl ) {
+                // pad the last block by repeating its last latitude
+                lats_block[jl] = lats[jlat_begin + std::min( jl, nb_valid - 1 )];
+            }
+            compute_legendre_polynomials_block( trc, lats_block, zfn.data(), workspace,
+                                                [&]( int jm, const double leg[] ) {
+                                                    store( jlat_begin, nb_valid, jm, leg );
+                                                } );
+        }
+    }
+}
+
+}  // namespace
+
+
 void compute_legendre_polynomials(
     const size_t trc,          // truncation (in)
     const int nlats,           // number of latitudes
@@ -158,50 +324,63 @@ void compute_legendre_polynomials(
     size_t leg_start_sym[],    // start indices for different zonal wave numbers, symmetric part
     size_t leg_start_asym[] )  // start indices for different zonal wave numbers, asymmetric part
 {
-    auto legendre_size = [&]( int truncation ) { return ( truncation + 2 ) * ( truncation + 1 ) / 2; };
-    std::vector<double> legpol( legendre_size( trc ) );
-    std::vector<double> zfn( ( trc + 1 ) * ( trc + 1 ) );
-    auto idxmn = [&]( int jm, int jn ) { return ( 2 * trc + 3 - jm ) * jm / 2 + jn - jm; };
-    compute_zfn( trc, zfn.data() );
-
-    // Loop over latitudes:
-    for ( int jlat = 0; jlat < nlats; ++jlat ) {
-        // compute legendre polynomials for current latitude:
-        compute_legendre_polynomials_lat( trc, lats[jlat], legpol.data(), zfn.data() );
-
+    auto store = [&]( int jlat_begin, int nb_lats, int jm, const double leg[] ) {
+        // zonal wavenumbers without storage are not needed (e.g. held by another MPI task):
+        if ( leg_start_sym[jm + 1] == leg_start_sym[jm] && leg_start_asym[jm + 1] == leg_start_asym[jm] ) { return; }
         // split polynomials into symmetric and antisymmetric parts:
-        {
-            //ATLAS_TRACE( "add to global arrays" );
-
-            for ( int jm = 0; jm <= trc; jm++ ) {
-                int is1 = 0, ia1 = 0;
-                for ( int jn = jm; jn <= trc; jn++ ) {
-                    if ( ( jn - jm ) % 2 == 0 ) { is1++; }
-                    else {
-                        ia1++;
-                    }
+        const int is1 = ( trc - jm ) / 2 + 1;  // number of symmetric total wavenumbers
+        const int ia1 = ( trc - jm + 1 ) / 2;  // number of antisymmetric total wavenumbers
+        for ( int jl = 0; jl < nb_lats; ++jl ) {
+            const int jlat = jlat_begin + jl;
+            int is2 = 0, ia2 = 0;
+            // the choice between the following two code lines determines whether
+            // total wavenumbers are summed in an ascending or descending order.
+            // The trans library in IFS uses descending order because it should
+            // be more accurate (higher wavenumbers have smaller contributions).
+            // This also needs to be changed when splitting the spectral data in
+            // TransLocal::invtrans_uv!
+            //for ( int jn = jm; jn <= trc; jn++ ) {
+            for ( int jn = trc; jn >= jm; jn-- ) {
+                if ( ( jn - jm ) % 2 == 0 ) {
+                    size_t is   = leg_start_sym[jm] + is1 * jlat + is2++;
+                    leg_sym[is] = leg[jl + nlats_block * jn];
                 }
-                int is2 = 0, ia2 = 0;
-                // the choice between the following two code lines determines whether
-                // total wavenumbers are summed in an ascending or descending order.
-                // The trans library in IFS uses descending order because it should
-                // be more accurate (higher wavenumbers have smaller contributions).
-                // This also needs to be changed when splitting the spectral data in
-                // TransLocal::invtrans_uv!
-                //for ( int jn = jm; jn <= trc; jn++ ) {
-                for ( int jn = trc; jn >= jm; jn-- ) {
-                    if ( ( jn - jm ) % 2 == 0 ) {
-                        int is      = leg_start_sym[jm] + is1 * jlat + is2++;
-                        leg_sym[is] = legpol[idxmn( jm, jn )];
-                    }
-                    else {
-                        int ia       = leg_start_asym[jm] + ia1 * jlat + ia2++;
-                        leg_asym[ia] = legpol[idxmn( jm, jn )];
-                    }
+                else {
+                    size_t ia    = leg_start_asym[jm] + ia1 * jlat + ia2++;
+                    leg_asym[ia] = leg[jl + nlats_block * jn];
                 }
             }
         }
+    };
+    compute_legendre_polynomials_blocked( trc, nlats, lats, store );
+}
+
+void compute_legendre_polynomials_band(
+    const size_t trc, const int nlats, const double lats[], const double zfn[],
+    const std::function<void( int jm, const double leg_sym[], const double leg_asym[] )>& store ) {
+    ASSERT( nlats > 0 && nlats <= nlats_block );
+    LegendreBlockWorkspace workspace;
+    double lats_block[nlats_block];
+    for ( int jl = 0; jl < nlats_block; ++jl ) {
+        // pad the band by repeating its last latitude
+        lats_block[jl] = lats[std::min( jl, nlats - 1 )];
     }
+    std::vector<double> leg_sym( nlats * ( trc / 2 + 1 ) ), leg_asym( nlats * ( ( trc + 1 ) / 2 ) );
+    compute_legendre_polynomials_block( trc, lats_block, zfn, workspace, [&]( int jm, const double leg[] ) {
+        // split polynomials into symmetric and antisymmetric parts, in descending order of total wavenumbers
+        const int is1 = ( trc - jm ) / 2 + 1;  // number of symmetric total wavenumbers
+        const int ia1 = ( trc - jm + 1 ) / 2;  // number of antisymmetric total wavenumbers
+        for ( int jl = 0; jl < nlats; ++jl ) {
+            int is2 = 0, ia2 = 0;
+            for ( int jn = trc; jn >= jm; jn-- ) {
+                if ( ( jn - jm ) % 2 == 0 ) { leg_sym[is1 * jl + is2++] = leg[jl + nlats_block * jn]; }
+                else {
+                    leg_asym[ia1 * jl + ia2++] = leg[jl + nlats_block * jn];
+                }
+            }
+        }
+        store( jm, leg_sym.data(), leg_asym.data() );
+    } );
 }
 
 void compute_legendre_polynomials_all( const size_t trc,     // truncation (in)
@@ -209,27 +388,18 @@ void compute_legendre_polynomials_all( const size_t trc,     // truncation (in)
                                        const double lats[],  // latitudes in radians (in)
                                        double legendre[] )   // legendre polynomials for all latitudes
 {
-    auto legendre_size = [&]( int truncation ) { return ( truncation + 2 ) * ( truncation + 1 ) / 2; };
-    std::vector<double> legpol( legendre_size( trc ) );
-    std::vector<double> zfn( ( trc + 1 ) * ( trc + 1 ) );
-    auto idxmn  = [&]( int jm, int jn ) { return ( 2 * trc + 3 - jm ) * jm / 2 + jn - jm; };
     auto idxmnl = [&]( int jm, int jn, int jlat ) {
-        return ( 2 * trc + 3 - jm ) * jm / 2 * nlats + jlat * ( trc - jm + 1 ) + jn - jm;
+        return size_t( ( 2 * trc + 3 - jm ) * jm / 2 ) * nlats + size_t( jlat ) * ( trc - jm + 1 ) + jn - jm;
     };
-    compute_zfn( trc, zfn.data() );
-
-    // Loop over latitudes:
-    for ( int jlat = 0; jlat < nlats; ++jlat ) {
-        // compute legendre polynomials for current latitude:
-        compute_legendre_polynomials_lat( trc, lats[jlat], legpol.data(), zfn.data() );
-
-        for ( int jm = 0; jm <= trc; ++jm ) {
+    auto store = [&]( int jlat_begin, int nb_lats, int jm, const double leg[] ) {
+        for ( int jl = 0; jl < nb_lats; ++jl ) {
             for ( int jn = jm; jn <= trc; ++jn ) {
-                legendre[idxmnl( jm, jn, jlat )] = legpol[idxmn( jm, jn )];
+                legendre[idxmnl( jm, jn, jlat_begin + jl )] = leg[jl + nlats_block * jn];
             }
         }
-    }
-}  // namespace trans
+    };
+    compute_legendre_polynomials_blocked( trc, nlats, lats, store );
+}
 
 // --------------------------------------------------------------------------------------------------------------------
 
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <cstddef>
+#include <functional>
 
 namespace atlas {
 namespace trans {
@@ -39,6 +40,8 @@ void compute_legendre_polynomials_lat( const size_t trc,  // truncation (in)
                                        double legpol[],   // legendre polynomials
                                        double zfn[] );
 
+// Zonal wavenumbers jm with leg_start_sym[jm+1]==leg_start_sym[jm] and leg_start_asym[jm+1]==leg_start_asym[jm]
+// are skipped, so that storage only needs to be reserved for the zonal wavenumbers required.
 void compute_legendre_polynomials(
     const size_t trc,           // truncation (in)
     const int nlats,            // number of latitudes
@@ -48,6 +51,20 @@ void compute_legendre_polynomials(
     size_t leg_start_sym[],     // start indices for different zonal wave numbers, symmetric part
     size_t leg_start_asym[] );  // start indices for different zonal wave numbers, asymmetric part
 
+// Maximum number of latitudes of compute_legendre_polynomials_band
+constexpr int legendre_band_size = 8;
+
+// Computes the Legendre polynomials of a band of (at most legendre_band_size) latitudes without storing
+// them: for each zonal wavenumber jm = 0..trc in turn, store( jm, leg_sym, leg_asym ) is called with the
+// symmetric and antisymmetric parts, laid out as for one zonal wavenumber in compute_legendre_polynomials.
+// The coefficients zfn must have been computed by compute_zfn( trc, zfn ).
+void compute_legendre_polynomials_band(
+    const size_t trc,     // truncation (in)
+    const int nlats,      // number of latitudes
+    const double lats[],  // latitudes in radians (in)
+    const double zfn[],   // coefficients of the series expansion (in)
+    const std::function<void( int jm, const double leg_sym[], const double leg_asym[] )>& store );
+
 void compute_legendre_polynomials_all( const size_t trc,     // truncation (in)
                                        const int nlats,      // number of latitudes
                                        const double lats[],  // latitudes in radians (in)
@@ -0,0 +1,337 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <algorithm>
+#include <numeric>
+
+#include "eckit/exception/Exceptions.h"
+
+#include "atlas/functionspace/StructuredColumns.h"
+#include "atlas/grid/Grid.h"
+#include "atlas/parallel/mpi/Statistics.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/Trace.h"
+#include "atlas/trans/local/ParallelisationLocal.h"
+
+namespace atlas {
+namespace trans {
+
+namespace {
+void compute_displs( const std::vector<int>& counts, std::vector<int>& displs ) {
+    displs.resize( counts.size() );
+    int displ = 0;
+    for ( size_t j = 0; j < counts.size(); ++j ) {
+        displs[j] = displ;
+        displ += counts[j];
+    }
+}
+
+std::vector<int> scaled( const std::vector<int>& v, int factor ) {
+    std::vector<int> result( v.size() );
+    for ( size_t j = 0; j < v.size(); ++j ) {
+        result[j] = v[j] * factor;
+    }
+    return result;
+}
+}  // namespace
+
+ParallelisationLocal::ParallelisationLocal( const functionspace::StructuredColumns& fs, int truncation ) :
+    nb_parts_( mpi::comm().size() ),
+    part_( mpi::comm().rank() ),
+    truncation_( truncation ),
+    nlats_( fs.grid().ny() ) {
+    ATLAS_TRACE( "ParallelisationLocal setup" );
+    const grid::StructuredGrid& grid = fs.grid();
+
+    // Zonal wavenumbers are dealt out to the tasks in the order 0,1,...,P-1,P-1,...,1,0,0,1,..., which balances
+    // the cost of the Legendre transforms as it decreases with increasing zonal wavenumber.
+    zonal_wavenumber_part_.resize( truncation_ + 1 );
+    zonal_wavenumber_index_.resize( truncation_ + 1 );
+    zonal_wavenumbers_.resize( nb_parts_ );
+    for ( int jm = 0; jm <= truncation_; ++jm ) {
+        const int cycle = jm / nb_parts_;
+        const int jpart = ( cycle % 2 == 0 ) ? jm % nb_parts_ : nb_parts_ - 1 - jm % nb_parts_;
+        zonal_wavenumber_part_[jm]  = jpart;
+        zonal_wavenumber_index_[jm] = zonal_wavenumbers_[jpart].size();
+        zonal_wavenumbers_[jpart].push_back( jm );
+    }
+
+    // Latitudes are split into contiguous bands of about equal numbers of grid points,
+    // each latitude going to the band in which its middle point falls.
+    std::vector<size_t> gp_begin( nlats_ + 1 );  // offset of each latitude in the global grid
+    gp_begin[0] = 0;
+    for ( int jlat = 0; jlat < nlats_; ++jlat ) {
+        gp_begin[jlat + 1] = gp_begin[jlat] + grid.nx( jlat );
+    }
+    const size_t nb_gp_global = gp_begin[nlats_];
+    std::vector<int> latitude_part( nlats_ );
+    for ( int jlat = 0; jlat < nlats_; ++jlat ) {
+        const size_t middle = 2 * gp_begin[jlat] + grid.nx( jlat );
+        latitude_part[jlat] = std::min<int>( nb_parts_ - 1, middle * nb_parts_ / ( 2 * nb_gp_global ) );
+    }
+    lat_begin_.resize( nb_parts_ + 1 );
+    for ( int jpart = 0, jlat = 0; jpart <= nb_parts_; ++jpart ) {
+        while ( jlat < nlats_ && latitude_part[jlat] < jpart ) {
+            ++jlat;
+        }
+        lat_begin_[jpart] = jlat;
+    }
+    nb_gridpoints_latitudes_ = gp_begin[lat_end()] - gp_begin[lat_begin()];
+
+    // Owned points of the StructuredColumns, grouped by the task holding their latitude.
+    // For each of them the position within the latitudes of that task is sent along.
+    nb_gridpoints_columns_ = fs.sizeOwned();
+    columns_counts_.assign( nb_parts_, 0 );
+    for ( idx_t j = fs.j_begin(); j < fs.j_end(); ++j ) {
+        if ( fs.i_begin( j ) < fs.i_end( j ) ) { columns_counts_[latitude_part[j]] += fs.i_end( j ) - fs.i_begin( j ); }
+    }
+    compute_displs( columns_counts_, columns_displs_ );
+    ASSERT( size_t( std::accumulate( columns_counts_.begin(), columns_counts_.end(), 0 ) ) == nb_gridpoints_columns_ );
+
+    columns_index_.resize( nb_gridpoints_columns_ );
+    std::vector<int> positions( nb_gridpoints_columns_ );
+    std::vector<int> pos( columns_displs_ );
+    for ( idx_t j = fs.j_begin(); j < fs.j_end(); ++j ) {
+        const int jpart = latitude_part[j];
+        for ( idx_t i = fs.i_begin( j ); i < fs.i_end( j ); ++i ) {
+            columns_index_[pos[jpart]] = fs.index( i, j );
+            positions[pos[jpart]]      = gp_begin[j] + i - gp_begin[lat_begin_[jpart]];
+            ++pos[jpart];
+        }
+    }
+
+    latitudes_counts_.resize( nb_parts_ );
+    ATLAS_TRACE_MPI( ALLTOALL ) { mpi::comm().allToAll( columns_counts_, latitudes_counts_ ); }
+    compute_displs( latitudes_counts_, latitudes_displs_ );
+    ASSERT( size_t( std::accumulate( latitudes_counts_.begin(), latitudes_counts_.end(), 0 ) ) ==
+            nb_gridpoints_latitudes_ );
+
+    latitudes_index_.resize( nb_gridpoints_latitudes_ );
+    ATLAS_TRACE_MPI( ALLTOALL ) {
+        mpi::comm().allToAllv( positions.data(), columns_counts_.data(), columns_displs_.data(),
+                               latitudes_index_.data(), latitudes_counts_.data(), latitudes_displs_.data() );
+    }
+}
+
+size_t ParallelisationLocal::nb_spectral_coefficients( int truncation ) const {
+    size_t nb_coefficients = 0;
+    for ( int jm : zonal_wavenumbers() ) {
+        if ( jm <= truncation ) { nb_coefficients += 2 * ( truncation + 1 - jm ); }
+    }
+    return nb_coefficients;
+}
+
+size_t ParallelisationLocal::spectral_offset( int truncation, int jm ) const {
+    size_t offset = 0;
+    for ( int jm_before : zonal_wavenumbers() ) {
+        if ( jm_before == jm ) { break; }
+        offset += 2 * ( truncation + 1 - jm_before );
+    }
+    return offset;
+}
+
+void ParallelisationLocal::fourier_counts( int nb_fields, std::vector<int>& wavenumber_counts,
+                                           std::vector<int>& wavenumber_displs, std::vector<int>& latitude_counts,
+                                           std::vector<int>& latitude_displs ) const {
+    // wavenumber side: zonal wavenumbers of this task on the latitudes of each task
+    // latitude side:   zonal wavenumbers of each task on the latitudes of this task
+    const int nb_wavenumbers = zonal_wavenumbers().size();
+    const int nb_latitudes   = lat_end() - lat_begin();
+    wavenumber_counts.resize( nb_parts_ );
+    latitude_counts.resize( nb_parts_ );
+    for ( int jpart = 0; jpart < nb_parts_; ++jpart ) {
+        wavenumber_counts[jpart] = 2 * nb_fields * nb_wavenumbers * ( lat_begin_[jpart + 1] - lat_begin_[jpart] );
+        latitude_counts[jpart]   = 2 * nb_fields * int( zonal_wavenumbers_[jpart].size() ) * nb_latitudes;
+    }
+    compute_displs( wavenumber_counts, wavenumber_displs );
+    compute_displs( latitude_counts, latitude_displs );
+}
+
+void ParallelisationLocal::transpose_to_latitudes( int nb_fields, const double fourier_wavenumbers[],
+                                                   double fourier_latitudes[] ) const {
+    ATLAS_TRACE( "Transposition to latitudes" );
+    std::vector<int> sendcounts, senddispls, recvcounts, recvdispls;
+    fourier_counts( nb_fields, sendcounts, senddispls, recvcounts, recvdispls );
+    std::vector<double> sendbuf( senddispls.back() + sendcounts.back() );
+    std::vector<double> recvbuf( recvdispls.back() + recvcounts.back() );
+
+    const int nb_latitudes   = lat_end() - lat_begin();
+    const int nb_wavenumbers = zonal_wavenumbers().size();
+    auto pos_wavenumbers     = [&]( int jfld, int imag, int jlat, int jm ) {
+        return imag + 2 * ( zonal_wavenumber_index_[jm] + nb_wavenumbers * ( jlat + nlats_ * jfld ) );
+    };
+    auto pos_latitudes = [&]( int jfld, int imag, int jlat, int jm ) {
+        return imag + 2 * ( jm + ( truncation_ + 1 ) * ( jlat + nb_latitudes * jfld ) );
+    };
+
+    atlas_omp_parallel_for( int jpart = 0; jpart < nb_parts_; ++jpart ) {
+        int idx = senddispls[jpart];
+        for ( int jm : zonal_wavenumbers() ) {
+            for ( int jlat = lat_begin_[jpart]; jlat < lat_begin_[jpart + 1]; ++jlat ) {
+                for ( int jfld = 0; jfld < nb_fields; ++jfld ) {
+                    for ( int imag = 0; imag < 2; ++imag ) {
+                        sendbuf[idx++] = fourier_wavenumbers[pos_wavenumbers( jfld, imag, jlat, jm )];
+                    }
+                }
+            }
+        }
+    }
+
+    ATLAS_TRACE_MPI( ALLTOALL ) {
+        mpi::comm().allToAllv( sendbuf.data(), sendcounts.data(), senddispls.data(), recvbuf.data(),
+                               recvcounts.data(), recvdispls.data() );
+    }
+
+    atlas_omp_parallel_for( int jpart = 0; jpart < nb_parts_; ++jpart ) {
+        int idx = recvdispls[jpart];
+        for ( int jm : zonal_wavenumbers_[jpart] ) {
+            for ( int jlat = 0; jlat < nb_latitudes; ++jlat ) {
+                for ( int jfld = 0; jfld < nb_fields; ++jfld ) {
+                    for ( int imag = 0; imag < 2; ++imag ) {
+                        fourier_latitudes[pos_latitudes( jfld, imag, jlat, jm )] = recvbuf[idx++];
+                    }
+                }
+            }
+        }
+    }
+}
+
+void ParallelisationLocal::transpose_to_wavenumbers( int nb_fields, const double fourier_latitudes[],
+                                                     double fourier_wavenumbers[] ) const {
+    ATLAS_TRACE( "Transposition to zonal wavenumbers" );
+    std::vector<int> recvcounts, recvdispls, sendcounts, senddispls;
+    fourier_counts( nb_fields, recvcounts, recvdispls, sendcounts, senddispls );
+    std::vector<double> sendbuf( senddispls.back() + sendcounts.back() );
+    std::vector<double> recvbuf( recvdispls.back() + recvcounts.back() );
+
+    const int nb_latitudes   = lat_end() - lat_begin();
+    const int nb_wavenumbers = zonal_wavenumbers().size();
+    auto pos_wavenumbers     = [&]( int jfld, int imag, int jlat, int jm ) {
+        return imag + 2 * ( zonal_wavenumber_index_[jm] + nb_wavenumbers * ( jlat + nlats_ * jfld ) );
+    };
+    auto pos_latitudes = [&]( int jfld, int imag, int jlat, int jm ) {
+        return imag + 2 * ( jm + ( truncation_ + 1 ) * ( jlat + nb_latitudes * jfld ) );
+    };
+
+    atlas_omp_parallel_for( int jpart = 0; jpart < nb_parts_; ++jpart ) {
+        int idx = senddispls[jpart];
+        for ( int jm : zonal_wavenumbers_[jpart] ) {
+            for ( int jlat = 0; jlat < nb_latitudes; ++jlat ) {
+                for ( int jfld = 0; jfld < nb_fields; ++jfld ) {
+                    for ( int imag = 0; imag < 2; ++imag ) {
+                        sendbuf[idx++] = fourier_latitudes[pos_latitudes( jfld, imag, jlat, jm )];
+                    }
+                }
+            }
+        }
+    }
+
+    ATLAS_TRACE_MPI( ALLTOALL ) {
+        mpi::comm().allToAllv( sendbuf.data(), sendcounts.data(), senddispls.data(), recvbuf.data(),
+                               recvcounts.data(), recvdispls.data() );
+    }
+
+    atlas_omp_parallel_for( int jpart = 0; jpart < nb_parts_; ++jpart ) {
+        int idx = recvdispls[jpart];
+        for ( int jm : zonal_wavenumbers() ) {
+            for ( int jlat = lat_begin_[jpart]; jlat < lat_begin_[jpart + 1]; ++jlat ) {
+                for ( int jfld = 0; jfld < nb_fields; ++jfld ) {
+                    for ( int imag = 0; imag < 2; ++imag ) {
+                        fourier_wavenumbers[pos_wavenumbers( jfld, imag, jlat, jm )] = recvbuf[idx++];
+                    }
+                }
+            }
+        }
+    }
+}
+
+void ParallelisationLocal::gridpoints_to_columns( int nb_fields, const double gp_latitudes[],
+                                                  double gp_columns[] ) const {
+    gridpoints_to_columns( gp_latitudes,
+                           StridedFields<double>::contiguous( nb_fields, nb_gridpoints_columns_, gp_columns ) );
+}
+
+void ParallelisationLocal::gridpoints_to_columns( const double gp_latitudes[],
+                                                  const StridedFields<double>& gp_columns ) const {
+    ATLAS_TRACE( "Redistribution to StructuredColumns" );
+    const int nb_fields               = gp_columns.size();
+    const std::vector<int> sendcounts = scaled( latitudes_counts_, nb_fields );
+    const std::vector<int> senddispls = scaled( latitudes_displs_, nb_fields );
+    const std::vector<int> recvcounts = scaled( columns_counts_, nb_fields );
+    const std::vector<int> recvdispls = scaled( columns_displs_, nb_fields );
+    std::vector<double> sendbuf( nb_fields * nb_gridpoints_latitudes_ );
+    std::vector<double> recvbuf( nb_fields * nb_gridpoints_columns_ );
+
+    atlas_omp_parallel_for( int jpart = 0; jpart < nb_parts_; ++jpart ) {
+        int idx = senddispls[jpart];
+        for ( int jfld = 0; jfld < nb_fields; ++jfld ) {
+            const double* gp = gp_latitudes + jfld * nb_gridpoints_latitudes_;
+            for ( int j = latitudes_displs_[jpart]; j < latitudes_displs_[jpart] + latitudes_counts_[jpart]; ++j ) {
+                sendbuf[idx++] = gp[latitudes_index_[j]];
+            }
+        }
+    }
+
+    ATLAS_TRACE_MPI( ALLTOALL ) {
+        mpi::comm().allToAllv( sendbuf.data(), sendcounts.data(), senddispls.data(), recvbuf.data(),
+                               recvcounts.data(), recvdispls.data() );
+    }
+
+    atlas_omp_parallel_for( int jpart = 0; jpart < nb_parts_; ++jpart ) {
+        int idx = recvdispls[jpart];
+        for ( int jfld = 0; jfld < nb_fields; ++jfld ) {
+            double* gp          = gp_columns.data( jfld );
+            const size_t stride = gp_columns.stride( jfld );
+            for ( int j = columns_displs_[jpart]; j < columns_displs_[jpart] + columns_counts_[jpart]; ++j ) {
+                gp[columns_index_[j] * stride] = recvbuf[idx++];
+            }
+        }
+    }
+}
+
+void ParallelisationLocal::gridpoints_to_latitudes( int nb_fields, const double gp_columns[],
+                                                    double gp_latitudes[] ) const {
+    ATLAS_TRACE( "Redistribution to latitudes" );
+    const std::vector<int> sendcounts = scaled( columns_counts_, nb_fields );
+    const std::vector<int> senddispls = scaled( columns_displs_, nb_fields );
+    const std::vector<int> recvcounts = scaled( latitudes_counts_, nb_fields );
+    const std::vector<int> recvdispls = scaled( latitudes_displs_, nb_fields );
+    std::vector<double> sendbuf( nb_fields * nb_gridpoints_columns_ );
+    std::vector<double> recvbuf( nb_fields * nb_gridpoints_latitudes_ );
+
+    atlas_omp_parallel_for( int jpart = 0; jpart < nb_parts_; ++jpart ) {
+        int idx = senddispls[jpart];
+        for ( int jfld = 0; jfld < nb_fields; ++jfld ) {
+            const double* gp = gp_columns + jfld * nb_gridpoints_columns_;
+            for ( int j = columns_displs_[jpart]; j < columns_displs_[jpart] + columns_counts_[jpart]; ++j ) {
+                sendbuf[idx++] = gp[columns_index_[j]];
+            }
+        }
+    }
+
+    ATLAS_TRACE_MPI( ALLTOALL ) {
+        mpi::comm().allToAllv( sendbuf.data(), sendcounts.data(), senddispls.data(), recvbuf.data(),
+                               recvcounts.data(), recvdispls.data() );
+    }
+
+    atlas_omp_parallel_for( int jpart = 0; jpart < nb_parts_; ++jpart ) {
+        int idx = recvdispls[jpart];
+        for ( int jfld = 0; jfld < nb_fields; ++jfld ) {
+            double* gp = gp_latitudes + jfld * nb_gridpoints_latitudes_;
+            for ( int j = latitudes_displs_[jpart]; j < latitudes_displs_[jpart] + latitudes_counts_[jpart]; ++j ) {
+                gp[latitudes_index_[j]] = recvbuf[idx++];
+            }
+        }
+    }
+}
+
+}  // namespace trans
+}  // namespace atlas
@@ -0,0 +1,137 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "atlas/trans/local/StridedFields.h"
+
+//-----------------------------------------------------------------------------
+// Forward declarations
+
+namespace atlas {
+namespace functionspace {
+class StructuredColumns;
+}  // namespace functionspace
+}  // namespace atlas
+
+//-----------------------------------------------------------------------------
+
+namespace atlas {
+namespace trans {
+
+//-----------------------------------------------------------------------------
+
+/// @class ParallelisationLocal
+///
+/// Distribution of the spectral transforms of TransLocal over MPI tasks, following the IFS trans library:
+///  - zonal wavenumbers are distributed for the Legendre transforms,
+///  - latitudes are distributed in bands of about equal numbers of grid points for the Fourier transforms,
+///  - grid points are distributed as the owned points of a StructuredColumns function space.
+/// Data is moved between these distributions with MPI alltoallv transpositions.
+///
+/// The spectral data of a task holds its zonal wavenumbers in ascending order, each with the layout used
+/// by TransLocal (total wavenumber, real/imaginary part, field), and so do the Fourier coefficients of the
+/// Legendre transforms. No task holds spectral data or Fourier coefficients of all zonal wavenumbers.
+/// The grid-point data of a task holds the owned points of the StructuredColumns, one field after the other.
+class ParallelisationLocal {
+public:
+    ParallelisationLocal( const functionspace::StructuredColumns&, int truncation );
+
+    int nb_parts() const { return nb_parts_; }
+    int part() const { return part_; }
+
+    // -- Spectral space --
+
+    /// @brief Zonal wavenumbers of this task, in ascending order
+    const std::vector<int>& zonal_wavenumbers() const { return zonal_wavenumbers_[part_]; }
+
+    bool owns_zonal_wavenumber( int jm ) const { return jm <= truncation_ && zonal_wavenumber_part_[jm] == part_; }
+
+    /// @brief Position of zonal wavenumber jm of this task in zonal_wavenumbers()
+    int zonal_wavenumber_index( int jm ) const { return zonal_wavenumber_index_[jm]; }
+
+    /// @brief Number of spectral coefficients of this task for given truncation (real and imaginary parts)
+    size_t nb_spectral_coefficients( int truncation ) const;
+
+    /// @brief First spectral coefficient of zonal wavenumber jm (of this task, and at most truncation) in the
+    /// spectral data of this task for given truncation (for each field)
+    size_t spectral_offset( int truncation, int jm ) const;
+
+    // -- Fourier space --
+
+    /// @brief Latitudes [lat_begin,lat_end) of this task
+    int lat_begin() const { return lat_begin_[part_]; }
+    int lat_end() const { return lat_begin_[part_ + 1]; }
+
+    /// @brief Transposition of Fourier coefficients of the zonal wavenumbers of this task for all latitudes,
+    /// to all zonal wavenumbers for the latitudes of this task. The layouts are
+    ///   imag + 2 * ( zonal_wavenumber_index( jm ) + zonal_wavenumbers().size() * ( jlat + nlats * jfld ) )
+    ///   imag + 2 * ( jm + ( truncation + 1 ) * ( jlat + nb_latitudes * jfld ) )
+    void transpose_to_latitudes( int nb_fields, const double fourier_wavenumbers[],
+                                 double fourier_latitudes[] ) const;
+
+    /// @brief Inverse of transpose_to_latitudes
+    void transpose_to_wavenumbers( int nb_fields, const double fourier_latitudes[],
+                                   double fourier_wavenumbers[] ) const;
+
+    // -- Grid-point space --
+
+    /// @brief Number of grid points on the latitudes of this task
+    size_t nb_gridpoints_latitudes() const { return nb_gridpoints_latitudes_; }
+
+    /// @brief Number of grid points owned by this task in the StructuredColumns
+    size_t nb_gridpoints_columns() const { return nb_gridpoints_columns_; }
+
+    /// @brief Redistribution of grid-point fields on the latitudes of this task
+    /// to the owned points of the StructuredColumns
+    void gridpoints_to_columns( int nb_fields, const double gp_latitudes[], double gp_columns[] ) const;
+
+    /// @brief As above, with the owned points of each field written to the given (possibly strided) memory
+    void gridpoints_to_columns( const double gp_latitudes[], const StridedFields<double>& gp_columns ) const;
+
+    /// @brief Inverse of gridpoints_to_columns
+    void gridpoints_to_latitudes( int nb_fields, const double gp_columns[], double gp_latitudes[] ) const;
+
+private:
+    void fourier_counts( int nb_fields, std::vector<int>& wavenumber_counts, std::vector<int>& wavenumber_displs,
+                         std::vector<int>& latitude_counts, std::vector<int>& latitude_displs ) const;
+
+private:
+    int nb_parts_;
+    int part_;
+    int truncation_;
+    int nlats_;
+
+    std::vector<int> zonal_wavenumber_part_;           // task of each zonal wavenumber
+    std::vector<int> zonal_wavenumber_index_;          // position of each zonal wavenumber in its task
+    std::vector<std::vector<int>> zonal_wavenumbers_;  // zonal wavenumbers of each task
+    std::vector<int> lat_begin_;                       // first latitude of each task, followed by nlats_
+
+    size_t nb_gridpoints_latitudes_;
+    size_t nb_gridpoints_columns_;
+
+    // Owned points of the StructuredColumns, grouped by the task holding their latitude
+    std::vector<int> columns_counts_;
+    std::vector<int> columns_displs_;
+    std::vector<int> columns_index_;  // index in the StructuredColumns
+
+    // Points on the latitudes of this task, grouped by the task owning them in the StructuredColumns
+    std::vector<int> latitudes_counts_;
+    std::vector<int> latitudes_displs_;
+    std::vector<int> latitudes_index_;  // index within the latitudes of this task
+};
+
+//-----------------------------------------------------------------------------
+
+}  // namespace trans
+}  // namespace atlas
@@ -0,0 +1,101 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace atlas {
+namespace trans {
+
+//-----------------------------------------------------------------------------
+
+/// @class StridedFields
+///
+/// Set of fields, each referring to its own memory with its own stride between consecutive values:
+/// value j of field jfld is stored at data( jfld )[ j * stride( jfld ) ].
+///
+/// This lets TransLocal read and write the levels (and components) of atlas::Field objects in place,
+/// as well as the contiguous arrays of the IFS style API. The memory is not owned.
+template <typename Value>
+class StridedFields {
+public:
+    StridedFields() = default;
+
+    /// @brief nb_fields fields of field_size values, stored one field after the other
+    static StridedFields contiguous( int nb_fields, size_t field_size, Value data[] ) {
+        StridedFields fields;
+        for ( int jfld = 0; jfld < nb_fields; ++jfld ) {
+            fields.add( data + jfld * field_size, 1 );
+        }
+        return fields;
+    }
+
+    /// @brief nb_fields fields with interleaved values: value j of field jfld is stored at data[jfld + nb_fields * j]
+    static StridedFields interleaved( int nb_fields, Value data[] ) {
+        StridedFields fields;
+        for ( int jfld = 0; jfld < nb_fields; ++jfld ) {
+            fields.add( data + jfld, nb_fields );
+        }
+        return fields;
+    }
+
+    void add( Value* data, size_t stride ) {
+        data_.push_back( data );
+        stride_.push_back( stride );
+    }
+
+    void add( const StridedFields& other ) {
+        data_.insert( data_.end(), other.data_.begin(), other.data_.end() );
+        stride_.insert( stride_.end(), other.stride_.begin(), other.stride_.end() );
+    }
+
+    int size() const { return static_cast<int>( data_.size() ); }
+
+    Value* data( int jfld ) const { return data_[jfld]; }
+    size_t stride( int jfld ) const { return stride_[jfld]; }
+
+    Value& operator()( int jfld, size_t j ) const { return data_[jfld][j * stride_[jfld]]; }
+
+    /// @brief Fields [begin,end)
+    StridedFields slice( int begin, int end ) const {
+        StridedFields fields;
+        fields.data_.assign( data_.begin() + begin, data_.begin() + end );
+        fields.stride_.assign( stride_.begin() + begin, stride_.begin() + end );
+        return fields;
+    }
+
+    /// @brief Start of the memory if the fields are stored as by contiguous( size(), field_size, ... ),
+    /// nullptr otherwise
+    Value* contiguous_data( size_t field_size ) const {
+        for ( int jfld = 0; jfld < size(); ++jfld ) {
+            if ( stride_[jfld] != 1 || data_[jfld] != data_[0] + jfld * field_size ) { return nullptr; }
+        }
+        return size() ? data_[0] : nullptr;
+    }
+
+    /// @brief Start of the memory if the fields are stored as by interleaved( size(), ... ), nullptr otherwise
+    Value* interleaved_data() const {
+        for ( int jfld = 0; jfld < size(); ++jfld ) {
+            if ( stride_[jfld] != size_t( size() ) || data_[jfld] != data_[0] + jfld ) { return nullptr; }
+        }
+        return size() ? data_[0] : nullptr;
+    }
+
+private:
+    std::vector<Value*> data_;
+    std::vector<size_t> stride_;
+};
+
+//-----------------------------------------------------------------------------
+
+}  // namespace trans
+}  // namespace atlas
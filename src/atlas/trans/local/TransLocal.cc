@@ -9,16 +9,32 @@
  */
 
 #include "atlas/trans/local/TransLocal.h"
+#include <algorithm>
+#include <cassert>
 #include <cmath>
 #include <cstdlib>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <tuple>
 #include "atlas/array.h"
+#include "atlas/field/Field.h"
+#include "atlas/field/FieldSet.h"
+#include "atlas/functionspace/Spectral.h"
+#include "atlas/functionspace/StructuredColumns.h"
+#include "atlas/grid/detail/spacing/gaussian/Latitudes.h"
 #include "atlas/option.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/parallel/omp/omp.h"
 #include "atlas/runtime/ErrorHandling.h"
 #include "atlas/runtime/Log.h"
-#include "atlas/trans/VorDivToUV.h"
+#include "atlas/trans/local/ButterflyMatrix.h"
 #include "atlas/trans/local/LegendrePolynomials.h"
+#include "atlas/trans/local/ParallelisationLocal.h"
+#include "atlas/trans/local/VorDivToUVLocal.h"
 #include "atlas/util/Constants.h"
+#include "atlas/util/Earth.h"
 #include "eckit/config/YAMLConfiguration.h"
 #include "eckit/eckit_config.h"
 #include "eckit/linalg/LinearAlgebra.h"
@@ -43,6 +59,7 @@ namespace trans {
 
 namespace {
 static TransBuilderGrid<TransLocal> builder( "local", "local" );
+static TransBuilderFunctionSpace<TransLocal> builder_fs( "local(StructuredColumns,Spectral)", "local" );
 }  // namespace
 
 namespace {
@@ -86,6 +103,49 @@ public:
         return string_to_FFT.at( config_.getString( "fft", fft_default ) );
     }
 
+    // Precision in which the precomputed Legendre coefficients are stored: "double" or "single".
+    // This only affects their memory footprint, as they are used in double precision.
+    bool legendre_single_precision_storage() const {
+        static const std::map<std::string, bool> string_to_precision = {{"double", false}, {"single", true}};
+        return string_to_precision.at( config_.getString( "legendre_storage", "double" ) );
+    }
+
+    // Method of the Legendre transforms of structured grids: dense "precomputed" coefficients,
+    // their "butterfly" compression, or coefficients recomputed "on_the_fly" for bands of latitudes
+    std::string legendre_method() const {
+        std::string method = config_.getString( "legendre_method", "precomputed" );
+        if ( method != "precomputed" && method != "butterfly" && method != "on_the_fly" ) {
+            throw eckit::BadParameter( "TransLocal: unknown legendre_method " + method, Here() );
+        }
+        return method;
+    }
+
+    // Relative accuracy of the butterfly compression of the Legendre coefficients
+    double butterfly_tolerance() const { return config_.getDouble( "butterfly_tolerance", 1.e-12 ); }
+
+    // Number of rows and columns below which blocks of the Legendre coefficients are not compressed further
+    int butterfly_leaf_size() const { return config_.getLong( "butterfly_leaf_size", 32 ); }
+
+    // Number of fields transformed at once in the batched FFTs for reduced grids
+    int fft_batch() const { return config_.getLong( "fft_batch", 16 ); }
+
+#if ATLAS_HAVE_FFTW
+    unsigned fftw_flags() const {
+        static const std::map<std::string, unsigned> string_to_flags = {
+            {"estimate", FFTW_ESTIMATE}, {"measure", FFTW_MEASURE}, {"patient", FFTW_PATIENT}};
+        return string_to_flags.at( config_.getString( "fftw_planner", "estimate" ) );
+    }
+
+    // Number of threads executing each FFT of many latitudes at once (regular grids), if FFTW has OpenMP support
+    int fftw_threads() const {
+#if ATLAS_HAVE_FFTW_OMP
+        return std::max( 1, int( config_.getLong( "fftw_threads", atlas_omp_get_max_threads() ) ) );
+#else
+        return 1;
+#endif
+    }
+#endif
+
 private:
     const eckit::Configuration& config_;
 };
@@ -197,14 +257,16 @@ AllocationFailed::AllocationFailed( size_t bytes, const eckit::CodeLocation& loc
     Exception( error_message( bytes ), loc ) {}
 
 
-void alloc_aligned( double*& ptr, size_t n ) {
+template <typename T>
+void alloc_aligned( T*& ptr, size_t n ) {
     const size_t alignment = 64 * sizeof( double );
-    size_t bytes           = sizeof( double ) * n;
+    size_t bytes           = sizeof( T ) * n;
     int err                = posix_memalign( (void**)&ptr, alignment, bytes );
     if ( err ) { throw AllocationFailed( bytes, Here() ); }
 }
 
-void free_aligned( double*& ptr ) {
+template <typename T>
+void free_aligned( T*& ptr ) {
     free( ptr );
     ptr = nullptr;
 }
@@ -213,6 +275,149 @@ int add_padding( int n ) {
     return std::ceil( n / 8. ) * 8;
 }
 
+// Legendre coefficients stored in single precision are converted to double precision one panel (the
+// coefficients of one zonal wavenumber) at a time, into a workspace of the calling thread, for the products
+// with linalg.gemm. Single precision storage therefore halves the memory of the coefficients, but not the
+// memory traffic of the transforms, which convert each panel in addition to the product.
+double* legendre_panel( const float legendre_sp[], const size_t size, double workspace[] ) {
+    std::copy( legendre_sp, legendre_sp + size, workspace );
+    return workspace;
+}
+
+// Split the spectral data of zonal wavenumber jm, starting at coefficient ioff (see TransLocal::spectral_offset),
+// into symmetric and antisymmetric parts, with total wavenumbers up to trc+1 in descending order (as the Legendre
+// polynomials, see compute_legendre_polynomials), each as columns of nb_fields*n_imag values. Coefficients beyond
+// the truncation of the spectral data are zero.
+// Called within OpenMP parallel regions, so that invariants are checked with assert, which does not throw.
+void split_spectra( const int trc, const int truncation, const int jm, const size_t ioff, const int nb_fields,
+                    const int n_imag, const StridedFields<const double>& scalar_spectra, double scalar_sym[],
+                    double scalar_asym[] ) {
+    int idx = 0, is = 0, ia = 0;
+    // the choice between the following two code lines determines whether
+    // total wavenumbers are summed in an ascending or descending order.
+    // The trans library in IFS uses descending order because it should
+    // be more accurate (higher wavenumbers have smaller contributions).
+    // This also needs to be changed when splitting the spectral data in
+    // compute_legendre_polynomials!
+    //for ( int jn = jm; jn <= trc + 1; jn++ ) {
+    for ( int jn = trc + 1; jn >= jm; jn-- ) {
+        for ( int imag = 0; imag < n_imag; imag++ ) {
+            for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                idx = imag + 2 * ( jn - jm );
+                if ( jn <= truncation && jm < truncation ) {
+                    if ( ( jn - jm ) % 2 == 0 ) { scalar_sym[is++] = scalar_spectra( jfld, ioff + idx ); }
+                    else {
+                        scalar_asym[ia++] = scalar_spectra( jfld, ioff + idx );
+                    }
+                }
+                else {
+                    if ( ( jn - jm ) % 2 == 0 ) { scalar_sym[is++] = 0.; }
+                    else {
+                        scalar_asym[ia++] = 0.;
+                    }
+                }
+            }
+        }
+    }
+    assert( ia == n_imag * nb_fields * num_n( trc + 1, jm, false ) &&
+            is == n_imag * nb_fields * num_n( trc + 1, jm, true ) );
+}
+
+// Merge the symmetric and antisymmetric parts of the spectral data of zonal wavenumber jm (see split_spectra),
+// stored as rows of nb_fields*n_imag values if interleaved, or as columns otherwise, into the spectral data
+// starting at coefficient offset. The truncation of the spectral data must not exceed trc+1, which callers
+// check before entering their OpenMP parallel regions.
+void merge_spectra( const int trc, const int truncation, const int jm, const size_t offset, const int nb_fields,
+                    const int n_imag, const bool interleaved, const double scalar_sym[], const double scalar_asym[],
+                    double scalar_spectra[] ) {
+    const int size_sym  = num_n( trc + 1, jm, true );
+    const int size_asym = num_n( trc + 1, jm, false );
+    const int nvec      = nb_fields * n_imag;
+    const size_t ioff   = offset * nb_fields;
+    int is = 0, ia = 0;
+    for ( int jn = trc + 1; jn >= jm; jn-- ) {
+        const bool sym = ( ( jn - jm ) % 2 == 0 );
+        if ( jn <= truncation ) {
+            for ( int imag = 0; imag < 2; imag++ ) {
+                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                    double value = 0.;
+                    if ( imag < n_imag ) {
+                        const int k = jfld + nb_fields * imag;
+                        if ( interleaved ) { value = sym ? scalar_sym[k + nvec * is] : scalar_asym[k + nvec * ia]; }
+                        else {
+                            value = sym ? scalar_sym[is + size_sym * k] : scalar_asym[ia + size_asym * k];
+                        }
+                    }
+                    scalar_spectra[ioff + jfld + nb_fields * ( imag + 2 * ( jn - jm ) )] = value;
+                }
+            }
+        }
+        ( sym ? is : ia )++;
+    }
+    assert( is == size_sym && ia == size_asym );
+}
+
+functionspace::StructuredColumns structured_columns( const FunctionSpace& gp ) {
+    functionspace::StructuredColumns fs( gp );
+    if ( not fs ) {
+        throw eckit::BadParameter( "TransLocal: grid-point function space must be StructuredColumns", Here() );
+    }
+    return fs;
+}
+
+// Number of levels of a field of rank 1 or 2, or with_components of rank 2 or 3 (components in the last dimension)
+int field_levels( const Field& field, const bool with_components ) {
+    const int rank_levels = with_components ? 3 : 2;
+    if ( field.rank() != rank_levels && field.rank() != rank_levels - 1 ) {
+        throw eckit::BadParameter( "TransLocal: field " + field.name() + " has unexpected rank", Here() );
+    }
+    return field.rank() == rank_levels ? field.shape( 1 ) : 1;
+}
+
+// Add the levels of a field (or of its component jcomp) to fields, each with the values along the first dimension
+template <typename Value>
+void add_levels( const Field& field, const bool with_components, const int jcomp, StridedFields<Value>& fields ) {
+    if ( field.datatype() != array::DataType::kind<double>() ) {
+        throw eckit::BadParameter( "TransLocal: field " + field.name() + " must be of type double", Here() );
+    }
+    const int nb_levels = field_levels( field, with_components );
+    if ( with_components && field.shape( field.rank() - 1 ) <= jcomp ) {
+        throw eckit::BadParameter( "TransLocal: field " + field.name() + " needs at least 2 components", Here() );
+    }
+    const size_t stride_levels = nb_levels > 1 ? field.stride( 1 ) : 0;
+    const size_t offset        = with_components ? jcomp * field.stride( field.rank() - 1 ) : 0;
+    Value* data                = const_cast<double*>( field.data<double>() ) + offset;
+    for ( int jlev = 0; jlev < nb_levels; ++jlev ) {
+        fields.add( data + jlev * stride_levels, field.stride( 0 ) );
+    }
+}
+
+int spectral_truncation( const FunctionSpace& sp ) {
+    functionspace::Spectral fs( sp );
+    if ( not fs ) { throw eckit::BadParameter( "TransLocal: spectral function space must be Spectral", Here() ); }
+    return fs.truncation();
+}
+
+// Divide grid-point fields on latitudes [jlat_begin,jlat_begin+nlats) of the structured grid g by cos(latitude)
+void divide_by_coslat( const grid::StructuredGrid& g, const int jlat_begin, const int nlats,
+                       const StridedFields<double>& gp_fields ) {
+    std::vector<double> coslatinvs( nlats );
+    for ( int j = 0; j < nlats; ++j ) {
+        double lat = g.y( jlat_begin + j );
+        if ( lat > latPole ) { lat = latPole; }
+        if ( lat < -latPole ) { lat = -latPole; }
+        coslatinvs[j] = 1. / std::cos( lat * util::Constants::degreesToRadians() );
+    }
+    for ( int jfld = 0; jfld < gp_fields.size(); jfld++ ) {
+        size_t idx = 0;
+        for ( int jlat = 0; jlat < nlats; jlat++ ) {
+            for ( int jlon = 0; jlon < g.nx( jlat_begin + jlat ); jlon++ ) {
+                gp_fields( jfld, idx++ ) *= coslatinvs[jlat];
+            }
+        }
+    }
+}
+
 }  // namespace
 
 int fourier_truncation( const int truncation,    // truncation
@@ -250,9 +455,95 @@ struct FFTW_Data {
 #if ATLAS_HAVE_FFTW
     fftw_complex* in;
     double* out;
+    // plans are owned by FFTW_PlanCache
     std::vector<fftw_plan> plans;
+    std::vector<fftw_plan> plans_r2c;  // only for direct transforms
+
+    // reduced grids: plans for each distinct number of longitudes, transforming
+    // "batch" fields at once, or a single field (remainder)
+    int batch;
+    std::map<int, fftw_plan> plans_batch;
+    std::map<int, fftw_plan> plans_single;
 #endif
 };
+
+#if ATLAS_HAVE_FFTW
+// Process-wide cache of FFTW plans, shared by all TransLocal instances, so that instances for the same grid
+// (e.g. for different truncations) do not plan again. A plan transforms "howmany" real sequences of n values,
+// stored one after the other, from or to as many sequences of n/2+1 complex values. Plans are only executed
+// with the new-array execute functions, on arrays allocated with fftw_malloc. They are created on first
+// request, under a lock as the FFTW planner is not thread-safe, and kept until the end of the process.
+class FFTW_PlanCache {
+public:
+    static FFTW_PlanCache& instance() {
+        static FFTW_PlanCache cache;
+        return cache;
+    }
+
+    fftw_plan c2r( int n, int howmany, unsigned flags, int nthreads = 1 ) {
+        return plan( false, n, howmany, flags, nthreads );
+    }
+
+    fftw_plan r2c( int n, int howmany, unsigned flags, int nthreads = 1 ) {
+        return plan( true, n, howmany, flags, nthreads );
+    }
+
+    void import_wisdom( const char* wisdom ) {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        fftw_import_wisdom_from_string( wisdom );
+    }
+
+    void export_wisdom( const std::string& file_path ) {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        FILE* file_fftw = fopen( file_path.c_str(), "wb" );
+        fftw_export_wisdom_to_file( file_fftw );
+        fclose( file_fftw );
+    }
+
+private:
+    // direction (r2c), n, howmany, input distance, output distance, planner flags, threads
+    using Key = std::tuple<bool, int, int, int, int, unsigned, int>;
+
+    FFTW_PlanCache() {
+#if ATLAS_HAVE_FFTW_OMP
+        fftw_init_threads();
+#endif
+    }
+
+    ~FFTW_PlanCache() {
+        for ( auto& plan : plans_ ) {
+            fftw_destroy_plan( plan.second );
+        }
+    }
+
+    fftw_plan plan( bool r2c, int n, int howmany, unsigned flags, int nthreads ) {
+        const int num_complex = ( n / 2 ) + 1;
+        const Key key         = r2c ? Key( r2c, n, howmany, n, num_complex, flags, nthreads )
+                                    : Key( r2c, n, howmany, num_complex, n, flags, nthreads );
+        std::lock_guard<std::mutex> lock( mutex_ );
+        auto found = plans_.find( key );
+        if ( found != plans_.end() ) { return found->second; }
+
+        // arrays for planning only (overwritten unless planning with FFTW_ESTIMATE)
+        fftw_complex* in = fftw_alloc_complex( size_t( howmany ) * num_complex );
+        double* out      = fftw_alloc_real( size_t( howmany ) * n );
+#if ATLAS_HAVE_FFTW_OMP
+        fftw_plan_with_nthreads( nthreads );
+#endif
+        fftw_plan plan =
+            r2c ? fftw_plan_many_dft_r2c( 1, &n, howmany, out, NULL, 1, n, in, NULL, 1, num_complex, flags )
+                : fftw_plan_many_dft_c2r( 1, &n, howmany, in, NULL, 1, num_complex, out, NULL, 1, n, flags );
+        fftw_free( in );
+        fftw_free( out );
+        ASSERT( plan );
+        plans_[key] = plan;
+        return plan;
+    }
+
+    std::mutex mutex_;
+    std::map<Key, fftw_plan> plans_;
+};
+#endif
 }  // namespace detail
 
 
@@ -275,7 +566,7 @@ bool TransLocal::warning( const eckit::Configuration& config ) const {
 }
 
 TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& domain, const long truncation,
-                        const eckit::Configuration& config ) :
+                        const eckit::Configuration& config, std::unique_ptr<ParallelisationLocal>&& parallelisation ) :
     grid_( grid, domain ),
     truncation_( truncation ),
     precompute_( config.getBool( "precompute", true ) ),
@@ -285,9 +576,16 @@ TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& doma
     fft_cache_( cache.fft().data() ),
     fft_cachesize_( cache.fft().size() ),
     fftw_( new detail::FFTW_Data ),
+    parallelisation_( std::move( parallelisation ) ),
     linalg_( linear_algebra_backend() ),
     warning_( TransParameters( config ).warning() ) {
     ATLAS_TRACE( "TransLocal constructor" );
+    // Fourier coefficients of the Legendre transforms hold the zonal wavenumbers of this task (see posLegendre)
+    legendre_wavenumber_index_.assign( truncation_ + 1, 0 );
+    nb_legendre_wavenumbers_ = 0;
+    for ( int jm : zonal_wavenumbers() ) {
+        legendre_wavenumber_index_[jm] = nb_legendre_wavenumbers_++;
+    }
     double fft_threshold = 0.0;  // fraction of latitudes of the full grid down to which FFT is used.
     // This threshold needs to be adjusted depending on the dgemm and FFT performance of the machine
     // on which this code is running!
@@ -416,7 +714,8 @@ TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& doma
             if ( nlonsMax < fft_threshold * nlonsMaxGlobal_ ) { useFFT_ = false; }
             else {
                 // need to use FFT with cropped grid
-                if ( grid::RegularGrid( gridGlobal_ ) ) {
+                // (when distributed, latitudes are transformed one at a time as for reduced grids)
+                if ( grid::RegularGrid( gridGlobal_ ) && not parallelisation_ ) {
                     for ( size_t jlon = 0; jlon < nlonsMaxGlobal_; ++jlon ) {
                         if ( gs_global.x( jlon, 0 ) < lonmin ) { jlonMin_[0]++; }
                     }
@@ -463,6 +762,38 @@ TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& doma
         }
         Log::info() << std::endl;*/
 
+        // Gaussian quadrature weights for direct transforms:
+        if ( grid::GaussianGrid( gridGlobal_ ) && grid_.domain().global() ) {
+            const size_t N = nlatsGlobal_ / 2;
+            std::vector<double> gaussian_lats( N );
+            gaussian_weights_.resize( N );
+            grid::spacing::gaussian::gaussian_quadrature_npole_equator( N, gaussian_lats.data(),
+                                                                        gaussian_weights_.data() );
+            // normalise such that the weights add up to 1 over the globe:
+            double sum = 0.;
+            for ( size_t j = 0; j < N; ++j ) {
+                sum += gaussian_weights_[j];
+            }
+            for ( size_t j = 0; j < N; ++j ) {
+                gaussian_weights_[j] /= 2. * sum;
+            }
+        }
+
+        if ( parallelisation_ ) {
+            if ( gaussian_weights_.empty() ) {
+                throw eckit::NotImplemented( "Distributed TransLocal is only implemented for global Gaussian grids",
+                                             Here() );
+            }
+#if !ATLAS_HAVE_FFTW || TRANSLOCAL_DGEMM2
+            throw eckit::NotImplemented( "Distributed TransLocal requires FFTW", Here() );
+#endif
+            if ( not useFFT_ ) { throw eckit::NotImplemented( "Distributed TransLocal requires FFT", Here() ); }
+            if ( legendre_cache_ || TransParameters( config ).export_legendre() ||
+                 TransParameters( config ).write_legendre().size() ) {
+                throw eckit::NotImplemented( "Legendre caches are not supported by distributed TransLocal", Here() );
+            }
+        }
+
         // precomputations for Legendre polynomials:
         {
             int size_sym  = 0;
@@ -472,28 +803,165 @@ TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& doma
             legendre_sym_begin_[0]  = 0;
             legendre_asym_begin_[0] = 0;
             for ( int jm = 0; jm <= truncation_ + 1; jm++ ) {
-                size_sym += add_padding( num_n( truncation_ + 1, jm, true ) * nlatsLeg_ );
-                size_asym += add_padding( num_n( truncation_ + 1, jm, false ) * nlatsLeg_ );
+                // when distributed, only the zonal wavenumbers of this task are stored
+                if ( not parallelisation_ || parallelisation_->owns_zonal_wavenumber( jm ) ) {
+                    size_sym += add_padding( num_n( truncation_ + 1, jm, true ) * nlatsLeg_ );
+                    size_asym += add_padding( num_n( truncation_ + 1, jm, false ) * nlatsLeg_ );
+                }
                 legendre_sym_begin_[jm + 1]  = size_sym;
                 legendre_asym_begin_[jm + 1] = size_asym;
             }
 
-            if ( legendre_cache_ ) {
+            // In single precision mode only the float tables legendre_sym_sp_ and legendre_asym_sp_ are set up.
+            // A cache must have been created with the same precision, which is checked via its size.
+            single_precision_legendre_ = TransParameters( config ).legendre_single_precision_storage();
+            const size_t legendre_value_size = single_precision_legendre_ ? sizeof( float ) : sizeof( double );
+
+            // In butterfly mode only the compressed coefficients are kept, for the latitudes from nlat0_[jm]
+            // of each zonal wavenumber jm. The dense coefficients are computed first, and released once compressed.
+            // In on_the_fly mode no coefficients are kept, but only what is needed to recompute them.
+            const std::string legendre_method = TransParameters( config ).legendre_method();
+            butterfly_legendre_               = ( legendre_method == "butterfly" );
+            legendre_on_the_fly_              = ( legendre_method == "on_the_fly" );
+            if ( butterfly_legendre_ || legendre_on_the_fly_ ) {
+                if ( single_precision_legendre_ ) {
+                    throw eckit::NotImplemented(
+                        "legendre_method=" + legendre_method + " requires legendre_storage=double", Here() );
+                }
+                if ( not grid_.domain().global() ) {
+                    throw eckit::NotImplemented(
+                        "legendre_method=" + legendre_method + " is only implemented for global grids", Here() );
+                }
+            }
+            if ( legendre_on_the_fly_ && ( legendre_cache_ || TransParameters( config ).export_legendre() ||
+                                           TransParameters( config ).write_legendre().size() ) ) {
+                throw eckit::NotImplemented( "Legendre caches are not supported with legendre_method=on_the_fly",
+                                             Here() );
+            }
+            auto owned = [&]( int jm ) {
+                return not parallelisation_ || parallelisation_->owns_zonal_wavenumber( jm );
+            };
+
+            if ( legendre_on_the_fly_ ) {
+                legendre_lats_ = lats;
+                legendre_zfn_.resize( ( truncation_ + 2 ) * ( truncation_ + 2 ) );
+                compute_zfn( truncation_ + 1, legendre_zfn_.data() );
+            }
+            else if ( butterfly_legendre_ ) {
+                if ( not legendre_cache_ ) {
+                    const double tolerance = TransParameters( config ).butterfly_tolerance();
+                    const int leaf_size    = TransParameters( config ).butterfly_leaf_size();
+                    std::vector<std::vector<double>> compressed( 2 * ( truncation_ + 1 ) );
+                    ATLAS_TRACE_SCOPE( "Legendre precomputations (structured, butterfly)" ) {
+                        std::vector<double> sym( size_sym ), asym( size_asym );
+                        compute_legendre_polynomials( truncation_ + 1, nlatsLeg_, lats.data(), sym.data(), asym.data(),
+                                                      legendre_sym_begin_.data(), legendre_asym_begin_.data() );
+                        // The options are checked here, as an exception cannot propagate out of the parallel
+                        // region. Others (e.g. failed allocations) are caught, and the first one is rethrown.
+                        ASSERT( tolerance >= 0. && leaf_size > 0 );
+                        std::exception_ptr exception;
+                        atlas_omp_pragma( omp parallel for schedule( dynamic, 1 ) )
+                        for ( int jm = 0; jm <= truncation_; jm++ ) {
+                            if ( not owned( jm ) ) { continue; }
+                            try {
+                                const int size_sym_m  = num_n( truncation_ + 1, jm, true );
+                                const int size_asym_m = num_n( truncation_ + 1, jm, false );
+                                const int nlatsm      = nlatsLeg_ - nlat0_[jm];
+                                const double* sym_m   = sym.data() + legendre_sym_begin_[jm] + nlat0_[jm] * size_sym_m;
+                                const double* asym_m =
+                                    asym.data() + legendre_asym_begin_[jm] + nlat0_[jm] * size_asym_m;
+                                ButterflyMatrix::compress( size_sym_m, nlatsm, sym_m, size_sym_m, tolerance,
+                                                           compressed[2 * jm], leaf_size );
+                                ButterflyMatrix::compress( size_asym_m, nlatsm, asym_m, size_asym_m, tolerance,
+                                                           compressed[2 * jm + 1], leaf_size );
+                            }
+                            catch ( ... ) {
+                                atlas_omp_critical {
+                                    if ( not exception ) { exception = std::current_exception(); }
+                                }
+                            }
+                        }
+                        if ( exception ) { std::rethrow_exception( exception ); }
+                    }
+                    for ( auto& c : compressed ) {
+                        legendre_butterfly_data_.insert( legendre_butterfly_data_.end(), c.begin(), c.end() );
+                    }
+                    if ( TransParameters( config ).export_legendre() ) {
+                        ASSERT( not cache_.legendre() );
+                        const size_t bytes = legendre_butterfly_data_.size() * sizeof( double );
+                        export_legendre_   = LegendreCache( bytes );
+                        std::copy( legendre_butterfly_data_.begin(), legendre_butterfly_data_.end(),
+                                   (double*)export_legendre_.legendre().data() );
+                        legendre_cachesize_ = export_legendre_.legendre().size();
+                        legendre_cache_     = export_legendre_.legendre().data();
+                        std::vector<double>().swap( legendre_butterfly_data_ );
+                    }
+                }
+                const double* encoded =
+                    legendre_cache_ ? (const double*)legendre_cache_ : legendre_butterfly_data_.data();
+                const size_t encoded_size =
+                    legendre_cache_ ? legendre_cachesize_ / sizeof( double ) : legendre_butterfly_data_.size();
+
+                std::string file_path = TransParameters( config ).write_legendre();
+                if ( file_path.size() ) {
+                    ATLAS_TRACE( "Write LegendreCache to file" );
+                    Log::debug() << "Writing Legendre cache file ..." << std::endl;
+                    Log::debug() << "    path: " << file_path << std::endl;
+                    WriteCache legendre( file_path );
+                    legendre.write( encoded, encoded_size );
+                    Log::debug() << "    size: " << eckit::Bytes( legendre.pos ) << std::endl;
+                }
+
+                // A cache must have been created in butterfly mode as well, which is checked via the matrix sizes
+                legendre_butterfly_sym_.resize( truncation_ + 1 );
+                legendre_butterfly_asym_.resize( truncation_ + 1 );
+                size_t pos = 0;
+                for ( int jm = 0; jm <= truncation_; jm++ ) {
+                    if ( not owned( jm ) ) { continue; }
+                    const int nlatsm = nlatsLeg_ - nlat0_[jm];
+                    ASSERT( pos + 2 <= encoded_size && encoded[pos] == num_n( truncation_ + 1, jm, true ) &&
+                            encoded[pos + 1] == nlatsm );
+                    legendre_butterfly_sym_[jm] = ButterflyMatrix( encoded + pos );
+                    pos += legendre_butterfly_sym_[jm].size();
+                    ASSERT( pos + 2 <= encoded_size && encoded[pos] == num_n( truncation_ + 1, jm, false ) &&
+                            encoded[pos + 1] == nlatsm );
+                    legendre_butterfly_asym_[jm] = ButterflyMatrix( encoded + pos );
+                    pos += legendre_butterfly_asym_[jm].size();
+                }
+                ASSERT( pos == encoded_size );
+            }
+            else if ( legendre_cache_ ) {
                 ReadCache legendre( legendre_cache_ );
-                legendre_sym_  = legendre.read<double>( size_sym );
-                legendre_asym_ = legendre.read<double>( size_asym );
+                if ( single_precision_legendre_ ) {
+                    legendre_sym_sp_  = legendre.read<float>( size_sym );
+                    legendre_asym_sp_ = legendre.read<float>( size_asym );
+                }
+                else {
+                    legendre_sym_  = legendre.read<double>( size_sym );
+                    legendre_asym_ = legendre.read<double>( size_asym );
+                }
                 ASSERT( legendre.pos == legendre_cachesize_ );
                 // TODO: check this is all aligned...
             }
             else {
                 if ( TransParameters( config ).export_legendre() ) {
                     ASSERT( not cache_.legendre() );
-                    export_legendre_    = LegendreCache( sizeof( double ) * ( size_sym + size_asym ) );
+                    export_legendre_    = LegendreCache( legendre_value_size * ( size_sym + size_asym ) );
                     legendre_cachesize_ = export_legendre_.legendre().size();
                     legendre_cache_     = export_legendre_.legendre().data();
                     ReadCache legendre( legendre_cache_ );
-                    legendre_sym_  = legendre.read<double>( size_sym );
-                    legendre_asym_ = legendre.read<double>( size_asym );
+                    if ( single_precision_legendre_ ) {
+                        legendre_sym_sp_  = legendre.read<float>( size_sym );
+                        legendre_asym_sp_ = legendre.read<float>( size_asym );
+                    }
+                    else {
+                        legendre_sym_  = legendre.read<double>( size_sym );
+                        legendre_asym_ = legendre.read<double>( size_asym );
+                    }
+                }
+                else if ( single_precision_legendre_ ) {
+                    alloc_aligned( legendre_sym_sp_, size_sym );
+                    alloc_aligned( legendre_asym_sp_, size_asym );
                 }
                 else {
                     alloc_aligned( legendre_sym_, size_sym );
@@ -501,9 +969,20 @@ TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& doma
                 }
 
                 ATLAS_TRACE_SCOPE( "Legendre precomputations (structured)" ) {
-                    compute_legendre_polynomials( truncation_ + 1, nlatsLeg_, lats.data(), legendre_sym_,
-                                                  legendre_asym_, legendre_sym_begin_.data(),
-                                                  legendre_asym_begin_.data() );
+                    if ( single_precision_legendre_ ) {
+                        // Polynomials are computed in double precision and rounded once stored
+                        std::vector<double> sym( size_sym ), asym( size_asym );
+                        compute_legendre_polynomials( truncation_ + 1, nlatsLeg_, lats.data(), sym.data(),
+                                                      asym.data(), legendre_sym_begin_.data(),
+                                                      legendre_asym_begin_.data() );
+                        std::copy( sym.begin(), sym.end(), legendre_sym_sp_ );
+                        std::copy( asym.begin(), asym.end(), legendre_asym_sp_ );
+                    }
+                    else {
+                        compute_legendre_polynomials( truncation_ + 1, nlatsLeg_, lats.data(), legendre_sym_,
+                                                      legendre_asym_, legendre_sym_begin_.data(),
+                                                      legendre_asym_begin_.data() );
+                    }
                 }
                 std::string file_path = TransParameters( config ).write_legendre();
                 if ( file_path.size() ) {
@@ -511,8 +990,14 @@ TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& doma
                     Log::debug() << "Writing Legendre cache file ..." << std::endl;
                     Log::debug() << "    path: " << file_path << std::endl;
                     WriteCache legendre( file_path );
-                    legendre.write( legendre_sym_, size_sym );
-                    legendre.write( legendre_asym_, size_asym );
+                    if ( single_precision_legendre_ ) {
+                        legendre.write( legendre_sym_sp_, size_sym );
+                        legendre.write( legendre_asym_sp_, size_asym );
+                    }
+                    else {
+                        legendre.write( legendre_sym_, size_sym );
+                        legendre.write( legendre_asym_, size_asym );
+                    }
                     Log::debug() << "    size: " << eckit::Bytes( legendre.pos ) << std::endl;
                 }
             }
@@ -523,13 +1008,17 @@ TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& doma
 #if ATLAS_HAVE_FFTW && !TRANSLOCAL_DGEMM2
             {
                 ATLAS_TRACE( "Fourier precomputations (FFTW)" );
-                int num_complex = ( nlonsMaxGlobal_ / 2 ) + 1;
-                fftw_->in       = fftw_alloc_complex( nlats * num_complex );
-                fftw_->out      = fftw_alloc_real( nlats * nlonsMaxGlobal_ );
-
+                int num_complex         = ( nlonsMaxGlobal_ / 2 ) + 1;
+                fftw_->batch            = std::max( 1, TransParameters( config ).fft_batch() );
+                const unsigned flags    = TransParameters( config ).fftw_flags();
+                const int nb_transforms = std::max( nlats, fftw_->batch );
+                fftw_->in               = fftw_alloc_complex( nb_transforms * num_complex );
+                fftw_->out              = fftw_alloc_real( nb_transforms * nlonsMaxGlobal_ );
+
+                auto& fftw_plans = detail::FFTW_PlanCache::instance();
                 if ( fft_cache_ ) {
                     Log::debug() << "Import FFTW wisdom from cache" << std::endl;
-                    fftw_import_wisdom_from_string( (const char*)fft_cache_ );
+                    fftw_plans.import_wisdom( (const char*)fft_cache_ );
                 }
                 //                std::string wisdomString( "" );
                 //                std::ifstream read( "wisdom.bin" );
@@ -543,18 +1032,29 @@ TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& doma
                 //                }
                 //                read.close();
                 //                if ( wisdomString.length() > 0 ) { fftw_import_wisdom_from_string( &wisdomString[0u] ); }
-                if ( grid::RegularGrid( gridGlobal_ ) ) {
-                    fftw_->plans.resize( 1 );
-                    fftw_->plans[0] =
-                        fftw_plan_many_dft_c2r( 1, &nlonsMaxGlobal_, nlats, fftw_->in, NULL, 1, num_complex, fftw_->out,
-                                                NULL, 1, nlonsMaxGlobal_, FFTW_ESTIMATE );
+                if ( grid::RegularGrid( gridGlobal_ ) && not parallelisation_ ) {
+                    // all latitudes are transformed at once, by threaded plans
+                    const int nthreads = TransParameters( config ).fftw_threads();
+                    fftw_->plans.assign( 1, fftw_plans.c2r( nlonsMaxGlobal_, nlats, flags, nthreads ) );
+                    if ( gaussian_weights_.size() ) {
+                        fftw_->plans_r2c.assign( 1, fftw_plans.r2c( nlonsMaxGlobal_, nlats, flags, nthreads ) );
+                    }
                 }
                 else {
-                    fftw_->plans.resize( nlatsLegDomain_ );
                     for ( int j = 0; j < nlatsLegDomain_; j++ ) {
                         int nlonsGlobalj = gs_global.nx( jlatMinLeg_ + j );
                         //ASSERT( nlonsGlobalj > 0 && nlonsGlobalj <= nlonsMaxGlobal_ );
-                        fftw_->plans[j] = fftw_plan_dft_c2r_1d( nlonsGlobalj, fftw_->in, fftw_->out, FFTW_ESTIMATE );
+                        // latitudes are distributed over threads, each executing single-threaded plans
+                        if ( fftw_->plans_batch.count( nlonsGlobalj ) ) { continue; }
+                        fftw_->plans_batch[nlonsGlobalj]  = fftw_plans.c2r( nlonsGlobalj, fftw_->batch, flags );
+                        fftw_->plans_single[nlonsGlobalj] = fftw_plans.c2r( nlonsGlobalj, 1, flags );
+                    }
+                    if ( gaussian_weights_.size() ) {
+                        fftw_->plans_r2c.resize( nlatsLegDomain_ );
+                        for ( int j = 0; j < nlatsLegDomain_; j++ ) {
+                            int nlonsGlobalj    = gs_global.nx( jlatMinLeg_ + j );
+                            fftw_->plans_r2c[j] = fftw_plans.r2c( nlonsGlobalj, 1, flags );
+                        }
                     }
                 }
                 std::string file_path = TransParameters( config ).write_fft();
@@ -565,9 +1065,7 @@ TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& doma
                     //std::ofstream write( file_path );
                     //write << FFTW_Wisdom();
 
-                    FILE* file_fftw = fopen( file_path.c_str(), "wb" );
-                    fftw_export_wisdom_to_file( file_fftw );
-                    fclose( file_fftw );
+                    fftw_plans.export_wisdom( file_path );
                 }
                 //                std::string newWisdom( fftw_export_wisdom_to_string() );
                 //                if ( 1.1 * wisdomString.length() < newWisdom.length() ) {
@@ -670,19 +1168,57 @@ TransLocal::TransLocal( const Cache& cache, const Grid& grid, const long truncat
                         const eckit::Configuration& config ) :
     TransLocal( cache, grid, grid.domain(), truncation, config ) {}
 
+TransLocal::TransLocal( const Cache& cache, const Grid& grid, const Domain& domain, const long truncation,
+                        const eckit::Configuration& config ) :
+    TransLocal( cache, grid, domain, truncation, config, nullptr ) {}
+
+TransLocal::TransLocal( const FunctionSpace& gp, const FunctionSpace& sp, const eckit::Configuration& config ) :
+    TransLocal( Cache(), gp, sp, config ) {}
+
+TransLocal::TransLocal( const Cache& cache, const FunctionSpace& gp, const FunctionSpace& sp,
+                        const eckit::Configuration& config ) :
+    TransLocal( cache, structured_columns( gp ).grid(), structured_columns( gp ).grid().domain(),
+                spectral_truncation( sp ), config,
+                std::unique_ptr<ParallelisationLocal>(
+                    new ParallelisationLocal( structured_columns( gp ), spectral_truncation( sp ) ) ) ) {}
+
+std::vector<int> TransLocal::zonal_wavenumbers() const {
+    if ( parallelisation_ ) { return parallelisation_->zonal_wavenumbers(); }
+    std::vector<int> zonal_wavenumbers( truncation_ + 1 );
+    std::iota( zonal_wavenumbers.begin(), zonal_wavenumbers.end(), 0 );
+    return zonal_wavenumbers;
+}
+
+size_t TransLocal::nb_spectral_coefficients() const {
+    return spectral_size( truncation_ );
+}
+
+size_t TransLocal::spectral_size( const int truncation ) const {
+    if ( parallelisation_ ) { return parallelisation_->nb_spectral_coefficients( truncation ); }
+    return size_t( truncation + 1 ) * ( truncation + 2 );
+}
+
+size_t TransLocal::spectral_offset( const int truncation, const int jm ) const {
+    if ( parallelisation_ ) { return parallelisation_->spectral_offset( truncation, jm ); }
+    return size_t( 2 * truncation + 3 - jm ) * jm;
+}
+
 // --------------------------------------------------------------------------------------------------------------------
 
 TransLocal::~TransLocal() {
     if ( grid::StructuredGrid( grid_ ) && not grid_.projection() ) {
-        if ( not legendre_cache_ ) {
-            free_aligned( legendre_sym_ );
-            free_aligned( legendre_asym_ );
+        if ( not legendre_cache_ && not butterfly_legendre_ && not legendre_on_the_fly_ ) {
+            if ( single_precision_legendre_ ) {
+                free_aligned( legendre_sym_sp_ );
+                free_aligned( legendre_asym_sp_ );
+            }
+            else {
+                free_aligned( legendre_sym_ );
+                free_aligned( legendre_asym_ );
+            }
         }
         if ( useFFT_ ) {
 #if ATLAS_HAVE_FFTW && !TRANSLOCAL_DGEMM2
-            for ( int j = 0; j < fftw_->plans.size(); j++ ) {
-                fftw_destroy_plan( fftw_->plans[j] );
-            }
             fftw_free( fftw_->in );
             fftw_free( fftw_->out );
 #endif
@@ -698,41 +1234,180 @@ TransLocal::~TransLocal() {
 
 // --------------------------------------------------------------------------------------------------------------------
 
+StridedFields<const double> TransLocal::spectral_fields( const FieldSet& fields, std::vector<double>& buffer ) const {
+    // Spectral fields hold either the zonal wavenumbers of this task (see zonal_wavenumbers()), as the Legendre
+    // transforms, or when distributed all zonal wavenumbers, of which those of this task are copied into buffer.
+    const size_t nb_coefficients_global = spectralCoefficients();
+    const size_t nb_coefficients_local  = nb_spectral_coefficients();
+    auto is_global                      = [&]( const Field& field ) {
+        if ( not functionspace::Spectral( field.functionspace() ) ) {
+            throw eckit::BadParameter( "TransLocal: field " + field.name() + " must be a Spectral field", Here() );
+        }
+        if ( size_t( field.shape( 0 ) ) == nb_coefficients_local ) { return false; }
+        if ( size_t( field.shape( 0 ) ) == nb_coefficients_global ) { return true; }
+        throw eckit::BadParameter( "TransLocal: spectral field " + field.name() + " has a wrong number of coefficients",
+                                   Here() );
+    };
+    size_t buffer_size = 0;
+    for ( idx_t j = 0; j < fields.size(); ++j ) {
+        if ( is_global( fields[j] ) ) { buffer_size += nb_coefficients_local * field_levels( fields[j], false ); }
+    }
+    buffer.resize( buffer_size );
+
+    StridedFields<const double> spectra;
+    double* local = buffer.data();
+    for ( idx_t j = 0; j < fields.size(); ++j ) {
+        if ( not is_global( fields[j] ) ) {
+            add_levels( fields[j], false, 0, spectra );
+            continue;
+        }
+        StridedFields<const double> global;
+        add_levels( fields[j], false, 0, global );
+        for ( int jlev = 0; jlev < global.size(); ++jlev, local += nb_coefficients_local ) {
+            size_t k = 0;
+            for ( int jm : zonal_wavenumbers() ) {
+                const size_t offset = size_t( 2 * truncation_ + 3 - jm ) * jm / 2 * 2;
+                for ( int jn = 0; jn < 2 * ( truncation_ + 1 - jm ); ++jn ) {
+                    local[k++] = global( jlev, offset + jn );
+                }
+            }
+            spectra.add( local, 1 );
+        }
+    }
+    return spectra;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+StridedFields<double> TransLocal::gridpoint_fields( const FieldSet& fields, const bool with_components,
+                                                    const int jcomp ) const {
+    const size_t nb_gp = parallelisation_ ? parallelisation_->nb_gridpoints_columns() : grid_.size();
+    StridedFields<double> gp_fields;
+    for ( idx_t j = 0; j < fields.size(); ++j ) {
+        if ( size_t( structured_columns( fields[j].functionspace() ).sizeOwned() ) != nb_gp ) {
+            throw eckit::BadParameter(
+                "TransLocal: the owned points of field " + fields[j].name() + " are not the points of the transform",
+                Here() );
+        }
+        add_levels( fields[j], with_components, jcomp, gp_fields );
+    }
+    return gp_fields;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+namespace {
+void check_levels( const FieldSet& spfields, const FieldSet& gpfields, const bool with_components ) {
+    if ( spfields.size() != gpfields.size() ) {
+        throw eckit::BadParameter( "TransLocal: different numbers of spectral and grid-point fields", Here() );
+    }
+    for ( idx_t j = 0; j < spfields.size(); ++j ) {
+        if ( field_levels( spfields[j], false ) != field_levels( gpfields[j], with_components ) ) {
+            throw eckit::BadParameter(
+                "TransLocal: fields " + spfields[j].name() + " and " + gpfields[j].name() + " have different levels",
+                Here() );
+        }
+    }
+}
+}  // namespace
+
+// --------------------------------------------------------------------------------------------------------------------
+
 void TransLocal::invtrans( const Field& spfield, Field& gpfield, const eckit::Configuration& config ) const {
-    NOTIMP;
+    FieldSet spfields;
+    spfields.add( spfield );
+    FieldSet gpfields;
+    gpfields.add( gpfield );
+    invtrans( spfields, gpfields, config );
 }
 
 // --------------------------------------------------------------------------------------------------------------------
 
 void TransLocal::invtrans( const FieldSet& spfields, FieldSet& gpfields, const eckit::Configuration& config ) const {
-    NOTIMP;
+    ATLAS_TRACE( "TransLocal::invtrans(FieldSet)" );
+    check_levels( spfields, gpfields, false );
+    std::vector<double> buffer;
+    invtrans_fields( spectral_fields( spfields, buffer ), StridedFields<const double>(), StridedFields<const double>(),
+                     gridpoint_fields( gpfields, false, 0 ), config );
+    for ( idx_t j = 0; j < gpfields.size(); ++j ) {
+        gpfields[j].set_dirty();
+    }
 }
 
 // --------------------------------------------------------------------------------------------------------------------
 
 void TransLocal::invtrans_grad( const Field& spfield, Field& gradfield, const eckit::Configuration& config ) const {
-    NOTIMP;
+    FieldSet spfields;
+    spfields.add( spfield );
+    FieldSet gradfields;
+    gradfields.add( gradfield );
+    invtrans_grad( spfields, gradfields, config );
 }
 
 // --------------------------------------------------------------------------------------------------------------------
 
 void TransLocal::invtrans_grad( const FieldSet& spfields, FieldSet& gradfields,
                                 const eckit::Configuration& config ) const {
-    NOTIMP;
+    ATLAS_TRACE( "TransLocal::invtrans_grad" );
+    check_levels( spfields, gradfields, true );
+    std::vector<double> buffer;
+    StridedFields<const double> spectra = spectral_fields( spfields, buffer );
+
+    // The gradient of a scalar field is the wind of zero vorticity and of the Laplacian of the scalar field
+    // as divergence (the scalar field being the velocity potential)
+    const int nb_fields          = spectra.size();
+    const size_t nb_coefficients = nb_spectral_coefficients();
+    const double radius          = util::Earth::radius();
+    std::vector<double> vorticity( nb_fields * nb_coefficients, 0. );
+    std::vector<double> divergence( nb_fields * nb_coefficients );
+    size_t k = 0;
+    for ( int jm : zonal_wavenumbers() ) {
+        for ( int jn = jm; jn <= truncation_; jn++ ) {
+            const double laplacian = -jn * ( jn + 1. ) / ( radius * radius );
+            for ( int imag = 0; imag < 2; imag++, k++ ) {
+                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                    divergence[jfld + nb_fields * k] = laplacian * spectra( jfld, k );
+                }
+            }
+        }
+    }
+
+    StridedFields<double> gp_fields = gridpoint_fields( gradfields, true, 0 );
+    gp_fields.add( gridpoint_fields( gradfields, true, 1 ) );
+    invtrans_fields( StridedFields<const double>(),
+                     StridedFields<const double>::interleaved( nb_fields, vorticity.data() ),
+                     StridedFields<const double>::interleaved( nb_fields, divergence.data() ), gp_fields, config );
+    for ( idx_t j = 0; j < gradfields.size(); ++j ) {
+        gradfields[j].set_dirty();
+    }
 }
 
 // --------------------------------------------------------------------------------------------------------------------
 
 void TransLocal::invtrans_vordiv2wind( const Field& spvor, const Field& spdiv, Field& gpwind,
                                        const eckit::Configuration& config ) const {
-    NOTIMP;
+    ATLAS_TRACE( "TransLocal::invtrans_vordiv2wind" );
+    FieldSet vorfields;
+    vorfields.add( spvor );
+    FieldSet divfields;
+    divfields.add( spdiv );
+    FieldSet windfields;
+    windfields.add( gpwind );
+    check_levels( vorfields, windfields, true );
+    check_levels( divfields, windfields, true );
+    std::vector<double> vorticity_buffer, divergence_buffer;
+    StridedFields<double> gp_fields = gridpoint_fields( windfields, true, 0 );
+    gp_fields.add( gridpoint_fields( windfields, true, 1 ) );
+    invtrans_fields( StridedFields<const double>(), spectral_fields( vorfields, vorticity_buffer ),
+                     spectral_fields( divfields, divergence_buffer ), gp_fields, config );
+    gpwind.set_dirty();
 }
 
 // --------------------------------------------------------------------------------------------------------------------
 
 void TransLocal::invtrans( const int nb_scalar_fields, const double scalar_spectra[], double gp_fields[],
                            const eckit::Configuration& config ) const {
-    invtrans_uv( truncation_, nb_scalar_fields, 0, scalar_spectra, gp_fields, config );
+    invtrans( nb_scalar_fields, scalar_spectra, 0, nullptr, nullptr, gp_fields, config );
 }
 
 // --------------------------------------------------------------------------------------------------------------------
@@ -748,152 +1423,249 @@ void gp_transpose( const int nb_size, const int nb_fields, const double gp_tmp[]
 // --------------------------------------------------------------------------------------------------------------------
 
 void TransLocal::invtrans_legendre( const int truncation, const int nlats, const int nb_fields,
-                                    const int nb_vordiv_fields, const double scalar_spectra[], double scl_fourier[],
-                                    const eckit::Configuration& config ) const {
+                                    const int nb_vordiv_fields, const StridedFields<const double>& scalar_spectra,
+                                    double scl_fourier[], const eckit::Configuration& config ) const {
+    if ( legendre_on_the_fly_ ) {
+        invtrans_legendre_on_the_fly( truncation, nlats, nb_fields, scalar_spectra, scl_fourier );
+        return;
+    }
     // Legendre transform:
     {
         Log::debug() << "Legendre dgemm: using " << nlatsLegReduced_ - nlat0_[0] << " latitudes out of "
                      << nlatsGlobal_ / 2 << std::endl;
         ATLAS_TRACE( "Inverse Legendre Transform (GEMM)" );
+
+        // Workspaces for splitting into symmetric and antisymmetric parts, preallocated for each thread
+        // with the sizes required for the largest zonal wavenumber, so that no allocations take place
+        // within the loop over zonal wavenumbers.
+        // In single precision mode, the last workspace holds the Legendre coefficients of one zonal wavenumber.
+        int size_sym_max = 0, size_asym_max = 0, size_fourier_max = 0, size_legendre_max = 0;
         for ( int jm = 0; jm <= truncation_; jm++ ) {
-            int size_sym  = num_n( truncation_ + 1, jm, true );
-            int size_asym = num_n( truncation_ + 1, jm, false );
-            int n_imag    = 2;
-            if ( jm == 0 ) { n_imag = 1; }
-            int size_fourier = nb_fields * n_imag * ( nlatsLegReduced_ - nlat0_[jm] );
-            if ( size_fourier > 0 ) {
-                auto posFourier = [&]( int jfld, int imag, int jlat, int jm, int nlatsH ) {
-                    return jfld + nb_fields * ( imag + n_imag * ( nlatsLegReduced_ - nlat0_[jm] - nlatsH + jlat ) );
-                };
-                double* scalar_sym;
-                double* scalar_asym;
-                double* scl_fourier_sym;
-                double* scl_fourier_asym;
-                alloc_aligned( scalar_sym, n_imag * nb_fields * size_sym );
-                alloc_aligned( scalar_asym, n_imag * nb_fields * size_asym );
-                alloc_aligned( scl_fourier_sym, size_fourier );
-                alloc_aligned( scl_fourier_asym, size_fourier );
-                {
-                    //ATLAS_TRACE( "Legendre split" );
-                    int idx = 0, is = 0, ia = 0, ioff = ( 2 * truncation + 3 - jm ) * jm / 2 * nb_fields * 2;
-                    // the choice between the following two code lines determines whether
-                    // total wavenumbers are summed in an ascending or descending order.
-                    // The trans library in IFS uses descending order because it should
-                    // be more accurate (higher wavenumbers have smaller contributions).
-                    // This also needs to be changed when splitting the spectral data in
-                    // compute_legendre_polynomials!
-                    //for ( int jn = jm; jn <= truncation_ + 1; jn++ ) {
-                    for ( int jn = truncation_ + 1; jn >= jm; jn-- ) {
-                        for ( int imag = 0; imag < n_imag; imag++ ) {
-                            for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
-                                idx = jfld + nb_fields * ( imag + 2 * ( jn - jm ) );
-                                if ( jn <= truncation && jm < truncation ) {
-                                    if ( ( jn - jm ) % 2 == 0 ) { scalar_sym[is++] = scalar_spectra[idx + ioff]; }
-                                    else {
-                                        scalar_asym[ia++] = scalar_spectra[idx + ioff];
-                                    }
-                                }
-                                else {
-                                    if ( ( jn - jm ) % 2 == 0 ) { scalar_sym[is++] = 0.; }
-                                    else {
-                                        scalar_asym[ia++] = 0.;
-                                    }
-                                }
-                            }
+            size_sym_max     = std::max( size_sym_max, 2 * nb_fields * num_n( truncation_ + 1, jm, true ) );
+            size_asym_max    = std::max( size_asym_max, 2 * nb_fields * num_n( truncation_ + 1, jm, false ) );
+            size_fourier_max = std::max( size_fourier_max, 2 * nb_fields * ( nlatsLegReduced_ - nlat0_[jm] ) );
+            if ( single_precision_legendre_ ) {
+                const int size_legendre = num_n( truncation_ + 1, jm, true ) * ( nlatsLegReduced_ - nlat0_[jm] );
+                size_legendre_max       = std::max( size_legendre_max, size_legendre );
+            }
+        }
+        const size_t workspace_sizes[5] = {size_t( add_padding( size_sym_max ) ), size_t( add_padding( size_asym_max ) ),
+                                           size_t( add_padding( size_fourier_max ) ),
+                                           size_t( add_padding( size_fourier_max ) ),
+                                           size_t( add_padding( size_legendre_max ) )};
+        size_t workspace_offsets[5];
+        size_t workspace_size = 0;
+        for ( int j = 0; j < 5; ++j ) {
+            workspace_offsets[j] = workspace_size;
+            workspace_size += workspace_sizes[j];
+        }
+        const int nb_threads = atlas_omp_get_max_threads();
+        double* workspaces;
+        alloc_aligned( workspaces, nb_threads * workspace_size );
+
+        atlas_omp_parallel {
+            double* thread_workspace = workspaces + atlas_omp_get_thread_num() * workspace_size;
+            auto workspace           = [&]( int j ) { return thread_workspace + workspace_offsets[j]; };
+
+            // The cost per zonal wavenumber decreases with jm, so a dynamic schedule starting with
+            // the lowest wavenumbers balances the load over the threads.
+            atlas_omp_pragma( omp for schedule( dynamic, 1 ) )
+            for ( int jm = 0; jm <= truncation_; jm++ ) {
+                if ( parallelisation_ && not parallelisation_->owns_zonal_wavenumber( jm ) ) { continue; }
+                int size_sym  = num_n( truncation_ + 1, jm, true );
+                int size_asym = num_n( truncation_ + 1, jm, false );
+                int n_imag    = 2;
+                if ( jm == 0 ) { n_imag = 1; }
+                int size_fourier = nb_fields * n_imag * ( nlatsLegReduced_ - nlat0_[jm] );
+                if ( size_fourier > 0 ) {
+                    auto posFourier = [&]( int jfld, int imag, int jlat, int jm, int nlatsH ) {
+                        return jfld + nb_fields * ( imag + n_imag * ( nlatsLegReduced_ - nlat0_[jm] - nlatsH + jlat ) );
+                    };
+                    double* scalar_sym       = workspace( 0 );
+                    double* scalar_asym      = workspace( 1 );
+                    double* scl_fourier_sym  = workspace( 2 );
+                    double* scl_fourier_asym = workspace( 3 );
+                    split_spectra( truncation_, truncation, jm, spectral_offset( truncation, jm ), nb_fields, n_imag,
+                                   scalar_spectra, scalar_sym, scalar_asym );
+                    if ( nlatsLegReduced_ - nlat0_[jm] > 0 && butterfly_legendre_ ) {
+                        // vectors are interleaved in the split spectral data and in the Fourier coefficients
+                        legendre_butterfly_sym_[jm].multiply_transpose( nb_fields * n_imag, scalar_sym,
+                                                                        scl_fourier_sym );
+                        if ( size_asym > 0 ) {
+                            legendre_butterfly_asym_[jm].multiply_transpose( nb_fields * n_imag, scalar_asym,
+                                                                             scl_fourier_asym );
                         }
                     }
-                    ASSERT( ia == n_imag * nb_fields * size_asym && is == n_imag * nb_fields * size_sym );
-                }
-                if ( nlatsLegReduced_ - nlat0_[jm] > 0 ) {
-                    {
-                        eckit::linalg::Matrix A( scalar_sym, nb_fields * n_imag, size_sym );
-                        eckit::linalg::Matrix B( legendre_sym_ + legendre_sym_begin_[jm] + nlat0_[jm] * size_sym,
-                                                 size_sym, nlatsLegReduced_ - nlat0_[jm] );
-                        eckit::linalg::Matrix C( scl_fourier_sym, nb_fields * n_imag, nlatsLegReduced_ - nlat0_[jm] );
-                        linalg_.gemm( A, B, C );
-                        /*Log::info() << "sym: ";
-                        for ( int j = 0; j < size_sym * ( nlatsLegReduced_ - nlat0_[jm] ); j++ ) {
-                            Log::info() << legendre_sym_[j + legendre_sym_begin_[jm] + nlat0_[jm] * size_sym] << " ";
+                    else if ( nlatsLegReduced_ - nlat0_[jm] > 0 ) {
+                        const size_t nlatsm      = nlatsLegReduced_ - nlat0_[jm];
+                        const size_t sym_offset  = legendre_sym_begin_[jm] + nlat0_[jm] * size_sym;
+                        const size_t asym_offset = legendre_asym_begin_[jm] + nlat0_[jm] * size_asym;
+                        {
+                            double* legendre_sym = single_precision_legendre_
+                                                       ? legendre_panel( legendre_sym_sp_ + sym_offset,
+                                                                         size_sym * nlatsm, workspace( 4 ) )
+                                                       : legendre_sym_ + sym_offset;
+                            eckit::linalg::Matrix A( scalar_sym, nb_fields * n_imag, size_sym );
+                            eckit::linalg::Matrix B( legendre_sym, size_sym, nlatsm );
+                            eckit::linalg::Matrix C( scl_fourier_sym, nb_fields * n_imag, nlatsLegReduced_ - nlat0_[jm] );
+                            linalg_.gemm( A, B, C );
+                            /*Log::info() << "sym: ";
+                            for ( int j = 0; j < size_sym * ( nlatsLegReduced_ - nlat0_[jm] ); j++ ) {
+                                Log::info() << legendre_sym_[j + legendre_sym_begin_[jm] + nlat0_[jm] * size_sym] << " ";
+                            }
+                            Log::info() << std::endl;*/
                         }
-                        Log::info() << std::endl;*/
-                    }
-                    if ( size_asym > 0 ) {
-                        eckit::linalg::Matrix A( scalar_asym, nb_fields * n_imag, size_asym );
-                        eckit::linalg::Matrix B( legendre_asym_ + legendre_asym_begin_[jm] + nlat0_[jm] * size_asym,
-                                                 size_asym, nlatsLegReduced_ - nlat0_[jm] );
-                        eckit::linalg::Matrix C( scl_fourier_asym, nb_fields * n_imag, nlatsLegReduced_ - nlat0_[jm] );
-                        linalg_.gemm( A, B, C );
-                        /*Log::info() << "asym: ";
-                        for ( int j = 0; j < size_asym * ( nlatsLegReduced_ - nlat0_[jm] ); j++ ) {
-                            Log::info() << legendre_asym_[j + legendre_asym_begin_[jm] + nlat0_[jm] * size_asym] << " ";
+                        if ( size_asym > 0 ) {
+                            double* legendre_asym = single_precision_legendre_
+                                                        ? legendre_panel( legendre_asym_sp_ + asym_offset,
+                                                                          size_asym * nlatsm, workspace( 4 ) )
+                                                        : legendre_asym_ + asym_offset;
+                            eckit::linalg::Matrix A( scalar_asym, nb_fields * n_imag, size_asym );
+                            eckit::linalg::Matrix B( legendre_asym, size_asym, nlatsm );
+                            eckit::linalg::Matrix C( scl_fourier_asym, nb_fields * n_imag, nlatsLegReduced_ - nlat0_[jm] );
+                            linalg_.gemm( A, B, C );
+                            /*Log::info() << "asym: ";
+                            for ( int j = 0; j < size_asym * ( nlatsLegReduced_ - nlat0_[jm] ); j++ ) {
+                                Log::info() << legendre_asym_[j + legendre_asym_begin_[jm] + nlat0_[jm] * size_asym] << " ";
+                            }
+                            Log::info() << std::endl;*/
                         }
-                        Log::info() << std::endl;*/
                     }
-                }
-                {
-                    //ATLAS_TRACE( "merge spheres" );
-                    // northern hemisphere:
-                    for ( int jlat = 0; jlat < nlatsNH_; jlat++ ) {
-                        if ( nlatsLegReduced_ - nlat0_[jm] - nlatsNH_ + jlat >= 0 ) {
-                            for ( int imag = 0; imag < n_imag; imag++ ) {
-                                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
-                                    int idx = posFourier( jfld, imag, jlat, jm, nlatsNH_ );
-                                    scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )] =
-                                        scl_fourier_sym[idx] + scl_fourier_asym[idx];
+                    {
+                        //ATLAS_TRACE( "merge spheres" );
+                        // northern hemisphere:
+                        for ( int jlat = 0; jlat < nlatsNH_; jlat++ ) {
+                            if ( nlatsLegReduced_ - nlat0_[jm] - nlatsNH_ + jlat >= 0 ) {
+                                for ( int imag = 0; imag < n_imag; imag++ ) {
+                                    for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                                        int idx = posFourier( jfld, imag, jlat, jm, nlatsNH_ );
+                                        scl_fourier[posLegendre( jfld, imag, jlat, jm, nb_fields, nlats )] =
+                                            scl_fourier_sym[idx] + scl_fourier_asym[idx];
+                                    }
                                 }
                             }
-                        }
-                        else {
-                            for ( int imag = 0; imag < n_imag; imag++ ) {
-                                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
-                                    scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )] = 0.;
+                            else {
+                                for ( int imag = 0; imag < n_imag; imag++ ) {
+                                    for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                                        scl_fourier[posLegendre( jfld, imag, jlat, jm, nb_fields, nlats )] = 0.;
+                                    }
                                 }
                             }
-                        }
-                        /*for ( int imag = 0; imag < n_imag; imag++ ) {
-                        for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
-                            if ( scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )] > 0. ) {
-                                Log::info() << "jm=" << jm << " jlat=" << jlat << " nlatsLeg_=" << nlatsLeg_
-                                            << " nlat0=" << nlat0_[jm] << " nlatsNH=" << nlatsNH_ << std::endl;
+                            /*for ( int imag = 0; imag < n_imag; imag++ ) {
+                            for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                                if ( scl_fourier[posLegendre( jfld, imag, jlat, jm, nb_fields, nlats )] > 0. ) {
+                                    Log::info() << "jm=" << jm << " jlat=" << jlat << " nlatsLeg_=" << nlatsLeg_
+                                                << " nlat0=" << nlat0_[jm] << " nlatsNH=" << nlatsNH_ << std::endl;
+                                }
                             }
+                        }*/
                         }
-                    }*/
-                    }
-                    // southern hemisphere:
-                    for ( int jlat = 0; jlat < nlatsSH_; jlat++ ) {
-                        int jslat = nlats - jlat - 1;
-                        if ( nlatsLegReduced_ - nlat0_[jm] - nlatsSH_ + jlat >= 0 ) {
-                            for ( int imag = 0; imag < n_imag; imag++ ) {
-                                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
-                                    int idx = posFourier( jfld, imag, jlat, jm, nlatsSH_ );
-                                    scl_fourier[posMethod( jfld, imag, jslat, jm, nb_fields, nlats )] =
-                                        scl_fourier_sym[idx] - scl_fourier_asym[idx];
+                        // southern hemisphere:
+                        for ( int jlat = 0; jlat < nlatsSH_; jlat++ ) {
+                            int jslat = nlats - jlat - 1;
+                            if ( nlatsLegReduced_ - nlat0_[jm] - nlatsSH_ + jlat >= 0 ) {
+                                for ( int imag = 0; imag < n_imag; imag++ ) {
+                                    for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                                        int idx = posFourier( jfld, imag, jlat, jm, nlatsSH_ );
+                                        scl_fourier[posLegendre( jfld, imag, jslat, jm, nb_fields, nlats )] =
+                                            scl_fourier_sym[idx] - scl_fourier_asym[idx];
+                                    }
                                 }
                             }
-                        }
-                        else {
-                            for ( int imag = 0; imag < n_imag; imag++ ) {
-                                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
-                                    scl_fourier[posMethod( jfld, imag, jslat, jm, nb_fields, nlats )] = 0.;
+                            else {
+                                for ( int imag = 0; imag < n_imag; imag++ ) {
+                                    for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                                        scl_fourier[posLegendre( jfld, imag, jslat, jm, nb_fields, nlats )] = 0.;
+                                    }
                                 }
                             }
                         }
                     }
                 }
-                free_aligned( scalar_sym );
-                free_aligned( scalar_asym );
-                free_aligned( scl_fourier_sym );
-                free_aligned( scl_fourier_asym );
+                else {
+                    for ( int jlat = 0; jlat < nlats; jlat++ ) {
+                        for ( int imag = 0; imag < n_imag; imag++ ) {
+                            for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                                scl_fourier[posLegendre( jfld, imag, jlat, jm, nb_fields, nlats )] = 0.;
+                            }
+                        }
+                    }
+                }
             }
-            else {
-                for ( int jlat = 0; jlat < nlats; jlat++ ) {
+        }
+        free_aligned( workspaces );
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Inverse Legendre transform for global grids, with the Legendre polynomials recomputed for bands of latitudes
+// (see compute_legendre_polynomials_band) and applied while they are in cache, one zonal wavenumber at a time.
+//
+void TransLocal::invtrans_legendre_on_the_fly( const int truncation, const int nlats, const int nb_fields,
+                                               const StridedFields<const double>& scalar_spectra,
+                                               double scl_fourier[] ) const {
+    ASSERT( nlatsNH_ == nlatsSH_ && nlatsNH_ == nlatsLeg_ );
+    ATLAS_TRACE( "Inverse Legendre Transform (on the fly)" );
+    auto owned = [&]( int jm ) { return not parallelisation_ || parallelisation_->owns_zonal_wavenumber( jm ); };
+
+    // split the spectral data of all zonal wavenumbers of this task beforehand
+    std::vector<size_t> sym_begin( truncation_ + 2, 0 ), asym_begin( truncation_ + 2, 0 );
+    for ( int jm = 0; jm <= truncation_; jm++ ) {
+        const int n = owned( jm ) ? 2 * nb_fields : 0;
+        sym_begin[jm + 1]  = sym_begin[jm] + n * num_n( truncation_ + 1, jm, true );
+        asym_begin[jm + 1] = asym_begin[jm] + n * num_n( truncation_ + 1, jm, false );
+    }
+    std::vector<double> scalar_sym( sym_begin.back() ), scalar_asym( asym_begin.back() );
+    atlas_omp_parallel_for( int jm = 0; jm <= truncation_; jm++ ) {
+        if ( not owned( jm ) ) { continue; }
+        split_spectra( truncation_, truncation, jm, spectral_offset( truncation, jm ), nb_fields, ( jm == 0 ) ? 1 : 2,
+                       scalar_spectra, scalar_sym.data() + sym_begin[jm], scalar_asym.data() + asym_begin[jm] );
+    }
+
+    const int nb_bands = ( nlatsLeg_ + legendre_band_size - 1 ) / legendre_band_size;
+    atlas_omp_parallel {
+        std::vector<double> fourier_sym( 2 * nb_fields * legendre_band_size );
+        std::vector<double> fourier_asym( 2 * nb_fields * legendre_band_size );
+        atlas_omp_pragma( omp for schedule( dynamic, 1 ) )
+        for ( int jb = 0; jb < nb_bands; jb++ ) {
+            const int jlat_begin = jb * legendre_band_size;
+            const int nb_lats    = std::min( legendre_band_size, nlatsLeg_ - jlat_begin );
+            auto transform       = [&]( int jm, const double leg_sym[], const double leg_asym[] ) {
+                if ( jm > truncation_ || not owned( jm ) ) { return; }
+                const int size_sym  = num_n( truncation_ + 1, jm, true );
+                const int size_asym = num_n( truncation_ + 1, jm, false );
+                const int n_imag    = ( jm == 0 ) ? 1 : 2;
+                const int nvec      = nb_fields * n_imag;
+                {
+                    eckit::linalg::Matrix A( scalar_sym.data() + sym_begin[jm], nvec, size_sym );
+                    eckit::linalg::Matrix B( const_cast<double*>( leg_sym ), size_sym, nb_lats );
+                    eckit::linalg::Matrix C( fourier_sym.data(), nvec, nb_lats );
+                    linalg_.gemm( A, B, C );
+                }
+                if ( size_asym > 0 ) {
+                    eckit::linalg::Matrix A( scalar_asym.data() + asym_begin[jm], nvec, size_asym );
+                    eckit::linalg::Matrix B( const_cast<double*>( leg_asym ), size_asym, nb_lats );
+                    eckit::linalg::Matrix C( fourier_asym.data(), nvec, nb_lats );
+                    linalg_.gemm( A, B, C );
+                }
+                // merge hemispheres (latitudes closer to the poles than nlat0_[jm] do not contribute):
+                for ( int jl = 0; jl < nb_lats; jl++ ) {
+                    const int jlat     = jlat_begin + jl;
+                    const int jslat    = nlats - jlat - 1;
+                    const bool nonzero = ( jlat >= nlat0_[jm] );
                     for ( int imag = 0; imag < n_imag; imag++ ) {
                         for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
-                            scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )] = 0.;
+                            const int k       = jfld + nb_fields * imag;
+                            const double sym  = nonzero ? fourier_sym[k + nvec * jl] : 0.;
+                            const double asym = ( nonzero && size_asym > 0 ) ? fourier_asym[k + nvec * jl] : 0.;
+                            scl_fourier[posLegendre( jfld, imag, jlat, jm, nb_fields, nlats )]  = sym + asym;
+                            scl_fourier[posLegendre( jfld, imag, jslat, jm, nb_fields, nlats )] = sym - asym;
                         }
                     }
                 }
-            }
+            };
+            compute_legendre_polynomials_band( truncation_ + 1, nb_lats, legendre_lats_.data() + jlat_begin,
+                                               legendre_zfn_.data(), transform );
         }
     }
 }
@@ -901,7 +1673,8 @@ void TransLocal::invtrans_legendre( const int truncation, const int nlats, const
 // --------------------------------------------------------------------------------------------------------------------
 
 void TransLocal::invtrans_fourier_regular( const int nlats, const int nlons, const int nb_fields, double scl_fourier[],
-                                           double gp_fields[], const eckit::Configuration& config ) const {
+                                           const StridedFields<double>& gp_fields,
+                                           const eckit::Configuration& config ) const {
     // Fourier transformation:
     if ( useFFT_ ) {
 #if ATLAS_HAVE_FFTW && !TRANSLOCAL_DGEMM2
@@ -926,11 +1699,13 @@ void TransLocal::invtrans_fourier_regular( const int nlats, const int nlons, con
                         }
                     }
                     fftw_execute_dft_c2r( fftw_->plans[0], fftw_->in, fftw_->out );
+                    double* gp          = gp_fields.data( jfld );
+                    const size_t stride = gp_fields.stride( jfld );
                     for ( int jlat = 0; jlat < nlats; jlat++ ) {
                         for ( int jlon = 0; jlon < nlons; jlon++ ) {
                             int j = jlon + jlonMin_[0];
                             if ( j >= nlonsMaxGlobal_ ) { j -= nlonsMaxGlobal_; }
-                            gp_fields[jlon + nlons * ( jlat + nlats * jfld )] = fftw_->out[j + nlonsMaxGlobal_ * jlat];
+                            gp[( jlon + nlons * jlat ) * stride] = fftw_->out[j + nlonsMaxGlobal_ * jlat];
                         }
                     }
                 }
@@ -943,9 +1718,17 @@ void TransLocal::invtrans_fourier_regular( const int nlats, const int nlons, con
         // dgemm-method 1
         {
             ATLAS_TRACE( "Inverse Fourier Transform (NoFFT)" );
+            // the product needs contiguous fields, otherwise it is computed into a temporary array
+            const size_t field_size = size_t( nlons ) * nlats;
+            double* gp              = gp_fields.contiguous_data( field_size );
+            std::vector<double> gp_tmp;
+            if ( not gp ) {
+                gp_tmp.resize( nb_fields * field_size );
+                gp = gp_tmp.data();
+            }
             eckit::linalg::Matrix A( fourier_, nlons, ( truncation_ + 1 ) * 2 );
             eckit::linalg::Matrix B( scl_fourier, ( truncation_ + 1 ) * 2, nb_fields * nlats );
-            eckit::linalg::Matrix C( gp_fields, nlons, nb_fields * nlats );
+            eckit::linalg::Matrix C( gp, nlons, nb_fields * nlats );
 
             // BUG ATLAS-159: valgrind warns here, saying that B(1,:) is uninitialised
             //                if workaround above labeled ATLAS-159 is not applied.
@@ -966,6 +1749,13 @@ void TransLocal::invtrans_fourier_regular( const int nlats, const int nlons, con
             //                        }
 
             linalg_.gemm( A, B, C );
+            if ( gp_tmp.size() ) {
+                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                    for ( size_t j = 0; j < field_size; j++ ) {
+                        gp_fields( jfld, j ) = gp_tmp[jfld * field_size + j];
+                    }
+                }
+            }
         }
 #else
         // dgemm-method 2
@@ -988,9 +1778,9 @@ void TransLocal::invtrans_fourier_regular( const int nlats, const int nlons, con
             for ( int jlon = 0; jlon < nlons; jlon++ ) {
                 for ( int jlat = 0; jlat < nlats; jlat++ ) {
                     for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
-                        int pos_tp = jlon + nlons * ( jlat + nlats * ( jfld ) );
+                        int pos_tp = jlon + nlons * jlat;
                         //int pos  = jfld + nb_fields * ( jlat + nlats * ( jlon ) );
-                        gp_fields[pos_tp] = gp[idx++];  // = gp[pos]
+                        gp_fields( jfld, pos_tp ) = gp[idx++];  // = gp[pos]
                     }
                 }
             }
@@ -1003,52 +1793,86 @@ void TransLocal::invtrans_fourier_regular( const int nlats, const int nlons, con
 // --------------------------------------------------------------------------------------------------------------------
 
 void TransLocal::invtrans_fourier_reduced( const int nlats, const grid::StructuredGrid g, const int nb_fields,
-                                           double scl_fourier[], double gp_fields[],
-                                           const eckit::Configuration& config ) const {
-    // Fourier transformation:
+                                           double scl_fourier[], const StridedFields<double>& gp_fields,
+                                           const eckit::Configuration& config, const int jlat_begin ) const {
+    // Fourier transformation of the latitudes [jlat_begin,jlat_begin+nlats) of g:
     int nlonsMax = g.nxmax();
     if ( useFFT_ ) {
 #if ATLAS_HAVE_FFTW && !TRANSLOCAL_DGEMM2
         {
-            {
-                ATLAS_TRACE( "Inverse Fourier Transform (FFTW, ReducedGid)" );
-                int jgp = 0;
-                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
-                    for ( int jlat = 0; jlat < nlats; jlat++ ) {
-                        int idx = 0;
-                        //Log::info() << jlat << "in:" << std::endl;
-                        int num_complex     = ( nlonsGlobal_[jlat] / 2 ) + 1;
-                        fftw_->in[idx++][0] = scl_fourier[posMethod( jfld, 0, jlat, 0, nb_fields, nlats )];
-                        //Log::info() << fftw_->in[0][0] << " ";
-                        for ( int jm = 1; jm < num_complex; jm++, idx++ ) {
+            ATLAS_TRACE( "Inverse Fourier Transform (FFTW, ReducedGrid)" );
+            std::vector<int> nlons( nlats );
+            std::vector<int> jgp_begin( nlats + 1 );  // offset of each latitude within a field
+            jgp_begin[0] = 0;
+            for ( int jlat = 0; jlat < nlats; jlat++ ) {
+                nlons[jlat]         = g.nx( jlat_begin + jlat );
+                jgp_begin[jlat + 1] = jgp_begin[jlat] + nlons[jlat];
+            }
+
+            // Buffers for each thread, holding "batch" fields of one latitude
+            const int batch       = fftw_->batch;
+            const size_t size_in  = add_padding( batch * ( ( nlonsMaxGlobal_ / 2 ) + 1 ) );
+            const size_t size_out = add_padding( batch * nlonsMaxGlobal_ );
+            const int nb_threads  = atlas_omp_get_max_threads();
+            fftw_complex* in_all  = fftw_alloc_complex( nb_threads * size_in );
+            double* out_all       = fftw_alloc_real( nb_threads * size_out );
+
+            atlas_omp_parallel {
+                fftw_complex* in = in_all + atlas_omp_get_thread_num() * size_in;
+                double* out      = out_all + atlas_omp_get_thread_num() * size_out;
+
+                atlas_omp_pragma( omp for schedule( dynamic, 1 ) )
+                for ( int jlat = 0; jlat < nlats; jlat++ ) {
+                    const int nlonsGlobal       = nlonsGlobal_[jlat_begin + jlat];
+                    const int num_complex       = ( nlonsGlobal / 2 ) + 1;
+                    const fftw_plan plan_batch  = fftw_->plans_batch.at( nlonsGlobal );
+                    const fftw_plan plan_single = fftw_->plans_single.at( nlonsGlobal );
+
+                    auto copy_in = [&]( int jfld, fftw_complex* inj ) {
+                        inj[0][0] = scl_fourier[posMethod( jfld, 0, jlat, 0, nb_fields, nlats )];
+                        inj[0][1] = 0.;
+                        for ( int jm = 1; jm < num_complex; jm++ ) {
                             for ( int imag = 0; imag < 2; imag++ ) {
                                 if ( jm <= truncation_ ) {
-                                    fftw_->in[idx][imag] =
-                                        scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )];
+                                    inj[jm][imag] = scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )];
                                 }
                                 else {
-                                    fftw_->in[idx][imag] = 0.;
+                                    inj[jm][imag] = 0.;
                                 }
-                                //Log::info() << fftw_->in[idx][imag] << " ";
                             }
                         }
-                        //Log::info() << std::endl;
-                        //Log::info() << jlat << "out:" << std::endl;
-                        int jplan = nlatsLegDomain_ - nlatsNH_ + jlat;
-                        if ( jplan >= nlatsLegDomain_ ) { jplan = nlats - 1 + nlatsLegDomain_ - nlatsSH_ - jlat; };
-                        //ASSERT( jplan < nlatsLeg_ && jplan >= 0 );
-                        fftw_execute_dft_c2r( fftw_->plans[jplan], fftw_->in, fftw_->out );
-                        for ( int jlon = 0; jlon < g.nx( jlat ); jlon++ ) {
-                            int j = jlon + jlonMin_[jlat];
-                            if ( j >= nlonsGlobal_[jlat] ) { j -= nlonsGlobal_[jlat]; }
-                            //Log::info() << fftw_->out[j] << " ";
-                            ASSERT( j < nlonsMaxGlobal_ );
-                            gp_fields[jgp++] = fftw_->out[j];
+                    };
+                    auto copy_out = [&]( int jfld, const double* outj ) {
+                        const size_t stride = gp_fields.stride( jfld );
+                        double* gp          = gp_fields.data( jfld ) + jgp_begin[jlat] * stride;
+                        for ( int jlon = 0; jlon < nlons[jlat]; jlon++ ) {
+                            int j = jlon + jlonMin_[jlat_begin + jlat];
+                            if ( j >= nlonsGlobal ) { j -= nlonsGlobal; }
+                            gp[jlon * stride] = outj[j];
+                        }
+                    };
+
+                    int jfld = 0;
+                    // all fields of a latitude, "batch" fields at a time:
+                    for ( ; jfld + batch <= nb_fields; jfld += batch ) {
+                        for ( int jb = 0; jb < batch; jb++ ) {
+                            copy_in( jfld + jb, in + jb * num_complex );
                         }
-                        //Log::info() << std::endl;
+                        fftw_execute_dft_c2r( plan_batch, in, out );
+                        for ( int jb = 0; jb < batch; jb++ ) {
+                            copy_out( jfld + jb, out + jb * nlonsGlobal );
+                        }
+                    }
+                    // remaining fields one by one:
+                    for ( ; jfld < nb_fields; jfld++ ) {
+                        copy_in( jfld, in );
+                        fftw_execute_dft_c2r( plan_single, in, out );
+                        copy_out( jfld, out );
                     }
                 }
             }
+            fftw_free( in_all );
+            fftw_free( out_all );
         }
 #endif
     }
@@ -1264,7 +2088,7 @@ void TransLocal::invtrans_unstructured( const int truncation, const int nb_field
 // Andreas Mueller *ECMWF*
 //
 void TransLocal::invtrans_uv( const int truncation, const int nb_scalar_fields, const int nb_vordiv_fields,
-                              const double scalar_spectra[], double gp_fields[],
+                              const StridedFields<const double>& scalar_spectra, const StridedFields<double>& gp_fields,
                               const eckit::Configuration& config ) const {
     if ( nb_scalar_fields > 0 ) {
         int nb_fields = nb_scalar_fields;
@@ -1277,10 +2101,10 @@ void TransLocal::invtrans_uv( const int truncation, const int nb_scalar_fields,
             int nlons            = g.nxmax();
             int size_fourier_max = nb_fields * 2 * nlats;
             double* scl_fourier;
-            alloc_aligned( scl_fourier, size_fourier_max * ( truncation_ + 1 ) );
+            alloc_aligned( scl_fourier, size_fourier_max * nb_legendre_wavenumbers_ );
 
             // ATLAS-159 workaround begin
-            for ( int i = 0; i < size_fourier_max * ( truncation_ + 1 ); ++i ) {
+            for ( int i = 0; i < size_fourier_max * nb_legendre_wavenumbers_; ++i ) {
                 scl_fourier[i] = 0.;
             }
             // ATLAS-159 workaround end
@@ -1289,48 +2113,76 @@ void TransLocal::invtrans_uv( const int truncation, const int nb_scalar_fields,
             invtrans_legendre( truncation, nlats, nb_scalar_fields, nb_vordiv_fields, scalar_spectra, scl_fourier,
                                config );
 
-            // Fourier transformation:
-            if ( grid::RegularGrid( gridGlobal_ ) ) {
-                invtrans_fourier_regular( nlats, nlons, nb_fields, scl_fourier, gp_fields, config );
+            const int nb_uv_fields = std::min( 2 * nb_vordiv_fields, nb_fields );
+            if ( parallelisation_ ) {
+                // Transposition to the latitudes of this task, Fourier transformation of these latitudes
+                // and redistribution to the owned points of the StructuredColumns:
+                const int jlat_begin  = parallelisation_->lat_begin();
+                const int nlats_local = parallelisation_->lat_end() - jlat_begin;
+                std::vector<double> scl_fourier_lats( size_t( 2 * nb_fields ) * nlats_local * ( truncation_ + 1 ) );
+                const size_t nb_gp_lats = parallelisation_->nb_gridpoints_latitudes();
+                std::vector<double> gp_lats( nb_fields * nb_gp_lats );
+                parallelisation_->transpose_to_latitudes( nb_fields, scl_fourier, scl_fourier_lats.data() );
+                invtrans_fourier_reduced( nlats_local, g, nb_fields, scl_fourier_lats.data(),
+                                          StridedFields<double>::contiguous( nb_fields, nb_gp_lats, gp_lats.data() ),
+                                          config, jlat_begin );
+                if ( nb_vordiv_fields > 0 ) {
+                    ATLAS_TRACE( "compute u,v from U,V" );
+                    divide_by_coslat( g, jlat_begin, nlats_local,
+                                      StridedFields<double>::contiguous( nb_uv_fields, nb_gp_lats, gp_lats.data() ) );
+                }
+                parallelisation_->gridpoints_to_columns( gp_lats.data(), gp_fields );
             }
             else {
-                invtrans_fourier_reduced( nlats, g, nb_fields, scl_fourier, gp_fields, config );
-            }
+                // Fourier transformation:
+                if ( grid::RegularGrid( gridGlobal_ ) ) {
+                    invtrans_fourier_regular( nlats, nlons, nb_fields, scl_fourier, gp_fields, config );
+                }
+                else {
+                    invtrans_fourier_reduced( nlats, g, nb_fields, scl_fourier, gp_fields, config );
+                }
 
-            // Computing u,v from U,V:
-            {
+                // Computing u,v from U,V:
                 if ( nb_vordiv_fields > 0 ) {
                     ATLAS_TRACE( "compute u,v from U,V" );
-                    std::vector<double> coslatinvs( nlats );
-                    for ( size_t j = 0; j < nlats; ++j ) {
-                        double lat = g.y( j );
-                        if ( lat > latPole ) { lat = latPole; }
-                        if ( lat < -latPole ) { lat = -latPole; }
-                        double coslat = std::cos( lat * util::Constants::degreesToRadians() );
-                        coslatinvs[j] = 1. / coslat;
-                        //Log::info() << "lat=" << g.y( j ) << " coslat=" << coslat << std::endl;
-                    }
-                    int idx = 0;
-                    for ( int jfld = 0; jfld < 2 * nb_vordiv_fields && jfld < nb_fields; jfld++ ) {
-                        for ( int jlat = 0; jlat < g.ny(); jlat++ ) {
-                            for ( int jlon = 0; jlon < g.nx( jlat ); jlon++ ) {
-                                gp_fields[idx] *= coslatinvs[jlat];
-                                idx++;
-                            }
-                        }
-                    }
+                    divide_by_coslat( g, 0, nlats, gp_fields.slice( 0, nb_uv_fields ) );
                 }
             }
             free_aligned( scl_fourier );
         }
         else {
+            // The transforms for unstructured grids work on contiguous arrays. Fields stored differently
+            // are copied into temporary arrays.
+            const size_t nb_gp   = grid_.size();
+            const double* spectra = scalar_spectra.interleaved_data();
+            double* gp            = gp_fields.contiguous_data( nb_gp );
+            std::vector<double> spectra_tmp, gp_tmp;
+            if ( not spectra ) {
+                const size_t nb_coefficients = 2 * legendre_size( truncation );
+                spectra_tmp.resize( nb_fields * nb_coefficients );
+                for ( size_t k = 0; k < nb_coefficients; k++ ) {
+                    for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                        spectra_tmp[jfld + nb_fields * k] = scalar_spectra( jfld, k );
+                    }
+                }
+                spectra = spectra_tmp.data();
+            }
+            if ( not gp ) {
+                gp_tmp.resize( nb_fields * nb_gp );
+                gp = gp_tmp.data();
+            }
             if ( unstruct_precomp_ ) {
-                invtrans_unstructured_precomp( truncation, nb_scalar_fields, nb_vordiv_fields, scalar_spectra,
-                                               gp_fields, config );
+                invtrans_unstructured_precomp( truncation, nb_scalar_fields, nb_vordiv_fields, spectra, gp, config );
             }
             else {
-                invtrans_unstructured( truncation, nb_scalar_fields, nb_vordiv_fields, scalar_spectra, gp_fields,
-                                       config );
+                invtrans_unstructured( truncation, nb_scalar_fields, nb_vordiv_fields, spectra, gp, config );
+            }
+            if ( gp_tmp.size() ) {
+                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                    for ( size_t j = 0; j < nb_gp; j++ ) {
+                        gp_fields( jfld, j ) = gp_tmp[jfld * nb_gp + j];
+                    }
+                }
             }
         }
     }
@@ -1346,17 +2198,24 @@ void TransLocal::invtrans( const int nb_vordiv_fields, const double vorticity_sp
 
 // --------------------------------------------------------------------------------------------------------------------
 
-void extend_truncation( const int old_truncation, const int nb_fields, const double old_spectra[],
-                        double new_spectra[] ) {
+// Spectral data of the given zonal wavenumbers with truncation increased by one, the coefficients of the
+// additional total (and zonal) wavenumber being zero
+void extend_truncation( const int old_truncation, const std::vector<int>& zonal_wavenumbers, const int nb_fields,
+                        const StridedFields<const double>& old_spectra, double new_spectra[] ) {
     int k = 0, k_old = 0;
-    for ( int m = 0; m <= old_truncation + 1; m++ ) {             // zonal wavenumber
-        for ( int n = m; n <= old_truncation + 1; n++ ) {         // total wavenumber
-            for ( int imag = 0; imag < 2; imag++ ) {              // imaginary/real part
-                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {  // field
-                    if ( m == old_truncation + 1 || n == old_truncation + 1 ) { new_spectra[k++] = 0.; }
-                    else {
-                        new_spectra[k++] = old_spectra[k_old++];
+    for ( int m : zonal_wavenumbers ) {                    // zonal wavenumber
+        for ( int n = m; n <= old_truncation + 1; n++ ) {  // total wavenumber
+            for ( int imag = 0; imag < 2; imag++ ) {       // imaginary/real part
+                if ( m == old_truncation + 1 || n == old_truncation + 1 ) {
+                    for ( int jfld = 0; jfld < nb_fields; jfld++ ) {  // field
+                        new_spectra[k++] = 0.;
+                    }
+                }
+                else {
+                    for ( int jfld = 0; jfld < nb_fields; jfld++ ) {  // field
+                        new_spectra[k++] = old_spectra( jfld, k_old );
                     }
+                    k_old++;
                 }
             }
         }
@@ -1368,11 +2227,37 @@ void extend_truncation( const int old_truncation, const int nb_fields, const dou
 void TransLocal::invtrans( const int nb_scalar_fields, const double scalar_spectra[], const int nb_vordiv_fields,
                            const double vorticity_spectra[], const double divergence_spectra[], double gp_fields[],
                            const eckit::Configuration& config ) const {
-    int nb_gp = grid_.size();
+    // spectral data holds the zonal wavenumbers of this task (see zonal_wavenumbers()), as used by the
+    // Legendre transforms
+    const size_t nb_gp = parallelisation_ ? parallelisation_->nb_gridpoints_columns() : grid_.size();
+    // grid-point fields: wind components u of all vorticity/divergence fields, then v, then the scalar fields
+    invtrans_fields( StridedFields<const double>::interleaved( nb_scalar_fields, scalar_spectra ),
+                     StridedFields<const double>::interleaved( nb_vordiv_fields, vorticity_spectra ),
+                     StridedFields<const double>::interleaved( nb_vordiv_fields, divergence_spectra ),
+                     StridedFields<double>::contiguous( 2 * nb_vordiv_fields + nb_scalar_fields, nb_gp, gp_fields ),
+                     config );
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Inverse transform of spectral data of the zonal wavenumbers of this task (see invtrans above), with each field
+// in its own, possibly strided, memory. This is shared by the IFS style API and the Field based API, and
+// transforms all fields at once.
+//
+void TransLocal::invtrans_fields( const StridedFields<const double>& scalar_spectra,
+                                  const StridedFields<const double>& vorticity_spectra,
+                                  const StridedFields<const double>& divergence_spectra,
+                                  const StridedFields<double>& gp_fields, const eckit::Configuration& config ) const {
+    const int nb_scalar_fields = scalar_spectra.size();
+    const int nb_vordiv_fields = vorticity_spectra.size();
+    ASSERT( divergence_spectra.size() == nb_vordiv_fields );
+    ASSERT( gp_fields.size() == 2 * nb_vordiv_fields + nb_scalar_fields );
     if ( nb_vordiv_fields > 0 ) {
         // collect all spectral data into one array "all_spectra":
         ATLAS_TRACE( "TransLocal::invtrans" );
-        int nb_vordiv_spec_ext = 2 * legendre_size( truncation_ + 1 ) * nb_vordiv_fields;
+        // zonal wavenumbers of the spectral data with truncation increased by one (see spectral_size)
+        std::vector<int> zonal_wavenumbers_ext = zonal_wavenumbers();
+        if ( not parallelisation_ ) { zonal_wavenumbers_ext.push_back( truncation_ + 1 ); }
+        int nb_vordiv_spec_ext = spectral_size( truncation_ + 1 ) * nb_vordiv_fields;
         std::vector<double> U_ext;
         std::vector<double> V_ext;
         std::vector<double> scalar_ext;
@@ -1385,32 +2270,33 @@ void TransLocal::invtrans( const int nb_scalar_fields, const double scalar_spect
             {
                 ATLAS_TRACE( "extend vordiv" );
                 // increase truncation in vorticity_spectra and divergence_spectra:
-                extend_truncation( truncation_, nb_vordiv_fields, vorticity_spectra,
+                extend_truncation( truncation_, zonal_wavenumbers_ext, nb_vordiv_fields, vorticity_spectra,
                                    vorticity_spectra_extended.data() );
-                extend_truncation( truncation_, nb_vordiv_fields, divergence_spectra,
+                extend_truncation( truncation_, zonal_wavenumbers_ext, nb_vordiv_fields, divergence_spectra,
                                    divergence_spectra_extended.data() );
             }
 
             {
                 ATLAS_TRACE( "vordiv to UV" );
                 // call vd2uv to compute u and v in spectral space
-                trans::VorDivToUV vordiv_to_UV_ext( truncation_ + 1, option::type( "local" ) );
-                vordiv_to_UV_ext.execute( nb_vordiv_spec_ext, nb_vordiv_fields, vorticity_spectra_extended.data(),
+                VorDivToUVLocal vordiv_to_UV_ext( truncation_ + 1 );
+                vordiv_to_UV_ext.execute( zonal_wavenumbers_ext, nb_vordiv_fields, vorticity_spectra_extended.data(),
                                           divergence_spectra_extended.data(), U_ext.data(), V_ext.data() );
             }
         }
         if ( nb_scalar_fields > 0 ) {
-            int nb_scalar_ext = 2 * legendre_size( truncation_ + 1 ) * nb_scalar_fields;
+            int nb_scalar_ext = spectral_size( truncation_ + 1 ) * nb_scalar_fields;
             scalar_ext.resize( nb_scalar_ext );
-            extend_truncation( truncation_, nb_scalar_fields, scalar_spectra, scalar_ext.data() );
+            extend_truncation( truncation_, zonal_wavenumbers_ext, nb_scalar_fields, scalar_spectra,
+                               scalar_ext.data() );
         }
         int nb_all_fields = 2 * nb_vordiv_fields + nb_scalar_fields;
-        int nb_all_size   = 2 * legendre_size( truncation_ + 1 ) * nb_all_fields;
+        int nb_all_size   = spectral_size( truncation_ + 1 ) * nb_all_fields;
         std::vector<double> all_spectra( nb_all_size );
         int k = 0, i = 0, j = 0, l = 0;
         {
             ATLAS_TRACE( "merge all spectra" );
-            for ( int m = 0; m <= truncation_ + 1; m++ ) {                       // zonal wavenumber
+            for ( int m : zonal_wavenumbers_ext ) {                              // zonal wavenumber
                 for ( int n = m; n <= truncation_ + 1; n++ ) {                   // total wavenumber
                     for ( int imag = 0; imag < 2; imag++ ) {                     // imaginary/real part
                         for ( int jfld = 0; jfld < nb_vordiv_fields; jfld++ ) {  // vorticity fields
@@ -1426,18 +2312,18 @@ void TransLocal::invtrans( const int nb_scalar_fields, const double scalar_spect
                 }
             }
         }
-        int nb_vordiv_size = 2 * legendre_size( truncation_ + 1 ) * nb_vordiv_fields;
-        int nb_scalar_size = 2 * legendre_size( truncation_ + 1 ) * nb_scalar_fields;
+        int nb_vordiv_size = spectral_size( truncation_ + 1 ) * nb_vordiv_fields;
+        int nb_scalar_size = spectral_size( truncation_ + 1 ) * nb_scalar_fields;
         ASSERT( k == nb_all_size );
         ASSERT( i == nb_vordiv_size );
         ASSERT( j == nb_vordiv_size );
         ASSERT( l == nb_scalar_size );
-        invtrans_uv( truncation_ + 1, nb_all_fields, nb_vordiv_fields, all_spectra.data(), gp_fields, config );
+        invtrans_uv( truncation_ + 1, nb_all_fields, nb_vordiv_fields,
+                     StridedFields<const double>::interleaved( nb_all_fields, all_spectra.data() ), gp_fields, config );
     }
     else {
         if ( nb_scalar_fields > 0 ) {
-            invtrans_uv( truncation_, nb_scalar_fields, 0, scalar_spectra, gp_fields + 2 * nb_gp * nb_vordiv_fields,
-                         config );
+            invtrans_uv( truncation_, nb_scalar_fields, 0, scalar_spectra, gp_fields, config );
         }
     }
 }
@@ -1469,20 +2355,436 @@ void TransLocal::dirtrans_wind2vordiv( const Field& gpwind, Field& spvor, Field&
 
 // --------------------------------------------------------------------------------------------------------------------
 
+void TransLocal::dirtrans_fourier_regular( const int nlats, const int nlons, const int nb_fields,
+                                           const double gp_fields[], double scl_fourier[],
+                                           const eckit::Configuration& config ) const {
+    // Fourier transformation:
+#if ATLAS_HAVE_FFTW && !TRANSLOCAL_DGEMM2
+    {
+        ASSERT( nlons == nlonsMaxGlobal_ );
+        int num_complex    = ( nlonsMaxGlobal_ / 2 ) + 1;
+        const double scale = 1. / nlonsMaxGlobal_;
+        {
+            ATLAS_TRACE( "Direct Fourier Transform (FFTW, RegularGrid)" );
+            for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                for ( int jlat = 0; jlat < nlats; jlat++ ) {
+                    for ( int jlon = 0; jlon < nlons; jlon++ ) {
+                        fftw_->out[jlon + nlonsMaxGlobal_ * jlat] = gp_fields[jlon + nlons * ( jlat + nlats * jfld )];
+                    }
+                }
+                fftw_execute_dft_r2c( fftw_->plans_r2c[0], fftw_->out, fftw_->in );
+                for ( int jlat = 0; jlat < nlats; jlat++ ) {
+                    for ( int jm = 0; jm <= truncation_; jm++ ) {
+                        for ( int imag = 0; imag < 2; imag++ ) {
+                            scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )] =
+                                ( jm < num_complex ) ? fftw_->in[jm + num_complex * jlat][imag] * scale : 0.;
+                        }
+                    }
+                }
+            }
+        }
+    }
+#endif
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+void TransLocal::dirtrans_fourier_reduced( const int nlats, const grid::StructuredGrid g, const int nb_fields,
+                                           const double gp_fields[], double scl_fourier[],
+                                           const eckit::Configuration& config, const int jlat_begin ) const {
+    // Fourier transformation of the latitudes [jlat_begin,jlat_begin+nlats) of g:
+#if ATLAS_HAVE_FFTW && !TRANSLOCAL_DGEMM2
+    {
+        ATLAS_TRACE( "Direct Fourier Transform (FFTW, ReducedGrid)" );
+        std::vector<int> jgp_begin( nlats + 1 );  // offset of each latitude within a field
+        jgp_begin[0] = 0;
+        for ( int jlat = 0; jlat < nlats; jlat++ ) {
+            const int jglat = jlat_begin + jlat;
+            ASSERT( g.nx( jglat ) == int( nlonsGlobal_[jglat] ) );
+            jgp_begin[jlat + 1] = jgp_begin[jlat] + g.nx( jglat );
+        }
+        const int nb_gp = jgp_begin[nlats];
+
+        // Buffers for each thread, holding one latitude
+        const size_t size_in  = add_padding( ( nlonsMaxGlobal_ / 2 ) + 1 );
+        const size_t size_out = add_padding( nlonsMaxGlobal_ );
+        const int nb_threads  = atlas_omp_get_max_threads();
+        fftw_complex* in_all  = fftw_alloc_complex( nb_threads * size_in );
+        double* out_all       = fftw_alloc_real( nb_threads * size_out );
+
+        atlas_omp_parallel {
+            fftw_complex* in = in_all + atlas_omp_get_thread_num() * size_in;
+            double* out      = out_all + atlas_omp_get_thread_num() * size_out;
+
+            atlas_omp_pragma( omp for schedule( dynamic, 1 ) )
+            for ( int jlat = 0; jlat < nlats; jlat++ ) {
+                const int jglat = jlat_begin + jlat;
+                const int nlons = g.nx( jglat );
+                int jplan       = nlatsLegDomain_ - nlatsNH_ + jglat;
+                if ( jplan >= nlatsLegDomain_ ) { jplan = g.ny() - 1 + nlatsLegDomain_ - nlatsSH_ - jglat; };
+                const int num_complex = ( nlons / 2 ) + 1;
+                const double scale    = 1. / nlons;
+                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                    const double* gp = gp_fields + size_t( jfld ) * nb_gp + jgp_begin[jlat];
+                    for ( int jlon = 0; jlon < nlons; jlon++ ) {
+                        out[jlon] = gp[jlon];
+                    }
+                    fftw_execute_dft_r2c( fftw_->plans_r2c[jplan], out, in );
+                    for ( int jm = 0; jm <= truncation_; jm++ ) {
+                        for ( int imag = 0; imag < 2; imag++ ) {
+                            scl_fourier[posMethod( jfld, imag, jlat, jm, nb_fields, nlats )] =
+                                ( jm < num_complex ) ? in[jm][imag] * scale : 0.;
+                        }
+                    }
+                }
+            }
+        }
+        fftw_free( in_all );
+        fftw_free( out_all );
+    }
+#endif
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Direct Legendre transform, the adjoint of invtrans_legendre with the Fourier coefficients weighted by
+// the Gaussian quadrature weights. The spectral data is returned with the given truncation, which can
+// be truncation_ or truncation_+1 (as needed to compute vorticity and divergence).
+//
+void TransLocal::dirtrans_legendre( const int truncation, const int nlats, const int nb_fields,
+                                    const double scl_fourier[], double scalar_spectra[],
+                                    const eckit::Configuration& config ) const {
+    ASSERT( truncation <= truncation_ + 1 );
+    ASSERT( nlatsNH_ == nlatsSH_ && nlatsNH_ == nlatsLeg_ );
+    if ( legendre_on_the_fly_ ) {
+        dirtrans_legendre_on_the_fly( truncation, nlats, nb_fields, scl_fourier, scalar_spectra );
+        return;
+    }
+    ATLAS_TRACE( "Direct Legendre Transform (GEMM)" );
+
+    // Workspaces, preallocated for each thread (see invtrans_legendre)
+    const size_t size_fourier_max  = add_padding( 2 * nb_fields * nlatsLeg_ );
+    const size_t size_sym_max      = add_padding( 2 * nb_fields * num_n( truncation_ + 1, 0, true ) );
+    const size_t size_asym_max     = add_padding( 2 * nb_fields * num_n( truncation_ + 1, 0, false ) );
+    const size_t size_legendre_max =
+        single_precision_legendre_ ? add_padding( num_n( truncation_ + 1, 0, true ) * nlatsLeg_ ) : 0;
+    const size_t workspace_size    = 2 * size_fourier_max + size_sym_max + size_asym_max + size_legendre_max;
+    const int nb_threads           = atlas_omp_get_max_threads();
+    double* workspaces;
+    alloc_aligned( workspaces, nb_threads * workspace_size );
+
+    atlas_omp_parallel {
+        double* scl_fourier_sym  = workspaces + atlas_omp_get_thread_num() * workspace_size;
+        double* scl_fourier_asym = scl_fourier_sym + size_fourier_max;
+        double* scalar_sym       = scl_fourier_asym + size_fourier_max;
+        double* scalar_asym      = scalar_sym + size_sym_max;
+        double* legendre         = scalar_asym + size_asym_max;
+
+        atlas_omp_pragma( omp for schedule( dynamic, 1 ) )
+        for ( int jm = 0; jm <= truncation; jm++ ) {
+            // zonal wavenumbers of other tasks are not stored
+            if ( parallelisation_ && not parallelisation_->owns_zonal_wavenumber( jm ) ) { continue; }
+            const size_t ioff = spectral_offset( truncation, jm ) * nb_fields;
+            const int nlatsm  = ( jm <= truncation_ ) ? nlatsLeg_ - nlat0_[jm] : 0;
+            if ( nlatsm <= 0 ) {
+                for ( int jn = jm; jn <= truncation; jn++ ) {
+                    for ( int imag = 0; imag < 2; imag++ ) {
+                        for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                            scalar_spectra[ioff + jfld + nb_fields * ( imag + 2 * ( jn - jm ) )] = 0.;
+                        }
+                    }
+                }
+                continue;
+            }
+            const int size_sym  = num_n( truncation_ + 1, jm, true );
+            const int size_asym = num_n( truncation_ + 1, jm, false );
+            const int n_imag    = ( jm == 0 ) ? 1 : 2;
+
+            // split into symmetric and antisymmetric parts, and apply quadrature weights
+            // (in butterfly mode vectors are interleaved, see ButterflyMatrix):
+            const int nvec = nb_fields * n_imag;
+            for ( int jl = 0; jl < nlatsm; jl++ ) {
+                const int jlat   = nlat0_[jm] + jl;
+                const int jslat  = nlats - jlat - 1;
+                const double w   = gaussian_weights_[jlat];
+                for ( int imag = 0; imag < n_imag; imag++ ) {
+                    for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                        const int k        = jfld + nb_fields * imag;
+                        const int idx      = butterfly_legendre_ ? k + nvec * jl : jl + nlatsm * k;
+                        const double north = scl_fourier[posLegendre( jfld, imag, jlat, jm, nb_fields, nlats )];
+                        const double south = scl_fourier[posLegendre( jfld, imag, jslat, jm, nb_fields, nlats )];
+                        scl_fourier_sym[idx]  = w * ( north + south );
+                        scl_fourier_asym[idx] = w * ( north - south );
+                    }
+                }
+            }
+            if ( butterfly_legendre_ ) {
+                legendre_butterfly_sym_[jm].multiply( nvec, scl_fourier_sym, scalar_sym );
+                if ( size_asym > 0 ) { legendre_butterfly_asym_[jm].multiply( nvec, scl_fourier_asym, scalar_asym ); }
+            }
+            else {
+                // single precision coefficients are converted one panel at a time (see legendre_panel)
+                const size_t sym_offset  = legendre_sym_begin_[jm] + nlat0_[jm] * size_sym;
+                const size_t asym_offset = legendre_asym_begin_[jm] + nlat0_[jm] * size_asym;
+                {
+                    double* legendre_sym = single_precision_legendre_
+                                               ? legendre_panel( legendre_sym_sp_ + sym_offset,
+                                                                 size_t( size_sym ) * nlatsm, legendre )
+                                               : legendre_sym_ + sym_offset;
+                    eckit::linalg::Matrix A( legendre_sym, size_sym, nlatsm );
+                    eckit::linalg::Matrix B( scl_fourier_sym, nlatsm, nb_fields * n_imag );
+                    eckit::linalg::Matrix C( scalar_sym, size_sym, nb_fields * n_imag );
+                    linalg_.gemm( A, B, C );
+                }
+                if ( size_asym > 0 ) {
+                    double* legendre_asym = single_precision_legendre_
+                                                ? legendre_panel( legendre_asym_sp_ + asym_offset,
+                                                                  size_t( size_asym ) * nlatsm, legendre )
+                                                : legendre_asym_ + asym_offset;
+                    eckit::linalg::Matrix A( legendre_asym, size_asym, nlatsm );
+                    eckit::linalg::Matrix B( scl_fourier_asym, nlatsm, nb_fields * n_imag );
+                    eckit::linalg::Matrix C( scalar_asym, size_asym, nb_fields * n_imag );
+                    linalg_.gemm( A, B, C );
+                }
+            }
+
+            // merge symmetric and antisymmetric parts
+            // (total wavenumbers are stored in descending order, see compute_legendre_polynomials):
+            merge_spectra( truncation_, truncation, jm, spectral_offset( truncation, jm ), nb_fields, n_imag,
+                           butterfly_legendre_, scalar_sym, scalar_asym, scalar_spectra );
+        }
+    }
+    free_aligned( workspaces );
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Direct Legendre transform with the Legendre polynomials recomputed for bands of latitudes (see
+// invtrans_legendre_on_the_fly). The contributions of the bands of each thread are accumulated in a
+// copy of the spectral data per thread, which are summed up at the end.
+//
+void TransLocal::dirtrans_legendre_on_the_fly( const int truncation, const int nlats, const int nb_fields,
+                                               const double scl_fourier[], double scalar_spectra[] ) const {
+    ASSERT( truncation <= truncation_ + 1 );
+    ATLAS_TRACE( "Direct Legendre Transform (on the fly)" );
+    auto owned = [&]( int jm ) { return not parallelisation_ || parallelisation_->owns_zonal_wavenumber( jm ); };
+    const int trc = std::min( truncation, truncation_ );
+
+    // symmetric and antisymmetric parts of the spectral data of this task, as columns of nb_fields*n_imag values
+    std::vector<size_t> sym_begin( trc + 2, 0 ), asym_begin( trc + 2, 0 );
+    for ( int jm = 0; jm <= trc; jm++ ) {
+        const int n = owned( jm ) ? 2 * nb_fields : 0;
+        sym_begin[jm + 1]  = sym_begin[jm] + n * num_n( truncation_ + 1, jm, true );
+        asym_begin[jm + 1] = asym_begin[jm] + n * num_n( truncation_ + 1, jm, false );
+    }
+    const size_t size_sym_all  = sym_begin.back();
+    const size_t size_asym_all = asym_begin.back();
+    const int nb_threads       = atlas_omp_get_max_threads();
+    std::vector<double> scalar_sym( nb_threads * size_sym_all, 0. ), scalar_asym( nb_threads * size_asym_all, 0. );
+
+    const int nb_bands = ( nlatsLeg_ + legendre_band_size - 1 ) / legendre_band_size;
+    atlas_omp_parallel {
+        const int thread      = atlas_omp_get_thread_num();
+        double* thread_sym    = scalar_sym.data() + thread * size_sym_all;
+        double* thread_asym   = scalar_asym.data() + thread * size_asym_all;
+        const size_t size_max = 2 * nb_fields * num_n( truncation_ + 1, 0, true );
+        std::vector<double> fourier_sym( 2 * nb_fields * legendre_band_size );
+        std::vector<double> fourier_asym( 2 * nb_fields * legendre_band_size );
+        std::vector<double> product( size_max );
+        atlas_omp_pragma( omp for schedule( dynamic, 1 ) )
+        for ( int jb = 0; jb < nb_bands; jb++ ) {
+            const int jlat_begin = jb * legendre_band_size;
+            const int nb_lats    = std::min( legendre_band_size, nlatsLeg_ - jlat_begin );
+            auto transform       = [&]( int jm, const double leg_sym[], const double leg_asym[] ) {
+                if ( jm > trc || not owned( jm ) ) { return; }
+                const int size_sym  = num_n( truncation_ + 1, jm, true );
+                const int size_asym = num_n( truncation_ + 1, jm, false );
+                const int n_imag    = ( jm == 0 ) ? 1 : 2;
+                const int nvec      = nb_fields * n_imag;
+
+                // split into symmetric and antisymmetric parts, and apply quadrature weights
+                // (latitudes closer to the poles than nlat0_[jm] do not contribute):
+                for ( int jl = 0; jl < nb_lats; jl++ ) {
+                    const int jlat  = jlat_begin + jl;
+                    const int jslat = nlats - jlat - 1;
+                    const double w  = ( jlat >= nlat0_[jm] ) ? gaussian_weights_[jlat] : 0.;
+                    for ( int imag = 0; imag < n_imag; imag++ ) {
+                        for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                            const int idx      = jl + nb_lats * ( jfld + nb_fields * imag );
+                            const double north = scl_fourier[posLegendre( jfld, imag, jlat, jm, nb_fields, nlats )];
+                            const double south = scl_fourier[posLegendre( jfld, imag, jslat, jm, nb_fields, nlats )];
+                            fourier_sym[idx]   = w * ( north + south );
+                            fourier_asym[idx]  = w * ( north - south );
+                        }
+                    }
+                }
+                auto accumulate = [&]( const double leg[], const int size, double fourier[], double spectra[] ) {
+                    eckit::linalg::Matrix A( const_cast<double*>( leg ), size, nb_lats );
+                    eckit::linalg::Matrix B( fourier, nb_lats, nvec );
+                    eckit::linalg::Matrix C( product.data(), size, nvec );
+                    linalg_.gemm( A, B, C );
+                    for ( int j = 0; j < size * nvec; j++ ) {
+                        spectra[j] += product[j];
+                    }
+                };
+                accumulate( leg_sym, size_sym, fourier_sym.data(), thread_sym + sym_begin[jm] );
+                if ( size_asym > 0 ) {
+                    accumulate( leg_asym, size_asym, fourier_asym.data(), thread_asym + asym_begin[jm] );
+                }
+            };
+            compute_legendre_polynomials_band( truncation_ + 1, nb_lats, legendre_lats_.data() + jlat_begin,
+                                               legendre_zfn_.data(), transform );
+        }
+    }
+
+    // sum up the contributions of all threads, and merge symmetric and antisymmetric parts:
+    atlas_omp_parallel_for( int jm = 0; jm <= truncation; jm++ ) {
+        if ( parallelisation_ && not parallelisation_->owns_zonal_wavenumber( jm ) ) { continue; }
+        if ( jm > trc ) {
+            const size_t ioff = spectral_offset( truncation, jm ) * nb_fields;
+            for ( int j = 0; j < 2 * nb_fields * ( truncation - jm + 1 ); j++ ) {
+                scalar_spectra[ioff + j] = 0.;
+            }
+            continue;
+        }
+        double* sym  = scalar_sym.data() + sym_begin[jm];
+        double* asym = scalar_asym.data() + asym_begin[jm];
+        for ( int thread = 1; thread < nb_threads; thread++ ) {
+            for ( size_t j = 0; j < sym_begin[jm + 1] - sym_begin[jm]; j++ ) {
+                sym[j] += sym[thread * size_sym_all + j];
+            }
+            for ( size_t j = 0; j < asym_begin[jm + 1] - asym_begin[jm]; j++ ) {
+                asym[j] += asym[thread * size_asym_all + j];
+            }
+        }
+        merge_spectra( truncation_, truncation, jm, spectral_offset( truncation, jm ), nb_fields, ( jm == 0 ) ? 1 : 2,
+                       false, sym, asym, scalar_spectra );
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Routine to compute the direct spectral transform for a global Gaussian grid. Wind components
+// (the first 2*nb_vordiv_fields fields) are divided by cos(latitude) before the transform, so
+// that vorticity and divergence can be computed from the resulting spectral data.
+//
+void TransLocal::dirtrans_uv( const int truncation, const int nb_fields, const int nb_vordiv_fields,
+                              const double gp_fields[], double scalar_spectra[],
+                              const eckit::Configuration& config ) const {
+    if ( nb_fields == 0 ) { return; }
+    if ( not( grid::StructuredGrid( grid_ ) && not grid_.projection() ) || gaussian_weights_.empty() ) {
+        throw eckit::NotImplemented( "TransLocal::dirtrans is only implemented for global Gaussian grids", Here() );
+    }
+    if ( not useFFT_ ) {
+        throw eckit::NotImplemented( "TransLocal::dirtrans requires FFTW", Here() );
+    }
+    ATLAS_TRACE( "dirtrans_uv structured" );
+    auto g    = grid::StructuredGrid( grid_ );
+    int nlats = g.ny();
+    int nlons = g.nxmax();
+
+    const int nb_uv_fields = std::min( 2 * nb_vordiv_fields, nb_fields );
+
+    double* scl_fourier;
+    alloc_aligned( scl_fourier, nb_fields * 2 * nlats * nb_legendre_wavenumbers_ );
+
+    if ( parallelisation_ ) {
+        // Redistribution to the latitudes of this task, Fourier transformation of these latitudes
+        // and transposition to the zonal wavenumbers of this task:
+        const int jlat_begin  = parallelisation_->lat_begin();
+        const int nlats_local = parallelisation_->lat_end() - jlat_begin;
+        std::vector<double> gp_lats( nb_fields * parallelisation_->nb_gridpoints_latitudes() );
+        std::vector<double> scl_fourier_lats( size_t( 2 * nb_fields ) * nlats_local * ( truncation_ + 1 ) );
+        parallelisation_->gridpoints_to_latitudes( nb_fields, gp_fields, gp_lats.data() );
+        if ( nb_vordiv_fields > 0 ) {
+            ATLAS_TRACE( "compute U,V from u,v" );
+            divide_by_coslat( g, jlat_begin, nlats_local, nb_uv_fields, gp_lats.data() );
+        }
+        dirtrans_fourier_reduced( nlats_local, g, nb_fields, gp_lats.data(), scl_fourier_lats.data(), config,
+                                  jlat_begin );
+        parallelisation_->transpose_to_wavenumbers( nb_fields, scl_fourier_lats.data(), scl_fourier );
+    }
+    else {
+        // Computing U,V from u,v:
+        std::vector<double> gp_uv;
+        if ( nb_vordiv_fields > 0 ) {
+            ATLAS_TRACE( "compute U,V from u,v" );
+            gp_uv.assign( gp_fields, gp_fields + nb_fields * grid_.size() );
+            divide_by_coslat( g, 0, nlats, nb_uv_fields, gp_uv.data() );
+            gp_fields = gp_uv.data();
+        }
+
+        // Fourier transformation:
+        if ( grid::RegularGrid( gridGlobal_ ) ) {
+            dirtrans_fourier_regular( nlats, nlons, nb_fields, gp_fields, scl_fourier, config );
+        }
+        else {
+            dirtrans_fourier_reduced( nlats, g, nb_fields, gp_fields, scl_fourier, config );
+        }
+    }
+
+    // Legendre transformation:
+    dirtrans_legendre( truncation, nlats, nb_fields, scl_fourier, scalar_spectra, config );
+
+    free_aligned( scl_fourier );
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
 void TransLocal::dirtrans( const int nb_fields, const double scalar_fields[], double scalar_spectra[],
-                           const eckit::Configuration& ) const {
-    NOTIMP;
-    // Not implemented and not planned.
-    // Use the TransIFS implementation instead.
+                           const eckit::Configuration& config ) const {
+    ATLAS_TRACE( "TransLocal::dirtrans" );
+    dirtrans_uv( truncation_, nb_fields, 0, scalar_fields, scalar_spectra, config );
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Routine to compute spectral vorticity and divergence out of the spectral data of u/cos(latitude) and
+// v/cos(latitude) (with truncation+1). This is the direct counterpart of vd2uv. Only total wavenumbers of
+// the same zonal wavenumber are coupled, so that the spectral data may hold any zonal wavenumbers (up to
+// truncation), in ascending order.
+//
+namespace {
+void uv2vordiv( const int truncation, const std::vector<int>& zonal_wavenumbers, const int nb_fields,
+                const double UV_ext[], double vorticity_spectra[], double divergence_spectra[] ) {
+    const double za_r = 1. / util::Earth::radius();
+    auto epsilon      = []( int n, int m ) { return std::sqrt( double( n * n - m * m ) / ( 4. * n * n - 1. ) ); };
+    size_t offset_ext = 0;  // total wavenumbers of UV_ext before zonal wavenumber m
+    auto U            = [&]( int m, int n, int imag, int jfld ) -> double {
+        if ( n < m ) { return 0.; }
+        return UV_ext[jfld + 2 * nb_fields * ( imag + 2 * ( offset_ext + n - m ) )];
+    };
+    auto V = [&]( int m, int n, int imag, int jfld ) { return U( m, n, imag, jfld + nb_fields ); };
+    int k  = 0;
+    for ( int m : zonal_wavenumbers ) {                // zonal wavenumber
+        for ( int n = m; n <= truncation; n++ ) {      // total wavenumber
+            const double cp = -n * epsilon( n + 1, m );
+            const double cm = ( n > m ) ? ( n + 1 ) * epsilon( n, m ) : 0.;
+            for ( int imag = 0; imag < 2; imag++ ) {  // imaginary/real part
+                // i*m*X: real part is -m*Im(X), imaginary part is +m*Re(X)
+                const double im = ( imag == 0 ? -m : m );
+                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {  // field
+                    vorticity_spectra[k] = za_r * ( im * V( m, n, 1 - imag, jfld ) + cp * U( m, n + 1, imag, jfld ) +
+                                                    cm * U( m, n - 1, imag, jfld ) );
+                    divergence_spectra[k] = za_r * ( im * U( m, n, 1 - imag, jfld ) - cp * V( m, n + 1, imag, jfld ) -
+                                                     cm * V( m, n - 1, imag, jfld ) );
+                    k++;
+                }
+            }
+        }
+        offset_ext += truncation + 2 - m;
+    }
 }
+}  // namespace
 
 // --------------------------------------------------------------------------------------------------------------------
 
 void TransLocal::dirtrans( const int nb_fields, const double wind_fields[], double vorticity_spectra[],
-                           double divergence_spectra[], const eckit::Configuration& ) const {
-    NOTIMP;
-    // Not implemented and not planned.
-    // Use the TransIFS implementation instead.
+                           double divergence_spectra[], const eckit::Configuration& config ) const {
+    ATLAS_TRACE( "TransLocal::dirtrans" );
+    // spectral data of u/cos(lat) and v/cos(lat), with truncation increased by one:
+    std::vector<double> UV_ext( spectral_size( truncation_ + 1 ) * 2 * nb_fields );
+    dirtrans_uv( truncation_ + 1, 2 * nb_fields, nb_fields, wind_fields, UV_ext.data(), config );
+    {
+        ATLAS_TRACE( "UV to vordiv" );
+        uv2vordiv( truncation_, zonal_wavenumbers(), nb_fields, UV_ext.data(), vorticity_spectra, divergence_spectra );
+    }
 }
 
 // --------------------------------------------------------------------------------------------------------------------
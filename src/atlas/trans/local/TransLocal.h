@@ -16,6 +16,8 @@
 #include "atlas/array.h"
 #include "atlas/grid/Grid.h"
 #include "atlas/trans/Trans.h"
+#include "atlas/trans/local/ButterflyMatrix.h"
+#include "atlas/trans/local/StridedFields.h"
 
 #define TRANSLOCAL_DGEMM2 0
 
@@ -31,6 +33,7 @@ class LinearAlgebra;
 namespace atlas {
 class Field;
 class FieldSet;
+class FunctionSpace;
 }  // namespace atlas
 
 //-----------------------------------------------------------------------------
@@ -43,6 +46,7 @@ struct FFTW_Data;
 }
 
 class LegendreCacheCreatorLocal;
+class ParallelisationLocal;
 int fourier_truncation( const int truncation,  // truncation
                         const int nx,          // number of longitudes
                         const int nxmax,       // maximum nx
@@ -59,11 +63,38 @@ int fourier_truncation( const int truncation,  // truncation
 /// For global grids, please consider using TransIFS instead.
 ///
 /// @todo:
-///  - support multiple fields
-///  - support atlas::Field and atlas::FieldSet based on function spaces
+///  - support direct transforms of atlas::Field and atlas::FieldSet
 ///
-/// @note: Direct transforms are not implemented and cannot be unless
-///        the grid is global. There are no plans to support this at the moment.
+/// @note: Inverse transforms of atlas::Field and atlas::FieldSet read the (levels of the) Spectral fields and
+///        write the owned points of the StructuredColumns fields in place, all fields in one transform.
+///        Gradient and wind fields hold the x (eastward) and y (northward) components in their last dimension.
+///
+/// @note: Direct transforms are only implemented for global Gaussian grids,
+///        and require FFTW.
+///
+/// @note: With the option legendre_storage="single" the precomputed Legendre coefficients
+///        are stored in single precision, halving their memory footprint (also in a Cache).
+///        This is a storage-only option: spectral and grid-point data, the Fourier transforms and the
+///        Legendre transforms remain in double precision, and the coefficients of each zonal wavenumber
+///        are converted when used, so that the transforms are not faster than in double precision.
+///
+/// @note: With the option legendre_method="butterfly" the Legendre transforms of global structured grids
+///        apply a butterfly compression of the Legendre coefficients (see ButterflyMatrix), accurate to
+///        the relative tolerance given by the option butterfly_tolerance (default 1.e-12). This reduces
+///        the cost and the memory footprint (also of a Cache) at high truncations, at the expense of
+///        a longer precomputation. Blocks smaller than the option butterfly_leaf_size (default 32)
+///        are kept dense.
+///
+/// @note: With the option legendre_method="on_the_fly" the Legendre coefficients of global structured grids
+///        are not stored, but recomputed for bands of latitudes within each transform and applied while they
+///        are in cache. This trades a recomputation of O(T^2) operations per latitude for the O(T^3) memory
+///        of the coefficients. Direct transforms use a copy of the spectral data per thread.
+///
+/// @note: When constructed from a StructuredColumns and a Spectral function space, the transforms are
+///        distributed over the MPI tasks (see ParallelisationLocal). Spectral data of a task then holds
+///        its zonal wavenumbers only (see zonal_wavenumbers()), and grid-point data the owned points of
+///        the StructuredColumns. No task holds spectral data or Fourier coefficients of all zonal wavenumbers.
+///        This requires a global Gaussian grid and FFTW.
 class TransLocal : public trans::TransImpl {
 public:
     TransLocal( const Grid&, const long truncation, const eckit::Configuration& = util::NoConfig() );
@@ -71,6 +102,9 @@ public:
     TransLocal( const Cache&, const Grid&, const long truncation, const eckit::Configuration& = util::NoConfig() );
     TransLocal( const Cache&, const Grid&, const Domain&, const long truncation,
                 const eckit::Configuration& = util::NoConfig() );
+    TransLocal( const FunctionSpace& gp, const FunctionSpace& sp, const eckit::Configuration& = util::NoConfig() );
+    TransLocal( const Cache&, const FunctionSpace& gp, const FunctionSpace& sp,
+                const eckit::Configuration& = util::NoConfig() );
 
     virtual ~TransLocal();
 
@@ -79,6 +113,12 @@ public:
 
     virtual const Grid& grid() const override { return grid_; }
 
+    /// @brief Zonal wavenumbers of the spectral data of this MPI task, in ascending order
+    std::vector<int> zonal_wavenumbers() const;
+
+    /// @brief Number of spectral coefficients of this MPI task (equal to spectralCoefficients() if not distributed)
+    size_t nb_spectral_coefficients() const;
+
     virtual void invtrans( const Field& spfield, Field& gpfield,
                            const eckit::Configuration& = util::NoConfig() ) const override;
 
@@ -107,6 +147,12 @@ public:
                            const double divergence_spectra[], double gp_fields[],
                            const eckit::Configuration& = util::NoConfig() ) const override;
 
+    virtual void dirtrans( const int nb_fields, const double scalar_fields[], double scalar_spectra[],
+                           const eckit::Configuration& = util::NoConfig() ) const override;
+
+    virtual void dirtrans( const int nb_fields, const double wind_fields[], double vorticity_spectra[],
+                           double divergence_spectra[], const eckit::Configuration& = util::NoConfig() ) const override;
+
     // -- NOT SUPPORTED -- //
 
     virtual void dirtrans( const Field& gpfield, Field& spfield,
@@ -118,13 +164,10 @@ public:
     virtual void dirtrans_wind2vordiv( const Field& gpwind, Field& spvor, Field& spdiv,
                                        const eckit::Configuration& = util::NoConfig() ) const override;
 
-    virtual void dirtrans( const int nb_fields, const double scalar_fields[], double scalar_spectra[],
-                           const eckit::Configuration& = util::NoConfig() ) const override;
-
-    virtual void dirtrans( const int nb_fields, const double wind_fields[], double vorticity_spectra[],
-                           double divergence_spectra[], const eckit::Configuration& = util::NoConfig() ) const override;
-
 private:
+    TransLocal( const Cache&, const Grid&, const Domain&, const long truncation, const eckit::Configuration&,
+                std::unique_ptr<ParallelisationLocal>&& );
+
     int posMethod( const int jfld, const int imag, const int jlat, const int jm, const int nb_fields,
                    const int nlats ) const {
 #if !TRANSLOCAL_DGEMM2
@@ -134,15 +177,37 @@ private:
 #endif
     };
 
+    // Position in the Fourier coefficients of the Legendre transforms, which hold the zonal wavenumbers of
+    // this MPI task only (all zonal wavenumbers, as posMethod, if not distributed)
+    int posLegendre( const int jfld, const int imag, const int jlat, const int jm, const int nb_fields,
+                     const int nlats ) const {
+#if !TRANSLOCAL_DGEMM2
+        return imag + 2 * ( legendre_wavenumber_index_[jm] + nb_legendre_wavenumbers_ * ( jlat + nlats * jfld ) );
+#else
+        return jfld + nb_fields * ( jlat + nlats * ( imag + 2 * legendre_wavenumber_index_[jm] ) );
+#endif
+    };
+
+    /// @brief Number of spectral coefficients of this MPI task for given truncation (for each field)
+    size_t spectral_size( const int truncation ) const;
+
+    /// @brief First spectral coefficient of zonal wavenumber jm (of this MPI task) in the spectral data of
+    /// this task for given truncation (for each field)
+    size_t spectral_offset( const int truncation, const int jm ) const;
+
     void invtrans_legendre( const int truncation, const int nlats, const int nb_fields, const int nb_vordiv_fields,
-                            const double scalar_spectra[], double scl_fourier[],
+                            const StridedFields<const double>& scalar_spectra, double scl_fourier[],
                             const eckit::Configuration& config ) const;
 
+    void invtrans_legendre_on_the_fly( const int truncation, const int nlats, const int nb_fields,
+                                       const StridedFields<const double>& scalar_spectra, double scl_fourier[] ) const;
+
     void invtrans_fourier_regular( const int nlats, const int nlons, const int nb_fields, double scl_fourier[],
-                                   double gp_fields[], const eckit::Configuration& config ) const;
+                                   const StridedFields<double>& gp_fields, const eckit::Configuration& config ) const;
 
     void invtrans_fourier_reduced( const int nlats, const grid::StructuredGrid g, const int nb_fields,
-                                   double scl_fourier[], double gp_fields[], const eckit::Configuration& config ) const;
+                                   double scl_fourier[], const StridedFields<double>& gp_fields,
+                                   const eckit::Configuration& config, const int jlat_begin = 0 ) const;
 
     void invtrans_unstructured_precomp( const int truncation, const int nb_scalar_fields, const int nb_vordiv_fields,
                                         const double scalar_spectra[], double gp_fields[],
@@ -153,7 +218,36 @@ private:
                                 const eckit::Configuration& config ) const;
 
     void invtrans_uv( const int truncation, const int nb_scalar_fields, const int nb_vordiv_fields,
-                      const double scalar_spectra[], double gp_fields[],
+                      const StridedFields<const double>& scalar_spectra, const StridedFields<double>& gp_fields,
+                      const eckit::Configuration& = util::NoConfig() ) const;
+
+    void invtrans_fields( const StridedFields<const double>& scalar_spectra,
+                          const StridedFields<const double>& vorticity_spectra,
+                          const StridedFields<const double>& divergence_spectra,
+                          const StridedFields<double>& gp_fields, const eckit::Configuration& ) const;
+
+    /// @brief Levels of Spectral fields, holding the zonal wavenumbers of this MPI task. Of fields holding all
+    /// zonal wavenumbers (when distributed), those of this task are copied into buffer.
+    StridedFields<const double> spectral_fields( const FieldSet&, std::vector<double>& buffer ) const;
+
+    /// @brief Owned points of the levels of StructuredColumns fields, or of their component jcomp if with_components
+    StridedFields<double> gridpoint_fields( const FieldSet&, const bool with_components, const int jcomp ) const;
+
+    void dirtrans_fourier_regular( const int nlats, const int nlons, const int nb_fields, const double gp_fields[],
+                                   double scl_fourier[], const eckit::Configuration& config ) const;
+
+    void dirtrans_fourier_reduced( const int nlats, const grid::StructuredGrid g, const int nb_fields,
+                                   const double gp_fields[], double scl_fourier[], const eckit::Configuration& config,
+                                   const int jlat_begin = 0 ) const;
+
+    void dirtrans_legendre( const int truncation, const int nlats, const int nb_fields, const double scl_fourier[],
+                            double scalar_spectra[], const eckit::Configuration& config ) const;
+
+    void dirtrans_legendre_on_the_fly( const int truncation, const int nlats, const int nb_fields,
+                                       const double scl_fourier[], double scalar_spectra[] ) const;
+
+    void dirtrans_uv( const int truncation, const int nb_scalar_fields, const int nb_vordiv_fields,
+                      const double gp_fields[], double scalar_spectra[],
                       const eckit::Configuration& = util::NoConfig() ) const;
 
     bool warning( const eckit::Configuration& = util::NoConfig() ) const;
@@ -184,14 +278,28 @@ private:
     double* legendre_;
     double* legendre_sym_;
     double* legendre_asym_;
+    float* legendre_sym_sp_{nullptr};   // used instead of legendre_sym_ when single_precision_legendre_
+    float* legendre_asym_sp_{nullptr};  // used instead of legendre_asym_ when single_precision_legendre_
+    bool single_precision_legendre_{false};
+    bool butterfly_legendre_{false};
+    std::vector<double> legendre_butterfly_data_;          // encoded butterfly matrices, unless in a cache
+    std::vector<ButterflyMatrix> legendre_butterfly_sym_;   // for each zonal wavenumber, when butterfly_legendre_
+    std::vector<ButterflyMatrix> legendre_butterfly_asym_;  // for each zonal wavenumber, when butterfly_legendre_
+    bool legendre_on_the_fly_{false};
+    std::vector<double> legendre_lats_;  // latitudes of the Legendre polynomials, when legendre_on_the_fly_
+    std::vector<double> legendre_zfn_;   // coefficients of compute_zfn, when legendre_on_the_fly_
     double* fourier_;
     double* fouriertp_;
     std::vector<size_t> legendre_begin_;
     std::vector<size_t> legendre_sym_begin_;
     std::vector<size_t> legendre_asym_begin_;
+    std::vector<double> gaussian_weights_;  // quadrature weights of northern hemisphere, used in dirtrans
 
 
     std::unique_ptr<detail::FFTW_Data> fftw_;
+    std::unique_ptr<ParallelisationLocal> parallelisation_;  // only set when distributed over MPI tasks
+    std::vector<int> legendre_wavenumber_index_;  // position of each zonal wavenumber of this task (see posLegendre)
+    int nb_legendre_wavenumbers_;                 // number of zonal wavenumbers of this task
 
     Cache cache_;
     Cache export_legendre_;
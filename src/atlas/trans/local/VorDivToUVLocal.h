@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "atlas/trans/VorDivToUV.h"
 
 //-----------------------------------------------------------------------------
@@ -57,6 +59,12 @@ public:
     virtual void execute( const int nb_coeff, const int nb_fields, const double vorticity[], const double divergence[],
                           double U[], double V[], const eckit::Configuration& = util::NoConfig() ) const override;
 
+    /// @brief As above, for spectral data holding only the given zonal wavenumbers, in ascending order
+    /// (as the spectral data of an MPI task of a distributed TransLocal)
+    void execute( const std::vector<int>& zonal_wavenumbers, const int nb_fields, const double vorticity[],
+                  const double divergence[], double U[], double V[],
+                  const eckit::Configuration& = util::NoConfig() ) const;
+
 private:
     int truncation_;
 };
@@ -0,0 +1,171 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include "atlas/util/IndexKDTree.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <utility>
+
+#include "eckit/exception/Exceptions.h"
+
+#include "atlas/runtime/Trace.h"
+
+namespace atlas {
+namespace util {
+
+namespace {
+
+// Nodes with at most this many points are not split, but searched linearly
+constexpr idx_t leaf_size = 8;
+
+inline double distance2( const PointXYZ& p, const PointXYZ& q ) {
+    const double dx = p.x() - q.x();
+    const double dy = p.y() - q.y();
+    const double dz = p.z() - q.z();
+    return dx * dx + dy * dy + dz * dz;
+}
+
+// Squared distance and index of a point, ordered by distance first
+using Candidate = std::pair<double, idx_t>;
+
+IndexKDTree::Neighbours sorted( std::vector<Candidate>& candidates ) {
+    std::sort( candidates.begin(), candidates.end() );
+    IndexKDTree::Neighbours neighbours( candidates.size() );
+    for ( size_t j = 0; j < candidates.size(); ++j ) {
+        neighbours[j].index    = candidates[j].second;
+        neighbours[j].distance = std::sqrt( candidates[j].first );
+    }
+    return neighbours;
+}
+
+}  // namespace
+
+IndexKDTree::IndexKDTree( const std::vector<PointXYZ>& points ) :
+    points_( points ),
+    index_( points.size() ),
+    dim_( points.size(), 0 ) {
+    ATLAS_TRACE( "IndexKDTree" );
+    for ( idx_t n = 0; n < size(); ++n ) {
+        index_[n] = n;
+    }
+    build( 0, size() );
+    for ( idx_t n = 0; n < size(); ++n ) {
+        points_[n] = points[index_[n]];
+    }
+}
+
+void IndexKDTree::build( idx_t begin, idx_t end ) {
+    if ( end - begin <= leaf_size ) { return; }
+
+    // Split the dimension of largest extent at the median point, which becomes the node
+    PointXYZ min = points_[index_[begin]];
+    PointXYZ max = min;
+    for ( idx_t i = begin + 1; i < end; ++i ) {
+        const PointXYZ& p = points_[index_[i]];
+        for ( int d = 0; d < 3; ++d ) {
+            min[d] = std::min( min[d], p[d] );
+            max[d] = std::max( max[d], p[d] );
+        }
+    }
+    int dim = 0;
+    for ( int d = 1; d < 3; ++d ) {
+        if ( max[d] - min[d] > max[dim] - min[dim] ) { dim = d; }
+    }
+
+    const idx_t mid = begin + ( end - begin ) / 2;
+    std::nth_element( index_.begin() + begin, index_.begin() + mid, index_.begin() + end,
+                      [this, dim]( idx_t a, idx_t b ) { return points_[a][dim] < points_[b][dim]; } );
+    dim_[mid] = static_cast<unsigned char>( dim );
+
+    build( begin, mid );
+    build( mid + 1, end );
+}
+
+template <typename Visit>
+void IndexKDTree::search( idx_t begin, idx_t end, const PointXYZ& p, Visit& visit ) const {
+    if ( end - begin <= leaf_size ) {
+        for ( idx_t i = begin; i < end; ++i ) {
+            visit( distance2( p, points_[i] ), index_[i] );
+        }
+        return;
+    }
+
+    // Points before mid are not further along dimension dim than the node, points after mid are not before it
+    const idx_t mid   = begin + ( end - begin ) / 2;
+    const int dim     = dim_[mid];
+    const double diff = p[dim] - points_[mid][dim];
+    visit( distance2( p, points_[mid] ), index_[mid] );
+    if ( diff < 0. ) {
+        search( begin, mid, p, visit );
+        if ( diff * diff <= visit.bound() ) { search( mid + 1, end, p, visit ); }
+    }
+    else {
+        search( mid + 1, end, p, visit );
+        if ( diff * diff <= visit.bound() ) { search( begin, mid, p, visit ); }
+    }
+}
+
+IndexKDTree::Neighbour IndexKDTree::closestPoint( const PointXYZ& p ) const {
+    ASSERT( size() > 0 );
+    struct Closest {
+        Candidate best{std::numeric_limits<double>::max(), 0};
+        double bound() const { return best.first; }
+        void operator()( double d2, idx_t n ) {
+            if ( Candidate( d2, n ) < best ) { best = Candidate( d2, n ); }
+        }
+    } closest;
+    search( 0, size(), p, closest );
+    return Neighbour{closest.best.second, std::sqrt( closest.best.first )};
+}
+
+IndexKDTree::Neighbours IndexKDTree::closestPoints( const PointXYZ& p, idx_t k ) const {
+    struct Closest {
+        size_t k;
+        std::priority_queue<Candidate> heap;  // the k closest points so far, furthest on top
+        double bound() const { return heap.size() < k ? std::numeric_limits<double>::max() : heap.top().first; }
+        void operator()( double d2, idx_t n ) {
+            if ( heap.size() < k ) { heap.push( Candidate( d2, n ) ); }
+            else if ( Candidate( d2, n ) < heap.top() ) {
+                heap.pop();
+                heap.push( Candidate( d2, n ) );
+            }
+        }
+    } closest;
+    closest.k = static_cast<size_t>( std::max<idx_t>( k, 0 ) );
+    if ( closest.k ) { search( 0, size(), p, closest ); }
+
+    std::vector<Candidate> candidates;
+    candidates.reserve( closest.heap.size() );
+    while ( not closest.heap.empty() ) {
+        candidates.push_back( closest.heap.top() );
+        closest.heap.pop();
+    }
+    return sorted( candidates );
+}
+
+IndexKDTree::Neighbours IndexKDTree::closestPointsWithinRadius( const PointXYZ& p, double radius ) const {
+    struct Within {
+        double radius2;
+        std::vector<Candidate> candidates;
+        double bound() const { return radius2; }
+        void operator()( double d2, idx_t n ) {
+            if ( d2 <= radius2 ) { candidates.push_back( Candidate( d2, n ) ); }
+        }
+    } within;
+    within.radius2 = radius * radius;
+    if ( radius >= 0. ) { search( 0, size(), p, within ); }
+    return sorted( within.candidates );
+}
+
+}  // namespace util
+}  // namespace atlas
@@ -0,0 +1,68 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "atlas/library/config.h"
+#include "atlas/util/Point.h"
+
+namespace atlas {
+namespace util {
+
+//------------------------------------------------------------------------------------------------------
+
+/// @brief Static kd-tree of points in 3D cartesian coordinates, searched for the points closest to a given point
+///
+/// The tree is built once, balanced, from all points, and stored in arrays without pointers. Searches do not
+/// modify the tree, so that several threads can search it concurrently. Points are identified by their position
+/// in the vector of points the tree is built from. Ties in distance are resolved by the lower index, so that
+/// results do not depend on the shape of the tree.
+class IndexKDTree {
+public:
+    struct Neighbour {
+        idx_t index;
+        double distance;
+    };
+    using Neighbours = std::vector<Neighbour>;
+
+public:
+    IndexKDTree() = default;
+
+    IndexKDTree( const std::vector<PointXYZ>& points );
+
+    idx_t size() const { return static_cast<idx_t>( index_.size() ); }
+
+    /// @brief Closest point to p (the tree must not be empty)
+    Neighbour closestPoint( const PointXYZ& p ) const;
+
+    /// @brief The k closest points to p, or all points if there are fewer, by increasing distance
+    Neighbours closestPoints( const PointXYZ& p, idx_t k ) const;
+
+    /// @brief The points at a distance of at most radius from p, by increasing distance
+    Neighbours closestPointsWithinRadius( const PointXYZ& p, double radius ) const;
+
+private:
+    void build( idx_t begin, idx_t end );
+
+    template <typename Visit>
+    void search( idx_t begin, idx_t end, const PointXYZ& p, Visit& visit ) const;
+
+private:
+    std::vector<PointXYZ> points_;    // points, reordered as nodes of the tree
+    std::vector<idx_t> index_;        // index of the points in the order they were given
+    std::vector<unsigned char> dim_;  // dimension split at each node
+};
+
+//------------------------------------------------------------------------------------------------------
+
+}  // namespace util
+}  // namespace atlas
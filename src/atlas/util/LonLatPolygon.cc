@@ -75,6 +75,39 @@ bool LonLatPolygon::contains( const PointLonLat& P ) const {
     return wn != 0;
 }
 
+void LonLatPolygon::edgesCrossing( double lat, std::vector<idx_t>& edges ) const {
+    edges.clear();
+    for ( size_t i = 1; i < coordinates_.size(); ++i ) {
+        const PointLonLat& A = coordinates_[i - 1];
+        const PointLonLat& B = coordinates_[i];
+        if ( ( A.lat() <= lat && lat < B.lat() ) != ( B.lat() <= lat && lat < A.lat() ) ) { edges.push_back( i ); }
+    }
+}
+
+bool LonLatPolygon::contains( const PointLonLat& P, const std::vector<idx_t>& edges ) const {
+    // check first bounding box
+    if ( coordinatesMax_.lon() <= P.lon() || P.lon() < coordinatesMin_.lon() || coordinatesMax_.lat() <= P.lat() ||
+         P.lat() < coordinatesMin_.lat() ) {
+        return false;
+    }
+
+    // winding number, as in contains( P ), from the edges crossed by the parallel of P
+    int wn = 0;
+    for ( idx_t i : edges ) {
+        const PointLonLat& A = coordinates_[i - 1];
+        const PointLonLat& B = coordinates_[i];
+
+        const double side = cross_product_analog( P, A, B );
+        if ( A.lat() < B.lat() ) {
+            if ( side > 0 ) { ++wn; }
+        }
+        else if ( side < 0 ) {
+            --wn;
+        }
+    }
+    return wn != 0;
+}
+
 //------------------------------------------------------------------------------------------------------
 
 }  // namespace util
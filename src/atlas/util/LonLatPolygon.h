@@ -38,6 +38,23 @@ public:
    * @return if point is in polygon
    */
     bool contains( const PointLonLat& P ) const;
+
+    /*
+   * Polygon edges crossed by the parallel at given latitude, the only edges
+   * contributing to the winding number of points at that latitude
+   * @param[in] lat latitude
+   * @param[out] edges indices i of edges (i-1,i) of the polygon coordinates
+   */
+    void edgesCrossing( double lat, std::vector<idx_t>& edges ) const;
+
+    /*
+   * Point-in-polygon test as contains( P ), only considering the given edges,
+   * which are to be computed by edgesCrossing( P.lat(), edges )
+   * @param[in] P given point
+   * @param[in] edges edges crossed by the parallel of P
+   * @return if point is in polygon
+   */
+    bool contains( const PointLonLat& P, const std::vector<idx_t>& edges ) const;
 };
 
 //------------------------------------------------------------------------------------------------------
@@ -10,8 +10,10 @@
 
 #include "atlas/util/Rotation.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <limits>
 
 #include "atlas/util/Constants.h"
 #include "atlas/util/CoordinateEnums.h"
@@ -233,5 +235,59 @@ void Rotation::unrotate( double crd[] ) const {
     crd[LAT] = L.lat();
 }
 
+namespace {
+
+// Rotation of points given by spherical coordinates in degrees, as a loop without branches or function calls
+// other than to the standard maths library, so that it can be vectorised by the compiler. The conversion back
+// to spherical coordinates conditions y as UnitSphere::convertCartesianToSpherical does, so that longitudes
+// are in the same range (-180,180] as those of the rotation of single points, also on the date line.
+void rotate_spherical( const idx_t n, double lon[], double lat[], const idx_t stride, const RotationMatrix& R,
+                       const double angle_before, const double angle_after ) {
+    const double d2r = Constants::degreesToRadians();
+    const double r2d = Constants::radiansToDegrees();
+    for ( idx_t i = 0; i < n; ++i ) {
+        const double lambda  = ( lon[i * stride] + angle_before ) * d2r;
+        const double sin_phi = std::sin( lat[i * stride] * d2r );
+        const double cos_phi = std::sqrt( 1. - sin_phi * sin_phi );
+
+        const double x = cos_phi * std::cos( lambda );
+        const double y = cos_phi * std::sin( lambda );
+        const double z = sin_phi;
+
+        const double xt = R[XX][XX] * x + R[XX][YY] * y + R[XX][ZZ] * z;
+        const double yt = R[YY][XX] * x + R[YY][YY] * y + R[YY][ZZ] * z;
+        const double zt = R[ZZ][XX] * x + R[ZZ][YY] * y + R[ZZ][ZZ] * z;
+
+        const double yc = std::abs( yt ) <= std::numeric_limits<double>::epsilon() ? 0. : yt;
+
+        lon[i * stride] = std::atan2( yc, xt ) * r2d - angle_after;
+        lat[i * stride] = std::asin( std::min( 1., std::max( -1., zt ) ) ) * r2d;
+    }
+}
+
+}  // namespace
+
+void Rotation::rotate( const idx_t n, double lon[], double lat[], const idx_t stride ) const {
+    if ( !rotated_ ) { return; }
+    else if ( rotation_angle_only_ ) {
+        for ( idx_t i = 0; i < n; ++i ) {
+            lon[i * stride] -= angle_;
+        }
+        return;
+    }
+    rotate_spherical( n, lon, lat, stride, rotate_, 0., angle_ );
+}
+
+void Rotation::unrotate( const idx_t n, double lon[], double lat[], const idx_t stride ) const {
+    if ( !rotated_ ) { return; }
+    else if ( rotation_angle_only_ ) {
+        for ( idx_t i = 0; i < n; ++i ) {
+            lon[i * stride] += angle_;
+        }
+        return;
+    }
+    rotate_spherical( n, lon, lat, stride, unrotate_, angle_, 0. );
+}
+
 }  // namespace util
 }  // namespace atlas
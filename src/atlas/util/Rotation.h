@@ -13,6 +13,7 @@
 #include <array>
 #include <iosfwd>
 
+#include "atlas/library/config.h"
 #include "atlas/util/Point.h"
 
 namespace eckit {
@@ -40,6 +41,12 @@ public:
     void rotate( double crd[] ) const;
     void unrotate( double crd[] ) const;
 
+    /// @brief Rotate n points in place, with coordinates of point i in lon[i*stride] and lat[i*stride]
+    void rotate( const idx_t n, double lon[], double lat[], const idx_t stride = 1 ) const;
+
+    /// @brief Unrotate n points in place, with coordinates of point i in lon[i*stride] and lat[i*stride]
+    void unrotate( const idx_t n, double lon[], double lat[], const idx_t stride = 1 ) const;
+
 private:
     void precompute();
 
@@ -62,6 +62,12 @@ public:
         }
     }
 
+    void clear() {
+        std::lock_guard<std::mutex> guard( lock_ );
+        map_.clear();
+        Log::debug() << "Cleared cache \"" << name_ << "\"." << std::endl;
+    }
+
 private:
     std::string name_;
     std::mutex lock_;
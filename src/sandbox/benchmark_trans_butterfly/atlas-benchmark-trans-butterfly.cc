@@ -0,0 +1,136 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "atlas/grid.h"
+#include "atlas/parallel/omp/omp.h"
+#include "atlas/runtime/AtlasTool.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/runtime/Trace.h"
+#include "atlas/trans/Trans.h"
+#include "atlas/util/Config.h"
+
+//------------------------------------------------------------------------------
+
+using namespace atlas;
+
+//------------------------------------------------------------------------------
+
+class Tool : public AtlasTool {
+    virtual void execute( const Args& args );
+    virtual std::string briefDescription() {
+        return "Tool to compare the cost and accuracy of butterfly compressed Legendre transforms "
+               "with dense ones";
+    }
+    virtual std::string usage() { return name() + " [--grid=name] [--truncation=T] [OPTION]... [--help]"; }
+
+public:
+    Tool( int argc, char** argv );
+};
+
+//-----------------------------------------------------------------------------
+
+Tool::Tool( int argc, char** argv ) : AtlasTool( argc, argv ) {
+    add_option( new SimpleOption<std::string>( "grid", "Grid unique identifier (default=O256)\n" + indent() +
+                                                           "     Example values: N80, F40, O24, L32" ) );
+    add_option( new SimpleOption<long>( "truncation", "Spectral truncation (default=255)" ) );
+    add_option( new SimpleOption<long>( "fields", "Number of scalar fields (default=3)" ) );
+    add_option( new SimpleOption<double>( "tolerance", "Tolerance of the butterfly compression (default=1.e-8)" ) );
+    add_option( new SimpleOption<long>( "leaf_size", "Leaf size of the butterfly compression (default=32)" ) );
+}
+
+//-----------------------------------------------------------------------------
+
+namespace {
+
+double max_relative_difference( const std::vector<double>& reference, const std::vector<double>& values ) {
+    double max_ref = 0., max_diff = 0.;
+    for ( size_t j = 0; j < reference.size(); ++j ) {
+        max_ref  = std::max( max_ref, std::abs( reference[j] ) );
+        max_diff = std::max( max_diff, std::abs( reference[j] - values[j] ) );
+    }
+    return max_diff / max_ref;
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
+void Tool::execute( const Args& args ) {
+    Trace timer( Here(), displayName() );
+
+    std::string key = "O256";
+    args.get( "grid", key );
+    const int trc       = args.getLong( "truncation", 255 );
+    const int nb_scalar = args.getLong( "fields", 3 );
+    const double tol    = args.getDouble( "tolerance", 1.e-8 );
+    const int leaf_size = args.getLong( "leaf_size", 32 );
+
+    Grid grid( key );
+
+    Log::info() << "Configuration" << std::endl;
+    Log::info() << "~~~~~~~~~~~~~" << std::endl;
+    Log::info() << "  Grid       : " << grid.name() << std::endl;
+    Log::info() << "  Truncation : " << trc << std::endl;
+    Log::info() << "  Fields     : " << nb_scalar << std::endl;
+    Log::info() << "  Tolerance  : " << tol << std::endl;
+    Log::info() << "  Leaf size  : " << leaf_size << std::endl;
+    Log::info() << "  OpenMP     : " << atlas_omp_get_max_threads() << std::endl;
+
+    util::Config config    = util::Config( "type", "local" );
+    util::Config butterfly = config | util::Config( "legendre_method", "butterfly" ) |
+                             util::Config( "butterfly_tolerance", tol ) |
+                             util::Config( "butterfly_leaf_size", leaf_size );
+
+    trans::Trans trans_dense, trans_butterfly;
+    ATLAS_TRACE_SCOPE( "setup dense" ) trans_dense = trans::Trans( grid, trc, config );
+    ATLAS_TRACE_SCOPE( "setup butterfly" ) trans_butterfly = trans::Trans( grid, trc, butterfly );
+
+    const int N = ( trc + 2 ) * ( trc + 1 ) / 2;
+    std::vector<double> sp( 2 * N * nb_scalar );
+    int k = 0;
+    for ( int m = 0; m <= trc; m++ ) {
+        for ( int n = m; n <= trc; n++ ) {
+            for ( int imag = 0; imag <= 1; imag++ ) {
+                for ( int jfld = 0; jfld < nb_scalar; jfld++ ) {
+                    sp[k * nb_scalar + jfld] = ( m == 0 && imag == 1 ) ? 0. : 1. / ( 1. + n + m + imag + jfld );
+                }
+                k++;
+            }
+        }
+    }
+
+    std::vector<double> gp_dense( nb_scalar * grid.size() ), gp_butterfly( nb_scalar * grid.size() );
+    ATLAS_TRACE_SCOPE( "invtrans dense" ) trans_dense.invtrans( nb_scalar, sp.data(), gp_dense.data() );
+    ATLAS_TRACE_SCOPE( "invtrans butterfly" ) trans_butterfly.invtrans( nb_scalar, sp.data(), gp_butterfly.data() );
+
+    std::vector<double> sp_dense( sp.size() ), sp_butterfly( sp.size() );
+    ATLAS_TRACE_SCOPE( "dirtrans dense" ) trans_dense.dirtrans( nb_scalar, gp_dense.data(), sp_dense.data() );
+    ATLAS_TRACE_SCOPE( "dirtrans butterfly" )
+    trans_butterfly.dirtrans( nb_scalar, gp_dense.data(), sp_butterfly.data() );
+
+    Log::info() << "Maximum relative difference with the dense transforms" << std::endl;
+    Log::info() << "  invtrans : " << max_relative_difference( gp_dense, gp_butterfly ) << std::endl;
+    Log::info() << "  dirtrans : " << max_relative_difference( sp_dense, sp_butterfly ) << std::endl;
+
+    timer.stop();
+    Log::info() << Trace::report() << std::endl;
+}
+
+//------------------------------------------------------------------------------
+
+int main( int argc, char** argv ) {
+    Tool tool( argc, argv );
+    return tool.start();
+}
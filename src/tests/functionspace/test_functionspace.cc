@@ -8,6 +8,9 @@
  * nor does it submit to any jurisdiction.
  */
 
+#include <cmath>
+#include <functional>
+
 #include "eckit/memory/ScopedPtr.h"
 #include "eckit/types/Types.h"
 
@@ -24,6 +27,7 @@
 #include "atlas/meshgenerator/StructuredMeshGenerator.h"
 #include "atlas/parallel/mpi/mpi.h"
 #include "atlas/trans/Trans.h"
+#include "atlas/util/Earth.h"
 
 #include "tests/AtlasTestEnvironment.h"
 
@@ -501,6 +505,76 @@ CASE( "test_SpectralFunctionSpace" ) {
     EXPECT( columns_scalar.shape( 1 ) == nb_levels );
 }
 
+CASE( "test_SpectralFunctionSpace_operators" ) {
+    int truncation  = 31;
+    idx_t nb_levels = 3;
+    double radius   = util::Earth::radius();
+
+    Spectral spectral_fs( truncation );
+    idx_t nb_coeff = spectral_fs.nb_spectral_coefficients();
+
+    // total wavenumber of each coefficient
+    std::vector<int> n;
+    for ( int m = 0; m <= truncation; ++m ) {
+        for ( int jn = m; jn <= truncation; ++jn ) {
+            n.push_back( jn );
+            n.push_back( jn );
+        }
+    }
+    EXPECT( idx_t( n.size() ) == nb_coeff );
+
+    Field f_field   = spectral_fs.createField<double>( option::name( "f" ) | option::levels( nb_levels ) );
+    Field out_field = spectral_fs.createField<double>( option::name( "out" ) | option::levels( nb_levels ) );
+    auto f          = array::make_view<double, 2>( f_field );
+    auto out        = array::make_view<double, 2>( out_field );
+    for ( idx_t k = 0; k < nb_coeff; ++k ) {
+        for ( idx_t jlev = 0; jlev < nb_levels; ++jlev ) {
+            f( k, jlev ) = 1. + k + jlev;
+        }
+    }
+
+    auto check = [&]( std::function<double( int )> factor ) {
+        for ( idx_t k = 0; k < nb_coeff; ++k ) {
+            for ( idx_t jlev = 0; jlev < nb_levels; ++jlev ) {
+                EXPECT( eckit::types::is_approximately_equal( out( k, jlev ), factor( n[k] ) * f( k, jlev ),
+                                                              1.e-12 * std::abs( f( k, jlev ) ) ) );
+            }
+        }
+    };
+
+    spectral_fs.laplacian( f_field, out_field );
+    check( [&]( int jn ) { return -jn * ( jn + 1. ) / ( radius * radius ); } );
+
+    // inverse of the Laplacian, in place
+    spectral_fs.inverse_laplacian( out_field, out_field );
+    check( []( int jn ) { return jn == 0 ? 0. : 1.; } );
+
+    double coefficient = 1.e20;
+    spectral_fs.horizontal_diffusion( f_field, out_field, coefficient );
+    check( [&]( int jn ) {
+        const double laplacian = jn * ( jn + 1. ) / ( radius * radius );
+        return 1. / ( 1. + coefficient * laplacian * laplacian );
+    } );
+
+    spectral_fs.truncate( f_field, out_field, 10 );
+    check( []( int jn ) { return jn <= 10 ? 1. : 0.; } );
+
+    std::vector<double> factors( truncation + 1 );
+    for ( int jn = 0; jn <= truncation; ++jn ) {
+        factors[jn] = 0.5 * jn;
+    }
+    FieldSet in_fields, out_fields;
+    in_fields.add( f_field );
+    out_fields.add( out_field );
+    spectral_fs.filter( in_fields, out_fields, factors );
+    check( []( int jn ) { return 0.5 * jn; } );
+
+    // fields must match the truncation
+    Spectral other_fs( truncation - 1 );
+    Field other_field = other_fs.createField<double>( option::name( "other" ) | option::levels( nb_levels ) );
+    EXPECT_THROWS( spectral_fs.laplacian( other_field, other_field ) );
+}
+
 #if ATLAS_HAVE_TRANS
 
 CASE( "test_SpectralFunctionSpace_trans_dist" ) {
@@ -9,7 +9,9 @@
  */
 
 #include <algorithm>
+#include <cmath>
 #include <iomanip>
+#include <random>
 #include <sstream>
 
 #include "eckit/memory/Builder.h"
@@ -18,9 +20,13 @@
 
 #include "atlas/grid.h"
 #include "atlas/grid/Grid.h"
+#include "atlas/grid/detail/grid/GridCache.h"
 #include "atlas/library/Library.h"
 #include "atlas/parallel/mpi/mpi.h"
+#include "atlas/projection/Projection.h"
 #include "atlas/util/Config.h"
+#include "atlas/util/Constants.h"
+#include "atlas/util/UnitSphere.h"
 
 #include "tests/AtlasTestEnvironment.h"
 
@@ -202,6 +208,254 @@ CASE( "Create unstructured from unstructured" ) {
     EXPECT( ugrid.size() == StructuredGrid( agrid, domain ).size() );
 }
 
+CASE( "test_grid_cache" ) {
+    // The cache is tested directly, without changing the setting of Library::gridCache()
+    grid::GridCache& cache = grid::GridCache::instance();
+    cache.clear();
+
+    int created  = 0;
+    auto creator = [&]( const std::string& name, const Grid::Config& config ) {
+        return [&created, name, config]() {
+            ++created;
+            return Grid::Implementation::create( name, config );
+        };
+    };
+
+    Grid::Config global, regional;
+    regional.set( "domain", RectangularDomain( {-10., 50.}, {20., 60.} ).spec() );
+
+    Grid grid1( cache.get_or_create( "O32", global, creator( "O32", global ) ).get() );
+    Grid grid2( cache.get_or_create( "O32", global, creator( "O32", global ) ).get() );
+    EXPECT( created == 1 );
+    EXPECT( grid1.get() == grid2.get() );
+
+    Grid grid3( cache.get_or_create( "O32", regional, creator( "O32", regional ) ).get() );
+    Grid grid4( cache.get_or_create( "O32", regional, creator( "O32", regional ) ).get() );
+    EXPECT( created == 2 );
+    EXPECT( grid3.get() != grid1.get() );
+    EXPECT( grid3.get() == grid4.get() );
+
+    // grids remain valid after they are released by the cache
+    cache.clear();
+    Grid grid5( cache.get_or_create( "O32", global, creator( "O32", global ) ).get() );
+    EXPECT( created == 3 );
+    EXPECT( grid5.get() != grid1.get() );
+    EXPECT( grid5 == grid1 );
+    EXPECT( grid1.size() == StructuredGrid( "O32" ).size() );
+
+    cache.clear();
+}
+
+CASE( "test_structured_rows" ) {
+    for ( StructuredGrid grid : {StructuredGrid( "O16" ), StructuredGrid( "L8" ),
+                                 StructuredGrid( "O16", RectangularDomain( {-10., 50.}, {20., 60.} ) )} ) {
+        std::vector<PointXY> xy;
+        for ( PointXY p : grid.xy() ) {
+            xy.push_back( p );
+        }
+        EXPECT( idx_t( xy.size() ) == grid.size() );
+
+        idx_t n = 0;
+        grid.for_each_row( [&]( const StructuredGrid::Row& row ) {
+            EXPECT( row.i_begin == 0 );
+            EXPECT( row.i_end == grid.nx( row.j ) );
+            EXPECT( row.n == n );
+            EXPECT( grid.index( 0, row.j ) == n );
+            for ( idx_t i = row.i_begin; i < row.i_end; ++i, ++n ) {
+                EXPECT( row.x( i ) == xy[n].x() );
+                EXPECT( row.y == xy[n].y() );
+            }
+        } );
+        EXPECT( n == grid.size() );
+
+        std::vector<idx_t> visited( grid.size(), 0 );
+        grid.parallel_for_each_row( [&]( const StructuredGrid::Row& row ) {
+            for ( idx_t i = row.i_begin, n = row.n; i < row.i_end; ++i, ++n ) {
+                visited[n] += 1;
+            }
+        } );
+        EXPECT( idx_t( std::count( visited.begin(), visited.end(), 1 ) ) == grid.size() );
+
+        // Blocks of rows for a range of points
+        const idx_t n_begin = grid.size() / 3 + 1;
+        const idx_t n_end   = 2 * grid.size() / 3;
+        n                   = n_begin;
+        grid.for_each_row( n_begin, n_end, [&]( const StructuredGrid::Row& row ) {
+            EXPECT( row.n == n );
+            EXPECT( row.size() > 0 );
+            for ( idx_t i = row.i_begin; i < row.i_end; ++i, ++n ) {
+                EXPECT( row.x( i ) == xy[n].x() );
+                EXPECT( row.y == xy[n].y() );
+            }
+        } );
+        EXPECT( n == n_end );
+    }
+}
+
+CASE( "test_projection_bulk" ) {
+    auto rotated = []( util::Config config ) {
+        config.set( "north_pole", std::vector<double>{-176., 40.} );
+        return config;
+    };
+    std::vector<util::Config> configs{
+        util::Config( "type", "lonlat" ),
+        rotated( util::Config( "type", "rotated_lonlat" ) ),
+        util::Config( "type", "rotated_lonlat" ) | util::Config( "rotation_angle", 30. ),
+        util::Config( "type", "lambert" ) | util::Config( "latitude1", 45. ) | util::Config( "longitude0", 5. ),
+        util::Config( "type", "mercator" ) | util::Config( "longitude0", -10. ),
+        rotated( util::Config( "type", "rotated_mercator" ) ),
+        util::Config( "type", "schmidt" ) | util::Config( "stretching_factor", 2.4 ),
+        rotated( util::Config( "type", "rotated_schmidt" ) | util::Config( "stretching_factor", 2.4 ) )};
+
+    // Points with interleaved coordinates
+    std::vector<double> lonlat;
+    for ( double lat = 20.; lat <= 70.; lat += 2.5 ) {
+        for ( double lon = -40.; lon <= 50.; lon += 3. ) {
+            lonlat.push_back( lon );
+            lonlat.push_back( lat );
+        }
+    }
+    const idx_t n = lonlat.size() / 2;
+
+    for ( auto& config : configs ) {
+        Projection projection( config );
+        Log::info() << projection.type() << std::endl;
+        const double tolerance = projection.units() == "meters" ? 1.e-6 : 1.e-9;
+
+        std::vector<double> xy( 2 * n );
+        projection.lonlat2xy( n, lonlat.data(), lonlat.data() + 1, xy.data(), xy.data() + 1, 2 );
+
+        std::vector<double> lonlat_bulk( xy );
+        projection.xy2lonlat( n, lonlat_bulk.data(), lonlat_bulk.data() + 1, lonlat_bulk.data(),
+                              lonlat_bulk.data() + 1, 2 );
+
+        for ( idx_t i = 0; i < n; ++i ) {
+            double crd[] = {lonlat[2 * i], lonlat[2 * i + 1]};
+            projection.lonlat2xy( crd );
+            EXPECT( eckit::types::is_approximately_equal( xy[2 * i], crd[0], tolerance ) );
+            EXPECT( eckit::types::is_approximately_equal( xy[2 * i + 1], crd[1], tolerance ) );
+
+            projection.xy2lonlat( crd );
+            EXPECT( eckit::types::is_approximately_equal( lonlat_bulk[2 * i], crd[0], 1.e-9 ) );
+            EXPECT( eckit::types::is_approximately_equal( lonlat_bulk[2 * i + 1], crd[1], 1.e-9 ) );
+
+            // round trip
+            EXPECT( eckit::types::is_approximately_equal( lonlat_bulk[2 * i], lonlat[2 * i], 1.e-9 ) );
+            EXPECT( eckit::types::is_approximately_equal( lonlat_bulk[2 * i + 1], lonlat[2 * i + 1], 1.e-9 ) );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+CASE( "test_partition_runs" ) {
+    // The runs of the structured partitioners should give the partition of every point
+    for ( std::string type : {"checkerboard", "equal_regions"} ) {
+        for ( int N : {1, 3, 4, 7} ) {
+            Log::info() << type << " partitioner, " << N << " partitions" << std::endl;
+            StructuredGrid grid( "F16" );
+            grid::Partitioner partitioner( type, N );
+
+            std::vector<gidx_t> run_end;
+            std::vector<int> run_part;
+            EXPECT( partitioner.partition_runs( grid, run_end, run_part ) );
+
+            std::vector<int> part( grid.size() );
+            partitioner.partition( grid, part.data() );
+            gidx_t begin = 0;
+            for ( size_t r = 0; r < run_end.size(); ++r ) {
+                EXPECT( run_end[r] > begin );
+                for ( gidx_t n = begin; n < run_end[r]; ++n ) {
+                    EXPECT( part[n] == run_part[r] );
+                }
+                begin = run_end[r];
+            }
+            EXPECT( begin == grid.size() );
+        }
+    }
+}
+
+CASE( "test_distribution_runs" ) {
+    StructuredGrid grid( "F32" );
+    grid::Distribution distribution( grid, grid::Partitioner( "checkerboard", 4 ) );
+
+    EXPECT( distribution.size() == grid.size() );
+
+    std::vector<idx_t> nb_pts( distribution.nb_partitions(), 0 );
+    gidx_t end = 0;
+    distribution.for_each_run( [&]( gidx_t begin, gidx_t run_end, int part ) {
+        EXPECT( begin == end );
+        EXPECT( run_end > begin );
+        for ( gidx_t n = begin; n < run_end; ++n ) {
+            EXPECT( distribution.partition( n ) == part );
+        }
+        nb_pts[part] += run_end - begin;
+        end = run_end;
+    } );
+    EXPECT( end == grid.size() );
+    EXPECT( nb_pts == distribution.nb_pts() );
+
+    const std::vector<int>& part = distribution.partition();
+    EXPECT( idx_t( part.size() ) == grid.size() );
+    for ( idx_t n = 0; n < grid.size(); ++n ) {
+        EXPECT( part[n] == distribution.partition( n ) );
+    }
+}
+
+CASE( "test_unstructured_grid_index" ) {
+    std::mt19937 random( 1 );
+    std::uniform_real_distribution<double> lon( 0., 360. );
+    std::uniform_real_distribution<double> lat( -90., 90. );
+
+    std::vector<PointXY> points( 2000 );
+    for ( auto& p : points ) {
+        p = PointXY( lon( random ), lat( random ) );
+    }
+    UnstructuredGrid grid( std::vector<PointXY>( points ) );
+
+    const idx_t n = 100;
+    std::vector<PointLonLat> targets( n );
+    for ( auto& p : targets ) {
+        p = PointLonLat( lon( random ), lat( random ) );
+    }
+
+    const idx_t k = 5;
+    std::vector<idx_t> closest( n );
+    std::vector<idx_t> k_closest( n * k );
+    std::vector<std::vector<idx_t>> within;
+    grid.closestPoint( n, targets.data(), closest.data() );
+    grid.closestPoints( n, targets.data(), k, k_closest.data() );
+    grid.closestPointsWithinRadius( n, targets.data(), 5., within );
+    EXPECT( grid.index().size() == grid.size() );
+
+    // Compare with a search through all points
+    auto distance2 = []( const PointLonLat& a, const PointLonLat& b ) {
+        PointXYZ p;
+        PointXYZ q;
+        util::UnitSphere::convertSphericalToCartesian( a, p );
+        util::UnitSphere::convertSphericalToCartesian( b, q );
+        return ( p.x() - q.x() ) * ( p.x() - q.x() ) + ( p.y() - q.y() ) * ( p.y() - q.y() ) +
+               ( p.z() - q.z() ) * ( p.z() - q.z() );
+    };
+    const double chord = 2. * std::sin( 0.5 * 5. * util::Constants::degreesToRadians() );
+    for ( idx_t j = 0; j < n; ++j ) {
+        std::vector<std::pair<double, idx_t>> distance;
+        for ( idx_t i = 0; i < grid.size(); ++i ) {
+            distance.emplace_back( distance2( targets[j], PointLonLat( points[i].x(), points[i].y() ) ), i );
+        }
+        std::sort( distance.begin(), distance.end() );
+        EXPECT( closest[j] == distance[0].second );
+        for ( idx_t i = 0; i < k; ++i ) {
+            EXPECT( k_closest[j * k + i] == distance[i].second );
+        }
+        size_t nb_within = 0;
+        while ( distance[nb_within].first <= chord * chord ) {
+            EXPECT( within[j][nb_within] == distance[nb_within].second );
+            ++nb_within;
+        }
+        EXPECT( within[j].size() == nb_within );
+    }
+}
 
 //-----------------------------------------------------------------------------
 
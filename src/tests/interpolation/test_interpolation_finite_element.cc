@@ -79,6 +79,95 @@ CASE( "test_interpolation_finite_element" ) {
 
 //-----------------------------------------------------------------------------
 
+CASE( "test_interpolation_finite_element_adjoint" ) {
+    Grid grid( "O32" );
+    MeshGenerator meshgen( "structured" );
+    Mesh mesh = meshgen.generate( grid );
+    NodeColumns fs( mesh );
+
+    PointCloud pointcloud( {{05., 5.}, {15., -25.}, {125., 45.}, {200., -60.}, {359., 80.}, {270., 0.}} );
+
+    Interpolation interpolation( option::type( "finite-element" ) | Config( "adjoint", true ), fs, pointcloud );
+
+    Field field_source = fs.createField<double>( option::name( "source" ) );
+    Field field_target( "target", array::make_datatype<double>(), array::make_shape( pointcloud.size() ) );
+    Field field_source_ad = fs.createField<double>( option::name( "source_ad" ) );
+    Field field_target_ad( "target_ad", array::make_datatype<double>(), array::make_shape( pointcloud.size() ) );
+
+    auto lonlat = array::make_view<double, 2>( fs.nodes().lonlat() );
+    auto source = array::make_view<double, 1>( field_source );
+    for ( idx_t j = 0; j < fs.nodes().size(); ++j ) {
+        source( j ) = std::cos( lonlat( j, LON ) * M_PI / 180. ) * std::sin( lonlat( j, LAT ) * M_PI / 90. ) + 2.;
+    }
+    field_source.set_dirty();
+
+    auto target_ad = array::make_view<double, 1>( field_target_ad );
+    for ( idx_t j = 0; j < pointcloud.size(); ++j ) {
+        target_ad( j ) = 1. + 0.5 * j;
+    }
+
+    interpolation.execute( field_source, field_target );
+    interpolation.execute_adjoint( field_source_ad, field_target_ad );
+
+    // dot-product test: < A x, y > == < x, A^T y >
+    auto target    = array::make_view<double, 1>( field_target );
+    auto source_ad = array::make_view<double, 1>( field_source_ad );
+    auto ghost     = array::make_view<int, 1>( fs.nodes().ghost() );
+
+    double lhs = 0.;
+    for ( idx_t j = 0; j < pointcloud.size(); ++j ) {
+        lhs += target( j ) * target_ad( j );
+    }
+    double rhs = 0.;
+    for ( idx_t j = 0; j < fs.nodes().size(); ++j ) {
+        if ( ghost( j ) ) {
+            EXPECT( source_ad( j ) == 0. );
+            continue;
+        }
+        rhs += source( j ) * source_ad( j );
+    }
+    Log::info() << "< A x, y > = " << lhs << "    < x, A^T y > = " << rhs << std::endl;
+    EXPECT( eckit::types::is_approximately_equal( lhs, rhs, 1.e-10 ) );
+}
+
+//-----------------------------------------------------------------------------
+
+CASE( "test_interpolation_finite_element_update_target" ) {
+    Grid grid( "O32" );
+    MeshGenerator meshgen( "structured" );
+    Mesh mesh = meshgen.generate( grid );
+    NodeColumns fs( mesh );
+
+    PointCloud pointcloud_1( {{00., 0.}, {10., 10.}, {20., 20.}, {30., 30.}} );
+    PointCloud pointcloud_2( {{01., 1.}, {11., 11.}, {21., 21.}, {31., 31.}, {41., 41.}} );
+
+    Field field_source = fs.createField<double>( option::name( "source" ) );
+    auto lonlat        = array::make_view<double, 2>( fs.nodes().lonlat() );
+    auto source        = array::make_view<double, 1>( field_source );
+    for ( idx_t j = 0; j < fs.nodes().size(); ++j ) {
+        source( j ) = std::sin( lonlat( j, LON ) * M_PI / 180. ) * std::cos( lonlat( j, LAT ) * M_PI / 180. );
+    }
+
+    Interpolation moving( option::type( "finite-element" ), fs, pointcloud_1 );
+    moving.updateTarget( pointcloud_2 );
+    EXPECT( moving.target().size() == pointcloud_2.size() );
+
+    Interpolation reference( option::type( "finite-element" ), fs, pointcloud_2 );
+
+    Field field_moving( "moving", array::make_datatype<double>(), array::make_shape( pointcloud_2.size() ) );
+    Field field_reference( "reference", array::make_datatype<double>(), array::make_shape( pointcloud_2.size() ) );
+    moving.execute( field_source, field_moving );
+    reference.execute( field_source, field_reference );
+
+    auto v_moving    = array::make_view<double, 1>( field_moving );
+    auto v_reference = array::make_view<double, 1>( field_reference );
+    for ( idx_t j = 0; j < pointcloud_2.size(); ++j ) {
+        EXPECT( v_moving( j ) == v_reference( j ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 }  // namespace test
 }  // namespace atlas
 
@@ -0,0 +1,101 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "atlas/grid.h"
+#include "atlas/library/Library.h"
+#include "atlas/mesh/Mesh.h"
+#include "atlas/mesh/Nodes.h"
+#include "atlas/meshgenerator/StructuredMeshGenerator.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/runtime/Log.h"
+#include "atlas/util/Config.h"
+#include "atlas/util/LonLatPolygon.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+// Partition of every grid point found by testing each point against the polygon of the local part of the mesh,
+// and resolving points found by several tasks to the highest rank
+std::vector<int> partition_point_by_point( const Mesh& mesh, const Grid& grid ) {
+    const int mpi_rank = int( mpi::comm().rank() );
+    const int mpi_size = int( mpi::comm().size() );
+
+    const bool includesNorthPole = ( mpi_rank == 0 );
+    const bool includesSouthPole = ( mpi_rank == mpi_size - 1 );
+
+    const util::LonLatPolygon poly( mesh.polygon( 0 ), mesh.nodes().lonlat() );
+
+    std::vector<int> partitioning( grid.size() );
+    size_t i = 0;
+    for ( const PointXY Pxy : grid.xy() ) {
+        const PointLonLat P  = grid.projection().lonlat( Pxy );
+        const bool atThePole = ( includesNorthPole && P.lat() >= poly.coordinatesMax().lat() ) ||
+                               ( includesSouthPole && P.lat() < poly.coordinatesMin().lat() );
+        partitioning[i++]    = atThePole || poly.contains( P ) ? mpi_rank : -1;
+    }
+    mpi::comm().allReduceInPlace( partitioning.data(), partitioning.size(), eckit::mpi::max() );
+    return partitioning;
+}
+
+void check_matching_partition( const Mesh& mesh, const Grid& grid ) {
+    grid::MatchingMeshPartitioner partitioner( mesh, util::Config( "type", "lonlat-polygon" ) );
+    grid::Distribution distribution( grid, partitioner );
+
+    const std::vector<int> expected = partition_point_by_point( mesh, grid );
+    EXPECT( distribution.nb_partitions() == idx_t( mpi::comm().size() ) );
+    for ( idx_t n = 0; n < grid.size(); ++n ) {
+        EXPECT( expected[n] >= 0 );
+        EXPECT( distribution.partition( n ) == expected[n] );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+CASE( "test_lonlat_polygon_partitioner" ) {
+    meshgenerator::StructuredMeshGenerator generate( util::Config( "partitioner", "equal_regions" ) );
+    Mesh mesh = generate( Grid( "O32" ) );
+
+    SECTION( "StructuredGrid" ) {
+        for ( std::string name : {"L48x25", "O24"} ) {
+            Log::info() << "Partitioning " << name << " matching O32 on " << mpi::comm().size() << " tasks"
+                        << std::endl;
+            check_matching_partition( mesh, Grid( name ) );
+        }
+    }
+
+    SECTION( "UnstructuredGrid" ) {
+        // Points scattered along parallels from pole to pole, including the equator
+        std::vector<PointXY> points;
+        for ( int j = 0; j <= 24; ++j ) {
+            for ( int i = 0; i < 24; ++i ) {
+                points.emplace_back( std::fmod( 13.7 * ( i + 24 * j ), 360. ), 90. - 7.5 * j );
+            }
+        }
+        check_matching_partition( mesh, UnstructuredGrid( std::move( points ) ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main( int argc, char** argv ) {
+    return atlas::test::run( argc, argv );
+}
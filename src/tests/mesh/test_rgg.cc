@@ -19,6 +19,8 @@
 #include "atlas/field/Field.h"
 #include "atlas/grid.h"
 #include "atlas/grid/detail/partitioner/EqualRegionsPartitioner.h"
+#include "atlas/grid/detail/partitioner/SpaceFillingCurvePartitioner.h"
+#include "atlas/grid/detail/pl/classic_gaussian/PointsPerLatitude.h"
 #include "atlas/grid/detail/spacing/gaussian/Latitudes.h"
 #include "atlas/library/Library.h"
 #include "atlas/library/config.h"
@@ -173,12 +175,111 @@ CASE( "test_partitioner" ) {
     }
 }
 
+CASE( "test_partitioner_runs" ) {
+    // Points of a StructuredGrid are partitioned row by row, without sorting. The result is the same as for
+    // the same points in an UnstructuredGrid, which are sorted.
+    grid::StructuredGrid structured( "O32" );
+    std::vector<PointXY> points;
+    for ( PointXY p : structured.xy() ) {
+        points.push_back( p );
+    }
+    grid::UnstructuredGrid unstructured( std::move( points ) );
+
+    for ( int N : {1, 7, 20, 96} ) {
+        grid::detail::partitioner::EqualRegionsPartitioner partitioner( N );
+
+        std::vector<int> part_structured( structured.size() );
+        std::vector<int> part_unstructured( unstructured.size() );
+        partitioner.partition( structured, part_structured.data() );
+        partitioner.partition( unstructured, part_unstructured.data() );
+        EXPECT( part_structured == part_unstructured );
+
+        std::vector<gidx_t> run_end;
+        std::vector<int> run_part;
+        EXPECT( partitioner.partition_runs( structured, run_end, run_part ) );
+        EXPECT( not partitioner.partition_runs( unstructured, run_end, run_part ) );
+
+        grid::Distribution distribution( structured, grid::Partitioner( "equal_regions", N ) );
+        for ( idx_t n = 0; n < structured.size(); ++n ) {
+            EXPECT( distribution.partition( n ) == part_structured[n] );
+        }
+    }
+}
+
+CASE( "test_space_filling_curve_partitioner" ) {
+    using grid::detail::partitioner::SpaceFillingCurvePartitioner;
+    EXPECT( grid::detail::partitioner::PartitionerFactory::has( "space_filling_curve" ) );
+
+    // Consecutive cells along the curve are neighbours
+    const double d = 2. / ( ( 1 << 21 ) - 1 );
+    EXPECT( SpaceFillingCurvePartitioner::hilbert( PointXYZ( -1., -1., -1. ) ) == 0 );
+    EXPECT( SpaceFillingCurvePartitioner::hilbert( PointXYZ( -1., -1., -1. + d ) ) == 1 ||
+            SpaceFillingCurvePartitioner::hilbert( PointXYZ( -1., -1. + d, -1. ) ) == 1 ||
+            SpaceFillingCurvePartitioner::hilbert( PointXYZ( -1. + d, -1., -1. ) ) == 1 );
+
+    grid::StructuredGrid structured( "O32" );
+    std::vector<PointXY> points;
+    for ( PointXY p : structured.xy() ) {
+        points.push_back( p );
+    }
+    grid::UnstructuredGrid unstructured( std::move( points ) );
+
+    for ( Grid grid : {Grid( structured ), Grid( unstructured )} ) {
+        for ( int N : {1, 7, 20} ) {
+            grid::Distribution distribution( grid, grid::Partitioner( "space_filling_curve", N ) );
+            EXPECT( distribution.nb_partitions() == N );
+            EXPECT( distribution.max_pts() - distribution.min_pts() <= 1 );
+        }
+    }
+}
+
+CASE( "test_weighted_partitioners" ) {
+    grid::StructuredGrid grid( "O32" );
+
+    // Points of the northern hemisphere cost ten times more
+    Field weights( "weights", array::make_datatype<double>(), array::make_shape( grid.size() ) );
+    auto w       = array::make_view<double, 1>( weights );
+    idx_t n      = 0;
+    double total = 0.;
+    for ( PointXY p : grid.xy() ) {
+        w( n ) = p.y() > 0. ? 10. : 1.;
+        total += w( n++ );
+    }
+
+    auto max_cost = [&]( const grid::Distribution& distribution ) {
+        std::vector<double> cost( distribution.nb_partitions(), 0. );
+        for ( idx_t j = 0; j < grid.size(); ++j ) {
+            cost[distribution.partition( j )] += w( j );
+        }
+        return *std::max_element( cost.begin(), cost.end() );
+    };
+
+    for ( std::string type : {"equal_regions", "space_filling_curve"} ) {
+        for ( int N : {7, 20} ) {
+            grid::Distribution weighted( grid, grid::Partitioner( type, N, weights ) );
+            grid::Distribution unweighted( grid, grid::Partitioner( type, N ) );
+            Log::info() << type << " N=" << N << ": max cost " << max_cost( weighted ) << " with weights, "
+                        << max_cost( unweighted ) << " without, average " << total / N << std::endl;
+            EXPECT( max_cost( weighted ) <= total / N + 2. * 10. );
+            EXPECT( max_cost( weighted ) < max_cost( unweighted ) );
+
+            // Weights from a callback give the same partitions as from a field
+            grid::Distribution callback( grid,
+                                         grid::Partitioner( type, N, [&w]( gidx_t j ) { return w( idx_t( j ) ); } ) );
+            for ( idx_t j = 0; j < grid.size(); ++j ) {
+                EXPECT( callback.partition( j ) == weighted.partition( j ) );
+            }
+        }
+    }
+}
+
 CASE( "test_gaussian_latitudes" ) {
     std::vector<double> factory_latitudes;
     std::vector<double> computed_latitudes;
     std::vector<double> computed_weights;
 
-    size_t size_test_N = 19;
+    // all tabulated N, which are computed in O(N) for N > 50
+    size_t size_test_N = 23;
 
     size_t test_N[] = {16,  24,  32,  48,  64,  80,   96,   128,  160,  200,  256, 320,
                        400, 512, 576, 640, 800, 1024, 1280, 1600, 2000, 4000, 8000};
@@ -205,6 +306,43 @@ CASE( "test_gaussian_latitudes" ) {
     }
 }
 
+CASE( "test_classic_gaussian_tables" ) {
+    // Tabulated values are decoded exactly
+    std::vector<double> lats( 16 );
+    grid::spacing::gaussian::gaussian_latitudes_npole_equator( 16, lats.data() );
+    EXPECT( lats.front() == 85.7605871204438159 );
+    EXPECT( lats.back() == 2.7689030077360099 );
+
+    // Tabulated values match the computed ones. The legacy tables for large N deviate up to ~1e-11 degrees
+    // near the pole, so the tolerance grows linearly beyond N = 256
+    const size_t tabulated_N[] = {16,  24,  32,  48,  64,  80,   96,   128,  160,  200,  256, 320,
+                                  400, 512, 576, 640, 800, 1024, 1280, 1600, 2000, 4000, 8000};
+    for ( size_t N : tabulated_N ) {
+        std::vector<double> tabulated( N );
+        std::vector<double> computed( N );
+        std::vector<double> weights( N );
+        grid::spacing::gaussian::gaussian_latitudes_npole_equator( N, tabulated.data() );
+        grid::spacing::gaussian::compute_gaussian_quadrature_npole_equator( N, computed.data(), weights.data() );
+        const double tolerance = 1.e-12 * std::max( 1., N / 256. );
+        for ( size_t j = 0; j < N; ++j ) {
+            EXPECT( eckit::types::is_approximately_equal( tabulated[j], computed[j], tolerance ) );
+        }
+    }
+
+    std::vector<int> pl( 2 * 32 );
+    grid::detail::pl::classic_gaussian::points_per_latitude_npole_spole( 32, pl.data() );
+    const std::vector<int> expected{20,  27,  36,  40,  45,  50,  60,  64,  72,  75,  80,  90,  90,  96,  100, 108,
+                                    108, 120, 120, 120, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128};
+    for ( size_t j = 0; j < 32; ++j ) {
+        EXPECT( pl[j] == expected[j] );
+        EXPECT( pl[2 * 32 - 1 - j] == expected[j] );
+    }
+
+    std::vector<long> pl_N33( 33 );
+    EXPECT_THROWS_AS( grid::detail::pl::classic_gaussian::points_per_latitude_npole_equator( 33, pl_N33.data() ),
+                      eckit::BadParameter );
+}
+
 CASE( "test_rgg_meshgen_one_part" ) {
     Mesh m;
     util::Config default_opts;
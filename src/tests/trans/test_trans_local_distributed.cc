@@ -0,0 +1,168 @@
+/*
+ * (C) Copyright 2013 ECMWF.
+ *
+ * This software is licensed under the terms of the Apache Licence Version 2.0
+ * which can be obtained at http://www.apache.org/licenses/LICENSE-2.0.
+ * In applying this licence, ECMWF does not waive the privileges and immunities
+ * granted to it by virtue of its status as an intergovernmental organisation
+ * nor does it submit to any jurisdiction.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "atlas/functionspace/Spectral.h"
+#include "atlas/functionspace/StructuredColumns.h"
+#include "atlas/grid.h"
+#include "atlas/grid/Partitioner.h"
+#include "atlas/parallel/mpi/mpi.h"
+#include "atlas/trans/Trans.h"
+#include "atlas/trans/local/TransLocal.h"
+
+#include "tests/AtlasTestEnvironment.h"
+
+namespace atlas {
+namespace test {
+
+//-----------------------------------------------------------------------------
+
+namespace {
+
+// Global spectral data in the layout of TransLocal
+std::vector<double> global_spectra( int trc, int nb_fields, int offset ) {
+    std::vector<double> sp( ( trc + 1 ) * ( trc + 2 ) * nb_fields );
+    int k = 0;
+    for ( int m = 0; m <= trc; m++ ) {
+        for ( int n = m; n <= trc; n++ ) {
+            for ( int imag = 0; imag <= 1; imag++ ) {
+                bool zero = ( m == 0 && imag == 1 ) || ( offset > 0 && n == 0 );
+                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                    sp[k++] = zero ? 0. : 1. / ( 1. + offset + n + m + imag + jfld );
+                }
+            }
+        }
+    }
+    return sp;
+}
+
+// Spectral data of the given zonal wavenumbers, out of the global spectral data
+std::vector<double> local_spectra( int trc, int nb_fields, const std::vector<int>& zonal_wavenumbers,
+                                   const std::vector<double>& global ) {
+    std::vector<double> sp;
+    for ( int m : zonal_wavenumbers ) {
+        size_t begin = size_t( 2 * trc + 3 - m ) * m / 2 * nb_fields * 2;
+        size_t end   = begin + 2 * ( trc + 1 - m ) * nb_fields;
+        sp.insert( sp.end(), global.begin() + begin, global.begin() + end );
+    }
+    return sp;
+}
+
+// Grid-point data of the owned points of fs, out of the global grid-point data
+std::vector<double> local_gridpoints( const functionspace::StructuredColumns& fs, int nb_fields,
+                                      const std::vector<double>& global ) {
+    const grid::StructuredGrid& g = fs.grid();
+    std::vector<size_t> begin( g.ny() + 1, 0 );
+    for ( idx_t j = 0; j < g.ny(); ++j ) {
+        begin[j + 1] = begin[j] + g.nx( j );
+    }
+    std::vector<double> gp( nb_fields * fs.sizeOwned() );
+    for ( int jfld = 0; jfld < nb_fields; ++jfld ) {
+        for ( idx_t j = fs.j_begin(); j < fs.j_end(); ++j ) {
+            for ( idx_t i = fs.i_begin( j ); i < fs.i_end( j ); ++i ) {
+                gp[jfld * fs.sizeOwned() + fs.index( i, j )] = global[jfld * g.size() + begin[j] + i];
+            }
+        }
+    }
+    return gp;
+}
+
+double max_diff( const std::vector<double>& a, const std::vector<double>& b ) {
+    EXPECT( a.size() == b.size() );
+    double diff = 0.;
+    for ( size_t j = 0; j < a.size(); ++j ) {
+        diff = std::max( diff, std::abs( a[j] - b[j] ) );
+    }
+    mpi::comm().allReduceInPlace( diff, eckit::mpi::max() );
+    return diff;
+}
+
+void check_distributed( const std::string& gridname, int trc ) {
+    Log::info() << "check_distributed " << gridname << " T" << trc << " on " << mpi::comm().size() << " tasks"
+                << std::endl;
+    double tolerance = 1.e-10;
+
+    Grid g( gridname );
+    trans::Trans trans_serial( g, trc, util::Config( "type", "local" ) );
+
+    functionspace::StructuredColumns gp_fs( g, grid::Partitioner( "equal_regions" ) );
+    functionspace::Spectral sp_fs( trc );
+    trans::Trans trans( gp_fs, sp_fs, util::Config( "type", "local" ) );
+    auto translocal = dynamic_cast<const trans::TransLocal*>( trans.get() );
+    EXPECT( translocal != nullptr );
+
+    std::vector<int> zonal_wavenumbers = translocal->zonal_wavenumbers();
+    size_t nb_coefficients             = translocal->nb_spectral_coefficients();
+    mpi::comm().allReduceInPlace( nb_coefficients, eckit::mpi::sum() );
+    EXPECT( nb_coefficients == trans.spectralCoefficients() );
+
+    int nb_scalar = 2, nb_vordiv = 2;
+    std::vector<double> sp  = global_spectra( trc, nb_scalar, 0 );
+    std::vector<double> vor = global_spectra( trc, nb_vordiv, 1 );
+    std::vector<double> div = global_spectra( trc, nb_vordiv, 2 );
+
+    // serial reference
+    std::vector<double> gp( nb_scalar * g.size() );
+    std::vector<double> gpwind( 2 * nb_vordiv * g.size() );
+    trans_serial.invtrans( nb_scalar, sp.data(), gp.data() );
+    trans_serial.invtrans( nb_vordiv, vor.data(), div.data(), gpwind.data() );
+
+    // inverse transforms
+    std::vector<double> sp_loc  = local_spectra( trc, nb_scalar, zonal_wavenumbers, sp );
+    std::vector<double> vor_loc = local_spectra( trc, nb_vordiv, zonal_wavenumbers, vor );
+    std::vector<double> div_loc = local_spectra( trc, nb_vordiv, zonal_wavenumbers, div );
+    std::vector<double> gp_loc( nb_scalar * gp_fs.sizeOwned() );
+    std::vector<double> gpwind_loc( 2 * nb_vordiv * gp_fs.sizeOwned() );
+    EXPECT_NO_THROW( trans.invtrans( nb_scalar, sp_loc.data(), gp_loc.data() ) );
+    EXPECT_NO_THROW( trans.invtrans( nb_vordiv, vor_loc.data(), div_loc.data(), gpwind_loc.data() ) );
+    EXPECT( max_diff( gp_loc, local_gridpoints( gp_fs, nb_scalar, gp ) ) < tolerance );
+    EXPECT( max_diff( gpwind_loc, local_gridpoints( gp_fs, 2 * nb_vordiv, gpwind ) ) < tolerance );
+
+    // direct transforms revert the inverse transforms
+    std::vector<double> sp_dir( sp_loc.size() );
+    std::vector<double> vor_dir( vor_loc.size() );
+    std::vector<double> div_dir( div_loc.size() );
+    EXPECT_NO_THROW( trans.dirtrans( nb_scalar, gp_loc.data(), sp_dir.data() ) );
+    EXPECT_NO_THROW( trans.dirtrans( nb_vordiv, gpwind_loc.data(), vor_dir.data(), div_dir.data() ) );
+    EXPECT( max_diff( sp_loc, sp_dir ) < tolerance );
+    EXPECT( max_diff( vor_loc, vor_dir ) < tolerance );
+    EXPECT( max_diff( div_loc, div_dir ) < tolerance );
+}
+
+}  // namespace
+
+//-----------------------------------------------------------------------------
+
+CASE( "test_trans_local_distributed_regular" ) {
+    check_distributed( "F24", 15 );
+}
+
+CASE( "test_trans_local_distributed_reduced" ) {
+    check_distributed( "O32", 31 );
+}
+
+CASE( "test_trans_local_distributed_unsupported" ) {
+    // distributed transforms require a global Gaussian grid
+    Grid g( "L48x25" );
+    functionspace::StructuredColumns gp_fs( g, grid::Partitioner( "equal_regions" ) );
+    functionspace::Spectral sp_fs( 15 );
+    EXPECT_THROWS_AS( trans::Trans( gp_fs, sp_fs, util::Config( "type", "local" ) ), eckit::NotImplemented );
+}
+
+//-----------------------------------------------------------------------------
+
+}  // namespace test
+}  // namespace atlas
+
+int main( int argc, char** argv ) {
+    return atlas::test::run( argc, argv );
+}
@@ -262,6 +262,58 @@ CASE( "test cache creator in memory" ) {
     auto trans2 = Trans( cache, grid_global, truncation );
 }
 
+CASE( "test cache memory mapped from file" ) {
+    auto truncation = 63;
+    Grid grid( "F64" );
+
+    LegendreCacheCreator legendre_cache_creator( grid, truncation );
+    auto cachefile = CacheFile( "leg_mmap_" + legendre_cache_creator.uid() + ".bin" );
+    ATLAS_TRACE_SCOPE( "Creating cache " + std::string( cachefile ) )
+    legendre_cache_creator.create( cachefile );
+
+    Cache cache_read, cache_mapped;
+    ATLAS_TRACE_SCOPE( "read cache" )
+    cache_read = LegendreCache( cachefile );
+    ATLAS_TRACE_SCOPE( "map cache" )
+    cache_mapped = LegendreCache( cachefile, util::Config( "memory_map", true ) );
+    EXPECT( cache_mapped.legendre().size() == cache_read.legendre().size() );
+    EXPECT( hash( cache_mapped ) == hash( cache_read ) );
+
+    auto trans_read   = Trans( cache_read, grid, truncation );
+    auto trans_mapped = Trans( cache_mapped, grid, truncation );
+
+    std::vector<double> rspecg( trans_read.spectralCoefficients(), 1. );
+    std::vector<double> gp_read( grid.size() ), gp_mapped( grid.size() );
+    trans_read.invtrans( 1, rspecg.data(), gp_read.data() );
+    trans_mapped.invtrans( 1, rspecg.data(), gp_mapped.data() );
+    EXPECT( gp_read == gp_mapped );
+}
+
+CASE( "test cache butterfly" ) {
+    auto truncation = 127;
+    Grid grid( "F128" );
+    util::Config butterfly( "legendre_method", "butterfly" );
+
+    LegendreCacheCreator legendre_cache_creator( grid, truncation, butterfly );
+    EXPECT( legendre_cache_creator.uid() != LegendreCacheCreator( grid, truncation ).uid() );
+    auto cachefile = CacheFile( "leg_" + legendre_cache_creator.uid() + ".bin" );
+    ATLAS_TRACE_SCOPE( "Creating cache " + std::string( cachefile ) )
+    legendre_cache_creator.create( cachefile );
+
+    Cache cache_file = LegendreCache( cachefile );
+    Cache cache_mem  = legendre_cache_creator.create();
+    EXPECT( hash( cache_file ) == hash( cache_mem ) );
+
+    auto trans_nocache = Trans( grid, truncation, butterfly );
+    auto trans_cache   = Trans( cache_file, grid, truncation, butterfly );
+
+    std::vector<double> rspecg( trans_cache.spectralCoefficients(), 1. );
+    std::vector<double> gp_nocache( grid.size() ), gp_cache( grid.size() );
+    trans_nocache.invtrans( 1, rspecg.data(), gp_nocache.data() );
+    trans_cache.invtrans( 1, rspecg.data(), gp_cache.data() );
+    EXPECT( gp_nocache == gp_cache );
+}
+
 }  // namespace test
 }  // namespace atlas
 
@@ -376,6 +376,39 @@ double compute_rms( const size_t N,    // length of the arrays
     return rms;
 }
 
+//-----------------------------------------------------------------------------
+// Fill the spectral coefficients of nb_fields fields up to the given truncation,
+// in the layout of the transforms, with values decreasing with the wavenumbers
+//
+void fill_test_spectra( const int truncation, const int nb_fields, std::vector<double>& sp ) {
+    sp.resize( ( truncation + 2 ) * ( truncation + 1 ) * nb_fields );
+    int k = 0;
+    for ( int m = 0; m <= truncation; m++ ) {          // zonal wavenumber
+        for ( int n = m; n <= truncation; n++ ) {      // total wavenumber
+            for ( int imag = 0; imag <= 1; imag++ ) {  // real and imaginary part
+                // imaginary parts for m=0 do not contribute to the grid point values
+                for ( int jfld = 0; jfld < nb_fields; jfld++ ) {
+                    sp[k * nb_fields + jfld] = ( m == 0 && imag == 1 ) ? 0. : 1. / ( 1. + n + m + imag + jfld );
+                }
+                k++;
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Maximum absolute difference between two arrays divided by the maximum
+// absolute value of the first array
+//
+double max_relative_difference( const std::vector<double>& reference, const std::vector<double>& values ) {
+    double max_ref = 0., max_diff = 0.;
+    for ( size_t j = 0; j < reference.size(); ++j ) {
+        max_ref  = std::max( max_ref, std::abs( reference[j] ) );
+        max_diff = std::max( max_diff, std::abs( reference[j] - values[j] ) );
+    }
+    return max_diff / max_ref;
+}
+
 //-----------------------------------------------------------------------------
 #if 1
 CASE( "test_trans_vordiv_with_translib" ) {
@@ -1331,6 +1364,371 @@ CASE( "test_trans_unstructured" ) {
 
 //-----------------------------------------------------------------------------
 
+#if 1
+CASE( "test_trans_dirtrans" ) {
+    Log::info() << "test_trans_dirtrans" << std::endl;
+    // test direct transform by checking that it reverts the inverse transform, for a regular and a reduced grid
+    // (the truncation is low enough for the Fourier truncation of the reduced grid not to affect the accuracy)
+
+    double tolerance = 1.e-10;
+
+    int trc = 15;
+    int nb_scalar = 2, nb_vordiv = 2;
+    int N = ( trc + 2 ) * ( trc + 1 ) / 2;
+    std::vector<double> sp;
+    fill_test_spectra( trc, nb_scalar, sp );
+    std::vector<double> vor( 2 * N * nb_vordiv );
+    std::vector<double> div( 2 * N * nb_vordiv );
+    int k = 0;
+    for ( int m = 0; m <= trc; m++ ) {                 // zonal wavenumber
+        for ( int n = m; n <= trc; n++ ) {             // total wavenumber
+            for ( int imag = 0; imag <= 1; imag++ ) {  // real and imaginary part
+                // imaginary parts for m=0 do not contribute to the grid point values,
+                // neither does the global mean of vorticity and divergence
+                bool zero = ( m == 0 && imag == 1 );
+                for ( int jfld = 0; jfld < nb_vordiv; jfld++ ) {
+                    vor[k * nb_vordiv + jfld] = ( zero || n == 0 ) ? 0. : 1. / ( 2. + n - m + imag + jfld );
+                    div[k * nb_vordiv + jfld] = ( zero || n == 0 ) ? 0. : 1. / ( 3. + n + imag + jfld );
+                }
+                k++;
+            }
+        }
+    }
+
+    std::vector<double> sp_dir( sp.size() );
+    std::vector<double> vor_dir( vor.size() );
+    std::vector<double> div_dir( div.size() );
+    for ( std::string gridname : {"F24", "O24"} ) {
+        Log::info() << "grid " << gridname << std::endl;
+        Grid g( gridname );
+        trans::Trans trans( g, trc, util::Config( "type", "local" ) );
+
+        std::vector<double> gp( nb_scalar * g.size() );
+        std::vector<double> gpwind( 2 * nb_vordiv * g.size() );
+        EXPECT_NO_THROW( trans.invtrans( nb_scalar, sp.data(), gp.data() ) );
+        EXPECT_NO_THROW( trans.invtrans( nb_vordiv, vor.data(), div.data(), gpwind.data() ) );
+
+        EXPECT_NO_THROW( trans.dirtrans( nb_scalar, gp.data(), sp_dir.data() ) );
+        EXPECT_NO_THROW( trans.dirtrans( nb_vordiv, gpwind.data(), vor_dir.data(), div_dir.data() ) );
+
+        ATLAS_DEBUG_VAR( max_relative_difference( sp, sp_dir ) );
+        ATLAS_DEBUG_VAR( max_relative_difference( vor, vor_dir ) );
+        ATLAS_DEBUG_VAR( max_relative_difference( div, div_dir ) );
+        EXPECT( max_relative_difference( sp, sp_dir ) < tolerance );
+        EXPECT( max_relative_difference( vor, vor_dir ) < tolerance );
+        EXPECT( max_relative_difference( div, div_dir ) < tolerance );
+    }
+
+    // direct transforms are not supported for grids that are not Gaussian
+    trans::Trans trans_lonlat( Grid( "L48x25" ), trc, util::Config( "type", "local" ) );
+    std::vector<double> gp_lonlat( trans_lonlat.grid().size() );
+    EXPECT_THROWS_AS( trans_lonlat.dirtrans( 1, gp_lonlat.data(), sp_dir.data() ), eckit::NotImplemented );
+}
+#endif
+
+//-----------------------------------------------------------------------------
+
+#if 1
+CASE( "test_trans_legendre_single_precision_storage" ) {
+    Log::info() << "test_trans_legendre_single_precision_storage" << std::endl;
+    // Legendre coefficients stored in single precision should give results close to double precision
+
+    double tolerance = 1.e-5;
+
+    Grid g( "O32" );
+    int trc = 31;
+    trans::Trans trans_dp( g, trc, util::Config( "type", "local" ) );
+    trans::Trans trans_sp( g, trc, util::Config( "type", "local" ) | util::Config( "legendre_storage", "single" ) );
+
+    int nb_scalar = 3;
+    std::vector<double> sp;
+    fill_test_spectra( trc, nb_scalar, sp );
+
+    std::vector<double> gp_dp( nb_scalar * g.size() );
+    std::vector<double> gp_sp( nb_scalar * g.size() );
+    EXPECT_NO_THROW( trans_dp.invtrans( nb_scalar, sp.data(), gp_dp.data() ) );
+    EXPECT_NO_THROW( trans_sp.invtrans( nb_scalar, sp.data(), gp_sp.data() ) );
+
+    double diff = max_relative_difference( gp_dp, gp_sp );
+    ATLAS_DEBUG_VAR( diff );
+    EXPECT( diff < tolerance );
+    EXPECT( diff > 0. );  // make sure single precision coefficients were used
+}
+#endif
+
+//-----------------------------------------------------------------------------
+
+#if 1
+CASE( "test_trans_legendre_butterfly" ) {
+    Log::info() << "test_trans_legendre_butterfly" << std::endl;
+    // Butterfly compressed Legendre transforms should agree with the dense transforms within the tolerance
+    // of the compression
+
+    double tolerance = 1.e-6;
+
+    // A small leaf size lets the coefficients of a small grid be compressed; see the sandbox
+    // benchmark_trans_butterfly for a high resolution comparison
+    Grid g( "O32" );
+    int trc                = 31;
+    util::Config butterfly = util::Config( "type", "local" ) | util::Config( "legendre_method", "butterfly" ) |
+                             util::Config( "butterfly_leaf_size", 4 );
+    trans::Trans trans_dense( g, trc, util::Config( "type", "local" ) );
+    trans::Trans trans_butterfly( g, trc, butterfly | util::Config( "butterfly_tolerance", 1.e-8 ) );
+
+    int nb_scalar = 3;
+    std::vector<double> sp;
+    fill_test_spectra( trc, nb_scalar, sp );
+
+    std::vector<double> gp_dense( nb_scalar * g.size() );
+    std::vector<double> gp_butterfly( nb_scalar * g.size() );
+    EXPECT_NO_THROW( trans_dense.invtrans( nb_scalar, sp.data(), gp_dense.data() ) );
+    EXPECT_NO_THROW( trans_butterfly.invtrans( nb_scalar, sp.data(), gp_butterfly.data() ) );
+
+    double diff = max_relative_difference( gp_dense, gp_butterfly );
+    ATLAS_DEBUG_VAR( diff );
+    EXPECT( diff < tolerance );
+    EXPECT( diff > 0. );  // make sure the compression was effective
+
+    std::vector<double> sp_dense( sp.size() );
+    std::vector<double> sp_butterfly( sp.size() );
+    EXPECT_NO_THROW( trans_dense.dirtrans( nb_scalar, gp_dense.data(), sp_dense.data() ) );
+    EXPECT_NO_THROW( trans_butterfly.dirtrans( nb_scalar, gp_dense.data(), sp_butterfly.data() ) );
+
+    ATLAS_DEBUG_VAR( max_relative_difference( sp_dense, sp_butterfly ) );
+    EXPECT( max_relative_difference( sp_dense, sp_butterfly ) < tolerance );
+
+    // butterfly compression is only implemented for global grids, in double precision
+    EXPECT_THROWS_AS( trans::Trans( g, RectangularDomain( {-1., 1.}, {50., 55.} ), trc, butterfly ),
+                      eckit::NotImplemented );
+    EXPECT_THROWS_AS( trans::Trans( g, trc, butterfly | util::Config( "legendre_storage", "single" ) ),
+                      eckit::NotImplemented );
+}
+
+CASE( "test_trans_legendre_on_the_fly" ) {
+    Log::info() << "test_trans_legendre_on_the_fly" << std::endl;
+    // Legendre polynomials recomputed within the transforms should give the same results as precomputed ones
+
+    double tolerance = 1.e-12;
+
+    // latitude bands are of 8 latitudes, and O30 and F45 have a number of latitudes per hemisphere that is not
+    // a multiple of it, so that the last band is partial
+    util::Config on_the_fly = util::Config( "type", "local" ) | util::Config( "legendre_method", "on_the_fly" );
+    for ( auto grid_trc : std::vector<std::pair<std::string, int>>{{"O48", 47}, {"O30", 29}, {"F45", 44}} ) {
+        Log::info() << "grid " << grid_trc.first << ", truncation " << grid_trc.second << std::endl;
+        Grid g( grid_trc.first );
+        int trc = grid_trc.second;
+        trans::Trans trans_dense( g, trc, util::Config( "type", "local" ) );
+        trans::Trans trans_on_the_fly( g, trc, on_the_fly );
+
+        int nb_scalar = 2;
+        std::vector<double> sp;
+        fill_test_spectra( trc, nb_scalar, sp );
+
+        std::vector<double> gp_dense( nb_scalar * g.size() );
+        std::vector<double> gp_on_the_fly( nb_scalar * g.size() );
+        EXPECT_NO_THROW( trans_dense.invtrans( nb_scalar, sp.data(), gp_dense.data() ) );
+        EXPECT_NO_THROW( trans_on_the_fly.invtrans( nb_scalar, sp.data(), gp_on_the_fly.data() ) );
+
+        ATLAS_DEBUG_VAR( max_relative_difference( gp_dense, gp_on_the_fly ) );
+        EXPECT( max_relative_difference( gp_dense, gp_on_the_fly ) < tolerance );
+
+        std::vector<double> sp_dense( sp.size() );
+        std::vector<double> sp_on_the_fly( sp.size() );
+        EXPECT_NO_THROW( trans_dense.dirtrans( nb_scalar, gp_dense.data(), sp_dense.data() ) );
+        EXPECT_NO_THROW( trans_on_the_fly.dirtrans( nb_scalar, gp_dense.data(), sp_on_the_fly.data() ) );
+
+        ATLAS_DEBUG_VAR( max_relative_difference( sp_dense, sp_on_the_fly ) );
+        EXPECT( max_relative_difference( sp_dense, sp_on_the_fly ) < tolerance );
+    }
+
+    // recomputation is only implemented for global grids, without caches
+    Grid g( "O48" );
+    int trc = 47;
+    EXPECT_THROWS_AS( trans::Trans( g, RectangularDomain( {-1., 1.}, {50., 55.} ), trc, on_the_fly ),
+                      eckit::NotImplemented );
+    EXPECT_THROWS_AS( trans::Trans( g, trc, on_the_fly | util::Config( "export_legendre", true ) ),
+                      eckit::NotImplemented );
+}
+
+CASE( "test_trans_invtrans_fields" ) {
+    Log::info() << "test_trans_invtrans_fields" << std::endl;
+    // Inverse transforms of Spectral and StructuredColumns fields with levels should agree with the inverse
+    // transforms of the raw arrays, and the gradient of a spherical harmonic with its analytic gradient
+
+    double tolerance = 1.e-12;
+
+    Grid g( "O32" );
+    int trc = 31;
+    trans::Trans trans( g, trc, util::Config( "type", "local" ) );
+    functionspace::StructuredColumns gridpoints( g );
+    functionspace::Spectral spectral( trc );
+
+    int nb_levels = 2;
+    int N = ( trc + 2 ) * ( trc + 1 ) / 2;
+    std::vector<double> sp;
+    fill_test_spectra( trc, nb_levels, sp );
+    std::vector<double> gp( nb_levels * g.size() );
+    trans.invtrans( nb_levels, sp.data(), gp.data() );
+
+    // a spectral field with levels has the layout of the raw spectral array
+    Field spf = spectral.createField<double>( option::name( "spf" ) | option::levels( nb_levels ) );
+    Field gpf = gridpoints.createField<double>( option::name( "gpf" ) | option::levels( nb_levels ) );
+    auto spv  = array::make_view<double, 2>( spf );
+    for ( int jsp = 0; jsp < 2 * N; ++jsp ) {
+        for ( int jlev = 0; jlev < nb_levels; ++jlev ) {
+            spv( jsp, jlev ) = sp[jsp * nb_levels + jlev];
+        }
+    }
+    EXPECT_NO_THROW( trans.invtrans( spf, gpf ) );
+
+    auto gpv = array::make_view<double, 2>( gpf );
+    std::vector<double> gp_field( gp.size() );
+    for ( idx_t jgp = 0; jgp < g.size(); ++jgp ) {
+        for ( int jlev = 0; jlev < nb_levels; ++jlev ) {
+            gp_field[jlev * g.size() + jgp] = gpv( jgp, jlev );
+        }
+    }
+    ATLAS_DEBUG_VAR( max_relative_difference( gp, gp_field ) );
+    EXPECT( max_relative_difference( gp, gp_field ) < tolerance );
+
+    // the wind of vorticity and divergence fields
+    Field vorf  = spectral.createField<double>( option::name( "vor" ) );
+    Field divf  = spectral.createField<double>( option::name( "div" ) );
+    Field windf = gridpoints.createField<double>( option::name( "wind" ) | option::variables( 2 ) );
+    auto vorv   = array::make_view<double, 1>( vorf );
+    auto divv   = array::make_view<double, 1>( divf );
+    std::vector<double> vor( 2 * N ), div( 2 * N );
+    for ( int jsp = 0; jsp < 2 * N; ++jsp ) {
+        vor[jsp] = vorv( jsp ) = sp[jsp * nb_levels];
+        div[jsp] = divv( jsp ) = sp[jsp * nb_levels + 1];
+    }
+    std::vector<double> wind( 2 * g.size() );
+    trans.invtrans( 1, vor.data(), div.data(), wind.data() );
+    EXPECT_NO_THROW( trans.invtrans_vordiv2wind( vorf, divf, windf ) );
+
+    auto windv = array::make_view<double, 2>( windf );
+    std::vector<double> wind_field( wind.size() );
+    for ( idx_t jgp = 0; jgp < g.size(); ++jgp ) {
+        for ( int jcomp = 0; jcomp < 2; ++jcomp ) {
+            wind_field[jcomp * g.size() + jgp] = windv( jgp, jcomp );
+        }
+    }
+    ATLAS_DEBUG_VAR( max_relative_difference( wind, wind_field ) );
+    EXPECT( max_relative_difference( wind, wind_field ) < tolerance );
+
+    // the gradient of f = cos(lat) cos(lon) is ( -sin(lon), -sin(lat) cos(lon) ) / radius
+    grid::StructuredGrid gs( g );
+    std::vector<double> f( g.size() );
+    std::vector<double> sp_f( 2 * N );
+    idx_t jgp = 0;
+    for ( idx_t j = 0; j < gs.ny(); ++j ) {
+        for ( idx_t i = 0; i < gs.nx( j ); ++i, ++jgp ) {
+            f[jgp] = std::cos( gs.y( j ) * util::Constants::degreesToRadians() ) *
+                     std::cos( gs.x( i, j ) * util::Constants::degreesToRadians() );
+        }
+    }
+    trans.dirtrans( 1, f.data(), sp_f.data() );
+
+    Field fieldf = spectral.createField<double>( option::name( "f" ) );
+    Field gradf  = gridpoints.createField<double>( option::name( "grad" ) | option::variables( 2 ) );
+    auto fieldv  = array::make_view<double, 1>( fieldf );
+    for ( int jsp = 0; jsp < 2 * N; ++jsp ) {
+        fieldv( jsp ) = sp_f[jsp];
+    }
+    EXPECT_NO_THROW( trans.invtrans_grad( fieldf, gradf ) );
+
+    auto gradv           = array::make_view<double, 2>( gradf );
+    const double radius  = util::Earth::radius();
+    double max_grad_diff = 0.;
+    jgp                  = 0;
+    for ( idx_t j = 0; j < gs.ny(); ++j ) {
+        for ( idx_t i = 0; i < gs.nx( j ); ++i, ++jgp ) {
+            const double lat = gs.y( j ) * util::Constants::degreesToRadians();
+            const double lon = gs.x( i, j ) * util::Constants::degreesToRadians();
+            max_grad_diff    = std::max( max_grad_diff, std::abs( gradv( jgp, 0 ) * radius + std::sin( lon ) ) );
+            max_grad_diff =
+                std::max( max_grad_diff, std::abs( gradv( jgp, 1 ) * radius + std::sin( lat ) * std::cos( lon ) ) );
+        }
+    }
+    ATLAS_DEBUG_VAR( max_grad_diff );
+    EXPECT( max_grad_diff < 1.e-10 );
+
+    // fields of other function spaces or numbers of levels are rejected
+    EXPECT_THROWS_AS( trans.invtrans( gpf, gpf ), eckit::BadParameter );
+    EXPECT_THROWS_AS( trans.invtrans( vorf, gpf ), eckit::BadParameter );
+}
+
+CASE( "test_trans_fftw_plan_reuse" ) {
+    Log::info() << "test_trans_fftw_plan_reuse" << std::endl;
+    // TransLocal instances for the same grid share their FFTW plans; transforms of later instances, also of
+    // other truncations, should give the results of the first one
+
+    for ( std::string gridname : {"O32", "F32"} ) {
+        Grid g( gridname );
+        int trc = 31;
+        trans::Trans trans_first( g, trc, util::Config( "type", "local" ) );
+        trans::Trans trans_second( g, trc, util::Config( "type", "local" ) );
+        trans::Trans trans_lower( g, trc / 2, util::Config( "type", "local" ) );
+
+        int nb_scalar = 3;
+        std::vector<double> sp;
+        fill_test_spectra( trc, nb_scalar, sp );
+
+        std::vector<double> gp_first( nb_scalar * g.size() );
+        std::vector<double> gp_second( nb_scalar * g.size() );
+        trans_first.invtrans( nb_scalar, sp.data(), gp_first.data() );
+        trans_second.invtrans( nb_scalar, sp.data(), gp_second.data() );
+        EXPECT( gp_first == gp_second );
+
+        std::vector<double> sp_first( sp.size() );
+        std::vector<double> sp_second( sp.size() );
+        trans_first.dirtrans( nb_scalar, gp_first.data(), sp_first.data() );
+        trans_second.dirtrans( nb_scalar, gp_first.data(), sp_second.data() );
+        EXPECT( sp_first == sp_second );
+
+        // the lower truncation only keeps the coefficients up to trc/2
+        int N_lower = ( trc / 2 + 2 ) * ( trc / 2 + 1 ) / 2;
+        std::vector<double> sp_lower( 2 * N_lower * nb_scalar );
+        EXPECT_NO_THROW( trans_lower.dirtrans( nb_scalar, gp_first.data(), sp_lower.data() ) );
+        EXPECT( std::abs( sp_lower[0] - sp_first[0] ) < 1.e-12 * std::abs( sp_first[0] ) );
+    }
+}
+
+CASE( "test_trans_fftw_threads" ) {
+    Log::info() << "test_trans_fftw_threads" << std::endl;
+    // FFTs of all latitudes of a regular grid executed by several threads should give the results of
+    // single-threaded ones. Without OpenMP support in FFTW (ATLAS_HAVE_FFTW_OMP), both are single-threaded.
+
+    double tolerance = 1.e-12;
+
+    Grid g( "F32" );
+    int trc = 31;
+    trans::Trans trans_serial( g, trc, util::Config( "type", "local" ) | util::Config( "fftw_threads", 1 ) );
+    trans::Trans trans_threaded( g, trc, util::Config( "type", "local" ) | util::Config( "fftw_threads", 4 ) );
+    Log::info() << "FFTW with OpenMP support: " << ATLAS_HAVE_FFTW_OMP << std::endl;
+
+    int nb_scalar = 3;
+    std::vector<double> sp;
+    fill_test_spectra( trc, nb_scalar, sp );
+
+    std::vector<double> gp_serial( nb_scalar * g.size() );
+    std::vector<double> gp_threaded( nb_scalar * g.size() );
+    EXPECT_NO_THROW( trans_serial.invtrans( nb_scalar, sp.data(), gp_serial.data() ) );
+    EXPECT_NO_THROW( trans_threaded.invtrans( nb_scalar, sp.data(), gp_threaded.data() ) );
+    ATLAS_DEBUG_VAR( max_relative_difference( gp_serial, gp_threaded ) );
+    EXPECT( max_relative_difference( gp_serial, gp_threaded ) < tolerance );
+
+    std::vector<double> sp_serial( sp.size() );
+    std::vector<double> sp_threaded( sp.size() );
+    EXPECT_NO_THROW( trans_serial.dirtrans( nb_scalar, gp_serial.data(), sp_serial.data() ) );
+    EXPECT_NO_THROW( trans_threaded.dirtrans( nb_scalar, gp_serial.data(), sp_threaded.data() ) );
+    ATLAS_DEBUG_VAR( max_relative_difference( sp_serial, sp_threaded ) );
+    EXPECT( max_relative_difference( sp_serial, sp_threaded ) < tolerance );
+}
+#endif
+
+//-----------------------------------------------------------------------------
+
 #if 0
 CASE( "test_trans_fourier_truncation" ) {
     Log::info() << "test_trans_fourier_truncation" << std::endl;
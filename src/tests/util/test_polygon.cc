@@ -12,6 +12,7 @@
 #include <cmath>
 #include <utility>
 
+#include "atlas/util/LonLatPolygon.h"
 #include "atlas/util/Point.h"
 #include "atlas/util/SphericalPolygon.h"
 
@@ -59,6 +60,28 @@ CASE( "test_polygon_something" ) {
     }
 }
 
+CASE( "test_lonlatpolygon_edges_crossing" ) {
+    using util::LonLatPolygon;
+    using p = PointLonLat;
+
+    LonLatPolygon poly( std::vector<PointLonLat>{p( 0, 0 ), p( 10, 0 ), p( 10, 5 ), p( 5, 5 ), p( 5, 10 ), p( 10, 10 ),
+                                                 p( 10, 15 ), p( 0, 15 ), p( 0, 0 )} );
+
+    // Testing only the edges crossed by the parallel of a point gives the same result as testing all edges,
+    // also for points on edges and vertices
+    std::vector<idx_t> edges;
+    for ( double lat = -2.5; lat <= 17.5; lat += 1.25 ) {
+        poly.edgesCrossing( lat, edges );
+        for ( double lon = -2.5; lon <= 12.5; lon += 1.25 ) {
+            EXPECT( poly.contains( p( lon, lat ), edges ) == poly.contains( p( lon, lat ) ) );
+        }
+    }
+    poly.edgesCrossing( 7.5, edges );
+    EXPECT( edges.size() == 2 );
+    EXPECT( poly.contains( p( 2.5, 7.5 ), edges ) );
+    EXPECT( not poly.contains( p( 7.5, 7.5 ), edges ) );
+}
+
 }  // namespace test
 }  // namespace atlas
 